@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -66,9 +71,8 @@
 #define yydebug         mdldebug
 #define yynerrs         mdlnerrs
 
-
-/* Copy the first part of user declarations.  */
-#line 1 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 1 "../src/mdlparse.y"
 
   #include "config.h"
   #include <stdio.h>
@@ -133,416 +137,712 @@
   #undef yyerror
   #define yyerror(a, b, c) mdlerror(a, c)
 
-#line 137 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:339  */
+#line 141 "mdlparse.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "mdlparse.h".  */
-#ifndef YY_MDL_HOME_JCZECH_MCELL_BUILD_DEPS_MDLPARSE_H_INCLUDED
-# define YY_MDL_HOME_JCZECH_MCELL_BUILD_DEPS_MDLPARSE_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int mdldebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    ABS = 258,
-    ABSORPTIVE = 259,
-    ACCURATE_3D_REACTIONS = 260,
-    ACOS = 261,
-    ALL_CROSSINGS = 262,
-    ALL_DATA = 263,
-    ALL_ELEMENTS = 264,
-    ALL_ENCLOSED = 265,
-    ALL_HITS = 266,
-    ALL_ITERATIONS = 267,
-    ALL_MOLECULES = 268,
-    ALL_NOTIFICATIONS = 269,
-    ALL_TIMES = 270,
-    ALL_WARNINGS = 271,
-    ASCII = 272,
-    ASIN = 273,
-    ASPECT_RATIO = 274,
-    ATAN = 275,
-    BACK = 276,
-    BACK_CROSSINGS = 277,
-    BACK_HITS = 278,
-    BOTTOM = 279,
-    BOX = 280,
-    BOX_TRIANGULATION_REPORT = 281,
-    BRIEF = 282,
-    CEIL = 283,
-    CELLBLENDER = 284,
-    CENTER_MOLECULES_ON_GRID = 285,
-    CHECKPOINT_INFILE = 286,
-    CHECKPOINT_ITERATIONS = 287,
-    CHECKPOINT_OUTFILE = 288,
-    CHECKPOINT_REALTIME = 289,
-    CHECKPOINT_REPORT = 290,
-    CLAMP_CONCENTRATION = 291,
-    CLOSE_PARTITION_SPACING = 292,
-    CONCENTRATION = 293,
-    CORNERS = 294,
-    COS = 295,
-    COUNT = 296,
-    CUBIC = 297,
-    CUBIC_RELEASE_SITE = 298,
-    CUSTOM_SPACE_STEP = 299,
-    CUSTOM_TIME_STEP = 300,
-    DEFINE_MOLECULE = 301,
-    DEFINE_MOLECULES = 302,
-    DEFINE_REACTIONS = 303,
-    DEFINE_RELEASE_PATTERN = 304,
-    DEFINE_SURFACE_CLASS = 305,
-    DEFINE_SURFACE_CLASSES = 306,
-    DEFINE_SURFACE_REGIONS = 307,
-    DEGENERATE_POLYGONS = 308,
-    DELAY = 309,
-    DENSITY = 310,
-    DIFFUSION_CONSTANT_2D = 311,
-    DIFFUSION_CONSTANT_3D = 312,
-    DIFFUSION_CONSTANT_REPORT = 313,
-    DYNAMIC_GEOMETRY = 314,
-    DYNAMIC_GEOMETRY_MOLECULE_PLACEMENT = 315,
-    EFFECTOR_GRID_DENSITY = 316,
-    ELEMENT_CONNECTIONS = 317,
-    ELLIPTIC = 318,
-    ELLIPTIC_RELEASE_SITE = 319,
-    EQUAL = 320,
-    ERROR = 321,
-    ESTIMATE_CONCENTRATION = 322,
-    EXCLUDE_ELEMENTS = 323,
-    EXCLUDE_PATCH = 324,
-    EXCLUDE_REGION = 325,
-    EXIT = 326,
-    EXP = 327,
-    EXPRESSION = 328,
-    EXTERN = 329,
-    FALSE = 330,
-    FCLOSE = 331,
-    FILENAME = 332,
-    FILENAME_PREFIX = 333,
-    FILE_OUTPUT_REPORT = 334,
-    FINAL_SUMMARY = 335,
-    FLOOR = 336,
-    FOPEN = 337,
-    FORMAT = 338,
-    FPRINTF = 339,
-    FPRINT_TIME = 340,
-    FRONT = 341,
-    FRONT_CROSSINGS = 342,
-    FRONT_HITS = 343,
-    GAUSSIAN_RELEASE_NUMBER = 344,
-    GEOMETRY = 345,
-    GRAPH_PATTERN = 346,
-    HEADER = 347,
-    HIGH_PROBABILITY_THRESHOLD = 348,
-    HIGH_REACTION_PROBABILITY = 349,
-    IGNORED = 350,
-    INCLUDE_ELEMENTS = 351,
-    INCLUDE_FILE = 352,
-    INCLUDE_PATCH = 353,
-    INCLUDE_REGION = 354,
-    INPUT_FILE = 355,
-    INSTANTIATE = 356,
-    LLINTEGER = 357,
-    FULLY_RANDOM = 358,
-    INTERACTION_RADIUS = 359,
-    ITERATION_LIST = 360,
-    ITERATION_NUMBERS = 361,
-    ITERATION_REPORT = 362,
-    ITERATIONS = 363,
-    KEEP_CHECKPOINT_FILES = 364,
-    LEFT = 365,
-    LIFETIME_THRESHOLD = 366,
-    LIFETIME_TOO_SHORT = 367,
-    LIST = 368,
-    LOCATION = 369,
-    LOG = 370,
-    LOG10 = 371,
-    MAX_TOK = 372,
-    MAXIMUM_STEP_LENGTH = 373,
-    MEAN_DIAMETER = 374,
-    MEAN_NUMBER = 375,
-    MEMORY_PARTITION_X = 376,
-    MEMORY_PARTITION_Y = 377,
-    MEMORY_PARTITION_Z = 378,
-    MEMORY_PARTITION_POOL = 379,
-    MICROSCOPIC_REVERSIBILITY = 380,
-    MIN_TOK = 381,
-    MISSED_REACTIONS = 382,
-    MISSED_REACTION_THRESHOLD = 383,
-    MISSING_SURFACE_ORIENTATION = 384,
-    MOD = 385,
-    MODE = 386,
-    MODIFY_SURFACE_REGIONS = 387,
-    MOLECULE = 388,
-    MOLECULE_COLLISION_REPORT = 389,
-    MOLECULE_DENSITY = 390,
-    MOLECULE_NUMBER = 391,
-    MOLECULE_POSITIONS = 392,
-    MOLECULES = 393,
-    MOLECULE_PLACEMENT_FAILURE = 394,
-    NAME_LIST = 395,
-    NEAREST_POINT = 396,
-    NEAREST_TRIANGLE = 397,
-    NEGATIVE_DIFFUSION_CONSTANT = 398,
-    NEGATIVE_REACTION_RATE = 399,
-    NO = 400,
-    NOEXIT = 401,
-    NONE = 402,
-    NO_SPECIES = 403,
-    NOT_EQUAL = 404,
-    NOTIFICATIONS = 405,
-    NUMBER_OF_SUBUNITS = 406,
-    NUMBER_OF_TRAINS = 407,
-    NUMBER_TO_RELEASE = 408,
-    OBJECT = 409,
-    OFF = 410,
-    ON = 411,
-    ORIENTATIONS = 412,
-    OUTPUT_BUFFER_SIZE = 413,
-    INVALID_OUTPUT_STEP_TIME = 414,
-    LARGE_MOLECULAR_DISPLACEMENT = 415,
-    ADD_REMOVE_MESH = 416,
-    OVERWRITTEN_OUTPUT_FILE = 417,
-    PARTITION_LOCATION_REPORT = 418,
-    PARTITION_X = 419,
-    PARTITION_Y = 420,
-    PARTITION_Z = 421,
-    PERIODIC_BOX = 422,
-    PERIODIC_X = 423,
-    PERIODIC_Y = 424,
-    PERIODIC_Z = 425,
-    PERIODIC_TRADITIONAL = 426,
-    PI_TOK = 427,
-    POLYGON_LIST = 428,
-    POSITIONS = 429,
-    PRINTF = 430,
-    PRINT_TIME = 431,
-    PROBABILITY_REPORT = 432,
-    PROBABILITY_REPORT_THRESHOLD = 433,
-    PROGRESS_REPORT = 434,
-    RADIAL_DIRECTIONS = 435,
-    RADIAL_SUBDIVISIONS = 436,
-    RAND_GAUSSIAN = 437,
-    RAND_UNIFORM = 438,
-    REACTION_DATA_OUTPUT = 439,
-    REACTION_OUTPUT_REPORT = 440,
-    REAL = 441,
-    RECTANGULAR_RELEASE_SITE = 442,
-    RECTANGULAR_TOKEN = 443,
-    REFLECTIVE = 444,
-    RELEASE_EVENT_REPORT = 445,
-    RELEASE_INTERVAL = 446,
-    RELEASE_PATTERN = 447,
-    RELEASE_PROBABILITY = 448,
-    RELEASE_SITE = 449,
-    REMOVE_ELEMENTS = 450,
-    RIGHT = 451,
-    ROTATE = 452,
-    ROUND_OFF = 453,
-    SCALE = 454,
-    SEED = 455,
-    SHAPE = 456,
-    SHOW_EXACT_TIME = 457,
-    SIN = 458,
-    SITE_DIAMETER = 459,
-    SITE_RADIUS = 460,
-    SPACE_STEP = 461,
-    SPHERICAL = 462,
-    SPHERICAL_RELEASE_SITE = 463,
-    SPHERICAL_SHELL = 464,
-    SPHERICAL_SHELL_SITE = 465,
-    SPRINTF = 466,
-    SQRT = 467,
-    STANDARD_DEVIATION = 468,
-    PERIODIC_BOX_INITIAL = 469,
-    STEP = 470,
-    STRING_TO_NUM = 471,
-    STR_VALUE = 472,
-    SUBUNIT = 473,
-    SUBUNIT_RELATIONSHIPS = 474,
-    SUMMATION_OPERATOR = 475,
-    SURFACE_CLASS = 476,
-    SURFACE_ONLY = 477,
-    TAN = 478,
-    TARGET_ONLY = 479,
-    TET_ELEMENT_CONNECTIONS = 480,
-    THROUGHPUT_REPORT = 481,
-    TIME_LIST = 482,
-    TIME_POINTS = 483,
-    TIME_STEP = 484,
-    TIME_STEP_MAX = 485,
-    TO = 486,
-    TOP = 487,
-    TRAIN_DURATION = 488,
-    TRAIN_INTERVAL = 489,
-    TRANSLATE = 490,
-    TRANSPARENT = 491,
-    TRIGGER = 492,
-    TRUE = 493,
-    UNLIMITED = 494,
-    USELESS_VOLUME_ORIENTATION = 495,
-    VACANCY_SEARCH_DISTANCE = 496,
-    VAR = 497,
-    VARYING_PROBABILITY_REPORT = 498,
-    VERTEX_LIST = 499,
-    VIZ_OUTPUT = 500,
-    VIZ_OUTPUT_REPORT = 501,
-    VIZ_VALUE = 502,
-    VOLUME_DATA_OUTPUT = 503,
-    VOLUME_OUTPUT_REPORT = 504,
-    VOLUME_DEPENDENT_RELEASE_NUMBER = 505,
-    VOLUME_ONLY = 506,
-    VOXEL_COUNT = 507,
-    VOXEL_LIST = 508,
-    VOXEL_SIZE = 509,
-    WARNING = 510,
-    WARNINGS = 511,
-    WORLD = 512,
-    YES = 513,
-    UNARYMINUS = 514
-  };
-#endif
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "mdlparse.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 67 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:355  */
-
-int ival;
-int tok;
-double dbl;
-long long llival;
-char *str;
-struct sym_entry *sym;
-struct vector3 *vec3;
-struct num_expr_list_head nlist;
-struct release_evaluator *rev;
-struct sym_table_list *symlist;
-struct output_times *otimes;
-
-/* Reaction output */
-struct output_times_inlist ro_otimes;
-struct output_column_list ro_cols;
-struct output_set *ro_set;
-struct output_set_list ro_sets;
-struct output_expression *cnt;
-
-/* Viz output */
-struct frame_data_list_head frame_list;
-
-/* Region definitions */
-struct element_list *elem_list_item;
-struct element_list_head elem_list;
-struct region *reg;
-
-/* Diffusion constants */
-struct diffusion_constant diff_const;
-
-/* Geometry */
-struct vertex_list_head vertlist;
-struct vertex_list *vertlistitem;
-struct element_connection_list_head ecl;
-struct element_connection_list *elem_conn;
-struct object *obj;
-struct object_list obj_list;
-struct voxel_object *voxel;
-
-/* Molecule species */
-struct mcell_species mol_type;
-struct mcell_species_list mol_type_list;
-struct mcell_species_spec *mcell_mol_spec;
-struct parse_mcell_species_list mcell_species_lst;
-struct sm_dat *surf_mol_dat;
-struct sm_dat_list surf_mol_dat_list;
-struct species_list species_lst;
-struct species_list_item *species_lst_item;
-
-/* Reactions */
-struct reaction_arrow react_arrow;
-struct reaction_rate  react_rate;
-struct reaction_rates react_rates;
-
-/* Release sites/patterns */
-struct release_pattern rpat;
-struct release_single_molecule *rsm;
-struct release_single_molecule_list rsm_list;
-
-/* printf arguments */
-struct arg *printfarg;
-struct arg_list printfargs;
-
-
-#line 503 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ABS = 3,                        /* ABS  */
+  YYSYMBOL_ABSORPTIVE = 4,                 /* ABSORPTIVE  */
+  YYSYMBOL_ACCURATE_3D_REACTIONS = 5,      /* ACCURATE_3D_REACTIONS  */
+  YYSYMBOL_ACOS = 6,                       /* ACOS  */
+  YYSYMBOL_ALL_CROSSINGS = 7,              /* ALL_CROSSINGS  */
+  YYSYMBOL_ALL_DATA = 8,                   /* ALL_DATA  */
+  YYSYMBOL_ALL_ELEMENTS = 9,               /* ALL_ELEMENTS  */
+  YYSYMBOL_ALL_ENCLOSED = 10,              /* ALL_ENCLOSED  */
+  YYSYMBOL_ALL_HITS = 11,                  /* ALL_HITS  */
+  YYSYMBOL_ALL_ITERATIONS = 12,            /* ALL_ITERATIONS  */
+  YYSYMBOL_ALL_MOLECULES = 13,             /* ALL_MOLECULES  */
+  YYSYMBOL_ALL_NOTIFICATIONS = 14,         /* ALL_NOTIFICATIONS  */
+  YYSYMBOL_ALL_TIMES = 15,                 /* ALL_TIMES  */
+  YYSYMBOL_ALL_WARNINGS = 16,              /* ALL_WARNINGS  */
+  YYSYMBOL_ASCII = 17,                     /* ASCII  */
+  YYSYMBOL_ASIN = 18,                      /* ASIN  */
+  YYSYMBOL_ASPECT_RATIO = 19,              /* ASPECT_RATIO  */
+  YYSYMBOL_ATAN = 20,                      /* ATAN  */
+  YYSYMBOL_BACK = 21,                      /* BACK  */
+  YYSYMBOL_BACK_CROSSINGS = 22,            /* BACK_CROSSINGS  */
+  YYSYMBOL_BACK_HITS = 23,                 /* BACK_HITS  */
+  YYSYMBOL_BOTTOM = 24,                    /* BOTTOM  */
+  YYSYMBOL_BOX = 25,                       /* BOX  */
+  YYSYMBOL_BOX_TRIANGULATION_REPORT = 26,  /* BOX_TRIANGULATION_REPORT  */
+  YYSYMBOL_BRIEF = 27,                     /* BRIEF  */
+  YYSYMBOL_CEIL = 28,                      /* CEIL  */
+  YYSYMBOL_CELLBLENDER = 29,               /* CELLBLENDER  */
+  YYSYMBOL_CENTER_MOLECULES_ON_GRID = 30,  /* CENTER_MOLECULES_ON_GRID  */
+  YYSYMBOL_CHECKPOINT_INFILE = 31,         /* CHECKPOINT_INFILE  */
+  YYSYMBOL_CHECKPOINT_ITERATIONS = 32,     /* CHECKPOINT_ITERATIONS  */
+  YYSYMBOL_CHECKPOINT_OUTFILE = 33,        /* CHECKPOINT_OUTFILE  */
+  YYSYMBOL_CHECKPOINT_REALTIME = 34,       /* CHECKPOINT_REALTIME  */
+  YYSYMBOL_CHECKPOINT_REPORT = 35,         /* CHECKPOINT_REPORT  */
+  YYSYMBOL_CLAMP_CONCENTRATION = 36,       /* CLAMP_CONCENTRATION  */
+  YYSYMBOL_CLOSE_PARTITION_SPACING = 37,   /* CLOSE_PARTITION_SPACING  */
+  YYSYMBOL_CONCENTRATION = 38,             /* CONCENTRATION  */
+  YYSYMBOL_CORNERS = 39,                   /* CORNERS  */
+  YYSYMBOL_COS = 40,                       /* COS  */
+  YYSYMBOL_COUNT = 41,                     /* COUNT  */
+  YYSYMBOL_CUBIC = 42,                     /* CUBIC  */
+  YYSYMBOL_CUBIC_RELEASE_SITE = 43,        /* CUBIC_RELEASE_SITE  */
+  YYSYMBOL_CUSTOM_SPACE_STEP = 44,         /* CUSTOM_SPACE_STEP  */
+  YYSYMBOL_CUSTOM_TIME_STEP = 45,          /* CUSTOM_TIME_STEP  */
+  YYSYMBOL_DEFINE_MOLECULE = 46,           /* DEFINE_MOLECULE  */
+  YYSYMBOL_DEFINE_MOLECULES = 47,          /* DEFINE_MOLECULES  */
+  YYSYMBOL_DEFINE_MOLECULE_STRUCTURES = 48, /* DEFINE_MOLECULE_STRUCTURES  */
+  YYSYMBOL_DEFINE_REACTIONS = 49,          /* DEFINE_REACTIONS  */
+  YYSYMBOL_DEFINE_RELEASE_PATTERN = 50,    /* DEFINE_RELEASE_PATTERN  */
+  YYSYMBOL_DEFINE_SURFACE_CLASS = 51,      /* DEFINE_SURFACE_CLASS  */
+  YYSYMBOL_DEFINE_SURFACE_CLASSES = 52,    /* DEFINE_SURFACE_CLASSES  */
+  YYSYMBOL_DEFINE_SURFACE_REGIONS = 53,    /* DEFINE_SURFACE_REGIONS  */
+  YYSYMBOL_DEGENERATE_POLYGONS = 54,       /* DEGENERATE_POLYGONS  */
+  YYSYMBOL_DELAY = 55,                     /* DELAY  */
+  YYSYMBOL_DENSITY = 56,                   /* DENSITY  */
+  YYSYMBOL_DIFFUSION_CONSTANT_2D = 57,     /* DIFFUSION_CONSTANT_2D  */
+  YYSYMBOL_DIFFUSION_CONSTANT_3D = 58,     /* DIFFUSION_CONSTANT_3D  */
+  YYSYMBOL_DIFFUSION_CONSTANT_REPORT = 59, /* DIFFUSION_CONSTANT_REPORT  */
+  YYSYMBOL_DYNAMIC_GEOMETRY = 60,          /* DYNAMIC_GEOMETRY  */
+  YYSYMBOL_DYNAMIC_GEOMETRY_MOLECULE_PLACEMENT = 61, /* DYNAMIC_GEOMETRY_MOLECULE_PLACEMENT  */
+  YYSYMBOL_EFFECTOR_GRID_DENSITY = 62,     /* EFFECTOR_GRID_DENSITY  */
+  YYSYMBOL_ELEMENT_CONNECTIONS = 63,       /* ELEMENT_CONNECTIONS  */
+  YYSYMBOL_ELLIPTIC = 64,                  /* ELLIPTIC  */
+  YYSYMBOL_ELLIPTIC_RELEASE_SITE = 65,     /* ELLIPTIC_RELEASE_SITE  */
+  YYSYMBOL_EQUAL = 66,                     /* EQUAL  */
+  YYSYMBOL_ERROR = 67,                     /* ERROR  */
+  YYSYMBOL_ESTIMATE_CONCENTRATION = 68,    /* ESTIMATE_CONCENTRATION  */
+  YYSYMBOL_EXCLUDE_ELEMENTS = 69,          /* EXCLUDE_ELEMENTS  */
+  YYSYMBOL_EXCLUDE_PATCH = 70,             /* EXCLUDE_PATCH  */
+  YYSYMBOL_EXCLUDE_REGION = 71,            /* EXCLUDE_REGION  */
+  YYSYMBOL_EXIT = 72,                      /* EXIT  */
+  YYSYMBOL_EXP = 73,                       /* EXP  */
+  YYSYMBOL_EXPRESSION = 74,                /* EXPRESSION  */
+  YYSYMBOL_EXTERN = 75,                    /* EXTERN  */
+  YYSYMBOL_FALSE = 76,                     /* FALSE  */
+  YYSYMBOL_FCLOSE = 77,                    /* FCLOSE  */
+  YYSYMBOL_FILENAME = 78,                  /* FILENAME  */
+  YYSYMBOL_FILENAME_PREFIX = 79,           /* FILENAME_PREFIX  */
+  YYSYMBOL_FILE_OUTPUT_REPORT = 80,        /* FILE_OUTPUT_REPORT  */
+  YYSYMBOL_FINAL_SUMMARY = 81,             /* FINAL_SUMMARY  */
+  YYSYMBOL_FLOOR = 82,                     /* FLOOR  */
+  YYSYMBOL_FOPEN = 83,                     /* FOPEN  */
+  YYSYMBOL_FORMAT = 84,                    /* FORMAT  */
+  YYSYMBOL_FPRINTF = 85,                   /* FPRINTF  */
+  YYSYMBOL_FPRINT_TIME = 86,               /* FPRINT_TIME  */
+  YYSYMBOL_FRONT = 87,                     /* FRONT  */
+  YYSYMBOL_FRONT_CROSSINGS = 88,           /* FRONT_CROSSINGS  */
+  YYSYMBOL_FRONT_HITS = 89,                /* FRONT_HITS  */
+  YYSYMBOL_GAUSSIAN_RELEASE_NUMBER = 90,   /* GAUSSIAN_RELEASE_NUMBER  */
+  YYSYMBOL_GEOMETRY = 91,                  /* GEOMETRY  */
+  YYSYMBOL_GRAPH_PATTERN = 92,             /* GRAPH_PATTERN  */
+  YYSYMBOL_HEADER = 93,                    /* HEADER  */
+  YYSYMBOL_HIGH_PROBABILITY_THRESHOLD = 94, /* HIGH_PROBABILITY_THRESHOLD  */
+  YYSYMBOL_HIGH_REACTION_PROBABILITY = 95, /* HIGH_REACTION_PROBABILITY  */
+  YYSYMBOL_IGNORED = 96,                   /* IGNORED  */
+  YYSYMBOL_INCLUDE_ELEMENTS = 97,          /* INCLUDE_ELEMENTS  */
+  YYSYMBOL_INCLUDE_FILE = 98,              /* INCLUDE_FILE  */
+  YYSYMBOL_INCLUDE_PATCH = 99,             /* INCLUDE_PATCH  */
+  YYSYMBOL_INCLUDE_REGION = 100,           /* INCLUDE_REGION  */
+  YYSYMBOL_INPUT_FILE = 101,               /* INPUT_FILE  */
+  YYSYMBOL_INSTANTIATE = 102,              /* INSTANTIATE  */
+  YYSYMBOL_LLINTEGER = 103,                /* LLINTEGER  */
+  YYSYMBOL_FULLY_RANDOM = 104,             /* FULLY_RANDOM  */
+  YYSYMBOL_INTERACTION_RADIUS = 105,       /* INTERACTION_RADIUS  */
+  YYSYMBOL_ITERATION_LIST = 106,           /* ITERATION_LIST  */
+  YYSYMBOL_ITERATION_NUMBERS = 107,        /* ITERATION_NUMBERS  */
+  YYSYMBOL_ITERATION_REPORT = 108,         /* ITERATION_REPORT  */
+  YYSYMBOL_ITERATIONS = 109,               /* ITERATIONS  */
+  YYSYMBOL_KEEP_CHECKPOINT_FILES = 110,    /* KEEP_CHECKPOINT_FILES  */
+  YYSYMBOL_LEFT = 111,                     /* LEFT  */
+  YYSYMBOL_LIFETIME_THRESHOLD = 112,       /* LIFETIME_THRESHOLD  */
+  YYSYMBOL_LIFETIME_TOO_SHORT = 113,       /* LIFETIME_TOO_SHORT  */
+  YYSYMBOL_LIST = 114,                     /* LIST  */
+  YYSYMBOL_LOCATION = 115,                 /* LOCATION  */
+  YYSYMBOL_COMPONENT_LOCATION = 116,       /* COMPONENT_LOCATION  */
+  YYSYMBOL_COMPONENT_ROTATION = 117,       /* COMPONENT_ROTATION  */
+  YYSYMBOL_LOG = 118,                      /* LOG  */
+  YYSYMBOL_LOG10 = 119,                    /* LOG10  */
+  YYSYMBOL_MAX_TOK = 120,                  /* MAX_TOK  */
+  YYSYMBOL_MAXIMUM_STEP_LENGTH = 121,      /* MAXIMUM_STEP_LENGTH  */
+  YYSYMBOL_MEAN_DIAMETER = 122,            /* MEAN_DIAMETER  */
+  YYSYMBOL_MEAN_NUMBER = 123,              /* MEAN_NUMBER  */
+  YYSYMBOL_MEMORY_PARTITION_X = 124,       /* MEMORY_PARTITION_X  */
+  YYSYMBOL_MEMORY_PARTITION_Y = 125,       /* MEMORY_PARTITION_Y  */
+  YYSYMBOL_MEMORY_PARTITION_Z = 126,       /* MEMORY_PARTITION_Z  */
+  YYSYMBOL_MEMORY_PARTITION_POOL = 127,    /* MEMORY_PARTITION_POOL  */
+  YYSYMBOL_MICROSCOPIC_REVERSIBILITY = 128, /* MICROSCOPIC_REVERSIBILITY  */
+  YYSYMBOL_MIN_TOK = 129,                  /* MIN_TOK  */
+  YYSYMBOL_MISSED_REACTIONS = 130,         /* MISSED_REACTIONS  */
+  YYSYMBOL_MISSED_REACTION_THRESHOLD = 131, /* MISSED_REACTION_THRESHOLD  */
+  YYSYMBOL_MISSING_SURFACE_ORIENTATION = 132, /* MISSING_SURFACE_ORIENTATION  */
+  YYSYMBOL_MOD = 133,                      /* MOD  */
+  YYSYMBOL_MODE = 134,                     /* MODE  */
+  YYSYMBOL_MODIFY_SURFACE_REGIONS = 135,   /* MODIFY_SURFACE_REGIONS  */
+  YYSYMBOL_MOLECULE = 136,                 /* MOLECULE  */
+  YYSYMBOL_MOLECULE_COLLISION_REPORT = 137, /* MOLECULE_COLLISION_REPORT  */
+  YYSYMBOL_MOLECULE_DENSITY = 138,         /* MOLECULE_DENSITY  */
+  YYSYMBOL_MOLECULE_NUMBER = 139,          /* MOLECULE_NUMBER  */
+  YYSYMBOL_MOLECULE_POSITIONS = 140,       /* MOLECULE_POSITIONS  */
+  YYSYMBOL_MOLECULE_POSITIONS_FILE = 141,  /* MOLECULE_POSITIONS_FILE  */
+  YYSYMBOL_MOLECULES = 142,                /* MOLECULES  */
+  YYSYMBOL_MOLECULE_PLACEMENT_FAILURE = 143, /* MOLECULE_PLACEMENT_FAILURE  */
+  YYSYMBOL_NAME_LIST = 144,                /* NAME_LIST  */
+  YYSYMBOL_NEAREST_POINT = 145,            /* NEAREST_POINT  */
+  YYSYMBOL_NEAREST_TRIANGLE = 146,         /* NEAREST_TRIANGLE  */
+  YYSYMBOL_NEGATIVE_DIFFUSION_CONSTANT = 147, /* NEGATIVE_DIFFUSION_CONSTANT  */
+  YYSYMBOL_NEGATIVE_REACTION_RATE = 148,   /* NEGATIVE_REACTION_RATE  */
+  YYSYMBOL_NO = 149,                       /* NO  */
+  YYSYMBOL_NOEXIT = 150,                   /* NOEXIT  */
+  YYSYMBOL_NONE = 151,                     /* NONE  */
+  YYSYMBOL_NO_SPECIES = 152,               /* NO_SPECIES  */
+  YYSYMBOL_NOT_EQUAL = 153,                /* NOT_EQUAL  */
+  YYSYMBOL_NOTIFICATIONS = 154,            /* NOTIFICATIONS  */
+  YYSYMBOL_NUMBER_OF_SUBUNITS = 155,       /* NUMBER_OF_SUBUNITS  */
+  YYSYMBOL_NUMBER_OF_TRAINS = 156,         /* NUMBER_OF_TRAINS  */
+  YYSYMBOL_NUMBER_TO_RELEASE = 157,        /* NUMBER_TO_RELEASE  */
+  YYSYMBOL_OBJECT = 158,                   /* OBJECT  */
+  YYSYMBOL_OFF = 159,                      /* OFF  */
+  YYSYMBOL_ON = 160,                       /* ON  */
+  YYSYMBOL_ORIENTATIONS = 161,             /* ORIENTATIONS  */
+  YYSYMBOL_OUTPUT_BUFFER_SIZE = 162,       /* OUTPUT_BUFFER_SIZE  */
+  YYSYMBOL_INVALID_OUTPUT_STEP_TIME = 163, /* INVALID_OUTPUT_STEP_TIME  */
+  YYSYMBOL_LARGE_MOLECULAR_DISPLACEMENT = 164, /* LARGE_MOLECULAR_DISPLACEMENT  */
+  YYSYMBOL_ADD_REMOVE_MESH = 165,          /* ADD_REMOVE_MESH  */
+  YYSYMBOL_OVERWRITTEN_OUTPUT_FILE = 166,  /* OVERWRITTEN_OUTPUT_FILE  */
+  YYSYMBOL_PARTITION_LOCATION_REPORT = 167, /* PARTITION_LOCATION_REPORT  */
+  YYSYMBOL_PARTITION_X = 168,              /* PARTITION_X  */
+  YYSYMBOL_PARTITION_Y = 169,              /* PARTITION_Y  */
+  YYSYMBOL_PARTITION_Z = 170,              /* PARTITION_Z  */
+  YYSYMBOL_PERIODIC_BOX = 171,             /* PERIODIC_BOX  */
+  YYSYMBOL_PERIODIC_X = 172,               /* PERIODIC_X  */
+  YYSYMBOL_PERIODIC_Y = 173,               /* PERIODIC_Y  */
+  YYSYMBOL_PERIODIC_Z = 174,               /* PERIODIC_Z  */
+  YYSYMBOL_PERIODIC_TRADITIONAL = 175,     /* PERIODIC_TRADITIONAL  */
+  YYSYMBOL_PI_TOK = 176,                   /* PI_TOK  */
+  YYSYMBOL_POLYGON_LIST = 177,             /* POLYGON_LIST  */
+  YYSYMBOL_POSITIONS = 178,                /* POSITIONS  */
+  YYSYMBOL_PRINTF = 179,                   /* PRINTF  */
+  YYSYMBOL_PRINT_TIME = 180,               /* PRINT_TIME  */
+  YYSYMBOL_PROBABILITY_REPORT = 181,       /* PROBABILITY_REPORT  */
+  YYSYMBOL_PROBABILITY_REPORT_THRESHOLD = 182, /* PROBABILITY_REPORT_THRESHOLD  */
+  YYSYMBOL_PROGRESS_REPORT = 183,          /* PROGRESS_REPORT  */
+  YYSYMBOL_RADIAL_DIRECTIONS = 184,        /* RADIAL_DIRECTIONS  */
+  YYSYMBOL_RADIAL_SUBDIVISIONS = 185,      /* RADIAL_SUBDIVISIONS  */
+  YYSYMBOL_RAND_GAUSSIAN = 186,            /* RAND_GAUSSIAN  */
+  YYSYMBOL_RAND_UNIFORM = 187,             /* RAND_UNIFORM  */
+  YYSYMBOL_REACTION_DATA_OUTPUT = 188,     /* REACTION_DATA_OUTPUT  */
+  YYSYMBOL_REACTION_OUTPUT_REPORT = 189,   /* REACTION_OUTPUT_REPORT  */
+  YYSYMBOL_REAL = 190,                     /* REAL  */
+  YYSYMBOL_RECTANGULAR_RELEASE_SITE = 191, /* RECTANGULAR_RELEASE_SITE  */
+  YYSYMBOL_RECTANGULAR_TOKEN = 192,        /* RECTANGULAR_TOKEN  */
+  YYSYMBOL_REFLECTIVE = 193,               /* REFLECTIVE  */
+  YYSYMBOL_RELEASE_EVENT_REPORT = 194,     /* RELEASE_EVENT_REPORT  */
+  YYSYMBOL_RELEASE_INTERVAL = 195,         /* RELEASE_INTERVAL  */
+  YYSYMBOL_RELEASE_PATTERN = 196,          /* RELEASE_PATTERN  */
+  YYSYMBOL_RELEASE_PROBABILITY = 197,      /* RELEASE_PROBABILITY  */
+  YYSYMBOL_RELEASE_SITE = 198,             /* RELEASE_SITE  */
+  YYSYMBOL_REMOVE_ELEMENTS = 199,          /* REMOVE_ELEMENTS  */
+  YYSYMBOL_RIGHT = 200,                    /* RIGHT  */
+  YYSYMBOL_ROTATE = 201,                   /* ROTATE  */
+  YYSYMBOL_ROUND_OFF = 202,                /* ROUND_OFF  */
+  YYSYMBOL_SCALE = 203,                    /* SCALE  */
+  YYSYMBOL_SEED = 204,                     /* SEED  */
+  YYSYMBOL_SHAPE = 205,                    /* SHAPE  */
+  YYSYMBOL_SHOW_EXACT_TIME = 206,          /* SHOW_EXACT_TIME  */
+  YYSYMBOL_SIN = 207,                      /* SIN  */
+  YYSYMBOL_SITE_DIAMETER = 208,            /* SITE_DIAMETER  */
+  YYSYMBOL_SITE_RADIUS = 209,              /* SITE_RADIUS  */
+  YYSYMBOL_SPACE_STEP = 210,               /* SPACE_STEP  */
+  YYSYMBOL_SPHERICAL = 211,                /* SPHERICAL  */
+  YYSYMBOL_SPHERICAL_RELEASE_SITE = 212,   /* SPHERICAL_RELEASE_SITE  */
+  YYSYMBOL_SPHERICAL_SHELL = 213,          /* SPHERICAL_SHELL  */
+  YYSYMBOL_SPHERICAL_SHELL_SITE = 214,     /* SPHERICAL_SHELL_SITE  */
+  YYSYMBOL_SPRINTF = 215,                  /* SPRINTF  */
+  YYSYMBOL_SQRT = 216,                     /* SQRT  */
+  YYSYMBOL_STANDARD_DEVIATION = 217,       /* STANDARD_DEVIATION  */
+  YYSYMBOL_PERIODIC_BOX_INITIAL = 218,     /* PERIODIC_BOX_INITIAL  */
+  YYSYMBOL_STEP = 219,                     /* STEP  */
+  YYSYMBOL_STRING_TO_NUM = 220,            /* STRING_TO_NUM  */
+  YYSYMBOL_STR_VALUE = 221,                /* STR_VALUE  */
+  YYSYMBOL_SUBUNIT = 222,                  /* SUBUNIT  */
+  YYSYMBOL_SUBUNIT_RELATIONSHIPS = 223,    /* SUBUNIT_RELATIONSHIPS  */
+  YYSYMBOL_SUMMATION_OPERATOR = 224,       /* SUMMATION_OPERATOR  */
+  YYSYMBOL_SURFACE_CLASS = 225,            /* SURFACE_CLASS  */
+  YYSYMBOL_SURFACE_ONLY = 226,             /* SURFACE_ONLY  */
+  YYSYMBOL_TAN = 227,                      /* TAN  */
+  YYSYMBOL_TARGET_ONLY = 228,              /* TARGET_ONLY  */
+  YYSYMBOL_TET_ELEMENT_CONNECTIONS = 229,  /* TET_ELEMENT_CONNECTIONS  */
+  YYSYMBOL_THROUGHPUT_REPORT = 230,        /* THROUGHPUT_REPORT  */
+  YYSYMBOL_TIME_LIST = 231,                /* TIME_LIST  */
+  YYSYMBOL_TIME_POINTS = 232,              /* TIME_POINTS  */
+  YYSYMBOL_TIME_STEP = 233,                /* TIME_STEP  */
+  YYSYMBOL_TIME_STEP_MAX = 234,            /* TIME_STEP_MAX  */
+  YYSYMBOL_TO = 235,                       /* TO  */
+  YYSYMBOL_TOP = 236,                      /* TOP  */
+  YYSYMBOL_TRAIN_DURATION = 237,           /* TRAIN_DURATION  */
+  YYSYMBOL_TRAIN_INTERVAL = 238,           /* TRAIN_INTERVAL  */
+  YYSYMBOL_TRANSLATE = 239,                /* TRANSLATE  */
+  YYSYMBOL_TRANSPARENT = 240,              /* TRANSPARENT  */
+  YYSYMBOL_TRIGGER = 241,                  /* TRIGGER  */
+  YYSYMBOL_TRUE = 242,                     /* TRUE  */
+  YYSYMBOL_UNLIMITED = 243,                /* UNLIMITED  */
+  YYSYMBOL_USELESS_VOLUME_ORIENTATION = 244, /* USELESS_VOLUME_ORIENTATION  */
+  YYSYMBOL_VACANCY_SEARCH_DISTANCE = 245,  /* VACANCY_SEARCH_DISTANCE  */
+  YYSYMBOL_VAR = 246,                      /* VAR  */
+  YYSYMBOL_VARYING_PROBABILITY_REPORT = 247, /* VARYING_PROBABILITY_REPORT  */
+  YYSYMBOL_VERTEX_LIST = 248,              /* VERTEX_LIST  */
+  YYSYMBOL_VIZ_OUTPUT = 249,               /* VIZ_OUTPUT  */
+  YYSYMBOL_VIZ_OUTPUT_REPORT = 250,        /* VIZ_OUTPUT_REPORT  */
+  YYSYMBOL_VIZ_VALUE = 251,                /* VIZ_VALUE  */
+  YYSYMBOL_VOLUME_DATA_OUTPUT = 252,       /* VOLUME_DATA_OUTPUT  */
+  YYSYMBOL_VOLUME_OUTPUT_REPORT = 253,     /* VOLUME_OUTPUT_REPORT  */
+  YYSYMBOL_VOLUME_DEPENDENT_RELEASE_NUMBER = 254, /* VOLUME_DEPENDENT_RELEASE_NUMBER  */
+  YYSYMBOL_VOLUME_ONLY = 255,              /* VOLUME_ONLY  */
+  YYSYMBOL_VOXEL_COUNT = 256,              /* VOXEL_COUNT  */
+  YYSYMBOL_VOXEL_LIST = 257,               /* VOXEL_LIST  */
+  YYSYMBOL_VOXEL_SIZE = 258,               /* VOXEL_SIZE  */
+  YYSYMBOL_WARNING = 259,                  /* WARNING  */
+  YYSYMBOL_WARNINGS = 260,                 /* WARNINGS  */
+  YYSYMBOL_WORLD = 261,                    /* WORLD  */
+  YYSYMBOL_YES = 262,                      /* YES  */
+  YYSYMBOL_263_ = 263,                     /* '='  */
+  YYSYMBOL_264_ = 264,                     /* '&'  */
+  YYSYMBOL_265_ = 265,                     /* ':'  */
+  YYSYMBOL_266_ = 266,                     /* '+'  */
+  YYSYMBOL_267_ = 267,                     /* '-'  */
+  YYSYMBOL_268_ = 268,                     /* '*'  */
+  YYSYMBOL_269_ = 269,                     /* '/'  */
+  YYSYMBOL_UNARYMINUS = 270,               /* UNARYMINUS  */
+  YYSYMBOL_271_ = 271,                     /* '^'  */
+  YYSYMBOL_272_ = 272,                     /* '['  */
+  YYSYMBOL_273_ = 273,                     /* ']'  */
+  YYSYMBOL_274_ = 274,                     /* ';'  */
+  YYSYMBOL_275_ = 275,                     /* '\''  */
+  YYSYMBOL_276_ = 276,                     /* ','  */
+  YYSYMBOL_277_ = 277,                     /* '{'  */
+  YYSYMBOL_278_ = 278,                     /* '}'  */
+  YYSYMBOL_279_ = 279,                     /* '('  */
+  YYSYMBOL_280_ = 280,                     /* ')'  */
+  YYSYMBOL_281_ = 281,                     /* '~'  */
+  YYSYMBOL_282_ = 282,                     /* '>'  */
+  YYSYMBOL_283_ = 283,                     /* '<'  */
+  YYSYMBOL_284_ = 284,                     /* '@'  */
+  YYSYMBOL_YYACCEPT = 285,                 /* $accept  */
+  YYSYMBOL_mdl_format = 286,               /* mdl_format  */
+  YYSYMBOL_mdl_stmt_list = 287,            /* mdl_stmt_list  */
+  YYSYMBOL_mdl_stmt = 288,                 /* mdl_stmt  */
+  YYSYMBOL_str_value = 289,                /* str_value  */
+  YYSYMBOL_var = 290,                      /* var  */
+  YYSYMBOL_file_name = 291,                /* file_name  */
+  YYSYMBOL_existing_object = 292,          /* existing_object  */
+  YYSYMBOL_existing_region = 293,          /* existing_region  */
+  YYSYMBOL_point = 294,                    /* point  */
+  YYSYMBOL_point_or_num = 295,             /* point_or_num  */
+  YYSYMBOL_boolean = 296,                  /* boolean  */
+  YYSYMBOL_orientation_class = 297,        /* orientation_class  */
+  YYSYMBOL_list_orient_marks = 298,        /* list_orient_marks  */
+  YYSYMBOL_head_mark = 299,                /* head_mark  */
+  YYSYMBOL_tail_mark = 300,                /* tail_mark  */
+  YYSYMBOL_orient_class_number = 301,      /* orient_class_number  */
+  YYSYMBOL_list_range_specs = 302,         /* list_range_specs  */
+  YYSYMBOL_range_spec = 303,               /* range_spec  */
+  YYSYMBOL_include_stmt = 304,             /* include_stmt  */
+  YYSYMBOL_assignment_stmt = 305,          /* assignment_stmt  */
+  YYSYMBOL_assign_var = 306,               /* assign_var  */
+  YYSYMBOL_existing_var_only = 307,        /* existing_var_only  */
+  YYSYMBOL_array_value = 308,              /* array_value  */
+  YYSYMBOL_array_expr_only = 309,          /* array_expr_only  */
+  YYSYMBOL_existing_array = 310,           /* existing_array  */
+  YYSYMBOL_num_expr = 311,                 /* num_expr  */
+  YYSYMBOL_num_value = 312,                /* num_value  */
+  YYSYMBOL_intOrReal = 313,                /* intOrReal  */
+  YYSYMBOL_num_expr_only = 314,            /* num_expr_only  */
+  YYSYMBOL_existing_num_var = 315,         /* existing_num_var  */
+  YYSYMBOL_arith_expr = 316,               /* arith_expr  */
+  YYSYMBOL_str_expr = 317,                 /* str_expr  */
+  YYSYMBOL_str_expr_only = 318,            /* str_expr_only  */
+  YYSYMBOL_existing_str_var = 319,         /* existing_str_var  */
+  YYSYMBOL_io_stmt = 320,                  /* io_stmt  */
+  YYSYMBOL_fopen_stmt = 321,               /* fopen_stmt  */
+  YYSYMBOL_new_file_stream = 322,          /* new_file_stream  */
+  YYSYMBOL_file_mode = 323,                /* file_mode  */
+  YYSYMBOL_fclose_stmt = 324,              /* fclose_stmt  */
+  YYSYMBOL_existing_file_stream = 325,     /* existing_file_stream  */
+  YYSYMBOL_format_string = 326,            /* format_string  */
+  YYSYMBOL_list_args = 327,                /* list_args  */
+  YYSYMBOL_list_arg = 328,                 /* list_arg  */
+  YYSYMBOL_printf_stmt = 329,              /* printf_stmt  */
+  YYSYMBOL_fprintf_stmt = 330,             /* fprintf_stmt  */
+  YYSYMBOL_sprintf_stmt = 331,             /* sprintf_stmt  */
+  YYSYMBOL_print_time_stmt = 332,          /* print_time_stmt  */
+  YYSYMBOL_fprint_time_stmt = 333,         /* fprint_time_stmt  */
+  YYSYMBOL_notification_def = 334,         /* notification_def  */
+  YYSYMBOL_notification_list = 335,        /* notification_list  */
+  YYSYMBOL_notification_item_def = 336,    /* notification_item_def  */
+  YYSYMBOL_notify_bilevel = 337,           /* notify_bilevel  */
+  YYSYMBOL_notify_level = 338,             /* notify_level  */
+  YYSYMBOL_warnings_def = 339,             /* warnings_def  */
+  YYSYMBOL_warning_list = 340,             /* warning_list  */
+  YYSYMBOL_warning_item_def = 341,         /* warning_item_def  */
+  YYSYMBOL_warning_level = 342,            /* warning_level  */
+  YYSYMBOL_chkpt_stmt = 343,               /* chkpt_stmt  */
+  YYSYMBOL_exit_or_no = 344,               /* exit_or_no  */
+  YYSYMBOL_time_expr = 345,                /* time_expr  */
+  YYSYMBOL_parameter_def = 346,            /* parameter_def  */
+  YYSYMBOL_memory_partition_def = 347,     /* memory_partition_def  */
+  YYSYMBOL_partition_def = 348,            /* partition_def  */
+  YYSYMBOL_partition_dimension = 349,      /* partition_dimension  */
+  YYSYMBOL_molecules_def = 350,            /* molecules_def  */
+  YYSYMBOL_define_one_molecule = 351,      /* define_one_molecule  */
+  YYSYMBOL_define_multiple_molecules = 352, /* define_multiple_molecules  */
+  YYSYMBOL_list_molecule_stmts = 353,      /* list_molecule_stmts  */
+  YYSYMBOL_molecule_stmt = 354,            /* molecule_stmt  */
+  YYSYMBOL_molecule_name = 355,            /* molecule_name  */
+  YYSYMBOL_new_molecule = 356,             /* new_molecule  */
+  YYSYMBOL_diffusion_def = 357,            /* diffusion_def  */
+  YYSYMBOL_mol_timestep_def = 358,         /* mol_timestep_def  */
+  YYSYMBOL_target_def = 359,               /* target_def  */
+  YYSYMBOL_maximum_step_length_def = 360,  /* maximum_step_length_def  */
+  YYSYMBOL_extern_def = 361,               /* extern_def  */
+  YYSYMBOL_existing_molecule = 362,        /* existing_molecule  */
+  YYSYMBOL_existing_surface_molecule = 363, /* existing_surface_molecule  */
+  YYSYMBOL_existing_molecule_opt_orient = 364, /* existing_molecule_opt_orient  */
+  YYSYMBOL_molecule_structures_def = 365,  /* molecule_structures_def  */
+  YYSYMBOL_list_bngl_molecules = 366,      /* list_bngl_molecules  */
+  YYSYMBOL_bngl_molecule = 367,            /* bngl_molecule  */
+  YYSYMBOL_368_1 = 368,                    /* $@1  */
+  YYSYMBOL_new_bngl_molecule_name = 369,   /* new_bngl_molecule_name  */
+  YYSYMBOL_list_bngl_components = 370,     /* list_bngl_components  */
+  YYSYMBOL_bngl_component = 371,           /* bngl_component  */
+  YYSYMBOL_372_2 = 372,                    /* $@2  */
+  YYSYMBOL_bngl_component_name = 373,      /* bngl_component_name  */
+  YYSYMBOL_list_bngl_component_states = 374, /* list_bngl_component_states  */
+  YYSYMBOL_bngl_component_state = 375,     /* bngl_component_state  */
+  YYSYMBOL_bngl_component_structure_spec = 376, /* bngl_component_structure_spec  */
+  YYSYMBOL_surface_classes_def = 377,      /* surface_classes_def  */
+  YYSYMBOL_define_one_surface_class = 378, /* define_one_surface_class  */
+  YYSYMBOL_define_multiple_surface_classes = 379, /* define_multiple_surface_classes  */
+  YYSYMBOL_list_surface_class_stmts = 380, /* list_surface_class_stmts  */
+  YYSYMBOL_surface_class_stmt = 381,       /* surface_class_stmt  */
+  YYSYMBOL_382_3 = 382,                    /* $@3  */
+  YYSYMBOL_existing_surface_class = 383,   /* existing_surface_class  */
+  YYSYMBOL_list_surface_prop_stmts = 384,  /* list_surface_prop_stmts  */
+  YYSYMBOL_surface_prop_stmt = 385,        /* surface_prop_stmt  */
+  YYSYMBOL_surface_rxn_stmt = 386,         /* surface_rxn_stmt  */
+  YYSYMBOL_surface_rxn_type = 387,         /* surface_rxn_type  */
+  YYSYMBOL_equals_or_to = 388,             /* equals_or_to  */
+  YYSYMBOL_surface_class_mol_stmt = 389,   /* surface_class_mol_stmt  */
+  YYSYMBOL_surface_mol_stmt = 390,         /* surface_mol_stmt  */
+  YYSYMBOL_list_surface_mol_density = 391, /* list_surface_mol_density  */
+  YYSYMBOL_list_surface_mol_num = 392,     /* list_surface_mol_num  */
+  YYSYMBOL_surface_mol_quant = 393,        /* surface_mol_quant  */
+  YYSYMBOL_rx_net_def = 394,               /* rx_net_def  */
+  YYSYMBOL_list_rx_stmts = 395,            /* list_rx_stmts  */
+  YYSYMBOL_rx_stmt = 396,                  /* rx_stmt  */
+  YYSYMBOL_list_dashes = 397,              /* list_dashes  */
+  YYSYMBOL_right_arrow = 398,              /* right_arrow  */
+  YYSYMBOL_left_arrow = 399,               /* left_arrow  */
+  YYSYMBOL_double_arrow = 400,             /* double_arrow  */
+  YYSYMBOL_right_cat_arrow = 401,          /* right_cat_arrow  */
+  YYSYMBOL_double_cat_arrow = 402,         /* double_cat_arrow  */
+  YYSYMBOL_reaction_arrow = 403,           /* reaction_arrow  */
+  YYSYMBOL_new_rxn_pathname = 404,         /* new_rxn_pathname  */
+  YYSYMBOL_rxn = 405,                      /* rxn  */
+  YYSYMBOL_reactant_list = 406,            /* reactant_list  */
+  YYSYMBOL_reactant = 407,                 /* reactant  */
+  YYSYMBOL_opt_reactant_surface_class = 408, /* opt_reactant_surface_class  */
+  YYSYMBOL_reactant_surface_class = 409,   /* reactant_surface_class  */
+  YYSYMBOL_product_list = 410,             /* product_list  */
+  YYSYMBOL_product = 411,                  /* product  */
+  YYSYMBOL_rx_rate_syntax = 412,           /* rx_rate_syntax  */
+  YYSYMBOL_rx_rate1 = 413,                 /* rx_rate1  */
+  YYSYMBOL_rx_rate2 = 414,                 /* rx_rate2  */
+  YYSYMBOL_rx_dir_rate = 415,              /* rx_dir_rate  */
+  YYSYMBOL_atomic_rate = 416,              /* atomic_rate  */
+  YYSYMBOL_release_pattern_def = 417,      /* release_pattern_def  */
+  YYSYMBOL_new_release_pattern = 418,      /* new_release_pattern  */
+  YYSYMBOL_existing_release_pattern_xor_rxpn = 419, /* existing_release_pattern_xor_rxpn  */
+  YYSYMBOL_list_req_release_pattern_cmds = 420, /* list_req_release_pattern_cmds  */
+  YYSYMBOL_train_count = 421,              /* train_count  */
+  YYSYMBOL_instance_def = 422,             /* instance_def  */
+  YYSYMBOL_423_4 = 423,                    /* $@4  */
+  YYSYMBOL_physical_object_def = 424,      /* physical_object_def  */
+  YYSYMBOL_object_def = 425,               /* object_def  */
+  YYSYMBOL_new_object = 426,               /* new_object  */
+  YYSYMBOL_start_object = 427,             /* start_object  */
+  YYSYMBOL_end_object = 428,               /* end_object  */
+  YYSYMBOL_list_opt_object_cmds = 429,     /* list_opt_object_cmds  */
+  YYSYMBOL_opt_object_cmd = 430,           /* opt_object_cmd  */
+  YYSYMBOL_transformation = 431,           /* transformation  */
+  YYSYMBOL_meta_object_def = 432,          /* meta_object_def  */
+  YYSYMBOL_list_objects = 433,             /* list_objects  */
+  YYSYMBOL_object_ref = 434,               /* object_ref  */
+  YYSYMBOL_existing_object_ref = 435,      /* existing_object_ref  */
+  YYSYMBOL_436_5 = 436,                    /* $@5  */
+  YYSYMBOL_release_site_def = 437,         /* release_site_def  */
+  YYSYMBOL_release_site_def_new = 438,     /* release_site_def_new  */
+  YYSYMBOL_439_6 = 439,                    /* $@6  */
+  YYSYMBOL_release_site_geom = 440,        /* release_site_geom  */
+  YYSYMBOL_release_region_expr = 441,      /* release_region_expr  */
+  YYSYMBOL_release_site_def_old = 442,     /* release_site_def_old  */
+  YYSYMBOL_443_7 = 443,                    /* $@7  */
+  YYSYMBOL_release_site_geom_old = 444,    /* release_site_geom_old  */
+  YYSYMBOL_list_release_site_cmds = 445,   /* list_release_site_cmds  */
+  YYSYMBOL_existing_num_or_array = 446,    /* existing_num_or_array  */
+  YYSYMBOL_release_site_cmd = 447,         /* release_site_cmd  */
+  YYSYMBOL_site_size_cmd = 448,            /* site_size_cmd  */
+  YYSYMBOL_release_number_cmd = 449,       /* release_number_cmd  */
+  YYSYMBOL_constant_release_number_cmd = 450, /* constant_release_number_cmd  */
+  YYSYMBOL_gaussian_release_number_cmd = 451, /* gaussian_release_number_cmd  */
+  YYSYMBOL_volume_dependent_number_cmd = 452, /* volume_dependent_number_cmd  */
+  YYSYMBOL_concentration_dependent_release_cmd = 453, /* concentration_dependent_release_cmd  */
+  YYSYMBOL_molecule_release_pos_list = 454, /* molecule_release_pos_list  */
+  YYSYMBOL_molecule_release_pos = 455,     /* molecule_release_pos  */
+  YYSYMBOL_new_object_name = 456,          /* new_object_name  */
+  YYSYMBOL_polygon_list_def = 457,         /* polygon_list_def  */
+  YYSYMBOL_458_8 = 458,                    /* @8  */
+  YYSYMBOL_vertex_list_cmd = 459,          /* vertex_list_cmd  */
+  YYSYMBOL_single_vertex = 460,            /* single_vertex  */
+  YYSYMBOL_list_points = 461,              /* list_points  */
+  YYSYMBOL_element_connection_cmd = 462,   /* element_connection_cmd  */
+  YYSYMBOL_list_element_connections = 463, /* list_element_connections  */
+  YYSYMBOL_element_connection = 464,       /* element_connection  */
+  YYSYMBOL_list_opt_polygon_object_cmds = 465, /* list_opt_polygon_object_cmds  */
+  YYSYMBOL_opt_polygon_object_cmd = 466,   /* opt_polygon_object_cmd  */
+  YYSYMBOL_remove_side = 467,              /* remove_side  */
+  YYSYMBOL_468_9 = 468,                    /* $@9  */
+  YYSYMBOL_remove_element_specifier_list = 469, /* remove_element_specifier_list  */
+  YYSYMBOL_side_name = 470,                /* side_name  */
+  YYSYMBOL_element_specifier_list = 471,   /* element_specifier_list  */
+  YYSYMBOL_element_specifier = 472,        /* element_specifier  */
+  YYSYMBOL_incl_element_list_stmt = 473,   /* incl_element_list_stmt  */
+  YYSYMBOL_excl_element_list_stmt = 474,   /* excl_element_list_stmt  */
+  YYSYMBOL_just_an_element_list = 475,     /* just_an_element_list  */
+  YYSYMBOL_list_element_specs = 476,       /* list_element_specs  */
+  YYSYMBOL_element_spec = 477,             /* element_spec  */
+  YYSYMBOL_prev_region_stmt = 478,         /* prev_region_stmt  */
+  YYSYMBOL_prev_region_type = 479,         /* prev_region_type  */
+  YYSYMBOL_patch_statement = 480,          /* patch_statement  */
+  YYSYMBOL_patch_type = 481,               /* patch_type  */
+  YYSYMBOL_in_obj_define_surface_regions = 482, /* in_obj_define_surface_regions  */
+  YYSYMBOL_list_in_obj_surface_region_defs = 483, /* list_in_obj_surface_region_defs  */
+  YYSYMBOL_in_obj_surface_region_def = 484, /* in_obj_surface_region_def  */
+  YYSYMBOL_485_10 = 485,                   /* $@10  */
+  YYSYMBOL_486_11 = 486,                   /* $@11  */
+  YYSYMBOL_voxel_list_def = 487,           /* voxel_list_def  */
+  YYSYMBOL_488_12 = 488,                   /* $@12  */
+  YYSYMBOL_tet_element_connection_cmd = 489, /* tet_element_connection_cmd  */
+  YYSYMBOL_element_connection_tet = 490,   /* element_connection_tet  */
+  YYSYMBOL_list_tet_arrays = 491,          /* list_tet_arrays  */
+  YYSYMBOL_periodic_box_def = 492,         /* periodic_box_def  */
+  YYSYMBOL_493_13 = 493,                   /* $@13  */
+  YYSYMBOL_494_14 = 494,                   /* $@14  */
+  YYSYMBOL_box_def = 495,                  /* box_def  */
+  YYSYMBOL_496_15 = 496,                   /* $@15  */
+  YYSYMBOL_497_16 = 497,                   /* $@16  */
+  YYSYMBOL_periodic_x_def = 498,           /* periodic_x_def  */
+  YYSYMBOL_periodic_y_def = 499,           /* periodic_y_def  */
+  YYSYMBOL_periodic_z_def = 500,           /* periodic_z_def  */
+  YYSYMBOL_periodic_traditional = 501,     /* periodic_traditional  */
+  YYSYMBOL_opt_aspect_ratio_def = 502,     /* opt_aspect_ratio_def  */
+  YYSYMBOL_existing_obj_define_surface_regions = 503, /* existing_obj_define_surface_regions  */
+  YYSYMBOL_list_existing_obj_surface_region_defs = 504, /* list_existing_obj_surface_region_defs  */
+  YYSYMBOL_existing_obj_surface_region_def = 505, /* existing_obj_surface_region_def  */
+  YYSYMBOL_506_17 = 506,                   /* $@17  */
+  YYSYMBOL_507_18 = 507,                   /* $@18  */
+  YYSYMBOL_508_19 = 508,                   /* $@19  */
+  YYSYMBOL_new_region = 509,               /* new_region  */
+  YYSYMBOL_list_opt_surface_region_stmts = 510, /* list_opt_surface_region_stmts  */
+  YYSYMBOL_opt_surface_region_stmt = 511,  /* opt_surface_region_stmt  */
+  YYSYMBOL_set_surface_class_stmt = 512,   /* set_surface_class_stmt  */
+  YYSYMBOL_mod_surface_regions = 513,      /* mod_surface_regions  */
+  YYSYMBOL_list_existing_surface_region_refs = 514, /* list_existing_surface_region_refs  */
+  YYSYMBOL_existing_surface_region_ref = 515, /* existing_surface_region_ref  */
+  YYSYMBOL_516_20 = 516,                   /* $@20  */
+  YYSYMBOL_output_def = 517,               /* output_def  */
+  YYSYMBOL_518_21 = 518,                   /* $@21  */
+  YYSYMBOL_output_buffer_size_def = 519,   /* output_buffer_size_def  */
+  YYSYMBOL_output_timer_def = 520,         /* output_timer_def  */
+  YYSYMBOL_step_time_def = 521,            /* step_time_def  */
+  YYSYMBOL_iteration_time_def = 522,       /* iteration_time_def  */
+  YYSYMBOL_real_time_def = 523,            /* real_time_def  */
+  YYSYMBOL_list_count_cmds = 524,          /* list_count_cmds  */
+  YYSYMBOL_count_cmd = 525,                /* count_cmd  */
+  YYSYMBOL_count_stmt = 526,               /* count_stmt  */
+  YYSYMBOL_527_22 = 527,                   /* $@22  */
+  YYSYMBOL_custom_header_value = 528,      /* custom_header_value  */
+  YYSYMBOL_custom_header = 529,            /* custom_header  */
+  YYSYMBOL_exact_time_toggle = 530,        /* exact_time_toggle  */
+  YYSYMBOL_list_count_exprs = 531,         /* list_count_exprs  */
+  YYSYMBOL_single_count_expr = 532,        /* single_count_expr  */
+  YYSYMBOL_count_expr = 533,               /* count_expr  */
+  YYSYMBOL_count_value = 534,              /* count_value  */
+  YYSYMBOL_535_23 = 535,                   /* $@23  */
+  YYSYMBOL_536_24 = 536,                   /* $@24  */
+  YYSYMBOL_file_arrow = 537,               /* file_arrow  */
+  YYSYMBOL_outfile_syntax = 538,           /* outfile_syntax  */
+  YYSYMBOL_existing_rxpn_or_molecule = 539, /* existing_rxpn_or_molecule  */
+  YYSYMBOL_existing_molecule_required_orient_braces = 540, /* existing_molecule_required_orient_braces  */
+  YYSYMBOL_count_syntax = 541,             /* count_syntax  */
+  YYSYMBOL_count_syntax_1 = 542,           /* count_syntax_1  */
+  YYSYMBOL_count_syntax_2 = 543,           /* count_syntax_2  */
+  YYSYMBOL_count_syntax_3 = 544,           /* count_syntax_3  */
+  YYSYMBOL_count_syntax_periodic_1 = 545,  /* count_syntax_periodic_1  */
+  YYSYMBOL_count_syntax_periodic_2 = 546,  /* count_syntax_periodic_2  */
+  YYSYMBOL_count_syntax_periodic_3 = 547,  /* count_syntax_periodic_3  */
+  YYSYMBOL_count_location_specifier = 548, /* count_location_specifier  */
+  YYSYMBOL_opt_hit_spec = 549,             /* opt_hit_spec  */
+  YYSYMBOL_hit_spec = 550,                 /* hit_spec  */
+  YYSYMBOL_opt_custom_header = 551,        /* opt_custom_header  */
+  YYSYMBOL_viz_output_def = 552,           /* viz_output_def  */
+  YYSYMBOL_553_25 = 553,                   /* $@25  */
+  YYSYMBOL_list_viz_output_cmds = 554,     /* list_viz_output_cmds  */
+  YYSYMBOL_viz_output_maybe_mode_cmd = 555, /* viz_output_maybe_mode_cmd  */
+  YYSYMBOL_viz_mode_def = 556,             /* viz_mode_def  */
+  YYSYMBOL_viz_output_cmd = 557,           /* viz_output_cmd  */
+  YYSYMBOL_viz_frames_def = 558,           /* viz_frames_def  */
+  YYSYMBOL_viz_filename_prefix_def = 559,  /* viz_filename_prefix_def  */
+  YYSYMBOL_viz_molecules_block_def = 560,  /* viz_molecules_block_def  */
+  YYSYMBOL_list_viz_molecules_block_cmds = 561, /* list_viz_molecules_block_cmds  */
+  YYSYMBOL_viz_molecules_block_cmd = 562,  /* viz_molecules_block_cmd  */
+  YYSYMBOL_viz_molecules_name_list_cmd = 563, /* viz_molecules_name_list_cmd  */
+  YYSYMBOL_optional_state = 564,           /* optional_state  */
+  YYSYMBOL_viz_include_mols_cmd_list = 565, /* viz_include_mols_cmd_list  */
+  YYSYMBOL_viz_include_mols_cmd = 566,     /* viz_include_mols_cmd  */
+  YYSYMBOL_existing_one_or_multiple_molecules = 567, /* existing_one_or_multiple_molecules  */
+  YYSYMBOL_viz_time_spec = 568,            /* viz_time_spec  */
+  YYSYMBOL_viz_molecules_time_points_def = 569, /* viz_molecules_time_points_def  */
+  YYSYMBOL_viz_molecules_time_points_cmds = 570, /* viz_molecules_time_points_cmds  */
+  YYSYMBOL_viz_molecules_time_points_one_cmd = 571, /* viz_molecules_time_points_one_cmd  */
+  YYSYMBOL_viz_iteration_spec = 572,       /* viz_iteration_spec  */
+  YYSYMBOL_viz_molecules_iteration_numbers_def = 573, /* viz_molecules_iteration_numbers_def  */
+  YYSYMBOL_viz_molecules_iteration_numbers_cmds = 574, /* viz_molecules_iteration_numbers_cmds  */
+  YYSYMBOL_viz_molecules_iteration_numbers_one_cmd = 575, /* viz_molecules_iteration_numbers_one_cmd  */
+  YYSYMBOL_viz_molecules_one_item = 576,   /* viz_molecules_one_item  */
+  YYSYMBOL_volume_output_def = 577,        /* volume_output_def  */
+  YYSYMBOL_volume_output_filename_prefix = 578, /* volume_output_filename_prefix  */
+  YYSYMBOL_volume_output_molecule_list = 579, /* volume_output_molecule_list  */
+  YYSYMBOL_volume_output_molecule_decl = 580, /* volume_output_molecule_decl  */
+  YYSYMBOL_volume_output_molecule = 581,   /* volume_output_molecule  */
+  YYSYMBOL_volume_output_molecules = 582,  /* volume_output_molecules  */
+  YYSYMBOL_volume_output_location = 583,   /* volume_output_location  */
+  YYSYMBOL_volume_output_voxel_size = 584, /* volume_output_voxel_size  */
+  YYSYMBOL_volume_output_voxel_count = 585, /* volume_output_voxel_count  */
+  YYSYMBOL_volume_output_times_def = 586   /* volume_output_times_def  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
 
 
-int mdlparse (struct mdlparse_vars *parse_state, yyscan_t scanner);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_MDL_HOME_JCZECH_MCELL_BUILD_DEPS_MDLPARSE_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 519 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -550,15 +850,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -572,47 +885,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -625,8 +934,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -691,8 +1014,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -701,17 +1023,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -724,11 +1046,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -740,12 +1062,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -755,44 +1077,47 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  150
+#define YYFINAL  153
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   2815
+#define YYLAST   2793
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  280
+#define YYNTOKENS  285
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  290
+#define YYNNTS  302
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  624
+#define YYNRULES  643
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  1232
+#define YYNSTATES  1282
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   514
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   518
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint16 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int16 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   260,   271,
-     275,   276,   264,   262,   272,   263,     2,   265,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   261,   270,
-     278,   259,   277,     2,   279,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   264,   275,
+     279,   280,   268,   266,   276,   267,     2,   269,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   265,   274,
+     283,   263,   282,     2,   284,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,   268,     2,   269,   267,     2,     2,     2,     2,     2,
+       2,   272,     2,   273,   271,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   273,     2,   274,     2,     2,     2,     2,
+       2,     2,     2,   277,     2,   278,   281,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -831,85 +1156,94 @@ static const yytype_uint16 yytranslate[] =
      225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
      235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
      245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,   266
+     255,   256,   257,   258,   259,   260,   261,   262,   270
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   602,   602,   606,   607,   612,   613,   614,   615,   616,
-     617,   618,   619,   620,   621,   622,   623,   624,   625,   626,
-     627,   628,   629,   630,   631,   632,   637,   640,   643,   646,
-     649,   652,   655,   656,   659,   660,   661,   662,   663,   664,
-     667,   668,   669,   670,   674,   675,   676,   686,   698,   701,
-     704,   716,   717,   730,   731,   737,   760,   761,   762,   763,
-     766,   769,   772,   773,   784,   787,   790,   791,   794,   795,
-     798,   799,   802,   803,   806,   810,   811,   812,   813,   814,
-     815,   816,   817,   818,   819,   820,   821,   822,   823,   824,
-     825,   826,   827,   828,   829,   830,   831,   832,   833,   834,
-     835,   836,   837,   838,   839,   843,   844,   848,   849,   850,
-     851,   854,   860,   861,   862,   863,   864,   865,   866,   869,
-     873,   876,   879,   882,   885,   888,   889,   899,   900,   901,
-     913,   917,   923,   928,   932,   941,   945,   946,   950,   951,
-     952,   953,   954,   955,   956,   957,   958,   959,   960,   961,
-     962,   963,   964,   965,   966,   970,   971,   975,   979,   980,
-     987,   991,   992,   996,   997,   998,   999,  1000,  1001,  1002,
-    1003,  1004,  1005,  1006,  1007,  1008,  1009,  1010,  1011,  1012,
-    1013,  1017,  1018,  1019,  1025,  1026,  1027,  1028,  1029,  1033,
-    1034,  1035,  1039,  1040,  1041,  1042,  1050,  1051,  1052,  1053,
-    1054,  1055,  1056,  1057,  1058,  1059,  1060,  1061,  1062,  1063,
-    1064,  1065,  1066,  1067,  1074,  1075,  1076,  1077,  1081,  1085,
-    1086,  1087,  1094,  1095,  1098,  1102,  1106,  1107,  1111,  1120,
-    1123,  1127,  1128,  1132,  1133,  1142,  1153,  1154,  1158,  1159,
-    1169,  1170,  1173,  1177,  1181,  1194,  1195,  1200,  1204,  1210,
-    1211,  1216,  1216,  1221,  1224,  1226,  1231,  1232,  1236,  1239,
-    1245,  1250,  1251,  1252,  1255,  1256,  1259,  1263,  1267,  1274,
-    1278,  1287,  1291,  1300,  1307,  1312,  1313,  1316,  1319,  1320,
-    1323,  1324,  1325,  1328,  1333,  1339,  1340,  1341,  1342,  1345,
-    1346,  1350,  1355,  1356,  1359,  1363,  1364,  1368,  1371,  1372,
-    1375,  1376,  1380,  1381,  1384,  1395,  1412,  1413,  1414,  1418,
-    1419,  1420,  1427,  1434,  1437,  1441,  1448,  1450,  1452,  1454,
-    1456,  1460,  1461,  1468,  1468,  1479,  1482,  1483,  1484,  1485,
-    1486,  1495,  1498,  1501,  1504,  1506,  1510,  1514,  1515,  1516,
-    1521,  1534,  1535,  1538,  1539,  1544,  1543,  1550,  1551,  1556,
-    1555,  1563,  1564,  1565,  1566,  1567,  1568,  1569,  1570,  1577,
-    1578,  1579,  1580,  1581,  1586,  1585,  1592,  1593,  1594,  1595,
-    1596,  1600,  1601,  1604,  1608,  1609,  1610,  1617,  1618,  1619,
-    1620,  1621,  1622,  1624,  1626,  1630,  1631,  1635,  1636,  1637,
-    1638,  1643,  1644,  1650,  1657,  1665,  1666,  1670,  1671,  1676,
-    1679,  1687,  1684,  1702,  1705,  1708,  1709,  1713,  1718,  1719,
-    1723,  1726,  1728,  1734,  1735,  1739,  1739,  1751,  1752,  1755,
-    1756,  1757,  1758,  1759,  1760,  1761,  1765,  1766,  1771,  1772,
-    1773,  1774,  1778,  1783,  1787,  1791,  1792,  1795,  1796,  1797,
-    1800,  1803,  1804,  1807,  1810,  1811,  1815,  1821,  1822,  1827,
-    1828,  1827,  1838,  1835,  1848,  1852,  1856,  1860,  1870,  1873,
-    1867,  1880,  1881,  1877,  1890,  1891,  1895,  1896,  1900,  1901,
-    1905,  1906,  1909,  1910,  1924,  1930,  1931,  1936,  1937,  1939,
-    1936,  1948,  1951,  1953,  1958,  1959,  1963,  1970,  1976,  1977,
-    1982,  1982,  1992,  1991,  2002,  2003,  2014,  2015,  2016,  2019,
-    2023,  2031,  2038,  2039,  2040,  2054,  2055,  2056,  2060,  2060,
-    2066,  2067,  2068,  2072,  2076,  2080,  2081,  2090,  2094,  2095,
-    2096,  2097,  2098,  2099,  2100,  2101,  2102,  2107,  2107,  2109,
-    2110,  2110,  2114,  2115,  2116,  2117,  2118,  2121,  2124,  2128,
-    2138,  2139,  2140,  2141,  2142,  2143,  2147,  2152,  2157,  2162,
-    2167,  2172,  2176,  2177,  2178,  2181,  2182,  2185,  2186,  2187,
-    2188,  2189,  2190,  2191,  2192,  2195,  2196,  2203,  2203,  2210,
-    2211,  2215,  2216,  2219,  2220,  2221,  2225,  2226,  2236,  2239,
-    2243,  2249,  2250,  2265,  2266,  2267,  2271,  2277,  2278,  2282,
-    2283,  2287,  2289,  2293,  2294,  2298,  2299,  2302,  2308,  2309,
-    2326,  2331,  2332,  2336,  2342,  2343,  2360,  2364,  2365,  2366,
-    2373,  2389,  2393,  2394,  2404,  2407,  2425,  2426,  2435,  2439,
-    2443,  2464,  2465,  2466,  2467
+       0,   610,   610,   614,   615,   620,   621,   622,   623,   624,
+     625,   626,   627,   628,   629,   630,   631,   632,   633,   634,
+     635,   636,   637,   638,   639,   640,   641,   646,   649,   652,
+     655,   658,   661,   664,   665,   668,   669,   670,   671,   672,
+     673,   676,   677,   678,   679,   683,   684,   685,   695,   707,
+     710,   713,   725,   726,   739,   740,   746,   769,   770,   771,
+     772,   775,   778,   781,   782,   793,   796,   799,   800,   803,
+     804,   807,   808,   811,   812,   815,   819,   820,   821,   822,
+     823,   824,   825,   826,   827,   828,   829,   830,   831,   832,
+     833,   834,   835,   836,   837,   838,   839,   840,   841,   842,
+     843,   844,   845,   846,   847,   848,   852,   853,   857,   858,
+     859,   860,   863,   869,   870,   871,   872,   873,   874,   875,
+     878,   882,   885,   888,   891,   894,   897,   898,   908,   909,
+     910,   922,   926,   932,   937,   941,   950,   954,   955,   959,
+     960,   961,   962,   963,   964,   965,   966,   967,   968,   969,
+     970,   971,   972,   973,   974,   975,   979,   980,   984,   988,
+     989,   996,  1000,  1001,  1005,  1006,  1007,  1008,  1009,  1010,
+    1011,  1012,  1013,  1014,  1015,  1016,  1017,  1018,  1019,  1020,
+    1021,  1022,  1026,  1027,  1028,  1034,  1035,  1036,  1037,  1038,
+    1042,  1043,  1044,  1048,  1049,  1050,  1051,  1059,  1060,  1061,
+    1062,  1063,  1064,  1065,  1066,  1067,  1068,  1069,  1070,  1071,
+    1072,  1073,  1074,  1075,  1076,  1083,  1084,  1085,  1086,  1090,
+    1094,  1095,  1096,  1103,  1104,  1107,  1111,  1115,  1116,  1120,
+    1129,  1132,  1136,  1137,  1141,  1142,  1151,  1162,  1163,  1167,
+    1168,  1178,  1179,  1182,  1186,  1190,  1202,  1204,  1211,  1212,
+    1221,  1220,  1228,  1233,  1234,  1240,  1239,  1247,  1251,  1253,
+    1257,  1263,  1267,  1282,  1283,  1288,  1292,  1298,  1299,  1304,
+    1304,  1309,  1312,  1314,  1319,  1320,  1324,  1327,  1333,  1338,
+    1339,  1340,  1343,  1344,  1347,  1351,  1355,  1362,  1366,  1375,
+    1379,  1388,  1395,  1400,  1401,  1404,  1407,  1408,  1411,  1412,
+    1413,  1416,  1421,  1427,  1428,  1429,  1430,  1433,  1434,  1438,
+    1443,  1444,  1447,  1451,  1452,  1456,  1459,  1460,  1463,  1464,
+    1468,  1469,  1472,  1483,  1500,  1501,  1502,  1506,  1507,  1508,
+    1515,  1522,  1525,  1529,  1536,  1538,  1540,  1542,  1544,  1548,
+    1549,  1556,  1556,  1567,  1570,  1571,  1572,  1573,  1574,  1583,
+    1586,  1589,  1592,  1594,  1598,  1602,  1603,  1604,  1609,  1622,
+    1623,  1626,  1627,  1632,  1631,  1638,  1639,  1644,  1643,  1651,
+    1652,  1653,  1654,  1655,  1656,  1657,  1658,  1665,  1666,  1667,
+    1668,  1669,  1674,  1673,  1680,  1681,  1682,  1683,  1684,  1688,
+    1689,  1692,  1696,  1697,  1698,  1705,  1706,  1707,  1708,  1709,
+    1710,  1712,  1714,  1715,  1719,  1720,  1724,  1725,  1726,  1727,
+    1732,  1733,  1739,  1746,  1754,  1755,  1759,  1760,  1765,  1768,
+    1776,  1773,  1791,  1794,  1797,  1798,  1802,  1807,  1808,  1812,
+    1815,  1817,  1823,  1824,  1828,  1828,  1840,  1841,  1844,  1845,
+    1846,  1847,  1848,  1849,  1850,  1854,  1855,  1860,  1861,  1862,
+    1863,  1867,  1872,  1876,  1880,  1881,  1884,  1885,  1886,  1889,
+    1892,  1893,  1896,  1899,  1900,  1904,  1910,  1911,  1916,  1917,
+    1916,  1927,  1924,  1937,  1941,  1945,  1949,  1959,  1962,  1956,
+    1969,  1970,  1966,  1979,  1980,  1984,  1985,  1989,  1990,  1994,
+    1995,  1998,  1999,  2013,  2019,  2020,  2025,  2026,  2028,  2025,
+    2037,  2040,  2042,  2047,  2048,  2052,  2059,  2065,  2066,  2071,
+    2071,  2081,  2080,  2091,  2092,  2103,  2104,  2105,  2108,  2112,
+    2120,  2127,  2128,  2129,  2143,  2144,  2145,  2149,  2149,  2155,
+    2156,  2157,  2161,  2165,  2169,  2170,  2179,  2183,  2184,  2185,
+    2186,  2187,  2188,  2189,  2190,  2191,  2196,  2196,  2198,  2199,
+    2199,  2203,  2204,  2205,  2206,  2207,  2210,  2213,  2217,  2227,
+    2228,  2229,  2230,  2231,  2232,  2236,  2241,  2246,  2251,  2256,
+    2261,  2265,  2266,  2267,  2270,  2271,  2274,  2275,  2276,  2277,
+    2278,  2279,  2280,  2281,  2284,  2285,  2292,  2292,  2299,  2300,
+    2304,  2305,  2308,  2309,  2310,  2314,  2315,  2325,  2328,  2332,
+    2338,  2339,  2354,  2355,  2356,  2360,  2366,  2367,  2371,  2372,
+    2376,  2378,  2382,  2383,  2387,  2388,  2391,  2397,  2398,  2415,
+    2420,  2421,  2425,  2431,  2432,  2449,  2453,  2454,  2455,  2462,
+    2478,  2482,  2483,  2493,  2496,  2514,  2515,  2524,  2528,  2532,
+    2553,  2554,  2555,  2556
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "ABS", "ABSORPTIVE",
+  "\"end of file\"", "error", "\"invalid token\"", "ABS", "ABSORPTIVE",
   "ACCURATE_3D_REACTIONS", "ACOS", "ALL_CROSSINGS", "ALL_DATA",
   "ALL_ELEMENTS", "ALL_ENCLOSED", "ALL_HITS", "ALL_ITERATIONS",
   "ALL_MOLECULES", "ALL_NOTIFICATIONS", "ALL_TIMES", "ALL_WARNINGS",
@@ -920,8 +1254,8 @@ static const char *const yytname[] =
   "CHECKPOINT_REPORT", "CLAMP_CONCENTRATION", "CLOSE_PARTITION_SPACING",
   "CONCENTRATION", "CORNERS", "COS", "COUNT", "CUBIC",
   "CUBIC_RELEASE_SITE", "CUSTOM_SPACE_STEP", "CUSTOM_TIME_STEP",
-  "DEFINE_MOLECULE", "DEFINE_MOLECULES", "DEFINE_REACTIONS",
-  "DEFINE_RELEASE_PATTERN", "DEFINE_SURFACE_CLASS",
+  "DEFINE_MOLECULE", "DEFINE_MOLECULES", "DEFINE_MOLECULE_STRUCTURES",
+  "DEFINE_REACTIONS", "DEFINE_RELEASE_PATTERN", "DEFINE_SURFACE_CLASS",
   "DEFINE_SURFACE_CLASSES", "DEFINE_SURFACE_REGIONS",
   "DEGENERATE_POLYGONS", "DELAY", "DENSITY", "DIFFUSION_CONSTANT_2D",
   "DIFFUSION_CONSTANT_3D", "DIFFUSION_CONSTANT_REPORT", "DYNAMIC_GEOMETRY",
@@ -938,14 +1272,15 @@ static const char *const yytname[] =
   "INSTANTIATE", "LLINTEGER", "FULLY_RANDOM", "INTERACTION_RADIUS",
   "ITERATION_LIST", "ITERATION_NUMBERS", "ITERATION_REPORT", "ITERATIONS",
   "KEEP_CHECKPOINT_FILES", "LEFT", "LIFETIME_THRESHOLD",
-  "LIFETIME_TOO_SHORT", "LIST", "LOCATION", "LOG", "LOG10", "MAX_TOK",
-  "MAXIMUM_STEP_LENGTH", "MEAN_DIAMETER", "MEAN_NUMBER",
-  "MEMORY_PARTITION_X", "MEMORY_PARTITION_Y", "MEMORY_PARTITION_Z",
-  "MEMORY_PARTITION_POOL", "MICROSCOPIC_REVERSIBILITY", "MIN_TOK",
-  "MISSED_REACTIONS", "MISSED_REACTION_THRESHOLD",
-  "MISSING_SURFACE_ORIENTATION", "MOD", "MODE", "MODIFY_SURFACE_REGIONS",
-  "MOLECULE", "MOLECULE_COLLISION_REPORT", "MOLECULE_DENSITY",
-  "MOLECULE_NUMBER", "MOLECULE_POSITIONS", "MOLECULES",
+  "LIFETIME_TOO_SHORT", "LIST", "LOCATION", "COMPONENT_LOCATION",
+  "COMPONENT_ROTATION", "LOG", "LOG10", "MAX_TOK", "MAXIMUM_STEP_LENGTH",
+  "MEAN_DIAMETER", "MEAN_NUMBER", "MEMORY_PARTITION_X",
+  "MEMORY_PARTITION_Y", "MEMORY_PARTITION_Z", "MEMORY_PARTITION_POOL",
+  "MICROSCOPIC_REVERSIBILITY", "MIN_TOK", "MISSED_REACTIONS",
+  "MISSED_REACTION_THRESHOLD", "MISSING_SURFACE_ORIENTATION", "MOD",
+  "MODE", "MODIFY_SURFACE_REGIONS", "MOLECULE",
+  "MOLECULE_COLLISION_REPORT", "MOLECULE_DENSITY", "MOLECULE_NUMBER",
+  "MOLECULE_POSITIONS", "MOLECULE_POSITIONS_FILE", "MOLECULES",
   "MOLECULE_PLACEMENT_FAILURE", "NAME_LIST", "NEAREST_POINT",
   "NEAREST_TRIANGLE", "NEGATIVE_DIFFUSION_CONSTANT",
   "NEGATIVE_REACTION_RATE", "NO", "NOEXIT", "NONE", "NO_SPECIES",
@@ -979,14 +1314,14 @@ static const char *const yytname[] =
   "VOLUME_DEPENDENT_RELEASE_NUMBER", "VOLUME_ONLY", "VOXEL_COUNT",
   "VOXEL_LIST", "VOXEL_SIZE", "WARNING", "WARNINGS", "WORLD", "YES", "'='",
   "'&'", "':'", "'+'", "'-'", "'*'", "'/'", "UNARYMINUS", "'^'", "'['",
-  "']'", "';'", "'\\''", "','", "'{'", "'}'", "'('", "')'", "'>'", "'<'",
-  "'@'", "$accept", "mdl_format", "mdl_stmt_list", "mdl_stmt", "str_value",
-  "var", "file_name", "existing_object", "existing_region", "point",
-  "point_or_num", "boolean", "orientation_class", "list_orient_marks",
-  "head_mark", "tail_mark", "orient_class_number", "list_range_specs",
-  "range_spec", "include_stmt", "assignment_stmt", "assign_var",
-  "existing_var_only", "array_value", "array_expr_only", "existing_array",
-  "num_expr", "num_value", "intOrReal", "num_expr_only",
+  "']'", "';'", "'\\''", "','", "'{'", "'}'", "'('", "')'", "'~'", "'>'",
+  "'<'", "'@'", "$accept", "mdl_format", "mdl_stmt_list", "mdl_stmt",
+  "str_value", "var", "file_name", "existing_object", "existing_region",
+  "point", "point_or_num", "boolean", "orientation_class",
+  "list_orient_marks", "head_mark", "tail_mark", "orient_class_number",
+  "list_range_specs", "range_spec", "include_stmt", "assignment_stmt",
+  "assign_var", "existing_var_only", "array_value", "array_expr_only",
+  "existing_array", "num_expr", "num_value", "intOrReal", "num_expr_only",
   "existing_num_var", "arith_expr", "str_expr", "str_expr_only",
   "existing_str_var", "io_stmt", "fopen_stmt", "new_file_stream",
   "file_mode", "fclose_stmt", "existing_file_stream", "format_string",
@@ -1001,9 +1336,13 @@ static const char *const yytname[] =
   "molecule_name", "new_molecule", "diffusion_def", "mol_timestep_def",
   "target_def", "maximum_step_length_def", "extern_def",
   "existing_molecule", "existing_surface_molecule",
-  "existing_molecule_opt_orient", "surface_classes_def",
+  "existing_molecule_opt_orient", "molecule_structures_def",
+  "list_bngl_molecules", "bngl_molecule", "$@1", "new_bngl_molecule_name",
+  "list_bngl_components", "bngl_component", "$@2", "bngl_component_name",
+  "list_bngl_component_states", "bngl_component_state",
+  "bngl_component_structure_spec", "surface_classes_def",
   "define_one_surface_class", "define_multiple_surface_classes",
-  "list_surface_class_stmts", "surface_class_stmt", "$@1",
+  "list_surface_class_stmts", "surface_class_stmt", "$@3",
   "existing_surface_class", "list_surface_prop_stmts", "surface_prop_stmt",
   "surface_rxn_stmt", "surface_rxn_type", "equals_or_to",
   "surface_class_mol_stmt", "surface_mol_stmt", "list_surface_mol_density",
@@ -1015,49 +1354,49 @@ static const char *const yytname[] =
   "product", "rx_rate_syntax", "rx_rate1", "rx_rate2", "rx_dir_rate",
   "atomic_rate", "release_pattern_def", "new_release_pattern",
   "existing_release_pattern_xor_rxpn", "list_req_release_pattern_cmds",
-  "train_count", "instance_def", "$@2", "physical_object_def",
+  "train_count", "instance_def", "$@4", "physical_object_def",
   "object_def", "new_object", "start_object", "end_object",
   "list_opt_object_cmds", "opt_object_cmd", "transformation",
   "meta_object_def", "list_objects", "object_ref", "existing_object_ref",
-  "$@3", "release_site_def", "release_site_def_new", "$@4",
+  "$@5", "release_site_def", "release_site_def_new", "$@6",
   "release_site_geom", "release_region_expr", "release_site_def_old",
-  "$@5", "release_site_geom_old", "list_release_site_cmds",
+  "$@7", "release_site_geom_old", "list_release_site_cmds",
   "existing_num_or_array", "release_site_cmd", "site_size_cmd",
   "release_number_cmd", "constant_release_number_cmd",
   "gaussian_release_number_cmd", "volume_dependent_number_cmd",
   "concentration_dependent_release_cmd", "molecule_release_pos_list",
-  "molecule_release_pos", "new_object_name", "polygon_list_def", "@6",
+  "molecule_release_pos", "new_object_name", "polygon_list_def", "@8",
   "vertex_list_cmd", "single_vertex", "list_points",
   "element_connection_cmd", "list_element_connections",
   "element_connection", "list_opt_polygon_object_cmds",
-  "opt_polygon_object_cmd", "remove_side", "$@7",
+  "opt_polygon_object_cmd", "remove_side", "$@9",
   "remove_element_specifier_list", "side_name", "element_specifier_list",
   "element_specifier", "incl_element_list_stmt", "excl_element_list_stmt",
   "just_an_element_list", "list_element_specs", "element_spec",
   "prev_region_stmt", "prev_region_type", "patch_statement", "patch_type",
   "in_obj_define_surface_regions", "list_in_obj_surface_region_defs",
-  "in_obj_surface_region_def", "$@8", "$@9", "voxel_list_def", "$@10",
+  "in_obj_surface_region_def", "$@10", "$@11", "voxel_list_def", "$@12",
   "tet_element_connection_cmd", "element_connection_tet",
-  "list_tet_arrays", "periodic_box_def", "$@11", "$@12", "box_def", "$@13",
-  "$@14", "periodic_x_def", "periodic_y_def", "periodic_z_def",
+  "list_tet_arrays", "periodic_box_def", "$@13", "$@14", "box_def", "$@15",
+  "$@16", "periodic_x_def", "periodic_y_def", "periodic_z_def",
   "periodic_traditional", "opt_aspect_ratio_def",
   "existing_obj_define_surface_regions",
   "list_existing_obj_surface_region_defs",
-  "existing_obj_surface_region_def", "$@15", "$@16", "$@17", "new_region",
+  "existing_obj_surface_region_def", "$@17", "$@18", "$@19", "new_region",
   "list_opt_surface_region_stmts", "opt_surface_region_stmt",
   "set_surface_class_stmt", "mod_surface_regions",
   "list_existing_surface_region_refs", "existing_surface_region_ref",
-  "$@18", "output_def", "$@19", "output_buffer_size_def",
+  "$@20", "output_def", "$@21", "output_buffer_size_def",
   "output_timer_def", "step_time_def", "iteration_time_def",
-  "real_time_def", "list_count_cmds", "count_cmd", "count_stmt", "$@20",
+  "real_time_def", "list_count_cmds", "count_cmd", "count_stmt", "$@22",
   "custom_header_value", "custom_header", "exact_time_toggle",
   "list_count_exprs", "single_count_expr", "count_expr", "count_value",
-  "$@21", "$@22", "file_arrow", "outfile_syntax",
+  "$@23", "$@24", "file_arrow", "outfile_syntax",
   "existing_rxpn_or_molecule", "existing_molecule_required_orient_braces",
   "count_syntax", "count_syntax_1", "count_syntax_2", "count_syntax_3",
   "count_syntax_periodic_1", "count_syntax_periodic_2",
   "count_syntax_periodic_3", "count_location_specifier", "opt_hit_spec",
-  "hit_spec", "opt_custom_header", "viz_output_def", "$@23",
+  "hit_spec", "opt_custom_header", "viz_output_def", "$@25",
   "list_viz_output_cmds", "viz_output_maybe_mode_cmd", "viz_mode_def",
   "viz_output_cmd", "viz_frames_def", "viz_filename_prefix_def",
   "viz_molecules_block_def", "list_viz_molecules_block_cmds",
@@ -1075,1258 +1414,1247 @@ static const char *const yytname[] =
   "volume_output_location", "volume_output_voxel_size",
   "volume_output_voxel_count", "volume_output_times_def", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,    61,
-      38,    58,    43,    45,    42,    47,   514,    94,    91,    93,
-      59,    39,    44,   123,   125,    40,    41,    62,    60,    64
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -1031
+#define YYPACT_NINF (-1084)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-1031)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -401
+#define YYTABLE_NINF (-420)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    2559,  -175,  -162,   -93,   -41,   -17,    -6,  -114,  -138,    82,
-    -114,  -114,   115,   135,    15,   178,   200,   177,   224,   228,
-     246, -1031,   251,   254,   262,   274,   281,   288,   291,   300,
-     282,   287, -1031, -1031, -1031,   292,   244,   279,   308,   310,
-     301,   323,   309,   326,   327,   329, -1031,   316,   319,   322,
-     596,  2559, -1031,   -42, -1031, -1031,   339, -1031, -1031,   517,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,
-   -1031, -1031,   342, -1031, -1031, -1031, -1031, -1031, -1031, -1031,
-   -1031, -1031, -1031, -1031,   165, -1031, -1031, -1031, -1031,   431,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,   144,
-     144,   -29,  2430,   -29,  2430, -1031, -1031,   341,  -114,  -114,
-   -1031,   355, -1031,   358, -1031,  -114,  -114,   -29,   -51,  2430,
-    -114,  -114,  -114,   -29,  -114,  2430,  2430,   144,  2430,  2430,
-    2430,  2430,   397,  -114,   980, -1031,   576,   -29,   -29,  2029,
-    2430,   458,  2430,  -114,  2430,  2430,  2430, -1031,   555,   685,
-   -1031, -1031,  1873,   361,   104,   292, -1031, -1031,   292, -1031,
-     292, -1031, -1031,   292,   292,   292, -1031, -1031, -1031, -1031,
-   -1031, -1031, -1031, -1031,   362, -1031, -1031, -1031, -1031, -1031,
-     383, -1031, -1031,   369,   370,   374,   378,   379,   385,   387,
-     389, -1031,   390,   391,   398,   399,   401, -1031, -1031, -1031,
-   -1031,   402, -1031,   410,   412,   413,   415,  2430,  2430,  2430,
-   -1031,   -19, -1031, -1031, -1031, -1031, -1031,  1006,     4,   142,
-    -179, -1031, -1031,   350, -1031,  -172, -1031, -1031,  -116, -1031,
-   -1031, -1031,   -71, -1031, -1031, -1031,    22, -1031,   383,   409,
-   -1031, -1031,   528, -1031,   396,   420,   423,   383, -1031,   543,
-   -1031,   528,   528, -1031,   528,   528,   528,   528, -1031, -1031,
-   -1031,   432,   426,    46, -1031,   443,   444,   448,   450,   451,
-     455,   456,   459,   462,   465,   468,   469,   470,   473,   475,
-     477,   478,   481,   351, -1031,   482,   383, -1031,   441, -1031,
-     528,   528,   485, -1031,   528, -1031,   479,   528,   528,   528,
-     624,   504,   627,   508,   521,   522,   523,   539,   542,   546,
-     548,   550,   552,   559,   560,   567,   568,   572,   584,   590,
-     599,   881, -1031,  2144,   638, -1031, -1031,   528,   764, -1031,
-     841,   409,   -29, -1031, -1031, -1031, -1031,   719,  -114, -1031,
-     532, -1031,   532,   -29,   -29,  2430,  2430,  2430,  2430,  2430,
-    2430,  2430,  2430,  2430,  2430,  2430,  2430,  2430,  2430,  2430,
-    2430,   -29,  2430,   589,   589,   394, -1031, -1031,  2430,  2430,
-    2430,  2430,  2430, -1031,  2430, -1031,   604,   608,   289, -1031,
-   -1031, -1031, -1031, -1031,  2430, -1031,   108, -1031, -1031, -1031,
-   -1031, -1031,  -114,  -114,  -137,     1, -1031, -1031, -1031,   549,
-   -1031, -1031, -1031,   -29,   -29,  -114, -1031, -1031, -1031,   144,
-     144,   144,    39,   144,   144,  1680,   144,   144,   144,  2430,
-     144,    39,   144,   144,   144,    39,    39, -1031, -1031,   104,
-     -25, -1031,  2430,   -13,   -29,   609,    17, -1031,   -29,   611,
-     -32, -1031,   -31,   -31,   -31,  2430,   -31,  2430,   -31,   -31,
-    2430,   -31,   -31,   -31,   -31,   -31,   -31,   -31,   -31,   -31,
-   -1031, -1031,  2430,   102, -1031,   528,   603,   612,   713, -1031,
-     296,  -114, -1031, -1031,   687,   616,   666,   538,   833, -1031,
-   -1031,   417,   588,   614,   620,   665,   684,   805,   831,   848,
-     872,  1102,  1108,  1114,  1135,   977,   984,  -183,   999, -1031,
-     260,   260,   589,   589, -1031,  1153,  2430,  2430,   648,   649,
-     696,   811, -1031, -1031, -1031, -1031,   350, -1031, -1031,   668,
-    -159, -1031,  -164, -1031, -1031, -1031,   -81,   677,   678,   679,
-     680,   686, -1031,    37,  -114, -1031,   657,   681, -1031, -1031,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,   528, -1031,
-   -1031, -1031, -1031,   528, -1031, -1031, -1031, -1031, -1031, -1031,
-   -1031,   671, -1031,  1911, -1031,   528,   697,   698,   699,   -24,
-   -1031, -1031, -1031, -1031,    28,   703,   682,   -33, -1031, -1031,
-   -1031, -1031,   383,  -114,   704, -1031,   710, -1031, -1031, -1031,
-   -1031, -1031, -1031,   528, -1031,   528, -1031, -1031,   528, -1031,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,   558, -1031,
-    2144,   -29,   104,    18,   152, -1031,   708,   538,   104,   700,
-   -1031,   717,   718,   715,   722,   724,   730,   729,   731,   732,
-     736, -1031, -1031,   745,   738,   538, -1031,   746, -1031, -1031,
-   -1031, -1031, -1031,   740, -1031,   204, -1031, -1031, -1031, -1031,
-   -1031, -1031, -1031, -1031, -1031, -1031,  2430,  2430,  2430,  2430,
-   -1031, -1031, -1031, -1031,  2430,   528,   528,  2430,  2430, -1031,
-     854, -1031, -1031,   751, -1031, -1031,   668, -1031,   668, -1031,
-   -1031,  -181, -1031,  2430,  2182,  2430,  2430,  2430, -1031,  -114,
-     743,   748, -1031, -1031, -1031, -1031, -1031,    86, -1031, -1031,
-   -1031,   749,   215, -1031, -1031,   -47,   104, -1031, -1031,   409,
-   -1031,   104,  2430,   104,   763,   771, -1031,    67, -1031, -1031,
-   -1031, -1031,   220, -1031, -1031, -1031,   -29,   -21, -1031, -1031,
-   -1031, -1031,   761,   104,   775,   785,  2430, -1031,   383,   768,
-     767,   292,   786,   787,   791, -1031, -1031, -1031, -1031,    -3,
-     538, -1031, -1031,   -63,   104, -1031,  2430,  2430,   931,   -29,
-     104,  -114,  -114,  2430,  -114,  2430,   104,   933,   152, -1031,
-    2300,   104, -1031, -1031,  1052,  1067,  1086,  1092,  1167,   528,
-     528,   799,   987,   -23, -1031, -1031,   -81,   295,   801, -1031,
-   -1031,   528, -1031,   528, -1031,   528,   528,   528,   807,  -114,
-    -114, -1031, -1031,    16, -1031, -1031,   818, -1031, -1031, -1031,
-   -1031,   893, -1031,   528, -1031,   306,   144,    -4, -1031, -1031,
-   -1031,   383,   806,   809,   810,   -64, -1031, -1031, -1031, -1031,
-    -114, -1031,  2300,   825,    55,   483, -1031,   104, -1031,   104,
-    2300,   104, -1031, -1031, -1031, -1031, -1031, -1031,  -168,   432,
-   -1031,   202,   152, -1031, -1031, -1031, -1031,   -46,   152,   528,
-     528,   827,   383, -1031, -1031,   104,    68, -1031,   528, -1031,
-   -1031,   528, -1031,   830, -1031,  1173, -1031, -1031, -1031, -1031,
-      50, -1031,   -14, -1031, -1031, -1031, -1031,  2430,  2430, -1031,
-     816, -1031,  1911,  1911, -1031, -1031,   409,   163, -1031,  -114,
-   -1031,  2430,   350,   832,    80, -1031,   154, -1031,   350, -1031,
-     824,  -114,   850, -1031, -1031, -1031,   383, -1031, -1031, -1031,
-     851,   863, -1031,    -4,    -4, -1031,    21, -1031,   889, -1031,
-      26, -1031,    26, -1031, -1031, -1031,  1173, -1031, -1031, -1031,
-    2300,   857,   883,   901,   826,  2430,  1080, -1031,   868, -1031,
-   -1031,   193,  -168,  -168,  -168, -1031, -1031, -1031, -1031,  2430,
-   -1031, -1031, -1031,  2430, -1031, -1031,   888,   895,   201, -1031,
-   -1031, -1031,   528,   528, -1031, -1031, -1031, -1031,   295, -1031,
-     528, -1031,  2430, -1031, -1031, -1031, -1031, -1031,   447, -1031,
-     144,   973,   894,  2430,    -4,   907, -1031,   184,    -4,    91,
-     -29,    -4,    -4,    -4,    -4, -1031, -1031, -1031, -1031,    12,
-   -1031,   890,    20,    13, -1031,   898, -1031,   104,  2430,   104,
-   -1031,   734,   919, -1031,   152,  2430, -1031,   915,   915, -1031,
-     343,   510,  -114, -1031, -1031,   911,   528,   922, -1031, -1031,
-     925, -1031, -1031,   447, -1031, -1031, -1031, -1031,   942, -1031,
-     945, -1031,   956,  1048,    95,  1030,   597,    95, -1031, -1031,
-     941,   943,   944,   -29,   383,   151,   151, -1031, -1031, -1031,
-   -1031,    10,   963, -1031, -1031, -1031, -1031,   963, -1031, -1031,
-       8, -1031,   528, -1031, -1031,  2430, -1031, -1031,   528,   966,
-   -1031,   968,   171, -1031,   959,  1210, -1031,   965,   967, -1031,
-   -1031,  -114,   104,   144,   978,  1066,   971,   972,   982,   985,
-     983, -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,   989,
-   -1031, -1031,   979, -1031, -1031, -1031, -1031, -1031,  2430, -1031,
-   -1031, -1031, -1031, -1031,   528,   -14,  2430,  2430, -1031, -1031,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,   571,   991,
-   -1031,   447, -1031,  1002, -1031,  1462,  1462,   145, -1031,  1004,
-   -1031,   144,  1018, -1031,   157, -1031,   157,   157, -1031, -1031,
-   -1031,   528, -1031,   882,    41,   447,  2430, -1031,  1462,   210,
-     225, -1031,   104, -1031,   144,  1007, -1031,   432, -1031,  1011,
-    1012,  1014,   152, -1031,  1029,   447,   528, -1031, -1031, -1031,
-   -1031, -1031, -1031,    89, -1031,    89, -1031,    89, -1031, -1031,
-    2430, -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,
-    1017, -1031,  1017,  1017,   909,   212,   580, -1031, -1031, -1031,
-   -1031, -1031
+    2533,  -162,  -125,   -19,    -7,    50,    79,   -31,  -115,   -50,
+     -14,   -31,   -31,   106,   120,   142,   149,   170,   138,   177,
+     191,   183, -1084,   217,   269,   271,   279,   283,   286,   288,
+     297,   292,   296, -1084, -1084, -1084,   300,   302,   314,   316,
+     339,   326,   352,   338,   358,   367,   370, -1084,   372,   374,
+     383,   285,  2533, -1084,   -17, -1084, -1084,   373, -1084, -1084,
+     570, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,
+   -1084, -1084, -1084,   398, -1084, -1084, -1084, -1084, -1084, -1084,
+   -1084, -1084, -1084, -1084, -1084, -1084,    39, -1084, -1084, -1084,
+   -1084,   496, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,
+   -1084,   344,   344,   -29,  2342,   -29,  2342, -1084, -1084,   395,
+     -31,   -31,   -31, -1084,   397, -1084,   416, -1084,   -31,   -31,
+     -29,   -55,  2342,   -31,   -31,   -31,   -29,   -31,  2342,  2342,
+     344,  2342,  2342,  2342,  2342,   350,   -31,   481, -1084,   655,
+     -29,   -29,  1915,  2342,   539,  2342,   -31,  2342,  2342,  2342,
+   -1084,   624,   866, -1084, -1084,  1690,   425,   -68,   300, -1084,
+   -1084,   300, -1084,   300, -1084, -1084,   300,   300,   300, -1084,
+   -1084, -1084, -1084, -1084, -1084, -1084, -1084,   427, -1084, -1084,
+   -1084, -1084, -1084,   443, -1084, -1084,   429,   430,   433,   436,
+     437,   438,   446,   447, -1084,   454,   460,   461,   464,   465,
+   -1084, -1084, -1084, -1084,   467, -1084,   468,   469,   471,   473,
+    2342,  2342,  2342, -1084,   169, -1084, -1084, -1084, -1084, -1084,
+    1147,   -18,   304,  -149, -1084, -1084,   -67, -1084, -1084, -1084,
+     208, -1084,   -26, -1084, -1084,   -76, -1084, -1084, -1084,    36,
+   -1084, -1084, -1084,    43, -1084,   443,   450, -1084, -1084,  1223,
+   -1084,   474,   504,   506,   443, -1084,   626, -1084,  1223,  1223,
+   -1084,  1223,  1223,  1223,  1223, -1084, -1084, -1084,   514,   518,
+      53, -1084,   548,   549,   551,   552,   553,   554,   555,   558,
+     559,   563,   577,   583,   585,   588,   590,   592,   595,   603,
+    1253, -1084,   606,   443, -1084,   522, -1084,  1223,  1223,   607,
+   -1084,  1223, -1084,   557,  1223,  1223,  1223,   705,   611,   730,
+     615,   616,   617,   618,   628,   630,   632,   633,   634,   637,
+     646,   648,   650,   654,   658,   668,   669,   670,   435, -1084,
+    2057,   887, -1084, -1084,  1223,  1230, -1084,  1254,   450,   -29,
+   -1084, -1084, -1084, -1084,   899,   -31, -1084,   636, -1084,   636,
+     -29,   -29,  2342,  2342,  2342,  2342,  2342,  2342,  2342,  2342,
+    2342,  2342,  2342,  2342,  2342,  2342,  2342,  2342,   -29,  2342,
+     677,   677,   452, -1084, -1084,  2342,  2342,  2342,  2342,  2342,
+   -1084,  2342, -1084,   689,   696,   331, -1084, -1084, -1084, -1084,
+     683, -1084, -1084, -1084,  2342, -1084,   215, -1084, -1084, -1084,
+   -1084, -1084,   -31,   -31,   123,    -2, -1084, -1084, -1084,   692,
+   -1084, -1084, -1084,   -29,   -29,   -31, -1084, -1084, -1084,   344,
+     344,   344,     7,   344,   344,  1580,   344,   344,   344,  2342,
+     344,     7,   344,   344,   344,     7,     7, -1084, -1084,   -68,
+     151, -1084,  2342,   -36,   -29,   703,    -5, -1084,   -29,   709,
+      86, -1084,    -9,    -9,    -9,  2342,    -9,  2342,    -9,    -9,
+    2342,    -9,    -9,    -9,    -9,    -9,    -9,    -9,    -9,    -9,
+   -1084, -1084,  2342,   -60, -1084,  1223,   698,   717,   788, -1084,
+      63,   -31, -1084, -1084,   776,   706,   756,   317,   921, -1084,
+   -1084,   530,   596,   639,   702,   721,   755,   781,   798,   828,
+     835,   400,   678,   805,  1032,   845,   937,    89,   952, -1084,
+     237,   237,   677,   677, -1084,  1156,  2342,  2342,   723,   731,
+     765,   -31,   576, -1084, -1084, -1084, -1084,   208, -1084, -1084,
+     728,  -168, -1084,  -160, -1084, -1084, -1084,   -57,   737,   739,
+     740,   741,   743, -1084,    25,   -31, -1084,   727,   738, -1084,
+   -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,  1223,
+   -1084, -1084, -1084, -1084,  1223, -1084, -1084, -1084, -1084, -1084,
+   -1084, -1084,   734, -1084,  1867, -1084,  1223,   749,   752,   753,
+     -48, -1084, -1084, -1084, -1084,    48,   754,   748,     3, -1084,
+   -1084, -1084, -1084,   443,   -31,   770, -1084,   778, -1084, -1084,
+   -1084, -1084, -1084, -1084,  1223, -1084,  1223, -1084, -1084,  1223,
+   -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,   415,
+   -1084,  2057,   -29,   -68,  -146,   107, -1084,   774,   317,   -68,
+     751, -1084,   775,   777,   764,   779,   780,   791,   800,   792,
+     793,   794,   795, -1084, -1084,   812,   802,   317, -1084,   817,
+   -1084, -1084, -1084, -1084, -1084,   810, -1084,   154, -1084, -1084,
+   -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,  2342,  2342,
+    2342,  2342, -1084, -1084, -1084, -1084,  2342,  1223,  1223,  2342,
+    2342, -1084,   930, -1084,   167, -1084, -1084, -1084, -1084,   801,
+   -1084, -1084,   728, -1084,   728, -1084, -1084,  -174, -1084,  2342,
+    2092,  2342,  2342,  2342, -1084,   -31,   811,   813, -1084, -1084,
+   -1084, -1084, -1084,  -156, -1084, -1084, -1084,   816,   186, -1084,
+   -1084,   -45,   -68, -1084, -1084,   450, -1084,   -68,  2342,   -68,
+     842,   844, -1084,   -53, -1084, -1084, -1084, -1084,   193, -1084,
+   -1084, -1084,   -29,   -23, -1084, -1084, -1084, -1084,   825,   -68,
+     856,   867,  2342, -1084,   443,   818,   846,   300,   861,   863,
+     864, -1084, -1084, -1084, -1084,    -1,   317, -1084, -1084,    80,
+     -68, -1084,  2342,  2342,  1007,   -29,   -68,   -31,   -31,   -29,
+    2342,   -31,  2342,   -68,  1011,   107, -1084,  2198,   -68, -1084,
+   -1084,   959,   976,   993,  1015,  1193,  1223,  1223,   873,  1066,
+     -31, -1084, -1084,    74, -1084, -1084,   -57,  1173,   892, -1084,
+   -1084,  1223, -1084,  1223, -1084,  1223,  1223,  1223,   889,   -31,
+     -31, -1084, -1084,    14, -1084, -1084,   896, -1084, -1084, -1084,
+   -1084,  1003, -1084,  1223, -1084,   969,   344,   103, -1084, -1084,
+   -1084,   443,   903,   904,   905,   -64, -1084, -1084, -1084, -1084,
+     -31, -1084,  2198,   925,   -35,   388, -1084,   -68, -1084,   -68,
+    2198,   -68, -1084, -1084, -1084, -1084, -1084, -1084,  -177,   514,
+   -1084,   251,   107, -1084, -1084, -1084, -1084,    87,   107,  1223,
+    1223,   929,   443, -1084, -1084,   -68,    56, -1084, -1084,  1223,
+   -1084, -1084,  1223, -1084,   931, -1084,  1272, -1084, -1084, -1084,
+   -1084,    94, -1084,     6, -1084, -1084, -1084, -1084,  2342,  2342,
+   -1084,   918, -1084,   168, -1084,  1867,  1867, -1084, -1084,   450,
+     152, -1084,   -31, -1084,  2342,   208,   936,    65, -1084,   141,
+   -1084,   208, -1084,   923,   -31,   944, -1084, -1084, -1084,   443,
+   -1084, -1084, -1084,   938,   933, -1084,   103,   103, -1084,   224,
+   -1084,   376, -1084,    41, -1084,    41, -1084, -1084, -1084,  1272,
+   -1084, -1084, -1084,  2198,   946,   953,   961,   951,  2342,  1203,
+   -1084,   958, -1084, -1084,   359,  -177,  -177,  -177, -1084, -1084,
+   -1084, -1084,  2342, -1084, -1084, -1084,  2342, -1084, -1084,   964,
+     971,   220, -1084, -1084, -1084,  1223,  1223, -1084,  1119,   -31,
+   -1084, -1084, -1084, -1084, -1084,  1173, -1084,  1223, -1084,  2342,
+   -1084, -1084, -1084, -1084, -1084,   453, -1084,   344,  1079,   977,
+    2342,   103,   980, -1084,   505,   103,    72,   -29,   103,   103,
+     103,   103, -1084, -1084, -1084, -1084,     8, -1084,   970,     1,
+       9, -1084,   974, -1084,   -68,  2342,   -68, -1084,   495,   990,
+   -1084,   107,  2342, -1084,   998,   998, -1084,   421,   342,   -31,
+   -1084, -1084,  1006, -1084,   997,  1223,  1008, -1084, -1084,  1009,
+   -1084, -1084,   453, -1084, -1084, -1084, -1084,  1012, -1084,  1014,
+   -1084,  1022,  1105,   -87,  1115,   523,   -87, -1084, -1084,  1005,
+    1023,  1025,   -29,   443,   259,   259, -1084, -1084, -1084, -1084,
+      11,  1026, -1084, -1084, -1084, -1084,  1026, -1084, -1084,    22,
+   -1084,  1223, -1084, -1084,  2342, -1084, -1084,  1223,  1027, -1084,
+    1031,   164, -1084,  1019,  1445,  1037, -1084,  1038,  1039, -1084,
+   -1084,   -31,   -68,   344,  1034,  1143,  1028,  1042,  1044,  1045,
+    1049, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,  1057,
+   -1084, -1084,  1050, -1084, -1084, -1084, -1084, -1084,  2342, -1084,
+   -1084, -1084, -1084, -1084,  1223,     6,  2342,  2342, -1084, -1084,
+   -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,   489,  1063,
+   -1084,   453, -1084,  1059, -1084,  2342,   368,   368,    34, -1084,
+    1074, -1084,   344,  1088, -1084,   102, -1084,   102,   102, -1084,
+   -1084, -1084,  1223, -1084,   621,    38,   453,  2342, -1084,   368,
+    1047,   239,   263, -1084,   -68, -1084,   344,  1076, -1084,   514,
+   -1084,  1080,  1081,  1082,   107, -1084,  1089,   453,  1223, -1084,
+    2342, -1084, -1084, -1084, -1084, -1084,    28, -1084,    28, -1084,
+      28, -1084, -1084,  2342, -1084,  1060, -1084, -1084, -1084, -1084,
+   -1084, -1084, -1084, -1084,  1086, -1084,  1086,  1086,   657,    37,
+    2342,   609, -1084, -1084, -1084, -1084, -1084,  1130,  1092,  1238,
+    1107,  1099,  2342,  1071,  2342,  1077,  2342,  1098,  2342,  1138,
+    1094, -1084
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
+     246,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   341,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   220,   221,   222,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    28,     0,     0,
+       0,     0,     2,     3,   349,     5,     6,     0,     7,   113,
+       0,   114,   115,   116,   117,   118,   119,     8,     9,    10,
+      11,    14,    12,     0,    15,   223,   224,    16,    17,   263,
+     264,    18,    19,    21,    20,   343,     0,   344,   345,   366,
+     365,     0,   347,   348,    13,   346,    22,    23,    24,    25,
+      26,     0,     0,     0,     0,     0,     0,   230,   225,     0,
+       0,     0,     0,   331,     0,   231,     0,   265,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   350,     0,
+       0,     0,     0,     0,   513,     0,     0,     0,     0,     0,
+     586,     0,     0,     1,     4,     0,     0,     0,     0,   385,
+     386,     0,   387,     0,   384,   388,     0,     0,     0,    36,
+      38,    40,    39,    35,    37,   202,   201,     0,   109,    27,
+     108,   112,   185,    29,   106,   107,     0,     0,     0,     0,
+       0,     0,     0,     0,    71,     0,     0,     0,     0,     0,
+      94,    96,    95,    72,     0,    97,     0,     0,     0,     0,
+       0,     0,     0,    75,   190,    67,    69,    70,    68,   186,
+     193,   190,     0,     0,   227,   252,     0,   248,   250,   243,
+      41,   312,     0,   293,   295,   313,   310,   333,   269,     0,
+     267,    30,   496,     0,   494,     0,   212,   213,   214,   207,
+     124,     0,     0,     0,    56,   349,     0,   342,   208,   200,
+     188,   215,   216,   217,   218,   210,   211,   209,     0,     0,
+       0,   507,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   323,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   219,   220,   221,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    27,     0,     0,     0,
-       0,     2,     3,   331,     5,     6,     0,     7,   112,     0,
-     113,   114,   115,   116,   117,   118,     8,     9,    10,    11,
-      14,    12,     0,    15,   222,   223,    16,   245,   246,    17,
-      18,    20,    19,   325,     0,   326,   327,   348,   347,     0,
-     329,   330,    13,   328,    21,    22,    23,    24,    25,     0,
-       0,     0,     0,     0,     0,   229,   224,     0,     0,     0,
-     313,     0,   230,     0,   247,     0,     0,     0,     0,     0,
+       0,   137,     0,   125,   126,     0,   205,   204,   206,     0,
+     511,   198,    61,     0,   197,   199,   203,   590,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   332,     0,     0,     0,     0,
-       0,   494,     0,     0,     0,     0,     0,   567,     0,     0,
-       1,     4,     0,     0,     0,     0,   367,   368,     0,   369,
-       0,   366,   370,     0,     0,     0,    35,    37,    39,    38,
-      34,    36,   201,   200,     0,   108,    26,   107,   111,   184,
-      28,   105,   106,     0,     0,     0,     0,     0,     0,     0,
-       0,    70,     0,     0,     0,     0,     0,    93,    95,    94,
-      71,     0,    96,     0,     0,     0,     0,     0,     0,     0,
-      74,   189,    66,    68,    69,    67,   185,   192,   189,     0,
-       0,   226,   242,    40,   294,     0,   275,   277,   295,   292,
-     315,   251,     0,   249,    29,   477,     0,   475,     0,   211,
-     212,   213,   206,   123,     0,     0,     0,    55,   331,     0,
-     324,   207,   199,   187,   214,   215,   216,   217,   209,   210,
-     208,     0,     0,     0,   488,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   162,
+       0,    62,    59,    60,     0,    73,    57,    74,    58,     0,
+      66,   219,    63,    64,     0,     0,   367,     0,   382,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   136,     0,   124,   125,     0,   204,
-     203,   205,     0,   492,   197,    60,     0,   196,   198,   202,
-     571,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   161,     0,    61,    58,    59,     0,    72,    56,
-      73,    57,     0,    65,   218,    62,    63,     0,     0,   349,
-       0,   364,     0,     0,     0,     0,     0,     0,     0,     0,
+     105,   104,     0,   192,   191,     0,     0,     0,     0,     0,
+     187,     0,   189,     0,     0,   234,   226,   228,   247,   249,
+       0,    44,    49,    50,     0,   245,    42,    45,    46,    43,
+     292,   294,     0,     0,     0,     0,   272,   266,   268,     0,
+     493,   495,   123,     0,     0,     0,   509,   506,   508,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   104,   103,     0,   191,   190,     0,     0,
-       0,     0,     0,   186,     0,   188,     0,     0,   233,   225,
-     227,    43,    48,    49,     0,   244,    41,    44,    45,    42,
-     274,   276,     0,     0,     0,     0,   254,   248,   250,     0,
-     474,   476,   122,     0,     0,     0,   490,   487,   489,     0,
+       0,     0,     0,     0,     0,     0,     0,   136,   138,     0,
+       0,   134,     0,     0,     0,     0,     0,   591,     0,     0,
+       0,   631,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   135,   137,     0,
-       0,   133,     0,     0,     0,     0,     0,   572,     0,     0,
-       0,   612,     0,     0,     0,     0,     0,     0,     0,     0,
+     161,   163,     0,     0,    52,    54,     0,     0,   349,   362,
+       0,   352,   359,   361,     0,     0,     0,     0,     0,   126,
+     110,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
+      99,   100,   101,   102,   103,   194,     0,     0,     0,     0,
+     237,     0,     0,    47,    48,   311,   271,    41,   314,   296,
+       0,     0,   303,     0,   305,   304,   306,     0,     0,     0,
+       0,     0,     0,   330,     0,     0,   126,     0,     0,   501,
+     158,   139,   146,   154,   160,   159,   141,   148,   149,   156,
+     155,   157,   145,   142,   144,   140,   151,   147,   150,   143,
+     153,   152,     0,    32,     0,   131,   514,     0,     0,     0,
+     521,   515,   516,   517,   126,     0,     0,     0,     0,   588,
+     596,   595,   597,   630,     0,     0,   632,     0,   184,   182,
+     183,   164,   169,   170,   168,   167,   173,   172,   174,   175,
+     176,   178,   165,   166,   179,   180,   181,   171,   177,     0,
+      65,     0,     0,     0,     0,     0,   360,     0,     0,     0,
+       0,   471,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   404,   405,     0,     0,   352,   389,     0,
+     394,   406,   407,   408,   409,     0,   420,     0,    92,    89,
+      88,    90,    84,    86,    77,    83,    78,    79,     0,     0,
+       0,     0,    85,    91,    98,    87,     0,   233,   232,     0,
+       0,   238,   239,   257,     0,   253,   255,    51,   315,   299,
+     297,   298,     0,   300,     0,   318,   319,     0,   316,     0,
+       0,     0,     0,     0,   281,     0,     0,     0,   279,   280,
+     270,   273,   274,     0,   275,   284,   500,     0,     0,   135,
+      31,     0,     0,   130,   128,   129,   127,     0,     0,     0,
+       0,     0,   527,     0,   522,   524,   525,   526,     0,   593,
+     594,   592,     0,     0,   587,   589,   634,   635,   633,     0,
+       0,     0,     0,    53,   122,     0,     0,     0,     0,     0,
+       0,   351,   358,   353,   354,     0,   352,   423,   424,     0,
+       0,   352,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   390,     0,     0,   430,
+     111,     0,     0,     0,     0,   195,   236,   235,     0,   241,
+       0,   251,   258,     0,   301,   302,     0,     0,   307,   320,
+     321,   334,   340,   339,   338,   335,   337,   336,     0,     0,
+       0,   283,   282,     0,   497,   132,     0,   510,   504,   502,
+     503,   489,   519,   518,   520,     0,     0,     0,   512,   523,
+     133,   598,     0,     0,     0,     0,   600,   602,   603,   604,
+       0,   637,     0,     0,   640,     0,   120,     0,   363,     0,
+       0,     0,   372,   373,   376,   374,   371,   375,     0,   370,
+     377,   369,     0,   422,   425,   474,   475,     0,     0,   414,
+     415,     0,   403,   392,   393,     0,     0,   416,   402,   410,
+     332,   400,   399,   398,     0,   383,   391,   396,   395,   397,
+     429,     0,   427,   352,    80,    81,    93,    82,     0,     0,
+     242,     0,   254,   261,   317,     0,     0,   329,   327,   328,
+       0,   324,     0,   309,     0,    41,     0,     0,   287,     0,
+     289,    41,   276,     0,     0,     0,   477,   529,   530,   531,
+     532,   533,   546,     0,     0,   549,     0,     0,   537,     0,
+     534,   584,   538,     0,   609,     0,   599,   601,   636,    66,
+      33,   638,    34,     0,     0,     0,     0,     0,     0,   491,
+     352,     0,   356,   355,     0,     0,     0,     0,   368,   473,
+     476,   472,     0,   418,   401,   417,     0,   426,   428,     0,
+       0,     0,   431,   432,   433,   196,   240,   229,     0,     0,
+     259,   256,   325,   326,   322,     0,   308,   278,   244,     0,
+     285,   288,   286,   290,   277,     0,   505,     0,   483,     0,
+       0,     0,     0,   544,     0,     0,     0,     0,     0,     0,
+       0,     0,   536,   626,   628,   627,     0,   623,     0,     0,
+       0,   617,     0,   639,     0,     0,     0,   629,     0,     0,
+     480,     0,     0,   378,   379,   380,   381,     0,     0,     0,
+     434,   421,     0,   260,     0,   291,     0,   464,   461,     0,
+     463,   460,   498,   445,   447,   448,   449,     0,   450,     0,
+     490,     0,   485,     0,     0,     0,     0,   539,   535,     0,
+       0,   551,     0,   585,   540,   541,   542,   543,   622,   624,
+       0,   607,   605,   613,   612,   608,   607,   616,   618,     0,
+     642,   641,   643,    55,     0,   430,   364,   357,     0,   411,
+       0,     0,   466,     0,     0,     0,   323,     0,     0,   446,
+     501,     0,     0,     0,     0,   487,     0,   557,     0,     0,
+       0,   559,   560,   561,   562,   563,   564,   548,   545,     0,
+     552,   555,   553,   556,   528,   620,   621,   625,     0,   611,
+     610,   614,   615,   619,   492,   481,     0,     0,   465,   467,
+     468,   444,   441,   439,   440,   442,   443,   438,   456,     0,
+     458,   436,   437,   453,   454,     0,     0,     0,     0,   459,
+       0,   484,     0,     0,   478,     0,   558,     0,     0,   547,
+     550,   554,   606,   352,     0,     0,     0,     0,   435,     0,
+       0,     0,     0,   499,     0,   486,     0,     0,   571,   573,
+     572,   574,   574,   574,     0,   412,     0,   469,   457,   455,
+       0,   452,   451,   462,   488,   479,     0,   567,     0,   565,
+       0,   566,   482,     0,   501,     0,   581,   583,   578,   580,
+     577,   582,   579,   576,   574,   575,   574,   574,     0,     0,
+       0,     0,   570,   568,   569,   413,   470,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     160,   162,     0,     0,    51,    53,     0,     0,   331,   344,
-       0,   334,   341,   343,     0,     0,     0,     0,     0,   125,
-     109,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    75,
-      98,    99,   100,   101,   102,   193,     0,     0,     0,     0,
-     236,     0,    46,    47,   293,   253,    40,   296,   278,     0,
-       0,   285,     0,   287,   286,   288,     0,     0,     0,     0,
-       0,     0,   312,     0,     0,   125,     0,     0,   482,   157,
-     138,   145,   153,   159,   158,   140,   147,   148,   155,   154,
-     156,   144,   141,   143,   139,   150,   146,   149,   142,   152,
-     151,     0,    31,     0,   130,   495,     0,     0,     0,   502,
-     496,   497,   498,   125,     0,     0,     0,     0,   569,   577,
-     576,   578,   611,     0,     0,   613,     0,   183,   181,   182,
-     163,   168,   169,   167,   166,   172,   171,   173,   174,   175,
-     177,   164,   165,   178,   179,   180,   170,   176,     0,    64,
-       0,     0,     0,     0,     0,   342,     0,     0,     0,     0,
-     452,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   385,   386,     0,     0,   334,   371,     0,   376,   387,
-     388,   389,   390,     0,   401,     0,    91,    88,    87,    89,
-      83,    85,    76,    82,    77,    78,     0,     0,     0,     0,
-      84,    90,    97,    86,     0,   232,   231,     0,     0,   237,
-     238,    50,   297,   281,   279,   280,     0,   282,     0,   300,
-     301,     0,   298,     0,     0,     0,     0,     0,   263,     0,
-       0,     0,   261,   262,   252,   255,   256,     0,   257,   266,
-     481,     0,     0,   134,    30,     0,     0,   129,   127,   128,
-     126,     0,     0,     0,     0,     0,   508,     0,   503,   505,
-     506,   507,     0,   574,   575,   573,     0,     0,   568,   570,
-     615,   616,   614,     0,     0,     0,     0,    52,   121,     0,
-       0,     0,     0,     0,     0,   333,   340,   335,   336,     0,
-     334,   404,   405,     0,     0,   334,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   372,
-       0,     0,   411,   110,     0,     0,     0,     0,   194,   235,
-     234,     0,   240,     0,   283,   284,     0,     0,   289,   302,
-     303,   316,   322,   321,   320,   317,   319,   318,     0,     0,
-       0,   265,   264,     0,   478,   131,     0,   491,   485,   483,
-     484,   470,   500,   499,   501,     0,     0,     0,   493,   504,
-     132,   579,     0,     0,     0,     0,   581,   583,   584,   585,
-       0,   618,     0,     0,   621,     0,   119,     0,   345,     0,
-       0,     0,   354,   355,   358,   356,   353,   357,     0,   352,
-     359,   351,     0,   403,   406,   455,   456,     0,     0,   395,
-     396,     0,   384,   374,   375,     0,     0,   397,   391,   314,
-     382,   381,   380,     0,   365,   373,   378,   377,   379,   410,
-       0,   408,   334,    79,    80,    92,    81,     0,     0,   241,
-       0,   299,     0,     0,   311,   309,   310,     0,   306,     0,
-     291,     0,    40,     0,     0,   269,     0,   271,    40,   258,
-       0,     0,     0,   458,   510,   511,   512,   513,   514,   527,
-       0,     0,   530,     0,     0,   518,     0,   515,   565,   519,
-       0,   590,     0,   580,   582,   617,    65,    32,   619,    33,
-       0,     0,     0,     0,     0,     0,   472,   334,     0,   338,
-     337,     0,     0,     0,     0,   350,   454,   457,   453,     0,
-     399,   383,   398,     0,   407,   409,     0,     0,     0,   412,
-     413,   414,   195,   239,   228,   307,   308,   304,     0,   290,
-     260,   243,     0,   267,   270,   268,   272,   259,     0,   486,
-       0,   464,     0,     0,     0,     0,   525,     0,     0,     0,
-       0,     0,     0,     0,     0,   517,   607,   609,   608,     0,
-     604,     0,     0,     0,   598,     0,   620,     0,     0,     0,
-     610,     0,     0,   461,     0,     0,   360,   361,   362,   363,
-       0,     0,     0,   415,   402,     0,   273,     0,   445,   442,
-       0,   444,   441,   479,   426,   428,   429,   430,     0,   431,
-       0,   471,     0,   466,     0,     0,     0,     0,   520,   516,
-       0,     0,   532,     0,   566,   521,   522,   523,   524,   603,
-     605,     0,   588,   586,   594,   593,   589,   588,   597,   599,
-       0,   623,   622,   624,    54,     0,   411,   346,   339,     0,
-     392,     0,     0,   447,     0,     0,   305,     0,     0,   427,
-     482,     0,     0,     0,     0,   468,     0,   538,     0,     0,
-       0,   540,   541,   542,   543,   544,   545,   529,   526,     0,
-     533,   536,   534,   537,   509,   601,   602,   606,     0,   592,
-     591,   595,   596,   600,   473,   462,     0,     0,   446,   448,
-     449,   425,   422,   420,   421,   423,   424,   419,   437,     0,
-     439,   417,   418,   434,   435,     0,     0,     0,   440,     0,
-     465,     0,     0,   459,     0,   539,     0,     0,   528,   531,
-     535,   587,   334,     0,     0,     0,     0,   416,     0,     0,
-       0,   480,     0,   467,     0,     0,   552,   554,   553,   555,
-     555,   555,     0,   393,     0,   450,   438,   436,   433,   432,
-     443,   469,   460,     0,   548,     0,   546,     0,   547,   463,
-       0,   482,   562,   564,   559,   561,   558,   563,   560,   557,
-     555,   556,   555,   555,     0,     0,     0,   551,   549,   550,
-     394,   451
+       0,   262
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-   -1031, -1031, -1031,  1247,  -845,     0,  -102,  -111,  -131,  -397,
-    -782,   -96,  -501, -1031,   914,   917,   194, -1031,   694, -1031,
-   -1031,  1162,  -139,  -145,  -140, -1031,   840,  -423,  -136,  -146,
-   -1031,  -124,   -76,  -109, -1031, -1031, -1031, -1031, -1031, -1031,
-     352,  -120,  -393, -1031, -1031, -1031, -1031, -1031, -1031, -1031,
-   -1031,  1024,   499,    63, -1031, -1031,   990,   674, -1031,  1095,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,   -58,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,  -496,
-   -1031, -1031, -1031, -1031,   -67, -1031,   407, -1031, -1031, -1031,
-   -1031, -1031, -1031,   777, -1031, -1031,  -649, -1031, -1031,  1096,
-    -322,  -235, -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,
-     930, -1031, -1031, -1031,   537, -1031, -1031, -1031,   346,  -384,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,  -282,  -107,
-     -16,  -722,  -621, -1031, -1031,  1209, -1031,   864, -1031, -1031,
-   -1031, -1031, -1031, -1031,  -569, -1031, -1031, -1031,   720, -1031,
-    -582, -1031, -1031, -1031, -1031, -1031, -1031, -1031,   472, -1031,
-   -1031, -1031,   997,   591, -1031, -1031, -1031,   461,   256, -1031,
-   -1031, -1031, -1031, -1031, -1030,  -994, -1031, -1031, -1031,  -624,
-     167, -1031, -1031, -1031, -1031, -1031, -1031,   266, -1031, -1031,
-   -1031, -1031, -1031,   495, -1031, -1031, -1031, -1031, -1031, -1031,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,  1124, -1031,
-   -1031, -1031,   829, -1020, -1031, -1031, -1031, -1031,  1098, -1031,
-   -1031, -1031, -1031, -1031, -1031, -1031, -1031, -1031,   667, -1031,
-   -1031, -1031, -1031, -1031, -1031,   392,  -362, -1031, -1031, -1031,
-   -1031, -1031, -1031, -1031,   328, -1031, -1031, -1031, -1031, -1031,
-   -1031,  -628,  -800, -1031, -1031, -1031, -1031, -1031, -1031, -1031,
-     812, -1031, -1031, -1031, -1031,   562, -1031,   311, -1031, -1031,
-   -1031, -1031, -1031, -1031,   381, -1031, -1031, -1031,   382,  -873,
-   -1031, -1031, -1031,   955,   553, -1031, -1031, -1031, -1031, -1031
+   -1084, -1084, -1084,  1321,  -791,     0,  -101,  -113,  -135,  -365,
+    -792,   -99,  -509, -1084,   982,   983,   248, -1084,   766, -1084,
+   -1084,  1245,  -145,  -142,  -147, -1084,   808,  -630,  -122,  -150,
+   -1084,  -107,   -84,  -111, -1084, -1084, -1084, -1084, -1084, -1084,
+     432,  -116,  -381, -1084, -1084, -1084, -1084, -1084, -1084, -1084,
+   -1084,  1102,   404,    29, -1084, -1084,  1048,   681, -1084,  1174,
+   -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,   -25,
+   -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,  -505,
+   -1084, -1084,  1176, -1084, -1084, -1084,   608, -1084, -1084, -1084,
+   -1084, -1084, -1084, -1084, -1084, -1084,   -58, -1084,   476, -1084,
+   -1084, -1084, -1084, -1084, -1084,   882, -1084, -1084,  -687, -1084,
+   -1084,  1185,  -342,  -151, -1084, -1084, -1084, -1084, -1084, -1084,
+   -1084, -1084,  1029, -1084, -1084, -1084,   622, -1084, -1084, -1084,
+     428,  -352, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,
+    -299,  -114,   -16,  -763,  -623, -1084, -1084,  1303, -1084,   956,
+   -1084, -1084, -1084, -1084, -1084, -1084,  -597, -1084, -1084, -1084,
+     804, -1084,  -572, -1084, -1084, -1084, -1084, -1084, -1084, -1084,
+     560, -1084, -1084, -1084,  1095,   672, -1084, -1084, -1084,   537,
+     328, -1084, -1084, -1084, -1084, -1084, -1057, -1042, -1084, -1084,
+   -1084,  -596,   236, -1084, -1084, -1084, -1084, -1084, -1084,   329,
+   -1084, -1084, -1084, -1084, -1084,   572, -1084, -1084, -1084, -1084,
+   -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,
+    1210, -1084, -1084, -1084,   912, -1083, -1084, -1084, -1084, -1084,
+    1197, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084, -1084,
+     735, -1084, -1084, -1084, -1084, -1084, -1084,   445,  -553, -1084,
+   -1084, -1084, -1084, -1084, -1084, -1084,   385, -1084, -1084, -1084,
+   -1084, -1084, -1084,  -601,  -932, -1084, -1084, -1084, -1084, -1084,
+   -1084, -1084,   884, -1084, -1084, -1084, -1084,   629, -1084,   369,
+   -1084, -1084, -1084, -1084, -1084, -1084,   440, -1084, -1084, -1084,
+     457,  -866, -1084, -1084, -1084,  1036,   631, -1084, -1084, -1084,
+   -1084, -1084
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    50,    51,    52,   177,   210,   179,   261,   850,   937,
-     938,   539,   385,   386,   387,   388,   389,   463,   464,    54,
-      55,    56,   894,   562,   335,   336,   327,   212,   213,   895,
-     214,   215,   238,   181,   182,    57,    58,    59,   739,    60,
-     244,   287,   430,   710,    61,    62,    63,    64,    65,    66,
-     283,   284,   540,   545,    67,   321,   322,   590,    68,   373,
-     218,    69,    70,    71,    72,    73,    74,    75,   220,   106,
-     107,   113,   378,   510,   670,   782,   890,   223,   903,   224,
-      76,    77,    78,   232,   114,   396,   516,   533,   695,   696,
-     697,   803,   698,   808,   904,   906,   905,    79,   225,   226,
-     783,   521,   522,   523,   524,   525,   526,   900,   227,   228,
-     229,   394,   517,   681,   682,   788,   789,   790,   897,   898,
-      80,   111,   870,   395,   794,    81,   124,    82,    83,    84,
-     338,   746,   614,   747,   748,    85,   471,   472,   473,   947,
-      86,    87,   474,   617,   851,    88,   477,   164,   635,   878,
-     636,   637,   638,   639,   640,   641,   642,   866,   867,    89,
-      90,   772,   476,   752,   753,   644,   880,   881,   882,   969,
-     970,  1095,  1149,  1150,  1043,  1044,  1045,  1046,  1152,  1153,
-    1154,  1047,  1048,  1049,  1050,   971,  1092,  1093,  1175,  1211,
-      91,   755,   620,   856,   857,    92,   991,  1185,    93,  1086,
-    1172,  1053,  1105,  1163,   913,  1023,    94,   236,   237,   399,
-     910,  1100,  1094,   705,   809,   810,    95,   263,   264,   538,
-      96,   433,   293,   569,   570,   571,   572,   717,   718,   719,
-     817,   917,   720,   721,   926,   927,   928,   929,   992,   995,
-    1063,  1124,  1108,  1109,  1110,  1111,  1112,  1113,  1114,  1115,
-    1116,  1189,  1204,  1221,  1005,    97,   300,   577,   436,   437,
-     578,   579,   580,   581,   825,   826,   827,  1129,  1012,  1076,
-    1077,  1133,   828,  1013,  1014,  1127,   829,  1009,  1010,  1011,
-      98,   302,   440,   441,   731,   732,   586,   735,   834,   944
+       0,    51,    52,    53,   180,   213,   182,   268,   870,   960,
+     961,   550,   395,   396,   397,   398,   399,   473,   474,    55,
+      56,    57,   917,   573,   342,   343,   334,   215,   216,   918,
+     217,   218,   245,   184,   185,    58,    59,    60,   755,    61,
+     251,   294,   440,   726,    62,    63,    64,    65,    66,    67,
+     290,   291,   551,   556,    68,   328,   329,   601,    69,   380,
+     221,    70,    71,    72,    73,    74,    75,    76,   223,   108,
+     109,   116,   385,   520,   682,   799,   911,   230,   926,   231,
+      77,   226,   227,   390,   228,   684,   685,   802,   686,   913,
+    1000,  1001,    78,    79,    80,   239,   117,   406,   527,   544,
+     711,   712,   713,   823,   714,   828,   927,   929,   928,    81,
+     232,   233,   803,   532,   533,   534,   535,   536,   537,   923,
+     234,   235,   236,   404,   528,   697,   698,   808,   809,   810,
+     920,   921,    82,   114,   891,   405,   814,    83,   127,    84,
+      85,    86,   345,   762,   625,   763,   764,    87,   481,   482,
+     483,   970,    88,    89,   484,   628,   871,    90,   487,   167,
+     647,   899,   648,   649,   650,   651,   652,   653,   654,   886,
+     887,    91,    92,   789,   486,   768,   769,   656,   901,   902,
+     903,   992,   993,  1124,  1179,  1180,  1072,  1073,  1074,  1075,
+    1182,  1183,  1184,  1076,  1077,  1078,  1079,   994,  1121,  1122,
+    1206,  1244,    93,   771,   631,   876,   877,    94,  1018,  1217,
+      95,  1115,  1203,  1082,  1135,  1194,   936,  1050,    96,   243,
+     244,   409,   933,  1130,  1123,   721,   829,   830,    97,   270,
+     271,   549,    98,   443,   300,   580,   581,   582,   583,   733,
+     734,   735,   837,   940,   736,   737,   949,   950,   951,   952,
+    1019,  1022,  1092,  1154,  1138,  1139,  1140,  1141,  1142,  1143,
+    1144,  1145,  1146,  1221,  1237,  1255,  1032,    99,   307,   588,
+     446,   447,   589,   590,   591,   592,   845,   846,   847,  1159,
+    1039,  1105,  1106,  1163,   848,  1040,  1041,  1157,   849,  1036,
+    1037,  1038,   100,   309,   450,   451,   747,   748,   597,   751,
+     854,   967
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      53,   216,   262,   172,   173,   235,   329,   105,   239,   334,
-     110,   112,   326,   325,   768,   672,   328,   249,   288,   136,
-    1006,  1006,  1125,  1131,   676,   180,   678,   180,   330,   908,
-     680,   253,   561,  1072,  1006,   587,   260,   919,   966,   842,
-    -120,   688,   822,   331,   575,   723,   874,   247,   233,  1099,
-     221,    53,   366,   769,   174,   527,   469,   724,   949,  1015,
-     843,   286,   286,    46,   588,  1151,   543,   679,   714,   920,
-      46,   175,   520,   689,    46,   366,   823,   344,    46,  1194,
-    1157,   786,   584,    46,    99,   822,   645,   787,   690,   691,
-     240,   241,   566,   662,   575,   379,  1212,   100,   191,  1213,
-    1214,   178,   390,   178,   674,   576,   439,   848,   105,   222,
-     844,  1215,  1216,   677,   166,   112,   234,   178,   675,   823,
-     243,   243,   243,   178,   248,   235,   518,   367,    46,   852,
-     955,  -400,   262,   234,   858,   108,   958,   178,   178,   337,
-    1015,   519,   702,   295,   339,  1195,   392,   340,   341,   342,
-     367,   907,   324,   528,   333,   576,  1217,  1099,  1016,   714,
-     941,    46,   380,   393,   824,   398,   101,  1074,   769,  1007,
-    1007,    46,   690,   691,   806,   725,  1218,  1219,   715,    46,
-     722,   967,   200,  1007,   167,   845,  1008,  1008,   176,   469,
-     155,  1225,   529,   798,   168,   169,    46,   673,   376,   377,
-    1008,  1099,   567,   397,   846,   323,   847,   824,   156,  1106,
-     933,   853,  1106,    46,   568,   740,   921,   -60,   102,   166,
-     105,   751,   323,   479,   589,   222,   692,   807,   956,   157,
-     466,   470,   112,   922,   530,   531,   234,   176,    46,    46,
-     674,   728,   103,   368,   369,   370,   371,   563,   372,   716,
-      46,   564,    46,   104,   675,   984,   180,   986,    46,   923,
-      46,   968,    46,   234,    46,   864,   865,   286,   480,   715,
-     942,   924,   848,   693,   117,   532,   323,   170,   323,   951,
-     690,   691,   943,   535,   536,   497,  1069,  1078,    46,   167,
-     680,   135,    46,   998,  1073,   999,   400,   171,   183,   168,
-     169,   184,  1087,   368,   369,   370,   371,   909,   372,   811,
-      46,   694,   176,   185,   573,   186,   544,   801,   323,   158,
-     407,   155,    46,   187,   964,   544,  1024,   286,   286,   544,
-     544,    46,   178,   508,   509,   188,   831,    46,   468,   156,
-     716,   818,   961,   178,   178,   802,    46,   690,   691,   742,
-    1060,   743,   159,  1061,   983,   109,   751,   323,   286,   160,
-     157,   178,   582,   863,   470,   265,   806,   189,  1062,   872,
-     865,   609,   323,   161,   610,   162,   190,   266,   174,   382,
-     383,   166,   170,  1027,  1028,  1029,   267,   744,   115,   174,
-    1206,  1208,   222,   515,   925,   175,    46,   191,   742,    46,
-     743,   981,   171,   178,   178,   537,   175,   987,   116,   268,
-     192,   193,   194,    46,  1186,  1003,  1004,   708,   163,  1181,
-    1227,   195,  1228,  1229,   707,   196,   745,   328,   985,   333,
-     269,   270,   977,   806,   178,   978,   744,   118,   178,   330,
-     946,   784,   948,   785,   950,  1138,  1001,  1002,  1003,  1004,
-     613,   167,   120,   914,   709,   952,   953,   954,   271,   119,
-    1058,   168,   169,  1202,   952,   953,   954,   197,   960,  1026,
-    1209,   468,   166,   245,   246,  1034,   563,   198,   199,  1198,
-     773,   200,  1178,   159,   555,   272,  1231,   563,   559,   560,
-     160,   805,   563,   201,  1199,   202,   820,  1178,   203,   121,
-     925,   925,   741,   122,   161,   123,   162,   204,   975,   976,
-     125,   205,   176,   126,   273,  1037,  1038,  1039,   206,   137,
-     222,   127,   222,   176,   370,   371,   222,   372,   274,   275,
-     276,  1179,  1180,   128,   700,   738,   277,    46,  1190,  1191,
-     129,   278,   167,  1040,   170,  1041,  1042,   130,    46,   163,
-     131,  1192,   168,   169,   138,   133,  1089,   207,   208,   132,
-     134,   996,   997,   324,   171,   135,   812,   139,   814,   140,
-     209,   925,   892,   893,   141,   925,   621,   279,   925,   925,
-     925,   925,   142,   730,   143,   144,   145,  1212,   146,   147,
-    1213,  1214,   148,   622,   280,   149,   150,   281,   152,   153,
-     282,   154,  1215,  1216,   165,   368,   369,   370,   371,   855,
-     372,   178,   333,   234,   219,   285,   292,  1090,   333,   258,
-     381,   382,   383,   384,   877,   427,   879,   623,   230,   624,
-     876,   231,  1056,   301,   328,   170,   332,   343,   849,  1065,
-    1066,  1067,  1068,   344,   345,   346,   330,  1217,   259,   347,
-     821,   328,   625,   348,   349,   171,   368,   369,   370,   371,
-     350,   372,   351,   330,   352,   353,   354,  1218,  1219,  -105,
-     499,   626,   402,   355,   356,   627,   357,   358,   896,   368,
-     369,   370,   371,   862,   372,   359,   939,   360,   361,   222,
-     362,   628,   403,   646,   939,   404,   328,   158,   945,   406,
-     405,   303,   409,   410,   328,  1159,   333,   411,   330,   412,
-     413,   333,   855,   333,   414,   415,   330,   431,   416,   915,
-     918,   417,   304,  1091,   418,   838,   178,   419,   420,   421,
-     629,   630,   422,   333,   423,   879,   424,   425,   305,   916,
-     426,   429,   631,   632,   432,   368,   369,   370,   371,   234,
-     372,   434,   633,   333,   333,   435,   328,   328,   467,   178,
-     333,   222,   222,   438,   869,   439,   333,   442,   330,   330,
-     875,   333,   368,   369,   370,   371,   475,   372,   306,   307,
-     443,   444,   445,   896,   896,  1200,   222,   324,   634,   736,
-     368,   369,   370,   371,   939,   372,   308,   309,   446,   902,
-     902,   447,  1176,   222,   328,   448,  1220,   449,  1222,   450,
-    1223,   451,   310,   311,   312,   178,   330,   534,   452,   453,
-     368,   369,   370,   371,   313,   372,   454,   455,   314,   315,
-     730,   456,   936,   368,   369,   370,   371,   333,   372,   333,
-     936,   333,   328,   457,   316,   317,   318,   319,   234,   458,
-     368,   369,   370,   371,   330,   372,   372,   333,   459,  1001,
-    1002,  1003,  1004,   506,   647,   333,   222,   507,   574,   896,
-     583,   612,  1081,  1118,  1083,   611,   368,   369,   370,   371,
-     333,   372,   368,   369,   370,   371,  -400,   372,   616,   618,
-     648,   619,   324,   324,  1051,   643,   649,   303,  -111,   979,
-     -74,   -74,   -74,   -74,   902,   -74,   902,   667,   668,   541,
-     542,   515,   546,   547,   549,   550,   551,   552,   304,   554,
-     669,   556,   557,   558,  1064,   320,  1126,   368,   369,   370,
-     371,   518,   372,   703,   305,  1132,   683,   684,   685,   686,
-     936,   650,   211,   706,   217,   687,   368,   369,   370,   371,
-     704,   372,   234,   234,   234,   727,   711,   712,   713,   242,
-     651,  1123,   726,   733,   734,   251,   252,   749,   254,   255,
-     256,   257,   781,   754,   306,   307,   756,   757,   324,   290,
-     291,   759,   294,   760,   297,   298,   299,   180,   758,   761,
-     763,   764,   308,   309,   265,   765,   368,   369,   370,   371,
-     178,   372,   762,  1084,   766,   770,   266,  1160,   310,   311,
-     312,   767,  1075,   771,   674,   267,   799,   333,   804,   333,
-     313,   800,   815,   830,   314,   315,   -68,   -68,   -68,   -68,
-     816,   -68,   700,  1188,   832,  1188,  1188,   833,   268,   837,
-     316,   317,   318,   319,   836,   839,   840,   363,   364,   365,
-     841,   861,   873,  1187,  1107,  1187,  1187,  1107,   888,   269,
-     270,   889,   899,   178,   912,  1183,   901,   368,   369,   370,
-     371,   333,   372,   368,   369,   370,   371,   911,   372,   930,
-     333,   652,   931,   932,   940,   671,   959,   271,  1201,   963,
-     974,   982,   700,   368,   369,   370,   371,   988,   372,  1022,
-    1020,  1158,   333,   -67,   -67,   -67,   -67,   653,   -67,   990,
-     368,   369,   370,   371,   272,   372,  1017,   591,   592,   993,
-     594,   320,   596,   597,   654,   599,   600,   601,   602,   603,
-     604,   605,   606,   607,   368,   369,   370,   371,   994,   372,
-    1025,  1052,  1018,   273,   368,   369,   370,   371,   655,   372,
-    1000,  1001,  1002,  1003,  1004,   460,  1193,   274,   275,   276,
-    1019,  1032,  1054,   465,   234,   277,   234,   234,  1033,  1071,
-     278,   368,   369,   370,   371,  1057,   372,  1080,  1085,   954,
-    1096,  1097,   333,  1230,  1098,   481,   482,   483,   484,   485,
-     486,   487,   488,   489,   490,   491,   492,   493,   494,   495,
-     496,  1101,   498,   333,  1102,   333,   279,   333,   500,   501,
-     502,   503,   504,   183,   505,  1103,   184,  1104,  1120,  1141,
-    1121,  1122,  1128,   280,   511,  1136,   281,  1137,   185,   282,
-     186,  1142,  1140,  1155,  1143,  1156,  1162,  1161,   187,   368,
-     369,   370,   371,  1164,   372,   384,   368,   369,   370,   371,
-     188,   372,  1168,   660,  1166,   548,  1170,  1167,  1169,   553,
-     661,   368,   369,   370,   371,  1177,   372,   374,   368,   369,
-     370,   371,   565,   372,  1178,   663,  1182,  1184,  1037,  1038,
-    1039,   745,   189,  1203,  1205,   593,  1207,   595,  1210,  1226,
-     598,   190,   368,   369,   370,   371,  1144,   372,   151,  1117,
-     512,  1165,   608,   513,   737,   296,  1040,   428,  1041,  1042,
-     699,   461,   191,   375,   368,   369,   370,   371,   989,   372,
-    1145,   391,   514,   891,  1035,   192,   193,   194,   883,   368,
-     369,   370,   371,   250,   372,   615,   195,   750,   962,   478,
-     196,   965,  1135,   884,   854,  1197,   665,   666,   368,   369,
-     370,   371,   957,   372,   368,   369,   370,   371,  1139,   372,
-     401,   408,   885,   701,   368,   369,   370,   371,   886,   372,
-     368,   369,   370,   371,   656,   372,   368,   369,   370,   371,
-     657,   372,   197,   935,   819,  1119,   658,   934,  1130,   729,
-    1059,  1070,   198,   199,  1079,   585,   200,   368,   369,   370,
-     371,     0,   372,     0,     0,     0,  1146,   659,   201,     0,
-     202,     0,     0,   203,   664,   368,   369,   370,   371,     0,
-     372,     0,   204,     0,     0,     0,   205,     0,   887,   368,
-     369,   370,   371,   206,   372,   -74,   -74,   -74,   -74,     0,
-     -74,     0,  1147,     0,     0,     0,     0,     0,     0,     0,
-     465,     0,    46,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   183,     0,     0,   184,     0,
-       0,  1141,   207,   208,     0,     0,     0,     0,     0,     0,
-     185,     0,   186,  1142,     0,   209,  1143,     0,     0,     0,
-     187,     0,     0,     0,     0,     0,   774,   775,   776,   777,
-       0,     0,   188,     0,   778,     0,     0,   779,   780,     0,
+      54,   269,   175,   176,   219,   336,   242,   107,   333,   246,
+     332,   113,   115,   256,  1101,   341,  1033,  1033,   688,   183,
+     139,   183,   895,  1155,   785,   295,   692,   931,   694,   704,
+    1129,   260,   696,   335,   554,  1246,   267,  1161,  1247,  1248,
+     730,   862,   254,   842,   338,   730,   479,  1188,   337,  1033,
+    1249,  1250,    54,   538,   373,   177,   293,   293,   598,   989,
+     240,   705,   531,   863,   158,   739,  -121,  1181,   972,    47,
+     577,   964,   178,   586,   572,   786,  1226,   740,    47,   821,
+     843,   586,   159,   169,   842,   224,    47,   599,   158,  1042,
+     247,   248,   806,   706,   707,   695,  1251,    47,   807,   690,
+      47,   101,   868,   181,   160,   181,   159,   822,   657,   978,
+     107,   225,   229,   864,   691,   981,  1252,  1253,   115,   241,
+     181,   843,   693,   250,   250,   250,   181,   255,   160,   386,
+     242,   138,   374,   930,   179,   269,   241,   587,   102,  1129,
+     181,   181,   344,   872,   942,   587,   302,   346,   878,  1227,
+     347,   348,   349,   731,   539,   331,   170,   340,   731,    47,
+    -419,  1259,   110,   706,   707,   718,   171,   172,   844,  1034,
+    1034,  1043,   706,   707,  1042,   706,   707,   943,    47,    47,
+     826,   408,   479,   578,   965,  1129,  1035,  1035,   689,    47,
+     402,   865,   179,   540,   786,   579,   966,   161,   387,   741,
+     818,   595,  1034,   738,   330,   990,   194,   948,   403,   844,
+     866,   388,   867,   620,   956,    47,   621,    47,   708,  1035,
+      47,   624,   179,   107,   732,   838,   225,   111,   449,   732,
+     162,   480,   229,   827,   489,   541,   542,   163,   476,   115,
+    1011,   373,  1013,   241,   103,    47,   -61,    47,  1103,   173,
+     600,   164,   400,   165,   162,   183,   104,    47,   756,   826,
+      47,   163,   826,   112,   767,   709,   293,   490,    47,   174,
+     241,   974,   884,   885,    47,   164,   543,   165,   868,  1102,
+     991,   744,    47,   330,   507,   153,  1098,  1107,  1116,    47,
+    1239,  1241,  1136,   203,   330,  1136,   166,   546,   547,    47,
+     330,   696,    47,   710,   375,   376,   377,   378,   758,   379,
+     759,    47,  1213,   105,   407,  1266,   948,   948,   932,   374,
+     166,   410,  1262,   555,  1263,  1264,    47,   944,   584,   293,
+     293,   417,   555,    47,   984,  1089,   555,   555,  1090,   181,
+      47,   690,   106,  1010,   945,   478,   760,  1051,    47,    47,
+     181,   181,   330,   351,  1091,   632,   691,   831,   873,   330,
+     293,   383,   384,  1218,   593,   979,   330,   480,   181,   674,
+     946,   186,   987,   633,   187,   518,   519,  1171,  1054,  1055,
+    1056,   885,   947,   118,   851,   761,   188,    47,   189,  1172,
+     529,   948,  1173,  1023,  1024,   948,   190,   119,   948,   948,
+     948,   948,   229,   526,   767,   120,   530,   634,   191,   635,
+      47,   883,   121,   181,   181,   548,  1008,   123,   893,  1012,
+     169,   758,  1014,   759,   724,  1004,   169,   574,  1005,   723,
+     574,   575,   636,   122,   790,   375,   376,   377,   378,   340,
+     379,   192,  1168,   800,   181,   998,   126,   801,   181,   999,
+     193,   310,   335,   637,  1235,  1174,   124,   638,   639,   760,
+     566,  1242,   574,   725,   570,   571,   825,   337,  1085,   574,
+     125,   194,   311,   840,   640,  1094,  1095,  1096,  1097,  1175,
+     128,   478,   391,   392,   393,   394,   195,   196,   197,   312,
+     392,   393,   969,   170,   971,   272,   973,   198,  1061,   170,
+    1025,   199,  1026,   171,   172,   377,   378,   273,   379,   171,
+     172,   757,  1231,   641,   642,  1209,   274,   975,   976,   977,
+     983,   683,  1066,  1067,  1068,   643,   644,  1030,  1031,   313,
+     314,   229,   129,   229,   130,   645,  1232,   229,   754,  1209,
+     275,   804,   131,   805,   200,   716,   132,   315,   316,   133,
+    1069,   134,  1070,  1071,   201,   202,   252,   253,   203,  1120,
+     135,   276,   277,  1002,  1003,   317,   318,   319,  1176,   136,
+     204,   646,   205,   137,   331,   206,   265,   138,   320,   142,
+    1224,   140,   321,   322,   207,   832,   173,   834,   208,   278,
+    1211,  1212,   173,   141,   746,   209,  1222,  1223,   323,   324,
+     325,   326,   143,   144,  1177,   266,   174,   968,   375,   376,
+     377,   378,   174,   379,    47,   145,  1246,   146,   279,  1247,
+    1248,   147,   181,   340,   241,   975,   976,   977,   875,   340,
+     148,  1249,  1250,   149,   210,   211,   155,   898,  1118,  1053,
+     897,  1027,  1028,  1029,  1030,  1031,   900,   212,   280,   150,
+     752,   151,   869,   156,   375,   376,   377,   378,   841,   379,
+     152,   157,   281,   282,   283,   335,   375,   376,   377,   378,
+     284,   379,   222,   168,   237,   285,   668,  1251,   888,   327,
+     337,   375,   376,   377,   378,   335,   379,   375,   376,   377,
+     378,   882,   379,   238,   292,   183,   919,  1252,  1253,  1119,
+     337,   299,   962,   308,   339,   229,   350,   351,   352,   353,
+     962,   286,   354,   470,  -106,   355,   356,   357,   375,   376,
+     377,   378,   340,   379,  1207,   358,   359,   340,   287,   340,
+     335,   288,   509,   360,   289,   875,   938,   941,   335,   361,
+     362,   858,   181,   363,   364,   337,   365,   366,   367,   340,
+     368,   939,   369,   337,   412,   375,   376,   377,   378,   900,
+     379,   375,   376,   377,   378,   241,   379,  1190,  1113,   340,
+     340,  1028,  1029,  1030,  1031,   181,   340,   229,   229,   181,
+     413,   890,   414,   340,   161,  1087,   415,   896,   340,  1028,
+    1029,  1030,  1031,   335,   335,   416,   375,   376,   377,   378,
+     683,   379,   441,  1148,   919,   919,   229,   331,   337,   337,
+     658,   419,   420,   962,   421,   422,   423,   424,   425,   925,
+     925,   426,   427,   229,   552,   553,   428,   557,   558,   560,
+     561,   562,   563,   444,   565,   181,   567,   568,   569,   445,
+     429,   335,   375,   376,   377,   378,   430,   379,   431,  1233,
+     746,   432,   959,   433,   687,   434,   337,   340,   435,   340,
+     959,   340,   375,   376,   377,   378,   436,   379,   241,   439,
+     442,  1254,   449,  1256,   448,  1257,   659,   340,   452,   453,
+     454,   455,   310,   335,   485,   340,   229,   375,   376,   377,
+     378,   456,   379,   457,   919,   458,   459,   460,   337,  1225,
+     461,   340,  1110,   311,  1112,   375,   376,   377,   378,   462,
+     379,   463,   214,   464,   220,   331,   331,   465,  1080,   660,
+     312,   466,  1006,   375,   376,   377,   378,   925,   379,   925,
+     249,   467,   468,   469,   526,  1265,   258,   259,   477,   261,
+     262,   263,   264,  1093,   375,   376,   377,   378,   379,   379,
+     297,   298,   516,   301,   669,   304,   305,   306,  1156,   517,
+     313,   314,   521,   959,   545,  -419,   585,  1162,   375,   376,
+     377,   378,   594,   379,   622,   241,   241,   241,   315,   316,
+     623,   627,   661,   629,   655,   630,   679,   375,   376,   377,
+     378,  1153,   379,   681,   680,   529,   317,   318,   319,  1063,
+     699,   662,   700,   701,   702,   331,   703,   719,   183,   320,
+     722,   720,   727,   321,   322,   728,   729,   742,   370,   371,
+     372,   375,   376,   377,   378,   743,   379,   181,   770,   323,
+     324,   325,   326,   749,  1191,   663,   750,   765,   772,  1104,
+     773,   774,   775,   776,   340,   169,   340,   375,   376,   377,
+     378,   798,   379,   177,   777,   779,   780,   781,   782,   716,
+    1220,   664,  1220,  1220,   375,   376,   377,   378,   690,   379,
+     178,   375,   376,   377,   378,   783,   379,   778,   665,   784,
+     787,   670,  1219,  1137,  1219,  1219,  1137,   788,   819,   824,
+     820,   850,   181,  1215,   375,   376,   377,   378,   856,   379,
+     340,   375,   376,   377,   378,   835,   379,   836,   666,   340,
+     327,   375,   376,   377,   378,   667,   379,  1234,   170,   852,
+     937,   716,   857,   853,   859,   672,   860,   861,   171,   172,
+     881,  1189,   340,   894,   602,   603,   909,   605,   475,   607,
+     608,   910,   610,   611,   612,   613,   614,   615,   616,   617,
+     618,  -112,   924,   -75,   -75,   -75,   -75,   922,   -75,   934,
+     491,   492,   493,   494,   495,   496,   497,   498,   499,   500,
+     501,   502,   503,   504,   505,   506,   186,   508,   935,   187,
+     953,   954,   955,   510,   511,   512,   513,   514,   963,   515,
+     179,   188,   982,   189,   986,   241,   997,   241,   241,  1009,
+    1015,   190,   522,   375,   376,   377,   378,  1017,   379,  1044,
+    1020,   173,  1021,   191,   340,    47,  1045,   673,   375,   376,
+     377,   378,  1049,   379,  1046,   375,   376,   377,   378,  1047,
+     379,   174,   675,   559,  1052,  1062,   340,   564,   340,   904,
+     340,  1059,   375,   376,   377,   378,   192,   379,  1060,  1083,
+     576,  1081,  1086,  1114,  1100,   193,   905,   177,  1109,   375,
+     376,   377,   378,   604,   379,   606,   977,   272,   609,  1125,
+    1126,  1127,  1128,   906,   178,  1131,   194,  1132,  1134,   273,
+     619,   375,   376,   377,   378,  1133,   379,  1150,   274,  1158,
+    1166,   195,   196,   197,  1167,   907,  1170,  1192,   375,   376,
+     377,   378,   198,   379,  1195,  1151,   199,  1152,   671,  1185,
+    1186,  1187,   275,   375,   376,   377,   378,  1193,   379,   394,
+    1197,  1198,  1199,  1230,   677,   678,   375,   376,   377,   378,
+    1200,   379,  1201,   276,   277,  1209,  1260,   375,   376,   377,
+     378,  1208,   379,   375,   376,   377,   378,  1274,   379,   200,
+    1214,  1216,  1243,  1276,   761,  1270,  1236,  1238,  1240,   201,
+     202,   278,  1261,   203,   375,   376,   377,   378,  1269,   379,
+    1271,  1272,  1281,   154,  1278,   204,   471,   205,   523,   524,
+     206,   375,   376,   377,   378,  1196,   379,   753,  1147,   207,
+     279,   303,   438,   208,   179,   382,   375,   376,   377,   378,
+     209,   379,   389,  1268,   375,   376,   377,   378,   912,   379,
+    1016,  1280,   381,   375,   376,   377,   378,   401,   379,    47,
+     280,   676,   375,   376,   377,   378,   715,   379,   914,   475,
+     257,   525,   766,  1064,   281,   282,   283,   626,   988,   210,
+     211,   874,   284,  1165,   488,  1229,   985,   285,   186,   980,
+    1169,   187,   212,   411,  1171,   915,   916,   717,   908,   375,
+     376,   377,   378,   188,   379,   189,  1172,   418,   839,  1173,
+    1088,  1149,   745,   190,   957,  1160,   791,   792,   793,   794,
+    1108,   958,     0,   286,   795,   191,   596,   796,   797,   375,
+     376,   377,   378,  1099,   379,     0,   -69,   -69,   -69,   -69,
+     287,   -69,     0,   288,     0,     0,   289,   811,   813,   815,
+     816,   817,     0,     0,  1066,  1067,  1068,     0,   192,     0,
+     -68,   -68,   -68,   -68,     0,   -68,     0,   193,     0,     0,
+       0,   437,  1174,     0,     0,     0,   833,     0,   -75,   -75,
+     -75,   -75,  1069,   -75,  1070,  1071,     0,     0,   194,     0,
+       0,     0,     0,     0,     0,     0,  1175,     0,     0,     0,
+     855,     0,     0,   195,   196,   197,     0,     0,     0,     0,
+       0,     0,     0,     0,   198,     0,     0,     0,   199,     0,
+     879,   880,     0,   186,     0,     0,   187,     0,   889,     0,
+     892,     0,     0,     0,     0,     0,     0,     0,   188,     0,
+     189,     0,     0,     0,     0,     0,     0,     0,   190,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     191,   200,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   201,   202,     0,     0,   203,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1176,     0,   204,     0,   205,
+       0,     0,   206,   192,     0,     0,   169,     0,     0,     0,
+       0,   207,   193,     0,     0,   208,     0,     0,     0,     0,
+       0,     0,   209,     0,     0,     0,     0,     0,     0,     0,
+       0,  1177,     0,   194,     0,     0,     0,     0,     0,     0,
+       0,    47,     0,   186,     0,     0,   187,     0,   195,   196,
+     197,     0,     0,     0,     0,     0,     0,     0,   188,   198,
+     189,   210,   211,   199,     0,     0,   995,   996,   190,     0,
+       0,     0,     0,     0,   212,     0,     0,     0,     0,   170,
+     191,     0,  1007,     0,     0,     0,     0,     0,     0,   171,
+     172,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   200,     0,     0,     0,
+       0,     0,     0,   192,     0,     0,   201,   202,     0,     0,
+     203,     0,   193,     0,   177,     0,  1048,     0,     0,     0,
+       0,     0,   204,     0,   205,     0,     0,   206,     0,     0,
+    1057,   178,     0,   194,  1058,     0,   207,     0,     0,     0,
+     208,     0,     0,     0,     0,     0,     0,   209,   195,   196,
+     197,     0,     0,     0,     0,     0,     0,  1065,     0,   198,
+       0,     0,   173,   199,     0,     0,    47,     0,  1084,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   174,     0,     0,     0,   210,   211,     0,     0,
+       0,     0,     0,  1111,     0,     0,     0,     0,     0,   212,
+    1117,     0,     0,     0,     0,     0,   200,     0,     0,     0,
+     186,     0,     0,   187,     0,     0,   201,   202,     0,     0,
+     203,     0,     0,     0,     0,   188,     0,   189,     0,     0,
+       0,     0,   204,     0,   205,   190,     0,   206,     0,     0,
+       0,     0,     0,     0,     0,     0,   207,   191,     0,     0,
+     208,   179,     0,     0,     0,     0,     0,   209,   186,     0,
+       0,   187,  1164,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1178,   188,     0,   189,    47,     0,     0,     0,
+     192,     0,     0,   190,     0,     0,     0,     0,     0,   193,
+       0,   177,     0,     0,     0,   191,   210,   211,     0,     0,
+       0,     0,   330,     0,     0,     0,  1202,     0,   178,   212,
+     194,     0,     0,     0,  1204,  1205,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   195,   196,   197,   192,     0,
+       0,     0,     0,  1210,  1178,  1178,   198,   193,     0,     0,
+     199,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1228,     0,  1178,   194,   296,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   791,   793,   795,   796,   797,     0,     0,
-       0,     0,     0,     0,   189,     0,     0,     0,     0,     0,
-       0,     0,     0,   190,     0,     0,     0,     0,  1144,     0,
-       0,     0,   813,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   191,     0,     0,     0,     0,     0,
-       0,     0,  1145,     0,     0,     0,   835,   192,   193,   194,
-       0,     0,     0,     0,     0,     0,     0,     0,   195,     0,
-       0,     0,   196,     0,     0,     0,   859,   860,     0,     0,
-       0,     0,     0,   868,     0,   871,     0,     0,     0,     0,
+       0,     0,     0,   195,   196,   197,     0,     0,  1245,     0,
+       0,     0,     0,   200,   198,     0,     0,     0,   199,     0,
+       0,  1258,     0,   201,   202,     0,     0,   203,     0,     0,
+     186,     0,     0,   187,     0,     0,     0,     0,  1267,   204,
+       0,   205,     0,     0,   206,   188,     0,   189,     0,     0,
+    1273,     0,  1275,   207,  1277,   190,  1279,   208,   179,     0,
+       0,   200,     0,     0,   209,   186,     0,   191,   187,     0,
+       0,   201,   202,     0,     0,   203,     0,     0,     0,     0,
+     188,     0,   189,    47,     0,     0,     0,   204,     0,   205,
+     190,     0,   206,     0,     0,     0,     0,     0,     0,     0,
+     192,   207,   191,   210,   211,   208,     0,     0,     0,   193,
+       0,     0,   209,     0,     0,     0,   212,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     194,    47,     0,     0,     0,   192,     0,     0,     0,     0,
+       0,     0,     0,     0,   193,   195,   196,   197,     0,     0,
+       0,   210,   211,     0,     0,     0,   198,     0,     0,     0,
+     199,     0,     0,     0,   212,   194,     0,     0,     0,     0,
+       0,   186,     0,     0,   187,     0,     0,     0,     0,     0,
+     195,   196,   197,     0,     0,     0,   188,     0,   189,     0,
+       0,   198,     0,     0,     0,   199,   190,     0,     0,     0,
+       0,     0,     0,   200,     0,     0,     0,     0,   191,     0,
+       0,     0,     0,   201,   202,     0,     0,   203,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   204,
+       0,   205,     0,     0,   206,     0,     0,     0,   200,     0,
+       0,   192,     0,   207,     0,     0,     0,   208,   201,   202,
+     193,     0,   203,     0,   209,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   204,     0,   205,     0,     0,   206,
+       0,   194,     0,    47,     0,     0,     0,     0,   207,     0,
+       0,     0,   208,     0,     0,     0,   195,   196,   197,   209,
+       0,     0,     0,   210,   211,     0,     0,   198,     0,   472,
+       0,   199,     0,     0,     0,   812,   212,     0,    47,     0,
+       0,     0,     0,     0,     0,   186,     0,     0,   187,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   210,   211,
+     188,     0,   189,     0,     0,     0,     0,     0,     0,     0,
+     190,   212,     0,     0,   200,     0,     0,     0,     0,     0,
+       0,     0,   191,     0,   201,   202,     0,     0,   203,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   197,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   198,   199,     0,     0,   200,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,  1146,     0,
-     201,     0,   202,     0,     0,   203,     0,     0,     0,     0,
-       0,     0,     0,     0,   204,     0,     0,     0,   205,     0,
-       0,     0,     0,   183,     0,   206,   184,     0,     0,     0,
-       0,     0,     0,     0,  1147,     0,     0,     0,   185,     0,
-     186,     0,     0,     0,    46,     0,     0,     0,   187,     0,
+     204,     0,   205,     0,     0,   206,     0,     0,     0,     0,
+       0,     0,     0,     0,   207,   192,     0,     0,   208,     0,
+       0,     0,     0,     0,   193,   209,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     188,     0,     0,     0,   207,   208,     0,   972,   973,     0,
-       0,     0,     0,     0,     0,     0,     0,   209,     0,     0,
-       0,   980,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   189,     0,     0,   166,     0,     0,     0,     0,
-       0,   190,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    47,   194,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   191,     0,     0,  1021,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   192,   193,   194,     0,  1030,
-       0,     0,     0,  1031,     0,     0,   195,     0,     0,     0,
-     196,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,  1036,     0,     0,   167,     0,     0,     0,     0,
-       0,     0,     0,  1055,     0,   168,   169,     0,     0,     0,
+     195,   196,   197,     0,   210,   211,     0,     0,     0,     0,
+     330,   198,     0,     0,     0,   199,     0,   212,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   197,     0,     0,     0,     0,     0,  1082,     0,
-       0,     0,   198,   199,     0,  1088,   200,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   183,     0,   201,   184,
-     202,     0,     0,   203,     0,     0,     0,     0,     0,     0,
-       0,   185,   204,   186,     0,     0,   205,     0,     0,     0,
-       0,   187,     0,   206,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   188,   183,     0,     0,   184,   170,     0,
-       0,     0,    46,     0,     0,  1134,     0,     0,     0,   185,
-       0,   186,     0,     0,     0,  1148,     0,     0,   171,   187,
-       0,     0,   207,   208,     0,   189,     0,     0,     0,     0,
-       0,   188,     0,     0,   190,   209,   174,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,  1171,     0,
-       0,     0,     0,   175,     0,   191,  1173,  1174,     0,     0,
-       0,     0,     0,   189,     0,     0,     0,     0,   192,   193,
-     194,     0,   190,     0,   174,  1148,  1148,     0,     0,   195,
-       0,     0,     0,   196,     0,     0,     0,     0,     0,     0,
-       0,   175,     0,   191,     0,     0,  1196,     0,  1148,     0,
-       0,     0,     0,     0,     0,     0,   192,   193,   194,     0,
-       0,     0,   183,     0,     0,   184,     0,   195,     0,     0,
-       0,   196,     0,     0,     0,   197,     0,   185,     0,   186,
-    1224,     0,     0,     0,     0,   198,   199,   187,     0,   200,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   188,
-       0,   201,     0,   202,     0,     0,   203,     0,     0,     0,
-       0,     0,     0,   197,     0,   204,     0,     0,     0,   205,
-     176,     0,     0,   198,   199,     0,   206,   200,     0,     0,
-       0,   189,     0,     0,     0,     0,     0,     0,     0,   201,
-     190,   202,     0,     0,   203,    46,     0,     0,     0,     0,
-       0,     0,     0,   204,     0,     0,     0,   205,   176,     0,
-       0,   191,   289,     0,   206,   207,   208,     0,     0,     0,
-       0,   323,     0,     0,   192,   193,   194,   183,   209,     0,
-     184,     0,     0,    46,     0,   195,     0,     0,     0,   196,
-       0,     0,   185,     0,   186,     0,     0,     0,     0,     0,
-       0,     0,   187,   207,   208,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   188,   183,   209,     0,   184,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     185,   197,   186,     0,     0,     0,     0,     0,     0,     0,
-     187,   198,   199,     0,     0,   200,   189,     0,     0,     0,
-       0,     0,   188,     0,     0,   190,     0,   201,     0,   202,
-       0,     0,   203,     0,     0,     0,     0,     0,     0,     0,
-       0,   204,     0,     0,     0,   205,   191,     0,     0,     0,
-       0,     0,   206,     0,   189,     0,     0,     0,     0,   192,
-     193,   194,     0,   190,     0,     0,     0,     0,     0,     0,
-     195,    46,     0,     0,   196,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   191,     0,     0,     0,     0,     0,
-       0,   207,   208,     0,     0,     0,     0,   192,   193,   194,
-       0,     0,     0,   183,   209,     0,   184,     0,   195,     0,
-       0,     0,   196,     0,     0,     0,   197,     0,   185,     0,
-     186,     0,     0,     0,     0,     0,   198,   199,   187,     0,
-     200,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     188,     0,   201,     0,   202,     0,     0,   203,     0,     0,
-       0,     0,     0,     0,   197,     0,   204,     0,     0,     0,
-     205,     0,     0,     0,   198,   199,     0,   206,   200,     0,
-       0,     0,   189,     0,     0,     0,     0,     0,     0,     0,
-     201,   190,   202,     0,     0,   203,    46,     0,     0,     0,
-       0,     0,     0,     0,   204,     0,     0,     0,   205,     0,
-       0,     0,   191,     0,     0,   206,   207,   208,     0,     0,
-       0,     0,   462,     0,     0,   192,   193,   194,     0,   209,
-       0,   792,     0,     0,    46,     0,   195,     0,     0,     0,
-     196,     0,     0,   183,     0,     0,   184,     0,     0,     0,
-       0,     0,     0,     0,   207,   208,     0,     0,   185,     0,
-     186,     0,     0,     0,     0,     0,     0,   209,   187,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     188,     0,   197,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   198,   199,     0,     0,   200,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   201,     0,
-     202,     0,   189,   203,     0,     0,     0,     0,     0,     0,
-       0,   190,   204,     0,     0,     0,   205,     0,     0,     0,
-       0,     0,     0,   206,     0,     0,     0,     0,     0,     0,
-       0,     0,   191,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    46,     0,     0,   192,   193,   194,     0,     0,
-       0,     0,     0,     0,     0,     0,   195,     0,     0,     0,
-     196,     0,   207,   208,     1,     0,     0,     0,   323,     0,
-       0,     0,     0,     0,     0,   209,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     2,
-       3,     4,     5,     6,     0,     0,     0,     0,     0,     0,
-       0,     0,   197,     0,     0,     7,     8,     9,    10,    11,
-      12,    13,   198,   199,     0,     0,   200,     0,    14,    15,
-      16,     0,     0,     0,     0,     0,     0,     0,   201,     0,
-     202,     0,     0,   203,     0,    17,     0,     0,     0,     0,
-       0,     0,   204,    18,    19,     0,   205,     0,     0,     0,
-       0,     0,     0,   206,     0,     0,    20,     0,     0,     0,
-      21,     0,     0,    22,     0,     0,     0,    23,    24,     0,
-       0,     0,    46,     0,     0,     0,     0,     0,     0,     0,
-      25,    26,    27,    28,    29,     0,     0,     0,     0,     0,
-       0,    30,   207,   208,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   209,     0,     0,     0,    31,
+       0,     0,     0,     0,     0,     0,     0,     0,   200,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   201,   202,
+       0,     0,   203,     0,     0,     0,     0,     0,     1,     0,
+       0,     0,     0,     0,   204,     0,   205,     0,     0,   206,
+       0,     0,     0,     0,     0,     0,     0,     0,   207,     0,
+       0,     0,   208,     2,     3,     4,     5,     6,     0,   209,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     7,
+       8,     9,    10,    11,    12,    13,    14,     0,    47,     0,
+       0,     0,     0,    15,    16,    17,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   210,   211,
+      18,     0,     0,     0,     0,     0,     0,     0,    19,    20,
+       0,   212,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    21,     0,     0,     0,    22,     0,     0,    23,     0,
+       0,     0,    24,    25,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    26,    27,    28,
+      29,    30,     0,     0,     0,     0,     0,     0,    31,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    32,    33,    34,    35,     0,     0,     0,
-       0,     0,     0,     0,    36,    37,     0,     0,     0,    38,
-      39,     0,     0,    40,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    32,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    41,     0,     0,     0,     0,
-      42,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    43,    44,
+       0,    33,    34,    35,    36,     0,     0,     0,     0,     0,
+       0,     0,    37,    38,     0,     0,     0,    39,    40,     0,
+       0,    41,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      45,    46,     0,     0,    47,     0,     0,    48,     0,     0,
-       0,     0,     0,     0,     0,    49
+       0,     0,     0,    42,     0,     0,     0,     0,    43,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    44,    45,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    46,    47,
+       0,     0,    48,     0,     0,    49,     0,     0,     0,     0,
+       0,     0,     0,    50
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,   103,   133,    99,   100,   116,   152,     7,   117,   154,
-      10,    11,   152,   152,   635,   516,   152,   124,   138,    35,
-       8,     8,    12,    15,   520,   101,   522,   103,   152,    13,
-     526,   127,   429,    13,     8,    66,   132,    41,    52,    42,
-      82,     4,   106,   152,    77,    17,   768,   123,   115,  1043,
-     108,    51,    71,   635,    83,    54,   338,    29,   840,   932,
-      63,   137,   138,   242,    95,  1095,    27,   148,    92,    73,
-     242,   100,   394,    36,   242,    71,   140,   260,   242,    38,
-    1100,   262,   114,   242,   259,   106,   479,   268,   135,   136,
-     141,   142,   105,   276,    77,   274,     7,   259,   102,    10,
-      11,   101,   274,   103,   263,   138,   138,   275,   108,   109,
-     113,    22,    23,   277,    75,   115,   116,   117,   277,   140,
-     120,   121,   122,   123,   124,   236,   263,   146,   242,   750,
-     852,   173,   263,   133,   755,   273,   858,   137,   138,   155,
-    1013,   278,   535,   143,   160,  1175,   262,   163,   164,   165,
-     146,   800,   152,   152,   154,   138,    67,  1151,   940,    92,
-     105,   242,   220,   279,   228,   232,   259,  1012,   750,   157,
-     157,   242,   135,   136,   221,   147,    87,    88,   202,   242,
-     573,   195,   186,   157,   145,   188,   174,   174,   217,   471,
-      25,  1211,   191,   689,   155,   156,   242,   519,    56,    57,
-     174,  1195,   215,   274,   207,   268,   209,   228,    43,  1054,
-     274,   274,  1057,   242,   227,   612,   220,   259,   259,    75,
-     220,   618,   268,   343,   255,   225,   189,   274,   274,    64,
-     332,   338,   232,   237,   233,   234,   236,   217,   242,   242,
-     263,   274,   259,   262,   263,   264,   265,   272,   267,   273,
-     242,   276,   242,   259,   277,   904,   332,   906,   242,   263,
-     242,   882,   242,   263,   242,   761,   762,   343,   344,   202,
-     215,   275,   275,   236,   259,   274,   268,   238,   268,   848,
-     135,   136,   227,   403,   404,   361,   274,   274,   242,   145,
-     786,   273,   242,   272,   274,   274,   274,   258,     3,   155,
-     156,     6,  1024,   262,   263,   264,   265,   803,   267,   706,
-     242,   274,   217,    18,   434,    20,   412,   231,   268,   154,
-     274,    25,   242,    28,   274,   421,   947,   403,   404,   425,
-     426,   242,   332,    44,    45,    40,   733,   242,   338,    43,
-     273,   274,   274,   343,   344,   259,   242,   135,   136,   197,
-     259,   199,   187,   262,   274,   273,   753,   268,   434,   194,
-      64,   361,   438,   760,   471,    14,   221,    72,   277,   766,
-     866,   269,   268,   208,   272,   210,    81,    26,    83,   271,
-     272,    75,   238,   952,   953,   954,    35,   235,   273,    83,
-    1190,  1191,   392,   393,   817,   100,   242,   102,   197,   242,
-     199,   902,   258,   403,   404,   405,   100,   908,   273,    58,
-     115,   116,   117,   242,   257,   264,   265,   563,   253,   274,
-    1220,   126,  1222,  1223,   563,   130,   274,   563,   274,   429,
-      79,    80,   269,   221,   434,   272,   235,   259,   438,   563,
-     837,   676,   839,   678,   841,   274,   262,   263,   264,   265,
-     154,   145,   275,   147,   563,   262,   263,   264,   107,   259,
-     276,   155,   156,  1185,   262,   263,   264,   172,   865,   276,
-    1192,   471,    75,   121,   122,   274,   272,   182,   183,   269,
-     276,   186,   272,   187,   421,   134,   274,   272,   425,   426,
-     194,   276,   272,   198,   269,   200,   276,   272,   203,   275,
-     923,   924,   613,   275,   208,   259,   210,   212,   892,   893,
-     259,   216,   217,   259,   163,    68,    69,    70,   223,   275,
-     520,   259,   522,   217,   264,   265,   526,   267,   177,   178,
-     179,  1155,  1156,   259,   534,   611,   185,   242,  1166,  1167,
-     259,   190,   145,    96,   238,    98,    99,   259,   242,   253,
-     259,  1172,   155,   156,   275,   273,   213,   262,   263,   259,
-     273,   923,   924,   563,   258,   273,   711,   259,   713,   259,
-     275,   994,   277,   278,   273,   998,    38,   226,  1001,  1002,
-    1003,  1004,   259,   583,   275,   259,   259,     7,   259,   273,
-      10,    11,   273,    55,   243,   273,     0,   246,   259,    82,
-     249,   259,    22,    23,   173,   262,   263,   264,   265,   754,
-     267,   611,   612,   613,   273,    39,   158,   274,   618,   222,
-     270,   271,   272,   273,   770,   274,   771,    89,   273,    91,
-     770,   273,   994,    78,   770,   238,   275,   275,   749,  1001,
-    1002,  1003,  1004,   260,   275,   275,   770,    67,   251,   275,
-     726,   787,   114,   275,   275,   258,   262,   263,   264,   265,
-     275,   267,   275,   787,   275,   275,   275,    87,    88,   260,
-     276,   133,   276,   275,   275,   137,   275,   275,   787,   262,
-     263,   264,   265,   759,   267,   275,   832,   275,   275,   689,
-     275,   153,   272,   276,   840,   272,   832,   154,   215,   273,
-     268,    16,   259,   259,   840,  1102,   706,   259,   832,   259,
-     259,   711,   857,   713,   259,   259,   840,   276,   259,   815,
-     816,   259,    37,   213,   259,   741,   726,   259,   259,   259,
-     192,   193,   259,   733,   259,   880,   259,   259,    53,   815,
-     259,   259,   204,   205,   259,   262,   263,   264,   265,   749,
-     267,   272,   214,   753,   754,   131,   892,   893,    39,   759,
-     760,   761,   762,   259,   764,   138,   766,   259,   892,   893,
-     770,   771,   262,   263,   264,   265,   244,   267,    93,    94,
-     259,   259,   259,   892,   893,  1182,   786,   787,   250,   231,
-     262,   263,   264,   265,   940,   267,   111,   112,   259,   799,
-     800,   259,   231,   803,   940,   259,  1203,   259,  1205,   259,
-    1207,   259,   127,   128,   129,   815,   940,   268,   259,   259,
-     262,   263,   264,   265,   139,   267,   259,   259,   143,   144,
-     830,   259,   832,   262,   263,   264,   265,   837,   267,   839,
-     840,   841,   978,   259,   159,   160,   161,   162,   848,   259,
-     262,   263,   264,   265,   978,   267,   267,   857,   259,   262,
-     263,   264,   265,   259,   276,   865,   866,   259,   259,   978,
-     259,   259,  1017,   276,  1019,   272,   262,   263,   264,   265,
-     880,   267,   262,   263,   264,   265,   173,   267,   201,   273,
-     276,   225,   892,   893,   990,    62,   276,    16,   260,   899,
-     262,   263,   264,   265,   904,   267,   906,   259,   259,   410,
-     411,   911,   413,   414,   415,   416,   417,   418,    37,   420,
-     224,   422,   423,   424,  1000,   240,  1071,   262,   263,   264,
-     265,   263,   267,   276,    53,  1080,   259,   259,   259,   259,
-     940,   276,   102,   272,   104,   259,   262,   263,   264,   265,
-     269,   267,   952,   953,   954,   273,   259,   259,   259,   119,
-     276,  1063,   259,   259,   254,   125,   126,   259,   128,   129,
-     130,   131,   118,   273,    93,    94,   259,   259,   978,   139,
-     140,   259,   142,   259,   144,   145,   146,  1063,   273,   259,
-     259,   259,   111,   112,    14,   259,   262,   263,   264,   265,
-    1000,   267,   273,   269,   259,   259,    26,  1103,   127,   128,
-     129,   273,  1012,   273,   263,    35,   273,  1017,   269,  1019,
-     139,   273,   259,   262,   143,   144,   262,   263,   264,   265,
-     259,   267,  1032,  1164,   259,  1166,  1167,   252,    58,   272,
-     159,   160,   161,   162,   276,   259,   259,   207,   208,   209,
-     259,   120,   119,  1164,  1054,  1166,  1167,  1057,   259,    79,
-      80,    74,   261,  1063,   171,  1161,   259,   262,   263,   264,
-     265,  1071,   267,   262,   263,   264,   265,   259,   267,   273,
-    1080,   276,   273,   273,   259,   274,   259,   107,  1184,   259,
-     274,   259,  1092,   262,   263,   264,   265,   273,   267,    19,
-     274,  1101,  1102,   262,   263,   264,   265,   276,   267,   259,
-     262,   263,   264,   265,   134,   267,   259,   443,   444,   268,
-     446,   240,   448,   449,   276,   451,   452,   453,   454,   455,
-     456,   457,   458,   459,   262,   263,   264,   265,   275,   267,
-     272,   168,   259,   163,   262,   263,   264,   265,   276,   267,
-     261,   262,   263,   264,   265,   274,   274,   177,   178,   179,
-     259,   273,   268,   323,  1164,   185,  1166,  1167,   273,   279,
-     190,   262,   263,   264,   265,   268,   267,   279,   259,   264,
-     269,   259,  1182,   274,   259,   345,   346,   347,   348,   349,
-     350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
-     360,   259,   362,  1203,   259,  1205,   226,  1207,   368,   369,
-     370,   371,   372,     3,   374,   259,     6,   169,   277,     9,
-     277,   277,   259,   243,   384,   259,   246,   259,    18,   249,
-      20,    21,   273,   268,    24,   268,   170,   259,    28,   262,
-     263,   264,   265,   272,   267,   273,   262,   263,   264,   265,
-      40,   267,   269,   276,   272,   415,   277,   272,   269,   419,
-     276,   262,   263,   264,   265,   274,   267,   261,   262,   263,
-     264,   265,   432,   267,   272,   276,   272,   259,    68,    69,
-      70,   274,    72,   272,   272,   445,   272,   447,   259,   272,
-     450,    81,   262,   263,   264,   265,    86,   267,    51,   269,
-     386,  1107,   462,   386,   610,   143,    96,   283,    98,    99,
-     533,   321,   102,   218,   262,   263,   264,   265,   911,   267,
-     110,   225,   392,   786,   978,   115,   116,   117,   276,   262,
-     263,   264,   265,   124,   267,   471,   126,   617,   866,   342,
-     130,   880,  1086,   276,   753,  1178,   506,   507,   262,   263,
-     264,   265,   857,   267,   262,   263,   264,   265,  1092,   267,
-     236,   263,   276,   534,   262,   263,   264,   265,   276,   267,
-     262,   263,   264,   265,   272,   267,   262,   263,   264,   265,
-     272,   267,   172,   830,   717,  1057,   272,   825,  1077,   577,
-     998,  1009,   182,   183,  1013,   440,   186,   262,   263,   264,
-     265,    -1,   267,    -1,    -1,    -1,   196,   272,   198,    -1,
-     200,    -1,    -1,   203,   261,   262,   263,   264,   265,    -1,
-     267,    -1,   212,    -1,    -1,    -1,   216,    -1,   261,   262,
-     263,   264,   265,   223,   267,   262,   263,   264,   265,    -1,
-     267,    -1,   232,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     610,    -1,   242,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,     3,    -1,    -1,     6,    -1,
-      -1,     9,   262,   263,    -1,    -1,    -1,    -1,    -1,    -1,
-      18,    -1,    20,    21,    -1,   275,    24,    -1,    -1,    -1,
-      28,    -1,    -1,    -1,    -1,    -1,   656,   657,   658,   659,
-      -1,    -1,    40,    -1,   664,    -1,    -1,   667,   668,    -1,
+       0,   136,   101,   102,   105,   155,   119,     7,   155,   120,
+     155,    11,    12,   127,    13,   157,     8,     8,   527,   103,
+      36,   105,   785,    12,   647,   141,   531,    13,   533,     4,
+    1072,   130,   537,   155,    27,     7,   135,    15,    10,    11,
+      93,    42,   126,   107,   155,    93,   345,  1130,   155,     8,
+      22,    23,    52,    55,    72,    84,   140,   141,    67,    53,
+     118,    36,   404,    64,    25,    17,    83,  1124,   860,   246,
+     106,   106,   101,    78,   439,   647,    38,    29,   246,   235,
+     144,    78,    43,    76,   107,   110,   246,    96,    25,   955,
+     145,   146,   266,   138,   139,   152,    68,   246,   272,   267,
+     246,   263,   279,   103,    65,   105,    43,   263,   489,   872,
+     110,   111,   112,   114,   282,   878,    88,    89,   118,   119,
+     120,   144,   282,   123,   124,   125,   126,   127,    65,   278,
+     243,   277,   150,   820,   221,   270,   136,   142,   263,  1181,
+     140,   141,   158,   766,    41,   142,   146,   163,   771,  1206,
+     166,   167,   168,   206,   156,   155,   149,   157,   206,   246,
+     177,  1244,   277,   138,   139,   546,   159,   160,   232,   161,
+     161,   963,   138,   139,  1040,   138,   139,    74,   246,   246,
+     225,   239,   481,   219,   219,  1227,   178,   178,   530,   246,
+     266,   192,   221,   195,   766,   231,   231,   158,   223,   151,
+     705,   115,   161,   584,   272,   199,   103,   837,   284,   232,
+     211,   278,   213,   273,   278,   246,   276,   246,   193,   178,
+     246,   158,   221,   223,   277,   278,   226,   277,   142,   277,
+     191,   345,   232,   278,   350,   237,   238,   198,   339,   239,
+     927,    72,   929,   243,   263,   246,   263,   246,  1039,   242,
+     259,   212,   278,   214,   191,   339,   263,   246,   623,   225,
+     246,   198,   225,   277,   629,   240,   350,   351,   246,   262,
+     270,   868,   777,   778,   246,   212,   278,   214,   279,   278,
+     903,   278,   246,   272,   368,     0,   278,   278,  1051,   246,
+    1222,  1223,  1083,   190,   272,  1086,   257,   413,   414,   246,
+     272,   806,   246,   278,   266,   267,   268,   269,   201,   271,
+     203,   246,   278,   263,   278,   278,   946,   947,   823,   150,
+     257,   278,  1254,   422,  1256,  1257,   246,   224,   444,   413,
+     414,   278,   431,   246,   278,   263,   435,   436,   266,   339,
+     246,   267,   263,   278,   241,   345,   239,   970,   246,   246,
+     350,   351,   272,   264,   282,    38,   282,   722,   278,   272,
+     444,    57,    58,   261,   448,   278,   272,   481,   368,   280,
+     267,     3,   278,    56,     6,    44,    45,     9,   975,   976,
+     977,   886,   279,   277,   749,   278,    18,   246,    20,    21,
+     267,  1021,    24,   946,   947,  1025,    28,   277,  1028,  1029,
+    1030,  1031,   402,   403,   769,   263,   283,    90,    40,    92,
+     246,   776,   263,   413,   414,   415,   925,   279,   783,   278,
+      76,   201,   931,   203,   574,   273,    76,   276,   276,   574,
+     276,   280,   115,   263,   280,   266,   267,   268,   269,   439,
+     271,    73,   278,   276,   444,   277,   263,   280,   448,   281,
+      82,    16,   574,   136,  1217,    87,   279,   140,   141,   239,
+     431,  1224,   276,   574,   435,   436,   280,   574,  1021,   276,
+     279,   103,    37,   280,   157,  1028,  1029,  1030,  1031,   111,
+     263,   481,   274,   275,   276,   277,   118,   119,   120,    54,
+     275,   276,   857,   149,   859,    14,   861,   129,   278,   149,
+     276,   133,   278,   159,   160,   268,   269,    26,   271,   159,
+     160,   624,   273,   196,   197,   276,    35,   266,   267,   268,
+     885,   521,    69,    70,    71,   208,   209,   268,   269,    94,
+      95,   531,   263,   533,   263,   218,   273,   537,   622,   276,
+      59,   692,   263,   694,   176,   545,   263,   112,   113,   263,
+      97,   263,    99,   100,   186,   187,   124,   125,   190,   217,
+     263,    80,    81,   915,   916,   130,   131,   132,   200,   277,
+     202,   254,   204,   277,   574,   207,   226,   277,   143,   263,
+    1203,   279,   147,   148,   216,   727,   242,   729,   220,   108,
+    1186,  1187,   242,   279,   594,   227,  1197,  1198,   163,   164,
+     165,   166,   263,   277,   236,   255,   262,   219,   266,   267,
+     268,   269,   262,   271,   246,   263,     7,   279,   137,    10,
+      11,   263,   622,   623,   624,   266,   267,   268,   770,   629,
+     263,    22,    23,   263,   266,   267,   263,   787,   217,   280,
+     787,   265,   266,   267,   268,   269,   788,   279,   167,   277,
+     235,   277,   765,    83,   266,   267,   268,   269,   742,   271,
+     277,   263,   181,   182,   183,   787,   266,   267,   268,   269,
+     189,   271,   277,   177,   277,   194,   276,    68,   779,   244,
+     787,   266,   267,   268,   269,   807,   271,   266,   267,   268,
+     269,   775,   271,   277,    39,   779,   807,    88,    89,   278,
+     807,   162,   852,    79,   279,   705,   279,   264,   279,   279,
+     860,   230,   279,   278,   264,   279,   279,   279,   266,   267,
+     268,   269,   722,   271,   235,   279,   279,   727,   247,   729,
+     852,   250,   280,   279,   253,   877,   835,   836,   860,   279,
+     279,   757,   742,   279,   279,   852,   279,   279,   279,   749,
+     279,   835,   279,   860,   280,   266,   267,   268,   269,   901,
+     271,   266,   267,   268,   269,   765,   271,  1132,   273,   769,
+     770,   266,   267,   268,   269,   775,   776,   777,   778,   779,
+     276,   781,   276,   783,   158,   280,   272,   787,   788,   266,
+     267,   268,   269,   915,   916,   277,   266,   267,   268,   269,
+     800,   271,   280,   280,   915,   916,   806,   807,   915,   916,
+     280,   263,   263,   963,   263,   263,   263,   263,   263,   819,
+     820,   263,   263,   823,   420,   421,   263,   423,   424,   425,
+     426,   427,   428,   276,   430,   835,   432,   433,   434,   134,
+     263,   963,   266,   267,   268,   269,   263,   271,   263,  1214,
+     850,   263,   852,   263,   278,   263,   963,   857,   263,   859,
+     860,   861,   266,   267,   268,   269,   263,   271,   868,   263,
+     263,  1236,   142,  1238,   263,  1240,   280,   877,   263,   263,
+     263,   263,    16,  1005,   248,   885,   886,   266,   267,   268,
+     269,   263,   271,   263,  1005,   263,   263,   263,  1005,   278,
+     263,   901,  1044,    37,  1046,   266,   267,   268,   269,   263,
+     271,   263,   104,   263,   106,   915,   916,   263,  1017,   280,
+      54,   263,   922,   266,   267,   268,   269,   927,   271,   929,
+     122,   263,   263,   263,   934,   278,   128,   129,    39,   131,
+     132,   133,   134,  1027,   266,   267,   268,   269,   271,   271,
+     142,   143,   263,   145,   276,   147,   148,   149,  1100,   263,
+      94,    95,   279,   963,   272,   177,   263,  1109,   266,   267,
+     268,   269,   263,   271,   276,   975,   976,   977,   112,   113,
+     263,   205,   280,   277,    63,   229,   263,   266,   267,   268,
+     269,  1092,   271,   228,   263,   267,   130,   131,   132,   999,
+     263,   280,   263,   263,   263,  1005,   263,   280,  1092,   143,
+     276,   273,   263,   147,   148,   263,   263,   263,   210,   211,
+     212,   266,   267,   268,   269,   277,   271,  1027,   277,   163,
+     164,   165,   166,   263,  1133,   280,   258,   263,   263,  1039,
+     263,   277,   263,   263,  1044,    76,  1046,   266,   267,   268,
+     269,   121,   271,    84,   263,   263,   263,   263,   263,  1059,
+    1195,   280,  1197,  1198,   266,   267,   268,   269,   267,   271,
+     101,   266,   267,   268,   269,   263,   271,   277,   280,   277,
+     263,   276,  1195,  1083,  1197,  1198,  1086,   277,   277,   273,
+     277,   266,  1092,  1192,   266,   267,   268,   269,   280,   271,
+    1100,   266,   267,   268,   269,   263,   271,   263,   280,  1109,
+     244,   266,   267,   268,   269,   280,   271,  1216,   149,   263,
+     151,  1121,   276,   256,   263,   280,   263,   263,   159,   160,
+     123,  1131,  1132,   122,   453,   454,   263,   456,   330,   458,
+     459,    75,   461,   462,   463,   464,   465,   466,   467,   468,
+     469,   264,   263,   266,   267,   268,   269,   265,   271,   263,
+     352,   353,   354,   355,   356,   357,   358,   359,   360,   361,
+     362,   363,   364,   365,   366,   367,     3,   369,   175,     6,
+     277,   277,   277,   375,   376,   377,   378,   379,   263,   381,
+     221,    18,   263,    20,   263,  1195,   278,  1197,  1198,   263,
+     277,    28,   394,   266,   267,   268,   269,   263,   271,   263,
+     272,   242,   279,    40,  1214,   246,   263,   280,   266,   267,
+     268,   269,    19,   271,   263,   266,   267,   268,   269,   278,
+     271,   262,   280,   425,   276,   116,  1236,   429,  1238,   280,
+    1240,   277,   266,   267,   268,   269,    73,   271,   277,   272,
+     442,   172,   272,   263,   284,    82,   280,    84,   284,   266,
+     267,   268,   269,   455,   271,   457,   268,    14,   460,   263,
+     273,   263,   263,   280,   101,   263,   103,   263,   173,    26,
+     472,   266,   267,   268,   269,   263,   271,   282,    35,   263,
+     263,   118,   119,   120,   263,   280,   277,   263,   266,   267,
+     268,   269,   129,   271,   276,   282,   133,   282,   276,   272,
+     272,   272,    59,   266,   267,   268,   269,   174,   271,   277,
+     276,   276,   273,   276,   516,   517,   266,   267,   268,   269,
+     273,   271,   282,    80,    81,   276,   276,   266,   267,   268,
+     269,   278,   271,   266,   267,   268,   269,   276,   271,   176,
+     276,   263,   263,   276,   278,   117,   276,   276,   276,   186,
+     187,   108,   276,   190,   266,   267,   268,   269,   276,   271,
+     263,   272,   278,    52,   276,   202,   328,   204,   396,   396,
+     207,   266,   267,   268,   269,  1137,   271,   621,   273,   216,
+     137,   146,   290,   220,   221,   221,   266,   267,   268,   269,
+     227,   271,   226,   273,   266,   267,   268,   269,   800,   271,
+     934,   273,   265,   266,   267,   268,   269,   232,   271,   246,
+     167,   265,   266,   267,   268,   269,   544,   271,   806,   621,
+     127,   402,   628,  1005,   181,   182,   183,   481,   901,   266,
+     267,   769,   189,  1115,   349,  1209,   886,   194,     3,   877,
+    1121,     6,   279,   243,     9,   282,   283,   545,   265,   266,
+     267,   268,   269,    18,   271,    20,    21,   270,   733,    24,
+    1025,  1086,   588,    28,   845,  1106,   668,   669,   670,   671,
+    1040,   850,    -1,   230,   676,    40,   450,   679,   680,   266,
+     267,   268,   269,  1036,   271,    -1,   266,   267,   268,   269,
+     247,   271,    -1,   250,    -1,    -1,   253,   699,   700,   701,
+     702,   703,    -1,    -1,    69,    70,    71,    -1,    73,    -1,
+     266,   267,   268,   269,    -1,   271,    -1,    82,    -1,    -1,
+      -1,   278,    87,    -1,    -1,    -1,   728,    -1,   266,   267,
+     268,   269,    97,   271,    99,   100,    -1,    -1,   103,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   111,    -1,    -1,    -1,
+     752,    -1,    -1,   118,   119,   120,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   129,    -1,    -1,    -1,   133,    -1,
+     772,   773,    -1,     3,    -1,    -1,     6,    -1,   780,    -1,
+     782,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    18,    -1,
+      20,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      40,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   186,   187,    -1,    -1,   190,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   200,    -1,   202,    -1,   204,
+      -1,    -1,   207,    73,    -1,    -1,    76,    -1,    -1,    -1,
+      -1,   216,    82,    -1,    -1,   220,    -1,    -1,    -1,    -1,
+      -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   236,    -1,   103,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   246,    -1,     3,    -1,    -1,     6,    -1,   118,   119,
+     120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    18,   129,
+      20,   266,   267,   133,    -1,    -1,   908,   909,    28,    -1,
+      -1,    -1,    -1,    -1,   279,    -1,    -1,    -1,    -1,   149,
+      40,    -1,   924,    -1,    -1,    -1,    -1,    -1,    -1,   159,
+     160,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   176,    -1,    -1,    -1,
+      -1,    -1,    -1,    73,    -1,    -1,   186,   187,    -1,    -1,
+     190,    -1,    82,    -1,    84,    -1,   968,    -1,    -1,    -1,
+      -1,    -1,   202,    -1,   204,    -1,    -1,   207,    -1,    -1,
+     982,   101,    -1,   103,   986,    -1,   216,    -1,    -1,    -1,
+     220,    -1,    -1,    -1,    -1,    -1,    -1,   227,   118,   119,
+     120,    -1,    -1,    -1,    -1,    -1,    -1,  1009,    -1,   129,
+      -1,    -1,   242,   133,    -1,    -1,   246,    -1,  1020,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   262,    -1,    -1,    -1,   266,   267,    -1,    -1,
+      -1,    -1,    -1,  1045,    -1,    -1,    -1,    -1,    -1,   279,
+    1052,    -1,    -1,    -1,    -1,    -1,   176,    -1,    -1,    -1,
+       3,    -1,    -1,     6,    -1,    -1,   186,   187,    -1,    -1,
+     190,    -1,    -1,    -1,    -1,    18,    -1,    20,    -1,    -1,
+      -1,    -1,   202,    -1,   204,    28,    -1,   207,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   216,    40,    -1,    -1,
+     220,   221,    -1,    -1,    -1,    -1,    -1,   227,     3,    -1,
+      -1,     6,  1114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1124,    18,    -1,    20,   246,    -1,    -1,    -1,
+      73,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    82,
+      -1,    84,    -1,    -1,    -1,    40,   266,   267,    -1,    -1,
+      -1,    -1,   272,    -1,    -1,    -1,  1158,    -1,   101,   279,
+     103,    -1,    -1,    -1,  1166,  1167,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   118,   119,   120,    73,    -1,
+      -1,    -1,    -1,  1185,  1186,  1187,   129,    82,    -1,    -1,
+     133,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,  1207,    -1,  1209,   103,   104,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   683,   684,   685,   686,   687,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    81,    -1,    -1,    -1,    -1,    86,    -1,
-      -1,    -1,   712,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   102,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   110,    -1,    -1,    -1,   736,   115,   116,   117,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,    -1,
-      -1,    -1,   130,    -1,    -1,    -1,   756,   757,    -1,    -1,
-      -1,    -1,    -1,   763,    -1,   765,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   118,   119,   120,    -1,    -1,  1230,    -1,
+      -1,    -1,    -1,   176,   129,    -1,    -1,    -1,   133,    -1,
+      -1,  1243,    -1,   186,   187,    -1,    -1,   190,    -1,    -1,
+       3,    -1,    -1,     6,    -1,    -1,    -1,    -1,  1260,   202,
+      -1,   204,    -1,    -1,   207,    18,    -1,    20,    -1,    -1,
+    1272,    -1,  1274,   216,  1276,    28,  1278,   220,   221,    -1,
+      -1,   176,    -1,    -1,   227,     3,    -1,    40,     6,    -1,
+      -1,   186,   187,    -1,    -1,   190,    -1,    -1,    -1,    -1,
+      18,    -1,    20,   246,    -1,    -1,    -1,   202,    -1,   204,
+      28,    -1,   207,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      73,   216,    40,   266,   267,   220,    -1,    -1,    -1,    82,
+      -1,    -1,   227,    -1,    -1,    -1,   279,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     103,   246,    -1,    -1,    -1,    73,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    82,   118,   119,   120,    -1,    -1,
+      -1,   266,   267,    -1,    -1,    -1,   129,    -1,    -1,    -1,
+     133,    -1,    -1,    -1,   279,   103,    -1,    -1,    -1,    -1,
+      -1,     3,    -1,    -1,     6,    -1,    -1,    -1,    -1,    -1,
+     118,   119,   120,    -1,    -1,    -1,    18,    -1,    20,    -1,
+      -1,   129,    -1,    -1,    -1,   133,    28,    -1,    -1,    -1,
+      -1,    -1,    -1,   176,    -1,    -1,    -1,    -1,    40,    -1,
+      -1,    -1,    -1,   186,   187,    -1,    -1,   190,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   202,
+      -1,   204,    -1,    -1,   207,    -1,    -1,    -1,   176,    -1,
+      -1,    73,    -1,   216,    -1,    -1,    -1,   220,   186,   187,
+      82,    -1,   190,    -1,   227,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   202,    -1,   204,    -1,    -1,   207,
+      -1,   103,    -1,   246,    -1,    -1,    -1,    -1,   216,    -1,
+      -1,    -1,   220,    -1,    -1,    -1,   118,   119,   120,   227,
+      -1,    -1,    -1,   266,   267,    -1,    -1,   129,    -1,   272,
+      -1,   133,    -1,    -1,    -1,   243,   279,    -1,   246,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,    -1,    -1,     6,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   266,   267,
+      18,    -1,    20,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      28,   279,    -1,    -1,   176,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    40,    -1,   186,   187,    -1,    -1,   190,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     202,    -1,   204,    -1,    -1,   207,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   216,    73,    -1,    -1,   220,    -1,
+      -1,    -1,    -1,    -1,    82,   227,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   182,   183,    -1,    -1,   186,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   196,    -1,
-     198,    -1,   200,    -1,    -1,   203,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   212,    -1,    -1,    -1,   216,    -1,
-      -1,    -1,    -1,     3,    -1,   223,     6,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   232,    -1,    -1,    -1,    18,    -1,
-      20,    -1,    -1,    -1,   242,    -1,    -1,    -1,    28,    -1,
+      -1,    -1,    -1,    -1,   246,   103,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      40,    -1,    -1,    -1,   262,   263,    -1,   887,   888,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   275,    -1,    -1,
-      -1,   901,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    -1,    -1,    75,    -1,    -1,    -1,    -1,
-      -1,    81,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,   119,   120,    -1,   266,   267,    -1,    -1,    -1,    -1,
+     272,   129,    -1,    -1,    -1,   133,    -1,   279,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   102,    -1,    -1,   945,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   115,   116,   117,    -1,   959,
-      -1,    -1,    -1,   963,    -1,    -1,   126,    -1,    -1,    -1,
-     130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   982,    -1,    -1,   145,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   993,    -1,   155,   156,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   172,    -1,    -1,    -1,    -1,    -1,  1018,    -1,
-      -1,    -1,   182,   183,    -1,  1025,   186,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,     3,    -1,   198,     6,
-     200,    -1,    -1,   203,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    18,   212,    20,    -1,    -1,   216,    -1,    -1,    -1,
-      -1,    28,    -1,   223,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    40,     3,    -1,    -1,     6,   238,    -1,
-      -1,    -1,   242,    -1,    -1,  1085,    -1,    -1,    -1,    18,
-      -1,    20,    -1,    -1,    -1,  1095,    -1,    -1,   258,    28,
-      -1,    -1,   262,   263,    -1,    72,    -1,    -1,    -1,    -1,
-      -1,    40,    -1,    -1,    81,   275,    83,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1128,    -1,
-      -1,    -1,    -1,   100,    -1,   102,  1136,  1137,    -1,    -1,
-      -1,    -1,    -1,    72,    -1,    -1,    -1,    -1,   115,   116,
-     117,    -1,    81,    -1,    83,  1155,  1156,    -1,    -1,   126,
-      -1,    -1,    -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   100,    -1,   102,    -1,    -1,  1176,    -1,  1178,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,    -1,
-      -1,    -1,     3,    -1,    -1,     6,    -1,   126,    -1,    -1,
-      -1,   130,    -1,    -1,    -1,   172,    -1,    18,    -1,    20,
-    1210,    -1,    -1,    -1,    -1,   182,   183,    28,    -1,   186,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    40,
-      -1,   198,    -1,   200,    -1,    -1,   203,    -1,    -1,    -1,
-      -1,    -1,    -1,   172,    -1,   212,    -1,    -1,    -1,   216,
-     217,    -1,    -1,   182,   183,    -1,   223,   186,    -1,    -1,
-      -1,    72,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   198,
-      81,   200,    -1,    -1,   203,   242,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   212,    -1,    -1,    -1,   216,   217,    -1,
-      -1,   102,   103,    -1,   223,   262,   263,    -1,    -1,    -1,
-      -1,   268,    -1,    -1,   115,   116,   117,     3,   275,    -1,
-       6,    -1,    -1,   242,    -1,   126,    -1,    -1,    -1,   130,
-      -1,    -1,    18,    -1,    20,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    28,   262,   263,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    40,     3,   275,    -1,     6,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      18,   172,    20,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      28,   182,   183,    -1,    -1,   186,    72,    -1,    -1,    -1,
-      -1,    -1,    40,    -1,    -1,    81,    -1,   198,    -1,   200,
-      -1,    -1,   203,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   212,    -1,    -1,    -1,   216,   102,    -1,    -1,    -1,
-      -1,    -1,   223,    -1,    72,    -1,    -1,    -1,    -1,   115,
-     116,   117,    -1,    81,    -1,    -1,    -1,    -1,    -1,    -1,
-     126,   242,    -1,    -1,   130,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   102,    -1,    -1,    -1,    -1,    -1,
-      -1,   262,   263,    -1,    -1,    -1,    -1,   115,   116,   117,
-      -1,    -1,    -1,     3,   275,    -1,     6,    -1,   126,    -1,
-      -1,    -1,   130,    -1,    -1,    -1,   172,    -1,    18,    -1,
-      20,    -1,    -1,    -1,    -1,    -1,   182,   183,    28,    -1,
-     186,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      40,    -1,   198,    -1,   200,    -1,    -1,   203,    -1,    -1,
-      -1,    -1,    -1,    -1,   172,    -1,   212,    -1,    -1,    -1,
-     216,    -1,    -1,    -1,   182,   183,    -1,   223,   186,    -1,
-      -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     198,    81,   200,    -1,    -1,   203,   242,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   212,    -1,    -1,    -1,   216,    -1,
-      -1,    -1,   102,    -1,    -1,   223,   262,   263,    -1,    -1,
-      -1,    -1,   268,    -1,    -1,   115,   116,   117,    -1,   275,
-      -1,   239,    -1,    -1,   242,    -1,   126,    -1,    -1,    -1,
-     130,    -1,    -1,     3,    -1,    -1,     6,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   262,   263,    -1,    -1,    18,    -1,
-      20,    -1,    -1,    -1,    -1,    -1,    -1,   275,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   176,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   186,   187,
+      -1,    -1,   190,    -1,    -1,    -1,    -1,    -1,     5,    -1,
+      -1,    -1,    -1,    -1,   202,    -1,   204,    -1,    -1,   207,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   216,    -1,
+      -1,    -1,   220,    30,    31,    32,    33,    34,    -1,   227,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      47,    48,    49,    50,    51,    52,    53,    -1,   246,    -1,
+      -1,    -1,    -1,    60,    61,    62,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   266,   267,
+      77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,    86,
+      -1,   279,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    98,    -1,    -1,    -1,   102,    -1,    -1,   105,    -1,
+      -1,    -1,   109,   110,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   124,   125,   126,
+     127,   128,    -1,    -1,    -1,    -1,    -1,    -1,   135,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      40,    -1,   172,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   182,   183,    -1,    -1,   186,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   198,    -1,
-     200,    -1,    72,   203,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    81,   212,    -1,    -1,    -1,   216,    -1,    -1,    -1,
-      -1,    -1,    -1,   223,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   102,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   242,    -1,    -1,   115,   116,   117,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   126,    -1,    -1,    -1,
-     130,    -1,   262,   263,     5,    -1,    -1,    -1,   268,    -1,
-      -1,    -1,    -1,    -1,    -1,   275,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    30,
-      31,    32,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   172,    -1,    -1,    46,    47,    48,    49,    50,
-      51,    52,   182,   183,    -1,    -1,   186,    -1,    59,    60,
-      61,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   198,    -1,
-     200,    -1,    -1,   203,    -1,    76,    -1,    -1,    -1,    -1,
-      -1,    -1,   212,    84,    85,    -1,   216,    -1,    -1,    -1,
-      -1,    -1,    -1,   223,    -1,    -1,    97,    -1,    -1,    -1,
-     101,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,    -1,
-      -1,    -1,   242,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     121,   122,   123,   124,   125,    -1,    -1,    -1,    -1,    -1,
-      -1,   132,   262,   263,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   275,    -1,    -1,    -1,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   154,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   164,   165,   166,   167,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,   180,
-     181,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   168,   169,   170,   171,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   179,   180,    -1,    -1,    -1,   184,   185,    -1,
+      -1,   188,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   206,    -1,    -1,    -1,    -1,
-     211,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   229,   230,
+      -1,    -1,    -1,   210,    -1,    -1,    -1,    -1,   215,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     241,   242,    -1,    -1,   245,    -1,    -1,   248,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   256
+      -1,    -1,    -1,    -1,    -1,    -1,   233,   234,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   245,   246,
+      -1,    -1,   249,    -1,    -1,   252,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   260
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
        0,     5,    30,    31,    32,    33,    34,    46,    47,    48,
-      49,    50,    51,    52,    59,    60,    61,    76,    84,    85,
-      97,   101,   104,   108,   109,   121,   122,   123,   124,   125,
-     132,   150,   164,   165,   166,   167,   175,   176,   180,   181,
-     184,   206,   211,   229,   230,   241,   242,   245,   248,   256,
-     281,   282,   283,   285,   299,   300,   301,   315,   316,   317,
-     319,   324,   325,   326,   327,   328,   329,   334,   338,   341,
-     342,   343,   344,   345,   346,   347,   360,   361,   362,   377,
-     400,   405,   407,   408,   409,   415,   420,   421,   425,   439,
-     440,   470,   475,   478,   486,   496,   500,   535,   560,   259,
-     259,   259,   259,   259,   259,   285,   349,   350,   273,   273,
-     285,   401,   285,   351,   364,   273,   273,   259,   259,   259,
-     275,   275,   275,   259,   406,   259,   259,   259,   259,   259,
-     259,   259,   259,   273,   273,   273,   410,   275,   275,   259,
-     259,   273,   259,   275,   259,   259,   259,   273,   273,   273,
-       0,   283,   259,    82,   259,    25,    43,    64,   154,   187,
-     194,   208,   210,   253,   427,   173,    75,   145,   155,   156,
-     238,   258,   291,   291,    83,   100,   217,   284,   285,   286,
-     312,   313,   314,     3,     6,    18,    20,    28,    40,    72,
-      81,   102,   115,   116,   117,   126,   130,   172,   182,   183,
-     186,   198,   200,   203,   212,   216,   223,   262,   263,   275,
-     285,   306,   307,   308,   310,   311,   286,   306,   340,   273,
-     348,   349,   285,   357,   359,   378,   379,   388,   389,   390,
-     273,   273,   363,   364,   285,   287,   487,   488,   312,   313,
-     141,   142,   306,   285,   320,   320,   320,   312,   285,   409,
-     415,   306,   306,   291,   306,   306,   306,   306,   222,   251,
-     291,   287,   288,   497,   498,    14,    26,    35,    58,    79,
-      80,   107,   134,   163,   177,   178,   179,   185,   190,   226,
-     243,   246,   249,   330,   331,    39,   312,   321,   321,   103,
-     306,   306,   158,   502,   306,   285,   301,   306,   306,   306,
-     536,    78,   561,    16,    37,    53,    93,    94,   111,   112,
-     127,   128,   129,   139,   143,   144,   159,   160,   161,   162,
-     240,   335,   336,   268,   285,   302,   304,   306,   308,   309,
-     311,   313,   275,   285,   303,   304,   305,   410,   410,   410,
-     410,   410,   410,   275,   260,   275,   275,   275,   275,   275,
-     275,   275,   275,   275,   275,   275,   275,   275,   275,   275,
-     275,   275,   275,   306,   306,   306,    71,   146,   262,   263,
-     264,   265,   267,   339,   261,   339,    56,    57,   352,   274,
-     349,   270,   271,   272,   273,   292,   293,   294,   295,   296,
-     274,   379,   262,   279,   391,   403,   365,   274,   364,   489,
-     274,   488,   276,   272,   272,   268,   273,   274,   498,   259,
-     259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
-     259,   259,   259,   259,   259,   259,   259,   274,   331,   259,
-     322,   276,   259,   501,   272,   131,   538,   539,   259,   138,
-     562,   563,   259,   259,   259,   259,   259,   259,   259,   259,
-     259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
-     274,   336,   268,   297,   298,   306,   286,    39,   285,   408,
-     409,   416,   417,   418,   422,   244,   442,   426,   442,   321,
-     312,   306,   306,   306,   306,   306,   306,   306,   306,   306,
-     306,   306,   306,   306,   306,   306,   306,   312,   306,   276,
-     306,   306,   306,   306,   306,   306,   259,   259,    44,    45,
-     353,   306,   294,   295,   390,   285,   366,   392,   263,   278,
-     380,   381,   382,   383,   384,   385,   386,    54,   152,   191,
-     233,   234,   274,   367,   268,   321,   321,   285,   499,   291,
-     332,   332,   332,    27,   291,   333,   332,   332,   306,   332,
-     332,   332,   332,   306,   332,   333,   332,   332,   332,   333,
-     333,   289,   303,   272,   276,   306,   105,   215,   227,   503,
-     504,   505,   506,   321,   259,    77,   138,   537,   540,   541,
-     542,   543,   312,   259,   114,   563,   566,    66,    95,   255,
-     337,   337,   337,   306,   337,   306,   337,   337,   306,   337,
-     337,   337,   337,   337,   337,   337,   337,   337,   306,   269,
-     272,   272,   259,   154,   412,   417,   201,   423,   273,   225,
-     472,    38,    55,    89,    91,   114,   133,   137,   153,   192,
-     193,   204,   205,   214,   250,   428,   430,   431,   432,   433,
-     434,   435,   436,    62,   445,   322,   276,   276,   276,   276,
-     276,   276,   276,   276,   276,   276,   272,   272,   272,   272,
-     276,   276,   276,   276,   261,   306,   306,   259,   259,   224,
-     354,   274,   292,   380,   263,   277,   359,   277,   359,   148,
-     359,   393,   394,   259,   259,   259,   259,   259,     4,    36,
-     135,   136,   189,   236,   274,   368,   369,   370,   372,   373,
-     285,   492,   322,   276,   269,   493,   272,   302,   309,   313,
-     323,   259,   259,   259,    92,   202,   273,   507,   508,   509,
-     512,   513,   322,    17,    29,   147,   259,   273,   274,   540,
-     285,   564,   565,   259,   254,   567,   231,   298,   312,   318,
-     289,   287,   197,   199,   235,   274,   411,   413,   414,   259,
-     428,   289,   443,   444,   273,   471,   259,   259,   273,   259,
-     259,   259,   273,   259,   259,   259,   259,   273,   412,   430,
-     259,   273,   441,   276,   306,   306,   306,   306,   306,   306,
-     306,   118,   355,   380,   381,   381,   262,   268,   395,   396,
-     397,   306,   239,   306,   404,   306,   306,   306,   359,   273,
-     273,   231,   259,   371,   269,   276,   221,   274,   373,   494,
-     495,   289,   303,   306,   303,   259,   259,   510,   274,   508,
-     276,   312,   106,   140,   228,   544,   545,   546,   552,   556,
-     262,   289,   259,   252,   568,   306,   276,   272,   410,   259,
-     259,   259,    42,    63,   113,   188,   207,   209,   275,   287,
-     288,   424,   412,   274,   443,   303,   473,   474,   412,   306,
-     306,   120,   312,   289,   359,   359,   437,   438,   306,   285,
-     402,   306,   289,   119,   411,   285,   304,   309,   429,   303,
-     446,   447,   448,   276,   276,   276,   276,   261,   259,    74,
-     356,   394,   277,   278,   302,   309,   313,   398,   399,   261,
-     387,   259,   285,   358,   374,   376,   375,   376,    13,   359,
-     490,   259,   171,   484,   147,   291,   312,   511,   291,    41,
-      73,   220,   237,   263,   275,   307,   514,   515,   516,   517,
-     273,   273,   273,   274,   545,   564,   285,   289,   290,   309,
-     259,   105,   215,   227,   569,   215,   289,   419,   289,   290,
-     289,   424,   262,   263,   264,   411,   274,   473,   411,   259,
-     289,   274,   438,   259,   274,   447,    52,   195,   412,   449,
-     450,   465,   306,   306,   274,   399,   399,   269,   272,   285,
-     306,   292,   259,   274,   376,   274,   376,   292,   273,   366,
-     259,   476,   518,   268,   275,   519,   516,   516,   272,   274,
-     261,   262,   263,   264,   265,   534,     8,   157,   174,   557,
-     558,   559,   548,   553,   554,   559,   290,   259,   259,   259,
-     274,   306,    19,   485,   412,   272,   276,   424,   424,   424,
-     306,   306,   273,   273,   274,   398,   306,    68,    69,    70,
-      96,    98,    99,   454,   455,   456,   457,   461,   462,   463,
-     464,   291,   168,   481,   268,   306,   516,   268,   276,   515,
-     259,   262,   277,   520,   312,   516,   516,   516,   516,   274,
-     558,   279,    13,   274,   284,   285,   549,   550,   274,   554,
-     279,   303,   306,   303,   269,   259,   479,   411,   306,   213,
-     274,   213,   466,   467,   492,   451,   269,   259,   259,   455,
-     491,   259,   259,   259,   169,   482,   284,   285,   522,   523,
-     524,   525,   526,   527,   528,   529,   530,   269,   276,   524,
-     277,   277,   277,   286,   521,    12,   303,   555,   259,   547,
-     547,    15,   303,   551,   306,   448,   259,   259,   274,   467,
-     273,     9,    21,    24,    86,   110,   196,   232,   306,   452,
-     453,   454,   458,   459,   460,   268,   268,   493,   285,   289,
-     291,   259,   170,   483,   272,   296,   272,   272,   269,   269,
-     277,   306,   480,   306,   306,   468,   231,   274,   272,   459,
-     459,   274,   272,   291,   259,   477,   257,   287,   288,   531,
-     531,   531,   412,   274,    38,   454,   306,   460,   269,   269,
-     289,   291,   411,   272,   532,   272,   532,   272,   532,   411,
-     259,   469,     7,    10,    11,    22,    23,    67,    87,    88,
-     289,   533,   289,   289,   306,   493,   272,   532,   532,   532,
-     274,   274
+      49,    50,    51,    52,    53,    60,    61,    62,    77,    85,
+      86,    98,   102,   105,   109,   110,   124,   125,   126,   127,
+     128,   135,   154,   168,   169,   170,   171,   179,   180,   184,
+     185,   188,   210,   215,   233,   234,   245,   246,   249,   252,
+     260,   286,   287,   288,   290,   304,   305,   306,   320,   321,
+     322,   324,   329,   330,   331,   332,   333,   334,   339,   343,
+     346,   347,   348,   349,   350,   351,   352,   365,   377,   378,
+     379,   394,   417,   422,   424,   425,   426,   432,   437,   438,
+     442,   456,   457,   487,   492,   495,   503,   513,   517,   552,
+     577,   263,   263,   263,   263,   263,   263,   290,   354,   355,
+     277,   277,   277,   290,   418,   290,   356,   381,   277,   277,
+     263,   263,   263,   279,   279,   279,   263,   423,   263,   263,
+     263,   263,   263,   263,   263,   263,   277,   277,   277,   427,
+     279,   279,   263,   263,   277,   263,   279,   263,   263,   263,
+     277,   277,   277,     0,   288,   263,    83,   263,    25,    43,
+      65,   158,   191,   198,   212,   214,   257,   444,   177,    76,
+     149,   159,   160,   242,   262,   296,   296,    84,   101,   221,
+     289,   290,   291,   317,   318,   319,     3,     6,    18,    20,
+      28,    40,    73,    82,   103,   118,   119,   120,   129,   133,
+     176,   186,   187,   190,   202,   204,   207,   216,   220,   227,
+     266,   267,   279,   290,   311,   312,   313,   315,   316,   291,
+     311,   345,   277,   353,   354,   290,   366,   367,   369,   290,
+     362,   364,   395,   396,   405,   406,   407,   277,   277,   380,
+     381,   290,   292,   504,   505,   317,   318,   145,   146,   311,
+     290,   325,   325,   325,   317,   290,   426,   432,   311,   311,
+     296,   311,   311,   311,   311,   226,   255,   296,   292,   293,
+     514,   515,    14,    26,    35,    59,    80,    81,   108,   137,
+     167,   181,   182,   183,   189,   194,   230,   247,   250,   253,
+     335,   336,    39,   317,   326,   326,   104,   311,   311,   162,
+     519,   311,   290,   306,   311,   311,   311,   553,    79,   578,
+      16,    37,    54,    94,    95,   112,   113,   130,   131,   132,
+     143,   147,   148,   163,   164,   165,   166,   244,   340,   341,
+     272,   290,   307,   309,   311,   313,   314,   316,   318,   279,
+     290,   308,   309,   310,   427,   427,   427,   427,   427,   427,
+     279,   264,   279,   279,   279,   279,   279,   279,   279,   279,
+     279,   279,   279,   279,   279,   279,   279,   279,   279,   279,
+     311,   311,   311,    72,   150,   266,   267,   268,   269,   271,
+     344,   265,   344,    57,    58,   357,   278,   354,   278,   367,
+     368,   274,   275,   276,   277,   297,   298,   299,   300,   301,
+     278,   396,   266,   284,   408,   420,   382,   278,   381,   506,
+     278,   505,   280,   276,   276,   272,   277,   278,   515,   263,
+     263,   263,   263,   263,   263,   263,   263,   263,   263,   263,
+     263,   263,   263,   263,   263,   263,   263,   278,   336,   263,
+     327,   280,   263,   518,   276,   134,   555,   556,   263,   142,
+     579,   580,   263,   263,   263,   263,   263,   263,   263,   263,
+     263,   263,   263,   263,   263,   263,   263,   263,   263,   263,
+     278,   341,   272,   302,   303,   311,   291,    39,   290,   425,
+     426,   433,   434,   435,   439,   248,   459,   443,   459,   326,
+     317,   311,   311,   311,   311,   311,   311,   311,   311,   311,
+     311,   311,   311,   311,   311,   311,   311,   317,   311,   280,
+     311,   311,   311,   311,   311,   311,   263,   263,    44,    45,
+     358,   279,   311,   299,   300,   407,   290,   383,   409,   267,
+     283,   397,   398,   399,   400,   401,   402,   403,    55,   156,
+     195,   237,   238,   278,   384,   272,   326,   326,   290,   516,
+     296,   337,   337,   337,    27,   296,   338,   337,   337,   311,
+     337,   337,   337,   337,   311,   337,   338,   337,   337,   337,
+     338,   338,   294,   308,   276,   280,   311,   106,   219,   231,
+     520,   521,   522,   523,   326,   263,    78,   142,   554,   557,
+     558,   559,   560,   317,   263,   115,   580,   583,    67,    96,
+     259,   342,   342,   342,   311,   342,   311,   342,   342,   311,
+     342,   342,   342,   342,   342,   342,   342,   342,   342,   311,
+     273,   276,   276,   263,   158,   429,   434,   205,   440,   277,
+     229,   489,    38,    56,    90,    92,   115,   136,   140,   141,
+     157,   196,   197,   208,   209,   218,   254,   445,   447,   448,
+     449,   450,   451,   452,   453,    63,   462,   327,   280,   280,
+     280,   280,   280,   280,   280,   280,   280,   280,   276,   276,
+     276,   276,   280,   280,   280,   280,   265,   311,   311,   263,
+     263,   228,   359,   290,   370,   371,   373,   278,   297,   397,
+     267,   282,   364,   282,   364,   152,   364,   410,   411,   263,
+     263,   263,   263,   263,     4,    36,   138,   139,   193,   240,
+     278,   385,   386,   387,   389,   390,   290,   509,   327,   280,
+     273,   510,   276,   307,   314,   318,   328,   263,   263,   263,
+      93,   206,   277,   524,   525,   526,   529,   530,   327,    17,
+      29,   151,   263,   277,   278,   557,   290,   581,   582,   263,
+     258,   584,   235,   303,   317,   323,   294,   292,   201,   203,
+     239,   278,   428,   430,   431,   263,   445,   294,   460,   461,
+     277,   488,   263,   263,   277,   263,   263,   263,   277,   263,
+     263,   263,   263,   263,   277,   429,   447,   263,   277,   458,
+     280,   311,   311,   311,   311,   311,   311,   311,   121,   360,
+     276,   280,   372,   397,   398,   398,   266,   272,   412,   413,
+     414,   311,   243,   311,   421,   311,   311,   311,   364,   277,
+     277,   235,   263,   388,   273,   280,   225,   278,   390,   511,
+     512,   294,   308,   311,   308,   263,   263,   527,   278,   525,
+     280,   317,   107,   144,   232,   561,   562,   563,   569,   573,
+     266,   294,   263,   256,   585,   311,   280,   276,   427,   263,
+     263,   263,    42,    64,   114,   192,   211,   213,   279,   292,
+     293,   441,   429,   278,   460,   308,   490,   491,   429,   311,
+     311,   123,   317,   294,   364,   364,   454,   455,   291,   311,
+     290,   419,   311,   294,   122,   428,   290,   309,   314,   446,
+     308,   463,   464,   465,   280,   280,   280,   280,   265,   263,
+      75,   361,   371,   374,   411,   282,   283,   307,   314,   318,
+     415,   416,   265,   404,   263,   290,   363,   391,   393,   392,
+     393,    13,   364,   507,   263,   175,   501,   151,   296,   317,
+     528,   296,    41,    74,   224,   241,   267,   279,   312,   531,
+     532,   533,   534,   277,   277,   277,   278,   562,   581,   290,
+     294,   295,   314,   263,   106,   219,   231,   586,   219,   294,
+     436,   294,   295,   294,   441,   266,   267,   268,   428,   278,
+     490,   428,   263,   294,   278,   455,   263,   278,   464,    53,
+     199,   429,   466,   467,   482,   311,   311,   278,   277,   281,
+     375,   376,   416,   416,   273,   276,   290,   311,   297,   263,
+     278,   393,   278,   393,   297,   277,   383,   263,   493,   535,
+     272,   279,   536,   533,   533,   276,   278,   265,   266,   267,
+     268,   269,   551,     8,   161,   178,   574,   575,   576,   565,
+     570,   571,   576,   295,   263,   263,   263,   278,   311,    19,
+     502,   429,   276,   280,   441,   441,   441,   311,   311,   277,
+     277,   278,   116,   290,   415,   311,    69,    70,    71,    97,
+      99,   100,   471,   472,   473,   474,   478,   479,   480,   481,
+     296,   172,   498,   272,   311,   533,   272,   280,   532,   263,
+     266,   282,   537,   317,   533,   533,   533,   533,   278,   575,
+     284,    13,   278,   289,   290,   566,   567,   278,   571,   284,
+     308,   311,   308,   273,   263,   496,   428,   311,   217,   278,
+     217,   483,   484,   509,   468,   263,   273,   263,   263,   472,
+     508,   263,   263,   263,   173,   499,   289,   290,   539,   540,
+     541,   542,   543,   544,   545,   546,   547,   273,   280,   541,
+     282,   282,   282,   291,   538,    12,   308,   572,   263,   564,
+     564,    15,   308,   568,   311,   465,   263,   263,   278,   484,
+     277,     9,    21,    24,    87,   111,   200,   236,   311,   469,
+     470,   471,   475,   476,   477,   272,   272,   272,   510,   290,
+     294,   296,   263,   174,   500,   276,   301,   276,   276,   273,
+     273,   282,   311,   497,   311,   311,   485,   235,   278,   276,
+     311,   476,   476,   278,   276,   296,   263,   494,   261,   292,
+     293,   548,   548,   548,   429,   278,    38,   471,   311,   477,
+     276,   273,   273,   294,   296,   428,   276,   549,   276,   549,
+     276,   549,   428,   263,   486,   311,     7,    10,    11,    22,
+      23,    68,    88,    89,   294,   550,   294,   294,   311,   510,
+     276,   276,   549,   549,   549,   278,   278,   311,   273,   276,
+     117,   263,   272,   311,   276,   311,   276,   311,   276,   311,
+     273,   278
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
 {
-       0,   280,   281,   282,   282,   283,   283,   283,   283,   283,
-     283,   283,   283,   283,   283,   283,   283,   283,   283,   283,
-     283,   283,   283,   283,   283,   283,   284,   285,   286,   287,
-     288,   289,   290,   290,   291,   291,   291,   291,   291,   291,
-     292,   292,   292,   292,   293,   293,   293,   293,   294,   295,
-     296,   297,   297,   298,   298,   299,   300,   300,   300,   300,
-     301,   302,   303,   303,   304,   305,   306,   306,   307,   307,
-     308,   308,   309,   309,   310,   311,   311,   311,   311,   311,
-     311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
-     311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
-     311,   311,   311,   311,   311,   312,   312,   313,   313,   313,
-     313,   314,   315,   315,   315,   315,   315,   315,   315,   316,
-     317,   318,   319,   320,   321,   322,   322,   323,   323,   323,
-     324,   325,   326,   327,   328,   329,   330,   330,   331,   331,
-     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
-     331,   331,   331,   331,   331,   331,   331,   332,   333,   333,
-     334,   335,   335,   336,   336,   336,   336,   336,   336,   336,
+       0,   285,   286,   287,   287,   288,   288,   288,   288,   288,
+     288,   288,   288,   288,   288,   288,   288,   288,   288,   288,
+     288,   288,   288,   288,   288,   288,   288,   289,   290,   291,
+     292,   293,   294,   295,   295,   296,   296,   296,   296,   296,
+     296,   297,   297,   297,   297,   298,   298,   298,   298,   299,
+     300,   301,   302,   302,   303,   303,   304,   305,   305,   305,
+     305,   306,   307,   308,   308,   309,   310,   311,   311,   312,
+     312,   313,   313,   314,   314,   315,   316,   316,   316,   316,
+     316,   316,   316,   316,   316,   316,   316,   316,   316,   316,
+     316,   316,   316,   316,   316,   316,   316,   316,   316,   316,
+     316,   316,   316,   316,   316,   316,   317,   317,   318,   318,
+     318,   318,   319,   320,   320,   320,   320,   320,   320,   320,
+     321,   322,   323,   324,   325,   326,   327,   327,   328,   328,
+     328,   329,   330,   331,   332,   333,   334,   335,   335,   336,
      336,   336,   336,   336,   336,   336,   336,   336,   336,   336,
-     336,   337,   337,   337,   338,   338,   338,   338,   338,   339,
-     339,   339,   340,   340,   340,   340,   341,   341,   341,   341,
+     336,   336,   336,   336,   336,   336,   336,   336,   337,   338,
+     338,   339,   340,   340,   341,   341,   341,   341,   341,   341,
      341,   341,   341,   341,   341,   341,   341,   341,   341,   341,
-     341,   341,   341,   341,   342,   342,   342,   342,   343,   344,
-     344,   344,   345,   345,   346,   347,   348,   348,   349,   350,
-     351,   352,   352,   353,   353,   353,   354,   354,   355,   355,
-     356,   356,   357,   358,   359,   360,   360,   361,   362,   363,
-     363,   365,   364,   366,   367,   367,   368,   368,   369,   369,
-     369,   370,   370,   370,   371,   371,   372,   373,   373,   374,
-     374,   375,   375,   376,   377,   378,   378,   379,   380,   380,
-     381,   382,   383,   384,   385,   386,   386,   386,   386,   387,
-     387,   388,   389,   389,   390,   391,   391,   392,   393,   393,
-     394,   394,   395,   395,   396,   397,   398,   398,   398,   399,
-     399,   399,   400,   401,   402,   403,   403,   403,   403,   403,
-     403,   404,   404,   406,   405,   407,   408,   408,   408,   408,
-     408,   409,   410,   411,   412,   412,   413,   414,   414,   414,
-     415,   416,   416,   417,   417,   419,   418,   420,   420,   422,
-     421,   423,   423,   423,   423,   423,   423,   423,   423,   424,
-     424,   424,   424,   424,   426,   425,   427,   427,   427,   427,
-     427,   428,   428,   429,   430,   430,   430,   430,   430,   430,
-     430,   430,   430,   430,   430,   431,   431,   432,   432,   432,
-     432,   433,   433,   434,   435,   436,   436,   437,   437,   438,
-     439,   441,   440,   442,   443,   444,   444,   445,   446,   446,
-     447,   448,   448,   449,   449,   451,   450,   452,   452,   453,
-     453,   453,   453,   453,   453,   453,   454,   454,   455,   455,
-     455,   455,   456,   457,   458,   459,   459,   460,   460,   460,
-     461,   462,   462,   463,   464,   464,   465,   466,   466,   468,
-     469,   467,   471,   470,   472,   473,   474,   474,   476,   477,
-     475,   479,   480,   478,   481,   481,   482,   482,   483,   483,
-     484,   484,   485,   485,   486,   487,   487,   489,   490,   491,
-     488,   492,   493,   493,   494,   494,   495,   496,   497,   497,
-     499,   498,   501,   500,   502,   502,   503,   503,   503,   504,
-     505,   506,   507,   507,   507,   508,   508,   508,   510,   509,
-     511,   511,   511,   512,   513,   514,   514,   515,   516,   516,
-     516,   516,   516,   516,   516,   516,   516,   518,   517,   517,
-     519,   517,   520,   520,   520,   520,   520,   521,   522,   523,
-     524,   524,   524,   524,   524,   524,   525,   526,   527,   528,
-     529,   530,   531,   531,   531,   532,   532,   533,   533,   533,
-     533,   533,   533,   533,   533,   534,   534,   536,   535,   537,
-     537,   538,   538,   539,   539,   539,   540,   540,   541,   542,
-     543,   544,   544,   545,   545,   545,   546,   547,   547,   548,
-     548,   549,   549,   550,   550,   551,   551,   552,   553,   553,
-     554,   555,   555,   556,   557,   557,   558,   559,   559,   559,
-     560,   561,   562,   562,   563,   564,   565,   565,   566,   567,
-     568,   569,   569,   569,   569
+     341,   341,   342,   342,   342,   343,   343,   343,   343,   343,
+     344,   344,   344,   345,   345,   345,   345,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   347,   347,   347,   347,   348,
+     349,   349,   349,   350,   350,   351,   352,   353,   353,   354,
+     355,   356,   357,   357,   358,   358,   358,   359,   359,   360,
+     360,   361,   361,   362,   363,   364,   365,   365,   366,   366,
+     368,   367,   369,   370,   370,   372,   371,   373,   374,   374,
+     375,   376,   376,   377,   377,   378,   379,   380,   380,   382,
+     381,   383,   384,   384,   385,   385,   386,   386,   386,   387,
+     387,   387,   388,   388,   389,   390,   390,   391,   391,   392,
+     392,   393,   394,   395,   395,   396,   397,   397,   398,   399,
+     400,   401,   402,   403,   403,   403,   403,   404,   404,   405,
+     406,   406,   407,   408,   408,   409,   410,   410,   411,   411,
+     412,   412,   413,   414,   415,   415,   415,   416,   416,   416,
+     417,   418,   419,   420,   420,   420,   420,   420,   420,   421,
+     421,   423,   422,   424,   425,   425,   425,   425,   425,   426,
+     427,   428,   429,   429,   430,   431,   431,   431,   432,   433,
+     433,   434,   434,   436,   435,   437,   437,   439,   438,   440,
+     440,   440,   440,   440,   440,   440,   440,   441,   441,   441,
+     441,   441,   443,   442,   444,   444,   444,   444,   444,   445,
+     445,   446,   447,   447,   447,   447,   447,   447,   447,   447,
+     447,   447,   447,   447,   448,   448,   449,   449,   449,   449,
+     450,   450,   451,   452,   453,   453,   454,   454,   455,   456,
+     458,   457,   459,   460,   461,   461,   462,   463,   463,   464,
+     465,   465,   466,   466,   468,   467,   469,   469,   470,   470,
+     470,   470,   470,   470,   470,   471,   471,   472,   472,   472,
+     472,   473,   474,   475,   476,   476,   477,   477,   477,   478,
+     479,   479,   480,   481,   481,   482,   483,   483,   485,   486,
+     484,   488,   487,   489,   490,   491,   491,   493,   494,   492,
+     496,   497,   495,   498,   498,   499,   499,   500,   500,   501,
+     501,   502,   502,   503,   504,   504,   506,   507,   508,   505,
+     509,   510,   510,   511,   511,   512,   513,   514,   514,   516,
+     515,   518,   517,   519,   519,   520,   520,   520,   521,   522,
+     523,   524,   524,   524,   525,   525,   525,   527,   526,   528,
+     528,   528,   529,   530,   531,   531,   532,   533,   533,   533,
+     533,   533,   533,   533,   533,   533,   535,   534,   534,   536,
+     534,   537,   537,   537,   537,   537,   538,   539,   540,   541,
+     541,   541,   541,   541,   541,   542,   543,   544,   545,   546,
+     547,   548,   548,   548,   549,   549,   550,   550,   550,   550,
+     550,   550,   550,   550,   551,   551,   553,   552,   554,   554,
+     555,   555,   556,   556,   556,   557,   557,   558,   559,   560,
+     561,   561,   562,   562,   562,   563,   564,   564,   565,   565,
+     566,   566,   567,   567,   568,   568,   569,   570,   570,   571,
+     572,   572,   573,   574,   574,   575,   576,   576,   576,   577,
+     578,   579,   579,   580,   581,   582,   582,   583,   584,   585,
+     586,   586,   586,   586
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     1,     2,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       4,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     1,     1,     1,     1,     1,     2,     2,     1,     1,
-       3,     1,     3,     1,     7,     3,     3,     3,     3,     3,
-       1,     1,     1,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     3,     4,     4,     4,     6,
-       6,     6,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     6,     1,     1,     1,     1,     4,     3,     3,
-       3,     3,     3,     2,     2,     1,     1,     1,     1,     3,
-       5,     1,     1,     1,     1,     1,     1,     1,     1,     7,
-       1,     1,     4,     1,     1,     0,     3,     1,     1,     1,
-       5,     7,     7,     4,     6,     4,     1,     2,     3,     3,
+       1,     4,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     0,     1,     1,     1,     1,     1,     2,     2,     1,
+       1,     3,     1,     3,     1,     7,     3,     3,     3,     3,
+       3,     1,     1,     1,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     4,     4,     4,
+       6,     6,     6,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     6,     1,     1,     1,     1,     4,     3,
+       3,     3,     3,     3,     2,     2,     1,     1,     1,     1,
+       3,     5,     1,     1,     1,     1,     1,     1,     1,     1,
+       7,     1,     1,     4,     1,     1,     0,     3,     1,     1,
+       1,     5,     7,     7,     4,     6,     4,     1,     2,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     1,     1,     1,
-       4,     1,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     1,     1,
+       1,     4,     1,     2,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     1,     1,     1,     3,     3,     4,     3,     4,     0,
-       1,     1,     1,     3,     5,     7,     3,     3,     3,     3,
+       3,     3,     1,     1,     1,     3,     3,     4,     3,     4,
+       0,     1,     1,     1,     3,     5,     7,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     1,
-       1,     1,     1,     1,     2,     4,     1,     2,     8,     1,
-       1,     3,     3,     0,     3,     3,     0,     1,     0,     3,
-       0,     1,     1,     2,     2,     1,     1,     2,     4,     1,
-       2,     0,     5,     1,     0,     2,     1,     1,     3,     4,
-       4,     1,     1,     1,     1,     1,     1,     4,     4,     1,
-       2,     1,     2,     3,     4,     1,     2,     1,     1,     2,
-       2,     2,     2,     3,     3,     1,     1,     1,     1,     0,
-       2,     6,     1,     3,     1,     0,     2,     2,     1,     3,
-       1,     1,     1,     1,     3,     5,     1,     2,     2,     1,
-       1,     1,     5,     1,     1,     0,     4,     4,     4,     4,
-       4,     1,     1,     0,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     2,     1,     3,     3,     5,
-       6,     1,     2,     1,     1,     0,     7,     1,     1,     0,
-       8,     3,     3,     3,     3,     3,     3,     3,     3,     1,
-       3,     3,     3,     3,     0,     7,     1,     1,     1,     1,
-       1,     1,     2,     1,     3,     3,     1,     3,     3,     3,
-       3,     3,     3,     4,     3,     1,     1,     1,     1,     1,
-       1,     3,     6,     9,    12,     3,     3,     1,     2,     2,
-       1,     0,     9,     4,     1,     1,     2,     4,     1,     2,
-       1,     0,     2,     1,     1,     0,     5,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     1,     1,
-       1,     1,     5,     5,     1,     1,     3,     1,     3,     1,
-       3,     1,     1,     5,     1,     1,     4,     1,     2,     0,
-       0,     7,     0,     8,     4,     1,     1,     2,     0,     0,
-      14,     0,     0,    14,     0,     3,     0,     3,     0,     3,
-       0,     3,     0,     3,     4,     1,     2,     0,     0,     0,
-      11,     1,     0,     2,     1,     1,     3,     4,     1,     2,
-       0,     5,     0,     7,     0,     3,     1,     1,     1,     3,
-       3,     3,     0,     1,     2,     1,     1,     1,     0,     6,
-       1,     1,     1,     3,     3,     1,     3,     2,     1,     1,
-       3,     3,     3,     3,     3,     2,     4,     0,     5,     4,
-       0,     5,     1,     2,     2,     3,     2,     1,     1,     2,
-       1,     1,     1,     1,     1,     1,     4,     4,     4,     6,
-       6,     6,     1,     1,     1,     0,     2,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     2,     0,     6,     1,
-       2,     0,     1,     3,     3,     3,     1,     1,     1,     3,
-       4,     1,     2,     1,     1,     1,     4,     2,     0,     2,
-       0,     2,     2,     1,     1,     1,     1,     4,     1,     2,
-       3,     1,     1,     4,     1,     2,     3,     1,     1,     1,
-       9,     3,     1,     2,     3,     1,     1,     3,     3,     3,
-       3,     0,     3,     3,     3
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       1,     1,     1,     1,     1,     2,     4,     1,     2,     8,
+       1,     1,     3,     3,     0,     3,     3,     0,     1,     0,
+       3,     0,     1,     1,     2,     2,     0,     4,     1,     2,
+       0,     5,     1,     1,     3,     0,     4,     1,     0,     2,
+       2,     0,    23,     1,     1,     2,     4,     1,     2,     0,
+       5,     1,     0,     2,     1,     1,     3,     4,     4,     1,
+       1,     1,     1,     1,     1,     4,     4,     1,     2,     1,
+       2,     3,     4,     1,     2,     1,     1,     2,     2,     2,
+       2,     3,     3,     1,     1,     1,     1,     0,     2,     6,
+       1,     3,     1,     0,     2,     2,     1,     3,     1,     1,
+       1,     1,     3,     5,     1,     2,     2,     1,     1,     1,
+       5,     1,     1,     0,     4,     4,     4,     4,     4,     1,
+       1,     0,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     2,     1,     3,     3,     5,     6,     1,
+       2,     1,     1,     0,     7,     1,     1,     0,     8,     3,
+       3,     3,     3,     3,     3,     3,     3,     1,     3,     3,
+       3,     3,     0,     7,     1,     1,     1,     1,     1,     1,
+       2,     1,     3,     3,     1,     3,     3,     3,     3,     3,
+       3,     4,     3,     3,     1,     1,     1,     1,     1,     1,
+       3,     6,     9,    12,     3,     3,     1,     2,     2,     1,
+       0,     9,     4,     1,     1,     2,     4,     1,     2,     1,
+       0,     2,     1,     1,     0,     5,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     1,     1,     1,
+       1,     5,     5,     1,     1,     3,     1,     3,     1,     3,
+       1,     1,     5,     1,     1,     4,     1,     2,     0,     0,
+       7,     0,     8,     4,     1,     1,     2,     0,     0,    14,
+       0,     0,    14,     0,     3,     0,     3,     0,     3,     0,
+       3,     0,     3,     4,     1,     2,     0,     0,     0,    11,
+       1,     0,     2,     1,     1,     3,     4,     1,     2,     0,
+       5,     0,     7,     0,     3,     1,     1,     1,     3,     3,
+       3,     0,     1,     2,     1,     1,     1,     0,     6,     1,
+       1,     1,     3,     3,     1,     3,     2,     1,     1,     3,
+       3,     3,     3,     3,     2,     4,     0,     5,     4,     0,
+       5,     1,     2,     2,     3,     2,     1,     1,     2,     1,
+       1,     1,     1,     1,     1,     4,     4,     4,     6,     6,
+       6,     1,     1,     1,     0,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     2,     0,     6,     1,     2,
+       0,     1,     3,     3,     3,     1,     1,     1,     3,     4,
+       1,     2,     1,     1,     1,     4,     2,     0,     2,     0,
+       2,     2,     1,     1,     1,     1,     4,     1,     2,     3,
+       1,     1,     4,     1,     2,     3,     1,     1,     1,     9,
+       3,     1,     2,     3,     1,     1,     3,     3,     3,     3,
+       0,     3,     3,     3
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (parse_state, scanner, YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (parse_state, scanner, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -2343,57 +2671,54 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, parse_state, scanner); \
+                  Kind, Value, parse_state, scanner); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, struct mdlparse_vars *parse_state, yyscan_t scanner)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, struct mdlparse_vars *parse_state, yyscan_t scanner)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
-  YYUSE (parse_state);
-  YYUSE (scanner);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (parse_state);
+  YY_USE (scanner);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, struct mdlparse_vars *parse_state, yyscan_t scanner)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, struct mdlparse_vars *parse_state, yyscan_t scanner)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, parse_state, scanner);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, parse_state, scanner);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -2402,7 +2727,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, str
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -2425,21 +2750,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule, struct mdlparse_vars *parse_state, yyscan_t scanner)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, struct mdlparse_vars *parse_state, yyscan_t scanner)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              , parse_state, scanner);
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], parse_state, scanner);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -2454,8 +2779,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -2478,250 +2803,35 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
 
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
 
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, struct mdlparse_vars *parse_state, yyscan_t scanner)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, struct mdlparse_vars *parse_state, yyscan_t scanner)
 {
-  YYUSE (yyvaluep);
-  YYUSE (parse_state);
-  YYUSE (scanner);
+  YY_USE (yyvaluep);
+  YY_USE (parse_state);
+  YY_USE (scanner);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2729,7 +2839,7 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, struct mdlparse_va
 int
 yyparse (struct mdlparse_vars *parse_state, yyscan_t scanner)
 {
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 
@@ -2740,45 +2850,38 @@ YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
 YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
     /* Number of syntax errors so far.  */
-    int yynerrs;
+    int yynerrs = 0;
 
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2786,71 +2889,75 @@ YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -2858,30 +2965,31 @@ YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2892,18 +3000,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex (&yylval, parse_state, scanner);
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2931,15 +3050,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2954,7 +3071,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2974,93 +3091,93 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 29:
-#line 646 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_object(parse_state, (yyvsp[0].str))); }
-#line 2981 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 30: /* existing_object: var  */
+#line 655 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_object(parse_state, (yyvsp[0].str))); }
+#line 3098 "mdlparse.c"
     break;
 
-  case 30:
-#line 649 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_region(parse_state, (yyvsp[-3].sym), (yyvsp[-1].str))); }
-#line 2987 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 31: /* existing_region: existing_object '[' var ']'  */
+#line 658 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_region(parse_state, (yyvsp[-3].sym), (yyvsp[-1].str))); }
+#line 3104 "mdlparse.c"
     break;
 
-  case 31:
-#line 652 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.vec3) = mdl_point(parse_state, &(yyvsp[0].nlist))); }
-#line 2993 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 32: /* point: array_value  */
+#line 661 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.vec3) = mdl_point(parse_state, &(yyvsp[0].nlist))); }
+#line 3110 "mdlparse.c"
     break;
 
-  case 33:
-#line 656 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.vec3) = mdl_point_scalar((yyvsp[0].dbl))); }
-#line 2999 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 34: /* point_or_num: num_expr_only  */
+#line 665 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.vec3) = mdl_point_scalar((yyvsp[0].dbl))); }
+#line 3116 "mdlparse.c"
     break;
 
-  case 34:
-#line 659 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 1; }
-#line 3005 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 35: /* boolean: TRUE  */
+#line 668 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 1; }
+#line 3122 "mdlparse.c"
     break;
 
-  case 35:
-#line 660 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 3011 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 36: /* boolean: FALSE  */
+#line 669 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 0; }
+#line 3128 "mdlparse.c"
     break;
 
-  case 36:
-#line 661 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 1; }
-#line 3017 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 37: /* boolean: YES  */
+#line 670 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 1; }
+#line 3134 "mdlparse.c"
     break;
 
-  case 37:
-#line 662 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 3023 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 38: /* boolean: NO  */
+#line 671 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 0; }
+#line 3140 "mdlparse.c"
     break;
 
-  case 38:
-#line 663 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 1; }
-#line 3029 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 39: /* boolean: ON  */
+#line 672 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 1; }
+#line 3146 "mdlparse.c"
     break;
 
-  case 39:
-#line 664 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 3035 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 40: /* boolean: OFF  */
+#line 673 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 0; }
+#line 3152 "mdlparse.c"
     break;
 
-  case 40:
-#line 667 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type).orient_set = 0; }
-#line 3041 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 41: /* orientation_class: %empty  */
+#line 676 "../src/mdlparse.y"
+                                                      { (yyval.mol_type).orient_set = 0; }
+#line 3158 "mdlparse.c"
     break;
 
-  case 43:
-#line 670 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type).orient_set = 1; (yyval.mol_type).orient = 0; }
-#line 3047 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 44: /* orientation_class: ';'  */
+#line 679 "../src/mdlparse.y"
+                                                      { (yyval.mol_type).orient_set = 1; (yyval.mol_type).orient = 0; }
+#line 3164 "mdlparse.c"
     break;
 
-  case 44:
-#line 674 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type).orient = 1; (yyval.mol_type).orient_set = 1; }
-#line 3053 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 45: /* list_orient_marks: head_mark  */
+#line 683 "../src/mdlparse.y"
+                                                      { (yyval.mol_type).orient = 1; (yyval.mol_type).orient_set = 1; }
+#line 3170 "mdlparse.c"
     break;
 
-  case 45:
-#line 675 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type).orient = -1; (yyval.mol_type).orient_set = 1; }
-#line 3059 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 46: /* list_orient_marks: tail_mark  */
+#line 684 "../src/mdlparse.y"
+                                                      { (yyval.mol_type).orient = -1; (yyval.mol_type).orient_set = 1; }
+#line 3176 "mdlparse.c"
     break;
 
-  case 46:
-#line 676 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 47: /* list_orient_marks: list_orient_marks head_mark  */
+#line 685 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.mol_type) = (yyvsp[-1].mol_type);
                                                           if ((yyval.mol_type).orient >= 32767)
                                                           {
@@ -3070,12 +3187,12 @@ yyreduce:
                                                           }
                                                           ++ (yyval.mol_type).orient;
                                                       }
-#line 3074 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 3191 "mdlparse.c"
     break;
 
-  case 47:
-#line 686 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 48: /* list_orient_marks: list_orient_marks tail_mark  */
+#line 695 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.mol_type) = (yyvsp[-1].mol_type);
                                                           if ((yyval.mol_type).orient <= -32768)
                                                           {
@@ -3085,12 +3202,12 @@ yyreduce:
                                                           }
                                                           -- (yyval.mol_type).orient;
                                                       }
-#line 3089 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 3206 "mdlparse.c"
     break;
 
-  case 50:
-#line 704 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 51: /* orient_class_number: '{' num_expr '}'  */
+#line 713 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.mol_type).orient = (int) (yyvsp[-1].dbl);
                                                           (yyval.mol_type).orient_set = 1;
                                                           if ((yyval.mol_type).orient != (yyvsp[-1].dbl))
@@ -3099,12 +3216,12 @@ yyreduce:
                                                             return 1;
                                                           }
                                                       }
-#line 3103 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 3220 "mdlparse.c"
     break;
 
-  case 52:
-#line 717 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 53: /* list_range_specs: list_range_specs ',' range_spec  */
+#line 726 "../src/mdlparse.y"
+                                                      {
                                                           if ((yyvsp[-2].nlist).value_tail)
                                                           {
                                                             (yyval.nlist) = (yyvsp[-2].nlist);
@@ -3115,24 +3232,24 @@ yyreduce:
                                                           else
                                                             (yyval.nlist) = (yyvsp[0].nlist);
                                                       }
-#line 3119 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 3236 "mdlparse.c"
     break;
 
-  case 53:
-#line 730 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mcell_generate_range_singleton(&(yyval.nlist), (yyvsp[0].dbl))); }
-#line 3125 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 54: /* range_spec: num_expr  */
+#line 739 "../src/mdlparse.y"
+                                                      { CHECK(mcell_generate_range_singleton(&(yyval.nlist), (yyvsp[0].dbl))); }
+#line 3242 "mdlparse.c"
     break;
 
-  case 54:
-#line 731 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_generate_range(parse_state, &(yyval.nlist), (yyvsp[-5].dbl), (yyvsp[-3].dbl), (yyvsp[-1].dbl))); }
-#line 3131 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 55: /* range_spec: '[' num_expr TO num_expr STEP num_expr ']'  */
+#line 740 "../src/mdlparse.y"
+                                                      { CHECK(mdl_generate_range(parse_state, &(yyval.nlist), (yyvsp[-5].dbl), (yyvsp[-3].dbl), (yyvsp[-1].dbl))); }
+#line 3248 "mdlparse.c"
     break;
 
-  case 55:
-#line 737 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 56: /* include_stmt: INCLUDE_FILE '=' str_expr  */
+#line 746 "../src/mdlparse.y"
+                                                      {
                                                           char *include_path = mcell_find_include_file((yyvsp[0].str), parse_state->vol->curr_file);
                                                           if (include_path == NULL)
                                                           {
@@ -3149,48 +3266,48 @@ yyreduce:
                                                           free(include_path);
                                                           free((yyvsp[0].str));
                                                       }
-#line 3153 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 3270 "mdlparse.c"
     break;
 
-  case 56:
-#line 760 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_assign_variable_double(parse_state, (yyvsp[-2].sym), (yyvsp[0].dbl))); }
-#line 3159 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 57: /* assignment_stmt: assign_var '=' num_expr_only  */
+#line 769 "../src/mdlparse.y"
+                                                      { CHECK(mdl_assign_variable_double(parse_state, (yyvsp[-2].sym), (yyvsp[0].dbl))); }
+#line 3276 "mdlparse.c"
     break;
 
-  case 57:
-#line 761 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_assign_variable_string(parse_state, (yyvsp[-2].sym), (yyvsp[0].str))); }
-#line 3165 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 58: /* assignment_stmt: assign_var '=' str_expr_only  */
+#line 770 "../src/mdlparse.y"
+                                                      { CHECK(mdl_assign_variable_string(parse_state, (yyvsp[-2].sym), (yyvsp[0].str))); }
+#line 3282 "mdlparse.c"
     break;
 
-  case 58:
-#line 762 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_assign_variable(parse_state, (yyvsp[-2].sym), (yyvsp[0].sym))); }
-#line 3171 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 59: /* assignment_stmt: assign_var '=' existing_var_only  */
+#line 771 "../src/mdlparse.y"
+                                                      { CHECK(mdl_assign_variable(parse_state, (yyvsp[-2].sym), (yyvsp[0].sym))); }
+#line 3288 "mdlparse.c"
     break;
 
-  case 59:
-#line 763 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_assign_variable_array(parse_state, (yyvsp[-2].sym), (yyvsp[0].nlist).value_head)); }
-#line 3177 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 60: /* assignment_stmt: assign_var '=' array_expr_only  */
+#line 772 "../src/mdlparse.y"
+                                                      { CHECK(mdl_assign_variable_array(parse_state, (yyvsp[-2].sym), (yyvsp[0].nlist).value_head)); }
+#line 3294 "mdlparse.c"
     break;
 
-  case 60:
-#line 766 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_get_or_create_variable(parse_state, (yyvsp[0].str))); }
-#line 3183 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 61: /* assign_var: var  */
+#line 775 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_get_or_create_variable(parse_state, (yyvsp[0].str))); }
+#line 3300 "mdlparse.c"
     break;
 
-  case 61:
-#line 769 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_variable(parse_state, (yyvsp[0].str))); }
-#line 3189 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 62: /* existing_var_only: var  */
+#line 778 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_variable(parse_state, (yyvsp[0].str))); }
+#line 3306 "mdlparse.c"
     break;
 
-  case 63:
-#line 773 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 64: /* array_value: existing_array  */
+#line 782 "../src/mdlparse.y"
+                                                      {
                                                           struct num_expr_list *elp;
                                                           (yyval.nlist).value_head = (struct num_expr_list *) (yyvsp[0].sym)->value;
                                                           (yyval.nlist).value_count = 1;
@@ -3199,300 +3316,300 @@ yyreduce:
                                                           (yyval.nlist).value_tail = elp;
                                                           (yyval.nlist).shared = 1;
                                                       }
-#line 3203 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 3320 "mdlparse.c"
     break;
 
-  case 64:
-#line 784 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_debug_dump_array((yyvsp[-1].nlist).value_head); (yyval.nlist) = (yyvsp[-1].nlist); }
-#line 3209 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 65: /* array_expr_only: '[' list_range_specs ']'  */
+#line 793 "../src/mdlparse.y"
+                                                      { mdl_debug_dump_array((yyvsp[-1].nlist).value_head); (yyval.nlist) = (yyvsp[-1].nlist); }
+#line 3326 "mdlparse.c"
     break;
 
-  case 65:
-#line 787 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_array(parse_state, (yyvsp[0].str))); }
-#line 3215 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 66: /* existing_array: var  */
+#line 796 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_array(parse_state, (yyvsp[0].str))); }
+#line 3332 "mdlparse.c"
     break;
 
-  case 69:
-#line 795 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = *(double *) (yyvsp[0].sym)->value; }
-#line 3221 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 70: /* num_value: existing_num_var  */
+#line 804 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = *(double *) (yyvsp[0].sym)->value; }
+#line 3338 "mdlparse.c"
     break;
 
-  case 70:
-#line 798 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = (yyvsp[0].llival); }
-#line 3227 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 71: /* intOrReal: LLINTEGER  */
+#line 807 "../src/mdlparse.y"
+                                                        { (yyval.dbl) = (yyvsp[0].llival); }
+#line 3344 "mdlparse.c"
     break;
 
-  case 74:
-#line 806 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_double(parse_state, (yyvsp[0].str))); }
-#line 3233 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 75: /* existing_num_var: var  */
+#line 815 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_double(parse_state, (yyvsp[0].str))); }
+#line 3350 "mdlparse.c"
     break;
 
-  case 75:
-#line 810 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = (yyvsp[-1].dbl); }
-#line 3239 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 76: /* arith_expr: '(' num_expr ')'  */
+#line 819 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = (yyvsp[-1].dbl); }
+#line 3356 "mdlparse.c"
     break;
 
-  case 76:
-#line 811 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKF((yyval.dbl) = exp((yyvsp[-1].dbl))); }
-#line 3245 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 77: /* arith_expr: EXP '(' num_expr ')'  */
+#line 820 "../src/mdlparse.y"
+                                                      { CHECKF((yyval.dbl) = exp((yyvsp[-1].dbl))); }
+#line 3362 "mdlparse.c"
     break;
 
-  case 77:
-#line 812 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_expr_log(parse_state, (yyvsp[-1].dbl), &(yyval.dbl))); }
-#line 3251 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 78: /* arith_expr: LOG '(' num_expr ')'  */
+#line 821 "../src/mdlparse.y"
+                                                      { CHECK(mdl_expr_log(parse_state, (yyvsp[-1].dbl), &(yyval.dbl))); }
+#line 3368 "mdlparse.c"
     break;
 
-  case 78:
-#line 813 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_expr_log10(parse_state, (yyvsp[-1].dbl), &(yyval.dbl))); }
-#line 3257 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 79: /* arith_expr: LOG10 '(' num_expr ')'  */
+#line 822 "../src/mdlparse.y"
+                                                      { CHECK(mdl_expr_log10(parse_state, (yyvsp[-1].dbl), &(yyval.dbl))); }
+#line 3374 "mdlparse.c"
     break;
 
-  case 79:
-#line 814 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = max2d((yyvsp[-3].dbl), (yyvsp[-1].dbl)); }
-#line 3263 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 80: /* arith_expr: MAX_TOK '(' num_expr ',' num_expr ')'  */
+#line 823 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = max2d((yyvsp[-3].dbl), (yyvsp[-1].dbl)); }
+#line 3380 "mdlparse.c"
     break;
 
-  case 80:
-#line 815 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = min2d((yyvsp[-3].dbl), (yyvsp[-1].dbl)); }
-#line 3269 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 81: /* arith_expr: MIN_TOK '(' num_expr ',' num_expr ')'  */
+#line 824 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = min2d((yyvsp[-3].dbl), (yyvsp[-1].dbl)); }
+#line 3386 "mdlparse.c"
     break;
 
-  case 81:
-#line 816 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = mdl_expr_roundoff((yyvsp[-1].dbl), (int) (yyvsp[-3].dbl)); }
-#line 3275 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 82: /* arith_expr: ROUND_OFF '(' num_expr ',' num_expr ')'  */
+#line 825 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = mdl_expr_roundoff((yyvsp[-1].dbl), (int) (yyvsp[-3].dbl)); }
+#line 3392 "mdlparse.c"
     break;
 
-  case 82:
-#line 817 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = floor((yyvsp[-1].dbl)); }
-#line 3281 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 83: /* arith_expr: FLOOR '(' num_expr ')'  */
+#line 826 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = floor((yyvsp[-1].dbl)); }
+#line 3398 "mdlparse.c"
     break;
 
-  case 83:
-#line 818 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = ceil((yyvsp[-1].dbl)); }
-#line 3287 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 84: /* arith_expr: CEIL '(' num_expr ')'  */
+#line 827 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = ceil((yyvsp[-1].dbl)); }
+#line 3404 "mdlparse.c"
     break;
 
-  case 84:
-#line 819 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = sin((yyvsp[-1].dbl)); }
-#line 3293 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 85: /* arith_expr: SIN '(' num_expr ')'  */
+#line 828 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = sin((yyvsp[-1].dbl)); }
+#line 3410 "mdlparse.c"
     break;
 
-  case 85:
-#line 820 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = cos((yyvsp[-1].dbl)); }
-#line 3299 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 86: /* arith_expr: COS '(' num_expr ')'  */
+#line 829 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = cos((yyvsp[-1].dbl)); }
+#line 3416 "mdlparse.c"
     break;
 
-  case 86:
-#line 821 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKF((yyval.dbl) = tan((yyvsp[-1].dbl))); }
-#line 3305 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 87: /* arith_expr: TAN '(' num_expr ')'  */
+#line 830 "../src/mdlparse.y"
+                                                      { CHECKF((yyval.dbl) = tan((yyvsp[-1].dbl))); }
+#line 3422 "mdlparse.c"
     break;
 
-  case 87:
-#line 822 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKF((yyval.dbl) = asin((yyvsp[-1].dbl))); }
-#line 3311 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 88: /* arith_expr: ASIN '(' num_expr ')'  */
+#line 831 "../src/mdlparse.y"
+                                                      { CHECKF((yyval.dbl) = asin((yyvsp[-1].dbl))); }
+#line 3428 "mdlparse.c"
     break;
 
-  case 88:
-#line 823 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKF((yyval.dbl) = acos((yyvsp[-1].dbl))); }
-#line 3317 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 89: /* arith_expr: ACOS '(' num_expr ')'  */
+#line 832 "../src/mdlparse.y"
+                                                      { CHECKF((yyval.dbl) = acos((yyvsp[-1].dbl))); }
+#line 3434 "mdlparse.c"
     break;
 
-  case 89:
-#line 824 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = atan((yyvsp[-1].dbl)); }
-#line 3323 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 90: /* arith_expr: ATAN '(' num_expr ')'  */
+#line 833 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = atan((yyvsp[-1].dbl)); }
+#line 3440 "mdlparse.c"
     break;
 
-  case 90:
-#line 825 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKF((yyval.dbl) = sqrt((yyvsp[-1].dbl))); }
-#line 3329 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 91: /* arith_expr: SQRT '(' num_expr ')'  */
+#line 834 "../src/mdlparse.y"
+                                                      { CHECKF((yyval.dbl) = sqrt((yyvsp[-1].dbl))); }
+#line 3446 "mdlparse.c"
     break;
 
-  case 91:
-#line 826 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = fabs((yyvsp[-1].dbl)); }
-#line 3335 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 92: /* arith_expr: ABS '(' num_expr ')'  */
+#line 835 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = fabs((yyvsp[-1].dbl)); }
+#line 3452 "mdlparse.c"
     break;
 
-  case 92:
-#line 827 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_expr_mod(parse_state, (yyvsp[-3].dbl), (yyvsp[-1].dbl), &(yyval.dbl))); }
-#line 3341 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 93: /* arith_expr: MOD '(' num_expr ',' num_expr ')'  */
+#line 836 "../src/mdlparse.y"
+                                                      { CHECK(mdl_expr_mod(parse_state, (yyvsp[-3].dbl), (yyvsp[-1].dbl), &(yyval.dbl))); }
+#line 3458 "mdlparse.c"
     break;
 
-  case 93:
-#line 828 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = MY_PI; }
-#line 3347 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 94: /* arith_expr: PI_TOK  */
+#line 837 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = MY_PI; }
+#line 3464 "mdlparse.c"
     break;
 
-  case 94:
-#line 829 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = mdl_expr_rng_uniform(parse_state); }
-#line 3353 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 95: /* arith_expr: RAND_UNIFORM  */
+#line 838 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = mdl_expr_rng_uniform(parse_state); }
+#line 3470 "mdlparse.c"
     break;
 
-  case 95:
-#line 830 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = rng_gauss(parse_state->vol->rng); }
-#line 3359 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 96: /* arith_expr: RAND_GAUSSIAN  */
+#line 839 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = rng_gauss(parse_state->vol->rng); }
+#line 3476 "mdlparse.c"
     break;
 
-  case 96:
-#line 831 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = parse_state->vol->seed_seq; }
-#line 3365 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 97: /* arith_expr: SEED  */
+#line 840 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = parse_state->vol->seed_seq; }
+#line 3482 "mdlparse.c"
     break;
 
-  case 97:
-#line 832 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_expr_string_to_double(parse_state, (yyvsp[-1].str), &(yyval.dbl))); }
-#line 3371 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 98: /* arith_expr: STRING_TO_NUM '(' str_expr ')'  */
+#line 841 "../src/mdlparse.y"
+                                                      { CHECK(mdl_expr_string_to_double(parse_state, (yyvsp[-1].str), &(yyval.dbl))); }
+#line 3488 "mdlparse.c"
     break;
 
-  case 98:
-#line 833 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKF((yyval.dbl) = (yyvsp[-2].dbl) + (yyvsp[0].dbl)); }
-#line 3377 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 99: /* arith_expr: num_expr '+' num_expr  */
+#line 842 "../src/mdlparse.y"
+                                                      { CHECKF((yyval.dbl) = (yyvsp[-2].dbl) + (yyvsp[0].dbl)); }
+#line 3494 "mdlparse.c"
     break;
 
-  case 99:
-#line 834 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKF((yyval.dbl) = (yyvsp[-2].dbl) - (yyvsp[0].dbl)); }
-#line 3383 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 100: /* arith_expr: num_expr '-' num_expr  */
+#line 843 "../src/mdlparse.y"
+                                                      { CHECKF((yyval.dbl) = (yyvsp[-2].dbl) - (yyvsp[0].dbl)); }
+#line 3500 "mdlparse.c"
     break;
 
-  case 100:
-#line 835 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKF((yyval.dbl) = (yyvsp[-2].dbl) * (yyvsp[0].dbl)); }
-#line 3389 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 101: /* arith_expr: num_expr '*' num_expr  */
+#line 844 "../src/mdlparse.y"
+                                                      { CHECKF((yyval.dbl) = (yyvsp[-2].dbl) * (yyvsp[0].dbl)); }
+#line 3506 "mdlparse.c"
     break;
 
-  case 101:
-#line 836 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_expr_div(parse_state, (yyvsp[-2].dbl), (yyvsp[0].dbl), &(yyval.dbl))); }
-#line 3395 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 102: /* arith_expr: num_expr '/' num_expr  */
+#line 845 "../src/mdlparse.y"
+                                                      { CHECK(mdl_expr_div(parse_state, (yyvsp[-2].dbl), (yyvsp[0].dbl), &(yyval.dbl))); }
+#line 3512 "mdlparse.c"
     break;
 
-  case 102:
-#line 837 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_expr_pow(parse_state, (yyvsp[-2].dbl), (yyvsp[0].dbl), &(yyval.dbl))); }
-#line 3401 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 103: /* arith_expr: num_expr '^' num_expr  */
+#line 846 "../src/mdlparse.y"
+                                                      { CHECK(mdl_expr_pow(parse_state, (yyvsp[-2].dbl), (yyvsp[0].dbl), &(yyval.dbl))); }
+#line 3518 "mdlparse.c"
     break;
 
-  case 103:
-#line 838 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = -(yyvsp[0].dbl); }
-#line 3407 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 104: /* arith_expr: '-' num_expr  */
+#line 847 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = -(yyvsp[0].dbl); }
+#line 3524 "mdlparse.c"
     break;
 
-  case 104:
-#line 839 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = (yyvsp[0].dbl); }
-#line 3413 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 105: /* arith_expr: '+' num_expr  */
+#line 848 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = (yyvsp[0].dbl); }
+#line 3530 "mdlparse.c"
     break;
 
-  case 106:
-#line 844 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.str) = mdl_strdup((char const *) (yyvsp[0].sym)->value)); }
-#line 3419 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 107: /* str_expr: existing_str_var  */
+#line 853 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.str) = mdl_strdup((char const *) (yyvsp[0].sym)->value)); }
+#line 3536 "mdlparse.c"
     break;
 
-  case 107:
-#line 848 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.str) = mdl_strip_quotes((yyvsp[0].str))); }
-#line 3425 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 108: /* str_expr_only: str_value  */
+#line 857 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.str) = mdl_strip_quotes((yyvsp[0].str))); }
+#line 3542 "mdlparse.c"
     break;
 
-  case 108:
-#line 849 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.str) = mdl_strdup(parse_state->vol->mdl_infile_name)); }
-#line 3431 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 109: /* str_expr_only: INPUT_FILE  */
+#line 858 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.str) = mdl_strdup(parse_state->vol->mdl_infile_name)); }
+#line 3548 "mdlparse.c"
     break;
 
-  case 109:
-#line 850 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.str) = mdl_strcat((yyvsp[-2].str), (yyvsp[0].str))); }
-#line 3437 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 110: /* str_expr_only: str_expr '&' str_expr  */
+#line 859 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.str) = mdl_strcat((yyvsp[-2].str), (yyvsp[0].str))); }
+#line 3554 "mdlparse.c"
     break;
 
-  case 110:
-#line 851 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.str) = mdl_string_format(parse_state, (yyvsp[-2].str), (yyvsp[-1].printfargs).arg_head)); }
-#line 3443 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 111: /* str_expr_only: FORMAT '(' format_string list_args ')'  */
+#line 860 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.str) = mdl_string_format(parse_state, (yyvsp[-2].str), (yyvsp[-1].printfargs).arg_head)); }
+#line 3560 "mdlparse.c"
     break;
 
-  case 111:
-#line 854 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_string(parse_state, (yyvsp[0].str))); }
-#line 3449 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 112: /* existing_str_var: var  */
+#line 863 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_string(parse_state, (yyvsp[0].str))); }
+#line 3566 "mdlparse.c"
     break;
 
-  case 119:
-#line 870 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_fopen(parse_state, (yyvsp[-6].sym), (yyvsp[-3].str), (yyvsp[-1].str))); }
-#line 3455 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 120: /* fopen_stmt: new_file_stream FOPEN '(' file_name ',' file_mode ')'  */
+#line 879 "../src/mdlparse.y"
+                                                      { CHECK(mdl_fopen(parse_state, (yyvsp[-6].sym), (yyvsp[-3].str), (yyvsp[-1].str))); }
+#line 3572 "mdlparse.c"
     break;
 
-  case 120:
-#line 873 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_new_filehandle(parse_state, (yyvsp[0].str))); }
-#line 3461 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 121: /* new_file_stream: var  */
+#line 882 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_new_filehandle(parse_state, (yyvsp[0].str))); }
+#line 3578 "mdlparse.c"
     break;
 
-  case 121:
-#line 876 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); CHECK(mdl_valid_file_mode(parse_state, (yyvsp[0].str))); }
-#line 3467 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 122: /* file_mode: str_expr  */
+#line 885 "../src/mdlparse.y"
+                                                      { (yyval.str) = (yyvsp[0].str); CHECK(mdl_valid_file_mode(parse_state, (yyvsp[0].str))); }
+#line 3584 "mdlparse.c"
     break;
 
-  case 122:
-#line 879 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_fclose(parse_state, (yyvsp[-1].sym))); }
-#line 3473 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 123: /* fclose_stmt: FCLOSE '(' existing_file_stream ')'  */
+#line 888 "../src/mdlparse.y"
+                                                      { CHECK(mdl_fclose(parse_state, (yyvsp[-1].sym))); }
+#line 3590 "mdlparse.c"
     break;
 
-  case 123:
-#line 882 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_file_stream(parse_state, (yyvsp[0].str))); }
-#line 3479 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 124: /* existing_file_stream: var  */
+#line 891 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_file_stream(parse_state, (yyvsp[0].str))); }
+#line 3596 "mdlparse.c"
     break;
 
-  case 124:
-#line 885 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.str) = mdl_expand_string_escapes((yyvsp[0].str))); }
-#line 3485 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 125: /* format_string: str_expr  */
+#line 894 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.str) = mdl_expand_string_escapes((yyvsp[0].str))); }
+#line 3602 "mdlparse.c"
     break;
 
-  case 125:
-#line 888 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.printfargs).arg_head = (yyval.printfargs).arg_tail = NULL; }
-#line 3491 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 126: /* list_args: %empty  */
+#line 897 "../src/mdlparse.y"
+                                                      { (yyval.printfargs).arg_head = (yyval.printfargs).arg_tail = NULL; }
+#line 3608 "mdlparse.c"
     break;
 
-  case 126:
-#line 889 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 127: /* list_args: list_args ',' list_arg  */
+#line 898 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.printfargs) = (yyvsp[-2].printfargs);
                                                         if ((yyval.printfargs).arg_tail)
                                                           (yyval.printfargs).arg_tail = (yyval.printfargs).arg_tail->next = (yyvsp[0].printfarg);
@@ -3500,24 +3617,24 @@ yyreduce:
                                                           (yyval.printfargs).arg_tail = (yyval.printfargs).arg_head = (yyvsp[0].printfarg);
                                                         (yyvsp[0].printfarg)->next = NULL;
                                                       }
-#line 3504 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 3621 "mdlparse.c"
     break;
 
-  case 127:
-#line 899 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.printfarg) = mdl_new_printf_arg_double((yyvsp[0].dbl))); }
-#line 3510 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 128: /* list_arg: num_expr_only  */
+#line 908 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.printfarg) = mdl_new_printf_arg_double((yyvsp[0].dbl))); }
+#line 3627 "mdlparse.c"
     break;
 
-  case 128:
-#line 900 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.printfarg) = mdl_new_printf_arg_string((yyvsp[0].str))); }
-#line 3516 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 129: /* list_arg: str_expr_only  */
+#line 909 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.printfarg) = mdl_new_printf_arg_string((yyvsp[0].str))); }
+#line 3633 "mdlparse.c"
     break;
 
-  case 129:
-#line 901 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 130: /* list_arg: existing_var_only  */
+#line 910 "../src/mdlparse.y"
+                                                      {
                                                           switch ((yyvsp[0].sym)->sym_type)
                                                           {
                                                             case DBL: CHECKN((yyval.printfarg) = mdl_new_printf_arg_double(*(double *) (yyvsp[0].sym)->value)); break;
@@ -3527,585 +3644,585 @@ yyreduce:
                                                               return 1;
                                                           }
                                                       }
-#line 3531 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 3648 "mdlparse.c"
     break;
 
-  case 130:
-#line 913 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_printf(parse_state, (yyvsp[-2].str), (yyvsp[-1].printfargs).arg_head)); }
-#line 3537 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 131: /* printf_stmt: PRINTF '(' format_string list_args ')'  */
+#line 922 "../src/mdlparse.y"
+                                                      { CHECK(mdl_printf(parse_state, (yyvsp[-2].str), (yyvsp[-1].printfargs).arg_head)); }
+#line 3654 "mdlparse.c"
     break;
 
-  case 131:
-#line 919 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_fprintf(parse_state, (struct file_stream *) (yyvsp[-4].sym)->value, (yyvsp[-2].str), (yyvsp[-1].printfargs).arg_head)); }
-#line 3543 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 132: /* fprintf_stmt: FPRINTF '(' existing_file_stream ',' format_string list_args ')'  */
+#line 928 "../src/mdlparse.y"
+                                                      { CHECK(mdl_fprintf(parse_state, (struct file_stream *) (yyvsp[-4].sym)->value, (yyvsp[-2].str), (yyvsp[-1].printfargs).arg_head)); }
+#line 3660 "mdlparse.c"
     break;
 
-  case 132:
-#line 925 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_sprintf(parse_state, (yyvsp[-4].sym), (yyvsp[-2].str), (yyvsp[-1].printfargs).arg_head)); }
-#line 3549 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 133: /* sprintf_stmt: SPRINTF '(' assign_var ',' format_string list_args ')'  */
+#line 934 "../src/mdlparse.y"
+                                                      { CHECK(mdl_sprintf(parse_state, (yyvsp[-4].sym), (yyvsp[-2].str), (yyvsp[-1].printfargs).arg_head)); }
+#line 3666 "mdlparse.c"
     break;
 
-  case 133:
-#line 928 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_print_time(parse_state, (yyvsp[-1].str)); }
-#line 3555 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 134: /* print_time_stmt: PRINT_TIME '(' format_string ')'  */
+#line 937 "../src/mdlparse.y"
+                                                      { mdl_print_time(parse_state, (yyvsp[-1].str)); }
+#line 3672 "mdlparse.c"
     break;
 
-  case 134:
-#line 934 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_fprint_time(parse_state, (yyvsp[-3].sym), (yyvsp[-1].str))); }
-#line 3561 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 135: /* fprint_time_stmt: FPRINT_TIME '(' existing_file_stream ',' format_string ')'  */
+#line 943 "../src/mdlparse.y"
+                                                      { CHECK(mdl_fprint_time(parse_state, (yyvsp[-3].sym), (yyvsp[-1].str))); }
+#line 3678 "mdlparse.c"
     break;
 
-  case 138:
-#line 950 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) mdl_set_all_notifications(parse_state->vol, (yyvsp[0].tok)); }
-#line 3567 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 139: /* notification_item_def: ALL_NOTIFICATIONS '=' notify_bilevel  */
+#line 959 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) mdl_set_all_notifications(parse_state->vol, (yyvsp[0].tok)); }
+#line 3684 "mdlparse.c"
     break;
 
-  case 139:
-#line 951 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->progress_report        = (yyvsp[0].tok); }
-#line 3573 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 140: /* notification_item_def: PROGRESS_REPORT '=' notify_bilevel  */
+#line 960 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->progress_report        = (yyvsp[0].tok); }
+#line 3690 "mdlparse.c"
     break;
 
-  case 140:
-#line 952 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->diffusion_constants    = (yyvsp[0].tok); }
-#line 3579 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 141: /* notification_item_def: DIFFUSION_CONSTANT_REPORT '=' notify_level  */
+#line 961 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->diffusion_constants    = (yyvsp[0].tok); }
+#line 3696 "mdlparse.c"
     break;
 
-  case 141:
-#line 953 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->reaction_probabilities = (yyvsp[0].tok); }
-#line 3585 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 142: /* notification_item_def: PROBABILITY_REPORT '=' notify_bilevel  */
+#line 962 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->reaction_probabilities = (yyvsp[0].tok); }
+#line 3702 "mdlparse.c"
     break;
 
-  case 142:
-#line 954 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->time_varying_reactions = (yyvsp[0].tok); }
-#line 3591 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 143: /* notification_item_def: VARYING_PROBABILITY_REPORT '=' notify_bilevel  */
+#line 963 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->time_varying_reactions = (yyvsp[0].tok); }
+#line 3708 "mdlparse.c"
     break;
 
-  case 143:
-#line 955 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->reaction_prob_notify   = (yyvsp[0].dbl); }
-#line 3597 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 144: /* notification_item_def: PROBABILITY_REPORT_THRESHOLD '=' num_expr  */
+#line 964 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->reaction_prob_notify   = (yyvsp[0].dbl); }
+#line 3714 "mdlparse.c"
     break;
 
-  case 144:
-#line 956 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->partition_location     = (yyvsp[0].tok); }
-#line 3603 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 145: /* notification_item_def: PARTITION_LOCATION_REPORT '=' notify_bilevel  */
+#line 965 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->partition_location     = (yyvsp[0].tok); }
+#line 3720 "mdlparse.c"
     break;
 
-  case 145:
-#line 957 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->box_triangulation      = (yyvsp[0].tok); }
-#line 3609 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 146: /* notification_item_def: BOX_TRIANGULATION_REPORT '=' notify_bilevel  */
+#line 966 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->box_triangulation      = (yyvsp[0].tok); }
+#line 3726 "mdlparse.c"
     break;
 
-  case 146:
-#line 958 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->release_events         = (yyvsp[0].tok); }
-#line 3615 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 147: /* notification_item_def: RELEASE_EVENT_REPORT '=' notify_bilevel  */
+#line 967 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->release_events         = (yyvsp[0].tok); }
+#line 3732 "mdlparse.c"
     break;
 
-  case 147:
-#line 959 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->file_writes            = (yyvsp[0].tok); }
-#line 3621 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 148: /* notification_item_def: FILE_OUTPUT_REPORT '=' notify_bilevel  */
+#line 968 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->file_writes            = (yyvsp[0].tok); }
+#line 3738 "mdlparse.c"
     break;
 
-  case 148:
-#line 960 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->final_summary          = (yyvsp[0].tok); }
-#line 3627 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 149: /* notification_item_def: FINAL_SUMMARY '=' notify_bilevel  */
+#line 969 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->final_summary          = (yyvsp[0].tok); }
+#line 3744 "mdlparse.c"
     break;
 
-  case 149:
-#line 961 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->throughput_report      = (yyvsp[0].tok); }
-#line 3633 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 150: /* notification_item_def: THROUGHPUT_REPORT '=' notify_bilevel  */
+#line 970 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->throughput_report      = (yyvsp[0].tok); }
+#line 3750 "mdlparse.c"
     break;
 
-  case 150:
-#line 962 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->reaction_output_report = (yyvsp[0].tok); }
-#line 3639 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 151: /* notification_item_def: REACTION_OUTPUT_REPORT '=' notify_level  */
+#line 971 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->reaction_output_report = (yyvsp[0].tok); }
+#line 3756 "mdlparse.c"
     break;
 
-  case 151:
-#line 963 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->volume_output_report   = (yyvsp[0].tok); }
-#line 3645 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 152: /* notification_item_def: VOLUME_OUTPUT_REPORT '=' notify_level  */
+#line 972 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->volume_output_report   = (yyvsp[0].tok); }
+#line 3762 "mdlparse.c"
     break;
 
-  case 152:
-#line 964 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->viz_output_report      = (yyvsp[0].tok); }
-#line 3651 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 153: /* notification_item_def: VIZ_OUTPUT_REPORT '=' notify_level  */
+#line 973 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->viz_output_report      = (yyvsp[0].tok); }
+#line 3768 "mdlparse.c"
     break;
 
-  case 153:
-#line 965 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->checkpoint_report      = (yyvsp[0].tok); }
-#line 3657 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 154: /* notification_item_def: CHECKPOINT_REPORT '=' notify_bilevel  */
+#line 974 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->checkpoint_report      = (yyvsp[0].tok); }
+#line 3774 "mdlparse.c"
     break;
 
-  case 154:
-#line 966 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 155: /* notification_item_def: ITERATION_REPORT '=' notify_bilevel  */
+#line 975 "../src/mdlparse.y"
+                                                      {
                                                           if (!parse_state->vol->quiet_flag && parse_state->vol->log_freq == ULONG_MAX)
                                                             parse_state->vol->notify->iteration_report = (yyvsp[0].tok);
                                                       }
-#line 3666 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 3783 "mdlparse.c"
     break;
 
-  case 155:
-#line 970 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) CHECK(mdl_set_iteration_report_freq(parse_state, (long long) (yyvsp[0].dbl))); }
-#line 3672 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 156: /* notification_item_def: ITERATION_REPORT '=' num_expr  */
+#line 979 "../src/mdlparse.y"
+                                                      { if (!parse_state->vol->quiet_flag) CHECK(mdl_set_iteration_report_freq(parse_state, (long long) (yyvsp[0].dbl))); }
+#line 3789 "mdlparse.c"
     break;
 
-  case 156:
-#line 971 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->molecule_collision_report    = (yyvsp[0].tok); }
-#line 3678 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 157: /* notification_item_def: MOLECULE_COLLISION_REPORT '=' notify_bilevel  */
+#line 980 "../src/mdlparse.y"
+                                                        { if (!parse_state->vol->quiet_flag) parse_state->vol->notify->molecule_collision_report    = (yyvsp[0].tok); }
+#line 3795 "mdlparse.c"
     break;
 
-  case 157:
-#line 975 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = ((yyvsp[0].tok) ? NOTIFY_FULL : NOTIFY_NONE); }
-#line 3684 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 158: /* notify_bilevel: boolean  */
+#line 984 "../src/mdlparse.y"
+                                                      { (yyval.tok) = ((yyvsp[0].tok) ? NOTIFY_FULL : NOTIFY_NONE); }
+#line 3801 "mdlparse.c"
     break;
 
-  case 158:
-#line 979 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = ((yyvsp[0].tok) ? NOTIFY_FULL : NOTIFY_NONE); }
-#line 3690 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 159: /* notify_level: boolean  */
+#line 988 "../src/mdlparse.y"
+                                                      { (yyval.tok) = ((yyvsp[0].tok) ? NOTIFY_FULL : NOTIFY_NONE); }
+#line 3807 "mdlparse.c"
     break;
 
-  case 159:
-#line 980 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = NOTIFY_BRIEF; }
-#line 3696 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 160: /* notify_level: BRIEF  */
+#line 989 "../src/mdlparse.y"
+                                                      { (yyval.tok) = NOTIFY_BRIEF; }
+#line 3813 "mdlparse.c"
     break;
 
-  case 163:
-#line 996 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_set_all_warnings(parse_state->vol, (byte) (yyvsp[0].tok)); }
-#line 3702 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 164: /* warning_item_def: ALL_WARNINGS '=' warning_level  */
+#line 1005 "../src/mdlparse.y"
+                                                      { mdl_set_all_warnings(parse_state->vol, (byte) (yyvsp[0].tok)); }
+#line 3819 "mdlparse.c"
     break;
 
-  case 164:
-#line 997 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->neg_diffusion = (byte)(yyvsp[0].tok); }
-#line 3708 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 165: /* warning_item_def: NEGATIVE_DIFFUSION_CONSTANT '=' warning_level  */
+#line 1006 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->neg_diffusion = (byte)(yyvsp[0].tok); }
+#line 3825 "mdlparse.c"
     break;
 
-  case 165:
-#line 998 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->neg_reaction = (byte)(yyvsp[0].tok); }
-#line 3714 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 166: /* warning_item_def: NEGATIVE_REACTION_RATE '=' warning_level  */
+#line 1007 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->neg_reaction = (byte)(yyvsp[0].tok); }
+#line 3831 "mdlparse.c"
     break;
 
-  case 166:
-#line 999 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->high_reaction_prob = (byte)(yyvsp[0].tok); }
-#line 3720 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 167: /* warning_item_def: HIGH_REACTION_PROBABILITY '=' warning_level  */
+#line 1008 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->high_reaction_prob = (byte)(yyvsp[0].tok); }
+#line 3837 "mdlparse.c"
     break;
 
-  case 167:
-#line 1000 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->reaction_prob_warn = (yyvsp[0].dbl); }
-#line 3726 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 168: /* warning_item_def: HIGH_PROBABILITY_THRESHOLD '=' num_expr  */
+#line 1009 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->reaction_prob_warn = (yyvsp[0].dbl); }
+#line 3843 "mdlparse.c"
     break;
 
-  case 168:
-#line 1001 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->close_partitions = (byte)(yyvsp[0].tok); }
-#line 3732 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 169: /* warning_item_def: CLOSE_PARTITION_SPACING '=' warning_level  */
+#line 1010 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->close_partitions = (byte)(yyvsp[0].tok); }
+#line 3849 "mdlparse.c"
     break;
 
-  case 169:
-#line 1002 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->degenerate_polys = (byte)(yyvsp[0].tok); }
-#line 3738 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 170: /* warning_item_def: DEGENERATE_POLYGONS '=' warning_level  */
+#line 1011 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->degenerate_polys = (byte)(yyvsp[0].tok); }
+#line 3855 "mdlparse.c"
     break;
 
-  case 170:
-#line 1003 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->overwritten_file = (byte)(yyvsp[0].tok); }
-#line 3744 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 171: /* warning_item_def: OVERWRITTEN_OUTPUT_FILE '=' warning_level  */
+#line 1012 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->overwritten_file = (byte)(yyvsp[0].tok); }
+#line 3861 "mdlparse.c"
     break;
 
-  case 171:
-#line 1004 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->short_lifetime = (byte)(yyvsp[0].tok); }
-#line 3750 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 172: /* warning_item_def: LIFETIME_TOO_SHORT '=' warning_level  */
+#line 1013 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->short_lifetime = (byte)(yyvsp[0].tok); }
+#line 3867 "mdlparse.c"
     break;
 
-  case 172:
-#line 1005 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_lifetime_warning_threshold(parse_state, (long long) (yyvsp[0].dbl))); }
-#line 3756 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 173: /* warning_item_def: LIFETIME_THRESHOLD '=' num_expr  */
+#line 1014 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_lifetime_warning_threshold(parse_state, (long long) (yyvsp[0].dbl))); }
+#line 3873 "mdlparse.c"
     break;
 
-  case 173:
-#line 1006 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->missed_reactions = (byte)(yyvsp[0].tok); }
-#line 3762 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 174: /* warning_item_def: MISSED_REACTIONS '=' warning_level  */
+#line 1015 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->missed_reactions = (byte)(yyvsp[0].tok); }
+#line 3879 "mdlparse.c"
     break;
 
-  case 174:
-#line 1007 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_missed_reaction_warning_threshold(parse_state, (yyvsp[0].dbl))); }
-#line 3768 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 175: /* warning_item_def: MISSED_REACTION_THRESHOLD '=' num_expr  */
+#line 1016 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_missed_reaction_warning_threshold(parse_state, (yyvsp[0].dbl))); }
+#line 3885 "mdlparse.c"
     break;
 
-  case 175:
-#line 1008 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->missed_surf_orient = (byte)(yyvsp[0].tok); }
-#line 3774 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 176: /* warning_item_def: MISSING_SURFACE_ORIENTATION '=' warning_level  */
+#line 1017 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->missed_surf_orient = (byte)(yyvsp[0].tok); }
+#line 3891 "mdlparse.c"
     break;
 
-  case 176:
-#line 1009 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->useless_vol_orient = (byte)(yyvsp[0].tok); }
-#line 3780 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 177: /* warning_item_def: USELESS_VOLUME_ORIENTATION '=' warning_level  */
+#line 1018 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->useless_vol_orient = (byte)(yyvsp[0].tok); }
+#line 3897 "mdlparse.c"
     break;
 
-  case 177:
-#line 1010 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->mol_placement_failure = (byte) (yyvsp[0].tok); }
-#line 3786 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 178: /* warning_item_def: MOLECULE_PLACEMENT_FAILURE '=' warning_level  */
+#line 1019 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->mol_placement_failure = (byte) (yyvsp[0].tok); }
+#line 3903 "mdlparse.c"
     break;
 
-  case 178:
-#line 1011 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->invalid_output_step_time = (byte) (yyvsp[0].tok); }
-#line 3792 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 179: /* warning_item_def: INVALID_OUTPUT_STEP_TIME '=' warning_level  */
+#line 1020 "../src/mdlparse.y"
+                                                      { parse_state->vol->notify->invalid_output_step_time = (byte) (yyvsp[0].tok); }
+#line 3909 "mdlparse.c"
     break;
 
-  case 179:
-#line 1012 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->large_molecular_displacement = (byte) (yyvsp[0].tok); }
-#line 3798 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 180: /* warning_item_def: LARGE_MOLECULAR_DISPLACEMENT '=' warning_level  */
+#line 1021 "../src/mdlparse.y"
+                                                       { parse_state->vol->notify->large_molecular_displacement = (byte) (yyvsp[0].tok); }
+#line 3915 "mdlparse.c"
     break;
 
-  case 180:
-#line 1013 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->notify->add_remove_mesh_warning = (byte) (yyvsp[0].tok); }
-#line 3804 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 181: /* warning_item_def: ADD_REMOVE_MESH '=' warning_level  */
+#line 1022 "../src/mdlparse.y"
+                                          { parse_state->vol->notify->add_remove_mesh_warning = (byte) (yyvsp[0].tok); }
+#line 3921 "mdlparse.c"
     break;
 
-  case 181:
-#line 1017 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = WARN_COPE;  }
-#line 3810 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 182: /* warning_level: IGNORED  */
+#line 1026 "../src/mdlparse.y"
+                                                      { (yyval.tok) = WARN_COPE;  }
+#line 3927 "mdlparse.c"
     break;
 
-  case 182:
-#line 1018 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = WARN_WARN;  }
-#line 3816 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 183: /* warning_level: WARNING  */
+#line 1027 "../src/mdlparse.y"
+                                                      { (yyval.tok) = WARN_WARN;  }
+#line 3933 "mdlparse.c"
     break;
 
-  case 183:
-#line 1019 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = WARN_ERROR; }
-#line 3822 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 184: /* warning_level: ERROR  */
+#line 1028 "../src/mdlparse.y"
+                                                      { (yyval.tok) = WARN_ERROR; }
+#line 3939 "mdlparse.c"
     break;
 
-  case 184:
-#line 1025 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_checkpoint_infile(parse_state, (yyvsp[0].str))); }
-#line 3828 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 185: /* chkpt_stmt: CHECKPOINT_INFILE '=' file_name  */
+#line 1034 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_checkpoint_infile(parse_state, (yyvsp[0].str))); }
+#line 3945 "mdlparse.c"
     break;
 
-  case 185:
-#line 1026 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_checkpoint_outfile(parse_state, (yyvsp[0].str))); }
-#line 3834 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 186: /* chkpt_stmt: CHECKPOINT_OUTFILE '=' file_name  */
+#line 1035 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_checkpoint_outfile(parse_state, (yyvsp[0].str))); }
+#line 3951 "mdlparse.c"
     break;
 
-  case 186:
-#line 1027 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_checkpoint_interval(parse_state, (yyvsp[-1].dbl), (yyvsp[0].tok))); }
-#line 3840 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 187: /* chkpt_stmt: CHECKPOINT_ITERATIONS '=' num_expr exit_or_no  */
+#line 1036 "../src/mdlparse.y"
+                                                        { CHECK(mdl_set_checkpoint_interval(parse_state, (yyvsp[-1].dbl), (yyvsp[0].tok))); }
+#line 3957 "mdlparse.c"
     break;
 
-  case 187:
-#line 1028 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_keep_checkpoint_files(parse_state, (yyvsp[0].tok))); }
-#line 3846 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 188: /* chkpt_stmt: KEEP_CHECKPOINT_FILES '=' boolean  */
+#line 1037 "../src/mdlparse.y"
+                                                      { CHECK(mdl_keep_checkpoint_files(parse_state, (yyvsp[0].tok))); }
+#line 3963 "mdlparse.c"
     break;
 
-  case 188:
-#line 1030 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_realtime_checkpoint(parse_state, (long) (yyvsp[-1].dbl), (yyvsp[0].tok))); }
-#line 3852 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 189: /* chkpt_stmt: CHECKPOINT_REALTIME '=' time_expr exit_or_no  */
+#line 1039 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_realtime_checkpoint(parse_state, (long) (yyvsp[-1].dbl), (yyvsp[0].tok))); }
+#line 3969 "mdlparse.c"
     break;
 
-  case 189:
-#line 1033 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 3858 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 190: /* exit_or_no: %empty  */
+#line 1042 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 0; }
+#line 3975 "mdlparse.c"
     break;
 
-  case 190:
-#line 1034 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 1; }
-#line 3864 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 191: /* exit_or_no: NOEXIT  */
+#line 1043 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 1; }
+#line 3981 "mdlparse.c"
     break;
 
-  case 191:
-#line 1035 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 3870 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 192: /* exit_or_no: EXIT  */
+#line 1044 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 0; }
+#line 3987 "mdlparse.c"
     break;
 
-  case 192:
-#line 1039 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { /* seconds */     (yyval.dbl) = (yyvsp[0].dbl); }
-#line 3876 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 193: /* time_expr: num_expr  */
+#line 1048 "../src/mdlparse.y"
+                                                      { /* seconds */     (yyval.dbl) = (yyvsp[0].dbl); }
+#line 3993 "mdlparse.c"
     break;
 
-  case 193:
-#line 1040 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { /* mm:ss */       (yyval.dbl) = (yyvsp[-2].dbl) * 60 + (yyvsp[0].dbl); }
-#line 3882 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 194: /* time_expr: num_expr ':' num_expr  */
+#line 1049 "../src/mdlparse.y"
+                                                      { /* mm:ss */       (yyval.dbl) = (yyvsp[-2].dbl) * 60 + (yyvsp[0].dbl); }
+#line 3999 "mdlparse.c"
     break;
 
-  case 194:
-#line 1041 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { /* hh:mm:ss */    (yyval.dbl) = (yyvsp[-4].dbl) * 3600 + (yyvsp[-2].dbl) * 60 + (yyvsp[0].dbl); }
-#line 3888 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 195: /* time_expr: num_expr ':' num_expr ':' num_expr  */
+#line 1050 "../src/mdlparse.y"
+                                                      { /* hh:mm:ss */    (yyval.dbl) = (yyvsp[-4].dbl) * 3600 + (yyvsp[-2].dbl) * 60 + (yyvsp[0].dbl); }
+#line 4005 "mdlparse.c"
     break;
 
-  case 195:
-#line 1043 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { /* dd:hh:mm:ss */ (yyval.dbl) = (yyvsp[-6].dbl) * 86400 + (yyvsp[-4].dbl) * 3600 + (yyvsp[-2].dbl) * 60 + (yyvsp[0].dbl); }
-#line 3894 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 196: /* time_expr: num_expr ':' num_expr ':' num_expr ':' num_expr  */
+#line 1052 "../src/mdlparse.y"
+                                                      { /* dd:hh:mm:ss */ (yyval.dbl) = (yyvsp[-6].dbl) * 86400 + (yyvsp[-4].dbl) * 3600 + (yyvsp[-2].dbl) * 60 + (yyvsp[0].dbl); }
+#line 4011 "mdlparse.c"
     break;
 
-  case 196:
-#line 1050 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_time_step(parse_state, (yyvsp[0].dbl))); }
-#line 3900 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 197: /* parameter_def: TIME_STEP '=' num_expr  */
+#line 1059 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_time_step(parse_state, (yyvsp[0].dbl))); }
+#line 4017 "mdlparse.c"
     break;
 
-  case 197:
-#line 1051 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_space_step(parse_state, (yyvsp[0].dbl))); }
-#line 3906 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 198: /* parameter_def: SPACE_STEP '=' num_expr  */
+#line 1060 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_space_step(parse_state, (yyvsp[0].dbl))); }
+#line 4023 "mdlparse.c"
     break;
 
-  case 198:
-#line 1052 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_max_time_step(parse_state, (yyvsp[0].dbl))); }
-#line 3912 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 199: /* parameter_def: TIME_STEP_MAX '=' num_expr  */
+#line 1061 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_max_time_step(parse_state, (yyvsp[0].dbl))); }
+#line 4029 "mdlparse.c"
     break;
 
-  case 199:
-#line 1053 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_num_iterations(parse_state, (long long) (yyvsp[0].dbl))); }
-#line 3918 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 200: /* parameter_def: ITERATIONS '=' num_expr  */
+#line 1062 "../src/mdlparse.y"
+                                  { CHECK(mdl_set_num_iterations(parse_state, (long long) (yyvsp[0].dbl))); }
+#line 4035 "mdlparse.c"
     break;
 
-  case 200:
-#line 1054 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->randomize_smol_pos = !((yyvsp[0].tok)); }
-#line 3924 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 201: /* parameter_def: CENTER_MOLECULES_ON_GRID '=' boolean  */
+#line 1063 "../src/mdlparse.y"
+                                                      { parse_state->vol->randomize_smol_pos = !((yyvsp[0].tok)); }
+#line 4041 "mdlparse.c"
     break;
 
-  case 201:
-#line 1055 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->use_expanded_list = (yyvsp[0].tok); }
-#line 3930 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 202: /* parameter_def: ACCURATE_3D_REACTIONS '=' boolean  */
+#line 1064 "../src/mdlparse.y"
+                                                      { parse_state->vol->use_expanded_list = (yyvsp[0].tok); }
+#line 4047 "mdlparse.c"
     break;
 
-  case 202:
-#line 1056 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->vacancy_search_dist2 = max2d((yyvsp[0].dbl), 0.0); }
-#line 3936 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 203: /* parameter_def: VACANCY_SEARCH_DISTANCE '=' num_expr  */
+#line 1065 "../src/mdlparse.y"
+                                                      { parse_state->vol->vacancy_search_dist2 = max2d((yyvsp[0].dbl), 0.0); }
+#line 4053 "mdlparse.c"
     break;
 
-  case 203:
-#line 1057 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_num_radial_directions(parse_state, (int) (yyvsp[0].dbl))); }
-#line 3942 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 204: /* parameter_def: RADIAL_DIRECTIONS '=' num_expr  */
+#line 1066 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_num_radial_directions(parse_state, (int) (yyvsp[0].dbl))); }
+#line 4059 "mdlparse.c"
     break;
 
-  case 204:
-#line 1058 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->fully_random = 1; }
-#line 3948 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 205: /* parameter_def: RADIAL_DIRECTIONS '=' FULLY_RANDOM  */
+#line 1067 "../src/mdlparse.y"
+                                                      { parse_state->vol->fully_random = 1; }
+#line 4065 "mdlparse.c"
     break;
 
-  case 205:
-#line 1059 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_num_radial_subdivisions(parse_state, (int) (yyvsp[0].dbl))); }
-#line 3954 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 206: /* parameter_def: RADIAL_SUBDIVISIONS '=' num_expr  */
+#line 1068 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_num_radial_subdivisions(parse_state, (int) (yyvsp[0].dbl))); }
+#line 4071 "mdlparse.c"
     break;
 
-  case 206:
-#line 1060 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_grid_density(parse_state, (yyvsp[0].dbl))); }
-#line 3960 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 207: /* parameter_def: EFFECTOR_GRID_DENSITY '=' num_expr  */
+#line 1069 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_grid_density(parse_state, (yyvsp[0].dbl))); }
+#line 4077 "mdlparse.c"
     break;
 
-  case 207:
-#line 1061 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_interaction_radius(parse_state, (yyvsp[0].dbl))); }
-#line 3966 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 208: /* parameter_def: INTERACTION_RADIUS '=' num_expr  */
+#line 1070 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_interaction_radius(parse_state, (yyvsp[0].dbl))); }
+#line 4083 "mdlparse.c"
     break;
 
-  case 208:
-#line 1062 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->surface_reversibility=(yyvsp[0].tok); parse_state->vol->volume_reversibility=(yyvsp[0].tok); }
-#line 3972 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 209: /* parameter_def: MICROSCOPIC_REVERSIBILITY '=' boolean  */
+#line 1071 "../src/mdlparse.y"
+                                                      { parse_state->vol->surface_reversibility=(yyvsp[0].tok); parse_state->vol->volume_reversibility=(yyvsp[0].tok); }
+#line 4089 "mdlparse.c"
     break;
 
-  case 209:
-#line 1063 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->surface_reversibility=1;  parse_state->vol->volume_reversibility=0;  }
-#line 3978 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 210: /* parameter_def: MICROSCOPIC_REVERSIBILITY '=' SURFACE_ONLY  */
+#line 1072 "../src/mdlparse.y"
+                                                      { parse_state->vol->surface_reversibility=1;  parse_state->vol->volume_reversibility=0;  }
+#line 4095 "mdlparse.c"
     break;
 
-  case 210:
-#line 1064 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->surface_reversibility=0;  parse_state->vol->volume_reversibility=1;  }
-#line 3984 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 211: /* parameter_def: MICROSCOPIC_REVERSIBILITY '=' VOLUME_ONLY  */
+#line 1073 "../src/mdlparse.y"
+                                                      { parse_state->vol->surface_reversibility=0;  parse_state->vol->volume_reversibility=1;  }
+#line 4101 "mdlparse.c"
     break;
 
-  case 211:
-#line 1065 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mcell_add_dynamic_geometry_file((yyvsp[0].str), parse_state)); }
-#line 3990 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 212: /* parameter_def: DYNAMIC_GEOMETRY '=' str_expr_only  */
+#line 1074 "../src/mdlparse.y"
+                                                      { CHECK(mcell_add_dynamic_geometry_file((yyvsp[0].str), parse_state)); }
+#line 4107 "mdlparse.c"
     break;
 
-  case 212:
-#line 1066 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->dynamic_geometry_molecule_placement = 0; }
-#line 3996 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 213: /* parameter_def: DYNAMIC_GEOMETRY_MOLECULE_PLACEMENT '=' NEAREST_POINT  */
+#line 1075 "../src/mdlparse.y"
+                                                                   { parse_state->vol->dynamic_geometry_molecule_placement = 0; }
+#line 4113 "mdlparse.c"
     break;
 
-  case 213:
-#line 1067 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->dynamic_geometry_molecule_placement = 1; }
-#line 4002 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 214: /* parameter_def: DYNAMIC_GEOMETRY_MOLECULE_PLACEMENT '=' NEAREST_TRIANGLE  */
+#line 1076 "../src/mdlparse.y"
+                                                                   { parse_state->vol->dynamic_geometry_molecule_placement = 1; }
+#line 4119 "mdlparse.c"
     break;
 
-  case 214:
-#line 1074 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->mem_part_x = (int) (yyvsp[0].dbl); }
-#line 4008 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 215: /* memory_partition_def: MEMORY_PARTITION_X '=' num_expr  */
+#line 1083 "../src/mdlparse.y"
+                                                      { parse_state->vol->mem_part_x = (int) (yyvsp[0].dbl); }
+#line 4125 "mdlparse.c"
     break;
 
-  case 215:
-#line 1075 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->mem_part_y = (int) (yyvsp[0].dbl); }
-#line 4014 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 216: /* memory_partition_def: MEMORY_PARTITION_Y '=' num_expr  */
+#line 1084 "../src/mdlparse.y"
+                                                      { parse_state->vol->mem_part_y = (int) (yyvsp[0].dbl); }
+#line 4131 "mdlparse.c"
     break;
 
-  case 216:
-#line 1076 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->mem_part_z = (int) (yyvsp[0].dbl); }
-#line 4020 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 217: /* memory_partition_def: MEMORY_PARTITION_Z '=' num_expr  */
+#line 1085 "../src/mdlparse.y"
+                                                      { parse_state->vol->mem_part_z = (int) (yyvsp[0].dbl); }
+#line 4137 "mdlparse.c"
     break;
 
-  case 217:
-#line 1077 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->mem_part_pool = (int) (yyvsp[0].dbl); }
-#line 4026 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 218: /* memory_partition_def: MEMORY_PARTITION_POOL '=' num_expr  */
+#line 1086 "../src/mdlparse.y"
+                                                      { parse_state->vol->mem_part_pool = (int) (yyvsp[0].dbl); }
+#line 4143 "mdlparse.c"
     break;
 
-  case 218:
-#line 1081 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mcell_set_partition(parse_state->vol, (yyvsp[-2].tok), & (yyvsp[0].nlist))); }
-#line 4032 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 219: /* partition_def: partition_dimension '=' array_value  */
+#line 1090 "../src/mdlparse.y"
+                                                      { CHECK(mcell_set_partition(parse_state->vol, (yyvsp[-2].tok), & (yyvsp[0].nlist))); }
+#line 4149 "mdlparse.c"
     break;
 
-  case 219:
-#line 1085 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = X_PARTS; }
-#line 4038 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 220: /* partition_dimension: PARTITION_X  */
+#line 1094 "../src/mdlparse.y"
+                                                      { (yyval.tok) = X_PARTS; }
+#line 4155 "mdlparse.c"
     break;
 
-  case 220:
-#line 1086 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = Y_PARTS; }
-#line 4044 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 221: /* partition_dimension: PARTITION_Y  */
+#line 1095 "../src/mdlparse.y"
+                                                      { (yyval.tok) = Y_PARTS; }
+#line 4161 "mdlparse.c"
     break;
 
-  case 221:
-#line 1087 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = Z_PARTS; }
-#line 4050 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 222: /* partition_dimension: PARTITION_Z  */
+#line 1096 "../src/mdlparse.y"
+                                                      { (yyval.tok) = Z_PARTS; }
+#line 4167 "mdlparse.c"
     break;
 
-  case 224:
-#line 1098 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_print_species_summary(parse_state->vol, (yyvsp[0].mcell_mol_spec)); }
-#line 4056 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 225: /* define_one_molecule: DEFINE_MOLECULE molecule_stmt  */
+#line 1107 "../src/mdlparse.y"
+                                                      { mdl_print_species_summary(parse_state->vol, (yyvsp[0].mcell_mol_spec)); }
+#line 4173 "mdlparse.c"
     break;
 
-  case 225:
-#line 1102 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_print_species_summaries(parse_state->vol, (yyvsp[-1].mcell_species_lst).species_head); }
-#line 4062 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 226: /* define_multiple_molecules: DEFINE_MOLECULES '{' list_molecule_stmts '}'  */
+#line 1111 "../src/mdlparse.y"
+                                                      { mdl_print_species_summaries(parse_state->vol, (yyvsp[-1].mcell_species_lst).species_head); }
+#line 4179 "mdlparse.c"
     break;
 
-  case 226:
-#line 1106 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mcell_species_lst).species_count = 0; CHECK(mdl_add_to_species_list(&(yyval.mcell_species_lst), (yyvsp[0].mcell_mol_spec))); }
-#line 4068 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 227: /* list_molecule_stmts: molecule_stmt  */
+#line 1115 "../src/mdlparse.y"
+                                                      { (yyval.mcell_species_lst).species_count = 0; CHECK(mdl_add_to_species_list(&(yyval.mcell_species_lst), (yyvsp[0].mcell_mol_spec))); }
+#line 4185 "mdlparse.c"
     break;
 
-  case 227:
-#line 1107 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mcell_species_lst) = (yyvsp[-1].mcell_species_lst); CHECK(mdl_add_to_species_list(&(yyval.mcell_species_lst), (yyvsp[0].mcell_mol_spec))); }
-#line 4074 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 228: /* list_molecule_stmts: list_molecule_stmts molecule_stmt  */
+#line 1116 "../src/mdlparse.y"
+                                                      { (yyval.mcell_species_lst) = (yyvsp[-1].mcell_species_lst); CHECK(mdl_add_to_species_list(&(yyval.mcell_species_lst), (yyvsp[0].mcell_mol_spec))); }
+#line 4191 "mdlparse.c"
     break;
 
-  case 228:
-#line 1117 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.mcell_mol_spec) = mdl_create_species(parse_state, (yyvsp[-7].str), (yyvsp[-5].diff_const).D, (yyvsp[-5].diff_const).is_2d, (yyvsp[-4].dbl), (yyvsp[-3].ival), (yyvsp[-2].dbl), (yyvsp[-1].ival) )); }
-#line 4080 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 229: /* molecule_stmt: molecule_name '{' diffusion_def mol_timestep_def target_def maximum_step_length_def extern_def '}'  */
+#line 1126 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.mcell_mol_spec) = mdl_create_species(parse_state, (yyvsp[-7].str), (yyvsp[-5].diff_const).D, (yyvsp[-5].diff_const).is_2d, (yyvsp[-4].dbl), (yyvsp[-3].ival), (yyvsp[-2].dbl), (yyvsp[-1].ival) )); }
+#line 4197 "mdlparse.c"
     break;
 
-  case 230:
-#line 1123 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_new_mol_species(parse_state, (yyvsp[0].str))); }
-#line 4086 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 231: /* new_molecule: var  */
+#line 1132 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_new_mol_species(parse_state, (yyvsp[0].str))); }
+#line 4203 "mdlparse.c"
     break;
 
-  case 231:
-#line 1127 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.diff_const).is_2d = 0; (yyval.diff_const).D = (yyvsp[0].dbl); CHECK(mdl_check_diffusion_constant(parse_state, & (yyval.diff_const).D)); }
-#line 4092 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 232: /* diffusion_def: DIFFUSION_CONSTANT_3D '=' num_expr  */
+#line 1136 "../src/mdlparse.y"
+                                                      { (yyval.diff_const).is_2d = 0; (yyval.diff_const).D = (yyvsp[0].dbl); CHECK(mdl_check_diffusion_constant(parse_state, & (yyval.diff_const).D)); }
+#line 4209 "mdlparse.c"
     break;
 
-  case 232:
-#line 1128 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.diff_const).is_2d = 1; (yyval.diff_const).D = (yyvsp[0].dbl); CHECK(mdl_check_diffusion_constant(parse_state, & (yyval.diff_const).D)); }
-#line 4098 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 233: /* diffusion_def: DIFFUSION_CONSTANT_2D '=' num_expr  */
+#line 1137 "../src/mdlparse.y"
+                                                      { (yyval.diff_const).is_2d = 1; (yyval.diff_const).D = (yyvsp[0].dbl); CHECK(mdl_check_diffusion_constant(parse_state, & (yyval.diff_const).D)); }
+#line 4215 "mdlparse.c"
     break;
 
-  case 233:
-#line 1132 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = 0.0; }
-#line 4104 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 234: /* mol_timestep_def: %empty  */
+#line 1141 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = 0.0; }
+#line 4221 "mdlparse.c"
     break;
 
-  case 234:
-#line 1133 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 235: /* mol_timestep_def: CUSTOM_TIME_STEP '=' num_expr  */
+#line 1142 "../src/mdlparse.y"
+                                                      {
                                                           if ((yyvsp[0].dbl) <= 0)
                                                           {
                                                             mdlerror_fmt(parse_state, "Requested custom time step of %.15g; custom time step must be positive.", (yyvsp[0].dbl));
@@ -4114,12 +4231,12 @@ yyreduce:
 
                                                           (yyval.dbl) = (yyvsp[0].dbl);
                                                       }
-#line 4118 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4235 "mdlparse.c"
     break;
 
-  case 235:
-#line 1142 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 236: /* mol_timestep_def: CUSTOM_SPACE_STEP '=' num_expr  */
+#line 1151 "../src/mdlparse.y"
+                                                      {
                                                           if ((yyvsp[0].dbl) <= 0)
                                                           {
                                                             mdlerror_fmt(parse_state, "Requested custom space step of %.15g; custom space step must be positive.", (yyvsp[0].dbl));
@@ -4128,30 +4245,30 @@ yyreduce:
 
                                                           (yyval.dbl) = -(yyvsp[0].dbl);
                                                       }
-#line 4132 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4249 "mdlparse.c"
     break;
 
-  case 236:
-#line 1153 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ival) = 0; }
-#line 4138 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 237: /* target_def: %empty  */
+#line 1162 "../src/mdlparse.y"
+                                                      { (yyval.ival) = 0; }
+#line 4255 "mdlparse.c"
     break;
 
-  case 237:
-#line 1154 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ival) = 1; }
-#line 4144 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 238: /* target_def: TARGET_ONLY  */
+#line 1163 "../src/mdlparse.y"
+                                                      { (yyval.ival) = 1; }
+#line 4261 "mdlparse.c"
     break;
 
-  case 238:
-#line 1158 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = 0; }
-#line 4150 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 239: /* maximum_step_length_def: %empty  */
+#line 1167 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = 0; }
+#line 4267 "mdlparse.c"
     break;
 
-  case 239:
-#line 1159 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 240: /* maximum_step_length_def: MAXIMUM_STEP_LENGTH '=' num_expr  */
+#line 1168 "../src/mdlparse.y"
+                                                      {
                                                         if ((yyvsp[0].dbl) <= 0)
                                                         {
                                                           mdlerror_fmt(parse_state, "Requested maximum step length of %.15g; maximum step length must be positive.", (yyvsp[0].dbl));
@@ -4159,256 +4276,300 @@ yyreduce:
                                                         }
                                                         (yyval.dbl) = (yyvsp[0].dbl);
                                                       }
-#line 4163 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4280 "mdlparse.c"
     break;
 
-  case 240:
-#line 1169 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {(yyval.ival) = 0;}
-#line 4169 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 241: /* extern_def: %empty  */
+#line 1178 "../src/mdlparse.y"
+            {(yyval.ival) = 0;}
+#line 4286 "mdlparse.c"
     break;
 
-  case 241:
-#line 1170 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {(yyval.ival) = 1;}
-#line 4175 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 242: /* extern_def: EXTERN  */
+#line 1179 "../src/mdlparse.y"
+                 {(yyval.ival) = 1;}
+#line 4292 "mdlparse.c"
     break;
 
-  case 242:
-#line 1173 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_molecule(parse_state, (yyvsp[0].str))); }
-#line 4181 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 243: /* existing_molecule: var  */
+#line 1182 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_molecule(parse_state, (yyvsp[0].str))); }
+#line 4298 "mdlparse.c"
     break;
 
-  case 243:
-#line 1177 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type) = (yyvsp[0].mol_type); CHECKN((yyval.mol_type).mol_type = mdl_existing_surface_molecule(parse_state, (yyvsp[-1].str))); }
-#line 4187 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 244: /* existing_surface_molecule: var orientation_class  */
+#line 1186 "../src/mdlparse.y"
+                                                      { (yyval.mol_type) = (yyvsp[0].mol_type); CHECKN((yyval.mol_type).mol_type = mdl_existing_surface_molecule(parse_state, (yyvsp[-1].str))); }
+#line 4304 "mdlparse.c"
     break;
 
-  case 244:
-#line 1181 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 245: /* existing_molecule_opt_orient: existing_molecule orientation_class  */
+#line 1190 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.mol_type) = (yyvsp[0].mol_type);
                                                         if (! (yyval.mol_type).orient_set)
                                                           (yyval.mol_type).orient = 0;
                                                         (yyval.mol_type).mol_type = (yyvsp[-1].sym);
                                                       }
-#line 4198 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4315 "mdlparse.c"
     break;
 
-  case 251:
-#line 1216 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_start_surface_class(parse_state, (yyvsp[-1].sym)); }
-#line 4204 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 250: /* $@1: %empty  */
+#line 1221 "../src/mdlparse.y"
+        {
+          parse_state->current_bngl_molecule = (yyvsp[0].sym);
+        }
+#line 4323 "mdlparse.c"
     break;
 
-  case 252:
-#line 1218 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_finish_surface_class(parse_state); }
-#line 4210 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 252: /* new_bngl_molecule_name: var  */
+#line 1228 "../src/mdlparse.y"
+                            { CHECKN((yyval.sym) = mdl_new_bngl_molecule(parse_state, (yyvsp[0].str))); }
+#line 4329 "mdlparse.c"
     break;
 
-  case 253:
-#line 1221 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_surface_class(parse_state, (yyvsp[0].str))); }
-#line 4216 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 255: /* $@2: %empty  */
+#line 1240 "../src/mdlparse.y"
+        {
+          parse_state->current_bngl_component = (yyvsp[0].mcomp_ss);
+        }
+#line 4337 "mdlparse.c"
     break;
 
-  case 258:
-#line 1238 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN(mdl_assemble_surface_reaction(parse_state, (yyvsp[-2].tok), parse_state->current_surface_class, (yyvsp[0].mol_type).mol_type, (yyvsp[0].mol_type).orient)); }
-#line 4222 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 257: /* bngl_component_name: var  */
+#line 1247 "../src/mdlparse.y"
+                         { CHECKN((yyval.mcomp_ss) = mdl_add_bngl_component(parse_state, parse_state->current_bngl_molecule, (yyvsp[0].str))); }
+#line 4343 "mdlparse.c"
     break;
 
-  case 259:
-#line 1241 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 261: /* bngl_component_structure_spec: %empty  */
+#line 1263 "../src/mdlparse.y"
+        {
+          mdl_set_bngl_component_layout(parse_state, parse_state->current_bngl_component, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+        }
+#line 4351 "mdlparse.c"
+    break;
+
+  case 262: /* bngl_component_structure_spec: '{' COMPONENT_LOCATION '=' '[' num_expr ',' num_expr ',' num_expr ']' ',' COMPONENT_ROTATION '=' '[' num_expr ',' num_expr ',' num_expr ',' num_expr ']' '}'  */
+#line 1272 "../src/mdlparse.y"
+        {
+          mdl_set_bngl_component_layout(parse_state, parse_state->current_bngl_component, (yyvsp[-18].dbl), (yyvsp[-16].dbl), (yyvsp[-14].dbl), (yyvsp[-8].dbl), (yyvsp[-6].dbl), (yyvsp[-4].dbl), (yyvsp[-2].dbl));
+        }
+#line 4359 "mdlparse.c"
+    break;
+
+  case 269: /* $@3: %empty  */
+#line 1304 "../src/mdlparse.y"
+                                                      { mdl_start_surface_class(parse_state, (yyvsp[-1].sym)); }
+#line 4365 "mdlparse.c"
+    break;
+
+  case 270: /* surface_class_stmt: new_molecule '{' $@3 list_surface_prop_stmts '}'  */
+#line 1306 "../src/mdlparse.y"
+                                                      { mdl_finish_surface_class(parse_state); }
+#line 4371 "mdlparse.c"
+    break;
+
+  case 271: /* existing_surface_class: var  */
+#line 1309 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_surface_class(parse_state, (yyvsp[0].str))); }
+#line 4377 "mdlparse.c"
+    break;
+
+  case 276: /* surface_rxn_stmt: surface_rxn_type equals_or_to existing_molecule_opt_orient  */
+#line 1326 "../src/mdlparse.y"
+                                                      { CHECKN(mdl_assemble_surface_reaction(parse_state, (yyvsp[-2].tok), parse_state->current_surface_class, (yyvsp[0].mol_type).mol_type, (yyvsp[0].mol_type).orient)); }
+#line 4383 "mdlparse.c"
+    break;
+
+  case 277: /* surface_rxn_stmt: surface_rxn_type equals_or_to ALL_MOLECULES orientation_class  */
+#line 1329 "../src/mdlparse.y"
+                                          {
               struct sym_entry *mol_sym = retrieve_sym("ALL_MOLECULES", parse_state->vol->mol_sym_table);
               if(!(yyvsp[0].mol_type).orient_set) (yyvsp[0].mol_type).orient = 0;
               CHECKN(mdl_assemble_surface_reaction(parse_state, (yyvsp[-3].tok), parse_state->current_surface_class, mol_sym, (yyvsp[0].mol_type).orient));}
-#line 4231 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4392 "mdlparse.c"
     break;
 
-  case 260:
-#line 1247 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN(mdl_assemble_concentration_clamp_reaction(parse_state, parse_state->current_surface_class, (yyvsp[-2].mol_type).mol_type, (yyvsp[-2].mol_type).orient, (yyvsp[0].dbl))); }
-#line 4237 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 278: /* surface_rxn_stmt: CLAMP_CONCENTRATION existing_molecule_opt_orient '=' num_expr  */
+#line 1335 "../src/mdlparse.y"
+                                                      { CHECKN(mdl_assemble_concentration_clamp_reaction(parse_state, parse_state->current_surface_class, (yyvsp[-2].mol_type).mol_type, (yyvsp[-2].mol_type).orient, (yyvsp[0].dbl))); }
+#line 4398 "mdlparse.c"
     break;
 
-  case 261:
-#line 1250 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = RFLCT; }
-#line 4243 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 279: /* surface_rxn_type: REFLECTIVE  */
+#line 1338 "../src/mdlparse.y"
+                                                      { (yyval.tok) = RFLCT; }
+#line 4404 "mdlparse.c"
     break;
 
-  case 262:
-#line 1251 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = TRANSP; }
-#line 4249 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 280: /* surface_rxn_type: TRANSPARENT  */
+#line 1339 "../src/mdlparse.y"
+                                                      { (yyval.tok) = TRANSP; }
+#line 4410 "mdlparse.c"
     break;
 
-  case 263:
-#line 1252 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = SINK; }
-#line 4255 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 281: /* surface_rxn_type: ABSORPTIVE  */
+#line 1340 "../src/mdlparse.y"
+                                                      { (yyval.tok) = SINK; }
+#line 4416 "mdlparse.c"
     break;
 
-  case 266:
-#line 1259 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_surface_class->sm_dat_head = (yyvsp[0].surf_mol_dat_list).sm_head; }
-#line 4261 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 284: /* surface_class_mol_stmt: surface_mol_stmt  */
+#line 1347 "../src/mdlparse.y"
+                                                      { parse_state->current_surface_class->sm_dat_head = (yyvsp[0].surf_mol_dat_list).sm_head; }
+#line 4422 "mdlparse.c"
     break;
 
-  case 267:
-#line 1266 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.surf_mol_dat_list) = (yyvsp[-1].surf_mol_dat_list); }
-#line 4267 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 285: /* surface_mol_stmt: MOLECULE_DENSITY '{' list_surface_mol_density '}'  */
+#line 1354 "../src/mdlparse.y"
+                                                      { (yyval.surf_mol_dat_list) = (yyvsp[-1].surf_mol_dat_list); }
+#line 4428 "mdlparse.c"
     break;
 
-  case 268:
-#line 1270 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.surf_mol_dat_list) = (yyvsp[-1].surf_mol_dat_list); }
-#line 4273 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 286: /* surface_mol_stmt: MOLECULE_NUMBER '{' list_surface_mol_num '}'  */
+#line 1358 "../src/mdlparse.y"
+                                                      { (yyval.surf_mol_dat_list) = (yyvsp[-1].surf_mol_dat_list); }
+#line 4434 "mdlparse.c"
     break;
 
-  case 269:
-#line 1274 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 287: /* list_surface_mol_density: surface_mol_quant  */
+#line 1362 "../src/mdlparse.y"
+                                                      {
                                                           (yyvsp[0].surf_mol_dat)->quantity_type = SURFMOLDENS;
                                                           (yyval.surf_mol_dat_list).sm_tail = (yyval.surf_mol_dat_list).sm_head = (yyvsp[0].surf_mol_dat);
                                                       }
-#line 4282 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4443 "mdlparse.c"
     break;
 
-  case 270:
-#line 1279 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 288: /* list_surface_mol_density: list_surface_mol_density surface_mol_quant  */
+#line 1367 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.surf_mol_dat_list) = (yyvsp[-1].surf_mol_dat_list);
                                                           (yyvsp[0].surf_mol_dat)->quantity_type = SURFMOLDENS;
                                                           (yyval.surf_mol_dat_list).sm_tail = (yyval.surf_mol_dat_list).sm_tail->next = (yyvsp[0].surf_mol_dat);
                                                       }
-#line 4292 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4453 "mdlparse.c"
     break;
 
-  case 271:
-#line 1287 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 289: /* list_surface_mol_num: surface_mol_quant  */
+#line 1375 "../src/mdlparse.y"
+                                                      {
                                                           (yyvsp[0].surf_mol_dat)->quantity_type = SURFMOLNUM;
                                                           (yyval.surf_mol_dat_list).sm_tail = (yyval.surf_mol_dat_list).sm_head = (yyvsp[0].surf_mol_dat);
                                                       }
-#line 4301 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4462 "mdlparse.c"
     break;
 
-  case 272:
-#line 1292 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 290: /* list_surface_mol_num: list_surface_mol_num surface_mol_quant  */
+#line 1380 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.surf_mol_dat_list) = (yyvsp[-1].surf_mol_dat_list);
                                                           (yyvsp[0].surf_mol_dat)->quantity_type = SURFMOLNUM;
                                                           (yyval.surf_mol_dat_list).sm_tail = (yyval.surf_mol_dat_list).sm_tail->next = (yyvsp[0].surf_mol_dat);
                                                       }
-#line 4311 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4472 "mdlparse.c"
     break;
 
-  case 273:
-#line 1300 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.surf_mol_dat) = mdl_new_surf_mol_data(parse_state, &(yyvsp[-2].mol_type), (yyvsp[0].dbl))); }
-#line 4317 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 291: /* surface_mol_quant: existing_surface_molecule '=' num_expr  */
+#line 1388 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.surf_mol_dat) = mdl_new_surf_mol_data(parse_state, &(yyvsp[-2].mol_type), (yyvsp[0].dbl))); }
+#line 4478 "mdlparse.c"
     break;
 
-  case 283:
-#line 1329 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.react_arrow).catalyst = (yyvsp[-1].mol_type); (yyval.react_arrow).flags = ARROW_CATALYTIC; }
-#line 4323 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 301: /* right_cat_arrow: list_dashes existing_molecule_opt_orient right_arrow  */
+#line 1417 "../src/mdlparse.y"
+                                                      { (yyval.react_arrow).catalyst = (yyvsp[-1].mol_type); (yyval.react_arrow).flags = ARROW_CATALYTIC; }
+#line 4484 "mdlparse.c"
     break;
 
-  case 284:
-#line 1334 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.react_arrow).catalyst = (yyvsp[-1].mol_type); (yyval.react_arrow).flags = ARROW_CATALYTIC | ARROW_BIDIRECTIONAL; }
-#line 4329 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 302: /* double_cat_arrow: left_arrow existing_molecule_opt_orient right_arrow  */
+#line 1422 "../src/mdlparse.y"
+                                                      { (yyval.react_arrow).catalyst = (yyvsp[-1].mol_type); (yyval.react_arrow).flags = ARROW_CATALYTIC | ARROW_BIDIRECTIONAL; }
+#line 4490 "mdlparse.c"
     break;
 
-  case 285:
-#line 1339 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.react_arrow).catalyst.mol_type = NULL; (yyval.react_arrow).flags = 0; }
-#line 4335 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 303: /* reaction_arrow: right_arrow  */
+#line 1427 "../src/mdlparse.y"
+                                                      { (yyval.react_arrow).catalyst.mol_type = NULL; (yyval.react_arrow).flags = 0; }
+#line 4496 "mdlparse.c"
     break;
 
-  case 287:
-#line 1341 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.react_arrow).catalyst.mol_type = NULL; (yyval.react_arrow).flags = ARROW_BIDIRECTIONAL; }
-#line 4341 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 305: /* reaction_arrow: double_arrow  */
+#line 1429 "../src/mdlparse.y"
+                                                      { (yyval.react_arrow).catalyst.mol_type = NULL; (yyval.react_arrow).flags = ARROW_BIDIRECTIONAL; }
+#line 4502 "mdlparse.c"
     break;
 
-  case 289:
-#line 1345 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.sym) = NULL; }
-#line 4347 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 307: /* new_rxn_pathname: %empty  */
+#line 1433 "../src/mdlparse.y"
+                                                      { (yyval.sym) = NULL; }
+#line 4508 "mdlparse.c"
     break;
 
-  case 290:
-#line 1346 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_new_rxn_pathname(parse_state, (yyvsp[0].str))); }
-#line 4353 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 308: /* new_rxn_pathname: ':' var  */
+#line 1434 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_new_rxn_pathname(parse_state, (yyvsp[0].str))); }
+#line 4514 "mdlparse.c"
     break;
 
-  case 291:
-#line 1352 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN(mdl_assemble_reaction(parse_state, (yyvsp[-5].mol_type_list).mol_type_head, &(yyvsp[-4].mol_type), &(yyvsp[-3].react_arrow), (yyvsp[-2].mol_type_list).mol_type_head, &(yyvsp[-1].react_rates), (yyvsp[0].sym))); }
-#line 4359 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 309: /* rxn: reactant_list opt_reactant_surface_class reaction_arrow product_list rx_rate_syntax new_rxn_pathname  */
+#line 1440 "../src/mdlparse.y"
+                                                      { CHECKN(mdl_assemble_reaction(parse_state, (yyvsp[-5].mol_type_list).mol_type_head, &(yyvsp[-4].mol_type), &(yyvsp[-3].react_arrow), (yyvsp[-2].mol_type_list).mol_type_head, &(yyvsp[-1].react_rates), (yyvsp[0].sym))); }
+#line 4520 "mdlparse.c"
     break;
 
-  case 292:
-#line 1355 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_reaction_player_singleton(parse_state, & (yyval.mol_type_list), & (yyvsp[0].mol_type))); }
-#line 4365 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 310: /* reactant_list: reactant  */
+#line 1443 "../src/mdlparse.y"
+                                                      { CHECK(mdl_reaction_player_singleton(parse_state, & (yyval.mol_type_list), & (yyvsp[0].mol_type))); }
+#line 4526 "mdlparse.c"
     break;
 
-  case 293:
-#line 1356 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type_list) = (yyvsp[-2].mol_type_list); CHECK(mdl_add_reaction_player(parse_state, & (yyval.mol_type_list), & (yyvsp[0].mol_type))); }
-#line 4371 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 311: /* reactant_list: reactant_list '+' reactant  */
+#line 1444 "../src/mdlparse.y"
+                                                      { (yyval.mol_type_list) = (yyvsp[-2].mol_type_list); CHECK(mdl_add_reaction_player(parse_state, & (yyval.mol_type_list), & (yyvsp[0].mol_type))); }
+#line 4532 "mdlparse.c"
     break;
 
-  case 295:
-#line 1363 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type).mol_type = NULL; }
-#line 4377 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 313: /* opt_reactant_surface_class: %empty  */
+#line 1451 "../src/mdlparse.y"
+                                                      { (yyval.mol_type).mol_type = NULL; }
+#line 4538 "mdlparse.c"
     break;
 
-  case 296:
-#line 1364 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type) = (yyvsp[0].mol_type); }
-#line 4383 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 314: /* opt_reactant_surface_class: '@' reactant_surface_class  */
+#line 1452 "../src/mdlparse.y"
+                                                      { (yyval.mol_type) = (yyvsp[0].mol_type); }
+#line 4544 "mdlparse.c"
     break;
 
-  case 297:
-#line 1368 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type) = (yyvsp[0].mol_type); (yyval.mol_type).mol_type = (yyvsp[-1].sym); }
-#line 4389 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 315: /* reactant_surface_class: existing_surface_class orientation_class  */
+#line 1456 "../src/mdlparse.y"
+                                                      { (yyval.mol_type) = (yyvsp[0].mol_type); (yyval.mol_type).mol_type = (yyvsp[-1].sym); }
+#line 4550 "mdlparse.c"
     break;
 
-  case 298:
-#line 1371 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_reaction_player_singleton(parse_state, & (yyval.mol_type_list), & (yyvsp[0].mol_type))); }
-#line 4395 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 316: /* product_list: product  */
+#line 1459 "../src/mdlparse.y"
+                                                      { CHECK(mdl_reaction_player_singleton(parse_state, & (yyval.mol_type_list), & (yyvsp[0].mol_type))); }
+#line 4556 "mdlparse.c"
     break;
 
-  case 299:
-#line 1372 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type_list) = (yyvsp[-2].mol_type_list); CHECK(mdl_add_reaction_player(parse_state, & (yyval.mol_type_list), & (yyvsp[0].mol_type))); }
-#line 4401 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 317: /* product_list: product_list '+' product  */
+#line 1460 "../src/mdlparse.y"
+                                                      { (yyval.mol_type_list) = (yyvsp[-2].mol_type_list); CHECK(mdl_add_reaction_player(parse_state, & (yyval.mol_type_list), & (yyvsp[0].mol_type))); }
+#line 4562 "mdlparse.c"
     break;
 
-  case 300:
-#line 1375 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.mol_type).mol_type = NULL; (yyval.mol_type).orient_set = 0; }
-#line 4407 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 318: /* product: NO_SPECIES  */
+#line 1463 "../src/mdlparse.y"
+                                                      { (yyval.mol_type).mol_type = NULL; (yyval.mol_type).orient_set = 0; }
+#line 4568 "mdlparse.c"
     break;
 
-  case 304:
-#line 1384 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 322: /* rx_rate1: '[' rx_dir_rate ']'  */
+#line 1472 "../src/mdlparse.y"
+                                                      {
                                                         if ((yyvsp[-1].react_rates).forward_rate.rate_type == RATE_UNSET)
                                                         {
                                                           mdlerror(parse_state, "invalid reaction rate specification: must specify a forward rate.");
@@ -4417,12 +4578,12 @@ yyreduce:
 
                                                         (yyval.react_rates) = (yyvsp[-1].react_rates);
                                                       }
-#line 4421 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4582 "mdlparse.c"
     break;
 
-  case 305:
-#line 1395 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 323: /* rx_rate2: '[' rx_dir_rate ',' rx_dir_rate ']'  */
+#line 1483 "../src/mdlparse.y"
+                                                      {
                                                         if (((yyvsp[-3].react_rates).forward_rate.rate_type  != RATE_UNSET && (yyvsp[-1].react_rates).forward_rate.rate_type  != RATE_UNSET)  ||
                                                             ((yyvsp[-3].react_rates).backward_rate.rate_type != RATE_UNSET && (yyvsp[-1].react_rates).backward_rate.rate_type != RATE_UNSET))
                                                         {
@@ -4436,867 +4597,873 @@ yyreduce:
                                                         else
                                                           (yyval.react_rates).backward_rate = (yyvsp[-1].react_rates).backward_rate;
                                                       }
-#line 4440 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4601 "mdlparse.c"
     break;
 
-  case 306:
-#line 1412 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.react_rates).forward_rate = (yyvsp[0].react_rate); (yyval.react_rates).backward_rate.rate_type = RATE_UNSET; CHECK(mdl_valid_rate(parse_state, &(yyvsp[0].react_rate))); }
-#line 4446 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 324: /* rx_dir_rate: atomic_rate  */
+#line 1500 "../src/mdlparse.y"
+                                                      { (yyval.react_rates).forward_rate = (yyvsp[0].react_rate); (yyval.react_rates).backward_rate.rate_type = RATE_UNSET; CHECK(mdl_valid_rate(parse_state, &(yyvsp[0].react_rate))); }
+#line 4607 "mdlparse.c"
     break;
 
-  case 307:
-#line 1413 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.react_rates).forward_rate = (yyvsp[0].react_rate); (yyval.react_rates).backward_rate.rate_type = RATE_UNSET; CHECK(mdl_valid_rate(parse_state, &(yyvsp[0].react_rate))); }
-#line 4452 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 325: /* rx_dir_rate: '>' atomic_rate  */
+#line 1501 "../src/mdlparse.y"
+                                                      { (yyval.react_rates).forward_rate = (yyvsp[0].react_rate); (yyval.react_rates).backward_rate.rate_type = RATE_UNSET; CHECK(mdl_valid_rate(parse_state, &(yyvsp[0].react_rate))); }
+#line 4613 "mdlparse.c"
     break;
 
-  case 308:
-#line 1414 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.react_rates).backward_rate = (yyvsp[0].react_rate); (yyval.react_rates).forward_rate.rate_type = RATE_UNSET; CHECK(mdl_valid_rate(parse_state, &(yyvsp[0].react_rate))); }
-#line 4458 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 326: /* rx_dir_rate: '<' atomic_rate  */
+#line 1502 "../src/mdlparse.y"
+                                                      { (yyval.react_rates).backward_rate = (yyvsp[0].react_rate); (yyval.react_rates).forward_rate.rate_type = RATE_UNSET; CHECK(mdl_valid_rate(parse_state, &(yyvsp[0].react_rate))); }
+#line 4619 "mdlparse.c"
     break;
 
-  case 309:
-#line 1418 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.react_rate).rate_type = RATE_CONSTANT; (yyval.react_rate).v.rate_constant = (yyvsp[0].dbl); }
-#line 4464 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 327: /* atomic_rate: num_expr_only  */
+#line 1506 "../src/mdlparse.y"
+                                                      { (yyval.react_rate).rate_type = RATE_CONSTANT; (yyval.react_rate).v.rate_constant = (yyvsp[0].dbl); }
+#line 4625 "mdlparse.c"
     break;
 
-  case 310:
-#line 1419 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.react_rate).rate_type = RATE_FILE; (yyval.react_rate).v.rate_file = (yyvsp[0].str); }
-#line 4470 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 328: /* atomic_rate: str_expr_only  */
+#line 1507 "../src/mdlparse.y"
+                                                      { (yyval.react_rate).rate_type = RATE_FILE; (yyval.react_rate).v.rate_file = (yyvsp[0].str); }
+#line 4631 "mdlparse.c"
     break;
 
-  case 311:
-#line 1420 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_reaction_rate_from_var(parse_state, & (yyval.react_rate), (yyvsp[0].sym))); }
-#line 4476 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 329: /* atomic_rate: existing_var_only  */
+#line 1508 "../src/mdlparse.y"
+                                                      { CHECK(mdl_reaction_rate_from_var(parse_state, & (yyval.react_rate), (yyvsp[0].sym))); }
+#line 4637 "mdlparse.c"
     break;
 
-  case 312:
-#line 1431 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_pattern(parse_state, (yyvsp[-3].sym), &(yyvsp[-1].rpat))); }
-#line 4482 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 330: /* release_pattern_def: DEFINE_RELEASE_PATTERN new_release_pattern '{' list_req_release_pattern_cmds '}'  */
+#line 1519 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_pattern(parse_state, (yyvsp[-3].sym), &(yyvsp[-1].rpat))); }
+#line 4643 "mdlparse.c"
     break;
 
-  case 313:
-#line 1434 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_new_release_pattern(parse_state, (yyvsp[0].str))); }
-#line 4488 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 331: /* new_release_pattern: var  */
+#line 1522 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_new_release_pattern(parse_state, (yyvsp[0].str))); }
+#line 4649 "mdlparse.c"
     break;
 
-  case 314:
-#line 1437 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_release_pattern_or_rxn_pathname(parse_state, (yyvsp[0].str))); }
-#line 4494 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 332: /* existing_release_pattern_xor_rxpn: var  */
+#line 1525 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_release_pattern_or_rxn_pathname(parse_state, (yyvsp[0].str))); }
+#line 4655 "mdlparse.c"
     break;
 
-  case 315:
-#line 1441 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 333: /* list_req_release_pattern_cmds: %empty  */
+#line 1529 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.rpat).delay = 0;
                                                         (yyval.rpat).release_interval = FOREVER;
                                                         (yyval.rpat).train_interval = FOREVER;
                                                         (yyval.rpat).train_duration = FOREVER;
                                                         (yyval.rpat).number_of_trains = 1;
                                                       }
-#line 4506 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4667 "mdlparse.c"
     break;
 
-  case 316:
-#line 1449 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).delay = (yyvsp[0].dbl) / parse_state->vol->time_unit; }
-#line 4512 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 334: /* list_req_release_pattern_cmds: list_req_release_pattern_cmds DELAY '=' num_expr  */
+#line 1537 "../src/mdlparse.y"
+                                                      { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).delay = (yyvsp[0].dbl) / parse_state->vol->time_unit; }
+#line 4673 "mdlparse.c"
     break;
 
-  case 317:
-#line 1451 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).release_interval = (yyvsp[0].dbl) / parse_state->vol->time_unit; }
-#line 4518 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 335: /* list_req_release_pattern_cmds: list_req_release_pattern_cmds RELEASE_INTERVAL '=' num_expr  */
+#line 1539 "../src/mdlparse.y"
+                                                      { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).release_interval = (yyvsp[0].dbl) / parse_state->vol->time_unit; }
+#line 4679 "mdlparse.c"
     break;
 
-  case 318:
-#line 1453 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).train_interval = (yyvsp[0].dbl) / parse_state->vol->time_unit; }
-#line 4524 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 336: /* list_req_release_pattern_cmds: list_req_release_pattern_cmds TRAIN_INTERVAL '=' num_expr  */
+#line 1541 "../src/mdlparse.y"
+                                                      { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).train_interval = (yyvsp[0].dbl) / parse_state->vol->time_unit; }
+#line 4685 "mdlparse.c"
     break;
 
-  case 319:
-#line 1455 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).train_duration = (yyvsp[0].dbl) / parse_state->vol->time_unit; }
-#line 4530 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 337: /* list_req_release_pattern_cmds: list_req_release_pattern_cmds TRAIN_DURATION '=' num_expr  */
+#line 1543 "../src/mdlparse.y"
+                                                      { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).train_duration = (yyvsp[0].dbl) / parse_state->vol->time_unit; }
+#line 4691 "mdlparse.c"
     break;
 
-  case 320:
-#line 1457 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).number_of_trains = (yyvsp[0].ival); }
-#line 4536 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 338: /* list_req_release_pattern_cmds: list_req_release_pattern_cmds NUMBER_OF_TRAINS '=' train_count  */
+#line 1545 "../src/mdlparse.y"
+                                                      { (yyval.rpat) = (yyvsp[-3].rpat); (yyval.rpat).number_of_trains = (yyvsp[0].ival); }
+#line 4697 "mdlparse.c"
     break;
 
-  case 321:
-#line 1460 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ival) = (int) (yyvsp[0].dbl); }
-#line 4542 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 339: /* train_count: num_expr  */
+#line 1548 "../src/mdlparse.y"
+                                                      { (yyval.ival) = (int) (yyvsp[0].dbl); }
+#line 4703 "mdlparse.c"
     break;
 
-  case 322:
-#line 1461 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ival) = INT_MAX; }
-#line 4548 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 340: /* train_count: UNLIMITED  */
+#line 1549 "../src/mdlparse.y"
+                                                      { (yyval.ival) = INT_MAX; }
+#line 4709 "mdlparse.c"
     break;
 
-  case 323:
-#line 1468 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_object = parse_state->vol->root_instance; }
-#line 4554 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 341: /* $@4: %empty  */
+#line 1556 "../src/mdlparse.y"
+                                                      { parse_state->current_object = parse_state->vol->root_instance; }
+#line 4715 "mdlparse.c"
     break;
 
-  case 324:
-#line 1469 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 342: /* instance_def: INSTANTIATE $@4 meta_object_def  */
+#line 1557 "../src/mdlparse.y"
+                                                      {
                                                         check_regions(parse_state->vol->root_instance, (yyvsp[0].obj));
                                                         add_child_objects(parse_state->vol->root_instance, (yyvsp[0].obj), (yyvsp[0].obj));
                                                         parse_state->current_object = parse_state->vol->root_object;
                                                       }
-#line 4564 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4725 "mdlparse.c"
     break;
 
-  case 325:
-#line 1479 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { add_child_objects(parse_state->vol->root_object, (yyvsp[0].obj), (yyvsp[0].obj)); }
-#line 4570 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 343: /* physical_object_def: object_def  */
+#line 1567 "../src/mdlparse.y"
+                                                      { add_child_objects(parse_state->vol->root_object, (yyvsp[0].obj), (yyvsp[0].obj)); }
+#line 4731 "mdlparse.c"
     break;
 
-  case 331:
-#line 1495 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_start_object(parse_state, (yyvsp[0].str))); }
-#line 4576 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 349: /* new_object: var  */
+#line 1583 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_start_object(parse_state, (yyvsp[0].str))); }
+#line 4737 "mdlparse.c"
     break;
 
-  case 333:
-#line 1501 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_finish_object(parse_state); }
-#line 4582 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 351: /* end_object: '}'  */
+#line 1589 "../src/mdlparse.y"
+                                                      { mdl_finish_object(parse_state); }
+#line 4743 "mdlparse.c"
     break;
 
-  case 337:
-#line 1514 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { transform_translate(parse_state->vol, parse_state->current_object->t_matrix, (yyvsp[0].vec3)); }
-#line 4588 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 355: /* transformation: TRANSLATE '=' point  */
+#line 1602 "../src/mdlparse.y"
+                                                      { transform_translate(parse_state->vol, parse_state->current_object->t_matrix, (yyvsp[0].vec3)); }
+#line 4749 "mdlparse.c"
     break;
 
-  case 338:
-#line 1515 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { transform_scale(parse_state->current_object->t_matrix, (yyvsp[0].vec3)); }
-#line 4594 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 356: /* transformation: SCALE '=' point_or_num  */
+#line 1603 "../src/mdlparse.y"
+                                                      { transform_scale(parse_state->current_object->t_matrix, (yyvsp[0].vec3)); }
+#line 4755 "mdlparse.c"
     break;
 
-  case 339:
-#line 1516 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_transform_rotate(parse_state, parse_state->current_object->t_matrix, (yyvsp[-2].vec3), (yyvsp[0].dbl))); }
-#line 4600 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 357: /* transformation: ROTATE '=' point ',' num_expr  */
+#line 1604 "../src/mdlparse.y"
+                                                      { CHECK(mdl_transform_rotate(parse_state, parse_state->current_object->t_matrix, (yyvsp[-2].vec3), (yyvsp[0].dbl))); }
+#line 4761 "mdlparse.c"
     break;
 
-  case 340:
-#line 1525 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 358: /* meta_object_def: new_object OBJECT start_object list_objects list_opt_object_cmds end_object  */
+#line 1613 "../src/mdlparse.y"
+                                                      {
                                                           struct object *the_object = (struct object *) (yyvsp[-5].sym)->value;
                                                           the_object->object_type = META_OBJ;
                                                           add_child_objects(the_object, (yyvsp[-2].obj_list).obj_head, (yyvsp[-2].obj_list).obj_tail);
                                                           (yyval.obj) = the_object;
                                                       }
-#line 4611 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4772 "mdlparse.c"
     break;
 
-  case 341:
-#line 1534 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_object_list_singleton(& (yyval.obj_list), (yyvsp[0].obj)); }
-#line 4617 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 359: /* list_objects: object_ref  */
+#line 1622 "../src/mdlparse.y"
+                                                      { mdl_object_list_singleton(& (yyval.obj_list), (yyvsp[0].obj)); }
+#line 4778 "mdlparse.c"
     break;
 
-  case 342:
-#line 1535 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.obj_list) = (yyvsp[-1].obj_list); mdl_add_object_to_list(& (yyval.obj_list), (yyvsp[0].obj)); }
-#line 4623 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 360: /* list_objects: list_objects object_ref  */
+#line 1623 "../src/mdlparse.y"
+                                                      { (yyval.obj_list) = (yyvsp[-1].obj_list); mdl_add_object_to_list(& (yyval.obj_list), (yyvsp[0].obj)); }
+#line 4784 "mdlparse.c"
     break;
 
-  case 345:
-#line 1544 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_deep_copy_object(parse_state, (struct object *) (yyvsp[-3].sym)->value, (struct object *) (yyvsp[-1].sym)->value)); }
-#line 4629 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 363: /* $@5: %empty  */
+#line 1632 "../src/mdlparse.y"
+                                                      { CHECK(mdl_deep_copy_object(parse_state, (struct object *) (yyvsp[-3].sym)->value, (struct object *) (yyvsp[-1].sym)->value)); }
+#line 4790 "mdlparse.c"
     break;
 
-  case 346:
-#line 1546 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.obj) = (struct object *) (yyvsp[-6].sym)->value; }
-#line 4635 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 364: /* existing_object_ref: new_object OBJECT existing_object start_object $@5 list_opt_object_cmds end_object  */
+#line 1634 "../src/mdlparse.y"
+                                                      { (yyval.obj) = (struct object *) (yyvsp[-6].sym)->value; }
+#line 4796 "mdlparse.c"
     break;
 
-  case 349:
-#line 1556 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_start_release_site(parse_state, (yyvsp[-2].sym), SHAPE_UNDEFINED)); }
-#line 4641 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 367: /* $@6: %empty  */
+#line 1644 "../src/mdlparse.y"
+                                                      { CHECK(mdl_start_release_site(parse_state, (yyvsp[-2].sym), SHAPE_UNDEFINED)); }
+#line 4802 "mdlparse.c"
     break;
 
-  case 350:
-#line 1560 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.obj) = mdl_finish_release_site(parse_state, (yyvsp[-7].sym))); }
-#line 4647 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 368: /* release_site_def_new: new_object RELEASE_SITE start_object $@6 release_site_geom list_release_site_cmds list_opt_object_cmds end_object  */
+#line 1648 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.obj) = mdl_finish_release_site(parse_state, (yyvsp[-7].sym))); }
+#line 4808 "mdlparse.c"
     break;
 
-  case 351:
-#line 1563 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_geometry_region(parse_state, parse_state->current_release_site, parse_state->current_object, (yyvsp[0].rev))); }
-#line 4653 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 369: /* release_site_geom: SHAPE '=' release_region_expr  */
+#line 1651 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_geometry_region(parse_state, parse_state->current_release_site, parse_state->current_object, (yyvsp[0].rev))); }
+#line 4814 "mdlparse.c"
     break;
 
-  case 352:
-#line 1564 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_geometry_object(parse_state, parse_state->current_release_site, (struct object *) (yyvsp[0].sym)->value)); }
-#line 4659 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 370: /* release_site_geom: SHAPE '=' existing_object  */
+#line 1652 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_geometry_object(parse_state, parse_state->current_release_site, (struct object *) (yyvsp[0].sym)->value)); }
+#line 4820 "mdlparse.c"
     break;
 
-  case 353:
-#line 1565 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_release_site->release_shape = SHAPE_SPHERICAL; }
-#line 4665 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 371: /* release_site_geom: SHAPE '=' SPHERICAL  */
+#line 1653 "../src/mdlparse.y"
+                                                      { parse_state->current_release_site->release_shape = SHAPE_SPHERICAL; }
+#line 4826 "mdlparse.c"
     break;
 
-  case 354:
-#line 1566 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_release_site->release_shape = SHAPE_CUBIC; }
-#line 4671 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 372: /* release_site_geom: SHAPE '=' CUBIC  */
+#line 1654 "../src/mdlparse.y"
+                                                      { parse_state->current_release_site->release_shape = SHAPE_CUBIC; }
+#line 4832 "mdlparse.c"
     break;
 
-  case 355:
-#line 1567 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_release_site->release_shape = SHAPE_ELLIPTIC; }
-#line 4677 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 373: /* release_site_geom: SHAPE '=' ELLIPTIC  */
+#line 1655 "../src/mdlparse.y"
+                                                      { parse_state->current_release_site->release_shape = SHAPE_ELLIPTIC; }
+#line 4838 "mdlparse.c"
     break;
 
-  case 356:
-#line 1568 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_release_site->release_shape = SHAPE_RECTANGULAR; }
-#line 4683 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 374: /* release_site_geom: SHAPE '=' RECTANGULAR_TOKEN  */
+#line 1656 "../src/mdlparse.y"
+                                                      { parse_state->current_release_site->release_shape = SHAPE_RECTANGULAR; }
+#line 4844 "mdlparse.c"
     break;
 
-  case 357:
-#line 1569 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_release_site->release_shape = SHAPE_SPHERICAL_SHELL; }
-#line 4689 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 375: /* release_site_geom: SHAPE '=' SPHERICAL_SHELL  */
+#line 1657 "../src/mdlparse.y"
+                                                      { parse_state->current_release_site->release_shape = SHAPE_SPHERICAL_SHELL; }
+#line 4850 "mdlparse.c"
     break;
 
-  case 358:
-#line 1570 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 376: /* release_site_geom: SHAPE '=' LIST  */
+#line 1658 "../src/mdlparse.y"
+                                                      {
                                                           parse_state->current_release_site->release_shape = SHAPE_LIST;
                                                           parse_state->current_release_site->release_number_method = CONSTNUM;
                                                       }
-#line 4698 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4859 "mdlparse.c"
     break;
 
-  case 359:
-#line 1577 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.rev) = new_release_region_expr_term((yyvsp[0].sym))); }
-#line 4704 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 377: /* release_region_expr: existing_region  */
+#line 1665 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.rev) = new_release_region_expr_term((yyvsp[0].sym))); }
+#line 4865 "mdlparse.c"
     break;
 
-  case 360:
-#line 1578 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.rev) = (yyvsp[-1].rev); }
-#line 4710 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 378: /* release_region_expr: '(' release_region_expr ')'  */
+#line 1666 "../src/mdlparse.y"
+                                                      { (yyval.rev) = (yyvsp[-1].rev); }
+#line 4871 "mdlparse.c"
     break;
 
-  case 361:
-#line 1579 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.rev) = new_release_region_expr_binary((yyvsp[-2].rev), (yyvsp[0].rev), REXP_UNION)); }
-#line 4716 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 379: /* release_region_expr: release_region_expr '+' release_region_expr  */
+#line 1667 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.rev) = new_release_region_expr_binary((yyvsp[-2].rev), (yyvsp[0].rev), REXP_UNION)); }
+#line 4877 "mdlparse.c"
     break;
 
-  case 362:
-#line 1580 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.rev) = new_release_region_expr_binary((yyvsp[-2].rev), (yyvsp[0].rev), REXP_SUBTRACTION)); }
-#line 4722 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 380: /* release_region_expr: release_region_expr '-' release_region_expr  */
+#line 1668 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.rev) = new_release_region_expr_binary((yyvsp[-2].rev), (yyvsp[0].rev), REXP_SUBTRACTION)); }
+#line 4883 "mdlparse.c"
     break;
 
-  case 363:
-#line 1581 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.rev) = new_release_region_expr_binary((yyvsp[-2].rev), (yyvsp[0].rev), REXP_INTERSECTION)); }
-#line 4728 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 381: /* release_region_expr: release_region_expr '*' release_region_expr  */
+#line 1669 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.rev) = new_release_region_expr_binary((yyvsp[-2].rev), (yyvsp[0].rev), REXP_INTERSECTION)); }
+#line 4889 "mdlparse.c"
     break;
 
-  case 364:
-#line 1586 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_start_release_site(parse_state, (yyvsp[-2].sym), (yyvsp[-1].tok))); }
-#line 4734 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 382: /* $@7: %empty  */
+#line 1674 "../src/mdlparse.y"
+                                                      { CHECK(mdl_start_release_site(parse_state, (yyvsp[-2].sym), (yyvsp[-1].tok))); }
+#line 4895 "mdlparse.c"
     break;
 
-  case 365:
-#line 1589 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.obj) = mdl_finish_release_site(parse_state, (yyvsp[-6].sym))); }
-#line 4740 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 383: /* release_site_def_old: new_object release_site_geom_old start_object $@7 list_release_site_cmds list_opt_object_cmds end_object  */
+#line 1677 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.obj) = mdl_finish_release_site(parse_state, (yyvsp[-6].sym))); }
+#line 4901 "mdlparse.c"
     break;
 
-  case 366:
-#line 1592 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = SHAPE_SPHERICAL; }
-#line 4746 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 384: /* release_site_geom_old: SPHERICAL_RELEASE_SITE  */
+#line 1680 "../src/mdlparse.y"
+                                                      { (yyval.tok) = SHAPE_SPHERICAL; }
+#line 4907 "mdlparse.c"
     break;
 
-  case 367:
-#line 1593 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = SHAPE_CUBIC; }
-#line 4752 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 385: /* release_site_geom_old: CUBIC_RELEASE_SITE  */
+#line 1681 "../src/mdlparse.y"
+                                                      { (yyval.tok) = SHAPE_CUBIC; }
+#line 4913 "mdlparse.c"
     break;
 
-  case 368:
-#line 1594 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = SHAPE_ELLIPTIC; }
-#line 4758 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 386: /* release_site_geom_old: ELLIPTIC_RELEASE_SITE  */
+#line 1682 "../src/mdlparse.y"
+                                                      { (yyval.tok) = SHAPE_ELLIPTIC; }
+#line 4919 "mdlparse.c"
     break;
 
-  case 369:
-#line 1595 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = SHAPE_RECTANGULAR; }
-#line 4764 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 387: /* release_site_geom_old: RECTANGULAR_RELEASE_SITE  */
+#line 1683 "../src/mdlparse.y"
+                                                      { (yyval.tok) = SHAPE_RECTANGULAR; }
+#line 4925 "mdlparse.c"
     break;
 
-  case 370:
-#line 1596 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = SHAPE_SPHERICAL_SHELL; }
-#line 4770 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 388: /* release_site_geom_old: SPHERICAL_SHELL_SITE  */
+#line 1684 "../src/mdlparse.y"
+                                                      { (yyval.tok) = SHAPE_SPHERICAL_SHELL; }
+#line 4931 "mdlparse.c"
     break;
 
-  case 373:
-#line 1604 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_num_or_array(parse_state, (yyvsp[0].str))); }
-#line 4776 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 391: /* existing_num_or_array: var  */
+#line 1692 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_num_or_array(parse_state, (yyvsp[0].str))); }
+#line 4937 "mdlparse.c"
     break;
 
-  case 374:
-#line 1608 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { set_release_site_location(parse_state->vol, parse_state->current_release_site, (yyvsp[0].vec3)); }
-#line 4782 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 392: /* release_site_cmd: LOCATION '=' point  */
+#line 1696 "../src/mdlparse.y"
+                                                      { set_release_site_location(parse_state->vol, parse_state->current_release_site, (yyvsp[0].vec3)); }
+#line 4943 "mdlparse.c"
     break;
 
-  case 375:
-#line 1609 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_molecule(parse_state, parse_state->current_release_site, & (yyvsp[0].mol_type))); }
-#line 4788 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 393: /* release_site_cmd: MOLECULE '=' existing_molecule_opt_orient  */
+#line 1697 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_molecule(parse_state, parse_state->current_release_site, & (yyvsp[0].mol_type))); }
+#line 4949 "mdlparse.c"
     break;
 
-  case 376:
-#line 1610 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 394: /* release_site_cmd: release_number_cmd  */
+#line 1698 "../src/mdlparse.y"
+                                                      {
                                                         if (parse_state->current_release_site->release_shape == SHAPE_LIST)
                                                         {
                                                           mdlerror(parse_state, "molecules are already specified in a list--cannot set number or density.");
                                                           return 1;
                                                         }
                                                       }
-#line 4800 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 4961 "mdlparse.c"
     break;
 
-  case 377:
-#line 1617 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_diameter(parse_state, parse_state->current_release_site, (yyvsp[0].dbl) * (((yyvsp[-2].tok) == SITE_RADIUS) ? 2.0 : 1.0))); }
-#line 4806 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 395: /* release_site_cmd: site_size_cmd '=' num_expr_only  */
+#line 1705 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_diameter(parse_state, parse_state->current_release_site, (yyvsp[0].dbl) * (((yyvsp[-2].tok) == SITE_RADIUS) ? 2.0 : 1.0))); }
+#line 4967 "mdlparse.c"
     break;
 
-  case 378:
-#line 1618 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_diameter_array(parse_state, parse_state->current_release_site, (yyvsp[0].nlist).value_count, (yyvsp[0].nlist).value_head, ((yyvsp[-2].tok) == SITE_RADIUS) ? 2.0 : 1.0)); }
-#line 4812 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 396: /* release_site_cmd: site_size_cmd '=' array_expr_only  */
+#line 1706 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_diameter_array(parse_state, parse_state->current_release_site, (yyvsp[0].nlist).value_count, (yyvsp[0].nlist).value_head, ((yyvsp[-2].tok) == SITE_RADIUS) ? 2.0 : 1.0)); }
+#line 4973 "mdlparse.c"
     break;
 
-  case 379:
-#line 1619 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_diameter_var(parse_state, parse_state->current_release_site, ((yyvsp[-2].tok) == SITE_RADIUS) ? 2.0 : 1.0, (yyvsp[0].sym))); }
-#line 4818 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 397: /* release_site_cmd: site_size_cmd '=' existing_num_or_array  */
+#line 1707 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_diameter_var(parse_state, parse_state->current_release_site, ((yyvsp[-2].tok) == SITE_RADIUS) ? 2.0 : 1.0, (yyvsp[0].sym))); }
+#line 4979 "mdlparse.c"
     break;
 
-  case 380:
-#line 1620 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_periodic_box(parse_state, parse_state->current_release_site, (yyvsp[0].vec3))); }
-#line 4824 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 398: /* release_site_cmd: PERIODIC_BOX_INITIAL '=' point  */
+#line 1708 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_periodic_box(parse_state, parse_state->current_release_site, (yyvsp[0].vec3))); }
+#line 4985 "mdlparse.c"
     break;
 
-  case 381:
-#line 1621 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_probability(parse_state, parse_state->current_release_site, (yyvsp[0].dbl))); }
-#line 4830 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 399: /* release_site_cmd: RELEASE_PROBABILITY '=' num_expr  */
+#line 1709 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_probability(parse_state, parse_state->current_release_site, (yyvsp[0].dbl))); }
+#line 4991 "mdlparse.c"
     break;
 
-  case 382:
-#line 1623 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_pattern(parse_state, parse_state->current_release_site, (yyvsp[0].sym))); }
-#line 4836 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 400: /* release_site_cmd: RELEASE_PATTERN '=' existing_release_pattern_xor_rxpn  */
+#line 1711 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_pattern(parse_state, parse_state->current_release_site, (yyvsp[0].sym))); }
+#line 4997 "mdlparse.c"
     break;
 
-  case 383:
-#line 1625 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_molecule_positions(parse_state, parse_state->current_release_site, & (yyvsp[-1].rsm_list))); }
-#line 4842 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 401: /* release_site_cmd: MOLECULE_POSITIONS '{' molecule_release_pos_list '}'  */
+#line 1713 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_molecule_positions(parse_state, parse_state->current_release_site, & (yyvsp[-1].rsm_list))); }
+#line 5003 "mdlparse.c"
     break;
 
-  case 384:
-#line 1626 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {CHECK(mdl_set_release_site_graph_pattern(parse_state, parse_state->current_release_site,  (yyvsp[0].str))); }
-#line 4848 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 402: /* release_site_cmd: MOLECULE_POSITIONS_FILE '=' file_name  */
+#line 1714 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_molecule_positions_file(parse_state, parse_state->current_release_site, (yyvsp[0].str))); }
+#line 5009 "mdlparse.c"
     break;
 
-  case 385:
-#line 1630 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = SITE_DIAMETER; }
-#line 4854 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 403: /* release_site_cmd: GRAPH_PATTERN '=' str_expr  */
+#line 1715 "../src/mdlparse.y"
+                                                        {CHECK(mdl_set_release_site_graph_pattern(parse_state, parse_state->current_release_site,  (yyvsp[0].str))); }
+#line 5015 "mdlparse.c"
     break;
 
-  case 386:
-#line 1631 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = SITE_RADIUS; }
-#line 4860 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 404: /* site_size_cmd: SITE_DIAMETER  */
+#line 1719 "../src/mdlparse.y"
+                                                      { (yyval.tok) = SITE_DIAMETER; }
+#line 5021 "mdlparse.c"
     break;
 
-  case 391:
-#line 1643 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { set_release_site_constant_number(parse_state->current_release_site, (yyvsp[0].dbl)); }
-#line 4866 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 405: /* site_size_cmd: SITE_RADIUS  */
+#line 1720 "../src/mdlparse.y"
+                                                      { (yyval.tok) = SITE_RADIUS; }
+#line 5027 "mdlparse.c"
     break;
 
-  case 392:
-#line 1646 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { set_release_site_constant_number(parse_state->current_release_site, (yyvsp[-1].dbl)); }
-#line 4872 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 410: /* constant_release_number_cmd: NUMBER_TO_RELEASE '=' num_expr  */
+#line 1732 "../src/mdlparse.y"
+                                                      { set_release_site_constant_number(parse_state->current_release_site, (yyvsp[0].dbl)); }
+#line 5033 "mdlparse.c"
     break;
 
-  case 393:
-#line 1653 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { set_release_site_gaussian_number(parse_state->current_release_site, (yyvsp[-4].dbl), (yyvsp[-1].dbl)); }
-#line 4878 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 411: /* constant_release_number_cmd: GAUSSIAN_RELEASE_NUMBER '{' MEAN_NUMBER '=' num_expr '}'  */
+#line 1735 "../src/mdlparse.y"
+                                                      { set_release_site_constant_number(parse_state->current_release_site, (yyvsp[-1].dbl)); }
+#line 5039 "mdlparse.c"
     break;
 
-  case 394:
-#line 1661 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { set_release_site_volume_dependent_number(parse_state->current_release_site, (yyvsp[-7].dbl), (yyvsp[-4].dbl), (yyvsp[-1].dbl)); }
-#line 4884 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 412: /* gaussian_release_number_cmd: GAUSSIAN_RELEASE_NUMBER '{' MEAN_NUMBER '=' num_expr STANDARD_DEVIATION '=' num_expr '}'  */
+#line 1742 "../src/mdlparse.y"
+                                                      { set_release_site_gaussian_number(parse_state->current_release_site, (yyvsp[-4].dbl), (yyvsp[-1].dbl)); }
+#line 5045 "mdlparse.c"
     break;
 
-  case 395:
-#line 1665 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_release_site_concentration(parse_state, parse_state->current_release_site, (yyvsp[0].dbl))); }
-#line 4890 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 413: /* volume_dependent_number_cmd: VOLUME_DEPENDENT_RELEASE_NUMBER '{' MEAN_DIAMETER '=' num_expr STANDARD_DEVIATION '=' num_expr CONCENTRATION '=' num_expr '}'  */
+#line 1750 "../src/mdlparse.y"
+                                                      { set_release_site_volume_dependent_number(parse_state->current_release_site, (yyvsp[-7].dbl), (yyvsp[-4].dbl), (yyvsp[-1].dbl)); }
+#line 5051 "mdlparse.c"
     break;
 
-  case 396:
-#line 1666 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(set_release_site_density(parse_state->current_release_site, (yyvsp[0].dbl))); }
-#line 4896 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 414: /* concentration_dependent_release_cmd: CONCENTRATION '=' num_expr  */
+#line 1754 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_release_site_concentration(parse_state, parse_state->current_release_site, (yyvsp[0].dbl))); }
+#line 5057 "mdlparse.c"
     break;
 
-  case 397:
-#line 1670 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { release_single_molecule_singleton(& (yyval.rsm_list), (yyvsp[0].rsm)); }
-#line 4902 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 415: /* concentration_dependent_release_cmd: DENSITY '=' num_expr  */
+#line 1755 "../src/mdlparse.y"
+                                                      { CHECK(set_release_site_density(parse_state->current_release_site, (yyvsp[0].dbl))); }
+#line 5063 "mdlparse.c"
     break;
 
-  case 398:
-#line 1672 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.rsm_list) = (yyvsp[-1].rsm_list); add_release_single_molecule_to_list(& (yyval.rsm_list), (yyvsp[0].rsm)); }
-#line 4908 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 416: /* molecule_release_pos_list: molecule_release_pos  */
+#line 1759 "../src/mdlparse.y"
+                                                      { release_single_molecule_singleton(& (yyval.rsm_list), (yyvsp[0].rsm)); }
+#line 5069 "mdlparse.c"
     break;
 
-  case 399:
-#line 1676 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.rsm) = mdl_new_release_single_molecule(parse_state, &(yyvsp[-1].mol_type), (yyvsp[0].vec3))); }
-#line 4914 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 417: /* molecule_release_pos_list: molecule_release_pos_list molecule_release_pos  */
+#line 1761 "../src/mdlparse.y"
+                                                      { (yyval.rsm_list) = (yyvsp[-1].rsm_list); add_release_single_molecule_to_list(& (yyval.rsm_list), (yyvsp[0].rsm)); }
+#line 5075 "mdlparse.c"
     break;
 
-  case 401:
-#line 1687 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 418: /* molecule_release_pos: existing_molecule_opt_orient point  */
+#line 1765 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.rsm) = mdl_new_release_single_molecule(parse_state, &(yyvsp[-1].mol_type), (yyvsp[0].vec3))); }
+#line 5081 "mdlparse.c"
+    break;
+
+  case 420: /* @8: %empty  */
+#line 1776 "../src/mdlparse.y"
+                                                      {
                                                         CHECKN((yyval.obj) = mdl_new_polygon_list(
                                                           parse_state, (yyvsp[-4].str), (yyvsp[-1].vertlist).vertex_count, (yyvsp[-1].vertlist).vertex_head,
                                                           (yyvsp[0].ecl).connection_count, (yyvsp[0].ecl).connection_head));
                                                       }
-#line 4924 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5091 "mdlparse.c"
     break;
 
-  case 402:
-#line 1696 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 421: /* polygon_list_def: new_object_name POLYGON_LIST start_object vertex_list_cmd element_connection_cmd @8 list_opt_polygon_object_cmds list_opt_object_cmds '}'  */
+#line 1785 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.obj) = (struct object *) (yyvsp[-3].obj);
                                                           CHECK(mdl_finish_polygon_list(parse_state, (yyval.obj)));
                                                       }
-#line 4933 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5100 "mdlparse.c"
     break;
 
-  case 403:
-#line 1702 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.vertlist) = (yyvsp[-1].vertlist); }
-#line 4939 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 422: /* vertex_list_cmd: VERTEX_LIST '{' list_points '}'  */
+#line 1791 "../src/mdlparse.y"
+                                                      { (yyval.vertlist) = (yyvsp[-1].vertlist); }
+#line 5106 "mdlparse.c"
     break;
 
-  case 404:
-#line 1705 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.vertlistitem) = mdl_new_vertex_list_item((yyvsp[0].vec3))); }
-#line 4945 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 423: /* single_vertex: point  */
+#line 1794 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.vertlistitem) = mdl_new_vertex_list_item((yyvsp[0].vec3))); }
+#line 5112 "mdlparse.c"
     break;
 
-  case 405:
-#line 1708 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_vertex_list_singleton(& (yyval.vertlist), (yyvsp[0].vertlistitem)); }
-#line 4951 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 424: /* list_points: single_vertex  */
+#line 1797 "../src/mdlparse.y"
+                                                      { mdl_vertex_list_singleton(& (yyval.vertlist), (yyvsp[0].vertlistitem)); }
+#line 5118 "mdlparse.c"
     break;
 
-  case 406:
-#line 1709 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.vertlist) = (yyvsp[-1].vertlist); mdl_add_vertex_to_list(& (yyval.vertlist), (yyvsp[0].vertlistitem)); }
-#line 4957 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 425: /* list_points: list_points single_vertex  */
+#line 1798 "../src/mdlparse.y"
+                                                      { (yyval.vertlist) = (yyvsp[-1].vertlist); mdl_add_vertex_to_list(& (yyval.vertlist), (yyvsp[0].vertlistitem)); }
+#line 5124 "mdlparse.c"
     break;
 
-  case 407:
-#line 1714 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ecl) = (yyvsp[-1].ecl); }
-#line 4963 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 426: /* element_connection_cmd: ELEMENT_CONNECTIONS '{' list_element_connections '}'  */
+#line 1803 "../src/mdlparse.y"
+                                                      { (yyval.ecl) = (yyvsp[-1].ecl); }
+#line 5130 "mdlparse.c"
     break;
 
-  case 408:
-#line 1718 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_element_connection_list_singleton(& (yyval.ecl), (yyvsp[0].elem_conn)); }
-#line 4969 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 427: /* list_element_connections: element_connection  */
+#line 1807 "../src/mdlparse.y"
+                                                      { mdl_element_connection_list_singleton(& (yyval.ecl), (yyvsp[0].elem_conn)); }
+#line 5136 "mdlparse.c"
     break;
 
-  case 409:
-#line 1720 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ecl) = (yyvsp[-1].ecl); mdl_add_element_connection_to_list(& (yyval.ecl), (yyvsp[0].elem_conn)); }
-#line 4975 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 428: /* list_element_connections: list_element_connections element_connection  */
+#line 1809 "../src/mdlparse.y"
+                                                      { (yyval.ecl) = (yyvsp[-1].ecl); mdl_add_element_connection_to_list(& (yyval.ecl), (yyvsp[0].elem_conn)); }
+#line 5142 "mdlparse.c"
     break;
 
-  case 410:
-#line 1723 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.elem_conn) = mdl_new_element_connection(parse_state, & (yyvsp[0].nlist))); }
-#line 4981 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 429: /* element_connection: array_value  */
+#line 1812 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.elem_conn) = mdl_new_element_connection(parse_state, & (yyvsp[0].nlist))); }
+#line 5148 "mdlparse.c"
     break;
 
-  case 415:
-#line 1739 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN(parse_state->current_region = mdl_get_region(parse_state, parse_state->current_object, "REMOVED")); }
-#line 4987 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 434: /* $@9: %empty  */
+#line 1828 "../src/mdlparse.y"
+                                                      { CHECKN(parse_state->current_region = mdl_get_region(parse_state, parse_state->current_object, "REMOVED")); }
+#line 5154 "mdlparse.c"
     break;
 
-  case 416:
-#line 1741 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 435: /* remove_side: REMOVE_ELEMENTS '{' $@9 remove_element_specifier_list '}'  */
+#line 1830 "../src/mdlparse.y"
+                                                      {
                                                           parse_state->current_region->element_list_head = (yyvsp[-1].elem_list).elml_head;
                                                           if (parse_state->current_object->object_type == POLY_OBJ)
                                                           {
                                                             CHECK(mdl_normalize_elements(parse_state, parse_state->current_region,0));
                                                           }
                                                       }
-#line 4999 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5166 "mdlparse.c"
     break;
 
-  case 419:
-#line 1755 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = Z_POS; }
-#line 5005 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 438: /* side_name: TOP  */
+#line 1844 "../src/mdlparse.y"
+                                                      { (yyval.tok) = Z_POS; }
+#line 5172 "mdlparse.c"
     break;
 
-  case 420:
-#line 1756 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = Z_NEG; }
-#line 5011 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 439: /* side_name: BOTTOM  */
+#line 1845 "../src/mdlparse.y"
+                                                      { (yyval.tok) = Z_NEG; }
+#line 5178 "mdlparse.c"
     break;
 
-  case 421:
-#line 1757 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = Y_NEG; }
-#line 5017 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 440: /* side_name: FRONT  */
+#line 1846 "../src/mdlparse.y"
+                                                      { (yyval.tok) = Y_NEG; }
+#line 5184 "mdlparse.c"
     break;
 
-  case 422:
-#line 1758 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = Y_POS; }
-#line 5023 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 441: /* side_name: BACK  */
+#line 1847 "../src/mdlparse.y"
+                                                      { (yyval.tok) = Y_POS; }
+#line 5190 "mdlparse.c"
     break;
 
-  case 423:
-#line 1759 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = X_NEG; }
-#line 5029 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 442: /* side_name: LEFT  */
+#line 1848 "../src/mdlparse.y"
+                                                      { (yyval.tok) = X_NEG; }
+#line 5196 "mdlparse.c"
     break;
 
-  case 424:
-#line 1760 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = X_POS; }
-#line 5035 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 443: /* side_name: RIGHT  */
+#line 1849 "../src/mdlparse.y"
+                                                      { (yyval.tok) = X_POS; }
+#line 5202 "mdlparse.c"
     break;
 
-  case 425:
-#line 1761 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = ALL_SIDES; }
-#line 5041 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 444: /* side_name: ALL_ELEMENTS  */
+#line 1850 "../src/mdlparse.y"
+                                                      { (yyval.tok) = ALL_SIDES; }
+#line 5208 "mdlparse.c"
     break;
 
-  case 427:
-#line 1767 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.elem_list) = (yyvsp[-1].elem_list); mdl_add_elements_to_list(& (yyval.elem_list), (yyvsp[0].elem_list).elml_head, (yyvsp[0].elem_list).elml_tail); }
-#line 5047 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 446: /* element_specifier_list: element_specifier_list element_specifier  */
+#line 1856 "../src/mdlparse.y"
+                                                    { (yyval.elem_list) = (yyvsp[-1].elem_list); mdl_add_elements_to_list(& (yyval.elem_list), (yyvsp[0].elem_list).elml_head, (yyvsp[0].elem_list).elml_tail); }
+#line 5214 "mdlparse.c"
     break;
 
-  case 430:
-#line 1773 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.elem_list).elml_tail = (yyval.elem_list).elml_head = (yyvsp[0].elem_list_item); }
-#line 5053 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 449: /* element_specifier: prev_region_stmt  */
+#line 1862 "../src/mdlparse.y"
+                                                      { (yyval.elem_list).elml_tail = (yyval.elem_list).elml_head = (yyvsp[0].elem_list_item); }
+#line 5220 "mdlparse.c"
     break;
 
-  case 431:
-#line 1774 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.elem_list).elml_tail = (yyval.elem_list).elml_head = (yyvsp[0].elem_list_item); }
-#line 5059 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 450: /* element_specifier: patch_statement  */
+#line 1863 "../src/mdlparse.y"
+                                                      { (yyval.elem_list).elml_tail = (yyval.elem_list).elml_head = (yyvsp[0].elem_list_item); }
+#line 5226 "mdlparse.c"
     break;
 
-  case 432:
-#line 1779 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.elem_list) = (yyvsp[-1].elem_list); }
-#line 5065 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 451: /* incl_element_list_stmt: INCLUDE_ELEMENTS '=' '[' list_element_specs ']'  */
+#line 1868 "../src/mdlparse.y"
+                                                      { (yyval.elem_list) = (yyvsp[-1].elem_list); }
+#line 5232 "mdlparse.c"
     break;
 
-  case 433:
-#line 1784 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.elem_list) = (yyvsp[-1].elem_list); mdl_set_elements_to_exclude((yyval.elem_list).elml_head); }
-#line 5071 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 452: /* excl_element_list_stmt: EXCLUDE_ELEMENTS '=' '[' list_element_specs ']'  */
+#line 1873 "../src/mdlparse.y"
+                                                      { (yyval.elem_list) = (yyvsp[-1].elem_list); mdl_set_elements_to_exclude((yyval.elem_list).elml_head); }
+#line 5238 "mdlparse.c"
     break;
 
-  case 435:
-#line 1791 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.elem_list).elml_tail = (yyval.elem_list).elml_head = (yyvsp[0].elem_list_item); }
-#line 5077 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 454: /* list_element_specs: element_spec  */
+#line 1880 "../src/mdlparse.y"
+                                                      { (yyval.elem_list).elml_tail = (yyval.elem_list).elml_head = (yyvsp[0].elem_list_item); }
+#line 5244 "mdlparse.c"
     break;
 
-  case 436:
-#line 1792 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.elem_list) = (yyvsp[-2].elem_list); mdl_add_elements_to_list(& (yyval.elem_list), (yyvsp[0].elem_list_item), (yyvsp[0].elem_list_item)); }
-#line 5083 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 455: /* list_element_specs: list_element_specs ',' element_spec  */
+#line 1881 "../src/mdlparse.y"
+                                                      { (yyval.elem_list) = (yyvsp[-2].elem_list); mdl_add_elements_to_list(& (yyval.elem_list), (yyvsp[0].elem_list_item), (yyvsp[0].elem_list_item)); }
+#line 5250 "mdlparse.c"
     break;
 
-  case 437:
-#line 1795 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.elem_list_item) = new_element_list((unsigned int) (yyvsp[0].dbl), (unsigned int) (yyvsp[0].dbl))); }
-#line 5089 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 456: /* element_spec: num_expr  */
+#line 1884 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.elem_list_item) = new_element_list((unsigned int) (yyvsp[0].dbl), (unsigned int) (yyvsp[0].dbl))); }
+#line 5256 "mdlparse.c"
     break;
 
-  case 438:
-#line 1796 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.elem_list_item) = new_element_list((unsigned int) (yyvsp[-2].dbl), (unsigned int) (yyvsp[0].dbl))); }
-#line 5095 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 457: /* element_spec: num_expr TO num_expr  */
+#line 1885 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.elem_list_item) = new_element_list((unsigned int) (yyvsp[-2].dbl), (unsigned int) (yyvsp[0].dbl))); }
+#line 5262 "mdlparse.c"
     break;
 
-  case 439:
-#line 1797 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.elem_list_item) = mdl_new_element_side(parse_state, (yyvsp[0].tok))); }
-#line 5101 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 458: /* element_spec: side_name  */
+#line 1886 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.elem_list_item) = mdl_new_element_side(parse_state, (yyvsp[0].tok))); }
+#line 5268 "mdlparse.c"
     break;
 
-  case 440:
-#line 1800 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.elem_list_item) = mdl_new_element_previous_region(parse_state, parse_state->current_object, parse_state->current_region, (yyvsp[0].str), (yyvsp[-2].tok))); }
-#line 5107 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 459: /* prev_region_stmt: prev_region_type '=' var  */
+#line 1889 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.elem_list_item) = mdl_new_element_previous_region(parse_state, parse_state->current_object, parse_state->current_region, (yyvsp[0].str), (yyvsp[-2].tok))); }
+#line 5274 "mdlparse.c"
     break;
 
-  case 441:
-#line 1803 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 5113 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 460: /* prev_region_type: INCLUDE_REGION  */
+#line 1892 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 0; }
+#line 5280 "mdlparse.c"
     break;
 
-  case 442:
-#line 1804 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 1; }
-#line 5119 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 461: /* prev_region_type: EXCLUDE_REGION  */
+#line 1893 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 1; }
+#line 5286 "mdlparse.c"
     break;
 
-  case 443:
-#line 1807 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.elem_list_item) = mdl_new_element_patch(parse_state, parse_state->current_polygon, (yyvsp[-2].vec3), (yyvsp[0].vec3), (yyvsp[-4].tok))); }
-#line 5125 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 462: /* patch_statement: patch_type '=' point ',' point  */
+#line 1896 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.elem_list_item) = mdl_new_element_patch(parse_state, parse_state->current_polygon, (yyvsp[-2].vec3), (yyvsp[0].vec3), (yyvsp[-4].tok))); }
+#line 5292 "mdlparse.c"
     break;
 
-  case 444:
-#line 1810 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 5131 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 463: /* patch_type: INCLUDE_PATCH  */
+#line 1899 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 0; }
+#line 5298 "mdlparse.c"
     break;
 
-  case 445:
-#line 1811 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 1; }
-#line 5137 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 464: /* patch_type: EXCLUDE_PATCH  */
+#line 1900 "../src/mdlparse.y"
+                                                      { (yyval.tok) = 1; }
+#line 5304 "mdlparse.c"
     break;
 
-  case 449:
-#line 1827 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_region = (yyvsp[-1].reg); }
-#line 5143 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 468: /* $@10: %empty  */
+#line 1916 "../src/mdlparse.y"
+                                                      { parse_state->current_region = (yyvsp[-1].reg); }
+#line 5310 "mdlparse.c"
     break;
 
-  case 450:
-#line 1828 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_region_elements(parse_state, (yyvsp[-3].reg), (yyvsp[0].elem_list).elml_head, (yyvsp[-3].reg)->parent->object_type == POLY_OBJ)); }
-#line 5149 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 469: /* $@11: %empty  */
+#line 1917 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_region_elements(parse_state, (yyvsp[-3].reg), (yyvsp[0].elem_list).elml_head, (yyvsp[-3].reg)->parent->object_type == POLY_OBJ)); }
+#line 5316 "mdlparse.c"
     break;
 
-  case 451:
-#line 1830 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_region = NULL; }
-#line 5155 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 470: /* in_obj_surface_region_def: new_region '{' $@10 element_specifier_list $@11 list_opt_surface_region_stmts '}'  */
+#line 1919 "../src/mdlparse.y"
+                                                      { parse_state->current_region = NULL; }
+#line 5322 "mdlparse.c"
     break;
 
-  case 452:
-#line 1838 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 471: /* $@12: %empty  */
+#line 1927 "../src/mdlparse.y"
+                                                      {
                                                         CHECKN(mdl_new_voxel_list(parse_state, (yyvsp[-4].sym),
                                                                                   (yyvsp[-1].vertlist).vertex_count, (yyvsp[-1].vertlist).vertex_head,
                                                                                   (yyvsp[0].ecl).connection_count, (yyvsp[0].ecl).connection_head));
                                                       }
-#line 5165 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5332 "mdlparse.c"
     break;
 
-  case 453:
-#line 1844 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.obj) = (struct object *) (yyvsp[-7].sym)->value; }
-#line 5171 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 472: /* voxel_list_def: new_object VOXEL_LIST start_object vertex_list_cmd tet_element_connection_cmd $@12 list_opt_object_cmds end_object  */
+#line 1933 "../src/mdlparse.y"
+                                                      { (yyval.obj) = (struct object *) (yyvsp[-7].sym)->value; }
+#line 5338 "mdlparse.c"
     break;
 
-  case 454:
-#line 1849 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ecl) = (yyvsp[-1].ecl); }
-#line 5177 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 473: /* tet_element_connection_cmd: TET_ELEMENT_CONNECTIONS '{' list_tet_arrays '}'  */
+#line 1938 "../src/mdlparse.y"
+                                                      { (yyval.ecl) = (yyvsp[-1].ecl); }
+#line 5344 "mdlparse.c"
     break;
 
-  case 455:
-#line 1852 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.elem_conn) = mdl_new_tet_element_connection(parse_state, & (yyvsp[0].nlist))); }
-#line 5183 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 474: /* element_connection_tet: array_value  */
+#line 1941 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.elem_conn) = mdl_new_tet_element_connection(parse_state, & (yyvsp[0].nlist))); }
+#line 5350 "mdlparse.c"
     break;
 
-  case 456:
-#line 1856 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 475: /* list_tet_arrays: element_connection_tet  */
+#line 1945 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.ecl).connection_head = (yyval.ecl).connection_tail = (yyvsp[0].elem_conn);
                                                           (yyval.ecl).connection_count = 1;
                                                       }
-#line 5192 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5359 "mdlparse.c"
     break;
 
-  case 457:
-#line 1860 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 476: /* list_tet_arrays: list_tet_arrays element_connection_tet  */
+#line 1949 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.ecl) = (yyvsp[-1].ecl);
                                                           (yyval.ecl).connection_tail = (yyval.ecl).connection_tail->next = (yyvsp[0].elem_conn);
                                                           ++ (yyval.ecl).connection_count;
                                                       }
-#line 5202 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5369 "mdlparse.c"
     break;
 
-  case 458:
-#line 1870 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->vol->periodic_traditional = (yyvsp[0].tok); }
-#line 5208 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 477: /* $@13: %empty  */
+#line 1959 "../src/mdlparse.y"
+                                                      { parse_state->vol->periodic_traditional = (yyvsp[0].tok); }
+#line 5375 "mdlparse.c"
     break;
 
-  case 459:
-#line 1873 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN(mdl_create_periodic_box(parse_state, (yyvsp[-7].vec3), (yyvsp[-5].vec3), (yyvsp[-2].tok), (yyvsp[-1].tok), (yyvsp[0].tok))); }
-#line 5214 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 478: /* $@14: %empty  */
+#line 1962 "../src/mdlparse.y"
+                                                      { CHECKN(mdl_create_periodic_box(parse_state, (yyvsp[-7].vec3), (yyvsp[-5].vec3), (yyvsp[-2].tok), (yyvsp[-1].tok), (yyvsp[0].tok))); }
+#line 5381 "mdlparse.c"
     break;
 
-  case 460:
-#line 1874 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_finish_periodic_box(parse_state)); }
-#line 5220 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 479: /* periodic_box_def: PERIODIC_BOX start_object CORNERS '=' point ',' point periodic_traditional $@13 periodic_x_def periodic_y_def periodic_z_def $@14 end_object  */
+#line 1963 "../src/mdlparse.y"
+                                                      { CHECK(mdl_finish_periodic_box(parse_state)); }
+#line 5387 "mdlparse.c"
     break;
 
-  case 461:
-#line 1880 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN(mdl_new_box_object(parse_state, (yyvsp[-8].sym), (yyvsp[-3].vec3), (yyvsp[-1].vec3))); }
-#line 5226 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 480: /* $@15: %empty  */
+#line 1969 "../src/mdlparse.y"
+                                                      { CHECKN(mdl_new_box_object(parse_state, (yyvsp[-8].sym), (yyvsp[-3].vec3), (yyvsp[-1].vec3))); }
+#line 5393 "mdlparse.c"
     break;
 
-  case 462:
-#line 1881 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_triangulate_box_object(parse_state, (yyvsp[-10].sym), parse_state->current_polygon, (yyvsp[-2].dbl))); }
-#line 5232 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 481: /* $@16: %empty  */
+#line 1970 "../src/mdlparse.y"
+                                                      { CHECK(mdl_triangulate_box_object(parse_state, (yyvsp[-10].sym), parse_state->current_polygon, (yyvsp[-2].dbl))); }
+#line 5399 "mdlparse.c"
     break;
 
-  case 463:
-#line 1883 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 482: /* box_def: new_object BOX start_object CORNERS '=' point ',' point opt_aspect_ratio_def $@15 list_opt_polygon_object_cmds $@16 list_opt_object_cmds end_object  */
+#line 1972 "../src/mdlparse.y"
+                                                      {
                                                           CHECK(mdl_finish_box_object(parse_state, (yyvsp[-13].sym)));
                                                           (yyval.obj) = (struct object *) (yyvsp[-13].sym)->value;
                                                       }
-#line 5241 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5408 "mdlparse.c"
     break;
 
-  case 464:
-#line 1890 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 5247 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 483: /* periodic_x_def: %empty  */
+#line 1979 "../src/mdlparse.y"
+                                { (yyval.tok) = 0; }
+#line 5414 "mdlparse.c"
     break;
 
-  case 465:
-#line 1891 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = (yyvsp[0].tok); }
-#line 5253 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 484: /* periodic_x_def: PERIODIC_X '=' boolean  */
+#line 1980 "../src/mdlparse.y"
+                                     { (yyval.tok) = (yyvsp[0].tok); }
+#line 5420 "mdlparse.c"
     break;
 
-  case 466:
-#line 1895 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 5259 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 485: /* periodic_y_def: %empty  */
+#line 1984 "../src/mdlparse.y"
+                                { (yyval.tok) = 0; }
+#line 5426 "mdlparse.c"
     break;
 
-  case 467:
-#line 1896 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = (yyvsp[0].tok); }
-#line 5265 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 486: /* periodic_y_def: PERIODIC_Y '=' boolean  */
+#line 1985 "../src/mdlparse.y"
+                                     { (yyval.tok) = (yyvsp[0].tok); }
+#line 5432 "mdlparse.c"
     break;
 
-  case 468:
-#line 1900 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 5271 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 487: /* periodic_z_def: %empty  */
+#line 1989 "../src/mdlparse.y"
+                                { (yyval.tok) = 0; }
+#line 5438 "mdlparse.c"
     break;
 
-  case 469:
-#line 1901 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = (yyvsp[0].tok); }
-#line 5277 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 488: /* periodic_z_def: PERIODIC_Z '=' boolean  */
+#line 1990 "../src/mdlparse.y"
+                                     { (yyval.tok) = (yyvsp[0].tok); }
+#line 5444 "mdlparse.c"
     break;
 
-  case 470:
-#line 1905 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = 0; }
-#line 5283 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 489: /* periodic_traditional: %empty  */
+#line 1994 "../src/mdlparse.y"
+                                      { (yyval.tok) = 0; }
+#line 5450 "mdlparse.c"
     break;
 
-  case 471:
-#line 1906 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = (yyvsp[0].tok); }
-#line 5289 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 490: /* periodic_traditional: PERIODIC_TRADITIONAL '=' boolean  */
+#line 1995 "../src/mdlparse.y"
+                                               { (yyval.tok) = (yyvsp[0].tok); }
+#line 5456 "mdlparse.c"
     break;
 
-  case 472:
-#line 1909 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = 0.0; }
-#line 5295 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 491: /* opt_aspect_ratio_def: %empty  */
+#line 1998 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = 0.0; }
+#line 5462 "mdlparse.c"
     break;
 
-  case 473:
-#line 1910 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 492: /* opt_aspect_ratio_def: ASPECT_RATIO '=' num_expr  */
+#line 1999 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.dbl) = (yyvsp[0].dbl);
                                                         if ((yyval.dbl) < 2.0)
                                                         {
@@ -5304,91 +5471,91 @@ yyreduce:
                                                           return 1;
                                                         }
                                                       }
-#line 5308 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5475 "mdlparse.c"
     break;
 
-  case 477:
-#line 1936 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_start_existing_obj_region_def(parse_state, (yyvsp[0].sym))); }
-#line 5314 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 496: /* $@17: %empty  */
+#line 2025 "../src/mdlparse.y"
+                                                      { CHECK(mdl_start_existing_obj_region_def(parse_state, (yyvsp[0].sym))); }
+#line 5481 "mdlparse.c"
     break;
 
-  case 478:
-#line 1937 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_region = (yyvsp[-1].reg); }
-#line 5320 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 497: /* $@18: %empty  */
+#line 2026 "../src/mdlparse.y"
+                                                      { parse_state->current_region = (yyvsp[-1].reg); }
+#line 5487 "mdlparse.c"
     break;
 
-  case 479:
-#line 1939 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_set_region_elements(parse_state, (yyvsp[-4].reg), (yyvsp[0].elem_list).elml_head, 1); }
-#line 5326 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 498: /* $@19: %empty  */
+#line 2028 "../src/mdlparse.y"
+                                                      { mdl_set_region_elements(parse_state, (yyvsp[-4].reg), (yyvsp[0].elem_list).elml_head, 1); }
+#line 5493 "mdlparse.c"
     break;
 
-  case 480:
-#line 1941 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 499: /* existing_obj_surface_region_def: existing_object $@17 '[' new_region ']' $@18 '{' element_specifier_list $@19 list_opt_surface_region_stmts '}'  */
+#line 2030 "../src/mdlparse.y"
+                                                      {
                                                           parse_state->current_region = NULL;
                                                           parse_state->current_polygon = NULL;
                                                           parse_state->current_object = parse_state->vol->root_object;
                                                       }
-#line 5336 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5503 "mdlparse.c"
     break;
 
-  case 481:
-#line 1948 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.reg) = mdl_create_region(parse_state, parse_state->current_object, (yyvsp[0].str))); }
-#line 5342 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 500: /* new_region: var  */
+#line 2037 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.reg) = mdl_create_region(parse_state, parse_state->current_object, (yyvsp[0].str))); }
+#line 5509 "mdlparse.c"
     break;
 
-  case 485:
-#line 1959 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_add_surf_mol_to_region(parse_state->current_region, & (yyvsp[0].surf_mol_dat_list)); }
-#line 5348 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 504: /* opt_surface_region_stmt: surface_mol_stmt  */
+#line 2048 "../src/mdlparse.y"
+                                                      { mdl_add_surf_mol_to_region(parse_state->current_region, & (yyvsp[0].surf_mol_dat_list)); }
+#line 5515 "mdlparse.c"
     break;
 
-  case 486:
-#line 1963 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { mdl_set_region_surface_class(parse_state, parse_state->current_region, (yyvsp[0].sym)); }
-#line 5354 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 505: /* set_surface_class_stmt: SURFACE_CLASS '=' existing_surface_class  */
+#line 2052 "../src/mdlparse.y"
+                                                      { mdl_set_region_surface_class(parse_state, parse_state->current_region, (yyvsp[0].sym)); }
+#line 5521 "mdlparse.c"
     break;
 
-  case 490:
-#line 1982 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_region = (struct region *) (yyvsp[-1].sym)->value; }
-#line 5360 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 509: /* $@20: %empty  */
+#line 2071 "../src/mdlparse.y"
+                                                      { parse_state->current_region = (struct region *) (yyvsp[-1].sym)->value; }
+#line 5527 "mdlparse.c"
     break;
 
-  case 491:
-#line 1984 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->current_region = NULL; }
-#line 5366 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 510: /* existing_surface_region_ref: existing_region '{' $@20 list_opt_surface_region_stmts '}'  */
+#line 2073 "../src/mdlparse.y"
+                                                      { parse_state->current_region = NULL; }
+#line 5533 "mdlparse.c"
     break;
 
-  case 492:
-#line 1992 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 511: /* $@21: %empty  */
+#line 2081 "../src/mdlparse.y"
+                                                      {
                                                           parse_state->header_comment = NULL;  /* No header by default */
                                                           parse_state->exact_time_flag = 1;    /* Print exact_time column in TRIGGER output by default */
                                                       }
-#line 5375 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5542 "mdlparse.c"
     break;
 
-  case 493:
-#line 1998 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_add_reaction_output_block_to_world(parse_state, (int) (yyvsp[-4].dbl), & (yyvsp[-2].ro_otimes), & (yyvsp[-1].ro_sets))); }
-#line 5381 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 512: /* output_def: REACTION_DATA_OUTPUT '{' output_buffer_size_def $@21 output_timer_def list_count_cmds '}'  */
+#line 2087 "../src/mdlparse.y"
+                                                      { CHECK(mdl_add_reaction_output_block_to_world(parse_state, (int) (yyvsp[-4].dbl), & (yyvsp[-2].ro_otimes), & (yyvsp[-1].ro_sets))); }
+#line 5548 "mdlparse.c"
     break;
 
-  case 494:
-#line 2002 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.dbl) = COUNTBUFFERSIZE; }
-#line 5387 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 513: /* output_buffer_size_def: %empty  */
+#line 2091 "../src/mdlparse.y"
+                                                      { (yyval.dbl) = COUNTBUFFERSIZE; }
+#line 5554 "mdlparse.c"
     break;
 
-  case 495:
-#line 2003 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 514: /* output_buffer_size_def: OUTPUT_BUFFER_SIZE '=' num_expr  */
+#line 2092 "../src/mdlparse.y"
+                                                      {
                                                           double temp_value = (yyvsp[0].dbl);
                                                           if (!(temp_value >= 1.0 && temp_value < UINT_MAX))
                                                           {
@@ -5397,48 +5564,48 @@ yyreduce:
                                                           }
                                                           (yyval.dbl) = (yyvsp[0].dbl);
                                                       }
-#line 5401 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5568 "mdlparse.c"
     break;
 
-  case 499:
-#line 2019 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ro_otimes).type = OUTPUT_BY_STEP; (yyval.ro_otimes).step = (yyvsp[0].dbl); }
-#line 5407 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 518: /* step_time_def: STEP '=' num_expr  */
+#line 2108 "../src/mdlparse.y"
+                                                      { (yyval.ro_otimes).type = OUTPUT_BY_STEP; (yyval.ro_otimes).step = (yyvsp[0].dbl); }
+#line 5574 "mdlparse.c"
     break;
 
-  case 500:
-#line 2023 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 519: /* iteration_time_def: ITERATION_LIST '=' array_value  */
+#line 2112 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.ro_otimes).type = OUTPUT_BY_ITERATION_LIST;
                                                         (yyval.ro_otimes).values = (yyvsp[0].nlist);
                                                       }
-#line 5416 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5583 "mdlparse.c"
     break;
 
-  case 501:
-#line 2031 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 520: /* real_time_def: TIME_LIST '=' array_value  */
+#line 2120 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.ro_otimes).type = OUTPUT_BY_TIME_LIST;
                                                         (yyval.ro_otimes).values = (yyvsp[0].nlist);
                                                       }
-#line 5425 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5592 "mdlparse.c"
     break;
 
-  case 502:
-#line 2038 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ro_sets).set_head = (yyval.ro_sets).set_tail = NULL; }
-#line 5431 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 521: /* list_count_cmds: %empty  */
+#line 2127 "../src/mdlparse.y"
+                                                      { (yyval.ro_sets).set_head = (yyval.ro_sets).set_tail = NULL; }
+#line 5598 "mdlparse.c"
     break;
 
-  case 503:
-#line 2039 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ro_sets).set_head = (yyval.ro_sets).set_tail = (yyvsp[0].ro_set); }
-#line 5437 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 522: /* list_count_cmds: count_cmd  */
+#line 2128 "../src/mdlparse.y"
+                                                      { (yyval.ro_sets).set_head = (yyval.ro_sets).set_tail = (yyvsp[0].ro_set); }
+#line 5604 "mdlparse.c"
     break;
 
-  case 504:
-#line 2041 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 523: /* list_count_cmds: list_count_cmds count_cmd  */
+#line 2130 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.ro_sets) = (yyvsp[-1].ro_sets);
                                                         if ((yyvsp[0].ro_set) != NULL)
                                                         {
@@ -5448,196 +5615,196 @@ yyreduce:
                                                             (yyval.ro_sets).set_tail = (yyval.ro_sets).set_head = (yyvsp[0].ro_set);
                                                         }
                                                       }
-#line 5452 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5619 "mdlparse.c"
     break;
 
-  case 506:
-#line 2055 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ro_set) = NULL; }
-#line 5458 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 525: /* count_cmd: custom_header  */
+#line 2144 "../src/mdlparse.y"
+                                                      { (yyval.ro_set) = NULL; }
+#line 5625 "mdlparse.c"
     break;
 
-  case 507:
-#line 2056 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ro_set) = NULL; }
-#line 5464 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 526: /* count_cmd: exact_time_toggle  */
+#line 2145 "../src/mdlparse.y"
+                                                      { (yyval.ro_set) = NULL; }
+#line 5631 "mdlparse.c"
     break;
 
-  case 508:
-#line 2060 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {  parse_state->count_flags = 0; }
-#line 5470 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 527: /* $@22: %empty  */
+#line 2149 "../src/mdlparse.y"
+                                                      {  parse_state->count_flags = 0; }
+#line 5637 "mdlparse.c"
     break;
 
-  case 509:
-#line 2062 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.ro_set) = mdl_populate_output_set(parse_state, parse_state->header_comment, parse_state->exact_time_flag, (yyvsp[-3].ro_cols).column_head, (yyvsp[-1].tok), (yyvsp[0].str))); }
-#line 5476 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 528: /* count_stmt: '{' $@22 list_count_exprs '}' file_arrow outfile_syntax  */
+#line 2151 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.ro_set) = mdl_populate_output_set(parse_state, parse_state->header_comment, parse_state->exact_time_flag, (yyvsp[-3].ro_cols).column_head, (yyvsp[-1].tok), (yyvsp[0].str))); }
+#line 5643 "mdlparse.c"
     break;
 
-  case 510:
-#line 2066 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.str) = NULL; }
-#line 5482 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 529: /* custom_header_value: NONE  */
+#line 2155 "../src/mdlparse.y"
+                                                      { (yyval.str) = NULL; }
+#line 5649 "mdlparse.c"
     break;
 
-  case 511:
-#line 2067 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.str) = ((yyvsp[0].tok) ? "" : NULL); }
-#line 5488 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 530: /* custom_header_value: boolean  */
+#line 2156 "../src/mdlparse.y"
+                                                      { (yyval.str) = ((yyvsp[0].tok) ? "" : NULL); }
+#line 5655 "mdlparse.c"
     break;
 
-  case 512:
-#line 2068 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); }
-#line 5494 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 531: /* custom_header_value: str_expr  */
+#line 2157 "../src/mdlparse.y"
+                                                      { (yyval.str) = (yyvsp[0].str); }
+#line 5661 "mdlparse.c"
     break;
 
-  case 513:
-#line 2072 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->header_comment = (yyvsp[0].str); }
-#line 5500 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 532: /* custom_header: HEADER '=' custom_header_value  */
+#line 2161 "../src/mdlparse.y"
+                                                      { parse_state->header_comment = (yyvsp[0].str); }
+#line 5667 "mdlparse.c"
     break;
 
-  case 514:
-#line 2076 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->exact_time_flag = (yyvsp[0].tok); }
-#line 5506 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 533: /* exact_time_toggle: SHOW_EXACT_TIME '=' boolean  */
+#line 2165 "../src/mdlparse.y"
+                                                      { parse_state->exact_time_flag = (yyvsp[0].tok); }
+#line 5673 "mdlparse.c"
     break;
 
-  case 516:
-#line 2082 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 535: /* list_count_exprs: list_count_exprs ',' single_count_expr  */
+#line 2171 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.ro_cols) = (yyvsp[-2].ro_cols);
                                                           (yyval.ro_cols).column_tail->next = (yyvsp[0].ro_cols).column_head;
                                                           (yyval.ro_cols).column_tail = (yyvsp[0].ro_cols).column_tail;
                                                       }
-#line 5516 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5683 "mdlparse.c"
     break;
 
-  case 517:
-#line 2090 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_single_count_expr(parse_state, & (yyval.ro_cols), (yyvsp[-1].cnt), (yyvsp[0].str))); }
-#line 5522 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 536: /* single_count_expr: count_expr opt_custom_header  */
+#line 2179 "../src/mdlparse.y"
+                                                      { CHECK(mdl_single_count_expr(parse_state, & (yyval.ro_cols), (yyvsp[-1].cnt), (yyvsp[0].str))); }
+#line 5689 "mdlparse.c"
     break;
 
-  case 518:
-#line 2094 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_new_oexpr_constant(parse_state, (yyvsp[0].dbl))); }
-#line 5528 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 537: /* count_expr: num_value  */
+#line 2183 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_new_oexpr_constant(parse_state, (yyvsp[0].dbl))); }
+#line 5695 "mdlparse.c"
     break;
 
-  case 520:
-#line 2096 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-1].cnt), NULL, '(')); }
-#line 5534 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 539: /* count_expr: '(' count_expr ')'  */
+#line 2185 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-1].cnt), NULL, '(')); }
+#line 5701 "mdlparse.c"
     break;
 
-  case 521:
-#line 2097 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-2].cnt),   (yyvsp[0].cnt), '+')); }
-#line 5540 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 540: /* count_expr: count_expr '+' count_expr  */
+#line 2186 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-2].cnt),   (yyvsp[0].cnt), '+')); }
+#line 5707 "mdlparse.c"
     break;
 
-  case 522:
-#line 2098 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-2].cnt),   (yyvsp[0].cnt), '-')); }
-#line 5546 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 541: /* count_expr: count_expr '-' count_expr  */
+#line 2187 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-2].cnt),   (yyvsp[0].cnt), '-')); }
+#line 5713 "mdlparse.c"
     break;
 
-  case 523:
-#line 2099 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-2].cnt),   (yyvsp[0].cnt), '*')); }
-#line 5552 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 542: /* count_expr: count_expr '*' count_expr  */
+#line 2188 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-2].cnt),   (yyvsp[0].cnt), '*')); }
+#line 5719 "mdlparse.c"
     break;
 
-  case 524:
-#line 2100 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-2].cnt),   (yyvsp[0].cnt), '/')); }
-#line 5558 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 543: /* count_expr: count_expr '/' count_expr  */
+#line 2189 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[-2].cnt),   (yyvsp[0].cnt), '/')); }
+#line 5725 "mdlparse.c"
     break;
 
-  case 525:
-#line 2101 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[0].cnt), NULL, '_')); }
-#line 5564 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 544: /* count_expr: '-' count_expr  */
+#line 2190 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_join_oexpr_tree(parse_state, (yyvsp[0].cnt), NULL, '_')); }
+#line 5731 "mdlparse.c"
     break;
 
-  case 526:
-#line 2102 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_sum_oexpr((yyvsp[-1].cnt))); }
-#line 5570 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 545: /* count_expr: SUMMATION_OPERATOR '(' count_expr ')'  */
+#line 2191 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_sum_oexpr((yyvsp[-1].cnt))); }
+#line 5737 "mdlparse.c"
     break;
 
-  case 527:
-#line 2107 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->count_flags |= COUNT_PRESENT; }
-#line 5576 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 546: /* $@23: %empty  */
+#line 2196 "../src/mdlparse.y"
+                                                      { parse_state->count_flags |= COUNT_PRESENT; }
+#line 5743 "mdlparse.c"
     break;
 
-  case 528:
-#line 2108 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.cnt) = (yyvsp[-1].cnt); }
-#line 5582 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 547: /* count_value: COUNT $@23 '[' count_syntax ']'  */
+#line 2197 "../src/mdlparse.y"
+                                                      { (yyval.cnt) = (yyvsp[-1].cnt); }
+#line 5749 "mdlparse.c"
     break;
 
-  case 529:
-#line 2109 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_new_oexpr_constant(parse_state, (yyvsp[-1].dbl))); }
-#line 5588 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 548: /* count_value: EXPRESSION '[' num_expr ']'  */
+#line 2198 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_new_oexpr_constant(parse_state, (yyvsp[-1].dbl))); }
+#line 5755 "mdlparse.c"
     break;
 
-  case 530:
-#line 2110 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { parse_state->count_flags |= TRIGGER_PRESENT; }
-#line 5594 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 549: /* $@24: %empty  */
+#line 2199 "../src/mdlparse.y"
+                                                      { parse_state->count_flags |= TRIGGER_PRESENT; }
+#line 5761 "mdlparse.c"
     break;
 
-  case 531:
-#line 2111 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.cnt) = (yyvsp[-1].cnt); }
-#line 5600 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 550: /* count_value: TRIGGER $@24 '[' count_syntax ']'  */
+#line 2200 "../src/mdlparse.y"
+                                                      { (yyval.cnt) = (yyvsp[-1].cnt); }
+#line 5767 "mdlparse.c"
     break;
 
-  case 532:
-#line 2114 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = FILE_OVERWRITE; }
-#line 5606 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 551: /* file_arrow: '>'  */
+#line 2203 "../src/mdlparse.y"
+                                                      { (yyval.tok) = FILE_OVERWRITE; }
+#line 5773 "mdlparse.c"
     break;
 
-  case 533:
-#line 2115 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = FILE_SUBSTITUTE; }
-#line 5612 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 552: /* file_arrow: '=' '>'  */
+#line 2204 "../src/mdlparse.y"
+                                                      { (yyval.tok) = FILE_SUBSTITUTE; }
+#line 5779 "mdlparse.c"
     break;
 
-  case 534:
-#line 2116 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = FILE_APPEND; }
-#line 5618 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 553: /* file_arrow: '>' '>'  */
+#line 2205 "../src/mdlparse.y"
+                                                      { (yyval.tok) = FILE_APPEND; }
+#line 5785 "mdlparse.c"
     break;
 
-  case 535:
-#line 2117 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = FILE_APPEND_HEADER; }
-#line 5624 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 554: /* file_arrow: '>' '>' '>'  */
+#line 2206 "../src/mdlparse.y"
+                                                      { (yyval.tok) = FILE_APPEND_HEADER; }
+#line 5791 "mdlparse.c"
     break;
 
-  case 536:
-#line 2118 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = FILE_CREATE; }
-#line 5630 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 555: /* file_arrow: '+' '>'  */
+#line 2207 "../src/mdlparse.y"
+                                                      { (yyval.tok) = FILE_CREATE; }
+#line 5797 "mdlparse.c"
     break;
 
-  case 538:
-#line 2124 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.sym) = mdl_existing_rxn_pathname_or_molecule(parse_state, (yyvsp[0].str))); }
-#line 5636 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 557: /* existing_rxpn_or_molecule: var  */
+#line 2213 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.sym) = mdl_existing_rxn_pathname_or_molecule(parse_state, (yyvsp[0].str))); }
+#line 5803 "mdlparse.c"
     break;
 
-  case 539:
-#line 2128 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 558: /* existing_molecule_required_orient_braces: var orient_class_number  */
+#line 2217 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.mol_type) = (yyvsp[0].mol_type);
                                                         if ((yyval.mol_type).orient > 0)
                                                           (yyval.mol_type).orient = 1;
@@ -5645,204 +5812,204 @@ yyreduce:
                                                           (yyval.mol_type).orient = -1;
                                                         CHECKN((yyval.mol_type).mol_type = mdl_existing_molecule(parse_state, (yyvsp[-1].str)));
                                                       }
-#line 5649 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5816 "mdlparse.c"
     break;
 
-  case 546:
-#line 2148 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_count_syntax_1(parse_state, (yyvsp[-3].sym), (yyvsp[-1].sym), (yyvsp[0].tok), parse_state->count_flags)); }
-#line 5655 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 565: /* count_syntax_1: existing_rxpn_or_molecule ',' count_location_specifier opt_hit_spec  */
+#line 2237 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_count_syntax_1(parse_state, (yyvsp[-3].sym), (yyvsp[-1].sym), (yyvsp[0].tok), parse_state->count_flags)); }
+#line 5822 "mdlparse.c"
     break;
 
-  case 547:
-#line 2153 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_count_syntax_2(parse_state, (yyvsp[-3].mol_type).mol_type, (yyvsp[-3].mol_type).orient, (yyvsp[-1].sym), (yyvsp[0].tok), parse_state->count_flags)); }
-#line 5661 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 566: /* count_syntax_2: existing_molecule_required_orient_braces ',' count_location_specifier opt_hit_spec  */
+#line 2242 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_count_syntax_2(parse_state, (yyvsp[-3].mol_type).mol_type, (yyvsp[-3].mol_type).orient, (yyvsp[-1].sym), (yyvsp[0].tok), parse_state->count_flags)); }
+#line 5828 "mdlparse.c"
     break;
 
-  case 548:
-#line 2158 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_count_syntax_3(parse_state, (yyvsp[-3].str), (yyvsp[-1].sym), (yyvsp[0].tok), parse_state->count_flags)); }
-#line 5667 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 567: /* count_syntax_3: str_value ',' count_location_specifier opt_hit_spec  */
+#line 2247 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_count_syntax_3(parse_state, (yyvsp[-3].str), (yyvsp[-1].sym), (yyvsp[0].tok), parse_state->count_flags)); }
+#line 5834 "mdlparse.c"
     break;
 
-  case 549:
-#line 2164 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_count_syntax_periodic_1(parse_state, (yyvsp[-5].sym), (yyvsp[-3].sym), (yyvsp[-1].vec3), (yyvsp[0].tok), parse_state->count_flags)); }
-#line 5673 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 568: /* count_syntax_periodic_1: existing_rxpn_or_molecule ',' count_location_specifier ',' point opt_hit_spec  */
+#line 2253 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_count_syntax_periodic_1(parse_state, (yyvsp[-5].sym), (yyvsp[-3].sym), (yyvsp[-1].vec3), (yyvsp[0].tok), parse_state->count_flags)); }
+#line 5840 "mdlparse.c"
     break;
 
-  case 550:
-#line 2168 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_count_syntax_periodic_2(parse_state, (yyvsp[-5].mol_type).mol_type, (yyvsp[-5].mol_type).orient, (yyvsp[-3].sym), (yyvsp[-1].vec3), (yyvsp[0].tok), parse_state->count_flags)); }
-#line 5679 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 569: /* count_syntax_periodic_2: existing_molecule_required_orient_braces ',' count_location_specifier ',' point opt_hit_spec  */
+#line 2257 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_count_syntax_periodic_2(parse_state, (yyvsp[-5].mol_type).mol_type, (yyvsp[-5].mol_type).orient, (yyvsp[-3].sym), (yyvsp[-1].vec3), (yyvsp[0].tok), parse_state->count_flags)); }
+#line 5846 "mdlparse.c"
     break;
 
-  case 551:
-#line 2173 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.cnt) = mdl_count_syntax_periodic_3(parse_state, (yyvsp[-5].str), (yyvsp[-3].sym), (yyvsp[-1].vec3), (yyvsp[0].tok), parse_state->count_flags)); }
-#line 5685 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 570: /* count_syntax_periodic_3: str_value ',' count_location_specifier ',' point opt_hit_spec  */
+#line 2262 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.cnt) = mdl_count_syntax_periodic_3(parse_state, (yyvsp[-5].str), (yyvsp[-3].sym), (yyvsp[-1].vec3), (yyvsp[0].tok), parse_state->count_flags)); }
+#line 5852 "mdlparse.c"
     break;
 
-  case 552:
-#line 2176 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.sym) = NULL; }
-#line 5691 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 571: /* count_location_specifier: WORLD  */
+#line 2265 "../src/mdlparse.y"
+                                                      { (yyval.sym) = NULL; }
+#line 5858 "mdlparse.c"
     break;
 
-  case 553:
-#line 2177 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.sym) = (yyvsp[0].sym); }
-#line 5697 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 572: /* count_location_specifier: existing_region  */
+#line 2266 "../src/mdlparse.y"
+                                                      { (yyval.sym) = (yyvsp[0].sym); }
+#line 5864 "mdlparse.c"
     break;
 
-  case 554:
-#line 2178 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.sym) = (yyvsp[0].sym); }
-#line 5703 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 573: /* count_location_specifier: existing_object  */
+#line 2267 "../src/mdlparse.y"
+                                                      { (yyval.sym) = (yyvsp[0].sym); }
+#line 5870 "mdlparse.c"
     break;
 
-  case 555:
-#line 2181 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = REPORT_NOTHING; }
-#line 5709 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 574: /* opt_hit_spec: %empty  */
+#line 2270 "../src/mdlparse.y"
+                                                      { (yyval.tok) = REPORT_NOTHING; }
+#line 5876 "mdlparse.c"
     break;
 
-  case 556:
-#line 2182 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = (yyvsp[0].tok); }
-#line 5715 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 575: /* opt_hit_spec: ',' hit_spec  */
+#line 2271 "../src/mdlparse.y"
+                                                      { (yyval.tok) = (yyvsp[0].tok); }
+#line 5882 "mdlparse.c"
     break;
 
-  case 557:
-#line 2185 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = REPORT_FRONT_HITS; }
-#line 5721 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 576: /* hit_spec: FRONT_HITS  */
+#line 2274 "../src/mdlparse.y"
+                                                      { (yyval.tok) = REPORT_FRONT_HITS; }
+#line 5888 "mdlparse.c"
     break;
 
-  case 558:
-#line 2186 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = REPORT_BACK_HITS; }
-#line 5727 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 577: /* hit_spec: BACK_HITS  */
+#line 2275 "../src/mdlparse.y"
+                                                      { (yyval.tok) = REPORT_BACK_HITS; }
+#line 5894 "mdlparse.c"
     break;
 
-  case 559:
-#line 2187 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = REPORT_ALL_HITS; }
-#line 5733 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 578: /* hit_spec: ALL_HITS  */
+#line 2276 "../src/mdlparse.y"
+                                                      { (yyval.tok) = REPORT_ALL_HITS; }
+#line 5900 "mdlparse.c"
     break;
 
-  case 560:
-#line 2188 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = REPORT_FRONT_CROSSINGS; }
-#line 5739 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 579: /* hit_spec: FRONT_CROSSINGS  */
+#line 2277 "../src/mdlparse.y"
+                                                      { (yyval.tok) = REPORT_FRONT_CROSSINGS; }
+#line 5906 "mdlparse.c"
     break;
 
-  case 561:
-#line 2189 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = REPORT_BACK_CROSSINGS; }
-#line 5745 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 580: /* hit_spec: BACK_CROSSINGS  */
+#line 2278 "../src/mdlparse.y"
+                                                      { (yyval.tok) = REPORT_BACK_CROSSINGS; }
+#line 5912 "mdlparse.c"
     break;
 
-  case 562:
-#line 2190 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = REPORT_ALL_CROSSINGS; }
-#line 5751 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 581: /* hit_spec: ALL_CROSSINGS  */
+#line 2279 "../src/mdlparse.y"
+                                                      { (yyval.tok) = REPORT_ALL_CROSSINGS; }
+#line 5918 "mdlparse.c"
     break;
 
-  case 563:
-#line 2191 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = REPORT_CONCENTRATION; }
-#line 5757 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 582: /* hit_spec: ESTIMATE_CONCENTRATION  */
+#line 2280 "../src/mdlparse.y"
+                                                      { (yyval.tok) = REPORT_CONCENTRATION; }
+#line 5924 "mdlparse.c"
     break;
 
-  case 564:
-#line 2192 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = REPORT_ENCLOSED; }
-#line 5763 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 583: /* hit_spec: ALL_ENCLOSED  */
+#line 2281 "../src/mdlparse.y"
+                                                      { (yyval.tok) = REPORT_ENCLOSED; }
+#line 5930 "mdlparse.c"
     break;
 
-  case 565:
-#line 2195 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.str) = NULL; }
-#line 5769 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 584: /* opt_custom_header: %empty  */
+#line 2284 "../src/mdlparse.y"
+                                                      { (yyval.str) = NULL; }
+#line 5936 "mdlparse.c"
     break;
 
-  case 566:
-#line 2196 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); }
-#line 5775 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 585: /* opt_custom_header: ':' str_expr  */
+#line 2285 "../src/mdlparse.y"
+                                                      { (yyval.str) = (yyvsp[0].str); }
+#line 5942 "mdlparse.c"
     break;
 
-  case 567:
-#line 2203 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_new_viz_output_block(parse_state)); }
-#line 5781 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 586: /* $@25: %empty  */
+#line 2292 "../src/mdlparse.y"
+                                                      { CHECK(mdl_new_viz_output_block(parse_state)); }
+#line 5948 "mdlparse.c"
     break;
 
-  case 568:
-#line 2206 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { }
-#line 5787 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 587: /* viz_output_def: VIZ_OUTPUT '{' $@25 viz_output_maybe_mode_cmd list_viz_output_cmds '}'  */
+#line 2295 "../src/mdlparse.y"
+                                                      { }
+#line 5954 "mdlparse.c"
     break;
 
-  case 571:
-#line 2215 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_viz_mode(parse_state->vol->viz_blocks, CELLBLENDER_MODE)); }
-#line 5793 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 590: /* viz_output_maybe_mode_cmd: %empty  */
+#line 2304 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_viz_mode(parse_state->vol->viz_blocks, CELLBLENDER_MODE)); }
+#line 5960 "mdlparse.c"
     break;
 
-  case 572:
-#line 2216 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_viz_mode(parse_state->vol->viz_blocks, (yyvsp[0].ival))); }
-#line 5799 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 591: /* viz_output_maybe_mode_cmd: viz_mode_def  */
+#line 2305 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_viz_mode(parse_state->vol->viz_blocks, (yyvsp[0].ival))); }
+#line 5966 "mdlparse.c"
     break;
 
-  case 573:
-#line 2219 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ival) = NO_VIZ_MODE; }
-#line 5805 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 592: /* viz_mode_def: MODE '=' NONE  */
+#line 2308 "../src/mdlparse.y"
+                                                      { (yyval.ival) = NO_VIZ_MODE; }
+#line 5972 "mdlparse.c"
     break;
 
-  case 574:
-#line 2220 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ival) = ASCII_MODE; }
-#line 5811 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 593: /* viz_mode_def: MODE '=' ASCII  */
+#line 2309 "../src/mdlparse.y"
+                                                      { (yyval.ival) = ASCII_MODE; }
+#line 5978 "mdlparse.c"
     break;
 
-  case 575:
-#line 2221 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ival) = CELLBLENDER_MODE; }
-#line 5817 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 594: /* viz_mode_def: MODE '=' CELLBLENDER  */
+#line 2310 "../src/mdlparse.y"
+                                                      { (yyval.ival) = CELLBLENDER_MODE; }
+#line 5984 "mdlparse.c"
     break;
 
-  case 577:
-#line 2226 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 596: /* viz_output_cmd: viz_frames_def  */
+#line 2315 "../src/mdlparse.y"
+                                                      {
                                                         if ((yyvsp[0].frame_list).frame_head)
                                                         {
                                                           (yyvsp[0].frame_list).frame_tail->next = parse_state->vol->viz_blocks->frame_data_head;
                                                           parse_state->vol->viz_blocks->frame_data_head = (yyvsp[0].frame_list).frame_head;
                                                         }
                                                       }
-#line 5829 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 5996 "mdlparse.c"
     break;
 
-  case 579:
-#line 2239 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_viz_filename_prefix(parse_state, parse_state->vol->viz_blocks, (yyvsp[0].str))); }
-#line 5835 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 598: /* viz_filename_prefix_def: FILENAME '=' str_expr  */
+#line 2328 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_viz_filename_prefix(parse_state, parse_state->vol->viz_blocks, (yyvsp[0].str))); }
+#line 6002 "mdlparse.c"
     break;
 
-  case 580:
-#line 2245 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.frame_list) = (yyvsp[-1].frame_list); }
-#line 5841 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 599: /* viz_molecules_block_def: MOLECULES '{' list_viz_molecules_block_cmds '}'  */
+#line 2334 "../src/mdlparse.y"
+                                                      { (yyval.frame_list) = (yyvsp[-1].frame_list); }
+#line 6008 "mdlparse.c"
     break;
 
-  case 582:
-#line 2251 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 601: /* list_viz_molecules_block_cmds: list_viz_molecules_block_cmds viz_molecules_block_cmd  */
+#line 2340 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.frame_list) = (yyvsp[-1].frame_list);
                                                         if ((yyval.frame_list).frame_tail)
                                                         {
@@ -5853,66 +6020,66 @@ yyreduce:
                                                         else
                                                           (yyval.frame_list) = (yyvsp[0].frame_list);
                                                       }
-#line 5857 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 6024 "mdlparse.c"
     break;
 
-  case 583:
-#line 2265 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.frame_list).frame_head = (yyval.frame_list).frame_tail = NULL; }
-#line 5863 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 602: /* viz_molecules_block_cmd: viz_molecules_name_list_cmd  */
+#line 2354 "../src/mdlparse.y"
+                                                      { (yyval.frame_list).frame_head = (yyval.frame_list).frame_tail = NULL; }
+#line 6030 "mdlparse.c"
     break;
 
-  case 587:
-#line 2277 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_viz_state(parse_state, & (yyval.ival), (yyvsp[0].dbl))); }
-#line 5869 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 606: /* optional_state: '=' num_expr  */
+#line 2366 "../src/mdlparse.y"
+                                                      { CHECK(mdl_viz_state(parse_state, & (yyval.ival), (yyvsp[0].dbl))); }
+#line 6036 "mdlparse.c"
     break;
 
-  case 588:
-#line 2278 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.ival) = INCLUDE_OBJ; }
-#line 5875 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 607: /* optional_state: %empty  */
+#line 2367 "../src/mdlparse.y"
+                                                      { (yyval.ival) = INCLUDE_OBJ; }
+#line 6042 "mdlparse.c"
     break;
 
-  case 591:
-#line 2288 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_viz_include_molecules(parse_state, parse_state->vol->viz_blocks, (yyvsp[-1].symlist), (yyvsp[0].ival))); }
-#line 5881 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 610: /* viz_include_mols_cmd: existing_one_or_multiple_molecules optional_state  */
+#line 2377 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_viz_include_molecules(parse_state, parse_state->vol->viz_blocks, (yyvsp[-1].symlist), (yyvsp[0].ival))); }
+#line 6048 "mdlparse.c"
     break;
 
-  case 592:
-#line 2289 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_set_viz_include_all_molecules(parse_state->vol->viz_blocks, (yyvsp[0].ival))); }
-#line 5887 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 611: /* viz_include_mols_cmd: ALL_MOLECULES optional_state  */
+#line 2378 "../src/mdlparse.y"
+                                                      { CHECK(mdl_set_viz_include_all_molecules(parse_state->vol->viz_blocks, (yyvsp[0].ival))); }
+#line 6054 "mdlparse.c"
     break;
 
-  case 593:
-#line 2293 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.symlist) = mdl_existing_molecule_list(parse_state, (yyvsp[0].str))); }
-#line 5893 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 612: /* existing_one_or_multiple_molecules: var  */
+#line 2382 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.symlist) = mdl_existing_molecule_list(parse_state, (yyvsp[0].str))); }
+#line 6060 "mdlparse.c"
     break;
 
-  case 594:
-#line 2294 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.symlist) = mdl_existing_molecules_wildcard(parse_state, (yyvsp[0].str))); }
-#line 5899 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 613: /* existing_one_or_multiple_molecules: str_value  */
+#line 2383 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.symlist) = mdl_existing_molecules_wildcard(parse_state, (yyvsp[0].str))); }
+#line 6066 "mdlparse.c"
     break;
 
-  case 595:
-#line 2298 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_new_viz_all_times(parse_state, & (yyval.nlist))); }
-#line 5905 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 614: /* viz_time_spec: ALL_TIMES  */
+#line 2387 "../src/mdlparse.y"
+                                                      { CHECK(mdl_new_viz_all_times(parse_state, & (yyval.nlist))); }
+#line 6072 "mdlparse.c"
     break;
 
-  case 597:
-#line 2304 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.frame_list) = (yyvsp[-1].frame_list); }
-#line 5911 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 616: /* viz_molecules_time_points_def: TIME_POINTS '{' viz_molecules_time_points_cmds '}'  */
+#line 2393 "../src/mdlparse.y"
+                                                      { (yyval.frame_list) = (yyvsp[-1].frame_list); }
+#line 6078 "mdlparse.c"
     break;
 
-  case 599:
-#line 2310 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 618: /* viz_molecules_time_points_cmds: viz_molecules_time_points_cmds viz_molecules_time_points_one_cmd  */
+#line 2399 "../src/mdlparse.y"
+                                                      {
                                                         if ((yyvsp[-1].frame_list).frame_head != NULL)
                                                         {
                                                           (yyval.frame_list) = (yyvsp[-1].frame_list);
@@ -5925,30 +6092,30 @@ yyreduce:
                                                         else if ((yyvsp[0].frame_list).frame_head != NULL)
                                                           (yyval.frame_list) = (yyvsp[0].frame_list);
                                                       }
-#line 5929 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 6096 "mdlparse.c"
     break;
 
-  case 600:
-#line 2327 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_new_viz_mol_frames(parse_state, parse_state->vol->viz_blocks, & (yyval.frame_list), OUTPUT_BY_TIME_LIST, (yyvsp[-2].tok), & (yyvsp[0].nlist))); }
-#line 5935 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 619: /* viz_molecules_time_points_one_cmd: viz_molecules_one_item '@' viz_time_spec  */
+#line 2416 "../src/mdlparse.y"
+                                                      { CHECK(mdl_new_viz_mol_frames(parse_state, parse_state->vol->viz_blocks, & (yyval.frame_list), OUTPUT_BY_TIME_LIST, (yyvsp[-2].tok), & (yyvsp[0].nlist))); }
+#line 6102 "mdlparse.c"
     break;
 
-  case 601:
-#line 2331 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_new_viz_all_iterations(parse_state, & (yyval.nlist))); }
-#line 5941 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 620: /* viz_iteration_spec: ALL_ITERATIONS  */
+#line 2420 "../src/mdlparse.y"
+                                                      { CHECK(mdl_new_viz_all_iterations(parse_state, & (yyval.nlist))); }
+#line 6108 "mdlparse.c"
     break;
 
-  case 603:
-#line 2338 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.frame_list) = (yyvsp[-1].frame_list); }
-#line 5947 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 622: /* viz_molecules_iteration_numbers_def: ITERATION_NUMBERS '{' viz_molecules_iteration_numbers_cmds '}'  */
+#line 2427 "../src/mdlparse.y"
+                                                      { (yyval.frame_list) = (yyvsp[-1].frame_list); }
+#line 6114 "mdlparse.c"
     break;
 
-  case 605:
-#line 2344 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 624: /* viz_molecules_iteration_numbers_cmds: viz_molecules_iteration_numbers_cmds viz_molecules_iteration_numbers_one_cmd  */
+#line 2433 "../src/mdlparse.y"
+                                                      {
                                                         if ((yyvsp[-1].frame_list).frame_head != NULL)
                                                         {
                                                           (yyval.frame_list) = (yyvsp[-1].frame_list);
@@ -5961,70 +6128,70 @@ yyreduce:
                                                         else if ((yyvsp[0].frame_list).frame_head != NULL)
                                                           (yyval.frame_list) = (yyvsp[0].frame_list);
                                                       }
-#line 5965 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 6132 "mdlparse.c"
     break;
 
-  case 606:
-#line 2361 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECK(mdl_new_viz_mol_frames(parse_state, parse_state->vol->viz_blocks, & (yyval.frame_list), OUTPUT_BY_ITERATION_LIST, (yyvsp[-2].tok), & (yyvsp[0].nlist))); }
-#line 5971 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 625: /* viz_molecules_iteration_numbers_one_cmd: viz_molecules_one_item '@' viz_iteration_spec  */
+#line 2450 "../src/mdlparse.y"
+                                                      { CHECK(mdl_new_viz_mol_frames(parse_state, parse_state->vol->viz_blocks, & (yyval.frame_list), OUTPUT_BY_ITERATION_LIST, (yyvsp[-2].tok), & (yyvsp[0].nlist))); }
+#line 6138 "mdlparse.c"
     break;
 
-  case 607:
-#line 2364 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = ALL_MOL_DATA; }
-#line 5977 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 626: /* viz_molecules_one_item: ALL_DATA  */
+#line 2453 "../src/mdlparse.y"
+                                                      { (yyval.tok) = ALL_MOL_DATA; }
+#line 6144 "mdlparse.c"
     break;
 
-  case 608:
-#line 2365 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = MOL_POS; }
-#line 5983 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 627: /* viz_molecules_one_item: POSITIONS  */
+#line 2454 "../src/mdlparse.y"
+                                                      { (yyval.tok) = MOL_POS; }
+#line 6150 "mdlparse.c"
     break;
 
-  case 609:
-#line 2366 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.tok) = MOL_ORIENT; }
-#line 5989 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 628: /* viz_molecules_one_item: ORIENTATIONS  */
+#line 2455 "../src/mdlparse.y"
+                                                      { (yyval.tok) = MOL_ORIENT; }
+#line 6156 "mdlparse.c"
     break;
 
-  case 610:
-#line 2380 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 629: /* volume_output_def: VOLUME_DATA_OUTPUT '{' volume_output_filename_prefix volume_output_molecule_list volume_output_location volume_output_voxel_size volume_output_voxel_count volume_output_times_def '}'  */
+#line 2469 "../src/mdlparse.y"
+                                                      {
                                                           struct volume_output_item *vo;
                                                           CHECKN(vo = mdl_new_volume_output_item(parse_state, (yyvsp[-6].str), & (yyvsp[-5].species_lst), (yyvsp[-4].vec3), (yyvsp[-3].vec3), (yyvsp[-2].vec3), (yyvsp[-1].otimes)));
                                                           vo->next = parse_state->vol->volume_output_head;
                                                           parse_state->vol->volume_output_head = vo;
                                                       }
-#line 6000 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 6167 "mdlparse.c"
     break;
 
-  case 611:
-#line 2389 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); }
-#line 6006 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 630: /* volume_output_filename_prefix: FILENAME_PREFIX '=' str_expr  */
+#line 2478 "../src/mdlparse.y"
+                                                      { (yyval.str) = (yyvsp[0].str); }
+#line 6173 "mdlparse.c"
     break;
 
-  case 613:
-#line 2395 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 632: /* volume_output_molecule_list: volume_output_molecule_list volume_output_molecule_decl  */
+#line 2484 "../src/mdlparse.y"
+                                                      {
                                                           (yyval.species_lst) = (yyvsp[-1].species_lst);
                                                           (yyval.species_lst).species_count += (yyvsp[0].species_lst).species_count;
                                                           (yyval.species_lst).species_tail->next = (yyvsp[0].species_lst).species_head;
                                                           (yyval.species_lst).species_tail = (yyvsp[0].species_lst).species_tail;
                                                       }
-#line 6017 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 6184 "mdlparse.c"
     break;
 
-  case 614:
-#line 2404 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.species_lst) = (yyvsp[0].species_lst); }
-#line 6023 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 633: /* volume_output_molecule_decl: MOLECULES '=' volume_output_molecules  */
+#line 2493 "../src/mdlparse.y"
+                                                      { (yyval.species_lst) = (yyvsp[0].species_lst); }
+#line 6190 "mdlparse.c"
     break;
 
-  case 615:
-#line 2407 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 634: /* volume_output_molecule: var  */
+#line 2496 "../src/mdlparse.y"
+                                                      {
                                                           struct sym_entry *sp;
                                                           struct species_list_item *ptrl;
                                                           CHECKN(sp = mdl_existing_molecule(parse_state, (yyvsp[0].str)));
@@ -6039,40 +6206,40 @@ yyreduce:
                                                           ptrl->next = NULL;
                                                           (yyval.species_lst_item) = ptrl;
                                                       }
-#line 6043 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 6210 "mdlparse.c"
     break;
 
-  case 616:
-#line 2425 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.species_lst).species_tail = (yyval.species_lst).species_head = (yyvsp[0].species_lst_item); (yyval.species_lst).species_count = 1; }
-#line 6049 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 635: /* volume_output_molecules: volume_output_molecule  */
+#line 2514 "../src/mdlparse.y"
+                                                      { (yyval.species_lst).species_tail = (yyval.species_lst).species_head = (yyvsp[0].species_lst_item); (yyval.species_lst).species_count = 1; }
+#line 6216 "mdlparse.c"
     break;
 
-  case 617:
-#line 2427 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 636: /* volume_output_molecules: volume_output_molecules '+' volume_output_molecule  */
+#line 2516 "../src/mdlparse.y"
+                                                      {
                                                         (yyval.species_lst) = (yyvsp[-2].species_lst);
                                                         (yyval.species_lst).species_tail = (yyval.species_lst).species_tail->next = (yyvsp[0].species_lst_item);
                                                         ++ (yyval.species_lst).species_count;
                                                       }
-#line 6059 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 6226 "mdlparse.c"
     break;
 
-  case 618:
-#line 2435 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.vec3) = (yyvsp[0].vec3); }
-#line 6065 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 637: /* volume_output_location: LOCATION '=' point  */
+#line 2524 "../src/mdlparse.y"
+                                                      { (yyval.vec3) = (yyvsp[0].vec3); }
+#line 6232 "mdlparse.c"
     break;
 
-  case 619:
-#line 2439 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { (yyval.vec3) = (yyvsp[0].vec3); }
-#line 6071 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 638: /* volume_output_voxel_size: VOXEL_SIZE '=' point_or_num  */
+#line 2528 "../src/mdlparse.y"
+                                                      { (yyval.vec3) = (yyvsp[0].vec3); }
+#line 6238 "mdlparse.c"
     break;
 
-  case 620:
-#line 2443 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    {
+  case 639: /* volume_output_voxel_count: VOXEL_COUNT '=' point_or_num  */
+#line 2532 "../src/mdlparse.y"
+                                                      {
                                                           if ((yyvsp[0].vec3)->x < 1.0)
                                                           {
                                                             mdl_warning(parse_state, "Voxel count (x dimension) too small.  Setting x count to 1.");
@@ -6090,35 +6257,36 @@ yyreduce:
                                                           }
                                                           (yyval.vec3) = (yyvsp[0].vec3);
                                                       }
-#line 6094 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 6261 "mdlparse.c"
     break;
 
-  case 621:
-#line 2464 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.otimes) = mdl_new_output_times_default(parse_state)); }
-#line 6100 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 640: /* volume_output_times_def: %empty  */
+#line 2553 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.otimes) = mdl_new_output_times_default(parse_state)); }
+#line 6267 "mdlparse.c"
     break;
 
-  case 622:
-#line 2465 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.otimes) = mdl_new_output_times_step(parse_state, (yyvsp[0].dbl))); }
-#line 6106 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 641: /* volume_output_times_def: STEP '=' num_expr  */
+#line 2554 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.otimes) = mdl_new_output_times_step(parse_state, (yyvsp[0].dbl))); }
+#line 6273 "mdlparse.c"
     break;
 
-  case 623:
-#line 2466 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.otimes) = mdl_new_output_times_iterations(parse_state, & (yyvsp[0].nlist))); }
-#line 6112 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 642: /* volume_output_times_def: ITERATION_LIST '=' array_value  */
+#line 2555 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.otimes) = mdl_new_output_times_iterations(parse_state, & (yyvsp[0].nlist))); }
+#line 6279 "mdlparse.c"
     break;
 
-  case 624:
-#line 2467 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1646  */
-    { CHECKN((yyval.otimes) = mdl_new_output_times_time(parse_state, & (yyvsp[0].nlist))); }
-#line 6118 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+  case 643: /* volume_output_times_def: TIME_LIST '=' array_value  */
+#line 2556 "../src/mdlparse.y"
+                                                      { CHECKN((yyval.otimes) = mdl_new_output_times_time(parse_state, & (yyvsp[0].nlist))); }
+#line 6285 "mdlparse.c"
     break;
 
 
-#line 6122 "/home/jczech/mcell/build/deps/mdlparse.c" /* yacc.c:1646  */
+#line 6289 "mdlparse.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -6132,25 +6300,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -6161,50 +6327,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (parse_state, scanner, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (parse_state, scanner, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -6233,12 +6363,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -6255,13 +6384,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -6275,7 +6405,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, parse_state, scanner);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, parse_state, scanner);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -6287,7 +6417,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -6298,26 +6428,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (parse_state, scanner, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -6333,20 +6467,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, parse_state, scanner);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, parse_state, scanner);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 2470 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1906  */
+
+#line 2559 "../src/mdlparse.y"
 
 
 
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +31,12 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-#ifndef YY_MDL_HOME_JCZECH_MCELL_BUILD_DEPS_MDLPARSE_H_INCLUDED
-# define YY_MDL_HOME_JCZECH_MCELL_BUILD_DEPS_MDLPARSE_H_INCLUDED
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_MDL_MDLPARSE_H_INCLUDED
+# define YY_MDL_MDLPARSE_H_INCLUDED
 /* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
@@ -40,277 +45,285 @@
 extern int mdldebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    ABS = 258,
-    ABSORPTIVE = 259,
-    ACCURATE_3D_REACTIONS = 260,
-    ACOS = 261,
-    ALL_CROSSINGS = 262,
-    ALL_DATA = 263,
-    ALL_ELEMENTS = 264,
-    ALL_ENCLOSED = 265,
-    ALL_HITS = 266,
-    ALL_ITERATIONS = 267,
-    ALL_MOLECULES = 268,
-    ALL_NOTIFICATIONS = 269,
-    ALL_TIMES = 270,
-    ALL_WARNINGS = 271,
-    ASCII = 272,
-    ASIN = 273,
-    ASPECT_RATIO = 274,
-    ATAN = 275,
-    BACK = 276,
-    BACK_CROSSINGS = 277,
-    BACK_HITS = 278,
-    BOTTOM = 279,
-    BOX = 280,
-    BOX_TRIANGULATION_REPORT = 281,
-    BRIEF = 282,
-    CEIL = 283,
-    CELLBLENDER = 284,
-    CENTER_MOLECULES_ON_GRID = 285,
-    CHECKPOINT_INFILE = 286,
-    CHECKPOINT_ITERATIONS = 287,
-    CHECKPOINT_OUTFILE = 288,
-    CHECKPOINT_REALTIME = 289,
-    CHECKPOINT_REPORT = 290,
-    CLAMP_CONCENTRATION = 291,
-    CLOSE_PARTITION_SPACING = 292,
-    CONCENTRATION = 293,
-    CORNERS = 294,
-    COS = 295,
-    COUNT = 296,
-    CUBIC = 297,
-    CUBIC_RELEASE_SITE = 298,
-    CUSTOM_SPACE_STEP = 299,
-    CUSTOM_TIME_STEP = 300,
-    DEFINE_MOLECULE = 301,
-    DEFINE_MOLECULES = 302,
-    DEFINE_REACTIONS = 303,
-    DEFINE_RELEASE_PATTERN = 304,
-    DEFINE_SURFACE_CLASS = 305,
-    DEFINE_SURFACE_CLASSES = 306,
-    DEFINE_SURFACE_REGIONS = 307,
-    DEGENERATE_POLYGONS = 308,
-    DELAY = 309,
-    DENSITY = 310,
-    DIFFUSION_CONSTANT_2D = 311,
-    DIFFUSION_CONSTANT_3D = 312,
-    DIFFUSION_CONSTANT_REPORT = 313,
-    DYNAMIC_GEOMETRY = 314,
-    DYNAMIC_GEOMETRY_MOLECULE_PLACEMENT = 315,
-    EFFECTOR_GRID_DENSITY = 316,
-    ELEMENT_CONNECTIONS = 317,
-    ELLIPTIC = 318,
-    ELLIPTIC_RELEASE_SITE = 319,
-    EQUAL = 320,
-    ERROR = 321,
-    ESTIMATE_CONCENTRATION = 322,
-    EXCLUDE_ELEMENTS = 323,
-    EXCLUDE_PATCH = 324,
-    EXCLUDE_REGION = 325,
-    EXIT = 326,
-    EXP = 327,
-    EXPRESSION = 328,
-    EXTERN = 329,
-    FALSE = 330,
-    FCLOSE = 331,
-    FILENAME = 332,
-    FILENAME_PREFIX = 333,
-    FILE_OUTPUT_REPORT = 334,
-    FINAL_SUMMARY = 335,
-    FLOOR = 336,
-    FOPEN = 337,
-    FORMAT = 338,
-    FPRINTF = 339,
-    FPRINT_TIME = 340,
-    FRONT = 341,
-    FRONT_CROSSINGS = 342,
-    FRONT_HITS = 343,
-    GAUSSIAN_RELEASE_NUMBER = 344,
-    GEOMETRY = 345,
-    GRAPH_PATTERN = 346,
-    HEADER = 347,
-    HIGH_PROBABILITY_THRESHOLD = 348,
-    HIGH_REACTION_PROBABILITY = 349,
-    IGNORED = 350,
-    INCLUDE_ELEMENTS = 351,
-    INCLUDE_FILE = 352,
-    INCLUDE_PATCH = 353,
-    INCLUDE_REGION = 354,
-    INPUT_FILE = 355,
-    INSTANTIATE = 356,
-    LLINTEGER = 357,
-    FULLY_RANDOM = 358,
-    INTERACTION_RADIUS = 359,
-    ITERATION_LIST = 360,
-    ITERATION_NUMBERS = 361,
-    ITERATION_REPORT = 362,
-    ITERATIONS = 363,
-    KEEP_CHECKPOINT_FILES = 364,
-    LEFT = 365,
-    LIFETIME_THRESHOLD = 366,
-    LIFETIME_TOO_SHORT = 367,
-    LIST = 368,
-    LOCATION = 369,
-    LOG = 370,
-    LOG10 = 371,
-    MAX_TOK = 372,
-    MAXIMUM_STEP_LENGTH = 373,
-    MEAN_DIAMETER = 374,
-    MEAN_NUMBER = 375,
-    MEMORY_PARTITION_X = 376,
-    MEMORY_PARTITION_Y = 377,
-    MEMORY_PARTITION_Z = 378,
-    MEMORY_PARTITION_POOL = 379,
-    MICROSCOPIC_REVERSIBILITY = 380,
-    MIN_TOK = 381,
-    MISSED_REACTIONS = 382,
-    MISSED_REACTION_THRESHOLD = 383,
-    MISSING_SURFACE_ORIENTATION = 384,
-    MOD = 385,
-    MODE = 386,
-    MODIFY_SURFACE_REGIONS = 387,
-    MOLECULE = 388,
-    MOLECULE_COLLISION_REPORT = 389,
-    MOLECULE_DENSITY = 390,
-    MOLECULE_NUMBER = 391,
-    MOLECULE_POSITIONS = 392,
-    MOLECULES = 393,
-    MOLECULE_PLACEMENT_FAILURE = 394,
-    NAME_LIST = 395,
-    NEAREST_POINT = 396,
-    NEAREST_TRIANGLE = 397,
-    NEGATIVE_DIFFUSION_CONSTANT = 398,
-    NEGATIVE_REACTION_RATE = 399,
-    NO = 400,
-    NOEXIT = 401,
-    NONE = 402,
-    NO_SPECIES = 403,
-    NOT_EQUAL = 404,
-    NOTIFICATIONS = 405,
-    NUMBER_OF_SUBUNITS = 406,
-    NUMBER_OF_TRAINS = 407,
-    NUMBER_TO_RELEASE = 408,
-    OBJECT = 409,
-    OFF = 410,
-    ON = 411,
-    ORIENTATIONS = 412,
-    OUTPUT_BUFFER_SIZE = 413,
-    INVALID_OUTPUT_STEP_TIME = 414,
-    LARGE_MOLECULAR_DISPLACEMENT = 415,
-    ADD_REMOVE_MESH = 416,
-    OVERWRITTEN_OUTPUT_FILE = 417,
-    PARTITION_LOCATION_REPORT = 418,
-    PARTITION_X = 419,
-    PARTITION_Y = 420,
-    PARTITION_Z = 421,
-    PERIODIC_BOX = 422,
-    PERIODIC_X = 423,
-    PERIODIC_Y = 424,
-    PERIODIC_Z = 425,
-    PERIODIC_TRADITIONAL = 426,
-    PI_TOK = 427,
-    POLYGON_LIST = 428,
-    POSITIONS = 429,
-    PRINTF = 430,
-    PRINT_TIME = 431,
-    PROBABILITY_REPORT = 432,
-    PROBABILITY_REPORT_THRESHOLD = 433,
-    PROGRESS_REPORT = 434,
-    RADIAL_DIRECTIONS = 435,
-    RADIAL_SUBDIVISIONS = 436,
-    RAND_GAUSSIAN = 437,
-    RAND_UNIFORM = 438,
-    REACTION_DATA_OUTPUT = 439,
-    REACTION_OUTPUT_REPORT = 440,
-    REAL = 441,
-    RECTANGULAR_RELEASE_SITE = 442,
-    RECTANGULAR_TOKEN = 443,
-    REFLECTIVE = 444,
-    RELEASE_EVENT_REPORT = 445,
-    RELEASE_INTERVAL = 446,
-    RELEASE_PATTERN = 447,
-    RELEASE_PROBABILITY = 448,
-    RELEASE_SITE = 449,
-    REMOVE_ELEMENTS = 450,
-    RIGHT = 451,
-    ROTATE = 452,
-    ROUND_OFF = 453,
-    SCALE = 454,
-    SEED = 455,
-    SHAPE = 456,
-    SHOW_EXACT_TIME = 457,
-    SIN = 458,
-    SITE_DIAMETER = 459,
-    SITE_RADIUS = 460,
-    SPACE_STEP = 461,
-    SPHERICAL = 462,
-    SPHERICAL_RELEASE_SITE = 463,
-    SPHERICAL_SHELL = 464,
-    SPHERICAL_SHELL_SITE = 465,
-    SPRINTF = 466,
-    SQRT = 467,
-    STANDARD_DEVIATION = 468,
-    PERIODIC_BOX_INITIAL = 469,
-    STEP = 470,
-    STRING_TO_NUM = 471,
-    STR_VALUE = 472,
-    SUBUNIT = 473,
-    SUBUNIT_RELATIONSHIPS = 474,
-    SUMMATION_OPERATOR = 475,
-    SURFACE_CLASS = 476,
-    SURFACE_ONLY = 477,
-    TAN = 478,
-    TARGET_ONLY = 479,
-    TET_ELEMENT_CONNECTIONS = 480,
-    THROUGHPUT_REPORT = 481,
-    TIME_LIST = 482,
-    TIME_POINTS = 483,
-    TIME_STEP = 484,
-    TIME_STEP_MAX = 485,
-    TO = 486,
-    TOP = 487,
-    TRAIN_DURATION = 488,
-    TRAIN_INTERVAL = 489,
-    TRANSLATE = 490,
-    TRANSPARENT = 491,
-    TRIGGER = 492,
-    TRUE = 493,
-    UNLIMITED = 494,
-    USELESS_VOLUME_ORIENTATION = 495,
-    VACANCY_SEARCH_DISTANCE = 496,
-    VAR = 497,
-    VARYING_PROBABILITY_REPORT = 498,
-    VERTEX_LIST = 499,
-    VIZ_OUTPUT = 500,
-    VIZ_OUTPUT_REPORT = 501,
-    VIZ_VALUE = 502,
-    VOLUME_DATA_OUTPUT = 503,
-    VOLUME_OUTPUT_REPORT = 504,
-    VOLUME_DEPENDENT_RELEASE_NUMBER = 505,
-    VOLUME_ONLY = 506,
-    VOXEL_COUNT = 507,
-    VOXEL_LIST = 508,
-    VOXEL_SIZE = 509,
-    WARNING = 510,
-    WARNINGS = 511,
-    WORLD = 512,
-    YES = 513,
-    UNARYMINUS = 514
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ABS = 258,                     /* ABS  */
+    ABSORPTIVE = 259,              /* ABSORPTIVE  */
+    ACCURATE_3D_REACTIONS = 260,   /* ACCURATE_3D_REACTIONS  */
+    ACOS = 261,                    /* ACOS  */
+    ALL_CROSSINGS = 262,           /* ALL_CROSSINGS  */
+    ALL_DATA = 263,                /* ALL_DATA  */
+    ALL_ELEMENTS = 264,            /* ALL_ELEMENTS  */
+    ALL_ENCLOSED = 265,            /* ALL_ENCLOSED  */
+    ALL_HITS = 266,                /* ALL_HITS  */
+    ALL_ITERATIONS = 267,          /* ALL_ITERATIONS  */
+    ALL_MOLECULES = 268,           /* ALL_MOLECULES  */
+    ALL_NOTIFICATIONS = 269,       /* ALL_NOTIFICATIONS  */
+    ALL_TIMES = 270,               /* ALL_TIMES  */
+    ALL_WARNINGS = 271,            /* ALL_WARNINGS  */
+    ASCII = 272,                   /* ASCII  */
+    ASIN = 273,                    /* ASIN  */
+    ASPECT_RATIO = 274,            /* ASPECT_RATIO  */
+    ATAN = 275,                    /* ATAN  */
+    BACK = 276,                    /* BACK  */
+    BACK_CROSSINGS = 277,          /* BACK_CROSSINGS  */
+    BACK_HITS = 278,               /* BACK_HITS  */
+    BOTTOM = 279,                  /* BOTTOM  */
+    BOX = 280,                     /* BOX  */
+    BOX_TRIANGULATION_REPORT = 281, /* BOX_TRIANGULATION_REPORT  */
+    BRIEF = 282,                   /* BRIEF  */
+    CEIL = 283,                    /* CEIL  */
+    CELLBLENDER = 284,             /* CELLBLENDER  */
+    CENTER_MOLECULES_ON_GRID = 285, /* CENTER_MOLECULES_ON_GRID  */
+    CHECKPOINT_INFILE = 286,       /* CHECKPOINT_INFILE  */
+    CHECKPOINT_ITERATIONS = 287,   /* CHECKPOINT_ITERATIONS  */
+    CHECKPOINT_OUTFILE = 288,      /* CHECKPOINT_OUTFILE  */
+    CHECKPOINT_REALTIME = 289,     /* CHECKPOINT_REALTIME  */
+    CHECKPOINT_REPORT = 290,       /* CHECKPOINT_REPORT  */
+    CLAMP_CONCENTRATION = 291,     /* CLAMP_CONCENTRATION  */
+    CLOSE_PARTITION_SPACING = 292, /* CLOSE_PARTITION_SPACING  */
+    CONCENTRATION = 293,           /* CONCENTRATION  */
+    CORNERS = 294,                 /* CORNERS  */
+    COS = 295,                     /* COS  */
+    COUNT = 296,                   /* COUNT  */
+    CUBIC = 297,                   /* CUBIC  */
+    CUBIC_RELEASE_SITE = 298,      /* CUBIC_RELEASE_SITE  */
+    CUSTOM_SPACE_STEP = 299,       /* CUSTOM_SPACE_STEP  */
+    CUSTOM_TIME_STEP = 300,        /* CUSTOM_TIME_STEP  */
+    DEFINE_MOLECULE = 301,         /* DEFINE_MOLECULE  */
+    DEFINE_MOLECULES = 302,        /* DEFINE_MOLECULES  */
+    DEFINE_MOLECULE_STRUCTURES = 303, /* DEFINE_MOLECULE_STRUCTURES  */
+    DEFINE_REACTIONS = 304,        /* DEFINE_REACTIONS  */
+    DEFINE_RELEASE_PATTERN = 305,  /* DEFINE_RELEASE_PATTERN  */
+    DEFINE_SURFACE_CLASS = 306,    /* DEFINE_SURFACE_CLASS  */
+    DEFINE_SURFACE_CLASSES = 307,  /* DEFINE_SURFACE_CLASSES  */
+    DEFINE_SURFACE_REGIONS = 308,  /* DEFINE_SURFACE_REGIONS  */
+    DEGENERATE_POLYGONS = 309,     /* DEGENERATE_POLYGONS  */
+    DELAY = 310,                   /* DELAY  */
+    DENSITY = 311,                 /* DENSITY  */
+    DIFFUSION_CONSTANT_2D = 312,   /* DIFFUSION_CONSTANT_2D  */
+    DIFFUSION_CONSTANT_3D = 313,   /* DIFFUSION_CONSTANT_3D  */
+    DIFFUSION_CONSTANT_REPORT = 314, /* DIFFUSION_CONSTANT_REPORT  */
+    DYNAMIC_GEOMETRY = 315,        /* DYNAMIC_GEOMETRY  */
+    DYNAMIC_GEOMETRY_MOLECULE_PLACEMENT = 316, /* DYNAMIC_GEOMETRY_MOLECULE_PLACEMENT  */
+    EFFECTOR_GRID_DENSITY = 317,   /* EFFECTOR_GRID_DENSITY  */
+    ELEMENT_CONNECTIONS = 318,     /* ELEMENT_CONNECTIONS  */
+    ELLIPTIC = 319,                /* ELLIPTIC  */
+    ELLIPTIC_RELEASE_SITE = 320,   /* ELLIPTIC_RELEASE_SITE  */
+    EQUAL = 321,                   /* EQUAL  */
+    ERROR = 322,                   /* ERROR  */
+    ESTIMATE_CONCENTRATION = 323,  /* ESTIMATE_CONCENTRATION  */
+    EXCLUDE_ELEMENTS = 324,        /* EXCLUDE_ELEMENTS  */
+    EXCLUDE_PATCH = 325,           /* EXCLUDE_PATCH  */
+    EXCLUDE_REGION = 326,          /* EXCLUDE_REGION  */
+    EXIT = 327,                    /* EXIT  */
+    EXP = 328,                     /* EXP  */
+    EXPRESSION = 329,              /* EXPRESSION  */
+    EXTERN = 330,                  /* EXTERN  */
+    FALSE = 331,                   /* FALSE  */
+    FCLOSE = 332,                  /* FCLOSE  */
+    FILENAME = 333,                /* FILENAME  */
+    FILENAME_PREFIX = 334,         /* FILENAME_PREFIX  */
+    FILE_OUTPUT_REPORT = 335,      /* FILE_OUTPUT_REPORT  */
+    FINAL_SUMMARY = 336,           /* FINAL_SUMMARY  */
+    FLOOR = 337,                   /* FLOOR  */
+    FOPEN = 338,                   /* FOPEN  */
+    FORMAT = 339,                  /* FORMAT  */
+    FPRINTF = 340,                 /* FPRINTF  */
+    FPRINT_TIME = 341,             /* FPRINT_TIME  */
+    FRONT = 342,                   /* FRONT  */
+    FRONT_CROSSINGS = 343,         /* FRONT_CROSSINGS  */
+    FRONT_HITS = 344,              /* FRONT_HITS  */
+    GAUSSIAN_RELEASE_NUMBER = 345, /* GAUSSIAN_RELEASE_NUMBER  */
+    GEOMETRY = 346,                /* GEOMETRY  */
+    GRAPH_PATTERN = 347,           /* GRAPH_PATTERN  */
+    HEADER = 348,                  /* HEADER  */
+    HIGH_PROBABILITY_THRESHOLD = 349, /* HIGH_PROBABILITY_THRESHOLD  */
+    HIGH_REACTION_PROBABILITY = 350, /* HIGH_REACTION_PROBABILITY  */
+    IGNORED = 351,                 /* IGNORED  */
+    INCLUDE_ELEMENTS = 352,        /* INCLUDE_ELEMENTS  */
+    INCLUDE_FILE = 353,            /* INCLUDE_FILE  */
+    INCLUDE_PATCH = 354,           /* INCLUDE_PATCH  */
+    INCLUDE_REGION = 355,          /* INCLUDE_REGION  */
+    INPUT_FILE = 356,              /* INPUT_FILE  */
+    INSTANTIATE = 357,             /* INSTANTIATE  */
+    LLINTEGER = 358,               /* LLINTEGER  */
+    FULLY_RANDOM = 359,            /* FULLY_RANDOM  */
+    INTERACTION_RADIUS = 360,      /* INTERACTION_RADIUS  */
+    ITERATION_LIST = 361,          /* ITERATION_LIST  */
+    ITERATION_NUMBERS = 362,       /* ITERATION_NUMBERS  */
+    ITERATION_REPORT = 363,        /* ITERATION_REPORT  */
+    ITERATIONS = 364,              /* ITERATIONS  */
+    KEEP_CHECKPOINT_FILES = 365,   /* KEEP_CHECKPOINT_FILES  */
+    LEFT = 366,                    /* LEFT  */
+    LIFETIME_THRESHOLD = 367,      /* LIFETIME_THRESHOLD  */
+    LIFETIME_TOO_SHORT = 368,      /* LIFETIME_TOO_SHORT  */
+    LIST = 369,                    /* LIST  */
+    LOCATION = 370,                /* LOCATION  */
+    COMPONENT_LOCATION = 371,      /* COMPONENT_LOCATION  */
+    COMPONENT_ROTATION = 372,      /* COMPONENT_ROTATION  */
+    LOG = 373,                     /* LOG  */
+    LOG10 = 374,                   /* LOG10  */
+    MAX_TOK = 375,                 /* MAX_TOK  */
+    MAXIMUM_STEP_LENGTH = 376,     /* MAXIMUM_STEP_LENGTH  */
+    MEAN_DIAMETER = 377,           /* MEAN_DIAMETER  */
+    MEAN_NUMBER = 378,             /* MEAN_NUMBER  */
+    MEMORY_PARTITION_X = 379,      /* MEMORY_PARTITION_X  */
+    MEMORY_PARTITION_Y = 380,      /* MEMORY_PARTITION_Y  */
+    MEMORY_PARTITION_Z = 381,      /* MEMORY_PARTITION_Z  */
+    MEMORY_PARTITION_POOL = 382,   /* MEMORY_PARTITION_POOL  */
+    MICROSCOPIC_REVERSIBILITY = 383, /* MICROSCOPIC_REVERSIBILITY  */
+    MIN_TOK = 384,                 /* MIN_TOK  */
+    MISSED_REACTIONS = 385,        /* MISSED_REACTIONS  */
+    MISSED_REACTION_THRESHOLD = 386, /* MISSED_REACTION_THRESHOLD  */
+    MISSING_SURFACE_ORIENTATION = 387, /* MISSING_SURFACE_ORIENTATION  */
+    MOD = 388,                     /* MOD  */
+    MODE = 389,                    /* MODE  */
+    MODIFY_SURFACE_REGIONS = 390,  /* MODIFY_SURFACE_REGIONS  */
+    MOLECULE = 391,                /* MOLECULE  */
+    MOLECULE_COLLISION_REPORT = 392, /* MOLECULE_COLLISION_REPORT  */
+    MOLECULE_DENSITY = 393,        /* MOLECULE_DENSITY  */
+    MOLECULE_NUMBER = 394,         /* MOLECULE_NUMBER  */
+    MOLECULE_POSITIONS = 395,      /* MOLECULE_POSITIONS  */
+    MOLECULE_POSITIONS_FILE = 396, /* MOLECULE_POSITIONS_FILE  */
+    MOLECULES = 397,               /* MOLECULES  */
+    MOLECULE_PLACEMENT_FAILURE = 398, /* MOLECULE_PLACEMENT_FAILURE  */
+    NAME_LIST = 399,               /* NAME_LIST  */
+    NEAREST_POINT = 400,           /* NEAREST_POINT  */
+    NEAREST_TRIANGLE = 401,        /* NEAREST_TRIANGLE  */
+    NEGATIVE_DIFFUSION_CONSTANT = 402, /* NEGATIVE_DIFFUSION_CONSTANT  */
+    NEGATIVE_REACTION_RATE = 403,  /* NEGATIVE_REACTION_RATE  */
+    NO = 404,                      /* NO  */
+    NOEXIT = 405,                  /* NOEXIT  */
+    NONE = 406,                    /* NONE  */
+    NO_SPECIES = 407,              /* NO_SPECIES  */
+    NOT_EQUAL = 408,               /* NOT_EQUAL  */
+    NOTIFICATIONS = 409,           /* NOTIFICATIONS  */
+    NUMBER_OF_SUBUNITS = 410,      /* NUMBER_OF_SUBUNITS  */
+    NUMBER_OF_TRAINS = 411,        /* NUMBER_OF_TRAINS  */
+    NUMBER_TO_RELEASE = 412,       /* NUMBER_TO_RELEASE  */
+    OBJECT = 413,                  /* OBJECT  */
+    OFF = 414,                     /* OFF  */
+    ON = 415,                      /* ON  */
+    ORIENTATIONS = 416,            /* ORIENTATIONS  */
+    OUTPUT_BUFFER_SIZE = 417,      /* OUTPUT_BUFFER_SIZE  */
+    INVALID_OUTPUT_STEP_TIME = 418, /* INVALID_OUTPUT_STEP_TIME  */
+    LARGE_MOLECULAR_DISPLACEMENT = 419, /* LARGE_MOLECULAR_DISPLACEMENT  */
+    ADD_REMOVE_MESH = 420,         /* ADD_REMOVE_MESH  */
+    OVERWRITTEN_OUTPUT_FILE = 421, /* OVERWRITTEN_OUTPUT_FILE  */
+    PARTITION_LOCATION_REPORT = 422, /* PARTITION_LOCATION_REPORT  */
+    PARTITION_X = 423,             /* PARTITION_X  */
+    PARTITION_Y = 424,             /* PARTITION_Y  */
+    PARTITION_Z = 425,             /* PARTITION_Z  */
+    PERIODIC_BOX = 426,            /* PERIODIC_BOX  */
+    PERIODIC_X = 427,              /* PERIODIC_X  */
+    PERIODIC_Y = 428,              /* PERIODIC_Y  */
+    PERIODIC_Z = 429,              /* PERIODIC_Z  */
+    PERIODIC_TRADITIONAL = 430,    /* PERIODIC_TRADITIONAL  */
+    PI_TOK = 431,                  /* PI_TOK  */
+    POLYGON_LIST = 432,            /* POLYGON_LIST  */
+    POSITIONS = 433,               /* POSITIONS  */
+    PRINTF = 434,                  /* PRINTF  */
+    PRINT_TIME = 435,              /* PRINT_TIME  */
+    PROBABILITY_REPORT = 436,      /* PROBABILITY_REPORT  */
+    PROBABILITY_REPORT_THRESHOLD = 437, /* PROBABILITY_REPORT_THRESHOLD  */
+    PROGRESS_REPORT = 438,         /* PROGRESS_REPORT  */
+    RADIAL_DIRECTIONS = 439,       /* RADIAL_DIRECTIONS  */
+    RADIAL_SUBDIVISIONS = 440,     /* RADIAL_SUBDIVISIONS  */
+    RAND_GAUSSIAN = 441,           /* RAND_GAUSSIAN  */
+    RAND_UNIFORM = 442,            /* RAND_UNIFORM  */
+    REACTION_DATA_OUTPUT = 443,    /* REACTION_DATA_OUTPUT  */
+    REACTION_OUTPUT_REPORT = 444,  /* REACTION_OUTPUT_REPORT  */
+    REAL = 445,                    /* REAL  */
+    RECTANGULAR_RELEASE_SITE = 446, /* RECTANGULAR_RELEASE_SITE  */
+    RECTANGULAR_TOKEN = 447,       /* RECTANGULAR_TOKEN  */
+    REFLECTIVE = 448,              /* REFLECTIVE  */
+    RELEASE_EVENT_REPORT = 449,    /* RELEASE_EVENT_REPORT  */
+    RELEASE_INTERVAL = 450,        /* RELEASE_INTERVAL  */
+    RELEASE_PATTERN = 451,         /* RELEASE_PATTERN  */
+    RELEASE_PROBABILITY = 452,     /* RELEASE_PROBABILITY  */
+    RELEASE_SITE = 453,            /* RELEASE_SITE  */
+    REMOVE_ELEMENTS = 454,         /* REMOVE_ELEMENTS  */
+    RIGHT = 455,                   /* RIGHT  */
+    ROTATE = 456,                  /* ROTATE  */
+    ROUND_OFF = 457,               /* ROUND_OFF  */
+    SCALE = 458,                   /* SCALE  */
+    SEED = 459,                    /* SEED  */
+    SHAPE = 460,                   /* SHAPE  */
+    SHOW_EXACT_TIME = 461,         /* SHOW_EXACT_TIME  */
+    SIN = 462,                     /* SIN  */
+    SITE_DIAMETER = 463,           /* SITE_DIAMETER  */
+    SITE_RADIUS = 464,             /* SITE_RADIUS  */
+    SPACE_STEP = 465,              /* SPACE_STEP  */
+    SPHERICAL = 466,               /* SPHERICAL  */
+    SPHERICAL_RELEASE_SITE = 467,  /* SPHERICAL_RELEASE_SITE  */
+    SPHERICAL_SHELL = 468,         /* SPHERICAL_SHELL  */
+    SPHERICAL_SHELL_SITE = 469,    /* SPHERICAL_SHELL_SITE  */
+    SPRINTF = 470,                 /* SPRINTF  */
+    SQRT = 471,                    /* SQRT  */
+    STANDARD_DEVIATION = 472,      /* STANDARD_DEVIATION  */
+    PERIODIC_BOX_INITIAL = 473,    /* PERIODIC_BOX_INITIAL  */
+    STEP = 474,                    /* STEP  */
+    STRING_TO_NUM = 475,           /* STRING_TO_NUM  */
+    STR_VALUE = 476,               /* STR_VALUE  */
+    SUBUNIT = 477,                 /* SUBUNIT  */
+    SUBUNIT_RELATIONSHIPS = 478,   /* SUBUNIT_RELATIONSHIPS  */
+    SUMMATION_OPERATOR = 479,      /* SUMMATION_OPERATOR  */
+    SURFACE_CLASS = 480,           /* SURFACE_CLASS  */
+    SURFACE_ONLY = 481,            /* SURFACE_ONLY  */
+    TAN = 482,                     /* TAN  */
+    TARGET_ONLY = 483,             /* TARGET_ONLY  */
+    TET_ELEMENT_CONNECTIONS = 484, /* TET_ELEMENT_CONNECTIONS  */
+    THROUGHPUT_REPORT = 485,       /* THROUGHPUT_REPORT  */
+    TIME_LIST = 486,               /* TIME_LIST  */
+    TIME_POINTS = 487,             /* TIME_POINTS  */
+    TIME_STEP = 488,               /* TIME_STEP  */
+    TIME_STEP_MAX = 489,           /* TIME_STEP_MAX  */
+    TO = 490,                      /* TO  */
+    TOP = 491,                     /* TOP  */
+    TRAIN_DURATION = 492,          /* TRAIN_DURATION  */
+    TRAIN_INTERVAL = 493,          /* TRAIN_INTERVAL  */
+    TRANSLATE = 494,               /* TRANSLATE  */
+    TRANSPARENT = 495,             /* TRANSPARENT  */
+    TRIGGER = 496,                 /* TRIGGER  */
+    TRUE = 497,                    /* TRUE  */
+    UNLIMITED = 498,               /* UNLIMITED  */
+    USELESS_VOLUME_ORIENTATION = 499, /* USELESS_VOLUME_ORIENTATION  */
+    VACANCY_SEARCH_DISTANCE = 500, /* VACANCY_SEARCH_DISTANCE  */
+    VAR = 501,                     /* VAR  */
+    VARYING_PROBABILITY_REPORT = 502, /* VARYING_PROBABILITY_REPORT  */
+    VERTEX_LIST = 503,             /* VERTEX_LIST  */
+    VIZ_OUTPUT = 504,              /* VIZ_OUTPUT  */
+    VIZ_OUTPUT_REPORT = 505,       /* VIZ_OUTPUT_REPORT  */
+    VIZ_VALUE = 506,               /* VIZ_VALUE  */
+    VOLUME_DATA_OUTPUT = 507,      /* VOLUME_DATA_OUTPUT  */
+    VOLUME_OUTPUT_REPORT = 508,    /* VOLUME_OUTPUT_REPORT  */
+    VOLUME_DEPENDENT_RELEASE_NUMBER = 509, /* VOLUME_DEPENDENT_RELEASE_NUMBER  */
+    VOLUME_ONLY = 510,             /* VOLUME_ONLY  */
+    VOXEL_COUNT = 511,             /* VOXEL_COUNT  */
+    VOXEL_LIST = 512,              /* VOXEL_LIST  */
+    VOXEL_SIZE = 513,              /* VOXEL_SIZE  */
+    WARNING = 514,                 /* WARNING  */
+    WARNINGS = 515,                /* WARNINGS  */
+    WORLD = 516,                   /* WORLD  */
+    YES = 517,                     /* YES  */
+    UNARYMINUS = 518               /* UNARYMINUS  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 67 "/home/jczech/mcell/src/mdlparse.y" /* yacc.c:1909  */
+#line 67 "../src/mdlparse.y"
 
 int ival;
 int tok;
@@ -322,6 +335,7 @@ struct vector3 *vec3;
 struct num_expr_list_head nlist;
 struct release_evaluator *rev;
 struct sym_table_list *symlist;
+struct mol_comp_ss *mcomp_ss;
 struct output_times *otimes;
 
 /* Reaction output */
@@ -376,9 +390,9 @@ struct arg *printfarg;
 struct arg_list printfargs;
 
 
-#line 380 "/home/jczech/mcell/build/deps/mdlparse.h" /* yacc.c:1909  */
-};
+#line 394 "mdlparse.h"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
@@ -386,6 +400,8 @@ typedef union YYSTYPE YYSTYPE;
 
 
 
+
 int mdlparse (struct mdlparse_vars *parse_state, yyscan_t scanner);
 
-#endif /* !YY_MDL_HOME_JCZECH_MCELL_BUILD_DEPS_MDLPARSE_H_INCLUDED  */
+
+#endif /* !YY_MDL_MDLPARSE_H_INCLUDED  */
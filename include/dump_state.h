@@ -65,7 +65,7 @@ void dump_vector3(struct vector3 vec, const char* extra_comment);
 #ifdef __cplusplus
 extern "C"
 #endif
-void dump_rng_call_info(struct isaac64_state* rng, const char* extra_comment);
+void dump_rng_call_info(struct rng_state* rng, const char* extra_comment);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2019 by
+ * The Salk Institute for Biological Studies and
+ * Pittsburgh Supercomputing Center, Carnegie Mellon University
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+ * USA.
+ *
+******************************************************************************/
+
+#ifndef __EVENT_TRACE_H__
+#define __EVENT_TRACE_H__
+
+#include <stdint.h>
+
+/* Binary event trace (-event_trace), the compact counterpart of the
+ * DEBUG_DIFFUSION/DEBUG_COLLISIONS/DEBUG_REACTIONS/DEBUG_RNG_CALLS dumps of
+ * debug_config.h.  MCell3 and MCell4 write the same records at the same
+ * points, so two traces can be compared with utils/trace_diff.
+ *
+ * Every thread writes fixed-size records into its own ring buffer and a
+ * background thread appends them to the file.  RNG calls are only traced in
+ * builds without NDEBUG, where rng_dbl is a function.
+ *
+ * File layout: a struct trace_file_header, then struct trace_records in
+ * native byte order.  Records of different threads are interleaved in
+ * chunks; the records of one thread are in order.
+ */
+
+#define TRACE_MAGIC "MCTRACE\0"
+#define TRACE_VERSION 1
+
+enum trace_event_t {
+  TRACE_DIFFUSE = 1,   /* molecule starts to diffuse; pos */
+  TRACE_DISPLACEMENT,  /* its displacement */
+  TRACE_COLLISION,     /* flags: TRACE_COLL_*; id2: molecule hit; pos */
+  TRACE_RXN_TIME,      /* unimolecular reaction time assigned; time */
+  TRACE_RXN_PRODUCT,   /* molecule created by a reaction; pos */
+  TRACE_RXN_REACTANT,  /* molecule destroyed by a reaction; flags:
+                          TRACE_RXN_UNIMOL if unimolecular */
+  TRACE_RNG,           /* flags: TRACE_RNG_GAUSS for rng_gauss; id: randcnt,
+                          id2: aa, species: bb, iteration: cc (all of the
+                          ISAAC state, the last three truncated to 32 bits) */
+  TRACE_N_EVENTS
+};
+
+#define TRACE_COLL_MOL 1
+#define TRACE_COLL_WALL 2
+#define TRACE_RXN_UNIMOL 1
+#define TRACE_RNG_GAUSS 1
+
+struct trace_file_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+};
+
+struct trace_record {
+  uint8_t type;        /* enum trace_event_t */
+  uint8_t flags;       /* meaning depends on type */
+  uint16_t thread;     /* index of the thread which wrote it */
+  uint32_t species;    /* MCell3 species id */
+  uint64_t iteration;
+  uint64_t id;         /* molecule id */
+  uint64_t id2;        /* second molecule id, if any */
+  double time;
+  double pos[3];       /* position, displacement or collision point */
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* NULL unless tracing.  Checked before every trace call, so that tracing
+ * costs a single test when disabled. */
+extern struct event_trace *mcell_trace;
+
+int trace_open(char const *filename);
+int trace_close(void);
+void trace_emergency_flush(void);
+
+void trace_event(uint8_t type, uint8_t flags, uint64_t iteration, uint64_t id,
+                 uint64_t id2, uint32_t species, double time, double x,
+                 double y, double z);
+
+void trace_rng(uint8_t flags, uint64_t randcnt, uint64_t aa, uint64_t bb,
+               uint64_t cc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define TRACE(code)                                                            \
+  do {                                                                         \
+    if (mcell_trace != NULL) {                                                 \
+      code;                                                                    \
+    }                                                                          \
+  } while (0)
+
+#endif
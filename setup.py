@@ -12,9 +12,13 @@ setup.py file for pyMCell
 from distutils.core import setup, Extension
 from distutils.command.build import build
 from distutils.command.sdist import sdist
+from distutils.ccompiler import new_compiler
+from distutils.errors import CompileError, LinkError
+from distutils.sysconfig import customize_compiler
 import os
 import shutil
 import sys
+import tempfile
 
 
 def disallow_python2():
@@ -22,6 +26,29 @@ def disallow_python2():
         sys.exit("Sorry, Python 2 is not supported.")
 
 
+def openmp_flags():
+    """ Return the compile and link flags which enable OpenMP if the compiler
+    supports it.  Without OpenMP the parallel loops simply run serially. """
+    compiler = new_compiler()
+    customize_compiler(compiler)
+    tmp_dir = tempfile.mkdtemp()
+    src = os.path.join(tmp_dir, "omp_test.c")
+    with open(src, "w") as f:
+        f.write("#include <omp.h>\n"
+                "int main(void) { return omp_get_max_threads() < 1; }\n")
+    try:
+        objects = compiler.compile(
+            [src], output_dir=tmp_dir, extra_postargs=["-fopenmp"])
+        compiler.link_executable(
+            objects, "omp_test", output_dir=tmp_dir,
+            extra_postargs=["-fopenmp"])
+    except (CompileError, LinkError):
+        return ["-Wno-unknown-pragmas"], []
+    finally:
+        shutil.rmtree(tmp_dir)
+    return ["-fopenmp"], ["-fopenmp"]
+
+
 class CustomBuild(build):
     def run(self):
         disallow_python2()
@@ -43,10 +70,12 @@ class CustomSDist(sdist):
         sdist.run(self)
 
 
+openmp_compile_args, openmp_link_args = openmp_flags()
+
 mcell_module = Extension(
     '_pymcell',
     include_dirs=['./include'],
-    libraries=['nfsim_c', 'NFsim'],
+    libraries=['nfsim_c', 'NFsim', 'pthread'],
     library_dirs=['./build/lib'],
     sources=[
         './src/argparse.c',
@@ -59,6 +88,7 @@ mcell_module = Extension(
         './src/dyngeom_lex.c',
         './src/dyngeom_parse_extras.c',
         './src/dyngeom_yacc.c',
+        './src/event_trace.c',
         './src/grid_util.c',
         './src/hashmap.c',
         './src/init.c',
@@ -77,6 +107,8 @@ mcell_module = Extension(
         './src/mcell_viz.c',
         './src/mem_util.c',
         './src/nfsim_func.c',
+        './src/phase_profile.c',
+        './src/philox.c',
         './src/pymcell.i',
         './src/react_cond.c',
         './src/react_outc.c',
@@ -99,9 +131,11 @@ mcell_module = Extension(
         './src/vol_util.c',
         './src/volume_output.c',
         './src/wall_util.c',
+        './src/work_counters.c',
         ],
     swig_opts=['-py3'],
-    extra_compile_args=['-O2'])
+    extra_compile_args=['-O2'] + openmp_compile_args,
+    extra_link_args=openmp_link_args)
 
 setup(name='pymcell',
       version='0.1',
@@ -70,6 +70,14 @@ static struct option long_options[] = { { "help", 0, 0, 'h' },
                                         { "rules", 1, 0, 'r'},
 																				{ "mcell4", 0, 0, 'n'},
 																				{ "dump_mcell4", 0, 0, 'o'},
+                                        { "species_arrays", 0, 0, 'a' },
+                                        { "volume_output_format", 1, 0, 'u' },
+                                        { "checkpoint_format", 1, 0, 'g' },
+                                        { "checkpoint_deltas", 1, 0, 'j' },
+                                        { "profile", 1, 0, 'p' },
+                                        { "profile_interval", 1, 0, 't' },
+                                        { "bisect_pathways", 0, 0, 'x' },
+                                        { "event_trace", 1, 0, 'y' },
                                         { NULL, 0, 0, 0 } };
 
 /* print_usage: Write the usage message for mcell to a file handle.
@@ -99,6 +107,24 @@ void print_usage(FILE *f, char const *argv0) {
       "     [-rules rules_file_name] run in MCell-R mode\n"
 			"     [-mcell4]                run new experimental MCell 4 version\n"
 			"     [-dump_mcell4]           dump Mcell 3 state for MCell 4 development\n"
+      "     [-species_arrays]        keep contiguous per-species molecule arrays in\n"
+      "                              subvolumes for faster collision partner scans\n"
+      "     [-volume_output_format ('text'/'binary'/'sparse', default 'text')]\n"
+      "                              file format of VOLUME_DATA_OUTPUT; binary\n"
+      "                              formats are written in the background\n"
+      "     [-checkpoint_format ('classic'/'stream'/'compressed', default 'classic')]\n"
+      "                              stream formats snapshot the molecules and\n"
+      "                              write them in chunks in the background\n"
+      "     [-checkpoint_deltas n]   write up to n incremental checkpoints, holding\n"
+      "                              only the molecules changed since the one before,\n"
+      "                              between full checkpoints (default: 0)\n"
+      "     [-profile profile_file]  time the phases of each iteration and write\n"
+      "                              them to profile_file as JSON at exit\n"
+      "     [-profile_interval n]    also write the profile every n iterations\n"
+      "     [-bisect_pathways]       pick reaction pathways by bisection as older\n"
+      "                              versions did, reproducing their results\n"
+      "     [-event_trace trace_file] write diffusion, collision, reaction and\n"
+      "                              RNG events to trace_file for utils/trace_diff\n"
       "\n");
 }
 
@@ -344,6 +370,96 @@ int argparse_init(int argc, char *const argv[], struct volume *vol) {
       vol->dump_mcell4 = 1;
       break;
 
+    case 'a': /* -species_arrays */
+      vol->use_species_arrays = 1;
+      break;
+
+    case 'u': /* -volume_output_format */
+      if (strcmp(optarg, "text") == 0) {
+        vol->volume_output_format = VOLUME_OUTPUT_TEXT;
+      } else if (strcmp(optarg, "binary") == 0) {
+        vol->volume_output_format = VOLUME_OUTPUT_BINARY;
+      } else if (strcmp(optarg, "sparse") == 0) {
+        vol->volume_output_format = VOLUME_OUTPUT_SPARSE;
+      } else {
+        argerror("-volume_output_format option should be 'text', 'binary' or "
+                 "'sparse'.");
+        return 1;
+      }
+      break;
+
+    case 'g': /* -checkpoint_format */
+      if (strcmp(optarg, "classic") == 0) {
+        vol->chkpt_format = CHKPT_FORMAT_CLASSIC;
+      } else if (strcmp(optarg, "stream") == 0) {
+        vol->chkpt_format = CHKPT_FORMAT_STREAM;
+      } else if (strcmp(optarg, "compressed") == 0) {
+#ifdef MCELL_WITH_ZLIB
+        vol->chkpt_format = CHKPT_FORMAT_STREAM_COMPRESSED;
+#else
+        mcell_warn("MCell was built without zlib, checkpoints will be "
+                   "streamed uncompressed.");
+        vol->chkpt_format = CHKPT_FORMAT_STREAM;
+#endif
+      } else {
+        argerror("-checkpoint_format option should be 'classic', 'stream' or "
+                 "'compressed'.");
+        return 1;
+      }
+      break;
+
+    case 'j': /* -checkpoint_deltas */
+      vol->chkpt_delta_interval = (int)strtol(optarg, &endptr, 0);
+      if (endptr == optarg || *endptr != '\0') {
+        argerror("Checkpoint delta count must be an integer: %s", optarg);
+        return 1;
+      }
+
+      if (vol->chkpt_delta_interval < 0) {
+        argerror("Checkpoint delta count %d is less than 0",
+                 vol->chkpt_delta_interval);
+        return 1;
+      }
+      break;
+
+    case 'p': /* -profile */
+      vol->profile_file = strdup(optarg);
+      if (vol->profile_file == NULL) {
+        argerror("File '%s', Line %u: Out of memory while parsing "
+                 "command-line arguments: %s\n",
+                 __FILE__, __LINE__, optarg);
+        return 1;
+      }
+      break;
+
+    case 't': /* -profile_interval */
+      vol->profile_interval = strtoll(optarg, &endptr, 0);
+      if (endptr == optarg || *endptr != '\0') {
+        argerror("Profile interval must be an integer: %s", optarg);
+        return 1;
+      }
+
+      if (vol->profile_interval < 0) {
+        argerror("Profile interval %lld is less than 0",
+                 (long long int)vol->profile_interval);
+        return 1;
+      }
+      break;
+
+    case 'x': /* -bisect_pathways */
+      vol->bisect_pathways = 1;
+      break;
+
+    case 'y': /* -event_trace */
+      vol->event_trace_file = strdup(optarg);
+      if (vol->event_trace_file == NULL) {
+        argerror("File '%s', Line %u: Out of memory while parsing "
+                 "command-line arguments: %s\n",
+                 __FILE__, __LINE__, optarg);
+        return 1;
+      }
+      break;
+
     default:
       argerror("Internal error: getopt returned character code 0x%02x",
                (unsigned int)c);
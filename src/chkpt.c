@@ -31,12 +31,15 @@
 #include "config.h"
 
 #include <assert.h>
+#include <dirent.h>
 #include <errno.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <signal.h>
 #include <sys/stat.h>
 #include <string.h>
+#include <time.h>
 
 #include "mcell_structs.h"
 #include "mcell_reactions.h"
@@ -49,6 +52,13 @@
 #include "react.h"
 #include "strfunc.h"
 
+#ifdef MCELL_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /* MCell checkpoint API version */
 #define CHECKPOINT_API 1
 
@@ -65,8 +75,11 @@
 #define SPECIES_TABLE_CMD 6
 #define MOL_SCHEDULER_STATE_CMD 7
 #define BYTE_ORDER_CMD 8
-#define NUM_CHKPT_CMDS 9
+#define MOL_CHUNKED_STATE_CMD 9
 #define CHECKPOINT_API_CMD 10
+#define CHKPT_LINK_CMD 11
+#define MOL_REMOVED_CMD 12
+#define NUM_CHKPT_CMDS 13
 
 /* Newbie flags */
 #define HAS_ACT_NEWBIE 1
@@ -75,6 +88,72 @@
 #define HAS_ACT_CHANGE 1
 #define HAS_NOT_ACT_CHANGE 0
 
+/* Chunked molecule section: number of molecules per chunk and how the chunk
+ * payload is stored */
+#define CHKPT_CHUNK_RECORDS 65536
+#define CHKPT_CHUNK_RAW 0
+#define CHKPT_CHUNK_ZLIB 1
+
+/* Kinds of files in a chain of incremental checkpoints */
+#define CHKPT_LINK_BASE 0
+#define CHKPT_LINK_DELTA 1
+
+/* Molecule record of the chunked molecule section.  Chunks hold an array of
+ * these in the byte order of the machine which wrote the checkpoint. */
+struct chkpt_mol_record {
+  uint64_t id;     /* molecule id, used to match molecules across deltas */
+  double t;        /* scheduling time in seconds */
+  double t2;       /* lifetime in seconds */
+  double birthday; /* birthday in seconds */
+  struct vector3 where;
+  uint32_t species_id; /* external (checkpoint) species id */
+  int16_t orient;
+  byte act_newbie_flag;
+  byte act_change_flag;
+};
+
+/* Background writer of a streamed checkpoint */
+struct chkpt_writer {
+  pthread_t thread;
+  FILE *fs;        /* checkpoint file, with everything but molecules written */
+  char *tmpname;   /* name of the file being written */
+  char *filename;  /* name to give the file once complete */
+  char *keep_name; /* where to move the previous checkpoint, or NULL */
+  int compress;    /* CHKPT_CHUNK_RAW or CHKPT_CHUNK_ZLIB */
+  struct chkpt_mol_record *records; /* snapshot of the molecule scheduler */
+  unsigned long long n_records;
+  int free_records;  /* set if the writer owns the records */
+  int retire_deltas; /* set if the deltas of the previous base have to go */
+  int status;        /* 0 on success, 1 on failure */
+};
+
+/* Position of a file in a chain of incremental checkpoints.  A base holds
+ * all molecules, the deltas following it only the molecules created, changed
+ * or removed since the file before. */
+struct chkpt_link {
+  unsigned long long chain_id; /* shared by a base and its deltas */
+  unsigned int index; /* delta number; for a base, the number of deltas
+                         already merged into it */
+  byte kind;          /* CHKPT_LINK_BASE or CHKPT_LINK_DELTA */
+};
+
+/* Incremental checkpoints written by this run */
+struct chkpt_chain {
+  unsigned long long chain_id;
+  unsigned int n_deltas; /* deltas written since the base */
+  char *filename;        /* name of the base */
+  struct chkpt_mol_record *records; /* last snapshot, sorted by id */
+  unsigned long long n_records;
+};
+
+/* Molecules of the chunked sections read so far, merged by molecule id */
+struct chkpt_replay {
+  int seen; /* set once a chunked section has been read */
+  struct chkpt_mol_record *records; /* species_id holds the index into
+                                       world->species_list */
+  unsigned long long n_records;
+};
+
 /* these are needed for the chkpt signal handler */
 int *chkpt_continue_after_checkpoint;
 char **chkpt_initialization_state;
@@ -203,6 +282,7 @@ enum checkpoint_request_type_t *chkpt_checkpoint_requested;
  */
 struct chkpt_read_state {
   byte byte_order_mismatch;
+  struct chkpt_replay *replay; /* where chunked molecules are collected */
 };
 
 /* Handlers for individual checkpoint commands */
@@ -219,6 +299,11 @@ static int read_mcell_version(FILE *fs, struct chkpt_read_state *state);
 static int read_api_version(FILE *fs, struct chkpt_read_state *state,
   uint32_t *api_version);
 static int read_species_table(struct volume *world, FILE *fs);
+static int read_chkpt_link(FILE *fs, struct chkpt_read_state *state,
+                           struct chkpt_link *link);
+static int read_removed_mols(FILE *fs, struct chkpt_read_state *state);
+static int read_mol_chunks(struct volume *world, FILE *fs,
+                           struct chkpt_read_state *state);
 static int read_mol_scheduler_state_real(struct volume *world, FILE *fs,
                                          struct chkpt_read_state *state,
                                          uint32_t api_version);
@@ -228,8 +313,14 @@ static int write_current_iteration(FILE *fs, long long current_iterations,
                                    double current_time_seconds);
 static int write_chkpt_seq_num(FILE *fs, u_int chkpt_seq_num);
 static int write_rng_state(FILE *fs, u_int seed_seq, struct rng_state *rng);
+static void assign_chkpt_species_ids(int n_species,
+                                     struct species **species_list,
+                                     int all_species);
 static int write_species_table(FILE *fs, int n_species,
                                struct species **species_list);
+static int write_chkpt_link(FILE *fs, struct chkpt_link const *link);
+static int write_removed_mols(FILE *fs, uint64_t const *ids,
+                              unsigned long long n_ids);
 static int write_mol_scheduler_state_real(FILE *fs,
                                           struct storage_list *storage_head,
                                           double simulation_start_seconds,
@@ -238,6 +329,28 @@ static int write_mol_scheduler_state_real(FILE *fs,
 static int write_byte_order(FILE *fs);
 
 static int write_api_version(FILE *fs);
+static int write_chkpt_header(struct volume *world, FILE *fs,
+                              struct chkpt_link const *link);
+static int snapshot_mol_scheduler_state(struct volume *world,
+                                        struct chkpt_mol_record **records,
+                                        unsigned long long *n_records);
+static void start_chkpt_writer(struct volume *world,
+                               struct chkpt_writer *writer);
+static int install_chkpt_file(char const *tmpname, char const *filename,
+                              char const *keep_name);
+static void next_chkpt_link(struct volume *world, char const *filename,
+                            struct chkpt_writer *writer,
+                            struct chkpt_link *link, uint64_t **removed,
+                            unsigned long long *n_removed);
+static void retire_chkpt_deltas(char const *filename, char const *keep_name);
+static int read_chkpt_file(struct volume *world, FILE *fs,
+                           struct chkpt_replay *replay,
+                           struct chkpt_link const *expect,
+                           struct chkpt_link *link, int *has_link,
+                           uint32_t *api_version);
+static int insert_replayed_mols(struct volume *world,
+                                struct chkpt_replay *replay,
+                                uint32_t api_version);
 
 static int create_molecule_scheduler(struct storage_list *storage_head,
                                      long long start_iterations);
@@ -297,11 +410,85 @@ void chkpt_signal_handler(int signo) {
  In:  filename - the name of the checkpoint file to create
  Out: returns 1 on failure, 0 on success.  On success, checkpoint file is
       written to the appropriate filename.  On failure, the old checkpoint file
-      is left unmolested.
+      is left unmolested.  Streamed checkpoints are only complete once
+      finish_chkpt_writer has returned.  With incremental checkpoints, only
+      every chkpt_delta_interval+1'th checkpoint is written to filename; the
+      ones in between go to delta files next to it.
 ***************************************************************************/
 int create_chkpt(struct volume *world, char const *filename) {
   FILE *outfs = NULL;
 
+  /* The previous streamed checkpoint has to be in place before it can be
+   * kept or replaced */
+  if (finish_chkpt_writer(world))
+    mcell_error("Failed to write checkpoint file %s\n", filename);
+
+  /* Write checkpoint */
+  world->current_time_seconds = world->current_time_seconds +
+      (world->current_iterations - world->start_iterations) * world->time_unit;
+  // These are normally set when reading a checkpoint. They need to be set here
+  // in case we checkpoint without exiting (i.e. using NOEXIT). Otherwise,
+  // world->current_time_seconds will be set incorrectly upon subsequent calls
+  // to create_chkpt
+  world->start_iterations = world->current_iterations;
+  world->simulation_start_seconds = world->current_time_seconds;
+
+  if (world->chkpt_format != CHKPT_FORMAT_CLASSIC ||
+      world->chkpt_delta_interval > 0) {
+    /* Take a snapshot of the molecules and write the small sections now; the
+     * molecules are written while the simulation goes on. */
+    struct chkpt_writer *writer =
+        CHECKED_MALLOC_STRUCT(struct chkpt_writer, "checkpoint writer");
+    writer->compress = (world->chkpt_format == CHKPT_FORMAT_STREAM_COMPRESSED)
+                           ? CHKPT_CHUNK_ZLIB
+                           : CHKPT_CHUNK_RAW;
+    writer->free_records = 1;
+    writer->retire_deltas = 0;
+    writer->status = 0;
+    assign_chkpt_species_ids(world->n_species, world->species_list,
+                             world->chkpt_delta_interval > 0);
+    if (snapshot_mol_scheduler_state(world, &writer->records,
+                                     &writer->n_records))
+      mcell_error("Failed to write checkpoint file %s\n", filename);
+
+    struct chkpt_link link = { 0, 0, CHKPT_LINK_BASE };
+    uint64_t *removed = NULL;
+    unsigned long long n_removed = 0;
+    if (world->chkpt_delta_interval > 0)
+      next_chkpt_link(world, filename, writer, &link, &removed, &n_removed);
+    else
+      writer->filename = CHECKED_STRDUP(filename, "checkpoint file name");
+
+    /* keep previous checkpoint file if requested by appending the current
+     * iteration; deltas are never kept on their own */
+    writer->keep_name = NULL;
+    if (world->keep_chkpts && (world->chkpt_delta_interval == 0 ||
+                               link.kind == CHKPT_LINK_BASE)) {
+      writer->keep_name =
+          alloc_sprintf("%s.%lld", filename, world->current_iterations);
+      if (writer->keep_name == NULL)
+        mcell_allocfailed("Out of memory creating filename for checkpoint");
+    }
+
+    writer->tmpname = alloc_sprintf("%s.tmp", writer->filename);
+    if (writer->tmpname == NULL)
+      mcell_allocfailed("Out of memory creating temporary checkpoint filename "
+                        "for checkpoint '%s'.",
+                        writer->filename);
+    if ((outfs = fopen(writer->tmpname, "wb")) == NULL)
+      mcell_perror(errno, "Failed to write checkpoint file '%s'",
+                   writer->tmpname);
+    writer->fs = outfs;
+
+    if (write_chkpt_header(world, outfs,
+                           (world->chkpt_delta_interval > 0) ? &link : NULL) ||
+        (removed != NULL && write_removed_mols(outfs, removed, n_removed)))
+      mcell_error("Failed to write checkpoint file %s\n", writer->filename);
+    free(removed);
+    start_chkpt_writer(world, writer);
+    return 0;
+  }
+
   /* Create temporary filename */
   char *tmpname = alloc_sprintf("%s.tmp", filename);
   if (tmpname == NULL)
@@ -309,53 +496,133 @@ int create_chkpt(struct volume *world, char const *filename) {
                       "for checkpoint '%s'.",
                       filename);
 
+  /* keep previous checkpoint file if requested by appending the current
+   * iteration */
+  char *keep_name = NULL;
+  if (world->keep_chkpts) {
+    keep_name = alloc_sprintf("%s.%lld", filename, world->current_iterations);
+    if (keep_name == NULL) {
+      mcell_allocfailed("Out of memory creating filename for checkpoint");
+    }
+  }
+
   /* Open the file */
   if ((outfs = fopen(tmpname, "wb")) == NULL)
     mcell_perror(errno, "Failed to write checkpoint file '%s'", tmpname);
 
-  /* Write checkpoint */
-  world->current_time_seconds = world->current_time_seconds +
-      (world->current_iterations - world->start_iterations) * world->time_unit;
-  // These are normally set when reading a checkpoint. They need to be set here
-  // in case we checkpoint without exiting (i.e. using NOEXIT). Otherwise,
-  // world->current_time_seconds will be set incorrectly upon subsequent calls
-  // to create_chkpt
-  world->start_iterations = world->current_iterations;
-  world->simulation_start_seconds = world->current_time_seconds;
   if (write_chkpt(world, outfs))
     mcell_error("Failed to write checkpoint file %s\n", filename);
   fclose(outfs);
 
-  /* keep previous checkpoint file if requested by appending the current
-   * iteration */
-  if (world->keep_chkpts) {
+  if (install_chkpt_file(tmpname, filename, keep_name))
+    mcell_die();
+
+  free(keep_name);
+  free(tmpname);
+  return 0;
+}
+
+/***************************************************************************
+ install_chkpt_file:
+ In:  tmpname - the completely written checkpoint file
+      filename - the name of the checkpoint file
+      keep_name - where to move the previous checkpoint file, or NULL to
+                  replace it
+ Out: returns 1 on failure, 0 on success.  On success, the new checkpoint
+      file is in place.
+***************************************************************************/
+static int install_chkpt_file(char const *tmpname, char const *filename,
+                              char const *keep_name) {
+  if (keep_name != NULL) {
     /* check if previous checkpoint file exists - may not exist initially */
     struct stat buf;
     if (stat(filename, &buf) == 0) {
-      char *keepName = alloc_sprintf("%s.%lld", filename, world->current_iterations);
-      if (keepName == NULL) {
-        mcell_allocfailed("Out of memory creating filename for checkpoint");
-      }
-
-      if (rename(filename, keepName) != 0) {
-        mcell_error("Failed to save previous checkpoint file %s to %s",
-                    filename, keepName);
+      if (rename(filename, keep_name) != 0) {
+        mcell_error_nodie("Failed to save previous checkpoint file %s to %s",
+                          filename, keep_name);
+        return 1;
       }
-      free(keepName);
     }
   }
 
   /* Move it into place */
-  if (rename(tmpname, filename) != 0)
-    mcell_error("Successfully wrote checkpoint to file '%s', but failed to "
-                "atomically replace checkpoint file '%s'.\nThe simulation may "
-                "be resumed from '%s'.",
-                tmpname, filename, tmpname);
+  if (rename(tmpname, filename) != 0) {
+    mcell_error_nodie("Successfully wrote checkpoint to file '%s', but failed "
+                      "to atomically replace checkpoint file '%s'.\nThe "
+                      "simulation may be resumed from '%s'.",
+                      tmpname, filename, tmpname);
+    return 1;
+  }
 
-  free(tmpname);
   return 0;
 }
 
+/***************************************************************************
+ retire_chkpt_deltas:
+ In:  filename - the name of a base checkpoint which has just been replaced
+      keep_name - where the previous base was moved to, or NULL
+ Out: The deltas of the previous base are moved along with it, or removed if
+      it was not kept.  The directory is searched for every <filename>.dN, so
+      deltas after a gap (a failed write, or a run with a larger delta
+      interval) are retired too.  Deltas left over by a crash would be
+      rejected on restart anyway, as they belong to a different chain.
+***************************************************************************/
+static void retire_chkpt_deltas(char const *filename, char const *keep_name) {
+  char const *base = strrchr(filename, '/');
+#ifdef _WIN32
+  if (strrchr(filename, '\\') > base)
+    base = strrchr(filename, '\\');
+#endif
+  char *dir_name;
+  if (base == NULL) {
+    base = filename;
+    dir_name = alloc_sprintf(".");
+  } else {
+    ++base;
+    dir_name = alloc_sprintf("%.*s", (int)(base - filename), filename);
+  }
+  if (dir_name == NULL)
+    mcell_allocfailed("Out of memory creating filename for checkpoint");
+  size_t base_len = strlen(base);
+
+  DIR *dir = opendir(dir_name);
+  if (dir == NULL) {
+    mcell_warn("Failed to search directory %s for previous checkpoint files",
+               dir_name);
+    free(dir_name);
+    return;
+  }
+
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL) {
+    /* Only <base>.d followed by a delta number */
+    char const *suffix = entry->d_name + base_len;
+    if (strncmp(entry->d_name, base, base_len) != 0 ||
+        strncmp(suffix, ".d", 2) != 0 || suffix[2] == '\0' ||
+        strspn(suffix + 2, "0123456789") != strlen(suffix + 2))
+      continue;
+
+    char *delta_name = alloc_sprintf("%s%s", filename, suffix);
+    if (delta_name == NULL)
+      mcell_allocfailed("Out of memory creating filename for checkpoint");
+
+    if (keep_name != NULL) {
+      char *kept_name = alloc_sprintf("%s%s", keep_name, suffix);
+      if (kept_name == NULL)
+        mcell_allocfailed("Out of memory creating filename for checkpoint");
+      if (rename(delta_name, kept_name) != 0)
+        mcell_warn("Failed to save previous checkpoint file %s to %s",
+                   delta_name, kept_name);
+      free(kept_name);
+    } else if (remove(delta_name) != 0) {
+      mcell_warn("Failed to remove previous checkpoint file %s", delta_name);
+    }
+    free(delta_name);
+  }
+  closedir(dir);
+  free(dir_name);
+}
+
 /***************************************************************************
  write_varintl: Size- and endian-agnostic saving of unsigned long long values.
  In:  fs - file handle to which to write
@@ -496,18 +763,36 @@ static int read_svarint(FILE *fs, int *dest) {
       Returns 1 on error, and 0 - on success.
 ***************************************************************************/
 int write_chkpt(struct volume *world, FILE *fs) {
+  return (write_chkpt_header(world, fs, NULL) ||
+          write_mol_scheduler_state_real(fs, world->storage_head,
+              world->simulation_start_seconds, world->start_iterations,
+              world->time_unit));
+}
+
+/***************************************************************************
+ write_chkpt_header:
+ In:  fs - checkpoint file to write to.
+      link - position of the file in a chain of incremental checkpoints, or
+             NULL
+ Out: Writes all checkpoint sections except for the molecules.  The link
+      comes right after the preamble, so that a reader can reject a file
+      before any of its state has been applied.
+      Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int write_chkpt_header(struct volume *world, FILE *fs,
+                              struct chkpt_link const *link) {
+  assign_chkpt_species_ids(world->n_species, world->species_list,
+                           link != NULL);
   return (write_byte_order(fs) ||
           write_api_version(fs) ||
           write_mcell_version(fs, world->mcell_version) ||
+          (link != NULL && write_chkpt_link(fs, link)) ||
           write_current_time_seconds(fs, world->current_time_seconds) ||
           write_current_iteration(fs, world->current_iterations,
                                   world->current_time_seconds) ||
           write_chkpt_seq_num(fs, world->chkpt_seq_num) ||
           write_rng_state(fs, world->seed_seq, world->rng) ||
-          write_species_table(fs, world->n_species, world->species_list) ||
-          write_mol_scheduler_state_real(fs, world->storage_head,
-              world->simulation_start_seconds, world->start_iterations,
-              world->time_unit));
+          write_species_table(fs, world->n_species, world->species_list));
 }
 
 /***************************************************************************
@@ -559,11 +844,90 @@ static int read_preamble(FILE *fs, struct chkpt_read_state *state, uint32_t *api
 /***************************************************************************
  read_chkpt:
  In:  fs - checkpoint file to read from.
- Out: Reads checkpoint file.  Sets the values of multiple parameters
-      in the simulation.
+      filename - name of the checkpoint file, used to find its deltas.  May
+                 be NULL.
+ Out: Reads checkpoint file, followed by the incremental checkpoints which
+      were written after it.  Sets the values of multiple parameters in the
+      simulation.
       Returns 1 on error, and 0 - on success.
 ***************************************************************************/
-int read_chkpt(struct volume *world, FILE *fs) {
+int read_chkpt(struct volume *world, FILE *fs, char const *filename) {
+  struct chkpt_replay replay = { 0, NULL, 0 };
+  struct chkpt_link link;
+  int has_link;
+  uint32_t api_version;
+
+  int status = read_chkpt_file(world, fs, &replay, NULL, &link, &has_link,
+                               &api_version);
+  if (status == 0 && has_link && link.kind == CHKPT_LINK_DELTA) {
+    mcell_error_nodie("Checkpoint file is an incremental checkpoint.  The "
+                      "simulation has to be restarted from its base.");
+    status = 1;
+  }
+
+  /* Apply the deltas written after the base, in order */
+  if (status == 0 && has_link && filename != NULL) {
+    struct chkpt_link expect = { link.chain_id, link.index + 1,
+                                 CHKPT_LINK_DELTA };
+    for (;; expect.index++) {
+      char *delta_name = alloc_sprintf("%s.d%u", filename, expect.index);
+      if (delta_name == NULL)
+        mcell_allocfailed("Out of memory creating filename for checkpoint");
+
+      FILE *delta_fs = fopen(delta_name, "rb");
+      if (delta_fs == NULL) {
+        free(delta_name);
+        break;
+      }
+
+      struct chkpt_link delta_link;
+      int delta_has_link;
+      uint32_t delta_api_version;
+      status = read_chkpt_file(world, delta_fs, &replay, &expect, &delta_link,
+                               &delta_has_link, &delta_api_version);
+      fclose(delta_fs);
+      if (status < 0) {
+        mcell_warn("Ignoring checkpoint file '%s', which was not written "
+                   "after '%s'.",
+                   delta_name, filename);
+        status = 0;
+        free(delta_name);
+        break;
+      } else if (status != 0) {
+        mcell_error_nodie("Failed to read checkpoint file '%s'.", delta_name);
+        free(delta_name);
+        break;
+      }
+
+      mcell_log("Applied incremental checkpoint file '%s'.", delta_name);
+      api_version = delta_api_version;
+      free(delta_name);
+    }
+  }
+
+  if (status == 0 && replay.seen)
+    status = insert_replayed_mols(world, &replay, api_version);
+  free(replay.records);
+  return status;
+}
+
+/***************************************************************************
+ read_chkpt_file:
+ In:  fs - checkpoint file to read from.
+      replay - where to collect the molecules of a chunked section
+      expect - the delta the file has to be, or NULL for a base
+      link - where to store the position of the file in its chain
+      has_link - set if the file has a position in a chain
+      api_version - where to store the checkpoint API version of the file
+ Out: Reads one checkpoint file.  Returns 1 on error, 0 on success, and -1
+      if the file is not the expected delta.  In the latter case, the state
+      of the simulation is unchanged.
+***************************************************************************/
+static int read_chkpt_file(struct volume *world, FILE *fs,
+                           struct chkpt_replay *replay,
+                           struct chkpt_link const *expect,
+                           struct chkpt_link *link, int *has_link,
+                           uint32_t *api_version) {
   byte cmd;
 
   int seen_section[NUM_CHKPT_CMDS];
@@ -571,13 +935,15 @@ int read_chkpt(struct volume *world, FILE *fs) {
 
   struct chkpt_read_state state;
   state.byte_order_mismatch = 0;
+  state.replay = replay;
+  *has_link = 0;
 
   /* Read the required pre-amble sections */
-  uint32_t api_version;
-  if (read_preamble(fs, &state, &api_version))
+  if (read_preamble(fs, &state, api_version))
     return 1;
   seen_section[BYTE_ORDER_CMD] = 1;
   seen_section[MCELL_VERSION_CMD] = 1;
+  seen_section[CHECKPOINT_API_CMD] = 1;
 
   /* Handle all other commands */
   while (1) {
@@ -598,16 +964,36 @@ int read_chkpt(struct volume *world, FILE *fs) {
     DATACHECK(seen_section[cmd], "Duplicate command-type in checkpoint file.");
     seen_section[cmd] = 1;
 
+    /* A delta has to be identified before any of it is applied */
+    if (expect != NULL && !*has_link && cmd != CHKPT_LINK_CMD)
+      return -1;
+
     /* Process normal commands */
     switch (cmd) {
+    case CHKPT_LINK_CMD:
+      DATACHECK(seen_section[CURRENT_TIME_CMD] ||
+                    seen_section[CURRENT_ITERATION_CMD] ||
+                    seen_section[CHKPT_SEQ_NUM_CMD] ||
+                    seen_section[RNG_STATE_CMD] ||
+                    seen_section[SPECIES_TABLE_CMD],
+                "Checkpoint chain command must directly follow the MCell "
+                "version command.");
+      if (read_chkpt_link(fs, &state, link))
+        return 1;
+      *has_link = 1;
+      if (expect != NULL &&
+          (link->kind != CHKPT_LINK_DELTA ||
+           link->chain_id != expect->chain_id || link->index != expect->index))
+        return -1;
+      break;
+
     case CURRENT_TIME_CMD:
       if (read_current_time_seconds(world, fs, &state))
         return 1;
       break;
 
     case CURRENT_ITERATION_CMD:
-      if (read_current_iteration(world, fs, &state) ||
-          create_molecule_scheduler(world->storage_head, world->start_iterations))
+      if (read_current_iteration(world, fs, &state))
         return 1;
       break;
 
@@ -633,12 +1019,42 @@ int read_chkpt(struct volume *world, FILE *fs) {
       DATACHECK(
           !seen_section[SPECIES_TABLE_CMD],
           "Species table command must precede molecule scheduler command.");
-      if (read_mol_scheduler_state_real(world, fs, &state, api_version))
+      DATACHECK(seen_section[MOL_CHUNKED_STATE_CMD],
+                "Checkpoint file contains molecules in both formats.");
+      DATACHECK(*has_link,
+                "Incremental checkpoint file contains unchunked molecules.");
+      if (create_molecule_scheduler(world->storage_head,
+                                    world->start_iterations) ||
+          read_mol_scheduler_state_real(world, fs, &state, *api_version))
+        return 1;
+      break;
+
+    case MOL_CHUNKED_STATE_CMD:
+      DATACHECK(seen_section[MOL_SCHEDULER_STATE_CMD],
+                "Checkpoint file contains molecules in both formats.");
+      DATACHECK(
+          !seen_section[CURRENT_ITERATION_CMD],
+          "Current iteration command must precede molecule scheduler command.");
+      DATACHECK(
+          !seen_section[SPECIES_TABLE_CMD],
+          "Species table command must precede molecule scheduler command.");
+      if (read_mol_chunks(world, fs, &state))
+        return 1;
+      break;
+
+    case MOL_REMOVED_CMD:
+      DATACHECK(!*has_link || link->kind != CHKPT_LINK_DELTA,
+                "Removed molecules found outside of an incremental "
+                "checkpoint.");
+      DATACHECK(seen_section[MOL_CHUNKED_STATE_CMD],
+                "Removed molecules command must precede molecule chunks.");
+      if (read_removed_mols(fs, &state))
         return 1;
       break;
 
     case BYTE_ORDER_CMD:
     case MCELL_VERSION_CMD:
+    case CHECKPOINT_API_CMD:
     default:
       /* We should have already filtered out these cases, so if we get here,
        * an internal error has occurred. */
@@ -648,12 +1064,15 @@ int read_chkpt(struct volume *world, FILE *fs) {
   }
 
   /* Check for required sections */
+  if (expect != NULL && !*has_link)
+    return -1;
   DATACHECK(!seen_section[CURRENT_TIME_CMD],
             "Current time command is not present.");
   DATACHECK(!seen_section[CHKPT_SEQ_NUM_CMD],
             "Checkpoint sequence number command is not present.");
   DATACHECK(!seen_section[RNG_STATE_CMD], "RNG state command is not present.");
-  DATACHECK(!seen_section[MOL_SCHEDULER_STATE_CMD],
+  DATACHECK(!seen_section[MOL_SCHEDULER_STATE_CMD] &&
+                !seen_section[MOL_CHUNKED_STATE_CMD],
             " Molecule scheduler state command is not present.");
 
   return 0;
@@ -776,6 +1195,102 @@ static int read_mcell_version(FILE *fs, struct chkpt_read_state *state) {
   return 0;
 }
 
+/***************************************************************************
+ write_chkpt_link:
+ In:  fs - checkpoint file to write to.
+      link - position of the file in its chain of incremental checkpoints
+ Out: Writes the chain id, index and kind of the file.
+      Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int write_chkpt_link(FILE *fs, struct chkpt_link const *link) {
+  static const char SECTNAME[] = "checkpoint chain";
+  static const byte cmd = CHKPT_LINK_CMD;
+
+  WRITEFIELD(cmd);
+  WRITEUINT64(link->chain_id);
+  WRITEUINT(link->index);
+  WRITEFIELD(link->kind);
+  return 0;
+}
+
+/***************************************************************************
+ read_chkpt_link:
+ In:  fs - checkpoint file to read from.
+      link - where to store the position of the file in its chain
+ Out: Reads the chain id, index and kind of the file.
+      Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int read_chkpt_link(FILE *fs, struct chkpt_read_state *state,
+                           struct chkpt_link *link) {
+  static const char SECTNAME[] = "checkpoint chain";
+  READUINT64(link->chain_id);
+  READUINT(link->index);
+  READFIELDRAW(link->kind);
+  DATACHECK(link->kind != CHKPT_LINK_BASE && link->kind != CHKPT_LINK_DELTA,
+            "Unknown kind of checkpoint file (%d).", (int)link->kind);
+  return 0;
+}
+
+/***************************************************************************
+ write_removed_mols:
+ In:  fs - checkpoint file to write to.
+      ids - ids of the molecules removed since the previous checkpoint, in
+            ascending order
+      n_ids - number of ids
+ Out: Writes the ids as differences to the previous id.
+      Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int write_removed_mols(FILE *fs, uint64_t const *ids,
+                              unsigned long long n_ids) {
+  static const char SECTNAME[] = "removed molecules";
+  static const byte cmd = MOL_REMOVED_CMD;
+
+  WRITEFIELD(cmd);
+  WRITEUINT64(n_ids);
+  uint64_t prev = 0;
+  for (unsigned long long i = 0; i < n_ids; i++) {
+    WRITEUINT64(ids[i] - prev);
+    prev = ids[i];
+  }
+  return 0;
+}
+
+/***************************************************************************
+ read_removed_mols:
+ In:  fs - checkpoint file to read from.
+      state - contextual state; the molecules are removed from
+              state->replay
+ Out: Reads the ids of removed molecules and drops them from the molecules
+      read so far.  Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int read_removed_mols(FILE *fs, struct chkpt_read_state *state) {
+  static const char SECTNAME[] = "removed molecules";
+  struct chkpt_replay *replay = state->replay;
+
+  unsigned long long n_ids;
+  READUINT64(n_ids);
+
+  /* Both the ids and the molecules are sorted, so one pass does */
+  unsigned long long kept = 0, next = 0;
+  uint64_t id = 0;
+  for (unsigned long long i = 0; i < n_ids; i++) {
+    unsigned long long diff;
+    READUINT64(diff);
+    DATACHECK(i > 0 && diff == 0, "Removed molecule ids are not sorted.");
+    id += diff;
+
+    while (next < replay->n_records && replay->records[next].id < id)
+      replay->records[kept++] = replay->records[next++];
+    DATACHECK(next == replay->n_records || replay->records[next].id != id,
+              "Removed molecule %llu does not exist.", (unsigned long long)id);
+    next++;
+  }
+  while (next < replay->n_records)
+    replay->records[kept++] = replay->records[next++];
+  replay->n_records = kept;
+  return 0;
+}
+
 /***************************************************************************
  write_current_time_seconds:
  In:  fs - checkpoint file to write to.
@@ -903,6 +1418,14 @@ static int write_an_rng_state(FILE *fs, struct rng_state *rng) {
   WRITEFIELD(rng->b);
   WRITEFIELD(rng->c);
   WRITEFIELD(rng->d);
+#elif defined(USE_PHILOX_RNG)
+  static const char RNG_PHILOX = 'P';
+  WRITEFIELD(RNG_PHILOX);
+  WRITEUINT(rng->randcnt);
+  WRITEARRAY(rng->key, 2);
+  WRITEFIELD(rng->stream);
+  WRITEFIELD(rng->counter);
+  WRITEARRAY(rng->randrsl, PHILOX_RANDMAX);
 #else
   static const char RNG_ISAAC = 'I';
   WRITEFIELD(RNG_ISAAC);
@@ -957,6 +1480,21 @@ static int read_an_rng_state(FILE *fs, struct chkpt_read_state *state,
   READFIELD(rng->c);
   READFIELD(rng->d);
 
+#elif defined(USE_PHILOX_RNG)
+  static const char RNG_PHILOX = 'P';
+  char rngtype;
+  READFIELD(rngtype);
+  DATACHECK(rngtype != RNG_PHILOX, "Invalid RNG type stored in checkpoint file "
+                                   "(in this version of MCell, only Philox "
+                                   "is supported).");
+
+  READUINT(rng->randcnt);
+  READARRAY(rng->key, 2);
+  READFIELD(rng->stream);
+  READFIELD(rng->counter);
+  READARRAY(rng->randrsl, PHILOX_RANDMAX);
+  rng->rngblocks = 1;
+
 #else
   static const char RNG_ISAAC = 'I';
   char rngtype;
@@ -1002,15 +1540,37 @@ static int read_rng_state(struct volume *world, FILE *fs,
 
   /* Reinitialize rngs to beginning of new seed sequence, if necessary. */
   if (world->seed_seq != old_seed)
-    rng_init(world->rng, world->seed_seq);
+    rng_init_stream(world->rng, world->seed_seq, RNG_STREAM_GLOBAL, 0);
 
   return 0;
 }
 
+/***************************************************************************
+ assign_chkpt_species_ids:
+ In:  n_species - number of species
+      species_list - all species
+      all_species - if set, every species gets an id, and the id of a species
+                    stays the same from one checkpoint to the next
+ Out: Sets the external (checkpoint) ids of the species to write.  Species
+      which are not written get UINT_MAX.
+***************************************************************************/
+static void assign_chkpt_species_ids(int n_species,
+                                     struct species **species_list,
+                                     int all_species) {
+  unsigned int external_species_id = 0;
+  for (int i = 0; i < n_species; i++) {
+    if (all_species || species_list[i]->population > 0)
+      species_list[i]->chkpt_species_id = external_species_id++;
+    else
+      species_list[i]->chkpt_species_id = UINT_MAX;
+  }
+}
+
 /***************************************************************************
  write_species_table:
  In:  fs - checkpoint file to write to.
- Out: Writes species data to the checkpoint file.
+ Out: Writes species data to the checkpoint file.  The species ids have to
+      be assigned by assign_chkpt_species_ids first.
       Returns 1 on error, and 0 - on success.
 ***************************************************************************/
 static int write_species_table(FILE *fs, int n_species,
@@ -1020,29 +1580,25 @@ static int write_species_table(FILE *fs, int n_species,
 
   WRITEFIELD(cmd);
 
-  /* Write total number of existing species with at least one representative. */
-  unsigned int non_empty_species_count = 0;
+  /* Write total number of species with an external id. */
+  unsigned int written_species_count = 0;
   int i;
   for (i = 0; i < n_species; i++) {
-    if (species_list[i]->population > 0)
-      ++non_empty_species_count;
+    if (species_list[i]->chkpt_species_id != UINT_MAX)
+      ++written_species_count;
   }
-  WRITEUINT(non_empty_species_count);
+  WRITEUINT(written_species_count);
 
-  /* Write out all species which have at least one representative. */
-  unsigned int external_species_id = 0;
+  /* Write out all species with an external id.  The stored id is used in
+   * make_mol_record to assign external species ids to mols as they are
+   * written out. */
   for (i = 0; i < n_species; i++) {
-    if (species_list[i]->population == 0)
+    if (species_list[i]->chkpt_species_id == UINT_MAX)
       continue;
 
     /* Write species name and external id. */
     WRITESTRING(species_list[i]->sym->name);
-    WRITEUINT(external_species_id);
-
-    /* Allocate and write the external species id for this species.  Stored
-     * value is used in wrote_mol_scheduler_state to assign external species
-     * ids to mols as they are written out. */
-    species_list[i]->chkpt_species_id = external_species_id++;
+    WRITEUINT(species_list[i]->chkpt_species_id);
   }
 
   return 0;
@@ -1061,6 +1617,10 @@ static int read_species_table(struct volume *world, FILE *fs) {
   unsigned int total_species;
   READUINT(total_species);
 
+  /* Species not in the table have no molecules in this file */
+  for (int j = 0; j < world->n_species; j++)
+    world->species_list[j]->chkpt_species_id = UINT_MAX;
+
   /* Scan over species table, reading in species data */
   for (unsigned int i = 0; i < total_species; i++) {
     unsigned int species_name_length;
@@ -1131,6 +1691,72 @@ count_items_in_scheduler(struct storage_list *storage_head) {
   return total_items;
 }
 
+/***************************************************************************
+ make_mol_record:
+ In:  amp - molecule from the scheduler
+      simulation_start_seconds, start_iterations, time_unit - used to
+      convert scheduler times into seconds
+      rec - record to fill in
+ Out: Returns 1 if the molecule was recorded, 0 if it is not checkpointed and
+      -1 on error.
+***************************************************************************/
+static int make_mol_record(struct abstract_molecule *amp,
+                           double simulation_start_seconds,
+                           double start_iterations, double time_unit,
+                           struct chkpt_mol_record *rec) {
+  /* Grab the location and orientation for this molecule */
+  if ((amp->properties->flags & NOT_FREE) == 0) {
+    struct volume_molecule *vmp = (struct volume_molecule *)amp;
+    if (vmp->previous_wall != NULL && vmp->index >= 0) {
+      mcell_warn("%s internal: The value of 'previous_grid' is not NULL.",
+                 __func__);
+      return -1;
+    }
+    rec->where = vmp->pos;
+    rec->orient = 0;
+  } else if ((amp->properties->flags & ON_GRID) != 0) {
+    struct surface_molecule *smp = (struct surface_molecule *)amp;
+    uv2xyz(&smp->s_pos, smp->grid->surface, &rec->where);
+    rec->orient = smp->orient;
+  } else
+    return 0;
+
+  /* Check for valid chkpt_species ID. */
+  if (amp->properties->chkpt_species_id == UINT_MAX) {
+    mcell_warn("%s internal: Attempted to write out a molecule of species "
+               "'%s', which has not been assigned a checkpoint species id.",
+               __func__, amp->properties->sym->name);
+    return -1;
+  }
+  rec->id = amp->id;
+  rec->species_id = amp->properties->chkpt_species_id;
+  rec->act_newbie_flag =
+      (amp->flags & ACT_NEWBIE) ? HAS_ACT_NEWBIE : HAS_NOT_ACT_NEWBIE;
+  rec->act_change_flag =
+      (amp->flags & ACT_CHANGE) ? HAS_ACT_CHANGE : HAS_NOT_ACT_CHANGE;
+
+  // NOTE: we write all times as real times (seconds) *not* as
+  // "iterations" (or "scaled times") in order to be able to
+  // re-schedule them properly upon restart
+
+  // The scheduling time (t) is essentially iterations, and since time
+  // steps can change when checkpointing, we can't directly convert
+  // iterations to real time (seconds). We need to correct for this by
+  // only converting the iterations of the current simulation
+  // [(t-start_iterations)*time_unit] and adding the real time at the
+  // start of the simulation (simulation_start_seconds).
+  rec->t = convert_iterations_to_seconds(
+      start_iterations, time_unit, simulation_start_seconds, amp->t);
+  // We do a simple conversion for the lifetime t2, since this
+  // corresponds to some event in the future and can be directly
+  // computed without using an offset.
+  rec->t2 = amp->t2 * time_unit;
+  // Birthday is now always treated as real time in seconds, not
+  // "scaled" time or iterations.
+  rec->birthday = amp->birthday;
+  return 1;
+}
+
 /***************************************************************************
  write_mol_scheduler_state_real:
  In:  fs - checkpoint file to write to.
@@ -1163,63 +1789,23 @@ static int write_mol_scheduler_state_real(FILE *fs,
           if (amp->properties == NULL)
             continue;
 
-          /* Grab the location and orientation for this molecule */
-          struct vector3 where;
-          short orient = 0;
-          byte act_newbie_flag =
-              (amp->flags & ACT_NEWBIE) ? HAS_ACT_NEWBIE : HAS_NOT_ACT_NEWBIE;
-          byte act_change_flag =
-              (amp->flags & ACT_CHANGE) ? HAS_ACT_CHANGE : HAS_NOT_ACT_CHANGE;
-          if ((amp->properties->flags & NOT_FREE) == 0) {
-            struct volume_molecule *vmp = (struct volume_molecule *)amp;
-            INTERNALCHECK(vmp->previous_wall != NULL && vmp->index >= 0,
-                          "The value of 'previous_grid' is not NULL.");
-            where.x = vmp->pos.x;
-            where.y = vmp->pos.y;
-            where.z = vmp->pos.z;
-            orient = 0;
-          } else if ((amp->properties->flags & ON_GRID) != 0) {
-            struct surface_molecule *smp = (struct surface_molecule *)amp;
-            uv2xyz(&smp->s_pos, smp->grid->surface, &where);
-            orient = smp->orient;
-          } else
+          struct chkpt_mol_record rec;
+          int recorded = make_mol_record(amp, simulation_start_seconds,
+                                         start_iterations, time_unit, &rec);
+          if (recorded < 0)
+            return 1;
+          else if (recorded == 0)
             continue;
 
-          /* Check for valid chkpt_species ID. */
-          INTERNALCHECK(amp->properties->chkpt_species_id == UINT_MAX,
-                        "Attempted to write out a molecule of species '%s', "
-                        "which has not been assigned a checkpoint species id.",
-                        amp->properties->sym->name);
-
           /* write molecule fields */
-          WRITEUINT(amp->properties->chkpt_species_id);
-          WRITEFIELD(act_newbie_flag);
-          WRITEFIELD(act_change_flag);
-
-          // NOTE: we write all times as real times (seconds) *not* as
-          // "iterations" (or "scaled times") in order to be able to
-          // re-schedule them properly upon restart
-
-          // The scheduling time (t) is essentially iterations, and since time
-          // steps can change when checkpointing, we can't directly convert
-          // iterations to real time (seconds). We need to correct for this by
-          // only converting the iterations of the current simulation
-          // [(t-start_iterations)*time_unit] and adding the real time at the
-          // start of the simulation (simulation_start_seconds).
-          double t = convert_iterations_to_seconds(
-              start_iterations, time_unit, simulation_start_seconds, amp->t);
-          WRITEFIELD(t);
-          // We do a simple conversion for the lifetime t2, since this
-          // corresponds to some event in the future and can be directly
-          // computed without using an offset.
-          double t2 = amp->t2 * time_unit;
-          WRITEFIELD(t2);
-          // Birthday is now always treated as real time in seconds, not
-          // "scaled" time or iterations.
-          double bday = amp->birthday;
-          WRITEFIELD(bday);
-          WRITEFIELD(where);
-          WRITEINT(orient);
+          WRITEUINT(rec.species_id);
+          WRITEFIELD(rec.act_newbie_flag);
+          WRITEFIELD(rec.act_change_flag);
+          WRITEFIELD(rec.t);
+          WRITEFIELD(rec.t2);
+          WRITEFIELD(rec.birthday);
+          WRITEFIELD(rec.where);
+          WRITEINT(rec.orient);
 
           static const unsigned char NON_COMPLEX = '\0';
           WRITEFIELD(NON_COMPLEX);
@@ -1231,6 +1817,573 @@ static int write_mol_scheduler_state_real(FILE *fs,
   return 0;
 }
 
+/***************************************************************************
+ snapshot_mol_scheduler_state:
+ In:  world - simulation state
+      records - where to store the malloc'd array of molecule records
+      n_records - where to store the number of records
+ Out: Copies every checkpointed molecule into a flat array, so that the
+      simulation can go on while the array is written.
+      Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int snapshot_mol_scheduler_state(struct volume *world,
+                                        struct chkpt_mol_record **records,
+                                        unsigned long long *n_records) {
+  unsigned long long total_items =
+      count_items_in_scheduler(world->storage_head);
+  struct chkpt_mol_record *recs = CHECKED_MALLOC_ARRAY(
+      struct chkpt_mol_record, (total_items > 0) ? total_items : 1,
+      "checkpoint molecule snapshot");
+
+  unsigned long long n = 0;
+  for (struct storage_list *slp = world->storage_head; slp != NULL;
+       slp = slp->next) {
+    for (struct schedule_helper *shp = slp->store->timer; shp != NULL;
+         shp = shp->next_scale) {
+      for (int i = -1; i < shp->buf_len; i++) {
+        for (struct abstract_element *aep = (i < 0) ? shp->current
+                                                    : shp->circ_buf_head[i];
+             aep != NULL; aep = aep->next) {
+          struct abstract_molecule *amp = (struct abstract_molecule *)aep;
+          if (amp->properties == NULL)
+            continue;
+
+          int recorded = make_mol_record(amp, world->simulation_start_seconds,
+                                         world->start_iterations,
+                                         world->time_unit, &recs[n]);
+          if (recorded < 0) {
+            free(recs);
+            return 1;
+          }
+          n += recorded;
+        }
+      }
+    }
+  }
+
+  *records = recs;
+  *n_records = n;
+  return 0;
+}
+
+/* qsort comparison of molecule records by id */
+static int compare_mol_record_ids(void const *a, void const *b) {
+  uint64_t id_a = ((struct chkpt_mol_record const *)a)->id;
+  uint64_t id_b = ((struct chkpt_mol_record const *)b)->id;
+  return (id_a > id_b) - (id_a < id_b);
+}
+
+/***************************************************************************
+ same_mol_state:
+ In:  a, b - records of the same molecule in two snapshots
+ Out: Returns 1 if the molecule would be restored the same from either
+      record.  Scheduling times and lifetimes are recomputed on restart, so
+      they do not count.
+***************************************************************************/
+static int same_mol_state(struct chkpt_mol_record const *a,
+                          struct chkpt_mol_record const *b) {
+  return a->species_id == b->species_id && a->orient == b->orient &&
+         a->act_newbie_flag == b->act_newbie_flag &&
+         a->birthday == b->birthday && a->where.x == b->where.x &&
+         a->where.y == b->where.y && a->where.z == b->where.z;
+}
+
+/***************************************************************************
+ diff_mol_snapshots:
+ In:  prev, n_prev - previous snapshot, sorted by id
+      cur, n_cur - current snapshot, sorted by id
+      changed, n_changed - where to store the malloc'd records of the
+                           molecules created or changed since prev
+      removed, n_removed - where to store the malloc'd ids of the molecules
+                           gone since prev
+ Out: Both outputs are sorted by id.
+***************************************************************************/
+static void diff_mol_snapshots(struct chkpt_mol_record const *prev,
+                               unsigned long long n_prev,
+                               struct chkpt_mol_record const *cur,
+                               unsigned long long n_cur,
+                               struct chkpt_mol_record **changed,
+                               unsigned long long *n_changed,
+                               uint64_t **removed,
+                               unsigned long long *n_removed) {
+  unsigned long long i = 0, j = 0, n_ch = 0, n_rm = 0;
+  while (i < n_prev || j < n_cur) {
+    if (j == n_cur || (i < n_prev && prev[i].id < cur[j].id)) {
+      ++n_rm;
+      ++i;
+    } else if (i == n_prev || cur[j].id < prev[i].id) {
+      ++n_ch;
+      ++j;
+    } else {
+      n_ch += !same_mol_state(&prev[i], &cur[j]);
+      ++i;
+      ++j;
+    }
+  }
+
+  struct chkpt_mol_record *ch = CHECKED_MALLOC_ARRAY(
+      struct chkpt_mol_record, (n_ch > 0) ? n_ch : 1,
+      "checkpoint molecule delta");
+  uint64_t *rm = CHECKED_MALLOC_ARRAY(uint64_t, (n_rm > 0) ? n_rm : 1,
+                                      "checkpoint molecule delta");
+
+  i = j = n_ch = n_rm = 0;
+  while (i < n_prev || j < n_cur) {
+    if (j == n_cur || (i < n_prev && prev[i].id < cur[j].id)) {
+      rm[n_rm++] = prev[i++].id;
+    } else if (i == n_prev || cur[j].id < prev[i].id) {
+      ch[n_ch++] = cur[j++];
+    } else {
+      if (!same_mol_state(&prev[i], &cur[j]))
+        ch[n_ch++] = cur[j];
+      ++i;
+      ++j;
+    }
+  }
+
+  *changed = ch;
+  *n_changed = n_ch;
+  *removed = rm;
+  *n_removed = n_rm;
+}
+
+/***************************************************************************
+ new_chain_id:
+ In:  world - simulation state
+ Out: Returns an id for a new chain of incremental checkpoints.  It only has
+      to tell the deltas of one base from those of a base written before.
+***************************************************************************/
+static unsigned long long new_chain_id(struct volume *world) {
+  static unsigned long long n_chains = 0;
+  uint64_t x = ((uint64_t)time(NULL) << 24) ^ (uint64_t)clock() ^
+               ((uint64_t)world->current_iterations << 8) ^ ++n_chains;
+
+  /* splitmix64 finalizer */
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/***************************************************************************
+ next_chkpt_link:
+ In:  world - simulation state
+      filename - the name of the checkpoint file to create
+      writer - checkpoint writer holding the snapshot of the molecules
+      link - where to store the position of the new file in its chain
+      removed, n_removed - where to store the malloc'd ids of the molecules
+                           removed since the previous checkpoint, for deltas
+ Out: Decides whether the checkpoint is a new base or a delta.  For a delta,
+      the writer is left with the changed molecules only, and is pointed at
+      the delta file.  The full snapshot is kept to diff the next checkpoint
+      against.
+***************************************************************************/
+static void next_chkpt_link(struct volume *world, char const *filename,
+                            struct chkpt_writer *writer,
+                            struct chkpt_link *link, uint64_t **removed,
+                            unsigned long long *n_removed) {
+  struct chkpt_chain *chain = world->chkpt_chain;
+  struct chkpt_mol_record *records = writer->records;
+  unsigned long long n_records = writer->n_records;
+
+  qsort(records, n_records, sizeof(struct chkpt_mol_record),
+        compare_mol_record_ids);
+
+  /* Molecules can only be matched across checkpoints by a unique id */
+  int unique_ids = 1;
+  for (unsigned long long i = 1; i < n_records && unique_ids; i++)
+    unique_ids = (records[i - 1].id != records[i].id);
+
+  if (chain != NULL && chain->records != NULL && unique_ids &&
+      chain->n_deltas < (unsigned int)world->chkpt_delta_interval &&
+      strcmp(chain->filename, filename) == 0) {
+    ++chain->n_deltas;
+    diff_mol_snapshots(chain->records, chain->n_records, records, n_records,
+                       &writer->records, &writer->n_records, removed,
+                       n_removed);
+    free(chain->records);
+    chain->records = records;
+    chain->n_records = n_records;
+
+    link->chain_id = chain->chain_id;
+    link->index = chain->n_deltas;
+    link->kind = CHKPT_LINK_DELTA;
+    writer->filename = alloc_sprintf("%s.d%u", filename, chain->n_deltas);
+    if (writer->filename == NULL)
+      mcell_allocfailed("Out of memory creating filename for checkpoint");
+    return;
+  }
+
+  /* Start a new chain with a full checkpoint */
+  if (chain == NULL) {
+    chain = CHECKED_MALLOC_STRUCT(struct chkpt_chain, "checkpoint chain");
+    chain->filename = NULL;
+    chain->records = NULL;
+    world->chkpt_chain = chain;
+  }
+  free(chain->filename);
+  free(chain->records);
+  chain->chain_id = new_chain_id(world);
+  chain->n_deltas = 0;
+  chain->filename = CHECKED_STRDUP(filename, "checkpoint file name");
+  if (unique_ids) {
+    /* the writer only reads the snapshot, so it can be kept as it is */
+    chain->records = records;
+    chain->n_records = n_records;
+    writer->free_records = 0;
+  } else {
+    chain->records = NULL;
+    chain->n_records = 0;
+  }
+
+  link->chain_id = chain->chain_id;
+  link->index = 0;
+  link->kind = CHKPT_LINK_BASE;
+  writer->filename = CHECKED_STRDUP(filename, "checkpoint file name");
+  writer->retire_deltas = 1;
+  *removed = NULL;
+  *n_removed = 0;
+}
+
+/***************************************************************************
+ write_mol_chunks:
+ In:  fs - checkpoint file to write to.
+      records - molecule snapshot
+      n_records - number of molecules in the snapshot
+      compress - CHKPT_CHUNK_RAW or CHKPT_CHUNK_ZLIB
+ Out: Writes the chunked molecule section.  Each chunk is preceded by its
+      number of molecules, raw size and stored size, so that chunks can be
+      decoded independently of each other.
+      Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int write_mol_chunks(FILE *fs, struct chkpt_mol_record *records,
+                            unsigned long long n_records, byte compress) {
+  static const char SECTNAME[] = "molecule chunks";
+  static const byte cmd = MOL_CHUNKED_STATE_CMD;
+
+  unsigned int n_chunks =
+      (unsigned int)((n_records + CHKPT_CHUNK_RECORDS - 1) /
+                     CHKPT_CHUNK_RECORDS);
+  WRITEFIELD(cmd);
+  WRITEUINT64(n_records);
+  WRITEUINT(n_chunks);
+  WRITEFIELD(compress);
+
+  unsigned char *buffer = NULL;
+#ifdef MCELL_WITH_ZLIB
+  uLongf buffer_size = 0;
+  if (compress == CHKPT_CHUNK_ZLIB) {
+    buffer_size =
+        compressBound(CHKPT_CHUNK_RECORDS * sizeof(struct chkpt_mol_record));
+    buffer = CHECKED_MALLOC_ARRAY_NODIE(unsigned char, buffer_size,
+                                        "checkpoint compression buffer");
+    if (buffer == NULL)
+      return 1;
+  }
+#endif
+
+  int status = 0;
+  for (unsigned long long first = 0; first < n_records && status == 0;
+       first += CHKPT_CHUNK_RECORDS) {
+    uint32_t n = (uint32_t)((n_records - first < CHKPT_CHUNK_RECORDS)
+                                ? n_records - first
+                                : CHKPT_CHUNK_RECORDS);
+    uint32_t raw_size = n * (uint32_t)sizeof(struct chkpt_mol_record);
+    const unsigned char *payload = (const unsigned char *)(records + first);
+    uint32_t stored_size = raw_size;
+
+#ifdef MCELL_WITH_ZLIB
+    if (compress == CHKPT_CHUNK_ZLIB) {
+      uLongf dest_size = buffer_size;
+      if (compress2(buffer, &dest_size, payload, raw_size, Z_BEST_SPEED) !=
+          Z_OK) {
+        mcell_warn("Failed to compress checkpoint molecule chunk.");
+        status = 1;
+        break;
+      }
+      payload = buffer;
+      stored_size = (uint32_t)dest_size;
+    }
+#endif
+
+    if (fwrite(&n, sizeof(n), 1, fs) != 1 ||
+        fwrite(&raw_size, sizeof(raw_size), 1, fs) != 1 ||
+        fwrite(&stored_size, sizeof(stored_size), 1, fs) != 1 ||
+        fwrite(payload, 1, stored_size, fs) != stored_size) {
+      mcell_perror_nodie(errno, "Error while writing '%s' to checkpoint file",
+                         SECTNAME);
+      status = 1;
+    }
+  }
+
+  free(buffer);
+  return status;
+}
+
+/***************************************************************************
+ chkpt_writer_main:
+ In:  arg - the checkpoint writer
+ Out: Writes the molecule snapshot, closes the file and moves it into place.
+      The outcome is left in writer->status.
+***************************************************************************/
+static void *chkpt_writer_main(void *arg) {
+  struct chkpt_writer *writer = (struct chkpt_writer *)arg;
+
+  writer->status = write_mol_chunks(writer->fs, writer->records,
+                                    writer->n_records, (byte)writer->compress);
+  if (fclose(writer->fs) != 0) {
+    mcell_perror_nodie(errno, "Failed to close checkpoint file '%s'",
+                       writer->tmpname);
+    writer->status = 1;
+  }
+  writer->fs = NULL;
+
+  if (writer->free_records)
+    free(writer->records);
+  writer->records = NULL;
+
+  if (writer->status == 0) {
+    writer->status = install_chkpt_file(writer->tmpname, writer->filename,
+                                        writer->keep_name);
+    if (writer->status == 0 && writer->retire_deltas)
+      retire_chkpt_deltas(writer->filename, writer->keep_name);
+  }
+  return NULL;
+}
+
+/***************************************************************************
+ start_chkpt_writer:
+ In:  world - simulation state
+      writer - checkpoint writer with the header written and the snapshot
+               taken
+ Out: The snapshot is written by a new thread.  If no thread can be
+      created, it is written right away.
+***************************************************************************/
+static void start_chkpt_writer(struct volume *world,
+                               struct chkpt_writer *writer) {
+  world->chkpt_writer = writer;
+  if (pthread_create(&writer->thread, NULL, chkpt_writer_main, writer) != 0) {
+    mcell_warn("Could not start the checkpoint writer thread, writing the "
+               "checkpoint in the foreground.");
+    chkpt_writer_main(writer);
+    writer->thread = pthread_self();
+  }
+}
+
+/***************************************************************************
+ finish_chkpt_writer:
+ In:  world - simulation state
+ Out: Waits until the most recent streamed checkpoint, if any, is written
+      and in place.  Returns 1 if it could not be written, 0 otherwise.
+***************************************************************************/
+int finish_chkpt_writer(struct volume *world) {
+  struct chkpt_writer *writer = world->chkpt_writer;
+  if (writer == NULL)
+    return 0;
+
+  if (!pthread_equal(writer->thread, pthread_self()))
+    pthread_join(writer->thread, NULL);
+
+  int status = writer->status;
+  free(writer->tmpname);
+  free(writer->filename);
+  free(writer->keep_name);
+  free(writer);
+  world->chkpt_writer = NULL;
+  return status;
+}
+
+/***************************************************************************
+ make_chkpt_species_index:
+ In:  world - simulation state, after the species table has been read
+      n_ids - where to store the size of the table
+ Out: Returns a malloc'd table mapping external species ids to indices into
+      world->species_list.  Ids which are not in use map to UINT_MAX.
+***************************************************************************/
+static unsigned int *make_chkpt_species_index(struct volume *world,
+                                              unsigned int *n_ids) {
+  unsigned int n = 0;
+  for (int i = 0; i < world->n_species; i++) {
+    unsigned int id = world->species_list[i]->chkpt_species_id;
+    if (id != UINT_MAX && id >= n)
+      n = id + 1;
+  }
+
+  unsigned int *table = CHECKED_MALLOC_ARRAY(
+      unsigned int, (n > 0) ? n : 1, "checkpoint species table");
+  for (unsigned int id = 0; id < n; id++)
+    table[id] = UINT_MAX;
+  for (int i = 0; i < world->n_species; i++) {
+    unsigned int id = world->species_list[i]->chkpt_species_id;
+    if (id != UINT_MAX && table[id] == UINT_MAX)
+      table[id] = (unsigned int)i;
+  }
+
+  *n_ids = n;
+  return table;
+}
+
+/***************************************************************************
+ merge_mol_records:
+ In:  replay - molecules read so far, sorted by id
+      records, n_records - molecules of a delta, sorted by id; freed here
+ Out: Molecules of the delta replace those with the same id, others are
+      added.
+***************************************************************************/
+static void merge_mol_records(struct chkpt_replay *replay,
+                              struct chkpt_mol_record *records,
+                              unsigned long long n_records) {
+  unsigned long long n_old = replay->n_records;
+  struct chkpt_mol_record *old = replay->records;
+  struct chkpt_mol_record *merged = CHECKED_MALLOC_ARRAY(
+      struct chkpt_mol_record, (n_old + n_records > 0) ? n_old + n_records : 1,
+      "checkpoint molecule records");
+
+  unsigned long long i = 0, j = 0, n = 0;
+  while (i < n_old && j < n_records) {
+    if (old[i].id < records[j].id)
+      merged[n++] = old[i++];
+    else if (records[j].id < old[i].id)
+      merged[n++] = records[j++];
+    else {
+      merged[n++] = records[j++];
+      ++i;
+    }
+  }
+  while (i < n_old)
+    merged[n++] = old[i++];
+  while (j < n_records)
+    merged[n++] = records[j++];
+
+  free(old);
+  free(records);
+  replay->records = merged;
+  replay->n_records = n;
+}
+
+/***************************************************************************
+ restore_molecule:
+ In:  world - simulation state
+      properties - species of the molecule
+      act_newbie_flag, act_change_flag, sched_time, lifetime, birthday,
+      where, orient - molecule fields as stored in the checkpoint file
+      api_version - checkpoint API version of the file
+      guess - subvolume guess for volume molecules, updated on return
+ Out: Creates the molecule and adds it to the scheduler.
+***************************************************************************/
+static void restore_molecule(struct volume *world, struct species *properties,
+                             byte act_newbie_flag, byte act_change_flag,
+                             double sched_time, double lifetime,
+                             double birthday, struct vector3 *where,
+                             int orient, uint32_t api_version,
+                             struct volume_molecule **guess) {
+  // starting with API version 1, convert the sched_time, lifetime and
+  // birthday into scaled time based on the current timestep
+  if (api_version >= 1) {
+    // This will force lifetimes to be recomputed. This is necessary if
+    // unimolecular rate constants change between checkpoints.
+    lifetime = 0;
+    sched_time = world->start_iterations;
+    act_change_flag = HAS_ACT_CHANGE;
+  }
+
+  /* Create and add molecule to scheduler */
+  struct periodic_image periodic_box = { .x = 0,
+                                         .y = 0,
+                                         .z = 0
+                                       };
+  if ((properties->flags & NOT_FREE) == 0) { /* 3D molecule */
+    struct volume_molecule vm;
+    struct volume_molecule *vmp = &vm;
+    struct abstract_molecule *amp = (struct abstract_molecule *)vmp;
+    memset(&vm, 0, sizeof(struct volume_molecule));
+
+    /* set molecule characteristics */
+    amp->t = sched_time;
+    amp->t2 = lifetime;
+    amp->birthday = birthday;
+    amp->properties = properties;
+    initialize_diffusion_function(amp);
+    if(amp->properties->flags & EXTERNAL_SPECIES)
+      properties_nfsim(world, amp);
+    vmp->previous_wall = NULL;
+    vmp->index = -1;
+    vmp->pos = *where;
+    amp->periodic_box = &periodic_box;
+
+    /* Set molecule flags */
+    amp->flags = TYPE_VOL | IN_VOLUME;
+    if (act_newbie_flag == HAS_ACT_NEWBIE)
+      amp->flags |= ACT_NEWBIE;
+
+    if (act_change_flag == HAS_ACT_CHANGE)
+      amp->flags |= ACT_CHANGE;
+
+    amp->flags |= IN_SCHEDULE;
+    if ((amp->properties->flags & CAN_SURFWALL) != 0 ||
+        trigger_unimolecular(world->reaction_hash, world->rx_hashsize,
+                             amp->properties->hashval, amp) != NULL)
+      amp->flags |= ACT_REACT;
+    if (amp->get_space_step(amp) > 0.0)
+      amp->flags |= ACT_DIFFUSE;
+
+    /* Insert copy of vm into world */
+    *guess = insert_volume_molecule(world, vmp, *guess);
+    if (*guess == NULL) {
+      mcell_error("Cannot insert copy of molecule of species '%s' into "
+                  "world.\nThis may be caused by a shortage of memory.",
+                  vmp->properties->sym->name);
+    }
+
+  } else { /* surface_molecule */
+    struct surface_molecule *smp = insert_surface_molecule(
+        world, properties, where, orient, CHKPT_GRID_TOLERANCE, sched_time,
+        NULL, NULL, NULL, &periodic_box);
+
+    if (smp == NULL) {
+      mcell_warn("Could not place molecule %s at (%f,%f,%f).",
+                 properties->sym->name, where->x * world->length_unit,
+                 where->y * world->length_unit,
+                 where->z * world->length_unit);
+      return;
+    }
+
+    smp->t2 = lifetime;
+    smp->birthday = birthday;
+    if (act_newbie_flag == HAS_NOT_ACT_NEWBIE)
+      smp->flags &= ~ACT_NEWBIE;
+
+    if (act_change_flag == HAS_ACT_CHANGE) {
+      smp->flags |= ACT_CHANGE;
+    }
+  }
+}
+
+/***************************************************************************
+ insert_replayed_mols:
+ In:  world - simulation state
+      replay - molecules of all checkpoint files read
+      api_version - checkpoint API version of the last file
+ Out: Creates the molecule scheduler and adds the molecules to it.  The
+      scheduler and subvolumes are not thread-safe, so this is serial.
+      Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int insert_replayed_mols(struct volume *world,
+                                struct chkpt_replay *replay,
+                                uint32_t api_version) {
+  if (create_molecule_scheduler(world->storage_head, world->start_iterations))
+    return 1;
+
+  struct volume_molecule *guess = NULL;
+  for (unsigned long long i = 0; i < replay->n_records; i++) {
+    struct chkpt_mol_record *rec = &replay->records[i];
+    restore_molecule(world, world->species_list[rec->species_id],
+                     rec->act_newbie_flag, rec->act_change_flag, rec->t,
+                     rec->t2, rec->birthday, &rec->where, rec->orient,
+                     api_version, &guess);
+  }
+  return 0;
+}
+
 /***************************************************************************
  read_mol_scheduler_state_real:
  In:  fs - checkpoint file to read from.
@@ -1242,20 +2395,16 @@ static int read_mol_scheduler_state_real(struct volume *world, FILE *fs,
                                          uint32_t api_version) {
   static const char SECTNAME[] = "molecule scheduler state";
 
-  struct volume_molecule vm;
-  struct volume_molecule *vmp = NULL;
-  struct abstract_molecule *amp = NULL;
   struct volume_molecule *guess = NULL;
 
-  /* Clear template vol mol structure */
-  memset(&vm, 0, sizeof(struct volume_molecule));
-  vmp = &vm;
-  amp = (struct abstract_molecule *)vmp;
-
   /* read total number of items in the scheduler. */
   unsigned long long total_items;
   READUINT64(total_items);
 
+  unsigned int n_ids;
+  unsigned int *species_index = make_chkpt_species_index(world, &n_ids);
+
+  int status = 0;
   for (unsigned long long n_mol = 0; n_mol < total_items; n_mol++) {
     /* Normal molecule fields */
     unsigned int external_species_id;
@@ -1264,7 +2413,7 @@ static int read_mol_scheduler_state_real(struct volume *world, FILE *fs,
     double sched_time;
     double lifetime;
     double birthday;
-    double x_coord, y_coord, z_coord;
+    struct vector3 where;
     int orient;
 
     /* read molecule fields */
@@ -1274,113 +2423,232 @@ static int read_mol_scheduler_state_real(struct volume *world, FILE *fs,
     READFIELD(sched_time);
     READFIELD(lifetime);
     READFIELD(birthday);
-    READFIELD(x_coord);
-    READFIELD(y_coord);
-    READFIELD(z_coord);
+    READFIELD(where.x);
+    READFIELD(where.y);
+    READFIELD(where.z);
     READINT(orient);
 
-    // starting with API version 1, convert the sched_time, lifetime and
-    // birthday into scaled time based on the current timestep
-    if (api_version >= 1) {
-      // This will force lifetimes to be recomputed. This is necessary if
-      // unimolecular rate constants change between checkpoints.
-      lifetime = 0;
-      sched_time = world->start_iterations;
-      act_change_flag = HAS_ACT_CHANGE;
-    }
-
     unsigned int complex_no = 0;
     READUINT(complex_no);
 
     /* Find this species by its external species id */
-    struct species *properties = NULL;
-    for (int species_idx = 0; species_idx < world->n_species; species_idx++) {
-      if (world->species_list[species_idx]->chkpt_species_id ==
-          external_species_id) {
-        properties = world->species_list[species_idx];
-        break;
-      }
+    unsigned int index = (external_species_id < n_ids)
+                             ? species_index[external_species_id]
+                             : UINT_MAX;
+    if (index == UINT_MAX) {
+      mcell_warn("Corrupted checkpoint data: Found molecule with unknown "
+                 "species id (%d).",
+                 external_species_id);
+      status = 1;
+      break;
     }
-    DATACHECK(properties == NULL,
-              "Found molecule with unknown species id (%d).",
-              external_species_id);
-
-    /* Create and add molecule to scheduler */
-    struct periodic_image periodic_box = { .x = 0,
-                                           .y = 0,
-                                           .z = 0
-                                         };
-    if ((properties->flags & NOT_FREE) == 0) { /* 3D molecule */
-
-      /* set molecule characteristics */
-      amp->t = sched_time;
-      amp->t2 = lifetime;
-      amp->birthday = birthday;
-      amp->properties = properties;
-      initialize_diffusion_function(amp);
-      if(amp->properties->flags & EXTERNAL_SPECIES)
-        properties_nfsim(world, amp);
-      vmp->previous_wall = NULL;
-      vmp->index = -1;
-      vmp->pos.x = x_coord;
-      vmp->pos.y = y_coord;
-      vmp->pos.z = z_coord;
-      amp->periodic_box = &periodic_box;
-
-      /* Set molecule flags */
-      amp->flags = TYPE_VOL | IN_VOLUME;
-      if (act_newbie_flag == HAS_ACT_NEWBIE)
-        amp->flags |= ACT_NEWBIE;
-
-      if (act_change_flag == HAS_ACT_CHANGE)
-        amp->flags |= ACT_CHANGE;
-
-      amp->flags |= IN_SCHEDULE;
-      if ((amp->properties->flags & CAN_SURFWALL) != 0 ||
-          trigger_unimolecular(world->reaction_hash, world->rx_hashsize,
-                               amp->properties->hashval, amp) != NULL)
-        amp->flags |= ACT_REACT;
-      if (amp->get_space_step(amp) > 0.0)
-        amp->flags |= ACT_DIFFUSE;
-
-      /* Insert copy of vm into world */
-      guess = insert_volume_molecule(world, vmp, guess);
-      if (guess == NULL) {
-        mcell_error("Cannot insert copy of molecule of species '%s' into "
-                    "world.\nThis may be caused by a shortage of memory.",
-                    vmp->properties->sym->name);
-      }
 
-    } else { /* surface_molecule */
-      struct vector3 where;
+    restore_molecule(world, world->species_list[index], act_newbie_flag,
+                     act_change_flag, sched_time, lifetime, birthday, &where,
+                     orient, api_version, &guess);
+  }
 
-      where.x = x_coord;
-      where.y = y_coord;
-      where.z = z_coord;
+  free(species_index);
+  return status;
+}
 
+/***************************************************************************
+ decode_mol_chunk:
+ In:  state - contextual state for reading checkpoint file
+      compress - how the chunk payload is stored
+      stored - chunk payload as read from the file
+      stored_size - size of the payload
+      records - where to put the n_records decoded records
+      n_records - number of records in the chunk
+ Out: Decompresses and byteswaps one chunk.  Safe to call for several
+      chunks at once.  Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int decode_mol_chunk(struct chkpt_read_state *state, byte compress,
+                            unsigned char *stored, uint32_t stored_size,
+                            struct chkpt_mol_record *records,
+                            uint32_t n_records) {
+  size_t raw_size = (size_t)n_records * sizeof(struct chkpt_mol_record);
+  if (compress == CHKPT_CHUNK_RAW) {
+    if (stored_size != raw_size)
+      return 1;
+    memcpy(records, stored, raw_size);
+  } else {
+#ifdef MCELL_WITH_ZLIB
+    uLongf dest_size = raw_size;
+    if (uncompress((Bytef *)records, &dest_size, stored, stored_size) != Z_OK ||
+        dest_size != raw_size)
+      return 1;
+#else
+    return 1;
+#endif
+  }
 
-      struct surface_molecule *smp = insert_surface_molecule(
-          world, properties, &where, orient, CHKPT_GRID_TOLERANCE, sched_time,
-          NULL, NULL, NULL, &periodic_box);
+  if (state->byte_order_mismatch) {
+    for (uint32_t i = 0; i < n_records; i++) {
+      struct chkpt_mol_record *rec = &records[i];
+      byte_swap(&rec->id, sizeof(rec->id));
+      byte_swap(&rec->t, sizeof(rec->t));
+      byte_swap(&rec->t2, sizeof(rec->t2));
+      byte_swap(&rec->birthday, sizeof(rec->birthday));
+      byte_swap(&rec->where.x, sizeof(rec->where.x));
+      byte_swap(&rec->where.y, sizeof(rec->where.y));
+      byte_swap(&rec->where.z, sizeof(rec->where.z));
+      byte_swap(&rec->species_id, sizeof(rec->species_id));
+      byte_swap(&rec->orient, sizeof(rec->orient));
+    }
+  }
+  return 0;
+}
 
-      if (smp == NULL) {
-        mcell_warn("Could not place molecule %s at (%f,%f,%f).",
-                   properties->sym->name, where.x * world->length_unit,
-                   where.y * world->length_unit,
-                   where.z * world->length_unit);
-        continue;
-      }
+/***************************************************************************
+ read_mol_chunks:
+ In:  fs - checkpoint file to read from.
+      state - contextual state; the molecules go to state->replay
+ Out: Reads the chunked molecule section.  The chunks are read in one pass
+      and decoded in parallel.  The molecules are inserted once all files of
+      a chain have been read.
+      Returns 1 on error, and 0 - on success.
+***************************************************************************/
+static int read_mol_chunks(struct volume *world, FILE *fs,
+                           struct chkpt_read_state *state) {
+  static const char SECTNAME[] = "molecule chunks";
 
-      smp->t2 = lifetime;
-      smp->birthday = birthday;
-      if (act_newbie_flag == HAS_NOT_ACT_NEWBIE)
-        smp->flags &= ~ACT_NEWBIE;
+  unsigned long long total_items;
+  unsigned int n_chunks;
+  byte compress;
+  READUINT64(total_items);
+  READUINT(n_chunks);
+  READFIELDRAW(compress);
+  DATACHECK(compress != CHKPT_CHUNK_RAW && compress != CHKPT_CHUNK_ZLIB,
+            "Unknown molecule chunk encoding (%d).", (int)compress);
+#ifndef MCELL_WITH_ZLIB
+  DATACHECK(compress == CHKPT_CHUNK_ZLIB,
+            "Checkpoint file is compressed, but MCell was built without "
+            "zlib.");
+#endif
+  DATACHECK(total_items >
+                (unsigned long long)n_chunks * CHKPT_CHUNK_RECORDS,
+            "Molecule chunks hold fewer molecules than announced.");
+
+  struct chkpt_mol_record *records = CHECKED_MALLOC_ARRAY(
+      struct chkpt_mol_record, (total_items > 0) ? total_items : 1,
+      "checkpoint molecule records");
+  unsigned char **stored = CHECKED_MALLOC_ARRAY(
+      unsigned char *, (n_chunks > 0) ? n_chunks : 1, "checkpoint chunks");
+  uint32_t *stored_sizes = CHECKED_MALLOC_ARRAY(
+      uint32_t, (n_chunks > 0) ? n_chunks : 1, "checkpoint chunks");
+  uint32_t *chunk_records = CHECKED_MALLOC_ARRAY(
+      uint32_t, (n_chunks > 0) ? n_chunks : 1, "checkpoint chunks");
+  unsigned long long *chunk_first = CHECKED_MALLOC_ARRAY(
+      unsigned long long, (n_chunks > 0) ? n_chunks : 1, "checkpoint chunks");
+  memset(stored, 0, ((n_chunks > 0) ? n_chunks : 1) * sizeof(unsigned char *));
+
+  /* Read all chunks; the file is read sequentially */
+  int status = 0;
+  unsigned long long n_read = 0;
+  for (unsigned int c = 0; c < n_chunks && status == 0; c++) {
+    uint32_t n, raw_size, stored_size;
+    if (fread(&n, sizeof(n), 1, fs) != 1 ||
+        fread(&raw_size, sizeof(raw_size), 1, fs) != 1 ||
+        fread(&stored_size, sizeof(stored_size), 1, fs) != 1) {
+      mcell_perror_nodie(errno, "Error while reading '%s' from checkpoint "
+                         "file", SECTNAME);
+      status = 1;
+      break;
+    }
+    READBSWAP(n);
+    READBSWAP(raw_size);
+    READBSWAP(stored_size);
+    if (n > CHKPT_CHUNK_RECORDS || n > total_items - n_read ||
+        raw_size != n * sizeof(struct chkpt_mol_record) ||
+        stored_size > 2 * raw_size + 1024) {
+      mcell_warn("Corrupted checkpoint data: Invalid molecule chunk header.");
+      status = 1;
+      break;
+    }
+
+    stored[c] = CHECKED_MALLOC_ARRAY(unsigned char,
+                                     (stored_size > 0) ? stored_size : 1,
+                                     "checkpoint chunk");
+    if (fread(stored[c], 1, stored_size, fs) != stored_size) {
+      mcell_perror_nodie(errno, "Error while reading '%s' from checkpoint "
+                         "file", SECTNAME);
+      status = 1;
+      break;
+    }
+    stored_sizes[c] = stored_size;
+    chunk_records[c] = n;
+    chunk_first[c] = n_read;
+    n_read += n;
+  }
+  if (status == 0 && n_read != total_items) {
+    mcell_warn("Corrupted checkpoint data: Molecule chunks hold %llu "
+               "molecules instead of %llu.", n_read, total_items);
+    status = 1;
+  }
 
-      if (act_change_flag == HAS_ACT_CHANGE) {
-        smp->flags |= ACT_CHANGE;
+  /* Decompress and byteswap the chunks in parallel */
+  if (status == 0) {
+    int n_failed = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+ : n_failed)
+    for (unsigned int c = 0; c < n_chunks; c++) {
+      n_failed += decode_mol_chunk(state, compress, stored[c],
+                                   stored_sizes[c], records + chunk_first[c],
+                                   chunk_records[c]);
+    }
+    if (n_failed != 0) {
+      mcell_warn("Corrupted checkpoint data: %d molecule chunks could not "
+                 "be decoded.", n_failed);
+      status = 1;
+    }
+  }
+
+  for (unsigned int c = 0; c < n_chunks; c++)
+    free(stored[c]);
+  free(stored);
+  free(stored_sizes);
+  free(chunk_records);
+  free(chunk_first);
+
+  /* Map the species to this simulation; files of a chain may number them
+   * differently */
+  if (status == 0) {
+    unsigned int n_ids;
+    unsigned int *species_index = make_chkpt_species_index(world, &n_ids);
+    for (unsigned long long i = 0; i < total_items; i++) {
+      struct chkpt_mol_record *rec = &records[i];
+      if (rec->species_id >= n_ids || species_index[rec->species_id] ==
+                                          UINT_MAX) {
+        mcell_warn("Corrupted checkpoint data: Found molecule with unknown "
+                   "species id (%u).",
+                   rec->species_id);
+        status = 1;
+        break;
+      }
+      rec->species_id = species_index[rec->species_id];
+      if (i > 0 && state->replay->seen && records[i - 1].id >= rec->id) {
+        mcell_warn("Corrupted checkpoint data: Molecules of an incremental "
+                   "checkpoint are not sorted.");
+        status = 1;
+        break;
       }
     }
+    free(species_index);
+  }
+
+  if (status != 0) {
+    free(records);
+    return status;
   }
 
+  /* The first file gives all molecules, later ones are applied on top */
+  struct chkpt_replay *replay = state->replay;
+  if (!replay->seen) {
+    replay->seen = 1;
+    replay->records = records;
+    replay->n_records = total_items;
+  } else {
+    merge_mol_records(replay, records, total_items);
+  }
   return 0;
 }
@@ -30,8 +30,9 @@
 /* header file for chkpt.c, MCell checkpointing functions */
 
 int create_chkpt(struct volume *world, char const *filename);
+int finish_chkpt_writer(struct volume *world);
 int write_chkpt(struct volume *world, FILE *fs);
-int read_chkpt(struct volume *world, FILE *fs);
+int read_chkpt(struct volume *world, FILE *fs, char const *filename);
 void chkpt_signal_handler(int signo);
 
 int set_checkpoint_state(struct volume *world);
@@ -42,11 +42,12 @@
 // debug
 #include "debug_config.h"
 #include "dump_state.h"
+#include "event_trace.h"
+#include "phase_profile.h"
+#include "work_counters.h"
 
 #define FREE_COLLISION_LISTS()                                                 \
   do {                                                                         \
-    if (shead2 != NULL)                                                        \
-      mem_put_list(sv->local_storage->coll, shead2);                           \
     if (shead != NULL)                                                         \
       mem_put_list(sv->local_storage->coll, shead);                            \
   } while (0)
@@ -55,6 +56,12 @@
 static const int inert_to_mol = 1;
 static const int inert_to_all = 2;
 
+/* Number of species array entries tested at once during neighbor scans */
+#define SPECIES_SCAN_BLOCK 64
+
+/* Collision buffers up to this length are insertion sorted */
+#define COLLISION_INSERTION_SORT_MAX 32
+
 /* declaration of static functions */
 int move_sm_on_same_triangle(
     struct volume *state,
@@ -730,8 +737,10 @@ struct wall *ray_trace_2D(
                                      .y = sm->periodic_box->y,
                                      .z = sm->periodic_box->z
                                    };
+  /* Only needed to find periodic box crossings */
   struct vector3 origin_xyz;
-  uv2xyz(&this_pos, this_wall, &origin_xyz);
+  if (world->periodic_box_obj)
+    uv2xyz(&this_pos, this_wall, &origin_xyz);
 
   struct rxn *rx = NULL;
   /* Will break out with return or break when we're done traversing walls */
@@ -857,7 +866,7 @@ struct wall *ray_trace_2D(
     struct vector2 new_disp;
     if (!reflect_now) {
       struct wall *target_wall =
-          traverse_surface(this_wall, &old_pos, index_edge_was_hit, &this_pos);
+          cross_edge(this_wall, &old_pos, index_edge_was_hit, &this_pos);
 
       if (target_wall != NULL) {
         if (sm->properties->flags & CAN_REGION_BORDER) {
@@ -883,7 +892,9 @@ struct wall *ray_trace_2D(
         if (!reflect_now) {
           this_disp.u = old_pos.u + this_disp.u;
           this_disp.v = old_pos.v + this_disp.v;
-          traverse_surface(this_wall, &this_disp, index_edge_was_hit, &new_disp);
+          /* the edge was just crossed, so this always maps */
+          map_across_edge(&this_wall->xform.edge[index_edge_was_hit],
+                          &this_disp, &new_disp);
           this_disp.u = new_disp.u - this_pos.u;
           this_disp.v = new_disp.v - this_pos.v;
           this_wall = target_wall;
@@ -907,31 +918,18 @@ struct wall *ray_trace_2D(
     new_disp.v = this_disp.v - (boundary_pos.v - old_pos.v);
 
     double f;
-    struct vector2 reflector;
+    struct vector2 const *reflector;
 
     switch (index_edge_was_hit) {
     case 0:
       new_disp.v *= -1.0;
       break;
     case 1:
-      reflector.u = -this_wall->uv_vert2.v;
-      reflector.v = this_wall->uv_vert2.u - this_wall->uv_vert1_u;
-      f = 1.0 / sqrt(reflector.u * reflector.u + reflector.v * reflector.v);
-      reflector.u *= f;
-      reflector.v *= f;
-      f = 2.0 * (new_disp.u * reflector.u + new_disp.v * reflector.v);
-      new_disp.u -= f * reflector.u;
-      new_disp.v -= f * reflector.v;
-      break;
     case 2:
-      reflector.u = this_wall->uv_vert2.v;
-      reflector.v = -this_wall->uv_vert2.u;
-      f = 1.0 / sqrt(reflector.u * reflector.u + reflector.v * reflector.v);
-      reflector.u *= f;
-      reflector.v *= f;
-      f = 2.0 * (new_disp.u * reflector.u + new_disp.v * reflector.v);
-      new_disp.u -= f * reflector.u;
-      new_disp.v -= f * reflector.v;
+      reflector = &this_wall->xform.reflector[index_edge_was_hit];
+      f = 2.0 * (new_disp.u * reflector->u + new_disp.v * reflector->v);
+      new_disp.u -= f * reflector->u;
+      new_disp.v -= f * reflector->v;
       break;
 
     default:
@@ -954,60 +952,22 @@ struct wall *ray_trace_2D(
 }
 
 /*************************************************************************
-ray_trace:
+subvolume_exit:
   In: world: simulation state
       init_pos: position of molecule that is moving
-      c: linked list of potential collisions with molecules (we could react)
       sv: subvolume that we start in
       v: displacement vector from current to new location
-      reflectee: wall we have reflected off of and should not hit again
-  Out: collision list of walls and molecules we intersected along our ray
-       (current subvolume only), plus the subvolume wall.  Will always
-       return at least the subvolume wall--NULL indicates an out of
-       memory error.
+      smash: collision to fill in
+  Out: No return value.  smash describes where the ray leaves the
+       subvolume.
 *************************************************************************/
-struct collision *ray_trace(struct volume *world, struct vector3 *init_pos,
-                            struct collision *c, struct subvolume *sv,
-                            struct vector3 *v, struct wall *reflectee) {
-
+static void subvolume_exit(struct volume *world, struct vector3 *init_pos,
+                           struct subvolume *sv, struct vector3 *v,
+                           struct collision *smash) {
   /* time, in units of of the molecule's time step, at which molecule
      will cross the x,y,z partitions, respectively. */
   double tx, ty, tz;
 
-  world->ray_voxel_tests++;
-
-  struct collision *shead = NULL;
-  struct collision *smash = (struct collision *)CHECKED_MEM_GET(
-      sv->local_storage->coll, "collision structure");
-
-  struct wall_list fake_wlp;
-  fake_wlp.next = sv->wall_head;
-
-  // Check wall collisions
-  for (struct wall_list *wlp = sv->wall_head; wlp != NULL; wlp = wlp->next) {
-    if (wlp->this_wall == reflectee)
-      continue;
-
-    int i = collide_wall(init_pos, v, wlp->this_wall, &(smash->t), &(smash->loc),
-                     1, world->rng, world->notify, &(world->ray_polygon_tests));
-    if (i == COLLIDE_REDO) {
-      if (shead != NULL)
-        mem_put_list(sv->local_storage->coll, shead);
-      shead = NULL;
-      wlp = &fake_wlp;
-      continue;
-    } else if (i != COLLIDE_MISS) {
-      world->ray_polygon_colls++;
-
-      smash->what = COLLIDE_WALL + i;
-      smash->target = (void *)wlp->this_wall;
-      smash->next = shead;
-      shead = smash;
-      smash = (struct collision *)CHECKED_MEM_GET(sv->local_storage->coll,
-                                                  "collision structure");
-    }
-  }
-
   double dx, dy, dz;
   dx = dy = dz = 0.0;
   int i = -10;
@@ -1076,10 +1036,10 @@ struct collision *ray_trace(struct volume *world, struct vector3 *init_pos,
         if (tx < tz) {
           smash->t = dx / v->x;
           smash->what = COLLIDE_SUBVOL + COLLIDE_SV_NX + i;
-        } else 
-{          smash->t = dz / v->z;
-          smash->what = COLLIDE_SUBVOL + COLLIDE_SV_NZ + k
-;        }
+        } else {
+          smash->t = dz / v->z;
+          smash->what = COLLIDE_SUBVOL + COLLIDE_SV_NZ + k;
+        }
       } else /* k<0 */
       {
         tx = fabs(dx * v->y);
@@ -1121,8 +1081,61 @@ struct collision *ray_trace(struct volume *world, struct vector3 *init_pos,
   smash->loc.x = init_pos->x + smash->t * v->x;
   smash->loc.y = init_pos->y + smash->t * v->y;
   smash->loc.z = init_pos->z + smash->t * v->z;
-
   smash->target = sv;
+}
+
+/*************************************************************************
+ray_trace:
+  In: world: simulation state
+      init_pos: position of molecule that is moving
+      c: linked list of potential collisions with molecules (we could react)
+      sv: subvolume that we start in
+      v: displacement vector from current to new location
+      reflectee: wall we have reflected off of and should not hit again
+  Out: collision list of walls and molecules we intersected along our ray
+       (current subvolume only), plus the subvolume wall.  Will always
+       return at least the subvolume wall--NULL indicates an out of
+       memory error.
+*************************************************************************/
+struct collision *ray_trace(struct volume *world, struct vector3 *init_pos,
+                            struct collision *c, struct subvolume *sv,
+                            struct vector3 *v, struct wall *reflectee) {
+
+  world->ray_voxel_tests++;
+
+  struct collision *shead = NULL;
+  struct collision *smash = (struct collision *)CHECKED_MEM_GET(
+      sv->local_storage->coll, "collision structure");
+
+  struct wall_list fake_wlp;
+  fake_wlp.next = sv->wall_head;
+
+  // Check wall collisions
+  for (struct wall_list *wlp = sv->wall_head; wlp != NULL; wlp = wlp->next) {
+    if (wlp->this_wall == reflectee)
+      continue;
+
+    int i = collide_wall(init_pos, v, wlp->this_wall, &(smash->t), &(smash->loc),
+                     1, world->rng, world->notify, &(world->ray_polygon_tests));
+    if (i == COLLIDE_REDO) {
+      if (shead != NULL)
+        mem_put_list(sv->local_storage->coll, shead);
+      shead = NULL;
+      wlp = &fake_wlp;
+      continue;
+    } else if (i != COLLIDE_MISS) {
+      world->ray_polygon_colls++;
+
+      smash->what = COLLIDE_WALL + i;
+      smash->target = (void *)wlp->this_wall;
+      smash->next = shead;
+      shead = smash;
+      smash = (struct collision *)CHECKED_MEM_GET(sv->local_storage->coll,
+                                                  "collision structure");
+    }
+  }
+
+  subvolume_exit(world, init_pos, sv, v, smash);
   smash->next = shead;
   shead = smash;
 
@@ -1132,7 +1145,7 @@ struct collision *ray_trace(struct volume *world, struct vector3 *init_pos,
     if (a->properties == NULL)
       continue;
 
-    i = collide_mol(init_pos, v, a, &(c->t), &(c->loc), world->rx_radius_3d);
+    int i = collide_mol(init_pos, v, a, &(c->t), &(c->loc), world->rx_radius_3d);
     if (i != COLLIDE_MISS) {
       smash = (struct collision *)CHECKED_MEM_GET(sv->local_storage->coll,
                                                   "collision structure");
@@ -1148,6 +1161,152 @@ struct collision *ray_trace(struct volume *world, struct vector3 *init_pos,
   return shead;
 }
 
+/*************************************************************************
+collision_buffer_slot:
+  In: buf: collision buffer
+  Out: Pointer to the next free collision of the buffer (not yet counted
+       in n_items).  The buffer grows as needed, which moves its items.
+*************************************************************************/
+struct collision *collision_buffer_slot(struct collision_buffer *buf) {
+  if (buf->n_items == buf->max_items) {
+    int max_items = (buf->max_items == 0) ? 64 : 2 * buf->max_items;
+    struct collision *items = (struct collision *)realloc(
+        buf->items, max_items * sizeof(struct collision));
+    if (items == NULL)
+      mcell_allocfailed("Failed to grow collision buffer.");
+    buf->items = items;
+    struct collision **order = (struct collision **)realloc(
+        buf->order, 2 * max_items * sizeof(struct collision *));
+    if (order == NULL)
+      mcell_allocfailed("Failed to grow collision buffer.");
+    buf->order = order;
+    buf->max_items = max_items;
+  }
+  return &buf->items[buf->n_items];
+}
+
+/*************************************************************************
+sort_collision_buffer:
+  In: buf: collision buffer holding at least one collision
+  Out: Head of the collisions linked in order of time.  Among equal times,
+       collisions found later come first, which is the order ae_list_sort
+       gives the lists built by ray_trace.  Short buffers are insertion
+       sorted, long ones merge sorted.
+*************************************************************************/
+struct collision *sort_collision_buffer(struct collision_buffer *buf) {
+  int n = buf->n_items;
+  struct collision **order = buf->order;
+  for (int k = 0; k < n; k++)
+    order[k] = &buf->items[n - 1 - k];
+
+  if (n <= COLLISION_INSERTION_SORT_MAX) {
+    for (int k = 1; k < n; k++) {
+      struct collision *c = order[k];
+      int m = k;
+      while (m > 0 && order[m - 1]->t > c->t) {
+        order[m] = order[m - 1];
+        m--;
+      }
+      order[m] = c;
+    }
+  } else {
+    struct collision **src = order, **dst = order + buf->max_items;
+    for (int width = 1; width < n; width *= 2) {
+      for (int lo = 0; lo < n; lo += 2 * width) {
+        int mid = (lo + width < n) ? lo + width : n;
+        int hi = (lo + 2 * width < n) ? lo + 2 * width : n;
+        int l = lo, r = mid, o = lo;
+        while (l < mid && r < hi)
+          dst[o++] = (src[l]->t <= src[r]->t) ? src[l++] : src[r++];
+        while (l < mid)
+          dst[o++] = src[l++];
+        while (r < hi)
+          dst[o++] = src[r++];
+      }
+      struct collision **tmp = src;
+      src = dst;
+      dst = tmp;
+    }
+    if (src != order)
+      memcpy(order, src, n * sizeof(struct collision *));
+  }
+
+  for (int k = 0; k + 1 < n; k++)
+    order[k]->next = order[k + 1];
+  order[n - 1]->next = NULL;
+  return order[0];
+}
+
+/*************************************************************************
+ray_trace_buffered:
+  In: world: simulation state
+      init_pos: position of molecule that is moving
+      c: linked list of potential collisions with molecules (we could react)
+      sv: subvolume that we start in
+      v: displacement vector from current to new location
+      reflectee: wall we have reflected off of and should not hit again
+      buf: collision buffer to reuse
+  Out: The collisions ray_trace would find, already sorted by time.  They
+       live in buf, stay valid until buf is used again and are not freed
+       individually.
+*************************************************************************/
+static struct collision *
+ray_trace_buffered(struct volume *world, struct vector3 *init_pos,
+                   struct collision *c, struct subvolume *sv,
+                   struct vector3 *v, struct wall *reflectee,
+                   struct collision_buffer *buf) {
+  world->ray_voxel_tests++;
+  WORK_PENDING(sv, WORK_RAY_VOXEL);
+  buf->n_items = 0;
+
+  struct wall_list fake_wlp;
+  fake_wlp.next = sv->wall_head;
+
+  // Check wall collisions
+  for (struct wall_list *wlp = sv->wall_head; wlp != NULL; wlp = wlp->next) {
+    if (wlp->this_wall == reflectee)
+      continue;
+
+    struct collision *smash = collision_buffer_slot(buf);
+    WORK_PENDING(sv, WORK_WALL_TESTS);
+    int i = collide_wall(init_pos, v, wlp->this_wall, &(smash->t), &(smash->loc),
+                     1, world->rng, world->notify, &(world->ray_polygon_tests));
+    if (i == COLLIDE_REDO) {
+      buf->n_items = 0;
+      wlp = &fake_wlp;
+      continue;
+    } else if (i != COLLIDE_MISS) {
+      world->ray_polygon_colls++;
+
+      smash->what = COLLIDE_WALL + i;
+      smash->target = (void *)wlp->this_wall;
+      buf->n_items++;
+    }
+  }
+
+  subvolume_exit(world, init_pos, sv, v, collision_buffer_slot(buf));
+  buf->n_items++;
+
+  // Check molecule collisions
+  for (; c != NULL; c = c->next) {
+    struct abstract_molecule *a = (struct abstract_molecule *)c->target;
+    if (a->properties == NULL)
+      continue;
+
+    WORK_PENDING(sv, WORK_MOL_PAIR_TESTS);
+    int i = collide_mol(init_pos, v, a, &(c->t), &(c->loc), world->rx_radius_3d);
+    if (i != COLLIDE_MISS) {
+      struct collision *smash = collision_buffer_slot(buf);
+      memcpy(smash, c, sizeof(struct collision));
+      smash->what = COLLIDE_VOL + i;
+      buf->n_items++;
+    }
+  }
+
+  return sort_collision_buffer(buf);
+}
+
+
 /******************************/
 /** exact_disk stuff follows **/
 /******************************/
@@ -2327,6 +2486,60 @@ double safe_diffusion_step(struct volume_molecule *vm, struct collision *shead,
   return steps;
 }
 
+/****************************************************************************
+add_vol_mol_collisions:
+  This is a helper function for expand_collision_list_for_neighbor.  It adds
+  one collision for each reaction between the moving molecule and a candidate
+  partner which has already passed the bounding box test.
+
+  In: sv: the "current" subvolume
+      vm: the current molecule
+      mp: the candidate partner
+      shead1: current list head
+      rx_hashsize:
+      reaction_hash:
+  Out: Returns the collision list with the new collisions prepended.
+****************************************************************************/
+static struct collision *add_vol_mol_collisions(struct volume *world,
+    struct subvolume *sv, struct volume_molecule *vm, struct volume_molecule *mp,
+    struct collision *shead1, int rx_hashsize, struct rxn **reaction_hash) {
+  int num_matching_rxns = 0;
+  struct rxn *matching_rxns[MAX_MATCHING_RXNS];
+
+  /* Skip defunct molecules */
+  if (mp->properties == NULL)
+    return shead1;
+
+  // count only in the relevant periodic box
+  if (!periodic_boxes_are_identical(vm->periodic_box, mp->periodic_box))
+    return shead1;
+
+  if (vm->properties->flags & EXTERNAL_SPECIES) {
+    num_matching_rxns = trigger_bimolecular_nfsim(world,
+        (struct abstract_molecule *)vm, (struct abstract_molecule *)mp, 0, 0,
+        matching_rxns);
+  } else {
+    num_matching_rxns = trigger_bimolecular(
+        reaction_hash, rx_hashsize, vm->properties->hashval,
+        mp->properties->hashval, (struct abstract_molecule *)vm,
+        (struct abstract_molecule *)mp, 0, 0, matching_rxns);
+  }
+
+  /* Add a collision for each matching reaction */
+  for (int i = 0; i < num_matching_rxns; i++) {
+    struct collision *smash = (struct collision *)CHECKED_MEM_GET(
+        sv->local_storage->coll, "collision data");
+    smash->target = (void *)mp;
+    smash->intermediate = matching_rxns[i];
+    smash->next = shead1;
+    smash->what = 0;
+    smash->what |= COLLIDE_VOL;
+    shead1 = smash;
+  }
+
+  return shead1;
+}
+
 /****************************************************************************
 expand_collision_list_for_neighbor:
   This is a helper function to reduce duplicated code in expand_collision_list.
@@ -2366,9 +2579,6 @@ static struct collision *expand_collision_list_for_neighbor(struct volume *world
     struct collision *shead1, double trim_x, double trim_y, double trim_z,
     double *x_fineparts, double *y_fineparts, double *z_fineparts,
     int rx_hashsize, struct rxn **reaction_hash) {
-  int num_matching_rxns = 0;
-  struct rxn *matching_rxns[MAX_MATCHING_RXNS];
-
   /* Grab the subvolume boundaries */
   struct vector3 new_sv_llf, new_sv_urb;
   new_sv_llf.x = x_fineparts[new_sv->llf.x];
@@ -2430,6 +2640,7 @@ static struct collision *expand_collision_list_for_neighbor(struct volume *world
     if (psl->head == NULL) {
       *psl_head = psl->next;
       ht_remove(&new_sv->mol_by_species, psl);
+      free_species_arrays(psl);
       mem_put(new_sv->local_storage->pslv, psl);
       continue;
     } else
@@ -2448,6 +2659,31 @@ static struct collision *expand_collision_list_for_neighbor(struct volume *world
              psl->properties->hashval, vm->properties, psl->properties))
       continue;
     }
+    if (psl->mols != NULL) {
+      /* Species arrays: test a block of positions against the region of
+         interest first (this loop vectorizes), then look at the hits only */
+      unsigned char in_box[SPECIES_SCAN_BLOCK];
+      for (int base = 0; base < psl->n_mols; base += SPECIES_SCAN_BLOCK) {
+        int n = psl->n_mols - base;
+        if (n > SPECIES_SCAN_BLOCK)
+          n = SPECIES_SCAN_BLOCK;
+        const double *px = psl->pos_x + base;
+        const double *py = psl->pos_y + base;
+        const double *pz = psl->pos_z + base;
+        for (int k = 0; k < n; k++) {
+          in_box[k] = (px[k] >= x_min) & (px[k] <= x_max) &
+                      (py[k] >= y_min) & (py[k] <= y_max) &
+                      (pz[k] >= z_min) & (pz[k] <= z_max);
+        }
+        for (int k = 0; k < n; k++) {
+          if (in_box[k])
+            shead1 = add_vol_mol_collisions(world, sv, vm, psl->mols[base + k],
+                                            shead1, rx_hashsize, reaction_hash);
+        }
+      }
+      continue;
+    }
+
     for (struct volume_molecule *mp = psl->head; mp != NULL; mp = mp->next_v) {
       /* Skip defunct molecules */
       if (mp->properties == NULL)
@@ -2460,43 +2696,9 @@ static struct collision *expand_collision_list_for_neighbor(struct volume *world
         continue;
       if (mp->pos.z < z_min || mp->pos.z > z_max)
         continue;
-      // count only in the relevant periodic box
-      if (!periodic_boxes_are_identical(vm->periodic_box, mp->periodic_box)) {
-        continue;
-      }
-
-      /* check for possible reactions */
-      /*num_matching_rxns = trigger_bimolecular(
-          reaction_hash, rx_hashsize, vm->properties->hashval,
-          mp->properties->hashval, (struct abstract_molecule *)vm,
-          (struct abstract_molecule *)mp, 0, 0, matching_rxns);*/
-
-        if(vm->properties->flags & EXTERNAL_SPECIES){
-          num_matching_rxns = trigger_bimolecular_nfsim(world, (struct abstract_molecule *)vm,
-            (struct abstract_molecule *)mp, 0, 0, matching_rxns);
-        } 
-        else{     
-          num_matching_rxns = trigger_bimolecular(
-              reaction_hash, rx_hashsize, vm->properties->hashval,
-              mp->properties->hashval, (struct abstract_molecule *)vm,
-              (struct abstract_molecule *)mp, 0, 0, matching_rxns);
-        }
-
-
-      if (num_matching_rxns <= 0)
-        continue;
 
-      /* Add a collision for each matching reaction */
-      for (int i = 0; i < num_matching_rxns; i++) {
-        struct collision *smash = (struct collision *)CHECKED_MEM_GET(
-            sv->local_storage->coll, "collision data");
-        smash->target = (void *)mp;
-        smash->intermediate = matching_rxns[i];
-        smash->next = shead1;
-        smash->what = 0;
-        smash->what |= COLLIDE_VOL;
-        shead1 = smash;
-      }
+      shead1 = add_vol_mol_collisions(world, sv, vm, mp, shead1, rx_hashsize,
+                                      reaction_hash);
     }
   }
 
@@ -2836,6 +3038,7 @@ struct sp_collision *expand_collision_partner_list_for_neighbor(
     if (psl->head == NULL) {
       *psl_head = psl->next;
       ht_remove(&new_sv->mol_by_species, psl);
+      free_species_arrays(psl);
       mem_put(new_sv->local_storage->pslv, psl);
       continue;
     } else
@@ -2912,6 +3115,32 @@ struct sp_collision *expand_collision_partner_list_for_neighbor(
   return shead1;
 }
 
+/*************************************************************************
+trace_collisions:
+  In: world: simulation state
+      vm: molecule that is moving
+      shead: collisions along its ray, sorted by time
+  Out: The collisions with molecules and walls are added to the event trace,
+       the same ones dump_collisions prints.
+*************************************************************************/
+static void trace_collisions(struct volume *world, struct volume_molecule *vm,
+                             struct collision *shead) {
+  for (struct collision *c = shead; c != NULL; c = c->next) {
+    if (c->what & COLLIDE_VOL) {
+      trace_event(TRACE_COLLISION, TRACE_COLL_MOL, world->current_iterations,
+                  vm->id, ((struct volume_molecule *)c->target)->id,
+                  vm->properties->species_id, c->t, c->loc.x, c->loc.y,
+                  c->loc.z);
+    } else if ((c->what & COLLIDE_SUBVOL) == 0 &&
+               (c->what == COLLIDE_REDO || (c->what & COLLIDE_FRONT) != 0 ||
+                (c->what & COLLIDE_BACK) != 0)) {
+      trace_event(TRACE_COLLISION, TRACE_COLL_WALL, world->current_iterations,
+                  vm->id, 0, vm->properties->species_id, c->t, c->loc.x,
+                  c->loc.y, c->loc.z);
+    }
+  }
+}
+
 /*************************************************************************
 diffuse_3D:
   In: world: simulation state
@@ -2949,6 +3178,8 @@ struct volume_molecule *diffuse_3D(
   		dump_volume_molecule(vm, "", true, "Diffusing vm:", world->current_iterations, vm->t);
   );
 #endif
+  TRACE(trace_event(TRACE_DIFFUSE, 0, world->current_iterations, vm->id, 0,
+                    spec->species_id, vm->t, vm->pos.x, vm->pos.y, vm->pos.z));
 
   int inertness = 0;
   set_inertness_and_maxtime(world, vm, &max_time, &inertness);
@@ -2969,6 +3200,7 @@ struct volume_molecule *diffuse_3D(
   struct vector3 displacement2; /* Used for 3D mol-mol unbinding */
 
   bool displacement_printed = false; // mcell4
+  bool displacement_traced = false;
 
 pretend_to_call_diffuse_3D: ; /* Label to allow fake recursion */
 
@@ -2997,6 +3229,12 @@ pretend_to_call_diffuse_3D: ; /* Label to allow fake recursion */
 		}
   );
 #endif
+  if (mcell_trace != NULL && !displacement_traced) {
+    trace_event(TRACE_DISPLACEMENT, 0, world->current_iterations, vm->id, 0,
+                spec->species_id, vm->t, displacement.x, displacement.y,
+                displacement.z);
+    displacement_traced = true;
+  }
 
   if (world->use_expanded_list &&
       ((vm->properties->flags & (CAN_VOLVOL | CANT_INITIATE)) == CAN_VOLVOL) &&
@@ -3023,22 +3261,17 @@ pretend_to_call_diffuse_3D: ; /* Label to allow fake recursion */
     if (world->use_expanded_list && redo_expand_collision_list_flag) {
       redo_collision_list(world, &shead, &stail, &shead_exp, vm, &displacement, sv);
     }
-    struct collision* shead2 = ray_trace(world, &(vm->pos), shead, sv, &displacement, reflectee);
-
-    if (shead2 == NULL) {
-      mcell_internal_error("ray_trace returned NULL.");
-    }
-
-    if (shead2->next != NULL) {
-      shead2 =
-          (struct collision *)ae_list_sort((struct abstract_element *)shead2);
-    }
+    /* Hits along the ray live in a reusable buffer, already sorted by time */
+    struct collision* shead2 = ray_trace_buffered(world, &(vm->pos), shead, sv,
+      &displacement, reflectee, &sv->local_storage->ray_hits);
+    WORK_COMMIT(world, sv, spec);
 
 #ifdef DEBUG_COLLISIONS
     DUMP_CONDITION3(
     		dump_collisions(shead2);
     );
 #endif
+    TRACE(trace_collisions(world, vm, shead2));
 
     struct vector3* loc_certain = NULL;
     struct collision *tentative = shead2;
@@ -3076,8 +3309,11 @@ pretend_to_call_diffuse_3D: ; /* Label to allow fake recursion */
 
         //assert(abs(r_rate_factor - 1.0) < EPS_C && "mcell4 temporary check");
         //assert(abs(t_steps - 1.0) < EPS_C && "mcell4 temporary check");
-        if (collide_and_react_with_vol_mol(world, smash, vm, &tentative,
-          &displacement, loc_certain, t_steps, r_rate_factor) == 1) {
+        PROFILE_BEGIN(PROF_COLLISIONS, t_vol_collision);
+        int reacted = collide_and_react_with_vol_mol(world, smash, vm,
+          &tentative, &displacement, loc_certain, t_steps, r_rate_factor);
+        PROFILE_END(PROF_COLLISIONS, t_vol_collision);
+        if (reacted == 1) {
           FREE_COLLISION_LISTS();
           return NULL;
         } else {
@@ -3088,9 +3324,11 @@ pretend_to_call_diffuse_3D: ; /* Label to allow fake recursion */
         struct wall* w = (struct wall *)smash->target;
         if (w->grid != NULL && (mol_grid_flag || mol_grid_grid_flag) &&
           inertness < inert_to_all) {
+          PROFILE_BEGIN(PROF_COLLISIONS, t_surf_collision);
           int destroyed = collide_and_react_with_surf_mol(world, smash, vm,
             &tentative, &loc_certain, t_steps, mol_grid_flag, mol_grid_grid_flag,
             r_rate_factor);
+          PROFILE_END(PROF_COLLISIONS, t_surf_collision);
           // if destroyed = -1 we didn't react with any molecules and keep going
           // to check for wall collisions
           if (destroyed == 1) {
@@ -3102,8 +3340,10 @@ pretend_to_call_diffuse_3D: ; /* Label to allow fake recursion */
         }
 
         if ((spec->flags & CAN_VOLWALL) != 0) {
+          PROFILE_BEGIN(PROF_COLLISIONS, t_wall_collision);
           int destroyed = collide_and_react_with_walls(world, smash, vm,
             &tentative, &loc_certain, t_steps, inertness, r_rate_factor);
+          PROFILE_END(PROF_COLLISIONS, t_wall_collision);
           // if destroyed = -1 we didn't react with any walls and keep going to
           // either reflect or encounter periodic bc
           if (destroyed == 1) {
@@ -3142,16 +3382,13 @@ pretend_to_call_diffuse_3D: ; /* Label to allow fake recursion */
         goto pretend_to_call_diffuse_3D;
       }
     }
-
-    if (shead2 != NULL) {
-      mem_put_list(sv->local_storage->coll, shead2);
-    }
   } while (smash != NULL);
 
   vm->pos.x += displacement.x;
   vm->pos.y += displacement.y;
   vm->pos.z += displacement.z;
   vm->t += t_steps;
+  update_species_array_pos(vm);
 
   /* Done with traversing disk, now do real motion */
   if (inertness == inert_to_all) 
@@ -3560,10 +3797,9 @@ react_2D_all_neighbors(struct volume *world, struct surface_molecule *sm,
           surf_surf_colls++;
       }
 
+      apply_rate_changes(world, sm->t);
       for (int jj = 0; jj < num_matching_rxns; jj++) {
         if (matching_rxns[jj] != NULL) {
-          if (matching_rxns[jj]->prob_t != NULL)
-            update_probs(world, matching_rxns[jj], sm->t);
           rxn_array[l] = matching_rxns[jj];
           cf[l] = t / (curr->grid->binding_factor);
           smol[l] = smp;
@@ -3579,7 +3815,10 @@ react_2D_all_neighbors(struct volume *world, struct surface_molecule *sm,
 
   if (n == 0) {
     return sm; /* Nobody to react with */
-  } else if (n == 1) {
+  }
+
+  WORK_COUNT_MOL(world, (struct abstract_molecule *)sm, WORK_RXN_ATTEMPTED);
+  if (n == 1) {
     i = test_bimolecular(rxn_array[0], cf[0], local_prob_factor, NULL, NULL,
                          world->rng);
     j = 0;
@@ -3748,12 +3987,14 @@ void run_timestep(struct volume *state, struct storage *local,
         double save_sched_time = am->t;
         if (max_time > release_time - am->t)
           max_time = release_time - am->t;
+        PROFILE_BEGIN(PROF_DIFFUSE_3D, t_diffuse_3D);
         if (am->properties->flags & (CAN_VOLVOLVOL | CAN_VOLVOLSURF))
           am = (struct abstract_molecule *)diffuse_3D_big_list(
               state, (struct volume_molecule *)am, max_time);
         else
           am = (struct abstract_molecule *)diffuse_3D(
               state, (struct volume_molecule *)am, max_time);
+        PROFILE_END(PROF_DIFFUSE_3D, t_diffuse_3D);
         if (am != NULL) /* We still exist */
         {
           // Perform only for unimolecular reactions
@@ -3772,9 +4013,11 @@ void run_timestep(struct volume *state, struct storage *local,
         // Remember current wall
         current_wall = ((struct surface_molecule *)am)->grid->surface;
 
+        PROFILE_BEGIN(PROF_DIFFUSE_2D, t_diffuse_2D);
         am = (struct abstract_molecule *)diffuse_2D(
             state, (struct surface_molecule *)am, max_time,
             &surface_mol_advance_time);
+        PROFILE_END(PROF_DIFFUSE_2D, t_diffuse_2D);
         if (am == NULL) {
           continue;
         }
@@ -3802,22 +4045,26 @@ void run_timestep(struct volume *state, struct storage *local,
       if (can_surface_mol_react) {
         if ((am->properties->flags & (CANT_INITIATE | CAN_SURFSURF)) ==
             CAN_SURFSURF) {
+          PROFILE_BEGIN(PROF_COLLISIONS, t_surf_neighbors);
           am = (struct abstract_molecule *)react_2D_all_neighbors(
               state, (struct surface_molecule *)am, max_time,
               state->notify->molecule_collision_report,
               state->rxn_flags.surf_surf_reaction_flag,
               &(state->surf_surf_colls));
+          PROFILE_END(PROF_COLLISIONS, t_surf_neighbors);
           if (am == NULL)
             continue;
         }
         if ((am->properties->flags & (CANT_INITIATE | CAN_SURFSURFSURF)) ==
             CAN_SURFSURFSURF) {
+          PROFILE_BEGIN(PROF_COLLISIONS, t_surf_trimol_neighbors);
           am = (struct abstract_molecule *)react_2D_trimol_all_neighbors(
               state, (struct surface_molecule *)am, max_time,
               state->notify->molecule_collision_report,
               state->notify->final_summary,
               state->rxn_flags.surf_surf_surf_reaction_flag,
               &(state->surf_surf_surf_colls));
+          PROFILE_END(PROF_COLLISIONS, t_surf_trimol_neighbors);
           if (am == NULL)
             continue;
         }
@@ -3891,6 +4138,154 @@ void run_timestep(struct volume *state, struct storage *local,
 }
 
 
+/*************************************************************************
+reserve_clamp_scratch:
+  In: world: simulation state
+      n: number of molecules about to be emitted
+  Out: No return value.  world->clamp_uniforms has room for 4 * n uniform
+       draws and world->clamp_sides for n orientation draws.
+*************************************************************************/
+static void reserve_clamp_scratch(struct volume *world, int n) {
+  if (n <= world->clamp_scratch_size)
+    return;
+
+  int size = (world->clamp_scratch_size > 0) ? world->clamp_scratch_size : 64;
+  while (size < n)
+    size *= 2;
+
+  free(world->clamp_uniforms);
+  free(world->clamp_sides);
+  world->clamp_uniforms = CHECKED_MALLOC_ARRAY(
+      double, 4 * size, "concentration clamp random numbers");
+  world->clamp_sides = CHECKED_MALLOC_ARRAY(
+      uint32_t, size, "concentration clamp random numbers");
+  world->clamp_scratch_size = size;
+}
+
+/*************************************************************************
+emit_clamped_molecules:
+  In: world: simulation state
+      ccdo: clamp data for the object being clamped
+      ccdm: clamp data for the molecule being clamped
+      n_emitted: number of molecules to release this step
+      t_now: the current time.
+  Out: No return value.  All random numbers for the batch are drawn up
+       front, walls are picked from the area-weighted alias table and the
+       molecules are placed next to each other and scheduled per storage.
+*************************************************************************/
+static void emit_clamped_molecules(struct volume *world,
+                                   struct ccn_clamp_data *ccdo,
+                                   struct ccn_clamp_data *ccdm,
+                                   int n_emitted, double t_now) {
+  struct volume_molecule vm;
+  vm.t = t_now + 0.5;
+  vm.t2 = 0;
+  vm.flags = IN_SCHEDULE | ACT_NEWBIE | TYPE_VOL | IN_VOLUME |
+            ACT_CLAMPED | ACT_DIFFUSE;
+  vm.properties = ccdm->mol;
+  initialize_diffusion_function((struct abstract_molecule*)&vm);
+
+  vm.mesh_name = NULL;
+  vm.birthplace = NULL;
+  vm.birthday = convert_iterations_to_seconds(
+      world->start_iterations, world->time_unit,
+      world->simulation_start_seconds, t_now);
+  vm.subvol = NULL;
+  vm.previous_wall = NULL;
+  vm.index = ccdm->orient;
+
+  // TODO: This isn't right. We need to figure out what PB these should
+  // really be created in.
+  struct periodic_image periodic_box = {.x = 0,
+                                        .y = 0,
+                                        .z = 0
+                                       };
+  vm.periodic_box = &periodic_box;
+
+  reserve_clamp_scratch(world, n_emitted);
+  double *u = world->clamp_uniforms;
+  rng_fill_dbl(world->rng, u, 4 * n_emitted);
+  if (ccdm->orient == 0)
+    rng_fill_uint32(world->rng, world->clamp_sides, n_emitted);
+
+  struct volume_molecule *vmp = NULL;
+  struct storage *run_store = NULL;
+  struct abstract_element *run_head = NULL, *run_tail = NULL;
+  for (int i = 0; i < n_emitted; i++, u += 4) {
+    int idx = alias_table_sample(ccdo->side_alias, u[0], u[3]);
+    struct wall *w = ccdo->objp->wall_p[ccdo->side_idx[idx]];
+
+    double s1 = sqrt(u[1]);
+    double s2 = u[2] * s1;
+
+    struct vector3 v;
+    v.x = w->vert[0]->x + s1 * (w->vert[1]->x - w->vert[0]->x) +
+          s2 * (w->vert[2]->x - w->vert[1]->x);
+    v.y = w->vert[0]->y + s1 * (w->vert[1]->y - w->vert[0]->y) +
+          s2 * (w->vert[2]->y - w->vert[1]->y);
+    v.z = w->vert[0]->z + s1 * (w->vert[1]->z - w->vert[0]->z) +
+          s2 * (w->vert[2]->z - w->vert[1]->z);
+
+    if (ccdm->orient == 0) {
+      vm.index = (world->clamp_sides[i] & 2) - 1;
+    }
+
+    double eps = EPS_C * vm.index;
+
+    s1 = fabs(v.x);
+    s2 = fabs(v.y);
+    if (s1 < s2) {
+      s1 = s2;
+    }
+    s2 = fabs(v.z);
+    if (s1 < s2) {
+      s1 = s2;
+    }
+    if (s1 > 1.0){
+      eps *= s1;
+    }
+
+    vm.pos.x = v.x + w->normal.x * eps;
+    vm.pos.y = v.y + w->normal.y * eps;
+    vm.pos.z = v.z + w->normal.z * eps;
+    vm.previous_wall = w;
+
+    /* The previous molecule serves as the subvolume guess for the next */
+    int first = (vmp == NULL);
+    vmp = place_volume_molecule_near(world, &vm, vmp);
+    if (vmp == NULL)
+      mcell_allocfailed("Failed to insert a '%s' volume molecule while "
+                        "concentration clamping.",
+                        vm.properties->sym->name);
+
+    /* Molecules are scheduled in runs that share a storage.  They all have
+       the same time, so each run is linked into its scheduler at once and
+       the scheduler ends up as if they had been added one by one. */
+    struct storage *store = vmp->subvol->local_storage;
+    if (store != run_store) {
+      if (run_store != NULL &&
+          schedule_insert_list(run_store->timer, run_head, 1))
+        mcell_allocfailed("Failed to add volume molecules to scheduler.");
+      run_store = store;
+      run_head = NULL;
+    }
+    if (run_head == NULL)
+      run_head = (struct abstract_element *)vmp;
+    else
+      run_tail->next = (struct abstract_element *)vmp;
+    run_tail = (struct abstract_element *)vmp;
+    if (first &&
+        trigger_unimolecular(world->reaction_hash, world->rx_hashsize,
+                             ccdm->mol->hashval,
+                             (struct abstract_molecule *)vmp) != NULL) {
+      vm.flags |= ACT_REACT;
+      vmp->flags |= ACT_REACT;
+    }
+  }
+  if (run_store != NULL && schedule_insert_list(run_store->timer, run_head, 1))
+    mcell_allocfailed("Failed to add volume molecules to scheduler.");
+}
+
 /*************************************************************************
 run_concentration_clamp:
   In: world: simulation state
@@ -3899,8 +4294,6 @@ run_concentration_clamp:
        surfaces to maintain the desired concentation.
 *************************************************************************/
 void run_concentration_clamp(struct volume *world, double t_now) {
-  int this_count = 0;
-  static int total_count = 0;
   for (struct ccn_clamp_data *ccd = world->clamp_list; ccd != NULL; ccd = ccd->next) {
     if (ccd->objp == NULL) {
       continue;
@@ -3917,107 +4310,11 @@ void run_concentration_clamp(struct volume *world, double t_now) {
         if (n_emitted == 0)
           continue;
 
-        struct volume_molecule vm;
-        vm.t = t_now + 0.5;
-        vm.t2 = 0;
-        vm.flags = IN_SCHEDULE | ACT_NEWBIE | TYPE_VOL | IN_VOLUME |
-                  ACT_CLAMPED | ACT_DIFFUSE;
-        vm.properties = ccdm->mol;
-        initialize_diffusion_function((struct abstract_molecule*)&vm);
-
-        vm.mesh_name = NULL;
-        vm.birthplace = NULL;
-        vm.birthday = convert_iterations_to_seconds(
-            world->start_iterations, world->time_unit,
-            world->simulation_start_seconds, t_now);
-        vm.subvol = NULL;
-        vm.previous_wall = NULL;
-        vm.index = 0;
-        struct volume_molecule *vmp = NULL;
-
-        this_count += n_emitted;
-        while (n_emitted > 0) {
-          int idx = bisect_high(ccdo->cum_area, ccdo->n_sides,
-                            rng_dbl(world->rng) *
-                                ccdo->cum_area[ccd->n_sides - 1]);
-          struct wall *w = ccdo->objp->wall_p[ccdo->side_idx[idx]];
-
-          double s1 = sqrt(rng_dbl(world->rng));
-          double s2 = rng_dbl(world->rng) * s1;
-
-          struct vector3 v;
-          v.x = w->vert[0]->x + s1 * (w->vert[1]->x - w->vert[0]->x) +
-                s2 * (w->vert[2]->x - w->vert[1]->x);
-          v.y = w->vert[0]->y + s1 * (w->vert[1]->y - w->vert[0]->y) +
-                s2 * (w->vert[2]->y - w->vert[1]->y);
-          v.z = w->vert[0]->z + s1 * (w->vert[1]->z - w->vert[0]->z) +
-                s2 * (w->vert[2]->z - w->vert[1]->z);
-
-          if (ccdm->orient == 1) {
-            vm.index = 1;
-          }
-          else if (ccdm->orient == -1) {
-            vm.index = -1;
-          }
-          else {
-            vm.index = (rng_uint(world->rng) & 2) - 1;
-          }
-
-          double eps = EPS_C * vm.index;
-
-          s1 = fabs(v.x);
-          s2 = fabs(v.y);
-          if (s1 < s2) {
-            s1 = s2;
-          }
-          s2 = fabs(v.z);
-          if (s1 < s2) {
-            s1 = s2;
-          }
-          if (s1 > 1.0){
-            eps *= s1;
-          }
-
-          vm.pos.x = v.x + w->normal.x * eps;
-          vm.pos.y = v.y + w->normal.y * eps;
-          vm.pos.z = v.z + w->normal.z * eps;
-          vm.previous_wall = w;
-          // TODO: This isn't right. We need to figure out what PB these should
-          // really be created in.
-          struct periodic_image periodic_box = {.x = 0,
-                                                .y = 0,
-                                                .z = 0
-                                               };
-          
-          vm.periodic_box = &periodic_box;
-
-          if (vmp == NULL) {
-            vmp = insert_volume_molecule(world, &vm, vmp);
-            if (vmp == NULL)
-              mcell_allocfailed("Failed to insert a '%s' volume molecule while "
-                                "concentration clamping.",
-                                vm.properties->sym->name);
-            if (trigger_unimolecular(world->reaction_hash, world->rx_hashsize,
-                                     ccdm->mol->hashval,
-                                     (struct abstract_molecule *)vmp) != NULL) {
-              vm.flags |= ACT_REACT;
-              vmp->flags |= ACT_REACT;
-            }
-          } else {
-            vmp = insert_volume_molecule(world, &vm, vmp);
-            if (vmp == NULL)
-              mcell_allocfailed("Failed to insert a '%s' volume molecule while "
-                                "concentration clamping.",
-                                vm.properties->sym->name);
-          }
-
-          n_emitted--;
-        }
+        emit_clamped_molecules(world, ccdo, ccdm, n_emitted, t_now);
+        world->clamp_emitted += n_emitted;
       }
     }
   }
-
-  total_count += this_count;
 }
 
 
@@ -4088,11 +4385,10 @@ static int collide_and_react_with_vol_mol(struct volume* world,
 
   double scaling = factor * r_rate_factor;
   struct rxn* rx = smash->intermediate;
-  if ((rx != NULL) && (rx->prob_t != NULL)) {
-    update_probs(world, rx, m->t);
-  }
+  apply_rate_changes(world, m->t);
   struct species *spec = m->properties;
   struct periodic_image *periodic_box = m->periodic_box;
+  WORK_COUNT(world, m->subvol, spec, WORK_RXN_ATTEMPTED);
   int i = test_bimolecular(
     rx, scaling, 0, am, (struct abstract_molecule *)m, world->rng);
 
@@ -4203,12 +4499,12 @@ int collide_and_react_with_surf_mol(struct volume* world, struct collision* smas
           world->vol_surf_colls++;
       }
 
+      apply_rate_changes(world, m->t);
       for (int l = 0; l < num_matching_rxns; l++) {
-        if (matching_rxns[l]->prob_t != NULL)
-          update_probs(world, matching_rxns[l], m->t);
         scaling_coef[l] = r_rate_factor / w->grid->binding_factor;
       }
 
+      WORK_COUNT(world, m->subvol, m->properties, WORK_RXN_ATTEMPTED);
       if (num_matching_rxns == 1) {
         ii = test_bimolecular(matching_rxns[0], scaling_coef[0], 0,
           (struct abstract_molecule *)m, (struct abstract_molecule *)sm,
@@ -4320,10 +4616,8 @@ int collide_and_react_with_surf_mol(struct volume* world, struct collision* smas
               world->rxn_flags.vol_surf_surf_reaction_flag) {
               world->vol_surf_surf_colls++;
           }
+          apply_rate_changes(world, m->t);
           for (j = 0; j < num_matching_rxns; j++) {
-            if (matching_rxns[j]->prob_t != NULL) {
-              update_probs(world, matching_rxns[j], m->t);
-            }
             rxn_array[ll] = matching_rxns[j];
             cf[ll] = r_rate_factor / (w->grid->binding_factor *
                                       curr->grid->binding_factor);
@@ -4335,6 +4629,8 @@ int collide_and_react_with_surf_mol(struct volume* world, struct collision* smas
       }
       delete_tile_neighbor_list(tile_nbr_head);
 
+      if (n > 0)
+        WORK_COUNT(world, m->subvol, m->properties, WORK_RXN_ATTEMPTED);
       if (n == 1) {
         ii = test_bimolecular(rxn_array[0], cf[0], local_prob_factor,
           NULL, NULL, world->rng);
@@ -4471,13 +4767,10 @@ int collide_and_react_with_walls(struct volume* world, struct collision* smash,
   } else if (inertness < inert_to_all) {
     /* Collisions with the surfaces declared REFLECTIVE are treated similar to
      * the default surfaces after this loop. */
-    for (int l = 0; l < num_matching_rxns; l++) {
-      if (matching_rxns[l]->prob_t != NULL) {
-        update_probs(world, matching_rxns[l], m->t);
-      }
-    }
+    apply_rate_changes(world, m->t);
     int jj = 0;
     int i = 0;
+    WORK_COUNT(world, m->subvol, m->properties, WORK_RXN_ATTEMPTED);
     if (num_matching_rxns == 1) {
       i = test_intersect(matching_rxns[0], r_rate_factor, world->rng);
       jj = 0;
@@ -4975,6 +5268,7 @@ void determine_mol_mol_reactions(struct volume* world, struct volume_molecule* m
     if (psl->head == NULL) {
       *psl_head = psl->next;
       ht_remove(&sv->mol_by_species, psl);
+      free_species_arrays(psl);
       mem_put(sv->local_storage->pslv, psl);
       continue;
     } else
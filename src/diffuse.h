@@ -63,6 +63,9 @@ struct collision *ray_trace(struct volume *world, struct vector3 *init_pos,
                             struct collision *c, struct subvolume *sv,
                             struct vector3 *v, struct wall *reflectee);
 
+struct collision *collision_buffer_slot(struct collision_buffer *buf);
+struct collision *sort_collision_buffer(struct collision_buffer *buf);
+
 struct sp_collision *ray_trace_trimol(struct volume *world,
                                       struct volume_molecule *m,
                                       struct sp_collision *c,
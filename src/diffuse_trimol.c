@@ -41,6 +41,7 @@
 #include "wall_util.h"
 #include "react.h"
 #include "react_output.h"
+#include "work_counters.h"
 
 /**********************************************************************
 ray_trace_trimol:
@@ -76,6 +77,7 @@ struct sp_collision *ray_trace_trimol(struct volume *world,
   int i, j, k;
 
   world->ray_voxel_tests++;
+  WORK_PENDING(sv, WORK_RAY_VOXEL);
 
   shead = NULL;
   smash = (struct sp_collision *)CHECKED_MEM_GET(sv->local_storage->sp_coll,
@@ -87,6 +89,7 @@ struct sp_collision *ray_trace_trimol(struct volume *world,
     if (wlp->this_wall == reflectee)
       continue;
 
+    WORK_PENDING(sv, WORK_WALL_TESTS);
     i = collide_wall(&(m->pos), v, wlp->this_wall, &(smash->t), &(smash->loc),
                      1, world->rng, world->notify, &(world->ray_polygon_tests));
     if (i == COLLIDE_REDO) {
@@ -251,6 +254,7 @@ struct sp_collision *ray_trace_trimol(struct volume *world,
     if (a->properties == NULL)
       continue;
 
+    WORK_PENDING(sv, WORK_MOL_PAIR_TESTS);
     i = collide_mol(&(m->pos), v, a, &(c->t), &(c->loc), world->rx_radius_3d);
     if (i != COLLIDE_MISS) {
       smash = (struct sp_collision *)CHECKED_MEM_GET(sv->local_storage->sp_coll,
@@ -459,7 +463,7 @@ static struct sp_collision *expand_collision_partner_list(
   }
 
   /* go -Y */
-  if (y_pos) {
+  if (y_neg) {
     struct subvolume *newsv_y = sv - (nz_parts - 1);
     shead1 = expand_collision_partner_list_for_neighbor(
         sv, m, mv, newsv_y, &path_llf, &path_urb, shead1, 0.0, -R, 0.0,
@@ -702,78 +706,96 @@ pretend_to_call_diffuse_3D_big_list: /* Label to allow fake recursion */
 
   if (moving_tri_molecular_flag || moving_bi_molecular_flag ||
       moving_mol_mol_grid_flag) {
-    /* scan molecules from this SV */
+    /* Garbage collection of empty per-species lists */
     struct per_species_list *psl_next, *psl,
         **psl_head = &m->subvol->species_head;
     for (psl = m->subvol->species_head; psl != NULL; psl = psl_next) {
       psl_next = psl->next;
-      if (psl->properties == NULL) {
-        psl_head = &psl->next;
-        continue;
-      }
-
-      /* Garbage collection of empty per-species lists */
-      if (psl->head == NULL) {
+      if (psl->properties != NULL && psl->head == NULL) {
         *psl_head = psl->next;
         ht_remove(&sv->mol_by_species, psl);
+        free_species_arrays(psl);
         mem_put(sv->local_storage->pslv, psl);
-        continue;
       } else
         psl_head = &psl->next;
+    }
 
-      col_bi_molecular_flag =
-          moving_bi_molecular_flag &&
-          ((psl->properties->flags & CAN_VOLVOL) == CAN_VOLVOL);
-      col_tri_molecular_flag =
-          moving_tri_molecular_flag &&
-          ((psl->properties->flags & CAN_VOLVOLVOL) == CAN_VOLVOLVOL);
-      col_mol_mol_grid_flag =
-          moving_mol_mol_grid_flag &&
-          ((psl->properties->flags & CAN_VOLVOLSURF) == CAN_VOLVOLSURF);
-
-      if (col_bi_molecular_flag &&
-          !trigger_bimolecular_preliminary(
-               world->reaction_hash, world->rx_hashsize, spec->hashval,
-               psl->properties->hashval, spec, psl->properties))
-        col_bi_molecular_flag = 0;
-
-      /* What types of collisions are we concerned with for this molecule type?
-       */
-      int what = 0;
-      if (col_bi_molecular_flag)
-        what |= COLLIDE_VOL;
-      if (col_tri_molecular_flag)
-        what |= COLLIDE_VOL_VOL;
-      if (col_mol_mol_grid_flag)
-        what |= COLLIDE_VOL_SURF;
-
-      /* If we are interested in collisions with this molecule type, add all
-       * local molecules to our collision list */
-      if (what != 0) {
-        for (mp = psl->head; mp != NULL; mp = mp->next_v) {
-          if (mp == m)
-            continue;
-
-          smash = (struct sp_collision *)CHECKED_MEM_GET(
-              sv->local_storage->sp_coll, "collision data");
-          smash->t = 0.0;
-          smash->t_start = 0.0;
-          smash->pos_start.x = m->pos.x;
-          smash->pos_start.y = m->pos.y;
-          smash->pos_start.z = m->pos.z;
-          smash->sv_start = sv;
-          smash->disp.x = displacement.x;
-          smash->disp.y = displacement.y;
-          smash->disp.z = displacement.z;
-          smash->moving = m->properties;
-          smash->target = (void *)mp;
-          smash->loc.x = 0.0;
-          smash->loc.y = 0.0;
-          smash->loc.z = 0.0;
-          smash->what = what;
-
-          smash->next = shead;
-          shead = smash;
+    /* scan molecules from this SV.  No molecule further away than the length
+     * of the displacement plus the interaction radius can be hit, even after
+     * reflections, so only the cells of the neighbor table around that box
+     * are looked at. */
+    struct nbr_table *nbr = get_nbr_table(world, sv);
+    double reach = vect_length(&displacement) + world->rx_radius_3d + EPS_C;
+    struct vector3 lo = { m->pos.x - reach, m->pos.y - reach, m->pos.z - reach };
+    struct vector3 hi = { m->pos.x + reach, m->pos.y + reach, m->pos.z + reach };
+    int x_lo = nbr_cell_axis(lo.x, nbr->llf.x, nbr->r_edge.x, nbr->nx);
+    int x_hi = nbr_cell_axis(hi.x, nbr->llf.x, nbr->r_edge.x, nbr->nx);
+    int y_lo = nbr_cell_axis(lo.y, nbr->llf.y, nbr->r_edge.y, nbr->ny);
+    int y_hi = nbr_cell_axis(hi.y, nbr->llf.y, nbr->r_edge.y, nbr->ny);
+    int z_lo = nbr_cell_axis(lo.z, nbr->llf.z, nbr->r_edge.z, nbr->nz);
+    int z_hi = nbr_cell_axis(hi.z, nbr->llf.z, nbr->r_edge.z, nbr->nz);
+    for (int x = x_lo; x <= x_hi; x++) {
+      for (int y = y_lo; y <= y_hi; y++) {
+        for (int z = z_lo; z <= z_hi; z++) {
+          struct nbr_cell *cell = &nbr->cells[(x * nbr->ny + y) * nbr->nz + z];
+          for (int n = 0; n < cell->n_mols; n++) {
+            mp = cell->mols[n];
+            if (mp == m || mp->properties == NULL)
+              continue;
+            if (mp->pos.x < lo.x || mp->pos.x > hi.x || mp->pos.y < lo.y ||
+                mp->pos.y > hi.y || mp->pos.z < lo.z || mp->pos.z > hi.z)
+              continue;
+
+            struct species *mp_spec = mp->properties;
+            col_bi_molecular_flag =
+                moving_bi_molecular_flag &&
+                ((mp_spec->flags & CAN_VOLVOL) == CAN_VOLVOL);
+            col_tri_molecular_flag =
+                moving_tri_molecular_flag &&
+                ((mp_spec->flags & CAN_VOLVOLVOL) == CAN_VOLVOLVOL);
+            col_mol_mol_grid_flag =
+                moving_mol_mol_grid_flag &&
+                ((mp_spec->flags & CAN_VOLVOLSURF) == CAN_VOLVOLSURF);
+
+            if (col_bi_molecular_flag &&
+                !trigger_bimolecular_preliminary(
+                     world->reaction_hash, world->rx_hashsize, spec->hashval,
+                     mp_spec->hashval, spec, mp_spec))
+              col_bi_molecular_flag = 0;
+
+            /* What types of collisions are we concerned with for this
+             * molecule type? */
+            int what = 0;
+            if (col_bi_molecular_flag)
+              what |= COLLIDE_VOL;
+            if (col_tri_molecular_flag)
+              what |= COLLIDE_VOL_VOL;
+            if (col_mol_mol_grid_flag)
+              what |= COLLIDE_VOL_SURF;
+            if (what == 0)
+              continue;
+
+            smash = (struct sp_collision *)CHECKED_MEM_GET(
+                sv->local_storage->sp_coll, "collision data");
+            smash->t = 0.0;
+            smash->t_start = 0.0;
+            smash->pos_start.x = m->pos.x;
+            smash->pos_start.y = m->pos.y;
+            smash->pos_start.z = m->pos.z;
+            smash->sv_start = sv;
+            smash->disp.x = displacement.x;
+            smash->disp.y = displacement.y;
+            smash->disp.z = displacement.z;
+            smash->moving = m->properties;
+            smash->target = (void *)mp;
+            smash->loc.x = 0.0;
+            smash->loc.y = 0.0;
+            smash->loc.z = 0.0;
+            smash->what = what;
+
+            smash->next = shead;
+            shead = smash;
+          }
         }
       }
     }
@@ -854,6 +876,7 @@ pretend_to_call_diffuse_3D_big_list: /* Label to allow fake recursion */
 
     shead2 = ray_trace_trimol(world, m, shead, sv, &displacement, reflectee,
                               t_start);
+    WORK_COMMIT(world, sv, m->properties);
 
     if (shead2 == NULL)
       mcell_internal_error("ray_trace_trimol returned NULL.");
@@ -1501,9 +1524,8 @@ pretend_to_call_diffuse_3D_big_list: /* Label to allow fake recursion */
 
       k = tri_smash->orient;
 
-      if ((rx != NULL) && (rx->prob_t != NULL))
-        update_probs(world, rx, m->t);
-
+      apply_rate_changes(world, m->t);
+      WORK_COUNT(world, m->subvol, m->properties, WORK_RXN_ATTEMPTED);
       /* XXX: Change required here to support macromol+trimol */
       i = test_bimolecular(rx, tri_smash->factor, tri_smash->local_prob_factor,
                            NULL, NULL,
@@ -1617,8 +1639,8 @@ pretend_to_call_diffuse_3D_big_list: /* Label to allow fake recursion */
 
             continue; /* Ignore this wall and keep going */
           } else if (rx->n_pathways != RX_REFLEC) {
-            if (rx->prob_t != NULL)
-              update_probs(world, rx, m->t);
+            apply_rate_changes(world, m->t);
+            WORK_COUNT(world, m->subvol, m->properties, WORK_RXN_ATTEMPTED);
             i = test_intersect(rx, r_rate_factor, world->rng);
             if (i > RX_NO_RX) {
               /* Save m flags in case it gets collected in outcome_intersect */
@@ -1717,6 +1739,7 @@ pretend_to_call_diffuse_3D_big_list: /* Label to allow fake recursion */
   m->pos.y += displacement.y;
   m->pos.z += displacement.z;
   m->t += t_steps;
+  update_species_array_pos(m);
 
   m->index = -1;
   m->previous_wall = NULL;
@@ -1909,7 +1932,10 @@ struct surface_molecule *react_2D_trimol_all_neighbors(
 
   if (n == 0) {
     return sm; /* Nobody to react with */
-  } else if (n == 1) {
+  }
+
+  WORK_COUNT_MOL(world, (struct abstract_molecule *)sm, WORK_RXN_ATTEMPTED);
+  if (n == 1) {
     /* XXX: Change required here to support macromol+trimol */
     i = test_bimolecular(rxn_array[0], cf[0], local_prob_factor[0], NULL, NULL, world->rng);
     j = 0;
@@ -1350,6 +1350,12 @@ void dump_vector3(struct vector3 vec, const char* extra_comment) {
   cout << extra_comment << vec << "\n";
 }
 
-void dump_rng_call_info(struct isaac64_state* rng, const char* extra_comment) {
+void dump_rng_call_info(struct rng_state* rng, const char* extra_comment) {
+#if defined(USE_PHILOX_RNG)
+  cout << "  " << extra_comment << "randcnt:" << rng->randcnt << ", stream:" << rng->stream << ", counter:" << rng->counter << "\n";
+#elif defined(USE_MINIMAL_RNG)
+  cout << "  " << extra_comment << "a:" << (unsigned)rng->a << ", b:" << (unsigned)rng->b << ", c:" << (unsigned)rng->c << ", d:" << (unsigned)rng->d << "\n";
+#else
   cout << "  " << extra_comment << "randcnt:" << rng->randcnt << ", aa:" << (unsigned)rng->aa << ", bb:" << (unsigned)rng->bb << ", cc:" << (unsigned)rng->cc << "\n";
+#endif
 }
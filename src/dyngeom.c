@@ -41,6 +41,7 @@
 #include "mdlparse_aux.h"
 #include "react.h"
 #include "nfsim_func.h"
+#include "work_counters.h"
 
 #define NO_MESH "\0"
 
@@ -1206,13 +1207,37 @@ int destroy_everything(struct volume *state) {
     free(state->clamp_list->side_idx);
     free(state->clamp_list->cum_area);
   }
+  for (struct ccn_clamp_data *ccd = state->clamp_list; ccd != NULL;
+       ccd = ccd->next) {
+    for (struct ccn_clamp_data *ccdo = ccd; ccdo != NULL;
+         ccdo = ccdo->next_obj) {
+      alias_table_destroy(ccdo->side_alias);
+      ccdo->side_alias = NULL;
+    }
+  }
+  free(state->clamp_uniforms);
+  free(state->clamp_sides);
+  state->clamp_uniforms = NULL;
+  state->clamp_sides = NULL;
+  state->clamp_scratch_size = 0;
 
   destroy_walls(state);
+  state->geometry_generation++;
 
   // Destroy memory helpers
   delete_mem(state->coll_mem);
   delete_mem(state->exdv_mem);
 
+  // Release species arrays and neighbor tables before their molecules go
+  // away with the storages
+  for (int i = 0; i < state->n_subvols; i++) {
+    struct subvolume *sv = &state->subvol[i];
+    for (struct per_species_list *psl = sv->species_head; psl != NULL;
+         psl = psl->next)
+      free_species_arrays(psl);
+    destroy_nbr_table(sv);
+  }
+
   struct storage_list *mem;
   for (mem = state->storage_head; mem != NULL; mem = mem->next) {
     delete_mem(mem->store->list);
@@ -1233,10 +1258,17 @@ int destroy_everything(struct volume *state) {
     sv->local_storage->wall_count = 0;
     sv->local_storage->vert_count = 0;
     sv->wall_head = NULL;
+    sv->walls = NULL;
+    sv->n_walls = 0;
   }
 
   for (mem = state->storage_head; mem != NULL; mem = mem->next) {
     delete_scheduler(mem->store->timer);
+    free(mem->store->ray_hits.items);
+    free(mem->store->ray_hits.order);
+#ifdef MCELL_WORK_COUNTERS
+    work_counters_destroy(state, mem->store);
+#endif
     free(mem->store);
   }
   state->storage_head->store = NULL;
@@ -1276,6 +1308,8 @@ void destroy_walls(struct volume *state) {
 
   free(state->walls_using_vertex);
   free(state->all_vertices);
+  free(state->subvol_walls);
+  state->subvol_walls = NULL;
   state->n_walls = 0;
   state->n_verts = 0;
 }
@@ -1307,8 +1341,9 @@ destroy_objects:
   In: obj_ptr: object to be destroyed
       free_poly_flag: see explanation in destroy_poly_object
   Out: Zero on success. One otherwise. Recursively destroys objects.
-  Note: Currently, this ultimately only destroys polygon objects. I don't know
-        if there's a need to trash release objects that use release patterns.
+  Note: Currently, this ultimately only destroys polygon objects and the
+        voxel caches of region releases. I don't know if there's a need to
+        trash release objects that use release patterns.
 ***************************************************************************/
 int destroy_objects(struct object *obj_ptr, int free_poly_flag) {
   obj_ptr->sym->count = 0;
@@ -1329,8 +1364,18 @@ int destroy_objects(struct object *obj_ptr, int free_poly_flag) {
     destroy_poly_object(obj_ptr, free_poly_flag);
     break;
 
+  // the voxel cache of a region release refers to the walls, it is rebuilt on
+  // the next release
+  case REL_SITE_OBJ: {
+    struct release_site_obj *rso = (struct release_site_obj *)obj_ptr->contents;
+    if (rso != NULL && rso->region_data != NULL) {
+      destroy_release_voxel_cache(rso->region_data->voxels);
+      rso->region_data->voxels = NULL;
+    }
+    break;
+  }
+
   // do nothing
-  case REL_SITE_OBJ:
   case VOXEL_OBJ:
     break;
   }
@@ -1999,8 +2044,18 @@ char *get_mesh_instantiation_names(struct object *obj_ptr,
   case POLY_OBJ:
     return CHECKED_STRDUP(obj_ptr->sym->name, "mesh name");
 
+  // the voxel cache of a region release refers to the walls, it is rebuilt on
+  // the next release
+  case REL_SITE_OBJ: {
+    struct release_site_obj *rso = (struct release_site_obj *)obj_ptr->contents;
+    if (rso != NULL && rso->region_data != NULL) {
+      destroy_release_voxel_cache(rso->region_data->voxels);
+      rso->region_data->voxels = NULL;
+    }
+    break;
+  }
+
   // do nothing
-  case REL_SITE_OBJ:
   case VOXEL_OBJ:
     break;
   }
@@ -0,0 +1,368 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2019 by
+ * The Salk Institute for Biological Studies and
+ * Pittsburgh Supercomputing Center, Carnegie Mellon University
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+ * USA.
+ *
+******************************************************************************/
+
+#include "config.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "logging.h"
+#include "mem_util.h"
+#include "event_trace.h"
+
+#define TRACE_RING_SIZE 16384 /* records per thread, a power of two */
+#define TRACE_FLUSH_MS 20     /* longest time records wait in a ring */
+#define TRACE_EMERGENCY_SPINS (1 << 24) /* tries to take over the file */
+
+/* Ring of one thread.  The thread only moves head and the flusher only moves
+ * tail, so neither needs a lock. */
+struct trace_ring {
+  struct trace_record records[TRACE_RING_SIZE];
+  _Atomic uint64_t head; /* records written */
+  _Atomic uint64_t tail; /* records flushed */
+  unsigned int generation; /* of the trace the ring belongs to */
+  uint16_t thread;
+  struct trace_ring *next;
+};
+
+struct event_trace {
+  FILE *f;
+  int fd;     /* of f, records are written with write(2), see
+                 trace_emergency_flush */
+  char *filename;
+  int failed; /* set by the flusher if writing failed */
+  atomic_flag writing; /* held while records are written */
+
+  pthread_t flusher;
+  pthread_mutex_t lock; /* protects rings, n_rings and stop */
+  pthread_cond_t wake;
+  int stop;
+  struct trace_ring *rings;
+  uint16_t n_rings;
+};
+
+struct event_trace *mcell_trace = NULL;
+
+/* Bumped by every trace_open, so that threads notice that the ring they
+ * cached belongs to a trace which was closed */
+static unsigned int trace_generation = 0;
+static _Thread_local struct trace_ring *trace_my_ring = NULL;
+
+/* Writes all of buf, returns 0 on success; async-signal-safe */
+static int trace_write(int fd, void const *buf, size_t size) {
+  char const *p = (char const *)buf;
+  while (size > 0) {
+    ssize_t n = write(fd, p, size);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return 1;
+    p += n;
+    size -= (size_t)n;
+  }
+  return 0;
+}
+
+/*************************************************************************
+trace_flush_ring:
+  In: trace: the trace
+      ring: a ring of the trace
+  Out: Returns the number of records written.  All records the thread
+       finished writing are appended to the file and their slots freed.
+       The caller must hold trace->writing.
+*************************************************************************/
+static uint64_t trace_flush_ring(struct event_trace *trace,
+                                 struct trace_ring *ring) {
+  uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+  uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  uint64_t n = head - tail;
+  if (n == 0)
+    return 0;
+
+  size_t first = (size_t)(tail & (TRACE_RING_SIZE - 1));
+  size_t n_first = (first + n > TRACE_RING_SIZE) ? TRACE_RING_SIZE - first : n;
+  if (trace_write(trace->fd, ring->records + first,
+                  n_first * sizeof(struct trace_record)) ||
+      trace_write(trace->fd, ring->records,
+                  (n - n_first) * sizeof(struct trace_record)))
+    trace->failed = 1;
+
+  atomic_store_explicit(&ring->tail, head, memory_order_release);
+  return n;
+}
+
+static void *trace_flusher_main(void *arg) {
+  struct event_trace *trace = (struct event_trace *)arg;
+
+  pthread_mutex_lock(&trace->lock);
+  while (1) {
+    int stop = trace->stop;
+    struct trace_ring *rings = trace->rings;
+    pthread_mutex_unlock(&trace->lock);
+
+    /* New rings are only ever added in front, so the list can be walked
+     * without the lock */
+    uint64_t n = 0;
+    while (atomic_flag_test_and_set_explicit(&trace->writing,
+                                             memory_order_acquire))
+      sched_yield();
+    for (struct trace_ring *ring = rings; ring != NULL; ring = ring->next)
+      n += trace_flush_ring(trace, ring);
+    atomic_flag_clear_explicit(&trace->writing, memory_order_release);
+
+    pthread_mutex_lock(&trace->lock);
+    if (stop && n == 0)
+      break;
+    if (n == 0 && !trace->stop) {
+      struct timeval now;
+      struct timespec deadline;
+      gettimeofday(&now, NULL);
+      long long ns = (long long)now.tv_usec * 1000 + TRACE_FLUSH_MS * 1000000LL;
+      deadline.tv_sec = now.tv_sec + (time_t)(ns / 1000000000LL);
+      deadline.tv_nsec = (long)(ns % 1000000000LL);
+      pthread_cond_timedwait(&trace->wake, &trace->lock, &deadline);
+    }
+  }
+  pthread_mutex_unlock(&trace->lock);
+  return NULL;
+}
+
+/*************************************************************************
+trace_open:
+  In: filename: where to write the trace
+  Out: Returns 0 on success, 1 on failure.  Starts tracing.
+*************************************************************************/
+int trace_open(char const *filename) {
+  if (mcell_trace != NULL)
+    return 0;
+
+  FILE *f = fopen(filename, "wb");
+  if (f == NULL) {
+    mcell_perror_nodie(errno, "Failed to open event trace '%s'", filename);
+    return 1;
+  }
+
+  struct trace_file_header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+  header.version = TRACE_VERSION;
+  header.record_size = sizeof(struct trace_record);
+  if (fwrite(&header, sizeof(header), 1, f) != 1 || fflush(f) != 0) {
+    mcell_perror_nodie(errno, "Failed to write event trace '%s'", filename);
+    fclose(f);
+    return 1;
+  }
+
+  struct event_trace *trace =
+      CHECKED_MALLOC_STRUCT_NODIE(struct event_trace, "event trace");
+  if (trace == NULL) {
+    fclose(f);
+    return 1;
+  }
+  memset(trace, 0, sizeof(struct event_trace));
+  trace->f = f;
+  trace->fd = fileno(f);
+  atomic_flag_clear(&trace->writing);
+  trace->filename = CHECKED_STRDUP_NODIE(filename, "event trace file name");
+  pthread_mutex_init(&trace->lock, NULL);
+  pthread_cond_init(&trace->wake, NULL);
+  if (trace->filename == NULL ||
+      pthread_create(&trace->flusher, NULL, trace_flusher_main, trace) != 0) {
+    mcell_warn("Could not start the event trace writer.");
+    pthread_mutex_destroy(&trace->lock);
+    pthread_cond_destroy(&trace->wake);
+    free(trace->filename);
+    free(trace);
+    fclose(f);
+    return 1;
+  }
+
+  trace_generation++;
+  mcell_trace = trace;
+  return 0;
+}
+
+/*************************************************************************
+trace_close:
+  In: nothing
+  Out: Returns 0 on success, 1 if the trace could not be written completely.
+       Stops tracing and writes out all records.  The other threads must no
+       longer be tracing.
+*************************************************************************/
+int trace_close(void) {
+  struct event_trace *trace = mcell_trace;
+  if (trace == NULL)
+    return 0;
+  mcell_trace = NULL;
+
+  pthread_mutex_lock(&trace->lock);
+  trace->stop = 1;
+  pthread_cond_signal(&trace->wake);
+  pthread_mutex_unlock(&trace->lock);
+  pthread_join(trace->flusher, NULL);
+
+  int status = 0;
+  if (trace->failed | ferror(trace->f) | fclose(trace->f)) {
+    mcell_perror_nodie(errno, "Failed to write event trace '%s'",
+                       trace->filename);
+    status = 1;
+  }
+
+  struct trace_ring *ring = trace->rings;
+  while (ring != NULL) {
+    struct trace_ring *next = ring->next;
+    free(ring);
+    ring = next;
+  }
+  trace_my_ring = NULL;
+  pthread_mutex_destroy(&trace->lock);
+  pthread_cond_destroy(&trace->wake);
+  free(trace->filename);
+  free(trace);
+  return status;
+}
+
+/*************************************************************************
+trace_emergency_flush:
+  In: nothing
+  Out: No return value.  The records all threads finished writing are
+       appended to the trace, which is then left alone, so that a dying
+       process keeps the events which led up to its end.  Only uses
+       async-signal-safe calls, and gives up if the file cannot be taken
+       over from a thread writing to it, e.g. the one a signal interrupted.
+*************************************************************************/
+void trace_emergency_flush(void) {
+  struct event_trace *trace = mcell_trace;
+  if (trace == NULL)
+    return;
+
+  int spins = 0;
+  while (atomic_flag_test_and_set_explicit(&trace->writing,
+                                           memory_order_acquire)) {
+    if (++spins == TRACE_EMERGENCY_SPINS)
+      return;
+  }
+
+  /* The flag is kept, the flusher must not write after this */
+  for (struct trace_ring *ring = trace->rings; ring != NULL; ring = ring->next)
+    trace_flush_ring(trace, ring);
+}
+
+/*************************************************************************
+trace_get_ring:
+  In: trace: the trace
+  Out: The ring of the calling thread, created on its first record.
+*************************************************************************/
+static struct trace_ring *trace_get_ring(struct event_trace *trace) {
+  struct trace_ring *ring = trace_my_ring;
+  if (ring != NULL && ring->generation == trace_generation)
+    return ring;
+
+  ring = CHECKED_MALLOC_STRUCT(struct trace_ring, "event trace ring");
+  atomic_init(&ring->head, 0);
+  atomic_init(&ring->tail, 0);
+  ring->generation = trace_generation;
+
+  pthread_mutex_lock(&trace->lock);
+  ring->thread = trace->n_rings++;
+  ring->next = trace->rings;
+  trace->rings = ring;
+  pthread_mutex_unlock(&trace->lock);
+
+  trace_my_ring = ring;
+  return ring;
+}
+
+/*************************************************************************
+trace_put:
+  In: rec: record to write, without its thread
+  Out: The record is queued in the ring of the calling thread.  If the ring
+       is full, waits for the flusher rather than losing records.
+*************************************************************************/
+static void trace_put(struct trace_record *rec) {
+  struct event_trace *trace = mcell_trace;
+  struct trace_ring *ring = trace_get_ring(trace);
+
+  uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  while (head - atomic_load_explicit(&ring->tail, memory_order_acquire) >=
+         TRACE_RING_SIZE) {
+    pthread_cond_signal(&trace->wake);
+    sched_yield();
+  }
+
+  rec->thread = ring->thread;
+  ring->records[head & (TRACE_RING_SIZE - 1)] = *rec;
+  atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+  /* Wake the flusher early once half of the ring is in use */
+  if (((head + 1) & (TRACE_RING_SIZE / 2 - 1)) == 0)
+    pthread_cond_signal(&trace->wake);
+}
+
+/*************************************************************************
+trace_event:
+  In: the fields of the record, see struct trace_record
+  Out: The record is added to the trace.
+*************************************************************************/
+void trace_event(uint8_t type, uint8_t flags, uint64_t iteration, uint64_t id,
+                 uint64_t id2, uint32_t species, double time, double x,
+                 double y, double z) {
+  struct trace_record rec;
+  rec.type = type;
+  rec.flags = flags;
+  rec.species = species;
+  rec.iteration = iteration;
+  rec.id = id;
+  rec.id2 = id2;
+  rec.time = time;
+  rec.pos[0] = x;
+  rec.pos[1] = y;
+  rec.pos[2] = z;
+  trace_put(&rec);
+}
+
+/*************************************************************************
+trace_rng:
+  In: flags: TRACE_RNG_GAUSS for rng_gauss, 0 otherwise
+      randcnt, aa, bb, cc: ISAAC state before the call
+  Out: The RNG call is added to the trace.
+*************************************************************************/
+void trace_rng(uint8_t flags, uint64_t randcnt, uint64_t aa, uint64_t bb,
+               uint64_t cc) {
+  struct trace_record rec;
+  memset(&rec, 0, sizeof(rec));
+  rec.type = TRACE_RNG;
+  rec.flags = flags;
+  rec.id = randcnt;
+  rec.id2 = (uint32_t)aa;
+  rec.species = (uint32_t)bb;
+  rec.iteration = (uint32_t)cc;
+  trace_put(&rec);
+}
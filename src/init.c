@@ -58,6 +58,7 @@
 #include "triangle_overlap.h"
 
 #include "debug_config.h"
+#include "work_counters.h"
 
 #define MESH_DISTINCTIVE EPS_C
 
@@ -361,7 +362,7 @@ int init_data_structures(struct volume *world) {
   if (world->seed_seq < 1 || world->seed_seq > INT_MAX)
     mcell_error(
         "Random sequence number must be in the range 1 to 2^31-1 [2147483647]");
-  rng_init(world->rng, world->seed_seq);
+  rng_init_stream(world->rng, world->seed_seq, RNG_STREAM_GLOBAL, 0);
   if (world->notify->progress_report != NOTIFY_NONE)
     mcell_log("MCell[%d]: random sequence %d", world->procnum, world->seed_seq);
 
@@ -806,7 +807,7 @@ int load_checkpoint(struct volume *world) {
     world->chkpt_seq_num = 1;
   } else {
     mcell_log("Reading from checkpoint file '%s'.", world->chkpt_infile);
-    if (read_chkpt(world, chkpt_infs)) {
+    if (read_chkpt(world, chkpt_infs, world->chkpt_infile)) {
       mcell_error_nodie("Failed to read checkpoint file '%s'.",
                         world->chkpt_infile);
       fclose(chkpt_infs);
@@ -1267,6 +1268,9 @@ static struct storage *create_storage(struct volume *world, int nsubvols) {
   shared_mem =
       CHECKED_MALLOC_STRUCT(struct storage, "memory storage partition");
   memset(shared_mem, 0, sizeof(struct storage));
+#ifdef MCELL_WORK_COUNTERS
+  shared_mem->work = work_counters_create();
+#endif
 
   if (world->mem_part_pool != 0)
     nsubvols = world->mem_part_pool;
@@ -1504,9 +1508,13 @@ int init_partitions(struct volume *world) {
         int h = k + (world->nz_parts - 1) * (j + (world->ny_parts - 1) * i);
         struct subvolume *sv = &(world->subvol[h]);
         sv->wall_head = NULL;
+        sv->walls = NULL;
+        sv->n_walls = 0;
         memset(&sv->mol_by_species, 0, sizeof(struct pointer_hash));
         sv->species_head = NULL;
         sv->mol_count = 0;
+        sv->use_species_arrays = (byte)world->use_species_arrays;
+        sv->nbr_table = NULL;
 
         sv->llf.x = bisect_near(world->x_fineparts, world->n_fineparts,
                                 world->x_partitions[i]);
@@ -2452,6 +2460,7 @@ int init_wall_regions(double length_unit, struct ccn_clamp_data *clamp_list,
                   temp->n_sides = 0;
                   temp->side_idx = NULL;
                   temp->cum_area = NULL;
+                  temp->side_alias = NULL;
                   ccd->next_obj = temp;
                   ccd = temp;
                 }
@@ -2504,6 +2513,12 @@ int init_wall_regions(double length_unit, struct ccn_clamp_data *clamp_list,
         for (j = 1; j < ccd->n_sides; j++)
           ccd->cum_area[j] += ccd->cum_area[j - 1];
 
+        alias_table_destroy(ccd->side_alias);
+        ccd->side_alias = alias_table_create(ccd->cum_area, ccd->n_sides);
+        if (ccd->side_alias == NULL)
+          mcell_allocfailed("Failed to allocate concentration clamp wall "
+                            "sampling table.");
+
         ccd->scaling_factor =
             ccd->cum_area[ccd->n_sides - 1] * length_unit *
             length_unit * length_unit /
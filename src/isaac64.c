@@ -92,6 +92,52 @@ void isaac64_generate(struct isaac64_state *rng) {
   ++rng->rngblocks;
 }
 
+/*
+------------------------------------------------------------------------------
+Bulk draws.  These return exactly the words that n successive calls to
+isaac64_uint32/isaac64_dbl32 would: each block is consumed from the top of
+randrsl downward, and a new block is generated only when the current one is
+exhausted and another word is needed.  Copying whole runs out of the block
+keeps the inner loops free of the per-draw refill test so that the compiler
+can vectorize the reversal and the integer to double conversion.
+------------------------------------------------------------------------------
+*/
+void isaac64_fill_uint32(struct isaac64_state *rng, ub4 *out, unsigned int n) {
+  while (n > 0) {
+    if (rng->randcnt == 0) {
+      isaac64_generate(rng);
+      rng->randcnt = RANDMAX;
+    }
+
+    unsigned int run = (n < rng->randcnt) ? n : rng->randcnt;
+    const ub4 *src = ((const ub4 *)(rng->randrsl)) + (rng->randcnt - run);
+    for (unsigned int i = 0; i < run; ++i)
+      out[i] = src[run - 1 - i];
+
+    rng->randcnt -= run;
+    out += run;
+    n -= run;
+  }
+}
+
+void isaac64_fill_dbl32(struct isaac64_state *rng, double *out, unsigned int n) {
+  while (n > 0) {
+    if (rng->randcnt == 0) {
+      isaac64_generate(rng);
+      rng->randcnt = RANDMAX;
+    }
+
+    unsigned int run = (n < rng->randcnt) ? n : rng->randcnt;
+    const ub4 *src = ((const ub4 *)(rng->randrsl)) + (rng->randcnt - run);
+    for (unsigned int i = 0; i < run; ++i)
+      out[i] = DBL32 * src[run - 1 - i];
+
+    rng->randcnt -= run;
+    out += run;
+    n -= run;
+  }
+}
+
 void isaac64_init(struct isaac64_state *rng, ub4 seed) {
   ub8 *r, *m;
   ub8 a, b, c, d, e, f, g, h;
@@ -62,6 +62,10 @@ void isaac64_init(struct isaac64_state *rng, ub4 seed);
 
 void isaac64_generate(struct isaac64_state *rng);
 
+void isaac64_fill_uint32(struct isaac64_state *rng, ub4 *out, unsigned int n);
+
+void isaac64_fill_dbl32(struct isaac64_state *rng, double *out, unsigned int n);
+
 /*
 ------------------------------------------------------------------------------
 Macros to get individual random numbers
@@ -1,5 +1,13 @@
+#include <limits.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "mcell_structs.h"
 #include "mcell_misc.h"
@@ -11,6 +19,20 @@
 #include "mcell_viz.h"
 #include "mcell_surfclass.h"
 #include "mcell_run.h"
+#include "chkpt.h"
+#include "logging.h"
+#include "mcell3_world_converter.h"
+#include "grid_util.h"
+#include "init.h"
+#include "mem_util.h"
+#include "phase_profile.h"
+#include "rng.h"
+#include "sym_table.h"
+#include "vol_util.h"
+#include "viz_output.h"
+#include "wall_util.h"
+#include "work_counters.h"
+#include "test_api.h"
 
 #define CHECKED_CALL_EXIT(function, error_message)                             \
   {                                                                            \
@@ -20,7 +42,1840 @@
     }                                                                          \
   }
 
-int main(void) {
+#define CHKPT_TEST_FILE "chkpt_round_trip"
+/* more than two chunks of the chunked molecule section */
+#define CHKPT_FORMAT_TEST_MOLS 150000
+#define RATE_CHANGE_TEST_FILE "rate_changes.txt"
+#define LAYOUT_CACHE_TEST_PREFIX "./viz_layout/complexes"
+#define PROFILE_TEST_DIR "./profile_test"
+#define PROFILE_TEST_INTERVAL 20
+#define MDL_PARSE_TEST_FILE "parse_benchmark.mdl"
+
+/* Sum of x + 2y + 3z over the surface molecules of the surface trajectory
+ * test after 100 iterations, as given by traverse_surface and the reflectors
+ * computed in ray_trace_2D before the per-wall edge records */
+#define SURFACE_TRAJECTORY_N_MOLS 500
+#define SURFACE_TRAJECTORY_SUM 3207.56716339078
+
+/* A molecule of a checkpoint round trip test, without its id, which is not
+ * kept across a restart */
+struct chkpt_test_mol {
+  char const *species;
+  struct vector3 pos;
+  double birthday;
+};
+
+/***************************************************************************
+create_chkpt_test_world:
+  Set up a closed box with molecules of V turning into W, which creates,
+  removes and keeps molecules between checkpoints.
+
+  In: chkpt_infile: checkpoint to restart from, or NULL to release molecules
+      n_mols: number of V to release
+  Out: The initialized simulation.  Exits on failure.
+***************************************************************************/
+static struct volume *create_chkpt_test_world(char const *chkpt_infile,
+                                              int n_mols) {
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the checkpoint test state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, 100),
+                    "Failed to set iterations");
+  mcell_silence_notifications(state);
+  if (chkpt_infile != NULL) {
+    state->chkpt_infile = strdup(chkpt_infile);
+    state->chkpt_init = 0;
+    state->chkpt_flag = 1;
+  }
+
+  struct mcell_species_spec molV = { "V", 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+  mcell_symbol *molV_ptr;
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molV, &molV_ptr),
+                    "Failed to create species V");
+  struct mcell_species_spec molW = { "W", 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+  mcell_symbol *molW_ptr;
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molW, &molW_ptr),
+                    "Failed to create species W");
+
+  /* mdl equivalent: V -> W [1e4] */
+  struct mcell_species *reactants =
+      mcell_add_to_species_list(molV_ptr, false, 0, NULL);
+  struct mcell_species *products =
+      mcell_add_to_species_list(molW_ptr, false, 0, NULL);
+  struct mcell_species *surfs = mcell_add_to_species_list(NULL, false, 0, NULL);
+  struct reaction_arrow arrow = { REGULAR_ARROW, { NULL, NULL, 0, 0 } };
+  struct reaction_rates rates =
+      mcell_create_reaction_rates(RATE_CONSTANT, 1e4, RATE_UNSET, 0.0);
+  if (mcell_add_reaction(state->notify, &state->r_step_release,
+                         state->rxn_sym_table, state->radial_subdivisions,
+                         state->vacancy_search_dist2, reactants, &arrow, surfs,
+                         products, NULL, &rates, NULL, NULL) == MCELL_FAIL) {
+    mcell_print("Failed to create reaction V -> W");
+    exit(1);
+  }
+  mcell_delete_species_list(reactants);
+  mcell_delete_species_list(products);
+  mcell_delete_species_list(surfs);
+
+  struct object *world_object = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "world", &world_object),
+                    "could not create meta object");
+
+  struct vertex_list *verts = mcell_add_to_vertex_list(0.1, 0.1, -0.1, NULL);
+  verts = mcell_add_to_vertex_list(0.1, -0.1, -0.1, verts);
+  verts = mcell_add_to_vertex_list(-0.1, -0.1, -0.1, verts);
+  verts = mcell_add_to_vertex_list(-0.1, 0.1, -0.1, verts);
+  verts = mcell_add_to_vertex_list(0.1, 0.1, 0.1, verts);
+  verts = mcell_add_to_vertex_list(0.1, -0.1, 0.1, verts);
+  verts = mcell_add_to_vertex_list(-0.1, -0.1, 0.1, verts);
+  verts = mcell_add_to_vertex_list(-0.1, 0.1, 0.1, verts);
+
+  struct element_connection_list *elems =
+      mcell_add_to_connection_list(1, 2, 3, NULL);
+  elems = mcell_add_to_connection_list(7, 6, 5, elems);
+  elems = mcell_add_to_connection_list(0, 4, 5, elems);
+  elems = mcell_add_to_connection_list(1, 5, 6, elems);
+  elems = mcell_add_to_connection_list(6, 7, 3, elems);
+  elems = mcell_add_to_connection_list(0, 3, 7, elems);
+  elems = mcell_add_to_connection_list(0, 1, 3, elems);
+  elems = mcell_add_to_connection_list(4, 7, 5, elems);
+  elems = mcell_add_to_connection_list(1, 0, 5, elems);
+  elems = mcell_add_to_connection_list(2, 1, 6, elems);
+  elems = mcell_add_to_connection_list(2, 6, 3, elems);
+  elems = mcell_add_to_connection_list(4, 0, 7, elems);
+
+  struct poly_object polygon = { "box", verts, 8, elems, 12 };
+  struct object *new_mesh = NULL;
+  CHECKED_CALL_EXIT(
+      mcell_create_poly_object(state, world_object, &polygon, &new_mesh),
+      "could not create polygon_object")
+
+  /* the release site keeps a pointer to its location */
+  static struct vector3 position = { 0.0, 0.0, 0.0 };
+  struct vector3 diameter = { 0.05, 0.05, 0.05 };
+  struct object *V_releaser = NULL;
+  struct mcell_species *V = mcell_add_to_species_list(molV_ptr, false, 0, NULL);
+  CHECKED_CALL_EXIT(mcell_create_geometrical_release_site(
+                        state, world_object, "V_releaser", SHAPE_SPHERICAL,
+                        &position, &diameter, V, n_mols, 0, 1, NULL,
+                        &V_releaser),
+                    "could not create V_releaser");
+  mcell_delete_species_list(V);
+
+  CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                    "An error occured during simulation creation.");
+  CHECKED_CALL_EXIT(
+      mcell_init_read_checkpoint(state),
+      "An error occured during initialization and reading of checkpoint.");
+  CHECKED_CALL_EXIT(mcell_init_output(state),
+                    "An error occured during setting up of output.");
+  return state;
+}
+
+static int compare_chkpt_test_mols(void const *a, void const *b) {
+  struct chkpt_test_mol const *ma = (struct chkpt_test_mol const *)a;
+  struct chkpt_test_mol const *mb = (struct chkpt_test_mol const *)b;
+  int c = strcmp(ma->species, mb->species);
+  if (c != 0)
+    return c;
+  if (ma->pos.x != mb->pos.x)
+    return (ma->pos.x < mb->pos.x) ? -1 : 1;
+  if (ma->pos.y != mb->pos.y)
+    return (ma->pos.y < mb->pos.y) ? -1 : 1;
+  if (ma->pos.z != mb->pos.z)
+    return (ma->pos.z < mb->pos.z) ? -1 : 1;
+  if (ma->birthday != mb->birthday)
+    return (ma->birthday < mb->birthday) ? -1 : 1;
+  return 0;
+}
+
+/***************************************************************************
+snapshot_chkpt_test_mols:
+  In: state: simulation
+      n_mols: where to store the number of molecules
+  Out: The malloc'd molecules of the scheduler, sorted.
+***************************************************************************/
+static struct chkpt_test_mol *snapshot_chkpt_test_mols(struct volume *state,
+                                                       int *n_mols) {
+  int n = (int)count_items_in_scheduler(state->storage_head);
+  struct chkpt_test_mol *mols =
+      malloc((n > 0 ? n : 1) * sizeof(struct chkpt_test_mol));
+  if (mols == NULL) {
+    mcell_print("Out of memory in checkpoint test");
+    exit(1);
+  }
+
+  int i_mol = 0;
+  for (struct storage_list *slp = state->storage_head; slp != NULL;
+       slp = slp->next) {
+    for (struct schedule_helper *shp = slp->store->timer; shp != NULL;
+         shp = shp->next_scale) {
+      for (int i = -1; i < shp->buf_len; i++) {
+        for (struct abstract_element *aep = (i < 0) ? shp->current
+                                                    : shp->circ_buf_head[i];
+             aep != NULL; aep = aep->next) {
+          struct volume_molecule *vm = (struct volume_molecule *)aep;
+          if (vm->properties == NULL || i_mol == n)
+            continue;
+          mols[i_mol].species = vm->properties->sym->name;
+          mols[i_mol].pos = vm->pos;
+          mols[i_mol].birthday = vm->birthday;
+          i_mol++;
+        }
+      }
+    }
+  }
+
+  qsort(mols, i_mol, sizeof(struct chkpt_test_mol), compare_chkpt_test_mols);
+  *n_mols = i_mol;
+  return mols;
+}
+
+/***************************************************************************
+check_chkpt_restart:
+  In: chkpt_file: checkpoint to restart from
+      expected, n_expected: molecules when the checkpoint was written
+  Out: 0 if a simulation restarted from chkpt_file has exactly the expected
+       molecules, 1 otherwise.
+***************************************************************************/
+static int check_chkpt_restart(char const *chkpt_file,
+                               struct chkpt_test_mol const *expected,
+                               int n_expected) {
+  struct volume *state = create_chkpt_test_world(chkpt_file, 0);
+  int n_mols;
+  struct chkpt_test_mol *mols = snapshot_chkpt_test_mols(state, &n_mols);
+
+  int failed = (n_mols != n_expected);
+  for (int i = 0; i < n_mols && !failed; i++)
+    failed = (compare_chkpt_test_mols(&mols[i], &expected[i]) != 0);
+  if (failed)
+    mcell_error_nodie("Restarting from %s gives %d molecules instead of the %d "
+                      "checkpointed, or different ones",
+                      chkpt_file, n_mols, n_expected);
+  free(mols);
+  return failed;
+}
+
+/***************************************************************************
+test_chkpt_round_trip:
+  Write a full checkpoint followed by two deltas, restart from them, and
+  check that the restarted simulation has the molecules of the last
+  checkpoint.  With utils_dir, the chain is also compacted into one full
+  checkpoint by compact_checkpoint.py, and restarting from that is checked
+  the same way.  A stale delta past a gap in the numbering must be removed
+  when the full checkpoint replaces it.
+
+  In: utils_dir: directory of compact_checkpoint.py, or NULL
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_chkpt_round_trip(char const *utils_dir) {
+  /* Deltas left over by an earlier run, with a gap */
+  char const *stale[] = { CHKPT_TEST_FILE ".d1", CHKPT_TEST_FILE ".d5" };
+  for (int i = 0; i < 2; i++) {
+    FILE *f = fopen(stale[i], "wb");
+    if (f != NULL)
+      fclose(f);
+  }
+
+  struct volume *state = create_chkpt_test_world(NULL, 2000);
+  state->chkpt_delta_interval = 2;
+  int restarted_from_checkpoint = 0;
+  for (int i_chkpt = 0; i_chkpt < 3; i_chkpt++) {
+    for (int i = 0; i < 5; i++)
+      CHECKED_CALL_EXIT(
+          mcell_run_iteration(state, 10, &restarted_from_checkpoint),
+          "Error running checkpoint test simulation.");
+    if (create_chkpt(state, CHKPT_TEST_FILE) || finish_chkpt_writer(state)) {
+      mcell_error_nodie("Failed to write checkpoint %d", i_chkpt);
+      return 1;
+    }
+  }
+
+  struct stat buf;
+  if (stat(CHKPT_TEST_FILE ".d5", &buf) == 0) {
+    mcell_print("Stale checkpoint delta was not removed with its base");
+    return 1;
+  }
+  if (stat(CHKPT_TEST_FILE ".d2", &buf) != 0) {
+    mcell_print("Checkpoint test did not write deltas");
+    return 1;
+  }
+
+  int n_expected;
+  struct chkpt_test_mol *expected = snapshot_chkpt_test_mols(state, &n_expected);
+  int failed = check_chkpt_restart(CHKPT_TEST_FILE, expected, n_expected);
+
+  if (!failed && utils_dir != NULL) {
+    char *command = CHECKED_SPRINTF(
+        "python3 \"%s/compact_checkpoint.py\" -o %s.compact %s", utils_dir,
+        CHKPT_TEST_FILE, CHKPT_TEST_FILE);
+    if (system(command) != 0) {
+      mcell_error_nodie("Failed to run: %s", command);
+      failed = 1;
+    } else
+      failed = check_chkpt_restart(CHKPT_TEST_FILE ".compact", expected,
+                                   n_expected);
+    free(command);
+  }
+
+  free(expected);
+  return failed;
+}
+
+/***************************************************************************
+test_chkpt_formats:
+  Write checkpoints of more molecules than fit into two chunks in the
+  classic format, which is the one of checkpoints from before the chunked
+  molecule section, and streamed in chunks, raw and compressed.  The
+  compressed checkpoint is written by the background writer while the
+  simulation goes on.  Restarting from each of them, with several threads
+  decoding the chunks, must give the molecules at the time it was written.
+  The compressed checkpoint must be smaller than the raw one.
+
+  In: Nothing
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_chkpt_formats(void) {
+  char const *files[] = { CHKPT_TEST_FILE ".classic", CHKPT_TEST_FILE ".raw",
+                          CHKPT_TEST_FILE ".zlib" };
+  enum chkpt_format_t formats[] = { CHKPT_FORMAT_CLASSIC, CHKPT_FORMAT_STREAM,
+                                    CHKPT_FORMAT_STREAM_COMPRESSED };
+#ifdef MCELL_WITH_ZLIB
+  int const n_formats = 3;
+#else
+  int const n_formats = 2;
+#endif
+
+  struct volume *state = create_chkpt_test_world(NULL, CHKPT_FORMAT_TEST_MOLS);
+  int restarted_from_checkpoint = 0;
+  for (int i = 0; i < 2; i++)
+    CHECKED_CALL_EXIT(
+        mcell_run_iteration(state, 10, &restarted_from_checkpoint),
+        "Error running checkpoint format test simulation.");
+
+  int n_expected;
+  struct chkpt_test_mol *expected = snapshot_chkpt_test_mols(state, &n_expected);
+  for (int i = 0; i < n_formats; i++) {
+    state->chkpt_format = formats[i];
+    if (create_chkpt(state, files[i])) {
+      mcell_error_nodie("Failed to write checkpoint %s", files[i]);
+      return 1;
+    }
+  }
+
+  /* the last checkpoint is still being written */
+  for (int i = 0; i < 2; i++)
+    CHECKED_CALL_EXIT(
+        mcell_run_iteration(state, 10, &restarted_from_checkpoint),
+        "Error running checkpoint format test simulation.");
+  if (finish_chkpt_writer(state)) {
+    mcell_error_nodie("Failed to write checkpoint %s", files[n_formats - 1]);
+    return 1;
+  }
+
+#ifdef _OPENMP
+  int const max_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif
+  int failed = 0;
+  for (int i = 0; i < n_formats && !failed; i++)
+    failed = check_chkpt_restart(files[i], expected, n_expected);
+#ifdef _OPENMP
+  omp_set_num_threads(max_threads);
+#endif
+
+#ifdef MCELL_WITH_ZLIB
+  struct stat raw_buf, zlib_buf;
+  if (!failed && (stat(files[1], &raw_buf) != 0 ||
+                  stat(files[2], &zlib_buf) != 0 ||
+                  zlib_buf.st_size >= raw_buf.st_size)) {
+    mcell_error_nodie("The compressed checkpoint is no smaller than the raw "
+                      "one");
+    failed = 1;
+  }
+#endif
+
+  free(expected);
+  return failed;
+}
+
+/***************************************************************************
+create_rate_change_world:
+  Set up A -> B with the rate read from RATE_CHANGE_TEST_FILE and, with a
+  nonzero back_rate, B -> A with a constant rate.
+
+  In: n_iterations: number of iterations
+      back_rate: rate constant of B -> A, 0 for none
+      molB_ptr: set to the symbol of B
+  Out: The initialized simulation with 1000 A.  Exits on failure.
+***************************************************************************/
+static struct volume *create_rate_change_world(int n_iterations,
+                                               double back_rate,
+                                               mcell_symbol **molB_ptr) {
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the rate change test state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, n_iterations),
+                    "Failed to set iterations");
+  mcell_silence_notifications(state);
+
+  struct mcell_species_spec molA = { "A", 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+  struct mcell_species_spec molB = { "B", 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+  mcell_symbol *molA_ptr;
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molA, &molA_ptr),
+                    "Failed to create species A");
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molB, molB_ptr),
+                    "Failed to create species B");
+
+  /* mdl equivalent: A -> B ["rate_changes.txt"]; the reaction takes over
+   * both copies of the file name */
+  struct mcell_species *reactants =
+      mcell_add_to_species_list(molA_ptr, false, 0, NULL);
+  struct mcell_species *products =
+      mcell_add_to_species_list(*molB_ptr, false, 0, NULL);
+  struct mcell_species *surfs = mcell_add_to_species_list(NULL, false, 0, NULL);
+  struct reaction_arrow arrow = { REGULAR_ARROW, { NULL, NULL, 0, 0 } };
+  struct reaction_rates rates =
+      mcell_create_reaction_rates(RATE_FILE, 0.0, RATE_UNSET, 0.0);
+  rates.forward_rate.v.rate_file = strdup(RATE_CHANGE_TEST_FILE);
+  if (mcell_add_reaction(state->notify, &state->r_step_release,
+                         state->rxn_sym_table, state->radial_subdivisions,
+                         state->vacancy_search_dist2, reactants, &arrow, surfs,
+                         products, NULL, &rates,
+                         strdup(RATE_CHANGE_TEST_FILE), NULL) == MCELL_FAIL) {
+    mcell_print("Failed to create reaction A -> B");
+    exit(1);
+  }
+  mcell_delete_species_list(reactants);
+  mcell_delete_species_list(products);
+  mcell_delete_species_list(surfs);
+
+  /* mdl equivalent: B -> A [back_rate] */
+  if (back_rate > 0.0) {
+    reactants = mcell_add_to_species_list(*molB_ptr, false, 0, NULL);
+    products = mcell_add_to_species_list(molA_ptr, false, 0, NULL);
+    surfs = mcell_add_to_species_list(NULL, false, 0, NULL);
+    rates = mcell_create_reaction_rates(RATE_CONSTANT, back_rate, RATE_UNSET,
+                                        0.0);
+    if (mcell_add_reaction(state->notify, &state->r_step_release,
+                           state->rxn_sym_table, state->radial_subdivisions,
+                           state->vacancy_search_dist2, reactants, &arrow,
+                           surfs, products, NULL, &rates, NULL,
+                           NULL) == MCELL_FAIL) {
+      mcell_print("Failed to create reaction B -> A");
+      exit(1);
+    }
+    mcell_delete_species_list(reactants);
+    mcell_delete_species_list(products);
+    mcell_delete_species_list(surfs);
+  }
+
+  struct object *world_object = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "world", &world_object),
+                    "could not create meta object");
+
+  /* the release site keeps a pointer to its location */
+  static struct vector3 position = { 0.0, 0.0, 0.0 };
+  struct vector3 diameter = { 0.1, 0.1, 0.1 };
+  struct object *A_releaser = NULL;
+  struct mcell_species *A = mcell_add_to_species_list(molA_ptr, false, 0, NULL);
+  CHECKED_CALL_EXIT(mcell_create_geometrical_release_site(
+                        state, world_object, "A_releaser", SHAPE_SPHERICAL,
+                        &position, &diameter, A, 1000, 0, 1, NULL, &A_releaser),
+                    "could not create A_releaser");
+  mcell_delete_species_list(A);
+
+  CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                    "An error occured during simulation creation.");
+  CHECKED_CALL_EXIT(
+      mcell_init_read_checkpoint(state),
+      "An error occured during initialization and reading of checkpoint.");
+  CHECKED_CALL_EXIT(mcell_init_output(state),
+                    "An error occured during setting up of output.");
+  return state;
+}
+
+/***************************************************************************
+test_rate_changes:
+  A rate read from a file must change at its time, also in the middle of an
+  iteration: A -> B is only switched on between 10.5 and 10.9 us, which is
+  long enough for most A to react, but never at the start of an iteration.
+  Then a stimulus train which switches the rate every 2.5 iterations over
+  1000 iterations is timed.
+
+  In: Nothing
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_rate_changes(void) {
+  FILE *f = fopen(RATE_CHANGE_TEST_FILE, "w");
+  if (f == NULL) {
+    mcell_print("Failed to write the rate change test file");
+    return 1;
+  }
+  fprintf(f, "0 0\n10.5e-6 1e8\n10.9e-6 0\n");
+  fclose(f);
+
+  mcell_symbol *molB_ptr;
+  struct volume *state = create_rate_change_world(20, 0.0, &molB_ptr);
+  int restarted_from_checkpoint = 0;
+  for (int i = 0; i < 20; i++)
+    CHECKED_CALL_EXIT(
+        mcell_run_iteration(state, 10, &restarted_from_checkpoint),
+        "Error running rate change test simulation.");
+  u_int n_B = ((struct species *)molB_ptr->value)->population;
+  if (n_B < 500) {
+    mcell_error_nodie("Only %u of 1000 A reacted while the rate was switched "
+                      "on in the middle of an iteration", n_B);
+    return 1;
+  }
+
+  f = fopen(RATE_CHANGE_TEST_FILE, "w");
+  if (f == NULL) {
+    mcell_print("Failed to write the rate change test file");
+    return 1;
+  }
+  fprintf(f, "0 0\n");
+  for (int k = 0; k < 400; k++)
+    fprintf(f, "%g %g\n", (2.5 * k + 0.5) * 1e-6, (k % 2 == 0) ? 1e6 : 0.0);
+  fclose(f);
+
+  state = create_rate_change_world(1000, 1e5, &molB_ptr);
+  clock_t start = clock();
+  for (int i = 0; i < 1000; i++)
+    CHECKED_CALL_EXIT(
+        mcell_run_iteration(state, 100, &restarted_from_checkpoint),
+        "Error running rate change benchmark simulation.");
+  mcell_log("Rate change benchmark: 1000 iterations with 400 rate changes "
+            "in %.3f s",
+            (double)(clock() - start) / CLOCKS_PER_SEC);
+  return 0;
+}
+
+/***************************************************************************
+test_trimol_benchmark:
+  Time 100 iterations of A + B + C -> D with 3000 molecules of each
+  reactant, where every reactant looks for its collision partners through
+  the neighbor tables of its subvolume.
+
+  In: Nothing
+  Out: 0 on success, 1 if no D was formed
+***************************************************************************/
+static int test_trimol_benchmark(void) {
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the trimolecular benchmark state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, 100),
+                    "Failed to set iterations");
+  mcell_silence_notifications(state);
+
+  char *names[4] = { "A", "B", "C", "D" };
+  mcell_symbol *mol_ptrs[4];
+  for (int i = 0; i < 4; i++) {
+    struct mcell_species_spec mol = { names[i], 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+    if (mcell_create_species(state, &mol, &mol_ptrs[i])) {
+      mcell_error_nodie("Failed to create species %s", names[i]);
+      exit(1);
+    }
+  }
+
+  /* mdl equivalent: A + B + C -> D [1e20] */
+  struct mcell_species *reactants =
+      mcell_add_to_species_list(mol_ptrs[0], false, 0, NULL);
+  reactants = mcell_add_to_species_list(mol_ptrs[1], false, 0, reactants);
+  reactants = mcell_add_to_species_list(mol_ptrs[2], false, 0, reactants);
+  struct mcell_species *products =
+      mcell_add_to_species_list(mol_ptrs[3], false, 0, NULL);
+  struct mcell_species *surfs = mcell_add_to_species_list(NULL, false, 0, NULL);
+  struct reaction_arrow arrow = { REGULAR_ARROW, { NULL, NULL, 0, 0 } };
+  struct reaction_rates rates =
+      mcell_create_reaction_rates(RATE_CONSTANT, 1e20, RATE_UNSET, 0.0);
+  if (mcell_add_reaction(state->notify, &state->r_step_release,
+                         state->rxn_sym_table, state->radial_subdivisions,
+                         state->vacancy_search_dist2, reactants, &arrow, surfs,
+                         products, NULL, &rates, NULL, NULL) == MCELL_FAIL) {
+    mcell_print("Failed to create reaction A + B + C -> D");
+    exit(1);
+  }
+  mcell_delete_species_list(reactants);
+  mcell_delete_species_list(products);
+  mcell_delete_species_list(surfs);
+
+  struct object *world_object = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "world", &world_object),
+                    "could not create meta object");
+
+  /* the release sites keep a pointer to their location */
+  static struct vector3 position = { 0.0, 0.0, 0.0 };
+  struct vector3 diameter = { 0.2, 0.2, 0.2 };
+  for (int i = 0; i < 3; i++) {
+    char *site_name = CHECKED_SPRINTF("%s_releaser", names[i]);
+    struct object *releaser = NULL;
+    struct mcell_species *mol =
+        mcell_add_to_species_list(mol_ptrs[i], false, 0, NULL);
+    CHECKED_CALL_EXIT(mcell_create_geometrical_release_site(
+                          state, world_object, site_name, SHAPE_SPHERICAL,
+                          &position, &diameter, mol, 3000, 0, 1, NULL,
+                          &releaser),
+                      "could not create a trimolecular benchmark release site");
+    mcell_delete_species_list(mol);
+    free(site_name);
+  }
+
+  CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                    "An error occured during simulation creation.");
+  CHECKED_CALL_EXIT(
+      mcell_init_read_checkpoint(state),
+      "An error occured during initialization and reading of checkpoint.");
+  CHECKED_CALL_EXIT(mcell_init_output(state),
+                    "An error occured during setting up of output.");
+
+  int restarted_from_checkpoint = 0;
+  clock_t start = clock();
+  for (int i = 0; i < 100; i++)
+    CHECKED_CALL_EXIT(
+        mcell_run_iteration(state, 100, &restarted_from_checkpoint),
+        "Error running the trimolecular benchmark simulation.");
+  u_int n_D = ((struct species *)mol_ptrs[3]->value)->population;
+  mcell_log("Trimolecular benchmark: 100 iterations, %u D formed, in %.3f s",
+            n_D, (double)(clock() - start) / CLOCKS_PER_SEC);
+  return (n_D == 0);
+}
+
+/***************************************************************************
+create_layout_benchmark_world:
+  Set up A + B -> C with 5000 molecules of each reactant in a world split
+  into 20x20x20 subvolumes, so that most collision partners are found in
+  neighbor subvolumes.
+
+  In: use_species_arrays: keep contiguous per-species molecule arrays, as
+                          with -species_arrays
+      molC_ptr: set to the symbol of C
+  Out: The initialized simulation.  Exits on failure.
+***************************************************************************/
+static struct volume *create_layout_benchmark_world(int use_species_arrays,
+                                                    mcell_symbol **molC_ptr) {
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the layout benchmark state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, 50),
+                    "Failed to set iterations");
+  mcell_silence_notifications(state);
+  state->use_species_arrays = use_species_arrays;
+
+  struct num_expr_list_head list = { NULL, NULL, 0, 1 };
+  mcell_generate_range(&list, -0.5, 0.5, 0.05);
+  list.shared = 1;
+  CHECKED_CALL_EXIT(mcell_set_partition(state, X_PARTS, &list),
+                    "Failed to set X partition");
+  CHECKED_CALL_EXIT(mcell_set_partition(state, Y_PARTS, &list),
+                    "Failed to set Y partition");
+  CHECKED_CALL_EXIT(mcell_set_partition(state, Z_PARTS, &list),
+                    "Failed to set Z partition");
+
+  char *names[3] = { "A", "B", "C" };
+  mcell_symbol *mol_ptrs[3];
+  for (int i = 0; i < 3; i++) {
+    struct mcell_species_spec mol = { names[i], 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+    if (mcell_create_species(state, &mol, &mol_ptrs[i])) {
+      mcell_error_nodie("Failed to create species %s", names[i]);
+      exit(1);
+    }
+  }
+  *molC_ptr = mol_ptrs[2];
+
+  /* mdl equivalent: A + B -> C [1e7] */
+  struct mcell_species *reactants =
+      mcell_add_to_species_list(mol_ptrs[0], false, 0, NULL);
+  reactants = mcell_add_to_species_list(mol_ptrs[1], false, 0, reactants);
+  struct mcell_species *products =
+      mcell_add_to_species_list(mol_ptrs[2], false, 0, NULL);
+  struct mcell_species *surfs = mcell_add_to_species_list(NULL, false, 0, NULL);
+  struct reaction_arrow arrow = { REGULAR_ARROW, { NULL, NULL, 0, 0 } };
+  struct reaction_rates rates =
+      mcell_create_reaction_rates(RATE_CONSTANT, 1e7, RATE_UNSET, 0.0);
+  if (mcell_add_reaction(state->notify, &state->r_step_release,
+                         state->rxn_sym_table, state->radial_subdivisions,
+                         state->vacancy_search_dist2, reactants, &arrow, surfs,
+                         products, NULL, &rates, NULL, NULL) == MCELL_FAIL) {
+    mcell_print("Failed to create reaction A + B -> C");
+    exit(1);
+  }
+  mcell_delete_species_list(reactants);
+  mcell_delete_species_list(products);
+  mcell_delete_species_list(surfs);
+
+  struct object *world_object = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "world", &world_object),
+                    "could not create meta object");
+
+  /* the release sites keep a pointer to their location */
+  static struct vector3 position = { 0.0, 0.0, 0.0 };
+  struct vector3 diameter = { 0.8, 0.8, 0.8 };
+  for (int i = 0; i < 2; i++) {
+    char *site_name = CHECKED_SPRINTF("%s_releaser", names[i]);
+    struct object *releaser = NULL;
+    struct mcell_species *mol =
+        mcell_add_to_species_list(mol_ptrs[i], false, 0, NULL);
+    CHECKED_CALL_EXIT(mcell_create_geometrical_release_site(
+                          state, world_object, site_name, SHAPE_SPHERICAL,
+                          &position, &diameter, mol, 5000, 0, 1, NULL,
+                          &releaser),
+                      "could not create a layout benchmark release site");
+    mcell_delete_species_list(mol);
+    free(site_name);
+  }
+
+  CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                    "An error occured during simulation creation.");
+  CHECKED_CALL_EXIT(
+      mcell_init_read_checkpoint(state),
+      "An error occured during initialization and reading of checkpoint.");
+  CHECKED_CALL_EXIT(mcell_init_output(state),
+                    "An error occured during setting up of output.");
+  return state;
+}
+
+/***************************************************************************
+test_species_arrays_benchmark:
+  Time 50 iterations of diffusion and A + B -> C collisions with the
+  linked per-species lists and with the contiguous species arrays.  Both
+  layouts run the same world from the same seed.
+
+  In: Nothing
+  Out: 0 on success, 1 if either layout formed no C
+***************************************************************************/
+static int test_species_arrays_benchmark(void) {
+  double seconds[2];
+  u_int n_C[2];
+  for (int use_species_arrays = 0; use_species_arrays < 2;
+       use_species_arrays++) {
+    mcell_symbol *molC_ptr;
+    struct volume *state =
+        create_layout_benchmark_world(use_species_arrays, &molC_ptr);
+    int restarted_from_checkpoint = 0;
+    clock_t start = clock();
+    for (int i = 0; i < 50; i++)
+      CHECKED_CALL_EXIT(
+          mcell_run_iteration(state, 100, &restarted_from_checkpoint),
+          "Error running the layout benchmark simulation.");
+    seconds[use_species_arrays] = (double)(clock() - start) / CLOCKS_PER_SEC;
+    n_C[use_species_arrays] = ((struct species *)molC_ptr->value)->population;
+  }
+
+  mcell_log("Species array benchmark: 50 iterations with linked lists in "
+            "%.3f s (%u C formed), with species arrays in %.3f s (%u C "
+            "formed)",
+            seconds[0], n_C[0], seconds[1], n_C[1]);
+  if (n_C[0] == 0 || n_C[1] == 0) {
+    mcell_error_nodie("No C formed in the species array benchmark");
+    return 1;
+  }
+  return 0;
+}
+
+/***************************************************************************
+icosphere_midpoint:
+  Find or add the vertex halfway between two vertices of an icosphere,
+  projected onto the unit sphere.  Midpoints are looked up in an
+  open-addressed table of edges, so that the faces on both sides of an edge
+  share the very same vertex.
+
+  In: a, b: indices of the vertices of the edge
+      verts: coordinates of the vertices, 3 per vertex
+      n_verts: number of vertices, updated if a vertex is added
+      keys: table of edges, 0 for free slots
+      mids: index of the midpoint of each edge of the table
+      mask: size of the table minus one (a power of two minus one)
+  Out: Index of the midpoint
+***************************************************************************/
+static int icosphere_midpoint(int a, int b, double *verts, int *n_verts,
+                              unsigned long long *keys, int *mids,
+                              unsigned long mask) {
+  unsigned long long key = (a < b)
+                               ? ((unsigned long long)(a + 1) << 32) | b
+                               : ((unsigned long long)(b + 1) << 32) | a;
+  unsigned long slot = (unsigned long)((key * 0x9E3779B97F4A7C15ULL) >> 32);
+  for (slot &= mask; keys[slot] != 0; slot = (slot + 1) & mask) {
+    if (keys[slot] == key)
+      return mids[slot];
+  }
+
+  double *m = verts + 3 * *n_verts;
+  for (int k = 0; k < 3; k++)
+    m[k] = 0.5 * (verts[3 * a + k] + verts[3 * b + k]);
+  double f = 1.0 / sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+  for (int k = 0; k < 3; k++)
+    m[k] *= f;
+  keys[slot] = key;
+  mids[slot] = *n_verts;
+  return (*n_verts)++;
+}
+
+/***************************************************************************
+create_icosphere_world:
+  Create a world with a single icosphere of radius 0.5 obtained by
+  subdividing the faces of an icosahedron n_subdivisions times.
+
+  In: n_subdivisions: number of times each face is split into four
+      mesh_ptr: set to the icosphere object
+  Out: The world, not initialized yet
+***************************************************************************/
+static struct volume *create_icosphere_world(int n_subdivisions,
+                                             struct object **mesh_ptr) {
+  int max_faces = 20 << (2 * n_subdivisions);
+  int max_verts = max_faces / 2 + 2;
+  double *verts = CHECKED_MALLOC_ARRAY(double, 3 * max_verts, "vertices");
+  int *faces = CHECKED_MALLOC_ARRAY(int, 3 * max_faces, "faces");
+  int *split = CHECKED_MALLOC_ARRAY(int, 3 * max_faces, "faces");
+  unsigned long table_size = 16;
+  while (table_size < 3UL * max_faces)
+    table_size <<= 1;
+  unsigned long long *keys =
+      CHECKED_MALLOC_ARRAY(unsigned long long, table_size, "edges");
+  int *mids = CHECKED_MALLOC_ARRAY(int, table_size, "edge midpoints");
+
+  double t = (1.0 + sqrt(5.0)) / 2.0;
+  double const ico_verts[12][3] = {
+    { -1, t, 0 }, { 1, t, 0 }, { -1, -t, 0 }, { 1, -t, 0 },
+    { 0, -1, t }, { 0, 1, t }, { 0, -1, -t }, { 0, 1, -t },
+    { t, 0, -1 }, { t, 0, 1 }, { -t, 0, -1 }, { -t, 0, 1 }
+  };
+  int const ico_faces[20][3] = {
+    { 0, 11, 5 }, { 0, 5, 1 },  { 0, 1, 7 },   { 0, 7, 10 }, { 0, 10, 11 },
+    { 1, 5, 9 },  { 5, 11, 4 }, { 11, 10, 2 }, { 10, 7, 6 }, { 7, 1, 8 },
+    { 3, 9, 4 },  { 3, 4, 2 },  { 3, 2, 6 },   { 3, 6, 8 },  { 3, 8, 9 },
+    { 4, 9, 5 },  { 2, 4, 11 }, { 6, 2, 10 },  { 8, 6, 7 },  { 9, 8, 1 }
+  };
+  double f = 1.0 / sqrt(1.0 + t * t);
+  for (int i = 0; i < 12; i++) {
+    for (int k = 0; k < 3; k++)
+      verts[3 * i + k] = f * ico_verts[i][k];
+  }
+  memcpy(faces, ico_faces, sizeof(ico_faces));
+  int n_verts = 12;
+  int n_faces = 20;
+
+  for (int level = 0; level < n_subdivisions; level++) {
+    memset(keys, 0, table_size * sizeof(unsigned long long));
+    for (int i = 0; i < n_faces; i++) {
+      int *v = faces + 3 * i;
+      int m[3];
+      for (int k = 0; k < 3; k++)
+        m[k] = icosphere_midpoint(v[k], v[(k + 1) % 3], verts, &n_verts, keys,
+                                  mids, table_size - 1);
+      int const children[4][3] = { { v[0], m[0], m[2] },
+                                   { v[1], m[1], m[0] },
+                                   { v[2], m[2], m[1] },
+                                   { m[0], m[1], m[2] } };
+      memcpy(split + 12 * i, children, sizeof(children));
+    }
+    int *tmp = faces;
+    faces = split;
+    split = tmp;
+    n_faces *= 4;
+  }
+
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the icosphere test state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, 1), "Failed to set iterations");
+  mcell_silence_notifications(state);
+
+  struct object *world_object = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "world", &world_object),
+                    "could not create meta object");
+
+  struct vertex_list *vertex_list = NULL;
+  for (int i = 0; i < n_verts; i++)
+    vertex_list = mcell_add_to_vertex_list(0.5 * verts[3 * i],
+                                           0.5 * verts[3 * i + 1],
+                                           0.5 * verts[3 * i + 2], vertex_list);
+  struct element_connection_list *elems = NULL;
+  for (int i = 0; i < n_faces; i++)
+    elems = mcell_add_to_connection_list(faces[3 * i], faces[3 * i + 1],
+                                         faces[3 * i + 2], elems);
+
+  struct poly_object polygon = { "icosphere", vertex_list, n_verts, elems,
+                                 n_faces };
+  CHECKED_CALL_EXIT(
+      mcell_create_poly_object(state, world_object, &polygon, mesh_ptr),
+      "could not create polygon_object");
+
+  free(verts);
+  free(faces);
+  free(split);
+  free(keys);
+  free(mids);
+  return state;
+}
+
+/***************************************************************************
+test_edge_matching_benchmark:
+  Time the initialization of a world holding a large icosphere, once with
+  the edges matched through the edge table and once by sorting.  Both must
+  close the sphere and join every wall to the same neighbors.
+
+  In: n_subdivisions: number of times the faces of the icosahedron are split
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_edge_matching_benchmark(int n_subdivisions) {
+  int const saved_sort_min_faces = edge_sort_min_faces;
+  struct object *mesh[2];
+  double seconds[2];
+  for (int pass = 0; pass < 2; pass++) {
+    struct volume *state = create_icosphere_world(n_subdivisions, &mesh[pass]);
+    edge_sort_min_faces = (pass == 0) ? INT_MAX : 0;
+    clock_t start = clock();
+    CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                      "An error occured during simulation creation.");
+    seconds[pass] = (double)(clock() - start) / CLOCKS_PER_SEC;
+  }
+  edge_sort_min_faces = saved_sort_min_faces;
+
+  mcell_log("Edge matching benchmark: initialized an icosphere of %d faces "
+            "in %.3f s with the edge table, in %.3f s by sorting",
+            mesh[0]->n_walls, seconds[0], seconds[1]);
+
+  if (mesh[0]->n_walls != mesh[1]->n_walls) {
+    mcell_error_nodie("The icosphere has %d walls with the edge table and %d "
+                      "by sorting",
+                      mesh[0]->n_walls, mesh[1]->n_walls);
+    return 1;
+  }
+  int n_mismatches = 0;
+  for (int n_wall = 0; n_wall < mesh[0]->n_walls; n_wall++) {
+    struct wall *w[2] = { mesh[0]->wall_p[n_wall], mesh[1]->wall_p[n_wall] };
+    for (int i = 0; i < 3; i++) {
+      if (w[0]->nb_walls[i] == NULL || w[1]->nb_walls[i] == NULL ||
+          w[0]->nb_walls[i]->side != w[1]->nb_walls[i]->side)
+        n_mismatches++;
+    }
+  }
+  if (n_mismatches != 0) {
+    mcell_error_nodie("%d edges of the icosphere are open or join different "
+                      "walls with the edge table and by sorting",
+                      n_mismatches);
+    return 1;
+  }
+  return 0;
+}
+
+/***************************************************************************
+read_whole_file:
+  In: file_name: name of the file
+      size: set to the size of the file
+  Out: The contents of the file, or NULL if it could not be read
+***************************************************************************/
+static char *read_whole_file(char const *file_name, long *size) {
+  FILE *f = fopen(file_name, "rb");
+  if (f == NULL)
+    return NULL;
+  fseek(f, 0, SEEK_END);
+  *size = ftell(f);
+  rewind(f);
+  char *data = CHECKED_MALLOC_ARRAY(char, *size + 1, "file contents");
+  if (fread(data, 1, *size, f) != (size_t)*size) {
+    free(data);
+    data = NULL;
+  }
+  fclose(f);
+  return data;
+}
+
+/***************************************************************************
+test_complex_layout_cache:
+  Write two CellBlender frames of more molecules than the complex layout
+  cache holds, each of them standing in for an NFsim complex of its own
+  graph pattern.  The first frame lays out every complex on one thread,
+  the second one on several threads and finds only part of the layouts in
+  the cache.  The cache must stay within COMPLEX_LAYOUT_CACHE_MAX layouts
+  and both frames must be identical.
+
+  In: Nothing
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_complex_layout_cache(void) {
+  int const n_mols = COMPLEX_LAYOUT_CACHE_MAX + 1000;
+
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the layout cache test state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, 3), "Failed to set iterations");
+  mcell_silence_notifications(state);
+
+  struct mcell_species_spec molX = { "X", 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+  mcell_symbol *molX_ptr;
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molX, &molX_ptr),
+                    "Failed to create species X");
+
+  struct object *world_object = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "world", &world_object),
+                    "could not create meta object");
+
+  /* the release site keeps a pointer to its location */
+  static struct vector3 position = { 0.0, 0.0, 0.0 };
+  struct vector3 diameter = { 0.5, 0.5, 0.5 };
+  struct object *releaser = NULL;
+  struct mcell_species *mol = mcell_add_to_species_list(molX_ptr, false, 0, NULL);
+  CHECKED_CALL_EXIT(mcell_create_geometrical_release_site(
+                        state, world_object, "X_releaser", SHAPE_SPHERICAL,
+                        &position, &diameter, mol, n_mols, 0, 1, NULL,
+                        &releaser),
+                    "could not create the layout cache test release site");
+
+  /* frames 1 and 2 are written by hand below */
+  CHECKED_CALL_EXIT(
+      mcell_create_viz_output(state, LAYOUT_CACHE_TEST_PREFIX, mol, 1, 2, 1),
+      "Error setting up the viz output block");
+  mcell_delete_species_list(mol);
+
+  CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                    "An error occured during simulation creation.");
+  CHECKED_CALL_EXIT(
+      mcell_init_read_checkpoint(state),
+      "An error occured during initialization and reading of checkpoint.");
+  CHECKED_CALL_EXIT(mcell_init_output(state),
+                    "An error occured during setting up of output.");
+
+  int restarted_from_checkpoint = 0;
+  CHECKED_CALL_EXIT(mcell_run_iteration(state, 100, &restarted_from_checkpoint),
+                    "Error running the layout cache test simulation.");
+
+  /* Turn the molecules into complexes of two bound molecules, each with a
+     pattern of its own */
+  struct species *spec = (struct species *)molX_ptr->value;
+  spec->flags |= EXTERNAL_SPECIES;
+  struct graph_data *graphs =
+      CHECKED_MALLOC_ARRAY(struct graph_data, n_mols, "graph data");
+  int n_complexes = 0;
+  for (struct storage_list *slp = state->storage_head; slp != NULL;
+       slp = slp->next) {
+    for (struct schedule_helper *shp = slp->store->timer; shp != NULL;
+         shp = shp->next_scale) {
+      for (int i = -1; i < shp->buf_len; i++) {
+        for (struct abstract_element *aep = (i < 0) ? shp->current
+                                                    : shp->circ_buf_head[i];
+             aep != NULL; aep = aep->next) {
+          struct abstract_molecule *amp = (struct abstract_molecule *)aep;
+          if (amp->properties != spec || n_complexes == n_mols)
+            continue;
+          struct graph_data *g = &graphs[n_complexes];
+          memset(g, 0, sizeof(struct graph_data));
+          g->graph_pattern = CHECKED_SPRINTF(
+              "m:A!2,m:B!3,c:x~s%d!0!3,c:y!1!2,", n_complexes);
+          amp->graph_data = g;
+          n_complexes++;
+        }
+      }
+    }
+  }
+  if (n_complexes != n_mols) {
+    mcell_error_nodie("Released %d molecules for the layout cache test "
+                      "instead of %d",
+                      n_complexes, n_mols);
+    return 1;
+  }
+
+#ifdef _OPENMP
+  int const max_threads = omp_get_max_threads();
+#endif
+  for (int frame = 1; frame <= 2; frame++) {
+#ifdef _OPENMP
+    omp_set_num_threads((frame == 1) ? 1 : 4);
+#endif
+    state->current_iterations = frame;
+    if (update_frame_data_list(state, state->viz_blocks)) {
+      mcell_error_nodie("Failed to write frame %d of the layout cache test",
+                        frame);
+      return 1;
+    }
+    if (complex_layout_cache_size() > COMPLEX_LAYOUT_CACHE_MAX) {
+      mcell_error_nodie("The complex layout cache holds %d layouts after "
+                        "frame %d, more than %d",
+                        complex_layout_cache_size(), frame,
+                        COMPLEX_LAYOUT_CACHE_MAX);
+      return 1;
+    }
+  }
+#ifdef _OPENMP
+  omp_set_num_threads(max_threads);
+#endif
+
+  long size[2];
+  char *data[2];
+  for (int frame = 1; frame <= 2; frame++) {
+    char *file_name =
+        CHECKED_SPRINTF("%s.cellbin.%d.dat", LAYOUT_CACHE_TEST_PREFIX, frame);
+    data[frame - 1] = read_whole_file(file_name, &size[frame - 1]);
+    free(file_name);
+  }
+  int failed = (data[0] == NULL || data[1] == NULL || size[0] != size[1] ||
+                memcmp(data[0], data[1], size[0]) != 0);
+  if (failed)
+    mcell_error_nodie("The layout cache test frames written with one and "
+                      "with several threads differ");
+  free(data[0]);
+  free(data[1]);
+  return failed;
+}
+
+/***************************************************************************
+create_profile_test_world:
+  Set up A + B -> C with reaction output every iteration into
+  PROFILE_TEST_DIR, profiled into PROFILE_TEST_DIR/profile.json with a
+  report every PROFILE_TEST_INTERVAL iterations.
+
+  In: n_iterations: number of iterations
+  Out: The initialized simulation with 2000 A and 2000 B.  Exits on failure.
+***************************************************************************/
+static struct volume *create_profile_test_world(int n_iterations) {
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the profile test state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, n_iterations),
+                    "Failed to set iterations");
+  mcell_silence_notifications(state);
+  state->profile_file = CHECKED_STRDUP(PROFILE_TEST_DIR "/profile.json",
+                                       "profile file name");
+  state->profile_interval = PROFILE_TEST_INTERVAL;
+
+  char *names[3] = { "A", "B", "C" };
+  mcell_symbol *mol_ptrs[3];
+  for (int i = 0; i < 3; i++) {
+    struct mcell_species_spec mol = { names[i], 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+    if (mcell_create_species(state, &mol, &mol_ptrs[i])) {
+      mcell_error_nodie("Failed to create species %s", names[i]);
+      exit(1);
+    }
+  }
+
+  /* mdl equivalent: A + B -> C [1e9] */
+  struct mcell_species *reactants =
+      mcell_add_to_species_list(mol_ptrs[0], false, 0, NULL);
+  reactants = mcell_add_to_species_list(mol_ptrs[1], false, 0, reactants);
+  struct mcell_species *products =
+      mcell_add_to_species_list(mol_ptrs[2], false, 0, NULL);
+  struct mcell_species *surfs = mcell_add_to_species_list(NULL, false, 0, NULL);
+  struct reaction_arrow arrow = { REGULAR_ARROW, { NULL, NULL, 0, 0 } };
+  struct reaction_rates rates =
+      mcell_create_reaction_rates(RATE_CONSTANT, 1e9, RATE_UNSET, 0.0);
+  if (mcell_add_reaction(state->notify, &state->r_step_release,
+                         state->rxn_sym_table, state->radial_subdivisions,
+                         state->vacancy_search_dist2, reactants, &arrow, surfs,
+                         products, NULL, &rates, NULL, NULL) == MCELL_FAIL) {
+    mcell_print("Failed to create reaction A + B -> C");
+    exit(1);
+  }
+  mcell_delete_species_list(reactants);
+  mcell_delete_species_list(products);
+  mcell_delete_species_list(surfs);
+
+  struct object *world_object = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "world", &world_object),
+                    "could not create meta object");
+
+  /* the release sites keep a pointer to their location */
+  static struct vector3 position = { 0.0, 0.0, 0.0 };
+  struct vector3 diameter = { 0.2, 0.2, 0.2 };
+  for (int i = 0; i < 2; i++) {
+    char *site_name = CHECKED_SPRINTF("%s_releaser", names[i]);
+    struct object *releaser = NULL;
+    struct mcell_species *mol =
+        mcell_add_to_species_list(mol_ptrs[i], false, 0, NULL);
+    CHECKED_CALL_EXIT(mcell_create_geometrical_release_site(
+                          state, world_object, site_name, SHAPE_SPHERICAL,
+                          &position, &diameter, mol, 2000, 0, 1, NULL,
+                          &releaser),
+                      "could not create a profile test release site");
+    mcell_delete_species_list(mol);
+    free(site_name);
+  }
+
+  /* mdl equivalent: REACTION_DATA_OUTPUT { STEP = 1e-6
+   *   {COUNT[C, WORLD]} => "PROFILE_TEST_DIR/react_data/C.dat" } */
+  struct output_column_list count_list;
+  CHECKED_CALL_EXIT(mcell_create_count(state, mol_ptrs[2], ORIENT_NOT_SET,
+                                       NULL, REPORT_CONTENTS | REPORT_WORLD,
+                                       NULL, &count_list),
+                    "Failed to create COUNT expression");
+  struct output_set *os = mcell_create_new_output_set(
+      NULL, 0, count_list.column_head, FILE_SUBSTITUTE,
+      PROFILE_TEST_DIR "/react_data/C.dat");
+  struct output_times_inlist out_times;
+  out_times.type = OUTPUT_BY_STEP;
+  out_times.step = 1e-6;
+  struct output_set_list output;
+  output.set_head = os;
+  output.set_tail = os;
+  CHECKED_CALL_EXIT(
+      mcell_add_reaction_output_block(state, &output, 10000, &out_times),
+      "Error setting up the reaction output block");
+
+  CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                    "An error occured during simulation creation.");
+  CHECKED_CALL_EXIT(
+      mcell_init_read_checkpoint(state),
+      "An error occured during initialization and reading of checkpoint.");
+  CHECKED_CALL_EXIT(mcell_init_output(state),
+                    "An error occured during setting up of output.");
+  return state;
+}
+
+/***************************************************************************
+profile_field:
+  In: json: text of a profile report
+      key: name of a numeric field
+  Out: The value of the first field named key in json, or -1 if there is
+       none.
+***************************************************************************/
+static double profile_field(char const *json, char const *key) {
+  char *quoted = CHECKED_SPRINTF("\"%s\": ", key);
+  char const *field = strstr(json, quoted);
+  double value = (field != NULL) ? strtod(field + strlen(quoted), NULL) : -1.0;
+  free(quoted);
+  return value;
+}
+
+/***************************************************************************
+check_profile:
+  In: n_iterations: number of iterations the report must cover
+  Out: 0 if the profile report in PROFILE_TEST_DIR exists and is
+       consistent: it covers n_iterations, every phase timed at most as
+       often as it ran, the diffusion and collision phases ran, and the
+       run_timestep calls of the storages add up to those of the phase.
+       1 otherwise.
+***************************************************************************/
+static int check_profile(long long n_iterations) {
+  long size;
+  char *json = read_whole_file(PROFILE_TEST_DIR "/profile.json", &size);
+  if (json == NULL) {
+    mcell_error_nodie("The profile test wrote no profile");
+    return 1;
+  }
+  json[size] = '\0';
+
+  int failed = 0;
+  if (profile_field(json, "iteration") != (double)n_iterations ||
+      profile_field(json, "iterations_profiled") != (double)n_iterations) {
+    mcell_error_nodie("The profile does not cover %lld iterations",
+                      n_iterations);
+    failed = 1;
+  }
+
+  double timestep_calls = -1.0;
+  for (char const *phase = strstr(json, "{\"name\": "); phase != NULL;
+       phase = strstr(phase + 1, "{\"name\": ")) {
+    double calls = profile_field(phase, "calls");
+    double timed_calls = profile_field(phase, "timed_calls");
+    int is_timestep = (strncmp(phase, "{\"name\": \"run_timestep\"", 23) == 0);
+    int must_run = is_timestep ||
+                   strncmp(phase, "{\"name\": \"diffuse_3D\"", 21) == 0 ||
+                   strncmp(phase, "{\"name\": \"collisions\"", 21) == 0;
+    if (timed_calls < 0.0 || timed_calls > calls || (must_run && calls < 1)) {
+      mcell_error_nodie("Inconsistent profile phase: %.60s", phase);
+      failed = 1;
+    }
+    if (is_timestep)
+      timestep_calls = calls;
+  }
+
+  double storage_calls = 0.0;
+  for (char const *storage = strstr(json, "{\"index\": "); storage != NULL;
+       storage = strstr(storage + 1, "{\"index\": "))
+    storage_calls += profile_field(storage, "calls");
+  if (timestep_calls < n_iterations || storage_calls != timestep_calls) {
+    mcell_error_nodie("The profile counts %g run_timestep calls, %g of them "
+                      "in the storages",
+                      timestep_calls, storage_calls);
+    failed = 1;
+  }
+
+  free(json);
+  return failed;
+}
+
+#ifdef MCELL_WORK_COUNTERS
+/***************************************************************************
+sum_work_counters:
+  In: file_name: work counter file in PROFILE_TEST_DIR/react_data
+      keys: scanf format of the columns before the counters
+      totals: set to the sums of the counters over all rows
+  Out: The number of rows, or -1 if the file could not be read
+***************************************************************************/
+static int sum_work_counters(char const *file_name, char const *keys,
+                             long long totals[WORK_N_COUNTERS]) {
+  char *path = CHECKED_SPRINTF("%s/react_data/%s", PROFILE_TEST_DIR,
+                               file_name);
+  FILE *f = fopen(path, "r");
+  free(path);
+  if (f == NULL)
+    return -1;
+
+  memset(totals, 0, WORK_N_COUNTERS * sizeof(long long));
+  int n_rows = 0;
+  char line[1024];
+  while (fgets(line, sizeof(line), f) != NULL) {
+    if (line[0] == '#')
+      continue;
+    int n_key_chars = 0;
+    if (sscanf(line, keys, &n_key_chars) < 0 || n_key_chars == 0)
+      continue;
+    char *p = line + n_key_chars;
+    for (int i = 0; i < WORK_N_COUNTERS; i++)
+      totals[i] += strtoll(p, &p, 10);
+    n_rows++;
+  }
+  fclose(f);
+  return n_rows;
+}
+
+/***************************************************************************
+check_work_counters:
+  In: nothing
+  Out: 0 if the work counter files of the profile test exist and agree:
+       the counters summed over the species equal those summed over the
+       subvolumes, work was counted, and no more reactions fired than
+       were attempted.  1 otherwise.
+***************************************************************************/
+static int check_work_counters(void) {
+  long long by_species[WORK_N_COUNTERS];
+  long long by_subvol[WORK_N_COUNTERS];
+  int n_species_rows = sum_work_counters("work_counters_species.dat",
+                                         "%*lld %*s%n", by_species);
+  int n_subvol_rows = sum_work_counters("work_counters_subvolumes.dat",
+                                        "%*lld %*d %*d %*d %*d%n", by_subvol);
+  if (n_species_rows <= 0 || n_subvol_rows <= 0) {
+    mcell_error_nodie("The profile test wrote no work counters");
+    return 1;
+  }
+
+  int failed = 0;
+  for (int i = 0; i < WORK_N_COUNTERS; i++) {
+    if (by_species[i] != by_subvol[i]) {
+      mcell_error_nodie("Work counter %d adds up to %lld over the species "
+                        "but to %lld over the subvolumes",
+                        i, by_species[i], by_subvol[i]);
+      failed = 1;
+    }
+  }
+  if (by_species[WORK_RAY_VOXEL] == 0 || by_species[WORK_RXN_FIRED] == 0 ||
+      by_species[WORK_RXN_FIRED] > by_species[WORK_RXN_ATTEMPTED]) {
+    mcell_error_nodie("The profile test counted %lld ray voxel steps and "
+                      "%lld reactions fired of %lld attempted",
+                      by_species[WORK_RAY_VOXEL], by_species[WORK_RXN_FIRED],
+                      by_species[WORK_RXN_ATTEMPTED]);
+    failed = 1;
+  }
+  return failed;
+}
+#endif
+
+/***************************************************************************
+test_phase_profile:
+  Run A + B -> C with the phase profiler for a number of iterations which
+  is no multiple of the report interval.  The periodic report must stop
+  at the last multiple, the report written at the end of the run must
+  cover all iterations, and both must be consistent (see check_profile).
+  Built with MCELL_WORK_COUNTERS, the work counters written with the
+  reaction output are checked as well (see check_work_counters).
+
+  In: Nothing
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_phase_profile(void) {
+  int const n_iterations = 5 * PROFILE_TEST_INTERVAL / 2;
+  struct volume *state = create_profile_test_world(n_iterations);
+
+  int restarted_from_checkpoint = 0;
+  for (int i = 0; i < n_iterations; i++)
+    CHECKED_CALL_EXIT(
+        mcell_run_iteration(state, 100, &restarted_from_checkpoint),
+        "Error running the profile test simulation.");
+
+  int failed = check_profile(2 * PROFILE_TEST_INTERVAL);
+  if (profile_dump(state)) {
+    mcell_error_nodie("Failed to write the profile at the end of the run");
+    failed = 1;
+  } else {
+    failed |= check_profile(n_iterations);
+  }
+  profile_destroy();
+#ifdef MCELL_WORK_COUNTERS
+  failed |= check_work_counters();
+#endif
+  return failed;
+}
+
+/***************************************************************************
+test_surface_trajectories:
+  Diffuse surface molecules on a box without a top for 100 iterations, with
+  steps long enough to cross many edges and to reflect off the open ones.  The crossings of every wall
+  edge must match traverse_surface bit for bit and the stored reflectors
+  must match the ones computed from the wall, and the final positions must
+  match the ones given by the code from before the per-wall edge records.
+
+  In: Nothing
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_surface_trajectories(void) {
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the surface trajectory test state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, 100),
+                    "Failed to set iterations");
+  mcell_silence_notifications(state);
+
+  struct mcell_species_spec molS = { "S", 1e-5, 1, 0.0, 0, 0.0, 0.0, 0 };
+  mcell_symbol *molS_ptr;
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molS, &molS_ptr),
+                    "Failed to create species S");
+
+  struct object *world_object = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "world", &world_object),
+                    "could not create meta object");
+
+  struct vertex_list *verts = mcell_add_to_vertex_list(0.1, 0.1, -0.1, NULL);
+  verts = mcell_add_to_vertex_list(0.1, -0.1, -0.1, verts);
+  verts = mcell_add_to_vertex_list(-0.1, -0.1, -0.1, verts);
+  verts = mcell_add_to_vertex_list(-0.1, 0.1, -0.1, verts);
+  verts = mcell_add_to_vertex_list(0.1, 0.1, 0.1, verts);
+  verts = mcell_add_to_vertex_list(0.1, -0.1, 0.1, verts);
+  verts = mcell_add_to_vertex_list(-0.1, -0.1, 0.1, verts);
+  verts = mcell_add_to_vertex_list(-0.1, 0.1, 0.1, verts);
+
+  struct element_connection_list *elems =
+      mcell_add_to_connection_list(1, 2, 3, NULL);
+  elems = mcell_add_to_connection_list(0, 4, 5, elems);
+  elems = mcell_add_to_connection_list(1, 5, 6, elems);
+  elems = mcell_add_to_connection_list(6, 7, 3, elems);
+  elems = mcell_add_to_connection_list(0, 3, 7, elems);
+  elems = mcell_add_to_connection_list(0, 1, 3, elems);
+  elems = mcell_add_to_connection_list(1, 0, 5, elems);
+  elems = mcell_add_to_connection_list(2, 1, 6, elems);
+  elems = mcell_add_to_connection_list(2, 6, 3, elems);
+  elems = mcell_add_to_connection_list(4, 0, 7, elems);
+
+  struct poly_object polygon = { "box", verts, 8, elems, 10 };
+  struct object *mesh = NULL;
+  CHECKED_CALL_EXIT(
+      mcell_create_poly_object(state, world_object, &polygon, &mesh),
+      "could not create polygon_object");
+
+  struct object *S_releaser = NULL;
+  struct mcell_species *S = mcell_add_to_species_list(molS_ptr, true, 1, NULL);
+  CHECKED_CALL_EXIT(mcell_create_region_release(state, world_object, mesh,
+                                                "S_releaser", "ALL", S,
+                                                SURFACE_TRAJECTORY_N_MOLS, 0,
+                                                1, NULL, &S_releaser),
+                    "could not create S_releaser");
+  mcell_delete_species_list(S);
+
+  CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                    "An error occured during simulation creation.");
+  CHECKED_CALL_EXIT(
+      mcell_init_read_checkpoint(state),
+      "An error occured during initialization and reading of checkpoint.");
+  CHECKED_CALL_EXIT(mcell_init_output(state),
+                    "An error occured during setting up of output.");
+
+  int n_mismatches = 0;
+  for (int n_wall = 0; n_wall < mesh->n_walls; n_wall++) {
+    struct wall *w = mesh->wall_p[n_wall];
+    for (int i = 0; i < 3; i++) {
+      for (int k = 0; k < 10; k++) {
+        double u[2];
+        rng_fill_dbl(state->rng, u, 2);
+        struct vector2 loc = { u[0] * w->uv_vert1_u, u[1] * w->uv_vert2.v };
+        struct vector2 expected, got;
+        struct wall *expected_wall = traverse_surface(w, &loc, i, &expected);
+        struct wall *got_wall = cross_edge(w, &loc, i, &got);
+        if (got_wall != expected_wall ||
+            (got_wall != NULL &&
+             (got.u != expected.u || got.v != expected.v)))
+          n_mismatches++;
+      }
+    }
+
+    struct vector2 reflector[3] = {
+      { 0.0, 1.0 },
+      { -w->uv_vert2.v, w->uv_vert2.u - w->uv_vert1_u },
+      { w->uv_vert2.v, -w->uv_vert2.u }
+    };
+    for (int i = 1; i < 3; i++) {
+      double f = 1.0 / sqrt(reflector[i].u * reflector[i].u +
+                            reflector[i].v * reflector[i].v);
+      reflector[i].u *= f;
+      reflector[i].v *= f;
+    }
+    for (int i = 0; i < 3; i++) {
+      if (w->xform.reflector[i].u != reflector[i].u ||
+          w->xform.reflector[i].v != reflector[i].v)
+        n_mismatches++;
+    }
+  }
+  if (n_mismatches != 0) {
+    mcell_error_nodie("%d edge crossings or reflectors of the box differ from "
+                      "the ones computed from its edges",
+                      n_mismatches);
+    return 1;
+  }
+
+  int restarted_from_checkpoint = 0;
+  for (int i = 0; i < 100; i++)
+    CHECKED_CALL_EXIT(
+        mcell_run_iteration(state, 100, &restarted_from_checkpoint),
+        "Error running the surface trajectory test simulation.");
+
+  int n_mols = 0;
+  double sum = 0.0;
+  for (struct storage_list *slp = state->storage_head; slp != NULL;
+       slp = slp->next) {
+    for (struct schedule_helper *shp = slp->store->timer; shp != NULL;
+         shp = shp->next_scale) {
+      for (int i = -1; i < shp->buf_len; i++) {
+        for (struct abstract_element *aep = (i < 0) ? shp->current
+                                                    : shp->circ_buf_head[i];
+             aep != NULL; aep = aep->next) {
+          struct surface_molecule *sm = (struct surface_molecule *)aep;
+          if (sm->properties == NULL || !(sm->flags & TYPE_SURF))
+            continue;
+          struct vector3 pos;
+          uv2xyz(&sm->s_pos, sm->grid->surface, &pos);
+          sum += pos.x + 2.0 * pos.y + 3.0 * pos.z;
+          n_mols++;
+        }
+      }
+    }
+  }
+
+  if (n_mols != SURFACE_TRAJECTORY_N_MOLS ||
+      fabs(sum - SURFACE_TRAJECTORY_SUM) > 1e-9) {
+    mcell_error_nodie("Surface molecules moved differently: %d molecules "
+                      "with a position sum of %.17g instead of %d and %.17g",
+                      n_mols, sum, SURFACE_TRAJECTORY_N_MOLS,
+                      SURFACE_TRAJECTORY_SUM);
+    return 1;
+  }
+  return 0;
+}
+
+/***************************************************************************
+test_mdl_parse_benchmark:
+  Time the parsing of a generated MDL with n_syms parameters, species and
+  reactions, which fills the symbol tables with many symbols.
+
+  In: n_syms: number of each kind of symbol
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_mdl_parse_benchmark(int n_syms) {
+  FILE *f = fopen(MDL_PARSE_TEST_FILE, "w");
+  if (f == NULL) {
+    mcell_print("Failed to write the MDL parse benchmark file");
+    return 1;
+  }
+  fprintf(f, "ITERATIONS = 1\nTIME_STEP = 1e-6\n\n");
+  for (int i = 0; i < n_syms; i++)
+    fprintf(f, "k_%d = %d\n", i, i + 1);
+  fprintf(f, "\nDEFINE_MOLECULES\n{\n");
+  for (int i = 0; i < n_syms; i++)
+    fprintf(f, "  mol_%d { DIFFUSION_CONSTANT_3D = 1e-6 }\n", i);
+  fprintf(f, "}\n\nDEFINE_REACTIONS\n{\n");
+  for (int i = 0; i < n_syms; i++)
+    fprintf(f, "  mol_%d -> mol_%d [k_%d]\n", i, (i + 1) % n_syms, i);
+  fprintf(f, "}\n");
+  fclose(f);
+
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the MDL parse benchmark state");
+  mcell_silence_notifications(state);
+  state->mdl_infile_name = CHECKED_STRDUP(MDL_PARSE_TEST_FILE, "file name");
+
+  clock_t start = clock();
+  if (parse_input(state)) {
+    mcell_error_nodie("Failed to parse the generated MDL %s",
+                      MDL_PARSE_TEST_FILE);
+    return 1;
+  }
+  mcell_log("MDL parse benchmark: %d parameters, species and reactions "
+            "in %.3f s",
+            n_syms, (double)(clock() - start) / CLOCKS_PER_SEC);
+
+  char *last_mol = CHECKED_SPRINTF("mol_%d", n_syms - 1);
+  int failed = (retrieve_sym(last_mol, state->mol_sym_table) == NULL);
+  if (failed)
+    mcell_error_nodie("Species %s of the generated MDL was not found",
+                      last_mol);
+  free(last_mol);
+  return failed;
+}
+
+/***************************************************************************
+test_release_voxel_cache:
+  Check the voxel cache of a region release against the uncached
+  classification: points in cells marked inside must be inside the region
+  and points in cells marked outside must not be, according to
+  is_point_inside_region.  The region is a tetrahedron, which fills only a
+  sixth of its bounding box and whose slanted face crosses many cells.
+
+  In: Nothing
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_release_voxel_cache(void) {
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the voxel cache test state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, 1),
+                    "Failed to set iterations");
+  mcell_silence_notifications(state);
+
+  struct mcell_species_spec molV = { "V", 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+  mcell_symbol *molV_ptr;
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molV, &molV_ptr),
+                    "Failed to create species V");
+
+  struct object *world_object = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "world", &world_object),
+                    "could not create meta object");
+
+  struct vertex_list *verts = mcell_add_to_vertex_list(0.0, 0.0, 0.0, NULL);
+  verts = mcell_add_to_vertex_list(0.2, 0.0, 0.0, verts);
+  verts = mcell_add_to_vertex_list(0.0, 0.2, 0.0, verts);
+  verts = mcell_add_to_vertex_list(0.0, 0.0, 0.2, verts);
+
+  struct element_connection_list *elems =
+      mcell_add_to_connection_list(0, 2, 1, NULL);
+  elems = mcell_add_to_connection_list(0, 1, 3, elems);
+  elems = mcell_add_to_connection_list(0, 3, 2, elems);
+  elems = mcell_add_to_connection_list(1, 2, 3, elems);
+
+  struct poly_object polygon = { "tetrahedron", verts, 4, elems, 4 };
+  struct object *mesh = NULL;
+  CHECKED_CALL_EXIT(
+      mcell_create_poly_object(state, world_object, &polygon, &mesh),
+      "could not create polygon_object");
+
+  struct object *V_releaser = NULL;
+  struct mcell_species *V = mcell_add_to_species_list(molV_ptr, false, 0, NULL);
+  CHECKED_CALL_EXIT(mcell_create_region_release(state, world_object, mesh,
+                                                "V_releaser", "ALL", V, 100, 0,
+                                                1, NULL, &V_releaser),
+                    "could not create V_releaser");
+  mcell_delete_species_list(V);
+
+  CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                    "An error occured during simulation creation.");
+
+  struct release_region_data *rrd =
+      ((struct release_site_obj *)V_releaser->contents)->region_data;
+  struct release_voxel_cache *cache = get_release_voxel_cache(state, rrd);
+
+  int n_cells[3] = { 0, 0, 0 };
+  int n_mismatches = 0;
+  struct subvolume *sv = NULL;
+  for (int x = 0; x < cache->n[0]; x++) {
+    for (int y = 0; y < cache->n[1]; y++) {
+      for (int z = 0; z < cache->n[2]; z++) {
+        int c = (x * cache->n[1] + y) * cache->n[2] + z;
+        n_cells[cache->cells[c]]++;
+        if (cache->cells[c] == RELEASE_VOXEL_BOUNDARY)
+          continue;
+
+        /* the centre and a few random points of the cell */
+        for (int k = 0; k < 4; k++) {
+          double u[3] = { 0.5, 0.5, 0.5 };
+          if (k > 0)
+            rng_fill_dbl(state->rng, u, 3);
+          struct vector3 pos;
+          pos.x = cache->llf.x + (x + u[0]) * cache->cell_size.x;
+          pos.y = cache->llf.y + (y + u[1]) * cache->cell_size.y;
+          pos.z = cache->llf.z + (z + u[2]) * cache->cell_size.z;
+          sv = find_subvolume(state, &pos, sv);
+          int inside = is_point_inside_region(state, &pos, rrd->expression, sv);
+          if (inside != -1 &&
+              inside != (cache->cells[c] == RELEASE_VOXEL_INSIDE))
+            n_mismatches++;
+        }
+      }
+    }
+  }
+
+  if (n_cells[RELEASE_VOXEL_INSIDE] == 0 ||
+      n_cells[RELEASE_VOXEL_OUTSIDE] == 0 ||
+      n_cells[RELEASE_VOXEL_BOUNDARY] == 0 || n_mismatches != 0) {
+    mcell_error_nodie("Voxel cache of the tetrahedron: %d inside, %d outside "
+                      "and %d boundary cells, %d points classified "
+                      "differently than without the cache",
+                      n_cells[RELEASE_VOXEL_INSIDE],
+                      n_cells[RELEASE_VOXEL_OUTSIDE],
+                      n_cells[RELEASE_VOXEL_BOUNDARY], n_mismatches);
+    return 1;
+  }
+  return 0;
+}
+
+/***************************************************************************
+add_unimol_test_reaction:
+  In: state: simulation
+      name: name of the reaction, which MCell 4 requires
+      reactant, product: species of reactant -> product
+      rate: rate constant
+  Out: Adds the reaction.  Exits on failure.
+***************************************************************************/
+static void add_unimol_test_reaction(struct volume *state, char *name,
+                                     mcell_symbol *reactant,
+                                     mcell_symbol *product, double rate) {
+  struct sym_entry *pathname = mcell_new_rxn_pathname(state, name);
+  struct mcell_species *reactants =
+      mcell_add_to_species_list(reactant, false, 0, NULL);
+  struct mcell_species *products =
+      mcell_add_to_species_list(product, false, 0, NULL);
+  struct mcell_species *surfs = mcell_add_to_species_list(NULL, false, 0, NULL);
+  struct reaction_arrow arrow = { REGULAR_ARROW, { NULL, NULL, 0, 0 } };
+  struct reaction_rates rates =
+      mcell_create_reaction_rates(RATE_CONSTANT, rate, RATE_UNSET, 0.0);
+  if (mcell_add_reaction(state->notify, &state->r_step_release,
+                         state->rxn_sym_table, state->radial_subdivisions,
+                         state->vacancy_search_dist2, reactants, &arrow, surfs,
+                         products, pathname, &rates, NULL, NULL) == MCELL_FAIL) {
+    mcell_print("Failed to create a unimolecular reaction");
+    exit(1);
+  }
+  mcell_delete_species_list(reactants);
+  mcell_delete_species_list(products);
+  mcell_delete_species_list(surfs);
+}
+
+/***************************************************************************
+test_mcell4_mixed_time_steps:
+  Run a model with species of three different time steps under MCell 4.
+  A is slow to react, so the classes of B and C are usually created by
+  unimolecular reactions scheduled on the calendar of A, i.e. the per time
+  step data of a partition grows while a calendar bucket is processed.
+
+  In: Nothing
+  Out: 0 on success, 1 on failure
+***************************************************************************/
+static int test_mcell4_mixed_time_steps(void) {
+  struct volume *state = mcell_create();
+  CHECKED_CALL_EXIT(mcell_init_state(state),
+                    "Failed to set up the MCell 4 test state");
+  CHECKED_CALL_EXIT(mcell_set_time_step(state, 1e-6), "Failed to set timestep");
+  CHECKED_CALL_EXIT(mcell_set_iterations(state, 100),
+                    "Failed to set iterations");
+  mcell_silence_notifications(state);
+
+  struct mcell_species_spec molA = { "A", 1e-6, 0, 0.0, 0, 0.0, 0.0, 0 };
+  struct mcell_species_spec molB = { "B", 1e-6, 0, 3e-6, 0, 0.0, 0.0, 0 };
+  struct mcell_species_spec molC = { "C", 1e-6, 0, 5e-7, 0, 0.0, 0.0, 0 };
+  mcell_symbol *molA_ptr, *molB_ptr, *molC_ptr;
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molA, &molA_ptr),
+                    "Failed to create species A");
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molB, &molB_ptr),
+                    "Failed to create species B");
+  CHECKED_CALL_EXIT(mcell_create_species(state, &molC, &molC_ptr),
+                    "Failed to create species C");
+
+  /* mdl equivalent: A -> B [1e3], B -> C [1e5], C -> A [1e5] */
+  add_unimol_test_reaction(state, "A_to_B", molA_ptr, molB_ptr, 1e3);
+  add_unimol_test_reaction(state, "B_to_C", molB_ptr, molC_ptr, 1e5);
+  add_unimol_test_reaction(state, "C_to_A", molC_ptr, molA_ptr, 1e5);
+
+  struct object *scene = NULL;
+  CHECKED_CALL_EXIT(mcell_create_instance_object(state, "Scene", &scene),
+                    "could not create meta object");
+
+  struct vector3 position = { 0.0, 0.0, 0.0 };
+  struct vector3 diameter = { 0.1, 0.1, 0.1 };
+  struct object *A_releaser = NULL;
+  struct mcell_species *A = mcell_add_to_species_list(molA_ptr, false, 0, NULL);
+  CHECKED_CALL_EXIT(mcell_create_geometrical_release_site(
+                        state, scene, "A_releaser", SHAPE_SPHERICAL, &position,
+                        &diameter, A, 100, 0, 1, NULL, &A_releaser),
+                    "could not create A_releaser");
+  mcell_delete_species_list(A);
+
+  CHECKED_CALL_EXIT(mcell_init_simulation(state),
+                    "An error occured during simulation creation.");
+  CHECKED_CALL_EXIT(
+      mcell_init_read_checkpoint(state),
+      "An error occured during initialization and reading of checkpoint.");
+  CHECKED_CALL_EXIT(mcell_init_output(state),
+                    "An error occured during setting up of output.");
+
+  if (!mcell4_convert_mcell3_volume(state)) {
+    mcell_print("Failed to convert the mixed time step model to MCell 4");
+    return 1;
+  }
+  int failed = !mcell4_run_simulation();
+  if (failed)
+    mcell_print("MCell 4 failed to run the mixed time step model");
+  mcell4_delete_world();
+  return failed;
+}
+
+int main(int argc, char **argv) {
+  /* the build with the work counters only runs the test which checks them
+   * (see CMakeLists.txt) */
+  if (argc > 2 && strcmp(argv[2], "-profile_only") == 0)
+    return test_phase_profile();
+
+  /* check the internal data structures before exercising the API */
+  if (test_internals() != 0) {
+    mcell_print("Internal consistency checks failed");
+    exit(1);
+  }
+
+  /* the optional argument is the directory of the MCell utility scripts */
+  if (test_chkpt_round_trip((argc > 1) ? argv[1] : NULL) != 0) {
+    mcell_print("Checkpoint round trip failed");
+    exit(1);
+  }
+
+  if (test_chkpt_formats() != 0) {
+    mcell_print("Checkpoint format round trip failed");
+    exit(1);
+  }
+
+  if (test_mcell4_mixed_time_steps() != 0)
+    exit(1);
+
+  if (test_release_voxel_cache() != 0)
+    exit(1);
+
+  if (test_rate_changes() != 0)
+    exit(1);
+
+  if (test_trimol_benchmark() != 0)
+    exit(1);
+
+  if (test_species_arrays_benchmark() != 0)
+    exit(1);
+
+  if (test_phase_profile() != 0)
+    exit(1);
+
+  if (test_surface_trajectories() != 0)
+    exit(1);
+
+  if (test_edge_matching_benchmark(6) != 0)
+    exit(1);
+
+  if (test_complex_layout_cache() != 0)
+    exit(1);
+
+  if (test_mdl_parse_benchmark(20000) != 0)
+    exit(1);
+
   struct volume *state = mcell_create();
   CHECKED_CALL_EXIT(
       mcell_init_state(state),
@@ -43,22 +1898,22 @@ int main(void) {
                     "Failed to set Z partition");
 
   /* create species */
-  struct mcell_species_spec molA = { "A", 1e-6, 1, 0.0, 0, 0.0, 0.0 };
+  struct mcell_species_spec molA = { "A", 1e-6, 1, 0.0, 0, 0.0, 0.0, 0 };
   mcell_symbol *molA_ptr;
   CHECKED_CALL_EXIT(mcell_create_species(state, &molA, &molA_ptr),
                     "Failed to create species A");
 
-  struct mcell_species_spec molB = { "B", 1e-5, 0, 0.0, 0, 0.0, 0.0 };
+  struct mcell_species_spec molB = { "B", 1e-5, 0, 0.0, 0, 0.0, 0.0, 0 };
   mcell_symbol *molB_ptr;
   CHECKED_CALL_EXIT(mcell_create_species(state, &molB, &molB_ptr),
                     "Failed to create species B");
 
-  struct mcell_species_spec molC = { "C", 2e-5, 0, 0.0, 0, 0.0, 0.0 };
+  struct mcell_species_spec molC = { "C", 2e-5, 0, 0.0, 0, 0.0, 0.0, 0 };
   mcell_symbol *molC_ptr;
   CHECKED_CALL_EXIT(mcell_create_species(state, &molC, &molC_ptr),
                     "Failed to create species C");
   
-  struct mcell_species_spec molD = { "D", 1e-6, 1, 0.0, 0, 0.0, 0.0 };
+  struct mcell_species_spec molD = { "D", 1e-6, 1, 0.0, 0, 0.0, 0.0, 0 };
   mcell_symbol *molD_ptr;
   CHECKED_CALL_EXIT(mcell_create_species(state, &molD, &molD_ptr),
                     "Failed to create species D");
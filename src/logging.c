@@ -24,20 +24,79 @@
 #include "config.h"
 #include "logging.h"
 #include "mem_util.h"
+#include "event_trace.h"
 
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <sys/time.h>
+#include <errno.h>
+#include <unistd.h>
 #undef _XOPEN_SOURCE
 #define _XOPEN_SOURCE 600
 #include <string.h>
 
+/* Messages formatted on the stack if they fit, else on the heap */
+#define LOG_STACK_TEXT 1024
+
+/* Asynchronous logging: messages go through a bounded queue, which any
+ * thread may add to without locks, and a background thread writes them out
+ * in the order they were queued. */
+#define LOG_QUEUE_SIZE 4096  /* records, a power of two */
+#define LOG_INLINE_TEXT 232  /* longer messages are kept on the heap */
+#define LOG_FLUSH_MS 20      /* longest time a message waits in the queue */
+#define LOG_EMERGENCY_SPINS (1 << 24) /* tries to take over the streams */
+
+/* Warnings from the same format string are only shown this many times */
+#define WARN_REPEAT_MAX 100
+#define WARN_LIMIT_SLOTS 1024 /* format strings tracked, a power of two */
+
+enum log_stream_t { LOG_STREAM, ERROR_STREAM };
+
+struct log_record {
+  _Atomic size_t seq; /* index it was queued at + 1 once written */
+  int stream;         /* enum log_stream_t */
+  size_t len;
+  char *heap;         /* text if it did not fit in 'text', or NULL */
+  char text[LOG_INLINE_TEXT];
+};
+
+struct log_queue {
+  struct log_record *records;
+  _Atomic size_t head; /* records queued */
+  size_t tail;         /* records written; only touched under write_lock */
+  int fd[2];           /* of the streams, see mcell_log_emergency_flush */
+  atomic_flag writing; /* held while records are written */
+
+  pthread_t flusher;
+  pthread_mutex_t lock; /* protects stop, for the wake condition */
+  pthread_cond_t wake;
+  int stop;
+};
+
+/* Held while writing queued records, so that they come out in order */
+static pthread_mutex_t log_write_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* The queue, or NULL when messages are written directly */
+static struct log_queue *_Atomic log_queue = NULL;
+
+struct warn_count {
+  char const *_Atomic fmt;
+  atomic_long count;
+};
+
+static struct warn_count warn_counts[WARN_LIMIT_SLOTS];
+static atomic_int warn_report_registered = 0;
+
 /* Our log file */
 static FILE *mcell_log_file = NULL;
 
 /* Our warning/error file */
 static FILE *mcell_error_file = NULL;
 
-/* Get the log file. */
-FILE *mcell_get_log_file(void) {
+static FILE *log_file(void) {
   if (mcell_log_file == NULL) {
 #ifdef DEBUG
     setvbuf(stdout, NULL, _IONBF, 0);
@@ -47,8 +106,7 @@ FILE *mcell_get_log_file(void) {
   return mcell_log_file;
 }
 
-/* Get the error file. */
-FILE *mcell_get_error_file(void) {
+static FILE *error_file(void) {
   if (mcell_error_file == NULL) {
 #ifdef DEBUG
     setvbuf(stderr, NULL, _IONBF, 0);
@@ -58,8 +116,338 @@ FILE *mcell_get_error_file(void) {
   return mcell_error_file;
 }
 
+static FILE *stream_file(int stream) {
+  return (stream == ERROR_STREAM) ? error_file() : log_file();
+}
+
+/*************************************************************************
+write_queued:
+  In: q: the log queue, with log_write_lock held
+  Out: Returns the number of records written.  All records which are
+       completely queued are written out, in order.
+*************************************************************************/
+static size_t write_queued(struct log_queue *q) {
+  /* Kept by mcell_log_emergency_flush once it took the streams over */
+  if (atomic_flag_test_and_set_explicit(&q->writing, memory_order_acquire))
+    return 0;
+
+  size_t n = 0;
+  int used[2] = { 0, 0 };
+  while (1) {
+    struct log_record *rec = &q->records[q->tail & (LOG_QUEUE_SIZE - 1)];
+    if (atomic_load_explicit(&rec->seq, memory_order_acquire) != q->tail + 1)
+      break;
+
+    char const *text = (rec->heap != NULL) ? rec->heap : rec->text;
+    fwrite(text, 1, rec->len, stream_file(rec->stream));
+    used[rec->stream] = 1;
+    free(rec->heap);
+    rec->heap = NULL;
+
+    atomic_store_explicit(&rec->seq, q->tail + LOG_QUEUE_SIZE,
+                          memory_order_release);
+    q->tail++;
+    n++;
+  }
+  if (used[LOG_STREAM])
+    fflush(log_file());
+  if (used[ERROR_STREAM])
+    fflush(error_file());
+  atomic_flag_clear_explicit(&q->writing, memory_order_release);
+  return n;
+}
+
+/* Writes all of buf, returns 0 on success; async-signal-safe */
+static int log_write(int fd, char const *buf, size_t size) {
+  while (size > 0) {
+    ssize_t n = write(fd, buf, size);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return 1;
+    buf += n;
+    size -= (size_t)n;
+  }
+  return 0;
+}
+
+static void *log_flusher_main(void *arg) {
+  struct log_queue *q = (struct log_queue *)arg;
+
+  pthread_mutex_lock(&q->lock);
+  while (1) {
+    int stop = q->stop;
+    pthread_mutex_unlock(&q->lock);
+
+    pthread_mutex_lock(&log_write_lock);
+    size_t n = write_queued(q);
+    pthread_mutex_unlock(&log_write_lock);
+
+    pthread_mutex_lock(&q->lock);
+    if (stop && n == 0)
+      break;
+    if (n == 0 && !q->stop) {
+      struct timeval now;
+      struct timespec deadline;
+      gettimeofday(&now, NULL);
+      long long ns = (long long)now.tv_usec * 1000 + LOG_FLUSH_MS * 1000000LL;
+      deadline.tv_sec = now.tv_sec + (time_t)(ns / 1000000000LL);
+      deadline.tv_nsec = (long)(ns % 1000000000LL);
+      pthread_cond_timedwait(&q->wake, &q->lock, &deadline);
+    }
+  }
+  pthread_mutex_unlock(&q->lock);
+  return NULL;
+}
+
+/*************************************************************************
+log_enqueue:
+  In: q: the log queue
+      stream: enum log_stream_t
+      text: the message; taken over if heap is set
+      len: its length
+      heap: nonzero if text was allocated with malloc
+  Out: The message is queued.  If the queue is full, waits for the flusher
+       rather than losing messages.
+*************************************************************************/
+static void log_enqueue(struct log_queue *q, int stream, char *text,
+                        size_t len, int heap) {
+  size_t pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+  struct log_record *rec;
+  while (1) {
+    rec = &q->records[pos & (LOG_QUEUE_SIZE - 1)];
+    size_t seq = atomic_load_explicit(&rec->seq, memory_order_acquire);
+    intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+    if (dif == 0) {
+      if (atomic_compare_exchange_weak_explicit(&q->head, &pos, pos + 1,
+                                                memory_order_relaxed,
+                                                memory_order_relaxed))
+        break;
+    } else if (dif < 0) {
+      /* full */
+      pthread_cond_signal(&q->wake);
+      sched_yield();
+      pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+    } else
+      pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+  }
+
+  rec->stream = stream;
+  rec->len = len;
+  if (heap || len > LOG_INLINE_TEXT) {
+    rec->heap = heap ? text : strdup(text);
+    if (rec->heap == NULL) {
+      /* keep as much as fits rather than nothing */
+      rec->len = LOG_INLINE_TEXT;
+      memcpy(rec->text, text, LOG_INLINE_TEXT);
+    }
+  } else {
+    rec->heap = NULL;
+    memcpy(rec->text, text, len);
+  }
+  atomic_store_explicit(&rec->seq, pos + 1, memory_order_release);
+
+  /* Wake the flusher early once half of the queue is in use */
+  if (((pos + 1) & (LOG_QUEUE_SIZE / 2 - 1)) == 0)
+    pthread_cond_signal(&q->wake);
+}
+
+/*************************************************************************
+log_emitv:
+  In: stream: enum log_stream_t
+      prefix: text to put before the message
+      fmt, args: the message
+      suffix: text to put after the message
+  Out: The message is written to the stream, or queued if logging is
+       asynchronous.
+*************************************************************************/
+static void log_emitv(int stream, char const *prefix, char const *fmt,
+                      va_list args, char const *suffix) {
+  char buffer[LOG_STACK_TEXT];
+  size_t prefix_len = strlen(prefix);
+  size_t suffix_len = strlen(suffix);
+
+  va_list args_copy;
+  va_copy(args_copy, args);
+  int n = vsnprintf(NULL, 0, fmt, args_copy);
+  va_end(args_copy);
+  if (n < 0)
+    n = 0;
+
+  size_t len = prefix_len + (size_t)n + suffix_len;
+  char *text = buffer;
+  int heap = 0;
+  if (len + 1 > sizeof(buffer)) {
+    text = (char *)malloc(len + 1);
+    if (text == NULL) {
+      /* write it unformatted rather than nothing */
+      text = buffer;
+      len = (size_t)snprintf(buffer, sizeof(buffer), "%s%s%s", prefix, fmt,
+                             suffix);
+      if (len >= sizeof(buffer))
+        len = sizeof(buffer) - 1;
+      n = -1;
+    } else
+      heap = 1;
+  }
+  if (n >= 0) {
+    memcpy(text, prefix, prefix_len);
+    vsnprintf(text + prefix_len, (size_t)n + 1, fmt, args);
+    memcpy(text + prefix_len + n, suffix, suffix_len + 1);
+  }
+
+  struct log_queue *q = atomic_load_explicit(&log_queue, memory_order_acquire);
+  if (q != NULL) {
+    log_enqueue(q, stream, text, len, heap);
+    return;
+  }
+  fwrite(text, 1, len, stream_file(stream));
+  if (heap)
+    free(text);
+}
+
+static void log_emit(int stream, char const *prefix, char const *fmt, ...)
+    PRINTF_FORMAT(3);
+
+static void log_emit(int stream, char const *prefix, char const *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  log_emitv(stream, prefix, fmt, args, "");
+  va_end(args);
+}
+
+/* Write out all queued messages. */
+void mcell_log_flush(void) {
+  struct log_queue *q = atomic_load_explicit(&log_queue, memory_order_acquire);
+  if (q == NULL)
+    return;
+  pthread_mutex_lock(&log_write_lock);
+  write_queued(q);
+  pthread_mutex_unlock(&log_write_lock);
+}
+
+/*************************************************************************
+mcell_log_emergency_flush:
+  In: nothing
+  Out: No return value.  The queued messages are written out with write(2),
+       and the queue is then left alone, so that messages logged afterwards
+       are written directly.  Only uses async-signal-safe calls, so that
+       signal handlers can call it: messages kept on the heap are skipped,
+       and it gives up if the streams cannot be taken over from a thread
+       writing to them, e.g. the one a signal interrupted.
+*************************************************************************/
+void mcell_log_emergency_flush(void) {
+  struct log_queue *q = atomic_load_explicit(&log_queue, memory_order_acquire);
+  if (q == NULL)
+    return;
+
+  int spins = 0;
+  while (atomic_flag_test_and_set_explicit(&q->writing,
+                                           memory_order_acquire)) {
+    if (++spins == LOG_EMERGENCY_SPINS)
+      return;
+  }
+
+  /* The flag is kept, the flusher must not write after this */
+  atomic_store_explicit(&log_queue, NULL, memory_order_release);
+  while (1) {
+    struct log_record *rec = &q->records[q->tail & (LOG_QUEUE_SIZE - 1)];
+    if (atomic_load_explicit(&rec->seq, memory_order_acquire) != q->tail + 1)
+      break;
+    if (rec->heap == NULL)
+      log_write(q->fd[rec->stream], rec->text, rec->len);
+    q->tail++;
+  }
+}
+
+/* Stop asynchronous logging, writing out all queued messages. */
+void mcell_log_stop_async(void) {
+  struct log_queue *q = atomic_load_explicit(&log_queue, memory_order_acquire);
+  if (q == NULL)
+    return;
+
+  pthread_mutex_lock(&q->lock);
+  q->stop = 1;
+  pthread_cond_signal(&q->wake);
+  pthread_mutex_unlock(&q->lock);
+  pthread_join(q->flusher, NULL);
+
+  /* Messages queued while the flusher stopped */
+  pthread_mutex_lock(&log_write_lock);
+  atomic_store_explicit(&log_queue, NULL, memory_order_release);
+  write_queued(q);
+  pthread_mutex_unlock(&log_write_lock);
+
+  pthread_mutex_destroy(&q->lock);
+  pthread_cond_destroy(&q->wake);
+  free(q->records);
+  free(q);
+}
+
+static void log_stop_async_at_exit(void) { mcell_log_stop_async(); }
+
+/* Start writing log and error messages from a background thread.  Returns 0
+ * on success, 1 if messages will still be written directly. */
+int mcell_log_start_async(void) {
+  if (atomic_load(&log_queue) != NULL)
+    return 0;
+
+  struct log_queue *q = (struct log_queue *)calloc(1, sizeof(struct log_queue));
+  if (q == NULL)
+    return 1;
+  q->records =
+      (struct log_record *)calloc(LOG_QUEUE_SIZE, sizeof(struct log_record));
+  if (q->records == NULL) {
+    free(q);
+    return 1;
+  }
+  for (size_t i = 0; i < LOG_QUEUE_SIZE; i++)
+    atomic_init(&q->records[i].seq, i);
+  atomic_init(&q->head, 0);
+  atomic_flag_clear(&q->writing);
+  q->fd[LOG_STREAM] = fileno(log_file());
+  q->fd[ERROR_STREAM] = fileno(error_file());
+  pthread_mutex_init(&q->lock, NULL);
+  pthread_cond_init(&q->wake, NULL);
+  if (pthread_create(&q->flusher, NULL, log_flusher_main, q) != 0) {
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->wake);
+    free(q->records);
+    free(q);
+    return 1;
+  }
+
+  /* Whatever was written directly goes out first */
+  fflush(log_file());
+  fflush(error_file());
+
+  /* Registered after the emergency output hooks, so it runs before them and
+   * they log directly */
+  static int registered = 0;
+  if (!registered) {
+    atexit(log_stop_async_at_exit);
+    registered = 1;
+  }
+  atomic_store_explicit(&log_queue, q, memory_order_release);
+  return 0;
+}
+
+/* Get the log file. */
+FILE *mcell_get_log_file(void) {
+  /* The caller writes to it directly, after what is already queued */
+  mcell_log_flush();
+  return log_file();
+}
+
+/* Get the error file. */
+FILE *mcell_get_error_file(void) {
+  mcell_log_flush();
+  return error_file();
+}
+
 /* Set the log file. */
 void mcell_set_log_file(FILE *f) {
+  mcell_log_flush();
   if (mcell_log_file != NULL && mcell_log_file != stdout &&
       mcell_log_file != stderr)
     fclose(mcell_log_file);
@@ -70,10 +458,15 @@ void mcell_set_log_file(FILE *f) {
 #else
   setvbuf(mcell_log_file, NULL, _IOLBF, 128);
 #endif
+
+  struct log_queue *q = atomic_load_explicit(&log_queue, memory_order_acquire);
+  if (q != NULL)
+    q->fd[LOG_STREAM] = fileno(f);
 }
 
 /* Set the error file. */
 void mcell_set_error_file(FILE *f) {
+  mcell_log_flush();
   if (mcell_error_file != NULL && mcell_error_file != stdout &&
       mcell_error_file != stderr)
     fclose(mcell_error_file);
@@ -83,6 +476,10 @@ void mcell_set_error_file(FILE *f) {
 #else
   setvbuf(mcell_error_file, NULL, _IOLBF, 128);
 #endif
+
+  struct log_queue *q = atomic_load_explicit(&log_queue, memory_order_acquire);
+  if (q != NULL)
+    q->fd[ERROR_STREAM] = fileno(f);
 }
 
 /* Log a message. */
@@ -95,7 +492,7 @@ void mcell_log_raw(char const *fmt, ...) {
 
 /* Log a message (va_list version). */
 void mcell_logv_raw(char const *fmt, va_list args) {
-  vfprintf(mcell_get_log_file(), fmt, args);
+  log_emitv(LOG_STREAM, "", fmt, args, "");
 }
 
 /* Log a message. */
@@ -108,7 +505,7 @@ void mcell_error_raw(char const *fmt, ...) {
 
 /* Log a message (va_list version). */
 void mcell_errorv_raw(char const *fmt, va_list args) {
-  vfprintf(mcell_get_error_file(), fmt, args);
+  log_emitv(ERROR_STREAM, "", fmt, args, "");
 }
 
 /* Log a message. */
@@ -121,8 +518,64 @@ void mcell_log(char const *fmt, ...) {
 
 /* Log a message (va_list version). */
 void mcell_logv(char const *fmt, va_list args) {
-  mcell_logv_raw(fmt, args);
-  fprintf(mcell_get_log_file(), "\n");
+  log_emitv(LOG_STREAM, "", fmt, args, "\n");
+}
+
+/*************************************************************************
+report_suppressed_warnings:
+  In: none
+  Out: For every format string whose warnings were suppressed, the number of
+       suppressed warnings is logged.
+*************************************************************************/
+static void report_suppressed_warnings(void) {
+  for (int i = 0; i < WARN_LIMIT_SLOTS; i++) {
+    char const *fmt = atomic_load(&warn_counts[i].fmt);
+    long count = atomic_load(&warn_counts[i].count);
+    if (fmt != NULL && count > WARN_REPEAT_MAX)
+      log_emit(ERROR_STREAM, "",
+               "Warning: %ld more warnings of the form \"%s\" were not "
+               "shown.\n",
+               count - WARN_REPEAT_MAX, fmt);
+  }
+}
+
+/*************************************************************************
+warning_allowed:
+  In: fmt: format string of a warning
+  Out: 1 if the warning should be shown, 0 if it has been shown
+       WARN_REPEAT_MAX times already.  Warnings are told apart by the
+       address of their format string, i.e. by the place they come from.
+*************************************************************************/
+static int warning_allowed(char const *fmt) {
+  uintptr_t h = ((uintptr_t)fmt >> 3) * 0x9E3779B97F4A7C15ull;
+  for (int probe = 0; probe < WARN_LIMIT_SLOTS; probe++) {
+    struct warn_count *wc =
+        &warn_counts[(h + probe) & (WARN_LIMIT_SLOTS - 1)];
+    char const *slot_fmt = atomic_load_explicit(&wc->fmt, memory_order_acquire);
+    if (slot_fmt == NULL) {
+      char const *expected = NULL;
+      if (atomic_compare_exchange_strong(&wc->fmt, &expected, fmt))
+        slot_fmt = fmt;
+      else
+        slot_fmt = expected;
+    }
+    if (slot_fmt != fmt)
+      continue;
+
+    long count = atomic_fetch_add(&wc->count, 1) + 1;
+    if (count <= WARN_REPEAT_MAX)
+      return 1;
+    if (count == WARN_REPEAT_MAX + 1) {
+      log_emit(ERROR_STREAM, "",
+               "Warning: the warning above was given %d times, further ones "
+               "like it are not shown.\n",
+               WARN_REPEAT_MAX);
+      if (atomic_exchange(&warn_report_registered, 1) == 0)
+        atexit(report_suppressed_warnings);
+    }
+    return 0;
+  }
+  return 1; /* too many different warnings to keep track of */
 }
 
 /* Log a warning. */
@@ -135,9 +588,9 @@ void mcell_warn(char const *fmt, ...) {
 
 /* Log a warning (va_list version). */
 void mcell_warnv(char const *fmt, va_list args) {
-  fprintf(mcell_get_error_file(), "Warning: ");
-  mcell_errorv_raw(fmt, args);
-  fprintf(mcell_get_error_file(), "\n");
+  if (!warning_allowed(fmt))
+    return;
+  log_emitv(ERROR_STREAM, "Warning: ", fmt, args, "\n");
 }
 
 /* Log an error and carry on. */
@@ -152,9 +605,7 @@ void mcell_error_nodie(char const *fmt, ...) {
 // This will either be called by mcell_errorv (which dies) or mcell_error_nodie
 // (which obviously doesn't die), so we shouldn't list this as a fatal error.
 void mcell_errorv_nodie(char const *fmt, va_list args) {
-  fprintf(mcell_get_error_file(), "Error: ");
-  mcell_errorv_raw(fmt, args);
-  fprintf(mcell_get_error_file(), "\n");
+  log_emitv(ERROR_STREAM, "Error: ", fmt, args, "\n");
 }
 
 /* Log an error and exit. */
@@ -183,14 +634,13 @@ void mcell_internal_error_(char const *file, unsigned int line,
 /* Log an error and exit (va_list version). */
 void mcell_internal_errorv_(char const *file, unsigned int line,
                             char const *func, char const *fmt, va_list args) {
-  fprintf(mcell_get_error_file(), "****************\n");
-  fprintf(mcell_get_error_file(), "INTERNAL ERROR at %s:%u [%s]: ", file, line,
-          func);
-  mcell_errorv_raw(fmt, args);
-  fprintf(mcell_get_error_file(), "\n");
-  fprintf(mcell_get_error_file(),
-          "MCell has detected an internal program error.\n");
- fprintf(mcell_get_error_file(), "****************\n");
+  char prefix[LOG_STACK_TEXT];
+  snprintf(prefix, sizeof(prefix),
+           "****************\nINTERNAL ERROR at %s:%u [%s]: ", file, line,
+           func);
+  log_emitv(ERROR_STREAM, prefix, fmt, args,
+            "\nMCell has detected an internal program error.\n"
+            "****************\n");
   mcell_die();
 }
 
@@ -223,17 +673,17 @@ void mcell_perror_nodie(int err, char const *fmt, ...) {
  * version). */
 void mcell_perrorv_nodie(int err, char const *fmt, va_list args) {
   char buffer[2048];
-  fprintf(mcell_get_error_file(), "Fatal error: ");
-  mcell_errorv_raw(fmt, args);
+  char suffix[2048 + 4];
 #ifdef STRERROR_R_CHAR_P
-  fprintf(mcell_get_error_file(), ": %s\n",
-          strerror_r(err, buffer, sizeof(buffer)));
+  snprintf(suffix, sizeof(suffix), ": %s\n",
+           strerror_r(err, buffer, sizeof(buffer)));
 #else
   if (strerror_r(err, buffer, sizeof(buffer)) == 0)
-    fprintf(mcell_get_error_file(), ": %s\n", buffer);
+    snprintf(suffix, sizeof(suffix), ": %s\n", buffer);
   else
-    fprintf(mcell_get_error_file(), "\n");
+    strcpy(suffix, "\n");
 #endif
+  log_emitv(ERROR_STREAM, "Fatal error: ", fmt, args, suffix);
 }
 
 /* Log an error due to a failed standard library call, and exit. */
@@ -262,10 +712,8 @@ void mcell_allocfailed_nodie(char const *fmt, ...) {
 /* Log an error due to failed memory allocation, but do not exit (va_list
  * version). */
 void mcell_allocfailedv_nodie(char const *fmt, va_list args) {
-  fprintf(mcell_get_error_file(), "Fatal error: ");
-  mcell_errorv_raw(fmt, args);
-  fprintf(mcell_get_error_file(), "\n");
-  fprintf(mcell_get_error_file(), "Fatal error: Out of memory\n\n");
+  log_emitv(ERROR_STREAM, "Fatal error: ", fmt, args,
+            "\nFatal error: Out of memory\n\n");
   mem_dump_stats(mcell_get_error_file());
 }
 
@@ -285,4 +733,8 @@ void mcell_allocfailedv(char const *fmt, va_list args) {
 }
 
 /* Terminate program execution due to an error. */
-void mcell_die(void) { exit(EXIT_FAILURE); }
+void mcell_die(void) {
+  trace_emergency_flush();
+  mcell_log_flush();
+  exit(EXIT_FAILURE);
+}
@@ -55,6 +55,23 @@ void mcell_set_log_file(FILE *f);
 /* Set the error file. */
 void mcell_set_error_file(FILE *f);
 
+/* Write log and error messages from a background thread, so that the
+ * threads logging them never wait for the output.  Messages come out in the
+ * order they were logged.  Returns 0 on success, 1 if they will still be
+ * written directly. */
+int mcell_log_start_async(void);
+
+/* Go back to writing messages directly, after writing out the queued ones.
+ * The other threads must no longer be logging. */
+void mcell_log_stop_async(void);
+
+/* Write out all queued messages. */
+void mcell_log_flush(void);
+
+/* Write out the queued messages from a signal handler, with write(2) only,
+ * and log directly from then on. */
+void mcell_log_emergency_flush(void);
+
 /********************************************************
  * Raw I/O to log and error streams
  ********************************************************/
@@ -82,7 +99,8 @@ void mcell_log(char const *fmt, ...) PRINTF_FORMAT(1);
 /* Log a message (va_list version). */
 void mcell_logv(char const *fmt, va_list args) PRINTF_FORMAT_V(1);
 
-/* Log a warning. */
+/* Log a warning.  Warnings from the same place are only shown the first 100
+ * times; how many more there were is reported at exit. */
 void mcell_warn(char const *fmt, ...) PRINTF_FORMAT(1);
 
 /* Log a warning (va_list version). */
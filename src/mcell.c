@@ -29,8 +29,10 @@
 #include "mcell_misc.h"
 #include "mcell_run.h"
 #include "init.h"
+#include "logging.h"
 
 #include "dump_state.h"
+#include "event_trace.h"
 #include "mcell3_world_converter.h"
 
 #define CHECKED_CALL_EXIT(function, error_message)                             \
@@ -90,6 +92,11 @@ int main(int argc, char **argv) {
   }
   //state->use_mcell4 = 1;
 
+  if (state->event_trace_file != NULL) {
+    CHECKED_CALL_EXIT(trace_open(state->event_trace_file),
+                      "Failed to start the event trace.");
+  }
+
   if (state->use_mcell4) {
     if (!mcell4_convert_mcell3_volume(state)) {
       exit(EXIT_FAILURE);
@@ -100,6 +107,10 @@ int main(int argc, char **argv) {
     mcell4_delete_world();
   }
   else {
+    /* Iteration reports and notifications are written in the background */
+    if (mcell_log_start_async())
+      mcell_warn("Could not start the log writer, logging directly.");
+
     CHECKED_CALL_EXIT(mcell_run_simulation(state),
                       "Error running mcell simulation.");
 
@@ -108,6 +119,9 @@ int main(int argc, char **argv) {
     }
 
     mcell_print_stats();
+    mcell_log_stop_async();
   }
+
+  CHECKED_CALL_EXIT(trace_close(), "Failed to write the event trace.");
   exit(0);
 }
@@ -47,6 +47,7 @@
 #include "mcell_init.h"
 #include "mcell_misc.h"
 #include "mcell_reactions.h"
+#include "react.h"
 #include "dyngeom.h"
 #include "chkpt.h"
 
@@ -177,6 +178,9 @@ MCELL_STATUS
 mcell_init_simulation(MCELL_STATE *state) {
   CHECKED_CALL(init_reactions(state), "Error initializing reactions.");
 
+  CHECKED_CALL(init_rate_changes(state),
+               "Error initializing time-varying reaction rates.");
+
   CHECKED_CALL(init_species(state), "Error initializing species.");
 
   if (has_micro_rev_and_trimol_rxns(state->species_list, state->n_species,
@@ -65,6 +65,43 @@ static struct output_column *
 get_counter_trigger_column(MCELL_STATE *state, const char *counter_name,
                            int column_id);
 
+/*************************************************************************
+ resolve_count_handle:
+  Find the counter holding the count of a molecule in a region.
+
+ In:  world - the instance world of the object volume.
+      mol_name - molecule you want the count of
+      reg_name - region where you want the count
+      handle - where to store the counter
+ Out: 0 on success, or the error code returned by mcell_get_count
+*************************************************************************/
+static int resolve_count_handle(struct volume *world, char *mol_name,
+                                char *reg_name, struct counter **handle) {
+  struct sym_entry *mol_sym = retrieve_sym(mol_name, world->mol_sym_table);
+  if (mol_sym == NULL)
+    return -5;
+  struct species *mol = mol_sym->value;
+
+  struct sym_entry *reg_sym = retrieve_sym(reg_name, world->reg_sym_table);
+  if (reg_sym == NULL)
+    return -6;
+  struct region *reg = reg_sym->value;
+
+  // Combine hash values for molecule in that region
+  int hash_bin = (mol->hashval + reg->hashval) & world->count_hashmask;
+  for (struct counter *c = world->count_hash[hash_bin]; c != NULL;
+       c = c->next) {
+    if (c->target == mol && c->reg_type == reg &&
+        (c->counter_type & MOL_COUNTER) &&
+        !(c->counter_type & TRIG_COUNTER)) {
+      *handle = c;
+      return 0;
+    }
+  }
+
+  return -7;
+}
+
 /*************************************************************************
  mcell_get_count:
   Get the count of a molecule in a certain region..
@@ -75,55 +112,112 @@ get_counter_trigger_column(MCELL_STATE *state, const char *counter_name,
 Out: int mol_count - count of molecule in the region
 *************************************************************************/
 int mcell_get_count(char *mol_name, char *reg_name, struct volume *world) {
-  // Get the hash values for mol and reg---------------// 
-
-  // Get hash value for molecule  
+  struct counter *c = NULL;
+  int status = resolve_count_handle(world, mol_name, reg_name, &c);
+  if (status != 0)
+    return status;
 
-  struct sym_entry *mol_sym = NULL;  
-  mol_sym = retrieve_sym(mol_name, world->mol_sym_table);
-
-  // Make sure mol_sym has been initialized. If not, return error code.
-  if (mol_sym == NULL)
-    return -5;
+  // Get the count of molecule in and on the region  
+  return c->data.move.n_enclosed + c->data.move.n_at;
+}
 
-  // Cast mol_sym (sym_entry, void pointer) to a species pointer
-  struct species *mol = mol_sym->value;
-  // Get hash value for molecule 
-  u_int mol_hashval = mol->hashval;
+/*************************************************************************
+ mcell_read_count_handles:
+  Read the current counts of many resolved counters at once.
 
-  // Get hash value for region
+ In:  handles - counters returned through mcell_count_set_add
+      n - number of handles
+      counts - caller-provided array of at least n entries
+ Out: counts[i] holds the count behind handles[i]
+*************************************************************************/
+void mcell_read_count_handles(struct counter *const *handles, int n,
+                              int *counts) {
+  for (int i = 0; i < n; i++)
+    counts[i] = handles[i]->data.move.n_enclosed + handles[i]->data.move.n_at;
+}
 
-  struct sym_entry *reg_sym = NULL;  
-  reg_sym = retrieve_sym(reg_name, world->reg_sym_table);
+/*************************************************************************
+ mcell_create_count_set:
+  Create an empty set of counter handles.  Counters live as long as the
+  world, so handles stay valid for the whole simulation.
 
-  // Make sure reg_sym has been initialized, if not return garbage
+ In:  expected - number of handles the caller intends to add; the counts
+                 array is only reallocated once this is exceeded.
+ Out: the new count set, or NULL if memory could not be allocated
+*************************************************************************/
+struct mcell_count_set *mcell_create_count_set(int expected) {
+  struct mcell_count_set *set = CHECKED_MALLOC_STRUCT_NODIE(
+      struct mcell_count_set, "count handle set");
+  if (set == NULL)
+    return NULL;
 
-  if (reg_sym == NULL)
-    return -6;  
- 
-  // Cast mol_sym (sym_entry,void pointer) to a species pointer 
-  struct region *reg = reg_sym->value;
-  // Get hash value for region
-  u_int reg_hashval = reg-> hashval;
+  set->n_handles = 0;
+  set->max_handles = (expected > 0) ? expected : 16;
+  set->handles = CHECKED_MALLOC_ARRAY_NODIE(struct counter *, set->max_handles,
+                                            "count handle set");
+  set->counts =
+      CHECKED_MALLOC_ARRAY_NODIE(int, set->max_handles, "count handle set");
+  if (set->handles == NULL || set->counts == NULL) {
+    mcell_destroy_count_set(set);
+    return NULL;
+  }
+  return set;
+}
 
-  //---------------------------------------------------//
+/*************************************************************************
+ mcell_count_set_add:
+  Resolve a (molecule, region) pair once and add it to a count set.
 
-  // Use the hash values to get the molecule count in the region from the count
-  // hash //
+ In:  world - the instance world of the object volume.
+      set - the count set
+      mol_name - molecule you want the count of
+      reg_name - region where you want the count
+ Out: index of the count in set->counts, or a negative error code (see
+      mcell_get_count, -1 if memory could not be allocated)
+*************************************************************************/
+int mcell_count_set_add(struct volume *world, struct mcell_count_set *set,
+                        char *mol_name, char *reg_name) {
+  struct counter *c = NULL;
+  int status = resolve_count_handle(world, mol_name, reg_name, &c);
+  if (status != 0)
+    return status;
+
+  if (set->n_handles == set->max_handles) {
+    int new_max = 2 * set->max_handles;
+    struct counter **handles = (struct counter **)realloc(
+        set->handles, new_max * sizeof(struct counter *));
+    if (handles == NULL)
+      return -1;
+    set->handles = handles;
+    int *counts = (int *)realloc(set->counts, new_max * sizeof(int));
+    if (counts == NULL)
+      return -1;
+    set->counts = counts;
+    set->max_handles = new_max;
+  }
 
-  // Combine hash values for molecule in that region
-  int hash_bin = (mol_hashval + reg_hashval) & world->count_hashmask;
- 
-  // Make sure hash_bin exists
-  if (world->count_hash[hash_bin] == NULL)
-    return -7;
+  set->handles[set->n_handles] = c;
+  set->counts[set->n_handles] = c->data.move.n_enclosed + c->data.move.n_at;
+  return set->n_handles++;
+}
 
-  // Get the count of molecule in and on the region  
-  int mol_count_vol = world->count_hash[hash_bin]->data.move.n_enclosed;
-  int mol_count_sur = world->count_hash[hash_bin]->data.move.n_at;
+/*************************************************************************
+ mcell_count_set_update:
+  Refresh set->counts from the counters.
 
-  return mol_count_vol + mol_count_sur;
+ In:  set - the count set
+ Out: set->counts holds the current counts
+*************************************************************************/
+void mcell_count_set_update(struct mcell_count_set *set) {
+  mcell_read_count_handles(set->handles, set->n_handles, set->counts);
+}
 
+void mcell_destroy_count_set(struct mcell_count_set *set) {
+  if (set == NULL)
+    return;
+  free(set->handles);
+  free(set->counts);
+  free(set);
 }
 
 
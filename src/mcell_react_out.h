@@ -43,6 +43,27 @@ struct output_times_inlist {
 
 int mcell_get_count(char *mol_name, char *reg_name, struct volume *world);
 
+/* Counter handles resolved once and read in bulk. set->counts is only
+ * reallocated when more than the expected number of handles are added. */
+struct mcell_count_set {
+  int n_handles;
+  int max_handles;
+  struct counter **handles;
+  int *counts;
+};
+
+void mcell_read_count_handles(struct counter *const *handles, int n,
+                              int *counts);
+
+struct mcell_count_set *mcell_create_count_set(int expected);
+
+int mcell_count_set_add(struct volume *world, struct mcell_count_set *set,
+                        char *mol_name, char *reg_name);
+
+void mcell_count_set_update(struct mcell_count_set *set);
+
+void mcell_destroy_count_set(struct mcell_count_set *set);
+
 struct output_request *mcell_new_output_request(MCELL_STATE *state,
                                                 struct sym_entry *target,
                                                 short orientation,
@@ -40,6 +40,34 @@ struct output_times_inlist {
 
 int mcell_get_count(char *mol_name, char *reg_name, struct volume *world);
 
+/* Counter handles resolved once and read in bulk. set->counts is only
+ * reallocated when more than the expected number of handles are added. */
+struct mcell_count_set {
+  int n_handles;
+  int max_handles;
+  struct counter **handles;
+  int *counts;
+};
+
+struct mcell_count_set *mcell_create_count_set(int expected);
+
+int mcell_count_set_add(struct volume *world, struct mcell_count_set *set,
+                        char *mol_name, char *reg_name);
+
+void mcell_count_set_update(struct mcell_count_set *set);
+
+void mcell_destroy_count_set(struct mcell_count_set *set);
+
+%inline %{
+/* Read-only view of set->counts without copying, e.g. for
+ * numpy.frombuffer(view, dtype=numpy.intc).  The view is invalidated when
+ * the set grows past the expected number of handles. */
+PyObject *mcell_count_set_view(struct mcell_count_set *set) {
+  return PyMemoryView_FromMemory((char *)set->counts,
+                                 set->n_handles * sizeof(int), PyBUF_READ);
+}
+%}
+
 struct output_request *mcell_new_output_request(MCELL_STATE *state,
                                                 struct sym_entry *target,
                                                 short orientation,
@@ -211,6 +211,7 @@ mcell_modify_multiple_rate_constants(struct volume *world, char **names, double
     }
     reaction->max_fixed_p += delta_prob;
     reaction->min_noreaction_p += delta_prob;
+    update_pathway_alias(reaction);
 
     // Go to the next reaction that needs to be changed
     i_rxn++;
@@ -385,6 +386,7 @@ mcell_modify_rate_constant(struct volume *world, char *name, double rate_constan
     }
     reaction->max_fixed_p += delta_prob;
     reaction->min_noreaction_p += delta_prob;
+    update_pathway_alias(reaction);
  
     // Print if the flags are set
     /*
@@ -1393,6 +1395,7 @@ int init_reactions(MCELL_STATE *state) {
               ccd->n_sides = 0;
               ccd->side_idx = NULL;
               ccd->cum_area = NULL;
+              ccd->side_alias = NULL;
               ccd->scaling_factor = 0.0;
               ccd->next = state->clamp_list;
               state->clamp_list = ccd;
@@ -1557,6 +1560,9 @@ int init_reactions(MCELL_STATE *state) {
         else
           rx->min_noreaction_p = rx->max_fixed_p = 1.0;
 
+        if (!state->bisect_pathways && init_pathway_alias(rx))
+          return MCELL_FAIL;
+
         rx = rx->next;
       }
     }
@@ -3193,6 +3199,7 @@ static struct rxn *create_sibling_reaction(struct rxn *rx) {
   reaction->get_reactant_diffusion = rx->get_reactant_diffusion;
   reaction->n_pathways = 0;
   reaction->cum_probs = NULL;
+  reaction->pathway_alias = NULL;
   reaction->product_idx = NULL;
   reaction->max_fixed_p = 0.0;
   reaction->min_noreaction_p = 0.0;
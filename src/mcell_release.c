@@ -570,6 +570,7 @@ int mcell_set_release_site_geometry_region(
   rel_reg_data->owners = NULL;
   rel_reg_data->in_release = NULL;
   rel_reg_data->self = obj_ptr;
+  rel_reg_data->voxels = NULL;
 
   rel_reg_data->expression = rel_eval;
 
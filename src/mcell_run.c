@@ -48,6 +48,9 @@
 #include <nfsim_c.h>
 #include "mcell_reactions.h"
 #include "mcell_react_out.h"
+#include "react.h"
+#include "phase_profile.h"
+#include "work_counters.h"
 
 #include "dump_state.h"
 
@@ -88,6 +91,7 @@ static void process_volume_output(struct volume *wrld, double not_yet) {
  ***********************************************************************/
 static void process_reaction_output(struct volume *wrld, double not_yet) {
   struct output_block *obp;
+  int n_outputs = 0;
   
   for (obp = schedule_next(wrld->count_scheduler);
        obp != NULL || not_yet >= wrld->count_scheduler->now;
@@ -99,11 +103,19 @@ static void process_reaction_output(struct volume *wrld, double not_yet) {
       logNFSimObservables_c(wrld->current_iterations * wrld->time_unit);
     if (update_reaction_output(wrld, obp))
       mcell_error("Failed to update reaction output.");
+    ++n_outputs;
   }
   if (wrld->count_scheduler->error)
     mcell_internal_error("Scheduler reported an out-of-memory error while "
                          "retrieving next scheduled reaction output, but this "
                          "should never happen.");
+
+#ifdef MCELL_WORK_COUNTERS
+  if (n_outputs > 0 && work_counters_output(wrld))
+    mcell_warn("Failed to write work counters.");
+#else
+  (void)n_outputs;
+#endif
 }
 
 /***********************************************************************
@@ -216,19 +228,21 @@ static int make_checkpoint(struct volume *wrld) {
   create_chkpt(wrld, wrld->chkpt_outfile);
   wrld->last_checkpoint_iteration = wrld->current_iterations;
 
-  /* Break out of the loop, if appropriate */
+  /* Break out of the loop, if appropriate.  A streamed checkpoint has to be
+   * complete before we stop. */
   if (wrld->checkpoint_requested == CHKPT_ALARM_EXIT ||
       wrld->checkpoint_requested == CHKPT_SIGNAL_EXIT ||
-      wrld->checkpoint_requested == CHKPT_ITERATIONS_EXIT)
+      wrld->checkpoint_requested == CHKPT_ITERATIONS_EXIT ||
+      (wrld->checkpoint_requested == CHKPT_ALARM_CONT &&
+       !wrld->continue_after_checkpoint)) {
+    if (finish_chkpt_writer(wrld))
+      mcell_error("Failed to write checkpoint file %s", wrld->chkpt_outfile);
     return 1;
+  }
 
   /* Schedule the next checkpoint, if appropriate */
-  if (wrld->checkpoint_requested == CHKPT_ALARM_CONT) {
-    if (wrld->continue_after_checkpoint)
-      alarm(wrld->checkpoint_alarm_time);
-    else
-      return 1;
-  }
+  if (wrld->checkpoint_requested == CHKPT_ALARM_CONT)
+    alarm(wrld->checkpoint_alarm_time);
 
   wrld->checkpoint_requested = CHKPT_NOT_REQUESTED;
   return 0;
@@ -409,6 +423,10 @@ mcell_run_iteration(MCELL_STATE *world, long long frequency,
                     int *restarted_from_checkpoint) {
   emergency_output_hook_enabled = 1;
 
+  if (world->profile_file != NULL && mcell_profile == NULL &&
+      profile_init(world))
+    mcell_allocfailed("Failed to set up the phase profiler.");
+
   long long iter_report_phase = world->current_iterations % frequency;
   double not_yet = world->current_iterations + 1.0;
 
@@ -417,24 +435,39 @@ mcell_run_iteration(MCELL_STATE *world, long long frequency,
   else
     world->elapsed_time = 1.0;
 
+  /* Apply the reaction rate changes which are due */
+  apply_rate_changes(world, world->current_iterations);
+
   if (!*restarted_from_checkpoint) {
 
     /* Change geometry if needed */
+    PROFILE_BEGIN(PROF_GEOMETRY_CHANGES, t_geometry);
     process_geometry_changes(world, not_yet);
+    PROFILE_END(PROF_GEOMETRY_CHANGES, t_geometry);
 
     /* Release molecules */
+    PROFILE_BEGIN(PROF_RELEASES, t_releases);
     process_molecule_releases(world, not_yet);
+    PROFILE_END(PROF_RELEASES, t_releases);
 
     //dump_volume(world, "after release", DUMP_EVERYTHING);
 
     /* Produce output */
+    PROFILE_BEGIN(PROF_REACTION_OUTPUT, t_reaction_output);
     process_reaction_output(world, not_yet);
+    PROFILE_END(PROF_REACTION_OUTPUT, t_reaction_output);
+
+    PROFILE_BEGIN(PROF_VOLUME_OUTPUT, t_volume_output);
     process_volume_output(world, not_yet);
+    PROFILE_END(PROF_VOLUME_OUTPUT, t_volume_output);
+
+    PROFILE_BEGIN(PROF_VIZ_OUTPUT, t_viz_output);
     for (struct viz_output_block *vizblk = world->viz_blocks; vizblk != NULL;
          vizblk = vizblk->next) {
       if (vizblk->frame_data_head && update_frame_data_list(world, vizblk))
         mcell_error("Unknown error while updating frame data list.");
     }
+    PROFILE_END(PROF_VIZ_OUTPUT, t_viz_output);
 
     /* Produce iteration report */
     if (iter_report_phase == 0 &&
@@ -450,14 +483,23 @@ mcell_run_iteration(MCELL_STATE *world, long long frequency,
               (double)(cur_time.tv_sec - world->last_timing_time.tv_sec) *
                   1000000.0 +
               (double)(cur_time.tv_usec - world->last_timing_time.tv_usec);
-          time_diff /= (double)(world->current_iterations - world->last_timing_iteration);
+          long long n_iters =
+              world->current_iterations - world->last_timing_iteration;
+          time_diff /= (double)n_iters;
           mcell_log_raw(" (%.6lg iter/sec)", 1000000.0 / time_diff);
+          if (world->clamp_list != NULL) {
+            mcell_log_raw(" (clamp: %.6lg ms/iter, %lld molecules)",
+                          1000.0 * world->clamp_time / (double)n_iters,
+                          world->clamp_emitted);
+          }
           world->last_timing_iteration = world->current_iterations;
           world->last_timing_time = cur_time;
         } else {
           world->last_timing_iteration = world->current_iterations;
           world->last_timing_time = cur_time;
         }
+        world->clamp_time = 0.0;
+        world->clamp_emitted = 0;
       }
       if (world->nfsim_flag){
         mcell_log_raw(" | NFSim info: [");
@@ -504,7 +546,20 @@ mcell_run_iteration(MCELL_STATE *world, long long frequency,
   // reset this flag to zero
   *restarted_from_checkpoint = 0;
 
-  run_concentration_clamp(world, world->current_iterations);
+  PROFILE_BEGIN(PROF_CONCENTRATION_CLAMP, t_clamp);
+  if (world->clamp_list != NULL &&
+      world->notify->throughput_report != NOTIFY_NONE) {
+    struct timeval clamp_start, clamp_end;
+    gettimeofday(&clamp_start, NULL);
+    run_concentration_clamp(world, world->current_iterations);
+    gettimeofday(&clamp_end, NULL);
+    world->clamp_time +=
+        (double)(clamp_end.tv_sec - clamp_start.tv_sec) +
+        (double)(clamp_end.tv_usec - clamp_start.tv_usec) / 1000000.0;
+  } else {
+    run_concentration_clamp(world, world->current_iterations);
+  }
+  PROFILE_END(PROF_CONCENTRATION_CLAMP, t_clamp);
 
   double next_release_time;
   if (!schedule_anticipate(world->releaser, &next_release_time))
@@ -525,11 +580,15 @@ mcell_run_iteration(MCELL_STATE *world, long long frequency,
     int done = 0;
     while (!done) {
       done = 1;
+      int i_storage = 0;
       for (struct storage_list *local = world->storage_head; local != NULL;
-           local = local->next) {
+           local = local->next, i_storage++) {
         if (local->store->timer->current != NULL) {
+          double t_timestep = (mcell_profile != NULL) ? profile_now() : -1.0;
           run_timestep(world, local->store, next_barrier,
                        (double)world->iterations + 1.0);
+          if (t_timestep >= 0.0)
+            profile_storage_add(mcell_profile, i_storage, t_timestep);
           done = 0;
         }
       }
@@ -547,6 +606,12 @@ mcell_run_iteration(MCELL_STATE *world, long long frequency,
 
   world->current_iterations++;
 
+  if (mcell_profile != NULL && mcell_profile->dump_interval > 0 &&
+      (world->current_iterations - mcell_profile->first_iteration) %
+              mcell_profile->dump_interval == 0 &&
+      profile_dump(world))
+    mcell_warn("Failed to write the phase profile.");
+
   return 0;
 }
 
@@ -595,6 +660,11 @@ mcell_flush_data(MCELL_STATE *world) {
     status = make_checkpoint(world);
   }
 
+  if (finish_chkpt_writer(world)) {
+    mcell_warn("Failed to write checkpoint file %s.", world->chkpt_outfile);
+    status = 1;
+  }
+
   emergency_output_hook_enabled = 0;
   int num_errors = flush_reaction_output(world);
   if (num_errors != 0) {
@@ -604,6 +674,19 @@ mcell_flush_data(MCELL_STATE *world) {
     status = 1;
   }
 
+  num_errors = flush_volume_output(world);
+  if (num_errors != 0) {
+    mcell_warn("%d errors occurred while writing volume output.\n"
+               "  Simulation complete anyway--continuing as normal.",
+               num_errors);
+    status = 1;
+  }
+
+  if (profile_dump(world)) {
+    mcell_warn("Failed to write the phase profile.");
+    status = 1;
+  }
+
   if (world->notify->progress_report != NOTIFY_NONE)
     mcell_log("Exiting run loop.");
 
@@ -522,6 +522,21 @@ enum output_timer_type_t {
   OUTPUT_BY_ITERATION_LIST,
 };
 
+/* File formats for VOLUME_DATA_OUTPUT */
+enum volume_output_format_t {
+  VOLUME_OUTPUT_TEXT,   /* Text, one slab after another */
+  VOLUME_OUTPUT_BINARY, /* Binary array of all voxel counts */
+  VOLUME_OUTPUT_SPARSE, /* Binary list of non-empty voxels */
+};
+
+/* Checkpoint file formats */
+enum chkpt_format_t {
+  CHKPT_FORMAT_CLASSIC,           /* Molecules written field by field */
+  CHKPT_FORMAT_STREAM,            /* Snapshot written in chunks in the
+                                     background */
+  CHKPT_FORMAT_STREAM_COMPRESSED, /* As above, chunks compressed with zlib */
+};
+
 /* Visualization modes. */
 enum viz_mode_t {
   NO_VIZ_MODE,
@@ -593,6 +608,16 @@ struct per_species_list {
   struct species *properties;    /* species for items in this bin */
   struct volume_molecule *head;  /* linked list of mols */
 
+  /* Contiguous copy of the molecules in this bin.  Only maintained when the
+     subvolume has species arrays enabled; positions are stored per axis so
+     that neighbor scans can test many molecules at once. */
+  struct volume_molecule **mols;
+  double *pos_x;
+  double *pos_y;
+  double *pos_z;
+  int n_mols;   /* number of used slots */
+  int max_mols; /* number of allocated slots */
+
   //JJT: nfsim related fields
   struct graph_data* graph_data;
 };
@@ -640,6 +665,9 @@ struct rxn {
   int n_pathways;    /* How many pathways lead away? (Negative = special
                         reaction, i.e. transparent etc...) */
   double *cum_probs; /* Cumulative probabilities for (entering) all pathways */
+  struct alias_table *pathway_alias; /* Picks a pathway in O(1) for reactions
+                                        with many pathways, or NULL to bisect
+                                        cum_probs */
   double max_fixed_p;          /* Maximum 'p' for region of p-space for all
                                   non-cooperative pathways */
   double min_noreaction_p; /* Minimum 'p' for region of p-space which is always
@@ -800,6 +828,12 @@ struct volume_molecule {
 
   struct volume_molecule **prev_v; /* Previous molecule in this subvolume */
   struct volume_molecule *next_v;  /* Next molecule in this subvolume */
+
+  struct per_species_list *psl; /* Species array we are stored in (or NULL) */
+  int psl_index;                /* Our slot in the species array */
+
+  int nbr_cell; /* Our cell in the subvolume's neighbor table, or -1 */
+  int nbr_slot; /* Our slot in that cell */
 };
 
 /* Fixed molecule on a grid on a surface */
@@ -867,6 +901,24 @@ struct edge {
   double length_1; /* Reciprocal of length of shared edge */
 };
 
+/* Edge crossing data of one wall edge, seen from that wall: the edge
+   transform already resolved for its direction, and the wall behind it */
+struct wall_edge_xform {
+  struct wall *nb_wall;     /* Wall across the edge, or NULL */
+  int inverse;              /* Apply the transform backwards (we are the
+                               edge's backward wall) */
+  double cos_theta;         /* Copies of the edge transform */
+  double sin_theta;
+  struct vector2 translate;
+};
+
+/* Everything 2D diffusion needs to leave a wall, in one contiguous record */
+struct wall_xform {
+  struct wall_edge_xform edge[3];
+  struct vector2 reflector[3]; /* Unit normals of edges 1 and 2 (edge 0 is
+                                  along u), for reflections */
+};
+
 struct wall {
   struct wall *next; /* Next wall in the universe */
 
@@ -884,6 +936,7 @@ struct wall {
 
   struct edge *edges[3];    /* Array of pointers to each edge. */
   struct wall *nb_walls[3]; /* Array of pointers to walls that share an edge*/
+  struct wall_xform xform;   /* Edge crossings, set when edges are added */
 
   double area; /* Area of this element */
 
@@ -964,6 +1017,14 @@ struct waypoint {
 };
 
 /* Contains local memory and scheduler for molecules, walls, wall_lists, etc. */
+/* Reusable contiguous storage for the collisions found along one ray */
+struct collision_buffer {
+  struct collision *items;  /* Collisions in the order they were found */
+  struct collision **order; /* Sorted by time (twice max_items, for sorting) */
+  int n_items;              /* Collisions currently held */
+  int max_items;            /* Allocated length of items */
+};
+
 struct storage {
   struct mem_helper *list;    /* Wall lists */
   struct mem_helper *mol;     /* Molecules */
@@ -986,6 +1047,12 @@ struct storage {
   struct schedule_helper *timer; /* Local scheduler */
   double current_time;           /* Local time */
   double max_timestep;           /* Local maximum timestep */
+
+  struct collision_buffer ray_hits; /* Collisions of the ray being traced by
+                                       diffuse_3D */
+
+  struct work_counters *work; /* Per-species and per-subvolume work done here,
+                                 see work_counters.h */
 };
 
 /* Linked list of storage areas. */
@@ -994,9 +1061,33 @@ struct storage_list {
   struct storage *store;
 };
 
+/* One cell of a neighbor table */
+struct nbr_cell {
+  struct volume_molecule **mols;
+  int n_mols;
+  int max_mols;
+};
+
+/* Cell list over the volume molecules of a subvolume which can take part in
+   mol-mol[-*] reactions.  Built when a molecule with trimolecular reactions
+   first looks for collision partners in the subvolume, then kept up to date
+   as molecules enter, leave and move; see diffuse_3D_big_list. */
+struct nbr_table {
+  int nx, ny, nz;          /* number of cells along each axis */
+  struct vector3 llf;      /* lower left front corner of the subvolume */
+  struct vector3 r_edge;   /* reciprocals of the cell edge lengths */
+  struct nbr_cell *cells;  /* nx * ny * nz cells, z fastest */
+  int n_mols;              /* molecules in all cells */
+  int built_n_mols;        /* molecules when the cells were laid out */
+  long long iteration;     /* when the size was last checked */
+};
+
 /* Walls and molecules in a spatial subvolume */
 struct subvolume {
   struct wall_list *wall_head; /* Head of linked list of intersecting walls */
+  struct wall **walls; /* Contiguous array of the same walls (wall_head lists
+                          them in reverse order) */
+  int n_walls;         /* Number of intersecting walls */
 
   struct pointer_hash mol_by_species; /* table of species->molecule list */
   struct per_species_list *species_head;
@@ -1007,6 +1098,9 @@ struct subvolume {
 
   short world_edge; /* Direction Bit Flags that are set for SSVs at edge of
                        world */
+  byte use_species_arrays; /* If set, per-species lists also keep contiguous
+                              molecule/position arrays */
+  struct nbr_table *nbr_table; /* Trimolecular partner cells, or NULL */
 
   struct storage *local_storage; /* Local memory and scheduler */
 };
@@ -1136,6 +1230,8 @@ struct volume {
 
   int n_subvols;            /* How many coarse subvolumes? */
   struct subvolume *subvol; /* Array containing all subvolumes */
+  struct wall **subvol_walls; /* Storage for the wall arrays of all
+                                 subvolumes */
 
   int n_walls;                  /* Total number of walls */
   int n_verts;                  /* Total number of vertices */
@@ -1149,6 +1245,11 @@ struct volume {
   int n_reactions;            /* How many reactions are there, total? */
   struct rxn **reaction_hash; /* A hash table of all reactions. */
   struct mem_helper *tv_rxn_mem; /* Memory to store time-varying reactions */
+  /* Reactions with time-varying rates, and the earliest time at which one of
+   * their rates changes next (see process_rate_changes) */
+  int n_time_varying_rxns;
+  struct rxn **time_varying_rxns;
+  double next_rate_change;
 
   int count_hashmask;          /* Mask for looking up count hash table */
   struct counter **count_hash; /* Count hash table */
@@ -1170,6 +1271,9 @@ struct volume {
   // This is used to skip over certain sections in the parser when using
   // dynamic geometries.
   int dynamic_geometry_flag;  
+  // Bumped whenever dynamic geometry replaces the walls, so that data derived
+  // from the old walls can tell it is stale.
+  unsigned int geometry_generation;
   int disable_polygon_objects;  
 
   // List of all the dynamic geometry events that need to be scheduled
@@ -1210,6 +1314,10 @@ struct volume {
 
   struct volume_output_item *volume_output_head; /* List of all volume data
                                                     output items */
+  enum volume_output_format_t volume_output_format; /* Format of volume data
+                                                       output files */
+  struct volume_output_writer *volume_output_writer; /* Background writer of
+                                                        binary volume output */
 
   struct output_block *
   output_block_head; /* Global list of reaction data output blocks */
@@ -1272,6 +1380,12 @@ struct volume {
 
   char *chkpt_infile;              /* Name of checkpoint file to read from */
   char *chkpt_outfile;             /* Name of checkpoint file to write to */
+  enum chkpt_format_t chkpt_format; /* How checkpoints are written */
+  struct chkpt_writer *chkpt_writer; /* Background writer of the most recent
+                                        streamed checkpoint */
+  int chkpt_delta_interval; /* Incremental checkpoints between full ones */
+  struct chkpt_chain *chkpt_chain; /* Base and last snapshot of the current
+                                      chain of incremental checkpoints */
   u_int chkpt_byte_order_mismatch; /* Flag that defines whether mismatch in
                                       byte order exists between the saved
                                       checkpoint file and the machine reading
@@ -1320,6 +1434,22 @@ struct volume {
   long long start_iterations; 
   struct timeval last_timing_time; /* time and iteration of last timing event */
   long long last_timing_iteration; /* during the main run_iteration loop */
+  double clamp_time;       /* seconds spent clamping since last timing event */
+  long long clamp_emitted; /* molecules clamped since last timing event */
+  double *clamp_uniforms;  /* scratch space for one batch of clamp draws */
+  uint32_t *clamp_sides;
+  int clamp_scratch_size;
+
+  /* Phase profiler (-profile) */
+  char *profile_file;         /* JSON report, or NULL if not profiling */
+  long long profile_interval; /* iterations between reports, 0: at exit */
+
+  /* Binary event trace (-event_trace), or NULL if not tracing */
+  char *event_trace_file;
+
+  /* Work counters folded in from freed storages and not yet written (only
+   * used when built with MCELL_WORK_COUNTERS) */
+  struct work_counters *work_totals;
 
   int procnum;          /* Processor number for a parallel run */
   int quiet_flag;       /* Quiet mode */
@@ -1336,6 +1466,11 @@ struct volume {
 
   int use_expanded_list; /* If set, check neighboring subvolumes for mol-mol
                             interactions */
+  int use_species_arrays; /* If set, subvolumes keep contiguous per-species
+                             molecule arrays for neighbor scans */
+  int bisect_pathways; /* If set, pick reaction pathways by bisecting
+                          cum_probs as older versions did, rather than with
+                          alias tables */
   int randomize_smol_pos; /* If set, always place surface molecule at random
                              location instead of center of grid */
   double vacancy_search_dist2; /* Square of distance to search for free grid
@@ -1553,6 +1688,9 @@ struct release_region_data {
   struct release_evaluator *expression; /* A set-construction expression
                                            combining regions to form this
                                            release site */
+  struct release_voxel_cache *voxels; /* Inside/outside classification of the
+                                         bounding box, built on the first
+                                         release (see vol_util.c) */
 };
 
 /* Data structure used to build boolean combinations of regions */
@@ -1639,6 +1777,7 @@ struct ccn_clamp_data {
   int n_sides;                /* How many walls? */
   int *side_idx;              /* Indices of the walls that are clamped */
   double *cum_area;           /* Cumulative area of all the clamped walls */
+  struct alias_table *side_alias; /* Area-weighted wall sampler */
   double scaling_factor;      /* Used to predict #mols/timestep */
   struct ccn_clamp_data *next_mol; /* Next clamp, by molecule, for this class */
   struct ccn_clamp_data *next_obj; /* Next clamp, by object, for this class */
@@ -2015,10 +2154,23 @@ struct file_stream {
 
 /* Symbol hash table */
 /* Used to parse and store user defined symbols from the MDL input file */
+/* The symbols are found through an open-addressed index which grows a few
+   slots at a time.  They are also chained in n_bins bins ('entries'), laid
+   out exactly as in the chained hash table this index replaced, so that code
+   walking the table sees the symbols in the same order as before. */
 struct sym_table_head {
-  struct sym_entry **entries;
+  struct sym_entry **entries; /* n_bins chains of symbols, for walking */
   int n_entries;
   int n_bins;
+
+  struct sym_slot *slots;     /* Index, n_slots (a power of two) long */
+  int n_slots;
+  struct sym_slot *old_slots; /* Index before growing, while its symbols are
+                                 still being moved over, or NULL */
+  int n_old_slots;
+  int n_moved;                /* Slots of old_slots moved so far */
+
+  struct sym_name_block *names; /* Storage for the symbol names */
 };
 
 /* Symbol hash table entry */
@@ -277,6 +277,7 @@ struct arg_list printfargs;
 %token       MOLECULE_DENSITY
 %token       MOLECULE_NUMBER
 %token       MOLECULE_POSITIONS
+%token       MOLECULE_POSITIONS_FILE
 %token       MOLECULES
 %token       MOLECULE_PLACEMENT_FAILURE
 %token       NAME_LIST
@@ -1710,6 +1711,7 @@ release_site_cmd:
           existing_release_pattern_xor_rxpn           { CHECK(mdl_set_release_site_pattern(parse_state, parse_state->current_release_site, $3)); }
         | MOLECULE_POSITIONS
           '{' molecule_release_pos_list '}'           { CHECK(mdl_set_release_site_molecule_positions(parse_state, parse_state->current_release_site, & $3)); }
+        | MOLECULE_POSITIONS_FILE '=' file_name       { CHECK(mdl_set_release_site_molecule_positions_file(parse_state, parse_state->current_release_site, $3)); }
         | GRAPH_PATTERN '=' str_expr                    {CHECK(mdl_set_release_site_graph_pattern(parse_state, parse_state->current_release_site,  $3)); }
 ;
 
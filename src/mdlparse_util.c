@@ -3399,6 +3399,7 @@ duplicate_release_site(struct mdlparse_vars *parse_state,
     rel_reg_data->owners = NULL;
     rel_reg_data->in_release = NULL;
     rel_reg_data->self = new_self;
+    rel_reg_data->voxels = NULL;
 
     rel_reg_data->expression =
         duplicate_rel_region_expr(parse_state, old->region_data->expression,
@@ -4859,6 +4860,7 @@ mdl_set_release_site_geometry_object(struct mdlparse_vars *parse_state,
   rel_reg_data->owners = NULL;
   rel_reg_data->in_release = NULL;
   rel_reg_data->self = parse_state->current_object;
+  rel_reg_data->voxels = NULL;
   rel_reg_data->expression = rel_eval;
   rel_site_obj_ptr->region_data = rel_reg_data;
 
@@ -5228,6 +5230,224 @@ mdl_new_release_single_molecule(struct mdlparse_vars *parse_state,
   return rsm;
 }
 
+/* Binary molecule position files (MOLECULE_POSITIONS_FILE), in native byte
+ * order: a struct mol_pos_file_header, then n_species names, each a uint32_t
+ * length followed by that many characters, then n_molecules struct
+ * mol_pos_records.  Positions are in the same units as in
+ * MOLECULE_POSITIONS; orient is positive for ', negative for , and 0 if no
+ * orientation is given. */
+#define MOL_POS_FILE_MAGIC "MCLIST\0\0"
+#define MOL_POS_FILE_VERSION 1
+#define MOL_POS_FILE_CHUNK 4096 /* records read at once */
+
+struct mol_pos_file_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t n_species;
+  uint64_t n_molecules;
+};
+
+struct mol_pos_record {
+  uint32_t species; /* index into the names */
+  int32_t orient;
+  double pos[3];
+};
+
+/**************************************************************************
+ read_mol_pos_species:
+    Read the species names of a binary molecule position file.
+
+ In: parse_state: parser state
+     f: the file, positioned after the header
+     path: its name, for error messages
+     n_species: number of names
+     species: filled with the species symbols
+ Out: 0 on success, 1 on failure
+**************************************************************************/
+static int read_mol_pos_species(struct mdlparse_vars *parse_state, FILE *f,
+                                char const *path, uint32_t n_species,
+                                struct sym_entry **species) {
+  for (uint32_t i = 0; i < n_species; i++) {
+    uint32_t len;
+    if (fread(&len, sizeof(len), 1, f) != 1 || len == 0 || len > 65536) {
+      mdlerror_fmt(parse_state, "Invalid species name in molecule position "
+                                "file '%s'", path);
+      return 1;
+    }
+    char *name = CHECKED_MALLOC_ARRAY(char, len + 1, "species name");
+    if (fread(name, 1, len, f) != len) {
+      mdlerror_fmt(parse_state, "Invalid species name in molecule position "
+                                "file '%s'", path);
+      free(name);
+      return 1;
+    }
+    name[len] = '\0';
+    species[i] = mdl_existing_molecule(parse_state, name);
+    if (species[i] == NULL)
+      return 1;
+  }
+  return 0;
+}
+
+/**************************************************************************
+ mdl_set_release_site_molecule_positions_file:
+    Set the molecule positions for a LIST release from a binary file, for
+    lists too long to be written out in MDL.  The file is found like an
+    INCLUDE_FILE; see struct mol_pos_file_header for its layout.
+
+ In: parse_state: parser state
+     rel_site_obj_ptr: the release site
+     name: name of the file
+ Out: 0 on success, 1 on failure
+**************************************************************************/
+int mdl_set_release_site_molecule_positions_file(
+    struct mdlparse_vars *parse_state,
+    struct release_site_obj *rel_site_obj_ptr, char *name) {
+  if (rel_site_obj_ptr->release_shape != SHAPE_LIST) {
+    mdlerror(parse_state,
+             "You must use the LIST shape to specify molecule positions in a "
+             "release.");
+    free(name);
+    return 1;
+  }
+
+  char *path = mcell_find_include_file(name, parse_state->vol->curr_file);
+  free(name);
+  if (path == NULL) {
+    mdlerror(parse_state, "Out of memory while reading molecule positions");
+    return 1;
+  }
+
+  FILE *f = fopen(path, "rb");
+  if (f == NULL) {
+    mdlerror_fmt(parse_state, "Cannot open file: %s", path);
+    free(path);
+    return 1;
+  }
+
+  int failure = 1;
+  struct sym_entry **species = NULL;
+  unsigned char *checked = NULL;
+  struct release_single_molecule *rsms = NULL;
+  struct mol_pos_record *chunk = NULL;
+
+  struct mol_pos_file_header header;
+  if (fread(&header, sizeof(header), 1, f) != 1 ||
+      memcmp(header.magic, MOL_POS_FILE_MAGIC, sizeof(header.magic)) != 0) {
+    mdlerror_fmt(parse_state, "'%s' is not a molecule position file", path);
+    goto done;
+  }
+  if (header.version != MOL_POS_FILE_VERSION) {
+    mdlerror_fmt(parse_state,
+                 "Molecule position file '%s' has version %u, expected %u",
+                 path, header.version, MOL_POS_FILE_VERSION);
+    goto done;
+  }
+  if (header.n_species == 0 || header.n_molecules == 0 ||
+      header.n_molecules > (uint64_t)INT_MAX) {
+    mdlerror_fmt(parse_state, "Molecule position file '%s' holds %u species "
+                              "and %llu molecules",
+                 path, header.n_species,
+                 (unsigned long long)header.n_molecules);
+    goto done;
+  }
+
+  /* Every species name takes its length and at least one character, so the
+   * counts can be checked against the size of the file before allocating */
+  struct stat file_stat;
+  if (fstat(fileno(f), &file_stat) != 0) {
+    mdlerror_fmt(parse_state, "Cannot get the size of file: %s", path);
+    goto done;
+  }
+  uint64_t min_size =
+      sizeof(header) + (uint64_t)header.n_species * (sizeof(uint32_t) + 1) +
+      header.n_molecules * sizeof(struct mol_pos_record);
+  if ((uint64_t)file_stat.st_size < min_size) {
+    mdlerror_fmt(parse_state, "Molecule position file '%s' is too short for "
+                              "its %u species and %llu molecules",
+                 path, header.n_species,
+                 (unsigned long long)header.n_molecules);
+    goto done;
+  }
+
+  species = CHECKED_MALLOC_ARRAY(struct sym_entry *, header.n_species,
+                                 "molecule position file species");
+  if (read_mol_pos_species(parse_state, f, path, header.n_species, species))
+    goto done;
+
+  /* Each species is checked once with and once without orientation, which
+   * is what mdl_new_release_single_molecule would report */
+  checked = CHECKED_MALLOC_ARRAY(unsigned char, header.n_species,
+                                 "molecule position file species");
+  memset(checked, 0, header.n_species);
+
+  int n = (int)header.n_molecules;
+  rsms = CHECKED_MALLOC_ARRAY(struct release_single_molecule, n,
+                              "release site molecule positions");
+  chunk = CHECKED_MALLOC_ARRAY(struct mol_pos_record, MOL_POS_FILE_CHUNK,
+                               "molecule position records");
+  double r_length_unit = parse_state->vol->r_length_unit;
+  for (int first = 0; first < n; first += MOL_POS_FILE_CHUNK) {
+    int n_chunk = (n - first < MOL_POS_FILE_CHUNK) ? n - first
+                                                   : MOL_POS_FILE_CHUNK;
+    if (fread(chunk, sizeof(struct mol_pos_record), n_chunk, f) !=
+        (size_t)n_chunk) {
+      mdlerror_fmt(parse_state, "Molecule position file '%s' ends after %d "
+                                "of %d molecules",
+                   path, first, n);
+      goto done;
+    }
+
+    for (int k = 0; k < n_chunk; k++) {
+      struct mol_pos_record *rec = &chunk[k];
+      if (rec->species >= header.n_species) {
+        mdlerror_fmt(parse_state, "Molecule %d in '%s' has invalid species "
+                                  "index %u",
+                     first + k, path, rec->species);
+        goto done;
+      }
+
+      unsigned char check = (rec->orient != 0) ? 2 : 1;
+      if ((checked[rec->species] & check) == 0) {
+        struct mcell_species mol_type;
+        mol_type.next = NULL;
+        mol_type.mol_type = species[rec->species];
+        mol_type.orient_set = (rec->orient != 0);
+        mol_type.orient = (short)rec->orient;
+        if (mdl_check_valid_molecule_release(parse_state, &mol_type))
+          goto done;
+        checked[rec->species] |= check;
+      }
+
+      struct release_single_molecule *rsm = &rsms[first + k];
+      rsm->orient = (rec->orient > 0) ? 1 : ((rec->orient < 0) ? -1 : 0);
+      rsm->loc.x = rec->pos[0] * r_length_unit;
+      rsm->loc.y = rec->pos[1] * r_length_unit;
+      rsm->loc.z = rec->pos[2] * r_length_unit;
+      rsm->mol_type = (struct species *)species[rec->species]->value;
+      rsm->next = (first + k + 1 < n) ? &rsms[first + k + 1] : NULL;
+    }
+  }
+
+  struct release_single_molecule_list list;
+  list.rsm_head = &rsms[0];
+  list.rsm_tail = &rsms[n - 1];
+  list.rsm_count = n;
+  failure = mdl_set_release_site_molecule_positions(parse_state,
+                                                    rel_site_obj_ptr, &list);
+  if (!failure)
+    rsms = NULL; /* now owned by the release site */
+
+done:
+  free(chunk);
+  free(rsms);
+  free(checked);
+  free(species);
+  fclose(f);
+  free(path);
+  return failure;
+}
+
 /**************************************************************************
  mdl_set_release_site_concentration:
     Set a release quantity from this release site based on a fixed
@@ -453,6 +453,11 @@ int mdl_set_release_site_molecule_positions(
     struct mdlparse_vars *parse_state, struct release_site_obj *rsop,
     struct release_single_molecule_list *list);
 
+/* Set the molecule positions for a LIST release from a binary file. */
+int mdl_set_release_site_molecule_positions_file(
+    struct mdlparse_vars *parse_state, struct release_site_obj *rsop,
+    char *name);
+
 /* Create a mew single molecule release position for a LIST release site. */
 struct release_single_molecule *
 mdl_new_release_single_molecule(struct mdlparse_vars *parse_state,
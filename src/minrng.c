@@ -25,6 +25,8 @@
 
 #include "minrng.h"
 
+#define MRNG_DBL32 (2.3283064365386962890625e-10)
+
 ub4 mrng_generate(struct mrng_state *x) {
   ub4 e = x->a - rot(x->b, 27);
   x->a = x->b ^ rot(x->c, 17);
@@ -41,3 +43,13 @@ void mrng_init(struct mrng_state *x, ub4 seed) {
     (void)mrng_generate(x);
   }
 }
+
+void mrng_fill_uint32(struct mrng_state *x, ub4 *out, unsigned int n) {
+  for (unsigned int i = 0; i < n; ++i)
+    out[i] = mrng_generate(x);
+}
+
+void mrng_fill_dbl32(struct mrng_state *x, double *out, unsigned int n) {
+  for (unsigned int i = 0; i < n; ++i)
+    out[i] = MRNG_DBL32 * (double)mrng_generate(x);
+}
@@ -38,6 +38,11 @@ struct mrng_state {
 
 ub4 mrng_generate(struct mrng_state *x);
 void mrng_init(struct mrng_state *x, ub4 seed);
+void mrng_fill_uint32(struct mrng_state *x, ub4 *out, unsigned int n);
+void mrng_fill_dbl32(struct mrng_state *x, double *out, unsigned int n);
 #define mrng_uint32(rng) (mrng_generate(rng))
 
+#ifndef DBL32
+#define DBL32 (2.3283064365386962890625e-10) /* 2^-32, as in isaac64.h */
+#endif
 #define mrng_dbl32(rng) (DBL32 *(double)mrng_uint32(rng))
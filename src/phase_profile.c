@@ -0,0 +1,215 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2006-2017 by
+ * The Salk Institute for Biological Studies and
+ * Pittsburgh Supercomputing Center, Carnegie Mellon University
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+ * USA.
+ *
+******************************************************************************/
+
+#include "config.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+
+#include "logging.h"
+#include "mem_util.h"
+#include "strfunc.h"
+#include "phase_profile.h"
+
+struct phase_profile *mcell_profile = NULL;
+
+static char const *const profile_phase_names[PROF_N_PHASES] = {
+  "geometry_changes", "releases",     "reaction_output",
+  "volume_output",    "viz_output",   "concentration_clamp",
+  "run_timestep",     "diffuse_3D",   "diffuse_2D",
+  "collisions",       "triggers",
+};
+
+/* The phase each phase mostly runs inside of, for reading the inclusive
+ * times */
+static char const *const profile_phase_parents[PROF_N_PHASES] = {
+  "iteration",    "iteration",    "iteration",
+  "iteration",    "iteration",    "iteration",
+  "iteration",    "run_timestep", "run_timestep",
+  "run_timestep", "run_timestep",
+};
+
+/*************************************************************************
+profile_now:
+  In: nothing
+  Out: Returns a monotonic wall clock time in seconds.
+*************************************************************************/
+double profile_now(void) {
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+#endif
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (double)tv.tv_sec + 1e-6 * (double)tv.tv_usec;
+}
+
+/*************************************************************************
+profile_init:
+  In: world: simulation state, with the partitions set up
+  Out: Returns 0 on success, 1 on failure.  Enables the profiler if
+       world->profile_file is set.
+*************************************************************************/
+int profile_init(struct volume *world) {
+  if (world->profile_file == NULL || mcell_profile != NULL)
+    return 0;
+
+  struct phase_profile *prof =
+      CHECKED_MALLOC_STRUCT_NODIE(struct phase_profile, "phase profile");
+  if (prof == NULL)
+    return 1;
+  memset(prof, 0, sizeof(struct phase_profile));
+
+  for (struct storage_list *stg = world->storage_head; stg != NULL;
+       stg = stg->next)
+    ++prof->n_storages;
+  int n = (prof->n_storages > 0) ? prof->n_storages : 1;
+  prof->storage_calls = CHECKED_MALLOC_ARRAY_NODIE(
+      unsigned long long, n, "phase profile storages");
+  prof->storage_seconds =
+      CHECKED_MALLOC_ARRAY_NODIE(double, n, "phase profile storages");
+  if (prof->storage_calls == NULL || prof->storage_seconds == NULL) {
+    free(prof->storage_calls);
+    free(prof->storage_seconds);
+    free(prof);
+    return 1;
+  }
+  memset(prof->storage_calls, 0, n * sizeof(unsigned long long));
+  memset(prof->storage_seconds, 0, n * sizeof(double));
+
+  prof->filename = world->profile_file;
+  prof->dump_interval = world->profile_interval;
+  prof->first_iteration = world->current_iterations;
+  prof->start_time = profile_now();
+  mcell_profile = prof;
+  return 0;
+}
+
+/*************************************************************************
+profile_storage_add:
+  In: prof: the profiler
+      storage: index of the storage in world->storage_head
+      start: time at which run_timestep was entered
+  Out: Adds one run_timestep call to the totals of the phase and of the
+       storage.
+*************************************************************************/
+void profile_storage_add(struct phase_profile *prof, int storage,
+                         double start) {
+  double seconds = profile_now() - start;
+  prof->calls[PROF_RUN_TIMESTEP]++;
+  prof->timed_calls[PROF_RUN_TIMESTEP]++;
+  prof->seconds[PROF_RUN_TIMESTEP] += seconds;
+  if (storage < prof->n_storages) {
+    prof->storage_calls[storage]++;
+    prof->storage_seconds[storage] += seconds;
+  }
+}
+
+/*************************************************************************
+profile_dump:
+  In: world: simulation state
+  Out: Returns 0 on success, 1 on failure.  The profile so far is written to
+       the profile file as JSON.  The file is replaced atomically, so a
+       report is always complete.
+*************************************************************************/
+int profile_dump(struct volume *world) {
+  struct phase_profile *prof = mcell_profile;
+  if (prof == NULL)
+    return 0;
+
+  char *tmpname = alloc_sprintf("%s.tmp", prof->filename);
+  if (tmpname == NULL) {
+    mcell_warn("Out of memory writing profile '%s'.", prof->filename);
+    return 1;
+  }
+
+  FILE *f = fopen(tmpname, "w");
+  if (f == NULL) {
+    mcell_perror_nodie(errno, "Failed to write profile '%s'", tmpname);
+    free(tmpname);
+    return 1;
+  }
+
+  fprintf(f, "{\n");
+  fprintf(f, "  \"iteration\": %lld,\n", world->current_iterations);
+  fprintf(f, "  \"iterations_profiled\": %lld,\n",
+          world->current_iterations - prof->first_iteration);
+  fprintf(f, "  \"wall_seconds\": %.9g,\n", profile_now() - prof->start_time);
+  fprintf(f, "  \"sample_period\": %d,\n", PROFILE_SAMPLE_PERIOD);
+  fprintf(f, "  \"phases\": [\n");
+  for (int i = 0; i < PROF_N_PHASES; i++) {
+    /* Extrapolate the sampled phases to all calls */
+    double seconds = prof->seconds[i];
+    if (prof->timed_calls[i] > 0 && prof->timed_calls[i] < prof->calls[i])
+      seconds *= (double)prof->calls[i] / (double)prof->timed_calls[i];
+    fprintf(f,
+            "    {\"name\": \"%s\", \"parent\": \"%s\", \"calls\": %llu, "
+            "\"timed_calls\": %llu, \"seconds\": %.9g, \"sampled\": %s}%s\n",
+            profile_phase_names[i], profile_phase_parents[i], prof->calls[i],
+            prof->timed_calls[i], seconds,
+            (i >= PROF_FIRST_SAMPLED) ? "true" : "false",
+            (i + 1 < PROF_N_PHASES) ? "," : "");
+  }
+  fprintf(f, "  ],\n");
+  fprintf(f, "  \"storages\": [\n");
+  for (int i = 0; i < prof->n_storages; i++) {
+    fprintf(f, "    {\"index\": %d, \"calls\": %llu, \"seconds\": %.9g}%s\n",
+            i, prof->storage_calls[i], prof->storage_seconds[i],
+            (i + 1 < prof->n_storages) ? "," : "");
+  }
+  fprintf(f, "  ]\n");
+  fprintf(f, "}\n");
+
+  int status = 0;
+  if (ferror(f) | fclose(f)) {
+    mcell_perror_nodie(errno, "Failed to write profile '%s'", tmpname);
+    status = 1;
+  } else if (rename(tmpname, prof->filename) != 0) {
+    mcell_perror_nodie(errno, "Failed to move profile '%s' into place",
+                       prof->filename);
+    status = 1;
+  }
+  free(tmpname);
+  return status;
+}
+
+/*************************************************************************
+profile_destroy:
+  In: nothing
+  Out: The profiler is freed and disabled.  A later run with a profile file
+       starts a new profile.
+*************************************************************************/
+void profile_destroy(void) {
+  if (mcell_profile == NULL)
+    return;
+
+  free(mcell_profile->storage_calls);
+  free(mcell_profile->storage_seconds);
+  free(mcell_profile);
+  mcell_profile = NULL;
+}
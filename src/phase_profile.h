@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2006-2017 by
+ * The Salk Institute for Biological Studies and
+ * Pittsburgh Supercomputing Center, Carnegie Mellon University
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+ * USA.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include "mcell_structs.h"
+
+/* Built-in profiler of the phases of an iteration (-profile).
+ *
+ * Every phase keeps a call count and cumulative wall clock time.  Times are
+ * inclusive, i.e. the time of a phase contains the time of the phases nested
+ * in it (see "parent" in the report).  Phases which run once per molecule or
+ * per collision are only timed on every PROFILE_SAMPLE_PERIOD'th call, and
+ * their time is extrapolated from the sampled calls, which keeps the cost of
+ * reading the clock out of the hot loops.
+ */
+
+enum profile_phase_t {
+  /* once per iteration, or per storage */
+  PROF_GEOMETRY_CHANGES,
+  PROF_RELEASES,
+  PROF_REACTION_OUTPUT,
+  PROF_VOLUME_OUTPUT,
+  PROF_VIZ_OUTPUT,
+  PROF_CONCENTRATION_CLAMP,
+  PROF_RUN_TIMESTEP,
+  /* per molecule or per collision, sampled */
+  PROF_DIFFUSE_3D,
+  PROF_DIFFUSE_2D,
+  PROF_COLLISIONS,
+  PROF_TRIGGERS,
+  PROF_N_PHASES
+};
+
+#define PROF_FIRST_SAMPLED PROF_DIFFUSE_3D
+#define PROFILE_SAMPLE_PERIOD 64
+
+struct phase_profile {
+  unsigned long long calls[PROF_N_PHASES];
+  unsigned long long timed_calls[PROF_N_PHASES];
+  double seconds[PROF_N_PHASES]; /* time of the timed calls */
+
+  /* run_timestep, broken down by storage (partition) */
+  int n_storages;
+  unsigned long long *storage_calls;
+  double *storage_seconds;
+
+  char *filename;          /* where the JSON report goes */
+  long long dump_interval; /* iterations between reports, 0 for exit only */
+  long long first_iteration;
+  double start_time;
+};
+
+/* NULL unless profiling is enabled.  A global so that functions which have
+ * no access to the world, e.g. the reaction triggers, can report to it. */
+extern struct phase_profile *mcell_profile;
+
+double profile_now(void);
+
+int profile_init(struct volume *world);
+int profile_dump(struct volume *world);
+void profile_destroy(void);
+void profile_storage_add(struct phase_profile *prof, int storage,
+                         double start);
+
+/*************************************************************************
+profile_begin:
+  In: phase: the phase about to run
+  Out: Counts the call.  Returns the current time if the call is timed, and
+       a negative value otherwise.  Only called with profiling enabled.
+*************************************************************************/
+static inline double profile_begin(enum profile_phase_t phase) {
+  unsigned long long n = mcell_profile->calls[phase]++;
+  if (phase >= PROF_FIRST_SAMPLED && n % PROFILE_SAMPLE_PERIOD != 0)
+    return -1.0;
+  return profile_now();
+}
+
+static inline void profile_end(enum profile_phase_t phase, double start) {
+  mcell_profile->seconds[phase] += profile_now() - start;
+  mcell_profile->timed_calls[phase]++;
+}
+
+/* Time the code between PROFILE_BEGIN and PROFILE_END as 'phase'.  Costs a
+ * single test when profiling is disabled. */
+#define PROFILE_BEGIN(phase, t0)                                               \
+  double t0 = (mcell_profile != NULL) ? profile_begin(phase) : -1.0
+
+#define PROFILE_END(phase, t0)                                                 \
+  do {                                                                         \
+    if ((t0) >= 0.0)                                                           \
+      profile_end(phase, t0);                                                  \
+  } while (0)
@@ -0,0 +1,146 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2006-2017 by
+ * The Salk Institute for Biological Studies and
+ * Pittsburgh Supercomputing Center, Carnegie Mellon University
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+ * USA.
+ *
+******************************************************************************/
+
+#include "config.h"
+
+#include "philox.h"
+
+#define PHILOX_M0 (0xD2511F53u)
+#define PHILOX_M1 (0xCD9E8D57u)
+#define PHILOX_W0 (0x9E3779B9u)
+#define PHILOX_W1 (0xBB67AE85u)
+
+/*************************************************************************
+philox_block:
+  In:  key: 64-bit key (seed, stream kind)
+       stream: upper 64 bits of the counter
+       counter: lower 64 bits of the counter
+       out: where to store the 4 output words
+  Out: out holds Philox4x32-10 of the given counter
+ *************************************************************************/
+static inline void philox_block(const uint32_t key[2], uint64_t stream,
+                                uint64_t counter, uint32_t *out) {
+  uint32_t c0 = (uint32_t)counter, c1 = (uint32_t)(counter >> 32);
+  uint32_t c2 = (uint32_t)stream, c3 = (uint32_t)(stream >> 32);
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for (int r = 0; r < PHILOX_ROUNDS; ++r) {
+    uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+    uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+    uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+    uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+    c1 = (uint32_t)p1;
+    c3 = (uint32_t)p0;
+    c0 = n0;
+    c2 = n2;
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+/*************************************************************************
+philox_generate:
+  In:  rng: RNG state
+  Out: randrsl holds the next PHILOX_BLOCKS counter blocks of the stream.
+       The blocks are independent of each other, so the loop is free of
+       any carried dependency.
+ *************************************************************************/
+void philox_generate(struct philox_state *rng) {
+  for (int i = 0; i < PHILOX_BLOCKS; ++i)
+    philox_block(rng->key, rng->stream, rng->counter + i, rng->randrsl + 4 * i);
+  rng->counter += PHILOX_BLOCKS;
+  ++rng->rngblocks;
+}
+
+/*************************************************************************
+philox_init_stream:
+  In:  rng: RNG state to initialize
+       seed: simulation seed (seed_seq)
+       stream_kind: what the stream id enumerates (see RNG_STREAM_* in rng.h)
+       stream_id: index of the stream, e.g. partition, subvolume or
+                  molecule id
+  Out: rng is positioned at the start of the requested stream.  The same
+       (seed, stream_kind, stream_id) always gives the same sequence.
+ *************************************************************************/
+void philox_init_stream(struct philox_state *rng, uint32_t seed,
+                        uint32_t stream_kind, uint64_t stream_id) {
+  rng->key[0] = seed;
+  rng->key[1] = stream_kind;
+  rng->stream = stream_id;
+  rng->counter = 0;
+  rng->rngblocks = 0;
+
+  philox_generate(rng);          /* fill in the first set of results */
+  rng->randcnt = PHILOX_RANDMAX; /* prepare to use the first set of results */
+}
+
+void philox_init(struct philox_state *rng, uint32_t seed) {
+  philox_init_stream(rng, seed, 0, 0);
+}
+
+/*
+------------------------------------------------------------------------------
+Bulk draws, returning the same words as n successive philox_uint32 calls.
+------------------------------------------------------------------------------
+*/
+void philox_fill_uint32(struct philox_state *rng, uint32_t *out,
+                        unsigned int n) {
+  while (n > 0) {
+    if (rng->randcnt == 0) {
+      philox_generate(rng);
+      rng->randcnt = PHILOX_RANDMAX;
+    }
+
+    unsigned int run = (n < rng->randcnt) ? n : rng->randcnt;
+    const uint32_t *src = rng->randrsl + (rng->randcnt - run);
+    for (unsigned int i = 0; i < run; ++i)
+      out[i] = src[run - 1 - i];
+
+    rng->randcnt -= run;
+    out += run;
+    n -= run;
+  }
+}
+
+void philox_fill_dbl32(struct philox_state *rng, double *out, unsigned int n) {
+  while (n > 0) {
+    if (rng->randcnt == 0) {
+      philox_generate(rng);
+      rng->randcnt = PHILOX_RANDMAX;
+    }
+
+    unsigned int run = (n < rng->randcnt) ? n : rng->randcnt;
+    const uint32_t *src = rng->randrsl + (rng->randcnt - run);
+    for (unsigned int i = 0; i < run; ++i)
+      out[i] = PHILOX_DBL32 * src[run - 1 - i];
+
+    rng->randcnt -= run;
+    out += run;
+    n -= run;
+  }
+}
@@ -0,0 +1,80 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2006-2017 by
+ * The Salk Institute for Biological Studies and
+ * Pittsburgh Supercomputing Center, Carnegie Mellon University
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+ * USA.
+ *
+******************************************************************************/
+
+/*
+------------------------------------------------------------------------------
+philox.h: counter-based random number generator (Philox4x32-10)
+
+Salmon, Moraes, Dror, Shaw - "Parallel random numbers: as easy as 1, 2, 3",
+SC11, 2011.
+
+Every output block is a pure function of (key, counter).  The key holds the
+seed and the stream kind, the upper half of the counter holds the stream id
+and the lower half counts blocks within the stream, so any number of
+independent streams can be derived from one seed without coordination.
+------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <inttypes.h>
+
+#define PHILOX_ROUNDS (10)
+#define PHILOX_BLOCKS (16) /* counter blocks generated per refill */
+#define PHILOX_RANDMAX (4 * PHILOX_BLOCKS)
+
+#define PHILOX_DBL32 (2.3283064365386962890625e-10)
+
+struct philox_state {
+  unsigned int randcnt;
+  uint32_t key[2];
+  uint64_t stream;  /* upper 64 bits of the counter */
+  uint64_t counter; /* index of the next block within the stream */
+  uint32_t randrsl[PHILOX_RANDMAX];
+  uint64_t rngblocks;
+};
+
+void philox_init(struct philox_state *rng, uint32_t seed);
+
+void philox_init_stream(struct philox_state *rng, uint32_t seed,
+                        uint32_t stream_kind, uint64_t stream_id);
+
+void philox_generate(struct philox_state *rng);
+
+void philox_fill_uint32(struct philox_state *rng, uint32_t *out,
+                        unsigned int n);
+
+void philox_fill_dbl32(struct philox_state *rng, double *out, unsigned int n);
+
+/*
+------------------------------------------------------------------------------
+Macros to get individual random numbers
+------------------------------------------------------------------------------
+*/
+
+#define philox_uint32(rng)                                                     \
+  (rng->randcnt > 0 ? rng->randrsl[rng->randcnt -= 1]                          \
+                    : (philox_generate(rng),                                   \
+                       rng->randrsl[rng->randcnt = PHILOX_RANDMAX - 1]))
+
+#define philox_dbl32(rng) (PHILOX_DBL32 * philox_uint32(rng))
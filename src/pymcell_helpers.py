@@ -284,6 +284,8 @@ class MCellSim:
         self._regions = {}  # type: Dict[str, Any]
         self._releases = {}  # type: Dict[str, Any]
         self._counts = {}  # type: Dict[str, Any]
+        # swig wrapped mcell_count_set, created by the first count handle
+        self._count_set = None  # type: Any
         self._iterations = 0
         self._current_iteration = 0
         self._finished = False
@@ -660,6 +662,35 @@ class MCellSim:
         return m.mcell_get_count(
             species.name, "Scene.%s,ALL" % mesh_obj.name, self._world)
 
+    def add_species_count_handle(
+            self, species: Species, mesh_obj: MeshObj) -> int:
+        """ Resolve a species count once and return its handle.
+
+        The handle is an index into the array returned by
+        get_species_counts.
+        """
+        if self._count_set is None:
+            self._count_set = m.mcell_create_count_set(0)
+        handle = m.mcell_count_set_add(
+            self._world, self._count_set, species.name,
+            "Scene.%s,ALL" % mesh_obj.name)
+        if handle < 0:
+            raise ValueError("cannot count %s in %s (error %d)" % (
+                species.name, mesh_obj.name, handle))
+        return handle
+
+    def get_species_counts(self) -> memoryview:
+        """ Read the counts of all handles in one call.
+
+        The result is a read-only view of the C array, so no data is copied.
+        Use numpy.frombuffer(view, dtype=numpy.intc) to get a NumPy array.
+        Adding another handle may invalidate earlier views.
+        """
+        if self._count_set is None:
+            return memoryview(b"")
+        m.mcell_count_set_update(self._count_set)
+        return m.mcell_count_set_view(self._count_set)
+
     def modify_rate_constant(
             self, rxn: Reaction, new_rate_constant: float) -> None:
         """ Modify the rate constant of the specified reaction. """
@@ -28,6 +28,79 @@ class SimpleReactionTestCase(SimpleSpeciesTestCase):
         rxn = m.Reaction((self.vm1.down(), self.sm1.up()), self.vm2.down(), 1e8)
 
 
+class CountSetTestCase(unittest.TestCase):
+    def setUp(self):
+        self.world = m.mcell_create()
+        m.mcell_init_state(self.world)
+        self.count_set = m.mcell_create_count_set(4)
+
+    def tearDown(self):
+        m.mcell_destroy_count_set(self.count_set)
+
+    def test_unknown_species(self):
+        handle = m.mcell_count_set_add(
+            self.world, self.count_set, "no_such_species", "Scene.box,ALL")
+        assert handle == -5, "Unknown species resolved to a handle"
+
+    def test_unknown_region(self):
+        handle = m.mcell_count_set_add(
+            self.world, self.count_set, "ALL_MOLECULES", "no_such_region")
+        assert handle == -6, "Unknown region resolved to a handle"
+
+    def test_empty_view(self):
+        m.mcell_count_set_update(self.count_set)
+        view = m.mcell_count_set_view(self.count_set)
+        assert len(view) == 0, "Empty count set has a non-empty view"
+
+    def test_counts_in_box(self):
+        hl = 0.1
+        verts = [(hl, hl, -hl), (hl, -hl, -hl), (-hl, -hl, -hl),
+                 (-hl, hl, -hl), (hl, hl, hl), (hl, -hl, hl),
+                 (-hl, -hl, hl), (-hl, hl, hl)]
+        faces = [(1, 2, 3), (7, 6, 5), (0, 4, 5), (1, 5, 6), (6, 7, 3),
+                 (0, 3, 7), (0, 1, 3), (4, 7, 5), (1, 0, 5), (2, 1, 6),
+                 (2, 6, 3), (4, 0, 7)]
+
+        sim = m.MCellSim(seed=1)
+        sim.silence_notifications()
+        sim.set_time_step(time_step=1e-6)
+        sim.set_iterations(iterations=5)
+        vm1 = m.Species("vm1", 1e-6)
+        vm2 = m.Species("vm2", 1e-7)
+        sim.add_species(vm1)
+        sim.add_species(vm2)
+        box = m.MeshObj("box", verts, faces, translation=(0, 0, 0))
+        sim.add_geometry(box)
+        sim.release(m.ObjectRelease(vm1, number=100, mesh_obj=box))
+        sim.release(m.ObjectRelease(vm2, number=40, mesh_obj=box))
+        sim.add_count(vm1, box)
+        sim.add_count(vm2, box)
+
+        # Counters only exist once the simulation is initialized
+        sim.run_iteration()
+        vm1_handle = sim.add_species_count_handle(vm1, box)
+        vm2_handle = sim.add_species_count_handle(vm2, box)
+        assert m.mcell_count_set_add(
+            sim._world, self.count_set, "vm2", "Scene.box,ALL") == 0
+        assert m.mcell_count_set_add(
+            sim._world, self.count_set, "vm1", "Scene.box,ALL") == 1
+
+        # Nothing reacts and the box is closed, so the counts never change
+        for i in range(3):
+            counts = sim.get_species_counts().cast('i')
+            assert counts[vm1_handle] == 100, "Wrong vm1 count from handle"
+            assert counts[vm2_handle] == 40, "Wrong vm2 count from handle"
+            assert counts[vm1_handle] == sim.get_species_count(vm1, box)
+
+            m.mcell_count_set_update(self.count_set)
+            view = m.mcell_count_set_view(self.count_set)
+            assert view.readonly, "Count view is writable"
+            assert view.cast('i').tolist() == [40, 100], \
+                "Wrong counts from the bulk view"
+            sim.run_iteration()
+        sim.end_sim()
+
+
 if __name__ == "__main__":
     unittest.main()
                             
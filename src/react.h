@@ -154,6 +154,24 @@ struct rxn *test_many_unimol(struct rxn **rx, int n,
 
 void update_probs(struct volume *world, struct rxn *rx, double t);
 
+int init_rate_changes(struct volume *world);
+
+void process_rate_changes(struct volume *world, double t);
+
+/* Latest time of a rate change which is due at time t.  This picks up
+ * changes at exactly t, which may have been rounded up a bit when they were
+ * converted to internal time. */
+static inline double rate_change_due(double t) {
+  return t * (1.0 + EPS_C) + EPS_C;
+}
+
+/* Applies the rate changes due by time t; when none is, this costs a single
+ * compare against the earliest pending change */
+static inline void apply_rate_changes(struct volume *world, double t) {
+  if (world->next_rate_change <= rate_change_due(t))
+    process_rate_changes(world, t);
+}
+
 /* In react_outc.c */
 int outcome_unimolecular(struct volume *world, struct rxn *rx, int path,
                          struct abstract_molecule *reac, double t);
@@ -29,8 +29,10 @@
 #include <stdlib.h>
 
 #include "logging.h"
+#include "mem_util.h"
 #include "rng.h"
 #include "react.h"
+#include "react_util.h"
 #include "vol_util.h"
 
 /*************************************************************************
@@ -48,6 +50,29 @@ double timeof_unimolecular(struct rxn *rx, struct abstract_molecule *a,
   return -log(p) / k_tot;
 }
 
+/*************************************************************************
+pick_pathway:
+  In: rx: the reaction which happens
+      p: uniform random number in [0, rx->cum_probs[M] * mult), where M is
+         the last pathway
+      mult: multiplier of the cumulative probabilities, 1 if not needed
+  Out: The pathway to take.  Reactions with an alias table pick it in
+       constant time from the same random number, so the random sequence
+       does not depend on which way the pathway is picked.  Reactions have
+       few pathways, so the fraction of p left over within its column is
+       still fine-grained enough to serve as the coin of the alias table.
+*************************************************************************/
+static int pick_pathway(struct rxn *rx, double p, double mult) {
+  int M = rx->n_pathways - 1;
+  if (rx->pathway_alias != NULL) {
+    double total = rx->cum_probs[M] * mult;
+    double u = (total > 0) ? p / total : 0;
+    double x = u * rx->n_pathways;
+    return alias_table_sample(rx->pathway_alias, u, x - floor(x));
+  }
+  return binary_search_double(rx->cum_probs, p, M, mult);
+}
+
 /*************************************************************************
 which_unimolecular:
   In: the reaction we're testing
@@ -62,7 +87,7 @@ int which_unimolecular(struct rxn *rx, struct abstract_molecule *a,
   int max = rx->n_pathways - 1;
   double match = rng_dbl(rng);
   match = match * rx->cum_probs[max];
-  return binary_search_double(rx->cum_probs, match, max, 1);
+  return pick_pathway(rx, match, 1);
 }
 
 /*************************************************************************
@@ -157,11 +182,10 @@ int test_bimolecular(struct rxn *rx, double scaling, double local_prob_factor,
   }
 
   /* If we have only fixed pathways... */
-  int M = rx->n_pathways - 1;
   if (local_prob_factor > 0)
-    return binary_search_double(rx->cum_probs, p, M, local_prob_factor);
+    return pick_pathway(rx, p, local_prob_factor);
   else
-    return binary_search_double(rx->cum_probs, p, M, 1);
+    return pick_pathway(rx, p, 1);
 }
 
 /*************************************************************************
@@ -195,7 +219,7 @@ int test_many_bimolecular(struct rxn **rx, double *scaling,
   double rxp[2 * n]; /* array of cumulative rxn probabilities */
   struct rxn *my_rx;
   int i; /* index in the array of reactions - return value */
-  int m, M;
+  int m;
   double p, f;
 
   if (all_neighbors_flag && local_prob_factor <= 0)
@@ -255,12 +279,10 @@ int test_many_bimolecular(struct rxn **rx, double *scaling,
   p = p * scaling[i];
 
   /* Now pick the pathway within that reaction */
-  M = my_rx->n_pathways - 1;
-
   if (all_neighbors_flag && local_prob_factor > 0)
-    m = binary_search_double(my_rx->cum_probs, p, M, local_prob_factor);
+    m = pick_pathway(my_rx, p, local_prob_factor);
   else
-    m = binary_search_double(my_rx->cum_probs, p, M, 1);
+    m = pick_pathway(my_rx, p, 1);
 
   *chosen_pathway = m;
 
@@ -305,7 +327,7 @@ int test_intersect(struct rxn *rx, double scaling, struct rng_state *rng) {
   double match = rng_dbl(rng);
   match = match * rx->cum_probs[max];
 
-  return binary_search_double(rx->cum_probs, match, max, 1);
+  return pick_pathway(rx, match, 1);
 }
 
 /*************************************************************************
@@ -359,8 +381,7 @@ int test_many_intersect(struct rxn **rx, double scaling, int n,
   p = p * scaling;
 
   /* Now pick the pathway within that reaction */
-  *chosen_pathway =
-      binary_search_double(my_rx->cum_probs, p, my_rx->n_pathways - 1, 1);
+  *chosen_pathway = pick_pathway(my_rx, p, 1);
 
   return i;
 }
@@ -483,6 +504,8 @@ void update_probs(struct volume *world, struct rxn *rx, double t) {
   if (!did_something)
     return;
 
+  update_pathway_alias(rx);
+
   /* Now we have to see if we need to warn the user. */
   if (rx->cum_probs[rx->n_pathways - 1] > world->notify->reaction_prob_warn) {
     FILE *warn_file = mcell_get_log_file();
@@ -519,6 +542,70 @@ void update_probs(struct volume *world, struct rxn *rx, double t) {
   return;
 }
 
+/*************************************************************************
+init_rate_changes:
+  In: world: simulation state, with the reactions initialized
+  Out: 0 on success, 1 on failure.  The reactions with time-varying rates are
+       collected for process_rate_changes.
+*************************************************************************/
+int init_rate_changes(struct volume *world) {
+  int n = 0;
+  for (int i = 0; i < world->rx_hashsize; i++) {
+    for (struct rxn *rx = world->reaction_hash[i]; rx != NULL; rx = rx->next) {
+      if (rx->prob_t != NULL)
+        n++;
+    }
+  }
+
+  world->n_time_varying_rxns = 0;
+  world->time_varying_rxns = NULL;
+  world->next_rate_change = GIGANTIC;
+  if (n == 0)
+    return 0;
+
+  world->time_varying_rxns = CHECKED_MALLOC_ARRAY_NODIE(
+      struct rxn *, n, "time-varying reactions");
+  if (world->time_varying_rxns == NULL)
+    return 1;
+  for (int i = 0; i < world->rx_hashsize; i++) {
+    for (struct rxn *rx = world->reaction_hash[i]; rx != NULL; rx = rx->next) {
+      if (rx->prob_t == NULL)
+        continue;
+      world->time_varying_rxns[world->n_time_varying_rxns++] = rx;
+      if (rx->prob_t->time < world->next_rate_change)
+        world->next_rate_change = rx->prob_t->time;
+    }
+  }
+  return 0;
+}
+
+/*************************************************************************
+process_rate_changes:
+  In: world: simulation state
+      t: current time
+  Out: No return value.  Every rate change due by time t is applied.
+  Note: This is called through apply_rate_changes at the start of every
+        iteration and before the reaction code picks or tests a reaction,
+        so a change takes effect at the first molecule past its time, like
+        update_probs did when it was called for every such reaction.
+*************************************************************************/
+void process_rate_changes(struct volume *world, double t) {
+  double due = rate_change_due(t);
+  if (world->next_rate_change > due)
+    return;
+
+  world->next_rate_change = GIGANTIC;
+  for (int i = 0; i < world->n_time_varying_rxns; i++) {
+    struct rxn *rx = world->time_varying_rxns[i];
+    if (rx->prob_t == NULL)
+      continue;
+    if (rx->prob_t->time <= due)
+      update_probs(world, rx, due);
+    if (rx->prob_t != NULL && rx->prob_t->time < world->next_rate_change)
+      world->next_rate_change = rx->prob_t->time;
+  }
+}
+
 /*************************************************************************
 test_many_reactions_all_neighbors:
   In: an array of reactions we're testing
@@ -601,12 +688,10 @@ int test_many_reactions_all_neighbors(struct rxn **rx, double *scaling,
   p = p * scaling[i];
 
   /* Now pick the pathway within that reaction */
-  int M = my_rx->n_pathways - 1;
   if (my_local_prob_factor > 0) {
-    *chosen_pathway =
-        binary_search_double(my_rx->cum_probs, p, M, my_local_prob_factor);
+    *chosen_pathway = pick_pathway(my_rx, p, my_local_prob_factor);
   } else {
-    *chosen_pathway = binary_search_double(my_rx->cum_probs, p, M, 1);
+    *chosen_pathway = pick_pathway(my_rx, p, 1);
   }
 
   return i;
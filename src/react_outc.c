@@ -42,7 +42,9 @@
 #include "diffuse.h"
 
 #include "debug_config.h"
+#include "work_counters.h"
 #include "dump_state.h"
+#include "event_trace.h"
 
 
 static int outcome_products_random(struct volume *world, struct wall *w,
@@ -107,6 +109,23 @@ void add_reactants_to_product_list(struct rxn *rx, struct abstract_molecule *rea
   }
 }
 
+/*************************************************************************
+trace_mol:
+  In: world: simulation state
+      type, flags: kind of the event trace record
+      am: molecule created or destroyed by a reaction
+      t: time to record
+  Out: The molecule is added to the event trace.
+*************************************************************************/
+static void trace_mol(struct volume *world, uint8_t type, uint8_t flags,
+                      struct abstract_molecule *am, double t) {
+  struct vector3 pos = { 0.0, 0.0, 0.0 };
+  if ((am->flags & TYPE_VOL) != 0)
+    pos = ((struct volume_molecule *)am)->pos;
+  trace_event(type, flags, world->current_iterations, am->id, 0,
+              am->properties->species_id, t, pos.x, pos.y, pos.z);
+}
+
 static bool is_rxn_unimol(struct rxn *rx) {
   if (rx->n_reactants == 1)
     return true;
@@ -998,6 +1017,7 @@ static int outcome_products_random(struct volume *world, struct wall *w,
       		dump_volume_molecule((struct volume_molecule*)this_product, "", true, "  created vm:", world->current_iterations, 0.0);
       );
 #endif
+      TRACE(trace_mol(world, TRACE_RXN_PRODUCT, 0, this_product, 0.0));
 
       if (((struct volume_molecule *)this_product)->index < DISSOCIATION_MAX)
         update_dissociation_index = true;
@@ -1082,6 +1102,7 @@ int outcome_unimolecular(struct volume *world, struct rxn *rx, int path,
                          struct abstract_molecule *reac, double t) {
   struct species *who_was_i = reac->properties;
   int result = RX_A_OK;
+  WORK_COUNT_MOL(world, reac, WORK_RXN_FIRED);
   struct volume_molecule *vm = NULL;
   struct surface_molecule *sm = NULL;
   //JJT: if this is a molecule marked as external leave it up to nfsim
@@ -1168,6 +1189,8 @@ int outcome_unimolecular(struct volume *world, struct rxn *rx, int path,
         dump_volume_molecule(vm, "", true, "Unimolecular vm defunct:", world->current_iterations, vm->t);
       );
 #endif
+      TRACE(trace_mol(world, TRACE_RXN_REACTANT, TRACE_RXN_UNIMOL,
+                      (struct abstract_molecule *)vm, vm->t));
       collect_molecule(vm);
     }
     else {
@@ -1182,6 +1205,8 @@ int outcome_unimolecular(struct volume *world, struct rxn *rx, int path,
         dump_volume_molecule(vm, "", true, "Unimolecular vm defunct:", world->current_iterations, vm->t);
       );
 #endif
+      TRACE(trace_mol(world, TRACE_RXN_REACTANT, TRACE_RXN_UNIMOL,
+                      (struct abstract_molecule *)vm, vm->t));
       collect_molecule(vm);
     }
     else
@@ -1214,6 +1239,7 @@ int outcome_bimolecular(struct volume *world, struct rxn *rx, int path,
                         struct vector3 *loc_okay) {
 
   assert(periodic_boxes_are_identical(reacA->periodic_box, reacB->periodic_box));
+  WORK_COUNT_MOL(world, reacA, WORK_RXN_FIRED);
 
   struct surface_molecule *sm = NULL;
   struct volume_molecule *vm = NULL;
@@ -1269,6 +1295,7 @@ int outcome_bimolecular(struct volume *world, struct rxn *rx, int path,
       dump_volume_molecule((struct volume_molecule*)reacB, "", true, "  defunct vm:", world->current_iterations, 0.0);
     );
 #endif
+    TRACE(trace_mol(world, TRACE_RXN_REACTANT, 0, reacB, 0.0));
 
     vm = NULL;
     if ((reacB->properties->flags & ON_GRID) != 0) {
@@ -1315,6 +1342,7 @@ int outcome_bimolecular(struct volume *world, struct rxn *rx, int path,
       dump_volume_molecule((struct volume_molecule*)reacA, "", true, "  defunct vm:", world->current_iterations, 0.0);
     );
 #endif
+    TRACE(trace_mol(world, TRACE_RXN_REACTANT, 0, reacA, 0.0));
 
     vm = NULL;
     if ((reacA->properties->flags & ON_GRID) != 0) {
@@ -1418,6 +1446,7 @@ int outcome_intersect(struct volume *world, struct rxn *rx, int path,
     else
       return RX_FLIP; /* Flip = transparent is default special case */
   }
+  WORK_COUNT_MOL(world, reac, WORK_RXN_FIRED);
   int idx = rx->product_idx[path];
 
   if ((reac->properties->flags & NOT_FREE) == 0) {
@@ -37,6 +37,7 @@
 #include "react.h"
 #include "vol_util.h"
 #include "wall_util.h"
+#include "work_counters.h"
 
 static int outcome_products_trimol_reaction_random(
     struct volume *world, struct wall *w, struct vector3 *hitpt, double t,
@@ -1776,6 +1777,7 @@ int outcome_trimolecular(struct volume *world, struct rxn *rx, int path,
   int reacB_is_free = 0;
   int reacC_is_free = 0;
   int num_surface_reactants = 0;
+  WORK_COUNT_MOL(world, reacA, WORK_RXN_FIRED);
 
   if ((reacA->properties->flags & NOT_FREE) == 0) {
     reacA_is_free = 1;
@@ -39,6 +39,7 @@
 #include "react_output.h"
 #include "mdlparse_util.h"
 #include "strfunc.h"
+#include "event_trace.h"
 
 // XXX: This global state should be removed. Currently
 // we need it for cleanup via signals.
@@ -209,6 +210,11 @@ emergency_output:
 static int emergency_output(struct volume *world) {
   struct storage_list *mem;
 
+  /* Get queued messages and traced events out before anything else can go
+   * wrong */
+  mcell_log_flush();
+  trace_emergency_flush();
+
   /* PANIC--delete everything we can get our pointers on! */
   delete_mem(world->coll_mem);
   delete_mem(world->exdv_mem);
@@ -222,6 +228,8 @@ static int emergency_output(struct volume *world) {
     delete_mem(mem->store->regl);
   }
   delete_mem(world->storage_allocator);
+  free(world->clamp_uniforms);
+  free(world->clamp_sides);
 
   return flush_reaction_output(world);
 }
@@ -272,6 +280,8 @@ static void emergency_output_signal_handler(int signo)
 
 static void emergency_output_signal_handler(int signo) {
 
+  trace_emergency_flush();
+  mcell_log_emergency_flush();
   if (emergency_output_hook_enabled) {
     emergency_output_hook_enabled = 0;
 
@@ -41,6 +41,8 @@
 
 #include "dump_state.h"
 #include "debug_config.h"
+#include "event_trace.h"
+#include "phase_profile.h"
 
 /*************************************************************************
 trigger_unimolecular:
@@ -236,7 +238,7 @@ int process_bimolecular(struct abstract_molecule *reacA,
 
 
 /*************************************************************************
-trigger_bimolecular:
+match_bimolecular:
    In: hash values of the two colliding molecules
        pointers to the two colliding molecules
        orientations of the two colliding molecules
@@ -251,11 +253,11 @@ trigger_bimolecular:
          but not rescheduled.  Assume we have or will check separately that
          the moving molecule is not inert!
 *************************************************************************/
-int trigger_bimolecular(struct rxn **reaction_hash, int rx_hashsize,
-                        u_int hashA, u_int hashB,
-                        struct abstract_molecule *reacA,
-                        struct abstract_molecule *reacB, short orientA,
-                        short orientB, struct rxn **matching_rxns) {
+static int match_bimolecular(struct rxn **reaction_hash, int rx_hashsize,
+                             u_int hashA, u_int hashB,
+                             struct abstract_molecule *reacA,
+                             struct abstract_molecule *reacB, short orientA,
+                             short orientB, struct rxn **matching_rxns) {
   /*struct surf_class_list *scl, *scl2;*/
 
   // reactions between reacA and reacB only happen if both are in the same periodic box
@@ -426,8 +428,23 @@ int trigger_bimolecular(struct rxn **reaction_hash, int rx_hashsize,
 
   return num_matching_rxns;
 }
+
+/* match_bimolecular, timed by the phase profiler */
+int trigger_bimolecular(struct rxn **reaction_hash, int rx_hashsize,
+                        u_int hashA, u_int hashB,
+                        struct abstract_molecule *reacA,
+                        struct abstract_molecule *reacB, short orientA,
+                        short orientB, struct rxn **matching_rxns) {
+  PROFILE_BEGIN(PROF_TRIGGERS, t_trigger);
+  int num_matching_rxns =
+      match_bimolecular(reaction_hash, rx_hashsize, hashA, hashB, reacA,
+                        reacB, orientA, orientB, matching_rxns);
+  PROFILE_END(PROF_TRIGGERS, t_trigger);
+  return num_matching_rxns;
+}
+
 /*************************************************************************
-trigger_trimolecular:
+match_trimolecular:
    In: hash values of the three colliding molecules
        pointers to the species of three colliding molecules
        (reacA is the moving molecule and reacB and reacC are the targets)
@@ -443,11 +460,11 @@ trigger_trimolecular:
               if two of the targets are surface molecules - they are
                     reacB and reacC.
 *************************************************************************/
-int trigger_trimolecular(struct rxn **reaction_hash, int rx_hashsize,
-                         u_int hashA, u_int hashB, u_int hashC,
-                         struct species *reacA, struct species *reacB,
-                         struct species *reacC, int orientA, int orientB,
-                         int orientC, struct rxn **matching_rxns) {
+static int match_trimolecular(struct rxn **reaction_hash, int rx_hashsize,
+                              u_int hashA, u_int hashB, u_int hashC,
+                              struct species *reacA, struct species *reacB,
+                              struct species *reacC, int orientA, int orientB,
+                              int orientC, struct rxn **matching_rxns) {
   u_int rawhash = 0;
   u_int hash = 0;            /* index in the reaction hash table */
   int num_matching_rxns = 0; /* number of matching reactions */
@@ -659,8 +676,22 @@ int trigger_trimolecular(struct rxn **reaction_hash, int rx_hashsize,
   return num_matching_rxns;
 }
 
+/* match_trimolecular, timed by the phase profiler */
+int trigger_trimolecular(struct rxn **reaction_hash, int rx_hashsize,
+                         u_int hashA, u_int hashB, u_int hashC,
+                         struct species *reacA, struct species *reacB,
+                         struct species *reacC, int orientA, int orientB,
+                         int orientC, struct rxn **matching_rxns) {
+  PROFILE_BEGIN(PROF_TRIGGERS, t_trigger);
+  int num_matching_rxns = match_trimolecular(
+      reaction_hash, rx_hashsize, hashA, hashB, hashC, reacA, reacB, reacC,
+      orientA, orientB, orientC, matching_rxns);
+  PROFILE_END(PROF_TRIGGERS, t_trigger);
+  return num_matching_rxns;
+}
+
 /*************************************************************************
-trigger_intersect:
+match_intersect:
    In: hash value of molecule's species
        pointer to a molecule
        orientation of that molecule
@@ -675,13 +706,14 @@ trigger_intersect:
    Note: Moving molecule may be inert.
 
 *************************************************************************/
-int trigger_intersect(struct rxn **reaction_hash, int rx_hashsize,
-                      struct species *all_mols, struct species *all_volume_mols,
-                      struct species *all_surface_mols, u_int hashA,
-                      struct abstract_molecule *reacA, short orientA,
-                      struct wall *w, struct rxn **matching_rxns,
-                      int allow_rx_transp, int allow_rx_reflec,
-                      int allow_rx_absorb_reg_border) {
+static int match_intersect(struct rxn **reaction_hash, int rx_hashsize,
+                           struct species *all_mols,
+                           struct species *all_volume_mols,
+                           struct species *all_surface_mols, u_int hashA,
+                           struct abstract_molecule *reacA, short orientA,
+                           struct wall *w, struct rxn **matching_rxns,
+                           int allow_rx_transp, int allow_rx_reflec,
+                           int allow_rx_absorb_reg_border) {
   int num_matching_rxns = 0; /* number of matching rxns */
 
   if (w->surf_class_head != NULL) {
@@ -708,6 +740,23 @@ int trigger_intersect(struct rxn **reaction_hash, int rx_hashsize,
   return num_matching_rxns;
 }
 
+/* match_intersect, timed by the phase profiler */
+int trigger_intersect(struct rxn **reaction_hash, int rx_hashsize,
+                      struct species *all_mols, struct species *all_volume_mols,
+                      struct species *all_surface_mols, u_int hashA,
+                      struct abstract_molecule *reacA, short orientA,
+                      struct wall *w, struct rxn **matching_rxns,
+                      int allow_rx_transp, int allow_rx_reflec,
+                      int allow_rx_absorb_reg_border) {
+  PROFILE_BEGIN(PROF_TRIGGERS, t_trigger);
+  int num_matching_rxns = match_intersect(
+      reaction_hash, rx_hashsize, all_mols, all_volume_mols, all_surface_mols,
+      hashA, reacA, orientA, w, matching_rxns, allow_rx_transp,
+      allow_rx_reflec, allow_rx_absorb_reg_border);
+  PROFILE_END(PROF_TRIGGERS, t_trigger);
+  return num_matching_rxns;
+}
+
 /*************************************************************************
  *
  * find all unimolecular reactions of reacA with surface classes on
@@ -1031,6 +1080,13 @@ void compute_lifetime(struct volume *state,
         dump_volume_molecule(vm, "", true, "Assigned unimolecular time (prev rng):", state->current_iterations, vm->t2);
     );
 #endif
+    if (mcell_trace != NULL) {
+      struct vector3 pos = { 0.0, 0.0, 0.0 };
+      if ((am->flags & TYPE_VOL) != 0)
+        pos = ((struct volume_molecule *)am)->pos;
+      trace_event(TRACE_RXN_TIME, 0, state->current_iterations, am->id, 0,
+                  am->properties->species_id, am->t2, pos.x, pos.y, pos.z);
+    }
 
     if (r->prob_t != NULL) {
       tt = r->prob_t->time;
@@ -1121,13 +1177,10 @@ struct rxn *pick_unimolecular_reaction(struct volume *state,
   }
   
   //else 
+  apply_rate_changes(state, am->t + am->t2);
   struct rxn *r = trigger_unimolecular(state->reaction_hash, state->rx_hashsize,
                                        am->properties->hashval, am);
 
-  if ((r != NULL) && (r->prob_t != NULL)) {
-    update_probs(state, r, (am->t + am->t2) * (1.0 + EPS_C));
-  }
-
   int can_surf_react = ((am->properties->flags & CAN_SURFWALL) != 0);
   if (can_surf_react) {
     num_matching_rxns =
@@ -1135,12 +1188,6 @@ struct rxn *pick_unimolecular_reaction(struct volume *state,
             state->reaction_hash, state->rx_hashsize, state->all_mols,
             state->all_volume_mols, state->all_surface_mols, am, NULL,
             matching_rxns);
-    for (int jj = 0; jj < num_matching_rxns; jj++) {
-      if ((matching_rxns[jj] != NULL) && (matching_rxns[jj]->prob_t != NULL)) {
-        update_probs(
-            state, matching_rxns[jj], (am->t + am->t2) * (1.0 + EPS_C));
-      }
-    }
   }
 
   if (r != NULL) {
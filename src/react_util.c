@@ -559,6 +559,7 @@ int change_reaction_probability(byte *reaction_prob_limit_flag,
   // update probability trackers
   rx->max_fixed_p += delta_prob;
   rx->min_noreaction_p += delta_prob;
+  update_pathway_alias(rx);
 
   // print update message
   if (rx->n_reactants == 1) {
@@ -638,3 +639,29 @@ void issue_reaction_probability_warnings(
 
   return;
 }
+
+/*************************************************************************
+init_pathway_alias:
+  In: rx: reaction with its cumulative pathway probabilities set up
+  Out: 0 on success, 1 on failure.  A reaction with at least
+       PATHWAY_ALIAS_MIN pathways gets an alias table, from which the
+       reaction tests pick a pathway in constant time.
+*************************************************************************/
+int init_pathway_alias(struct rxn *rx) {
+  if (rx->n_pathways < PATHWAY_ALIAS_MIN || rx->pathway_alias != NULL)
+    return 0;
+  rx->pathway_alias = alias_table_create(rx->cum_probs, rx->n_pathways);
+  return (rx->pathway_alias == NULL);
+}
+
+/*************************************************************************
+update_pathway_alias:
+  In: rx: reaction whose cumulative pathway probabilities changed
+  Out: No return value.  The alias table of the reaction, if it has one, is
+       rebuilt.
+*************************************************************************/
+void update_pathway_alias(struct rxn *rx) {
+  if (rx->pathway_alias != NULL &&
+      alias_table_update(rx->pathway_alias, rx->cum_probs))
+    mcell_allocfailed("Failed to update the pathway table of a reaction.");
+}
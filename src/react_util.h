@@ -41,5 +41,12 @@ int change_reaction_probability(byte *reaction_prob_limit_flag,
                                 struct notifications *notify, struct rxn *rx,
                                 int path_id, double new_rate);
 
+/* Reactions with fewer pathways bisect cum_probs, which is just as fast */
+#define PATHWAY_ALIAS_MIN 8
+
+int init_pathway_alias(struct rxn *rx);
+
+void update_pathway_alias(struct rxn *rx);
+
 void issue_reaction_probability_warnings(struct notifications *notify,
                                          struct rxn *rx);
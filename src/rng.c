@@ -30,6 +30,7 @@
 
 #include "dump_state.h"
 #include "debug_config.h"
+#include "event_trace.h"
 
 /*************************************************************************
  * Ziggurat Gaussian generator
@@ -185,6 +186,9 @@ double rng_gauss(struct rng_state *rng) {
 #ifdef DEBUG_RNG_CALLS
   dump_rng_call_info(rng, "rng_gauss");
 #endif
+#if !defined(USE_PHILOX_RNG) && !defined(USE_MINIMAL_RNG)
+  TRACE(trace_rng(TRACE_RNG_GAUSS, rng->randcnt, rng->aa, rng->bb, rng->cc));
+#endif
 
   int npasses = 0;
   do {
@@ -225,12 +229,49 @@ double rng_gauss(struct rng_state *rng) {
   return sign * x;
 }
 
-#ifndef NDEBUG
+/*************************************************************************
+rng_stream_seed:
+  In:  seed: simulation seed (seed_seq)
+       stream_kind: one of RNG_STREAM_*
+       stream_id: index of the stream within its kind
+  Out: Returns a seed for generators that have no notion of streams.  The
+       global stream keeps the original seed so that rng_init_stream with
+       RNG_STREAM_GLOBAL, 0 matches rng_init.
+ *************************************************************************/
+uint32_t rng_stream_seed(uint32_t seed, uint32_t stream_kind,
+                         uint64_t stream_id) {
+  if (stream_kind == RNG_STREAM_GLOBAL && stream_id == 0)
+    return seed;
+
+  /* splitmix64 finalizer over all three inputs */
+  uint64_t z = ((uint64_t)seed << 32) ^ stream_kind;
+  z += 0x9e3779b97f4a7c15ULL * (stream_id + 1);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  z ^= z >> 31;
+  return (uint32_t)(z ^ (z >> 32));
+}
+
+/* rng.h maps rng_dbl straight to the minimal generator in every build, so
+ * the checked wrappers only exist for ISAAC64 and Philox. */
+#if !defined(NDEBUG) && !defined(USE_MINIMAL_RNG)
 double rng_dbl(struct rng_state *rng) {
 
 #ifdef DEBUG_RNG_CALLS
   dump_rng_call_info(rng, "");
 #endif
+#ifdef USE_PHILOX_RNG
+  return philox_dbl32(rng);
+#else
+  TRACE(trace_rng(0, rng->randcnt, rng->aa, rng->bb, rng->cc));
   return isaac64_dbl32(rng);
+#endif
+}
+
+/* Draw one value at a time so that the RNG call dump stays identical to the
+ * equivalent sequence of rng_dbl calls. */
+void rng_fill_dbl(struct rng_state *rng, double *out, unsigned int n) {
+  for (unsigned int i = 0; i < n; ++i)
+    out[i] = rng_dbl(rng);
 }
 #endif
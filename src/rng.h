@@ -26,6 +26,13 @@
 
 #define ONE_OVER_2_TO_THE_33RD 1.16415321826934814453125e-10
 
+/* Kinds of independent streams that can be derived from seed_seq with
+ * rng_init_stream. */
+#define RNG_STREAM_GLOBAL 0
+#define RNG_STREAM_PARTITION 1
+#define RNG_STREAM_SUBVOLUME 2
+#define RNG_STREAM_MOLECULE 3
+
 #if defined(USE_MINIMAL_RNG)
 #include "minrng.h"
 #define rng_state mrng_state
@@ -33,6 +40,38 @@
 #define rng_init(x, y) mrng_init((x), (y))
 #define rng_dbl(x) mrng_dbl32((x))
 #define rng_uint(x) mrng_uint32((x))
+#define rng_fill_dbl(x, out, n) mrng_fill_dbl32((x), (out), (n))
+#define rng_fill_uint32(x, out, n) mrng_fill_uint32((x), (out), (n))
+#define rng_init_stream(x, seed, kind, id)                                     \
+  mrng_init((x), rng_stream_seed((seed), (kind), (id)))
+
+#elif defined(USE_PHILOX_RNG)
+/*******************Philox4x32-10***************/
+/* Counter-based generator: every block of output is a pure function of the
+ * seed and the block index, see philox.h.  Streams derived with
+ * rng_init_stream are independent by construction. */
+#include "philox.h"
+
+#define rng_state philox_state
+
+#define rng_uses(x)                                                            \
+  ((PHILOX_RANDMAX *((x)->rngblocks - 1)) +                                    \
+   (long long)(PHILOX_RANDMAX - (x)->randcnt))
+#define rng_init(x, y) philox_init((x), (y))
+#define rng_init_stream(x, seed, kind, id)                                     \
+  philox_init_stream((x), (seed), (kind), (id))
+
+#ifdef NDEBUG
+#define rng_dbl(x) philox_dbl32((x))
+#define rng_fill_dbl(x, out, n) philox_fill_dbl32((x), (out), (n))
+#else
+double rng_dbl(struct rng_state *rng);
+void rng_fill_dbl(struct rng_state *rng, double *out, unsigned int n);
+#endif
+
+#define rng_uint(x) philox_uint32((x))
+#define rng_fill_uint32(x, out, n) philox_fill_uint32((x), (out), (n))
+/***********************************************/
 
 #else
 /*******************ISAAC64*********************/
@@ -43,19 +82,24 @@
 #define rng_uses(x)                                                            \
   ((RANDMAX *((x)->rngblocks - 1)) + (long long)(RANDMAX - (x)->randcnt))
 #define rng_init(x, y) isaac64_init((x), (y))
+#define rng_init_stream(x, seed, kind, id)                                     \
+  isaac64_init((x), rng_stream_seed((seed), (kind), (id)))
 
 #ifdef NDEBUG
 #define rng_dbl(x) isaac64_dbl32((x))
+#define rng_fill_dbl(x, out, n) isaac64_fill_dbl32((x), (out), (n))
 #else 
 // for some reason I could not include dump9ing function here, so
 // the function had to be moved to rng.cpp file
 double rng_dbl(struct rng_state *rng);
+void rng_fill_dbl(struct rng_state *rng, double *out, unsigned int n);
 #endif
 // dump for release build
 
 
 
 #define rng_uint(x) isaac64_uint32((x))
+#define rng_fill_uint32(x, out, n) isaac64_fill_uint32((x), (out), (n))
 /***********************************************/
 
 #endif
@@ -63,3 +107,7 @@ double rng_dbl(struct rng_state *rng);
 #define rng_open_dbl(x) (rng_dbl(x) + ONE_OVER_2_TO_THE_33RD)
 
 double rng_gauss(struct rng_state *rng);
+
+uint32_t rng_stream_seed(uint32_t seed, uint32_t stream_kind,
+                         uint64_t stream_id);
+
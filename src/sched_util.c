@@ -298,6 +298,116 @@ int schedule_insert(struct schedule_helper *sh, void *data,
   return 0;
 }
 
+/*************************************************************************
+schedule_insert_list:
+  In: scheduler that we are using
+      list of items to schedule, linked through their next pointers
+      flag to indicate whether times in the "past" go into the list
+         of current events (if 0, go into next event, not current).
+  Out: 0 on success, 1 on memory allocation failure.  The items end up
+       where schedule_insert would have put them one by one.  If they all
+       have the same time, as the molecules of a release do, the whole list
+       is linked into its time slot at once.
+*************************************************************************/
+
+int schedule_insert_list(struct schedule_helper *sh,
+                         struct abstract_element *head,
+                         int put_neg_in_current) {
+  if (head == NULL)
+    return 0;
+
+  int n = 0;
+  struct abstract_element *tail = head;
+  struct abstract_element *ae;
+  for (ae = head; ae != NULL && ae->t == head->t; ae = ae->next) {
+    tail = ae;
+    n++;
+  }
+
+  if (ae != NULL) {
+    /* times differ, insert the items one by one */
+    while (head != NULL) {
+      struct abstract_element *next = head->next;
+      if (schedule_insert(sh, head, put_neg_in_current))
+        return 1;
+      head = next;
+    }
+    return 0;
+  }
+
+  if (put_neg_in_current && head->t < sh->now) {
+    /* append list to current list */
+
+    sh->current_count += n;
+    if (sh->current_tail == NULL)
+      sh->current = head;
+    else
+      sh->current_tail->next = head;
+    sh->current_tail = tail;
+    return 0;
+  }
+
+  /* insert list into future lists */
+  sh->count += n;
+  double nsteps = (head->t - sh->now) * sh->dt_1;
+
+  if (nsteps < ((double)sh->buf_len)) {
+    /* list fits in array for this scale */
+
+    int i;
+    if (nsteps < 0.0)
+      i = sh->index;
+    else
+      i = (int)nsteps + sh->index;
+    if (i >= sh->buf_len)
+      i -= sh->buf_len;
+
+    if (sh->circ_buf_tail[i] == NULL)
+      sh->circ_buf_count[i] = n;
+    else
+      sh->circ_buf_count[i] += n;
+
+    /* For schedulers other than the first tier, each item would have been
+     * pushed in front, so the list goes in front in reverse order */
+    if (sh->depth) {
+      if (sh->circ_buf_tail[i] == NULL)
+        sh->circ_buf_tail[i] = head;
+      struct abstract_element *prev = sh->circ_buf_head[i];
+      for (ae = head; ae != NULL;) {
+        struct abstract_element *next = ae->next;
+        ae->next = prev;
+        prev = ae;
+        ae = next;
+      }
+      sh->circ_buf_head[i] = prev;
+    }
+
+    /* For first-tier scheduler, append the list */
+    else {
+      if (sh->circ_buf_tail[i] == NULL)
+        sh->circ_buf_head[i] = head;
+      else
+        sh->circ_buf_tail[i]->next = head;
+      sh->circ_buf_tail[i] = tail;
+    }
+  } else {
+    /* list fits in array for coarser scale */
+
+    if (sh->next_scale == NULL) {
+      sh->next_scale = create_scheduler(
+          sh->dt * sh->buf_len, sh->dt * sh->buf_len * sh->buf_len, sh->buf_len,
+          sh->now + sh->dt * (sh->buf_len - sh->index));
+      if (sh->next_scale == NULL)
+        return 1;
+      sh->next_scale->depth = sh->depth + 1;
+    }
+
+    return schedule_insert_list(sh->next_scale, head, 0);
+  }
+
+  return 0;
+}
+
 /*************************************************************************
 unlink_list_item:
   Removes a specific item from the linked list.
@@ -66,6 +66,10 @@ struct schedule_helper *create_scheduler(double dt_min, double dt_max,
 
 int schedule_insert(struct schedule_helper *sh, void *data,
                     int put_neg_in_current);
+int schedule_insert_list(struct schedule_helper *sh,
+                         struct abstract_element *head,
+                         int put_neg_in_current);
+
 int schedule_deschedule(struct schedule_helper *sh, void *data);
 int schedule_reschedule(struct schedule_helper *sh, void *data, double new_t);
 /*void schedule_excert(struct schedule_helper *sh,void *data,void *blank,int
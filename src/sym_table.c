@@ -33,6 +33,26 @@
 
 #define hashsize(n) ((ub4)1 << (n))
 
+/* Index slots moved from the old index to the new one by each store_sym
+ * while the index grows.  Must be at least 2, so that the move is finished
+ * before the new index is half full. */
+#define SYMTAB_MOVE_STEP 16
+#define SYMTAB_NAME_BLOCK 65536 /* bytes of names allocated at a time */
+
+/* Slot of the symbol table index; empty if entry is NULL */
+struct sym_slot {
+  ub4 hashval;
+  struct sym_entry *entry;
+};
+
+/* Block of symbol names */
+struct sym_name_block {
+  struct sym_name_block *next;
+  size_t used;
+  size_t size;
+  char names[];
+};
+
 /* ================ Bob Jenkin hash function ======================== */
 
 /*--------------------------------------------------------------------
@@ -178,18 +198,59 @@ unsigned long hash(char const *sym) {
   return (hashval);
 }
 
+/**
+ * find_slot:
+ *      Look for a symbol in one symbol table index.
+ *
+ *      In:  slots: the index
+ *           n_slots: its length, a power of two
+ *           sym: name of the symbol
+ *           hashval: hash of the name
+ *      Out: the slot holding the symbol, or the empty slot where it would go
+ */
+static struct sym_slot *find_slot(struct sym_slot *slots, int n_slots,
+                                  char const *sym, ub4 hashval) {
+  ub4 mask = (ub4)n_slots - 1;
+  for (ub4 i = hashval & mask;; i = (i + 1) & mask) {
+    struct sym_slot *slot = &slots[i];
+    if (slot->entry == NULL ||
+        (slot->hashval == hashval && strcmp(sym, slot->entry->name) == 0))
+      return slot;
+  }
+}
+
+/**
+ * lookup_sym:
+ *      Look for a symbol in a symbol table, given its hash.  Does not modify
+ *      the table, so any number of threads may look up symbols at once as
+ *      long as none stores one.
+ *
+ *      In:  sym: name of the symbol
+ *           hashval: hash of the name
+ *           hashtab: the symbol table
+ *      Out: the symbol, or NULL if it is not in the table
+ */
+static struct sym_entry *lookup_sym(char const *sym, ub4 hashval,
+                                    struct sym_table_head *hashtab) {
+  struct sym_slot *slot =
+      find_slot(hashtab->slots, hashtab->n_slots, sym, hashval);
+  if (slot->entry != NULL)
+    return slot->entry;
+
+  /* Symbols not moved to the new index yet are still in the old one */
+  if (hashtab->old_slots != NULL) {
+    slot = find_slot(hashtab->old_slots, hashtab->n_old_slots, sym, hashval);
+    return slot->entry;
+  }
+  return NULL;
+}
+
 struct sym_entry *retrieve_sym(char const *sym,
                                struct sym_table_head *hashtab) {
   if (sym == NULL)
     return NULL;
 
-  for (struct sym_entry *sp =
-           hashtab->entries[hash(sym) & (hashtab->n_bins - 1)];
-       sp != NULL; sp = sp->next) {
-    if (strcmp(sym, sp->name) == 0)
-      return sp;
-  }
-  return NULL;
+  return lookup_sym(sym, (ub4)hash(sym), hashtab);
 }
 
 /**
@@ -315,6 +376,7 @@ struct rxn *new_reaction(void) {
   rxnp->n_reactants = 0;
   rxnp->n_pathways = 0;
   rxnp->cum_probs = NULL;
+  rxnp->pathway_alias = NULL;
   rxnp->max_fixed_p = 0.0;
   rxnp->min_noreaction_p = 0.0;
   rxnp->pb_factor = 0.0;
@@ -387,18 +449,37 @@ struct file_stream *new_filestream(void) {
 }
 
 /**
- * resize_symtab:
- *      Resize the symbol table, rehashing all values.
+ * round_up_symtab_size:
+ *      Round a symbol table size up to a power of two.
  *
- *      In:  hashtab: the symbol table
- *           size: new size for hash table
- *      Out: symbol table might be resized
+ *      In:  size: wanted size
+ *      Out: the size to use
  */
-static int resize_symtab(struct sym_table_head *hashtab, int size) {
-  struct sym_entry **entries = hashtab->entries;
-  int n_bins = hashtab->n_bins;
+static int round_up_symtab_size(int size) {
+  if (size < 2)
+    size = 2;
+  --size;
+  size |= (size >> 1);
+  size |= (size >> 2);
+  size |= (size >> 4);
+  size |= (size >> 8);
+  size |= (size >> 16);
+  ++size;
+  if (size > (1 << 28))
+    size = (1 << 28);
+  return size;
+}
 
-  /* Round up to a power of two */
+/**
+ * round_up_bins:
+ *      Round a number of bins up the way the chained symbol table did, which
+ *      gives the next power of two strictly above it.  The bins must keep
+ *      growing the same way for the walk order to stay the same.
+ *
+ *      In:  size: wanted number of bins
+ *      Out: the number of bins to use
+ */
+static int round_up_bins(int size) {
   size |= (size >> 1);
   size |= (size >> 2);
   size |= (size >> 4);
@@ -407,67 +488,141 @@ static int resize_symtab(struct sym_table_head *hashtab, int size) {
   ++size;
   if (size > (1 << 28))
     size = (1 << 28);
+  return size;
+}
 
+/**
+ * maybe_rebin_symtab:
+ *      When a third of the bins of a symbol table are used, spread its
+ *      chains over more bins, relinking them in the same order as the
+ *      chained symbol table did when it grew.
+ *
+ *      In:  hashtab: the symbol table
+ *      Out: the bins might be grown
+ */
+static void maybe_rebin_symtab(struct sym_table_head *hashtab) {
+  if (hashtab->n_entries * 3 < hashtab->n_bins)
+    return;
+
+  int n_bins = round_up_bins(hashtab->n_bins * 2);
+  if (n_bins == hashtab->n_bins)
+    return;
+
+  struct sym_entry **entries = hashtab->entries;
   hashtab->entries =
-      CHECKED_MALLOC_ARRAY(struct sym_entry *, size, "symbol table");
-  if (hashtab->entries == NULL) {
-    /* XXX: Warning message? */
-    hashtab->entries = entries;
-    return 1;
-  }
-  memset(hashtab->entries, 0, size * sizeof(struct sym_entry *));
-  hashtab->n_bins = size;
+      CHECKED_MALLOC_ARRAY(struct sym_entry *, n_bins, "symbol table");
+  memset(hashtab->entries, 0, n_bins * sizeof(struct sym_entry *));
 
-  for (int i = 0; i < n_bins; ++i) {
+  for (int i = 0; i < hashtab->n_bins; ++i) {
     while (entries[i] != NULL) {
       struct sym_entry *entry = entries[i];
       entries[i] = entries[i]->next;
 
-      unsigned long hashval = hash(entry->name) & (size - 1);
+      unsigned long hashval = hash(entry->name) & (n_bins - 1);
       entry->next = hashtab->entries[hashval];
       hashtab->entries[hashval] = entry;
     }
   }
+  hashtab->n_bins = n_bins;
   free(entries);
-  return 0;
 }
 
-
 /**
- * dump_symtab:
- *      Dump the symbol table
+ * move_old_slots:
+ *      Move some symbols of the old index of a growing symbol table to the
+ *      new index, and free the old index once all of them are moved.
  *
  *      In:  hashtab: the symbol table
- *      Out: number of symbols found
+ *           n: number of old slots to look at
+ *      Out: none
  */
-int dump_symtab(struct sym_table_head *hashtab) {
-  struct sym_entry **entries = hashtab->entries;
-  int n_bins = hashtab->n_bins;
-  int num_total_entries;
-  num_total_entries = 0;
-  for (int i = 0; i < n_bins; ++i) {
-    struct sym_entry *entry;
-    entry = entries[i];
-    while (entry != NULL) {
-      num_total_entries += 1;
-      fprintf ( stdout, "  symtab entry: %s\n", entry->name );
-      entry = entry->next;
-    }
+static void move_old_slots(struct sym_table_head *hashtab, int n) {
+  struct sym_slot *old_slots = hashtab->old_slots;
+  for (; n > 0 && hashtab->n_moved < hashtab->n_old_slots; --n) {
+    struct sym_slot *old = &old_slots[hashtab->n_moved++];
+    if (old->entry == NULL)
+      continue;
+    struct sym_slot *slot = find_slot(hashtab->slots, hashtab->n_slots,
+                                      old->entry->name, old->hashval);
+    *slot = *old;
   }
-  return num_total_entries;
-}
 
+  if (hashtab->n_moved == hashtab->n_old_slots) {
+    hashtab->old_slots = NULL;
+    hashtab->n_old_slots = 0;
+    hashtab->n_moved = 0;
+    free(old_slots);
+  }
+}
 
 /**
  * maybe_grow_symtab:
- *      Possibly grow the symbol table.
+ *      Make room for one more symbol in the symbol table.  When the index
+ *      gets half full, a new index twice as long is started, and the
+ *      symbols are moved over a few at a time by the following calls.
  *
  *      In:  hashtab: the symbol table
  *      Out: symbol table might be resized
  */
 static void maybe_grow_symtab(struct sym_table_head *hashtab) {
-  if (hashtab->n_entries * 3 >= hashtab->n_bins)
-    resize_symtab(hashtab, hashtab->n_bins * 2);
+  if (hashtab->old_slots != NULL)
+    move_old_slots(hashtab, SYMTAB_MOVE_STEP);
+
+  if (hashtab->old_slots == NULL &&
+      (hashtab->n_entries + 1) * 2 > hashtab->n_slots) {
+    hashtab->old_slots = hashtab->slots;
+    hashtab->n_old_slots = hashtab->n_slots;
+    hashtab->n_moved = 0;
+    hashtab->n_slots *= 2;
+    hashtab->slots = CHECKED_MALLOC_ARRAY(struct sym_slot, hashtab->n_slots,
+                                          "symbol table");
+    memset(hashtab->slots, 0, hashtab->n_slots * sizeof(struct sym_slot));
+  }
+}
+
+/**
+ * intern_name:
+ *      Copy a symbol name into the name storage of a symbol table.
+ *
+ *      In:  hashtab: the symbol table
+ *           sym: the name
+ *      Out: the copy, which lives as long as the table
+ */
+static char *intern_name(struct sym_table_head *hashtab, char const *sym) {
+  size_t len = strlen(sym) + 1;
+  struct sym_name_block *block = hashtab->names;
+  if (block == NULL || block->size - block->used < len) {
+    size_t size = (len > SYMTAB_NAME_BLOCK) ? len : SYMTAB_NAME_BLOCK;
+    block = (struct sym_name_block *)CHECKED_MALLOC(
+        sizeof(struct sym_name_block) + size, "symbol names");
+    block->next = hashtab->names;
+    block->used = 0;
+    block->size = size;
+    hashtab->names = block;
+  }
+  char *name = block->names + block->used;
+  memcpy(name, sym, len);
+  block->used += len;
+  return name;
+}
+
+/**
+ * dump_symtab:
+ *      Dump the symbol table
+ *
+ *      In:  hashtab: the symbol table
+ *      Out: number of symbols found
+ */
+int dump_symtab(struct sym_table_head *hashtab) {
+  int num_total_entries = 0;
+  for (int i = 0; i < hashtab->n_bins; ++i) {
+    for (struct sym_entry *entry = hashtab->entries[i]; entry != NULL;
+         entry = entry->next) {
+      num_total_entries += 1;
+      fprintf(stdout, "  symtab entry: %s\n", entry->name);
+    }
+  }
+  return num_total_entries;
 }
 
 /** Stores symbol in the symbol table.
@@ -478,24 +633,29 @@ static void maybe_grow_symtab(struct sym_table_head *hashtab) {
 struct sym_entry *store_sym(char const *sym, enum symbol_type_t sym_type,
                             struct sym_table_head *hashtab, void *data) {
   struct sym_entry *sp;
-  unsigned long hashval;
   void *vp = NULL;
   double *fp;
   unsigned long rawhash;
 
   /* try to find sym in table */
-  if ((sp = retrieve_sym(sym, hashtab)) == NULL) {
+  rawhash = hash(sym);
+  if ((sp = lookup_sym(sym, (ub4)rawhash, hashtab)) == NULL) {
+    maybe_rebin_symtab(hashtab);
     maybe_grow_symtab(hashtab);
-    ++hashtab->n_entries;
 
     /* sym not found */
     sp = CHECKED_MALLOC_STRUCT(struct sym_entry, "sym table entry");
-    sp->name = CHECKED_STRDUP(sym, "symbol name");
+    sp->name = intern_name(hashtab, sym);
     sp->sym_type = sym_type;
     sp->count = 1;
-    rawhash = hash(sym);
-    hashval = rawhash & (hashtab->n_bins - 1);
 
+    struct sym_slot *slot =
+        find_slot(hashtab->slots, hashtab->n_slots, sym, (ub4)rawhash);
+    slot->hashval = (ub4)rawhash;
+    slot->entry = sp;
+    ++hashtab->n_entries;
+
+    unsigned long hashval = rawhash & (hashtab->n_bins - 1);
     sp->next = hashtab->entries[hashval];
     hashtab->entries[hashval] = sp;
     switch (sym_type) {
@@ -613,29 +773,34 @@ struct sym_entry *store_sym(char const *sym, enum symbol_type_t sym_type,
  * init_symtab:
  *      Create a new symbol table.
  *
- *      In:  size: initial number of entries in the table
- *      Out: symbol table
+ *      In:  size: expected number of entries in the table
+ *      Out: symbol table, or NULL if out of memory
  */
 struct sym_table_head *init_symtab(int size) {
-  /* Round up to a power of two */
-  size |= (size >> 1);
-  size |= (size >> 2);
-  size |= (size >> 4);
-  size |= (size >> 8);
-  size |= (size >> 16);
-  ++size;
-  if (size > (1 << 28))
-    size = (1 << 28);
+  int n_bins = round_up_bins(size);
+  size = round_up_symtab_size(size);
 
   /* Allocate the table and zero-initialize it. */
   struct sym_table_head *symtab_head;
   symtab_head =
       CHECKED_MALLOC_STRUCT_NODIE(struct sym_table_head, "symbol table");
+  if (symtab_head == NULL)
+    return NULL;
+  memset(symtab_head, 0, sizeof(struct sym_table_head));
   symtab_head->entries =
-      CHECKED_MALLOC_ARRAY_NODIE(struct sym_entry *, size, "symbol table");
-  memset(symtab_head->entries, 0, sizeof(struct sym_entry *) * size);
-  symtab_head->n_entries = 0;
-  symtab_head->n_bins = size;
+      CHECKED_MALLOC_ARRAY_NODIE(struct sym_entry *, n_bins, "symbol table");
+  symtab_head->slots = CHECKED_MALLOC_ARRAY_NODIE(struct sym_slot, 2 * size,
+                                                  "symbol table");
+  if (symtab_head->entries == NULL || symtab_head->slots == NULL) {
+    free(symtab_head->entries);
+    free(symtab_head->slots);
+    free(symtab_head);
+    return NULL;
+  }
+  memset(symtab_head->entries, 0, sizeof(struct sym_entry *) * n_bins);
+  memset(symtab_head->slots, 0, sizeof(struct sym_slot) * 2 * size);
+  symtab_head->n_bins = n_bins;
+  symtab_head->n_slots = 2 * size;
   return symtab_head;
 }
 
@@ -649,15 +814,24 @@ struct sym_table_head *init_symtab(int size) {
 void destroy_symtab(struct sym_table_head *tab) {
   for (int i = 0; i < tab->n_bins; ++i) {
     struct sym_entry *next;
-    for (struct sym_entry *sym = tab->entries[i]; sym != NULL; sym = next) {
-      next = sym->next;
-      free(sym);
-      sym = NULL;
+    for (struct sym_entry *entry = tab->entries[i]; entry != NULL;
+         entry = next) {
+      next = entry->next;
+      free(entry);
     }
   }
 
+  struct sym_name_block *next;
+  for (struct sym_name_block *block = tab->names; block != NULL;
+       block = next) {
+    next = block->next;
+    free(block);
+  }
+
   free(tab->entries);
   tab->entries = NULL;
+  free(tab->slots);
+  free(tab->old_slots);
   free(tab);
   tab = NULL;
 }
@@ -1,6 +1,9 @@
 #include "config.h"
 
+#include <math.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 #include "mcell_misc.h"
 #include "mcell_objects.h"
@@ -10,6 +13,19 @@
 #include "mcell_species.h"
 #include "mcell_viz.h"
 #include "mcell_surfclass.h"
+#include "diffuse.h"
+#include "isaac64.h"
+#include "logging.h"
+#include "mem_util.h"
+#include "minrng.h"
+#include "philox.h"
+#include "react.h"
+#include "react_util.h"
+#include "rng.h"
+#include "sched_util.h"
+#include "util.h"
+#include "vol_util.h"
+#include "wall_util.h"
 
 #define CHECKED_CALL_EXIT(function, error_message)                             \
   {                                                                            \
@@ -238,3 +254,805 @@ void test_api(MCELL_STATE *state) {
                     "Error setting up the viz output block");
   mcell_delete_species_list(mol_viz_list);
 }
+
+/***************************************************************************
+ * Consistency checks for internal data structures
+ *
+ * Each check builds the smallest piece of simulation state it needs, runs the
+ * optimized code path and compares the outcome with the straightforward one.
+ ***************************************************************************/
+
+static int test_failures = 0;
+
+#define TEST_CHECK(condition, message)                                         \
+  {                                                                            \
+    if (!(condition)) {                                                        \
+      mcell_error_nodie("%s:%d: %s", __FILE__, __LINE__, message);            \
+      test_failures++;                                                         \
+    }                                                                          \
+  }
+
+/***************************************************************************
+test_species_arrays:
+  Insert, move and remove molecules in a subvolume with species arrays and
+  check that the contiguous arrays always hold exactly the molecules of the
+  linked per-species list, at their current positions.
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_species_arrays(void) {
+  enum { N_MOLS = 1000 };
+
+  struct storage store;
+  memset(&store, 0, sizeof(store));
+  store.pslv = create_mem(sizeof(struct per_species_list), 32);
+
+  struct subvolume sv;
+  memset(&sv, 0, sizeof(sv));
+  sv.local_storage = &store;
+  sv.use_species_arrays = 1;
+  CHECKED_CALL_EXIT(pointer_hash_init(&sv.mol_by_species, 16),
+                    "Failed to initialize species table");
+
+  struct species spec;
+  memset(&spec, 0, sizeof(spec));
+  spec.hashval = 1;
+
+  struct mem_helper *mols = create_mem(sizeof(struct volume_molecule), 128);
+  struct volume_molecule *vms[N_MOLS];
+  for (int i = 0; i < N_MOLS; i++) {
+    vms[i] = CHECKED_MEM_GET(mols, "test molecule");
+    memset(vms[i], 0, sizeof(struct volume_molecule));
+    vms[i]->properties = &spec;
+    vms[i]->birthplace = mols;
+    vms[i]->flags = TYPE_VOL | ACT_DIFFUSE | IN_VOLUME;
+    vms[i]->subvol = &sv;
+    vms[i]->pos.x = 0.001 * i;
+    vms[i]->pos.y = -0.002 * i;
+    vms[i]->pos.z = 0.5;
+    ht_add_molecule_to_list(&sv.mol_by_species, vms[i]);
+  }
+
+  /* Move every other molecule and remove every third one */
+  for (int i = 0; i < N_MOLS; i += 2) {
+    vms[i]->pos.z = 0.25 + 0.001 * i;
+    update_species_array_pos(vms[i]);
+  }
+  for (int i = 0; i < N_MOLS; i += 3) {
+    collect_molecule(vms[i]);
+    vms[i] = NULL;
+  }
+
+  struct per_species_list *psl = sv.species_head;
+  TEST_CHECK(psl != NULL && psl->next == NULL,
+             "Expected exactly one per-species list");
+  if (psl != NULL) {
+    int n_listed = 0;
+    for (struct volume_molecule *vm = psl->head; vm != NULL; vm = vm->next_v) {
+      n_listed++;
+      int idx = vm->psl_index;
+      TEST_CHECK(vm->psl == psl, "Listed molecule is not in the species array");
+      TEST_CHECK(idx >= 0 && idx < psl->n_mols && psl->mols[idx] == vm,
+                 "Species array slot does not point back to the molecule");
+      if (idx >= 0 && idx < psl->n_mols) {
+        TEST_CHECK(psl->pos_x[idx] == vm->pos.x &&
+                       psl->pos_y[idx] == vm->pos.y &&
+                       psl->pos_z[idx] == vm->pos.z,
+                   "Species array holds a stale position");
+      }
+    }
+    TEST_CHECK(n_listed == psl->n_mols,
+               "Species array and linked list differ in length");
+    TEST_CHECK(n_listed == N_MOLS - (N_MOLS + 2) / 3,
+               "Wrong number of molecules left after removal");
+    free_species_arrays(psl);
+  }
+
+  pointer_hash_destroy(&sv.mol_by_species);
+  delete_mem(mols);
+  delete_mem(store.pslv);
+}
+
+/***************************************************************************
+torus_vertex:
+  In: i, j: grid indices of the vertex (taken modulo the grid size)
+      n_u, n_v: size of the grid around and across the tube
+      v: vertex to fill in
+  Out: Nothing.  The same indices always give bitwise identical coordinates,
+       so separate copies of a vertex compare equal.
+***************************************************************************/
+static void torus_vertex(int i, int j, int n_u, int n_v, struct vector3 *v) {
+  double u = 2.0 * MY_PI * (i % n_u) / n_u;
+  double w = 2.0 * MY_PI * (j % n_v) / n_v;
+  v->x = (1.0 + 0.3 * cos(w)) * cos(u);
+  v->y = (1.0 + 0.3 * cos(w)) * sin(u);
+  v->z = 0.3 * sin(w);
+}
+
+/***************************************************************************
+same_point:
+  In: two vertices
+  Out: 1 if they have the same coordinates, 0 otherwise
+***************************************************************************/
+static int same_point(struct vector3 *a, struct vector3 *b) {
+  return a->x == b->x && a->y == b->y && a->z == b->z;
+}
+
+/***************************************************************************
+check_surface_net:
+  In: facelist: walls (NULL entries are holes), already connected
+      nfaces: length of facelist
+  Out: Nothing.  Every edge must be linked to the one wall which lists the
+       same two vertices in opposite order, found by comparing all pairs of
+       walls, and to none if there is no such wall.
+***************************************************************************/
+static void check_surface_net(struct wall **facelist, int nfaces) {
+  for (int a = 0; a < nfaces; a++) {
+    if (facelist[a] == NULL)
+      continue;
+    for (int ea = 0; ea < 3; ea++) {
+      struct vector3 *p = facelist[a]->vert[ea];
+      struct vector3 *q = facelist[a]->vert[(ea + 1) % 3];
+      struct wall *expected = NULL;
+      for (int b = 0; b < nfaces; b++) {
+        if (b == a || facelist[b] == NULL)
+          continue;
+        for (int eb = 0; eb < 3; eb++) {
+          if (same_point(facelist[b]->vert[eb], q) &&
+              same_point(facelist[b]->vert[(eb + 1) % 3], p))
+            expected = facelist[b];
+        }
+      }
+      TEST_CHECK(facelist[a]->nb_walls[ea] == expected,
+                 "Wall linked to the wrong neighbor");
+      TEST_CHECK(facelist[a]->edges[ea] != NULL, "Wall edge left unset");
+    }
+  }
+}
+
+/***************************************************************************
+test_edge_matching:
+  Connect a triangulated torus, in which every wall has its own copies of
+  its vertices, through the edge table and through the sorting path, both
+  closed and with holes, and compare the links with a brute force search.
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_edge_matching(void) {
+  enum { N_U = 24, N_V = 12, N_FACES = 2 * N_U * N_V };
+
+  struct storage store;
+  memset(&store, 0, sizeof(store));
+  store.join = create_mem(sizeof(struct edge), 128);
+
+  struct object obj;
+  memset(&obj, 0, sizeof(obj));
+  obj.walls = CHECKED_MALLOC_ARRAY(struct wall, N_FACES, "test walls");
+  struct vector3 *verts =
+      CHECKED_MALLOC_ARRAY(struct vector3, 3 * N_FACES, "test vertices");
+  struct wall **facelist =
+      CHECKED_MALLOC_ARRAY(struct wall *, N_FACES, "test wall list");
+  memset(obj.walls, 0, N_FACES * sizeof(struct wall));
+
+  for (int pass = 0; pass < 4; pass++) {
+    int with_holes = pass & 1;
+    int sort_min_faces = (pass & 2) ? 0 : N_FACES + 1;
+
+    for (int i = 0; i < N_U; i++) {
+      for (int j = 0; j < N_V; j++) {
+        int f = 2 * (i * N_V + j);
+        struct vector3 *v = &verts[3 * f];
+        torus_vertex(i, j, N_U, N_V, &v[0]);
+        torus_vertex(i + 1, j, N_U, N_V, &v[1]);
+        torus_vertex(i + 1, j + 1, N_U, N_V, &v[2]);
+        torus_vertex(i, j, N_U, N_V, &v[3]);
+        torus_vertex(i + 1, j + 1, N_U, N_V, &v[4]);
+        torus_vertex(i, j + 1, N_U, N_V, &v[5]);
+        init_tri_wall(&obj, f, &v[0], &v[1], &v[2]);
+        init_tri_wall(&obj, f + 1, &v[3], &v[4], &v[5]);
+      }
+    }
+    for (int f = 0; f < N_FACES; f++) {
+      obj.walls[f].birthplace = &store;
+      facelist[f] = (with_holes && f % 7 == 0) ? NULL : &obj.walls[f];
+    }
+
+    int status = surface_net_sort_above(facelist, N_FACES, sort_min_faces);
+    TEST_CHECK(status == (with_holes ? 0 : -1),
+               "Surface reported with the wrong closedness");
+    check_surface_net(facelist, N_FACES);
+  }
+
+  free(facelist);
+  free(verts);
+  free(obj.walls);
+  delete_mem(store.join);
+}
+
+/***************************************************************************
+test_collision_buffer:
+  Sort random collision buffers, with many equal times, and compare the
+  order with the one ae_list_sort gives the list ray_trace builds from the
+  same hits (each hit prepended as it is found).
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_collision_buffer(void) {
+  enum { MAX_HITS = 200, N_TRIALS = 2000 };
+
+  struct collision_buffer buf;
+  memset(&buf, 0, sizeof(buf));
+  struct collision list_items[MAX_HITS];
+  unsigned int seed = 12345;
+
+  for (int trial = 0; trial < N_TRIALS; trial++) {
+    int n = 1 + trial % MAX_HITS;
+    int n_times = 1 + trial % 7; /* few distinct times, so many ties */
+
+    struct collision *list = NULL;
+    buf.n_items = 0;
+    for (int k = 0; k < n; k++) {
+      seed = seed * 1103515245u + 12345u;
+      double t = (double)((seed >> 16) % n_times) / n_times;
+
+      struct collision *c = collision_buffer_slot(&buf);
+      memset(c, 0, sizeof(struct collision));
+      c->t = t;
+      c->target = &list_items[k];
+      buf.n_items++;
+
+      list_items[k] = *c;
+      list_items[k].next = list;
+      list = &list_items[k];
+    }
+
+    struct collision *sorted = sort_collision_buffer(&buf);
+    list = (struct collision *)ae_list_sort((struct abstract_element *)list);
+
+    int same = 1, count = 0;
+    for (; sorted != NULL && list != NULL;
+         sorted = sorted->next, list = list->next, count++) {
+      if (sorted->target != list->target)
+        same = 0;
+    }
+    TEST_CHECK(same && sorted == NULL && list == NULL && count == n,
+               "Collision buffer sorted differently from ae_list_sort");
+  }
+
+  free(buf.items);
+  free(buf.order);
+}
+
+/* Compare n batched draws of every generator with n single draws from an
+   identically seeded generator, then one more single draw from each so that
+   the generators must also be left in the same state. */
+#define CHECK_RNG_FILL(state_type, init, fill_dbl, one_dbl, fill_uint,         \
+                       one_uint, n)                                            \
+  {                                                                            \
+    struct state_type batched_state, single_state;                            \
+    struct state_type *batched = &batched_state, *single = &single_state;     \
+    init(batched, 4242);                                                       \
+    init(single, 4242);                                                        \
+    fill_dbl(batched, dbls, (n));                                              \
+    int same = 1;                                                              \
+    for (unsigned int k = 0; k < (n); k++)                                     \
+      if (dbls[k] != one_dbl(single))                                          \
+        same = 0;                                                              \
+    fill_uint(batched, uints, (n));                                            \
+    for (unsigned int k = 0; k < (n); k++)                                     \
+      if (uints[k] != one_uint(single))                                        \
+        same = 0;                                                              \
+    if (one_dbl(batched) != one_dbl(single))                                   \
+      same = 0;                                                                \
+    TEST_CHECK(same, #fill_dbl " or " #fill_uint " differs from single draws"); \
+  }
+
+/***************************************************************************
+test_rng_fill:
+  Check the batched draws of every generator against repeated single
+  draws, for lengths around the sizes of their internal blocks.
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_rng_fill(void) {
+  static const unsigned int lengths[] = { 0, 1, 3, 63, 64, 65, 511, 512, 513,
+                                          4097 };
+  double dbls[4097];
+  uint32_t uints[4097];
+
+  for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+    CHECK_RNG_FILL(isaac64_state, isaac64_init, isaac64_fill_dbl32,
+                   isaac64_dbl32, isaac64_fill_uint32, isaac64_uint32,
+                   lengths[i]);
+    CHECK_RNG_FILL(philox_state, philox_init, philox_fill_dbl32,
+                   philox_dbl32, philox_fill_uint32, philox_uint32,
+                   lengths[i]);
+    CHECK_RNG_FILL(mrng_state, mrng_init, mrng_fill_dbl32, mrng_dbl32,
+                   mrng_fill_uint32, mrng_uint32, lengths[i]);
+  }
+}
+
+/* Check the uniformity of n draws of a generator: mean and variance against
+   those of U(0,1) within 6 standard errors, a chi-square test over
+   RNG_STAT_BINS bins (the limit is far in the tail for 63 degrees of
+   freedom) and the correlation of successive draws. */
+#define RNG_STAT_BINS 64
+#define CHECK_RNG_STATISTICS(state_type, init, fill_dbl, n)                    \
+  {                                                                            \
+    struct state_type rng_state_, *rng = &rng_state_;                         \
+    init(rng, 1);                                                              \
+    double sum = 0.0, sum_sq = 0.0, sum_lag = 0.0, prev = 0.5;                 \
+    long bins[RNG_STAT_BINS] = { 0 };                                          \
+    for (long drawn = 0; drawn < (n); drawn += 4096) {                         \
+      fill_dbl(rng, dbls, 4096);                                               \
+      for (int k = 0; k < 4096; k++) {                                         \
+        double x = dbls[k];                                                    \
+        sum += x;                                                              \
+        sum_sq += x * x;                                                       \
+        sum_lag += (x - 0.5) * (prev - 0.5);                                   \
+        prev = x;                                                              \
+        bins[(int)(x * RNG_STAT_BINS)]++;                                      \
+      }                                                                        \
+    }                                                                          \
+    double n_drawn = (double)(((n) + 4095) / 4096 * 4096);                     \
+    double mean = sum / n_drawn;                                               \
+    double var = sum_sq / n_drawn - mean * mean;                               \
+    double chi2 = 0.0, expected = n_drawn / RNG_STAT_BINS;                     \
+    for (int b = 0; b < RNG_STAT_BINS; b++)                                    \
+      chi2 += (bins[b] - expected) * (bins[b] - expected) / expected;          \
+    double lag_corr = sum_lag / n_drawn * 12.0;                                \
+    TEST_CHECK(fabs(mean - 0.5) < 6.0 * sqrt(1.0 / 12.0 / n_drawn),            \
+               #state_type ": mean of uniform draws is off");                 \
+    TEST_CHECK(fabs(var - 1.0 / 12.0) < 6.0 * sqrt(1.0 / 180.0 / n_drawn),     \
+               #state_type ": variance of uniform draws is off");             \
+    TEST_CHECK(chi2 < 140.0, #state_type ": draws are not uniform");           \
+    TEST_CHECK(fabs(lag_corr) < 6.0 / sqrt(n_drawn),                           \
+               #state_type ": successive draws are correlated");              \
+  }
+
+/* Time n draws of a generator, one at a time and in batches */
+#define REPORT_RNG_THROUGHPUT(state_type, init, one_dbl, fill_dbl, n)          \
+  {                                                                            \
+    struct state_type rng_state_, *rng = &rng_state_;                         \
+    init(rng, 1);                                                              \
+    double sink = 0.0;                                                         \
+    clock_t start = clock();                                                   \
+    for (long k = 0; k < (n); k++)                                             \
+      sink += one_dbl(rng);                                                    \
+    clock_t middle = clock();                                                  \
+    for (long k = 0; k < (n); k += 4096) {                                     \
+      fill_dbl(rng, dbls, 4096);                                               \
+      sink += dbls[0];                                                         \
+    }                                                                          \
+    clock_t end = clock();                                                     \
+    mcell_log("%-14s %6.2f ns/draw single, %6.2f ns/draw batched%s",          \
+              #state_type ":",                                                 \
+              1e9 * (middle - start) / CLOCKS_PER_SEC / (n),                   \
+              1e9 * (end - middle) / CLOCKS_PER_SEC / (n),                     \
+              (sink < 0.0) ? "?" : "");                                        \
+  }
+
+/***************************************************************************
+test_rng_statistics:
+  Check the Philox generator against the known-answer vectors of its
+  reference implementation (Random123), check the uniformity of all
+  generators and of distinct Philox streams, and report the throughput of
+  each generator.
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_rng_statistics(void) {
+  static double dbls[4096];
+  struct philox_state philox;
+
+  /* Random123 known answers for Philox4x32-10: counter and key 0 ... */
+  static const uint32_t zero_answer[4] = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                                           0x9b00dbd8 };
+  philox_init_stream(&philox, 0, 0, 0);
+  TEST_CHECK(memcmp(philox.randrsl, zero_answer, sizeof(zero_answer)) == 0,
+             "Philox does not match its known answer for zero input");
+
+  /* ... and counter and key taken from the digits of pi */
+  static const uint32_t pi_answer[4] = { 0xd16cfe09, 0x94fdcceb, 0x5001e420,
+                                         0x24126ea1 };
+  philox_init_stream(&philox, 0xa4093822, 0x299f31d0, 0x0370734413198a2eULL);
+  philox.counter = 0x85a308d3243f6a88ULL;
+  philox_generate(&philox);
+  TEST_CHECK(memcmp(philox.randrsl, pi_answer, sizeof(pi_answer)) == 0,
+             "Philox does not match its known answer for pi input");
+
+  CHECK_RNG_STATISTICS(isaac64_state, isaac64_init, isaac64_fill_dbl32,
+                       1L << 22);
+  CHECK_RNG_STATISTICS(philox_state, philox_init, philox_fill_dbl32,
+                       1L << 22);
+  CHECK_RNG_STATISTICS(mrng_state, mrng_init, mrng_fill_dbl32, 1L << 22);
+
+  /* Streams of the same seed that differ only in kind or id must not be
+     correlated with each other */
+  struct philox_state streams[3];
+  philox_init_stream(&streams[0], 1, 0, 0);
+  philox_init_stream(&streams[1], 1, 0, 1);
+  philox_init_stream(&streams[2], 1, 1, 0);
+  const int n_pairs = 1 << 20;
+  double corr_01 = 0.0, corr_02 = 0.0;
+  for (int k = 0; k < n_pairs; k++) {
+    double x0 = philox_dbl32((&streams[0])) - 0.5;
+    double x1 = philox_dbl32((&streams[1])) - 0.5;
+    double x2 = philox_dbl32((&streams[2])) - 0.5;
+    corr_01 += x0 * x1;
+    corr_02 += x0 * x2;
+  }
+  corr_01 *= 12.0 / n_pairs;
+  corr_02 *= 12.0 / n_pairs;
+  TEST_CHECK(fabs(corr_01) < 6.0 / sqrt(n_pairs) &&
+                 fabs(corr_02) < 6.0 / sqrt(n_pairs),
+             "Philox streams are correlated");
+
+  REPORT_RNG_THROUGHPUT(isaac64_state, isaac64_init, isaac64_dbl32,
+                        isaac64_fill_dbl32, 1L << 24);
+  REPORT_RNG_THROUGHPUT(philox_state, philox_init, philox_dbl32,
+                        philox_fill_dbl32, 1L << 24);
+  REPORT_RNG_THROUGHPUT(mrng_state, mrng_init, mrng_dbl32, mrng_fill_dbl32,
+                        1L << 24);
+}
+
+/***************************************************************************
+test_rng_streams:
+  Check the streams derived with rng_init_stream: two consumers that set
+  up the partition streams and draw from them in different orders and
+  batch sizes must get the same numbers from each stream, different
+  streams must differ, and the first global stream must be the one
+  rng_init gives.
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_rng_streams(void) {
+  enum { N_STREAMS = 4, N_DRAWS = 1000 };
+  static double interleaved[N_STREAMS][N_DRAWS];
+  static double batched[N_STREAMS][N_DRAWS];
+  struct rng_state streams[N_STREAMS];
+
+  /* Round robin over the streams, one number at a time */
+  for (int s = 0; s < N_STREAMS; s++)
+    rng_init_stream(&streams[s], 1234, RNG_STREAM_PARTITION, s);
+  for (int k = 0; k < N_DRAWS; k++)
+    for (int s = 0; s < N_STREAMS; s++)
+      interleaved[s][k] = rng_dbl(&streams[s]);
+
+  /* Streams set up and drained in reverse order, in uneven batches */
+  for (int s = N_STREAMS - 1; s >= 0; s--) {
+    rng_init_stream(&streams[s], 1234, RNG_STREAM_PARTITION, s);
+    for (int k = 0; k < N_DRAWS; k += 7 + s) {
+      int n = (N_DRAWS - k < 7 + s) ? N_DRAWS - k : 7 + s;
+      rng_fill_dbl(&streams[s], &batched[s][k], n);
+    }
+  }
+
+  int same = 1;
+  int distinct = 1;
+  for (int s = 0; s < N_STREAMS; s++) {
+    if (memcmp(interleaved[s], batched[s], sizeof(interleaved[s])) != 0)
+      same = 0;
+    for (int t = 0; t < s; t++)
+      if (memcmp(interleaved[s], interleaved[t], 16 * sizeof(double)) == 0)
+        distinct = 0;
+  }
+  TEST_CHECK(same, "stream draws depend on the order of the consumers");
+  TEST_CHECK(distinct, "different streams gave the same numbers");
+
+  struct rng_state global, plain;
+  rng_init_stream(&global, 1234, RNG_STREAM_GLOBAL, 0);
+  rng_init(&plain, 1234);
+  same = 1;
+  for (int k = 0; k < N_DRAWS; k++)
+    if (rng_dbl(&global) != rng_dbl(&plain))
+      same = 0;
+  TEST_CHECK(same, "the global stream differs from rng_init");
+}
+
+/***************************************************************************
+test_alias_table:
+  Check that the alias tables used to pick concentration clamped walls
+  draw every index with a probability proportional to its weight, and never
+  draw an index of weight zero.
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_alias_table(void) {
+  enum { N_WEIGHTS = 37 };
+  double cum[N_WEIGHTS];
+  double weight[N_WEIGHTS];
+  struct mrng_state rng_state, *rng = &rng_state;
+  mrng_init(rng, 5);
+
+  for (int trial = 0; trial < 100; trial++) {
+    int n = 1 + trial % N_WEIGHTS;
+    for (int i = 0; i < n; i++) {
+      /* Very uneven weights, some of them zero */
+      weight[i] = (mrng_uint32(rng) % 4 == 0) ? 0.0 : pow(mrng_dbl32(rng), 4);
+      cum[i] = (i == 0) ? weight[i] : cum[i - 1] + weight[i];
+    }
+    if (cum[n - 1] == 0.0) {
+      weight[n - 1] = 1.0;
+      cum[n - 1] = 1.0 + ((n > 1) ? cum[n - 2] : 0.0);
+    }
+
+    struct alias_table *at = alias_table_create(cum, n);
+    TEST_CHECK(at != NULL, "could not create an alias table");
+    if (at == NULL)
+      return;
+
+    /* Each column is drawn with probability 1/n and keeps its own index
+       with probability prob[i] */
+    double p[N_WEIGHTS] = { 0 };
+    for (int i = 0; i < n; i++) {
+      p[i] += at->prob[i] / n;
+      p[at->alias[i]] += (1.0 - at->prob[i]) / n;
+    }
+    int same = 1;
+    for (int i = 0; i < n; i++)
+      if (fabs(p[i] - weight[i] / cum[n - 1]) > 1e-12)
+        same = 0;
+    TEST_CHECK(same, "alias table probabilities differ from the weights");
+
+    int drew_zero = 0;
+    for (int k = 0; k < 10000; k++) {
+      double column_u = mrng_dbl32(rng);
+      int i = alias_table_sample(at, column_u, mrng_dbl32(rng));
+      if (i < 0 || i >= n || weight[i] == 0.0)
+        drew_zero = 1;
+    }
+    TEST_CHECK(!drew_zero, "alias table drew an index of weight zero");
+    alias_table_destroy(at);
+  }
+}
+
+/***************************************************************************
+test_alias_table_resolution:
+  Check an alias table with 2^20 columns, all but one of which keep their
+  own index with probability 1e-4 only.  With 32-bit uniforms, the part of
+  the column draw left over for the coin has a resolution of 2^-12, which
+  would draw the light indices 2.4 times too often, so the coin must come
+  from its own uniform.
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_alias_table_resolution(void) {
+  int const n = 1 << 20;
+  double const keep = 1e-4;
+  int const n_draws = 4000000;
+
+  /* The heavy index 0 takes what the light ones leave over */
+  double *cum = CHECKED_MALLOC_ARRAY(double, n, "cumulative weights");
+  cum[0] = n - (n - 1) * keep;
+  for (int i = 1; i < n; i++)
+    cum[i] = cum[i - 1] + keep;
+
+  struct alias_table *at = alias_table_create(cum, n);
+  free(cum);
+  TEST_CHECK(at != NULL, "could not create a large alias table");
+  if (at == NULL)
+    return;
+
+  struct mrng_state rng_state, *rng = &rng_state;
+  mrng_init(rng, 11);
+  int n_light = 0;
+  for (int k = 0; k < n_draws; k++) {
+    double column_u = mrng_dbl32(rng);
+    if (alias_table_sample(at, column_u, mrng_dbl32(rng)) != 0)
+      n_light++;
+  }
+  alias_table_destroy(at);
+
+  /* About 400 light draws are expected, give or take 20 */
+  double expected = (double)n_draws * keep * (n - 1) / n;
+  TEST_CHECK(fabs(n_light - expected) < 5 * sqrt(expected),
+             "alias table drew light indices with the wrong frequency");
+}
+
+/***************************************************************************
+check_pathway_frequencies:
+  Pick pathways of a reaction many times with which_unimolecular and
+  compare how often each one is taken with its share of cum_probs.
+
+  In: rx: reaction with an alias table over its pathways
+      rng: random number generator
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void check_pathway_frequencies(struct rxn *rx, struct rng_state *rng) {
+  enum { N_DRAWS = 200000 };
+  int count[PATHWAY_ALIAS_MIN * 2] = { 0 };
+  for (int k = 0; k < N_DRAWS; k++)
+    count[which_unimolecular(rx, NULL, rng)]++;
+
+  int same = 1;
+  int M = rx->n_pathways - 1;
+  for (int i = 0; i <= M; i++) {
+    double w = (i == 0) ? rx->cum_probs[0]
+                        : rx->cum_probs[i] - rx->cum_probs[i - 1];
+    double expected = N_DRAWS * w / rx->cum_probs[M];
+    if (fabs(count[i] - expected) > 5 * sqrt(expected) + 1)
+      same = 0;
+  }
+  TEST_CHECK(same, "pathways picked from the alias table do not follow the "
+                   "pathway probabilities");
+}
+
+/***************************************************************************
+test_pathway_alias:
+  Check that the pathways of a reaction with an alias table are picked as
+  often as cum_probs says, both when the table is first built and after
+  the probabilities change.  Without the table (-bisect_pathways), every
+  pick must be the one binary_search_double makes from the same random
+  number, and both ways must use the same number of random numbers.
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_pathway_alias(void) {
+  enum { N_PATHWAYS = PATHWAY_ALIAS_MIN * 2 };
+  double cum_probs[N_PATHWAYS];
+  double weight[N_PATHWAYS] = { 5, 1, 0, 3, 0.25, 8, 2, 0, 1, 1, 0.5, 7, 4, 0,
+                                2, 6 };
+  for (int i = 0; i < N_PATHWAYS; i++)
+    cum_probs[i] = (i == 0) ? weight[i] : cum_probs[i - 1] + weight[i];
+
+  struct rxn rx;
+  memset(&rx, 0, sizeof(rx));
+  rx.n_pathways = N_PATHWAYS;
+  rx.cum_probs = cum_probs;
+  TEST_CHECK(init_pathway_alias(&rx) == 0 && rx.pathway_alias != NULL,
+             "reaction with many pathways did not get an alias table");
+  if (rx.pathway_alias == NULL)
+    return;
+
+  struct rng_state rng_state, *rng = &rng_state;
+  rng_init(rng, 17);
+  check_pathway_frequencies(&rx, rng);
+
+  /* Rate changes shift the probabilities, including to and from zero */
+  for (int i = 0; i < N_PATHWAYS; i++) {
+    double w = (weight[i] == 0) ? 3 : ((i % 3 == 0) ? 0 : weight[i] * i);
+    cum_probs[i] = (i == 0) ? w : cum_probs[i - 1] + w;
+  }
+  update_pathway_alias(&rx);
+  check_pathway_frequencies(&rx, rng);
+
+  /* The alias table and bisection use the same random numbers */
+  struct rxn bisect_rx = rx;
+  bisect_rx.pathway_alias = NULL;
+  struct rng_state alias_rng, bisect_rng, match_rng;
+  rng_init(&alias_rng, 23);
+  rng_init(&bisect_rng, 23);
+  rng_init(&match_rng, 23);
+  int same = 1;
+  for (int k = 0; k < 100000; k++) {
+    which_unimolecular(&rx, NULL, &alias_rng);
+    double match = rng_dbl(&match_rng) * cum_probs[N_PATHWAYS - 1];
+    if (which_unimolecular(&bisect_rx, NULL, &bisect_rng) !=
+        binary_search_double(cum_probs, match, N_PATHWAYS - 1, 1))
+      same = 0;
+  }
+  TEST_CHECK(same, "bisected pathways differ from binary_search_double");
+  TEST_CHECK(rng_dbl(&alias_rng) == rng_dbl(&bisect_rng),
+             "picking pathways from the alias table used a different number "
+             "of random numbers than bisection");
+
+  alias_table_destroy(rx.pathway_alias);
+}
+
+/* An item to put in a scheduler */
+struct test_event {
+  struct abstract_element *next;
+  double t;
+  int id;
+};
+
+/***************************************************************************
+drain_scheduler:
+  In: sh: scheduler
+      order: ids of the events in the order they come out
+      n: number of events in the scheduler
+  Out: The number of events retrieved before the scheduler ran dry.
+***************************************************************************/
+static int drain_scheduler(struct schedule_helper *sh, int *order, int n) {
+  int n_out = 0;
+  for (int steps = 0; n_out < n && steps < 100000 && !sh->error; steps++) {
+    struct test_event *e;
+    while ((e = (struct test_event *)schedule_next(sh)) != NULL && n_out < n)
+      order[n_out++] = e->id;
+  }
+  return n_out;
+}
+
+/***************************************************************************
+test_schedule_insert_list:
+  Schedule events of the same time, as concentration clamps and LIST
+  releases emit them, once with schedule_insert_list and once one by one,
+  next to events already scheduled, and check that both schedulers hand
+  them out in the same order.  Times cover the current list, the first
+  tier and coarser tiers of the scheduler.
+
+  In: Nothing
+  Out: Nothing.  Failures are counted in test_failures.
+***************************************************************************/
+static void test_schedule_insert_list(void) {
+  enum { N_OLD = 64, N_NEW = 50 };
+  static const double new_times[] = { 3.5, 0.5, 17.5, 250.5, 4000.5 };
+  struct test_event events[2][N_OLD + N_NEW];
+  int order[2][N_OLD + N_NEW];
+
+  for (size_t k = 0; k < sizeof(new_times) / sizeof(new_times[0]); k++) {
+    struct schedule_helper *sh[2];
+    for (int s = 0; s < 2; s++) {
+      sh[s] = create_scheduler(1.0, 100.0, 100, 0);
+      TEST_CHECK(sh[s] != NULL, "could not create a scheduler");
+      if (sh[s] == NULL)
+        return;
+      /* Advance past t = 0 so that early times land in the current list */
+      if (new_times[k] < 1.0)
+        schedule_next(sh[s]);
+
+      for (int i = 0; i < N_OLD; i++) {
+        events[s][i].id = i;
+        events[s][i].t = (i % 2) ? new_times[k] : 0.5 + (i * 37 % 5000);
+        schedule_add(sh[s], &events[s][i]);
+      }
+      for (int i = N_OLD; i < N_OLD + N_NEW; i++) {
+        events[s][i].id = i;
+        events[s][i].t = new_times[k];
+        events[s][i].next = (i + 1 < N_OLD + N_NEW)
+                                ? (struct abstract_element *)&events[s][i + 1]
+                                : NULL;
+      }
+    }
+
+    TEST_CHECK(schedule_insert_list(
+                   sh[0], (struct abstract_element *)&events[0][N_OLD], 1) == 0,
+               "schedule_insert_list failed");
+    for (int i = N_OLD; i < N_OLD + N_NEW; i++)
+      schedule_add(sh[1], &events[1][i]);
+
+    int n_out[2];
+    for (int s = 0; s < 2; s++)
+      n_out[s] = drain_scheduler(sh[s], order[s], N_OLD + N_NEW);
+    TEST_CHECK(n_out[0] == N_OLD + N_NEW && n_out[1] == N_OLD + N_NEW,
+               "scheduler lost events");
+    TEST_CHECK(memcmp(order[0], order[1], sizeof(order[0])) == 0,
+               "schedule_insert_list orders events differently from "
+               "schedule_insert");
+
+    delete_scheduler(sh[0]);
+    delete_scheduler(sh[1]);
+  }
+}
+
+/***************************************************************************
+test_internals:
+  Run all internal consistency checks.
+
+  In: Nothing
+  Out: The number of failed checks.
+***************************************************************************/
+int test_internals(void) {
+  test_failures = 0;
+  test_species_arrays();
+  test_edge_matching();
+  test_collision_buffer();
+  test_rng_fill();
+  test_rng_statistics();
+  test_rng_streams();
+  test_alias_table();
+  test_alias_table_resolution();
+  test_pathway_alias();
+  test_schedule_insert_list();
+  return test_failures;
+}
@@ -9,3 +9,5 @@
 #include "mcell_viz.h"
 
 void test_api(MCELL_STATE *state);
+
+int test_internals(void);
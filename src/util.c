@@ -436,6 +436,100 @@ int bisect_high(double *list, int n, double val) {
   }
 }
 
+/*************************************************************************
+alias_table_create:
+  In: array of cumulative weights, sorted low to high
+      int saying how many weights there are
+  Out: Walker alias table drawing index i with probability proportional to
+       cum[i] - cum[i-1], or NULL if memory could not be allocated.  Built
+       in O(n) with Vose's method.
+*************************************************************************/
+struct alias_table *alias_table_create(const double *cum, int n) {
+  struct alias_table *at = (struct alias_table *)malloc(
+      sizeof(struct alias_table) + n * (sizeof(double) + sizeof(int)));
+  if (at == NULL)
+    return NULL;
+  at->n = n;
+  at->prob = (double *)(at + 1);
+  at->alias = (int *)(at->prob + n);
+
+  if (alias_table_update(at, cum)) {
+    free(at);
+    return NULL;
+  }
+  return at;
+}
+
+/*************************************************************************
+alias_table_update:
+  In: alias table
+      array of at->n cumulative weights, sorted low to high
+  Out: 0 on success, 1 if memory could not be allocated.  The table is
+       rebuilt in place for the new weights.
+*************************************************************************/
+int alias_table_update(struct alias_table *at, const double *cum) {
+  int n = at->n;
+  int *work = (int *)malloc(2 * n * sizeof(int));
+  if (work == NULL)
+    return 1;
+  int *small = work;
+  int *large = work + n;
+  int n_small = 0;
+  int n_large = 0;
+
+  double total = (n > 0) ? cum[n - 1] : 0.0;
+  for (int i = 0; i < n; i++) {
+    double w = (i == 0) ? cum[0] : cum[i] - cum[i - 1];
+    at->prob[i] = (total > 0.0) ? w * n / total : 1.0;
+    at->alias[i] = i;
+    if (at->prob[i] < 1.0)
+      small[n_small++] = i;
+    else
+      large[n_large++] = i;
+  }
+
+  while (n_small > 0 && n_large > 0) {
+    int s = small[--n_small];
+    int l = large[n_large - 1];
+    at->alias[s] = l;
+    at->prob[l] -= 1.0 - at->prob[s];
+    if (at->prob[l] < 1.0) {
+      n_large--;
+      small[n_small++] = l;
+    }
+  }
+
+  /* Whatever is left over is 1.0 up to rounding error */
+  while (n_large > 0)
+    at->prob[large[--n_large]] = 1.0;
+  while (n_small > 0)
+    at->prob[small[--n_small]] = 1.0;
+
+  free(work);
+  return 0;
+}
+
+/*************************************************************************
+alias_table_sample:
+  In: alias table
+      column_u: uniform random number in [0, 1) picking the column
+      coin_u: independent uniform random number in [0, 1) deciding between
+              the column and its alias
+  Out: sampled index
+  Note: The coin must not be taken from the fraction left over by column_u.
+        A 32-bit uniform spread over n columns leaves only 2^32 / n levels
+        for it, which rounds the keep probabilities of large tables.
+*************************************************************************/
+int alias_table_sample(const struct alias_table *at, double column_u,
+                       double coin_u) {
+  int i = (int)(column_u * at->n);
+  if (i >= at->n)
+    i = at->n - 1;
+  return (coin_u < at->prob[i]) ? i : at->alias[i];
+}
+
+void alias_table_destroy(struct alias_table *at) { free(at); }
+
 /**********************************************************************
 distinguishable: reports whether two doubles are measurably different
 
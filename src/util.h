@@ -69,6 +69,19 @@ int bisect(double *list, int n, double val);
 int bisect_near(double *list, int n, double val);
 int bisect_high(double *list, int n, double val);
 
+/* Walker alias table for O(1) sampling from a fixed discrete distribution */
+struct alias_table {
+  int n;
+  double *prob; /* probability of keeping column i rather than its alias */
+  int *alias;   /* index substituted for column i otherwise */
+};
+
+struct alias_table *alias_table_create(const double *cum, int n);
+int alias_table_update(struct alias_table *at, const double *cum);
+int alias_table_sample(const struct alias_table *at, double column_u,
+                       double coin_u);
+void alias_table_destroy(struct alias_table *at);
+
 int distinguishable(double a, double b, double eps);
 int is_reverse_abbrev(char *abbrev, char *full);
 
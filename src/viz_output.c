@@ -36,6 +36,11 @@
 #include <sys/stat.h>
 #include <errno.h>
 #include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /*
 #include "isaac64.h"
@@ -450,8 +455,6 @@ typedef struct external_mol_viz_entry_struct {
 } external_mol_viz_entry;
 
 
-static struct sym_table_head *graph_pattern_table = NULL;
-
 typedef struct external_molcomp_loc_struct {
   bool is_mol;
   bool has_coords;
@@ -620,8 +623,10 @@ static void set_component_positions_by_table ( struct volume *world, external_mo
                 mc[mc[mi].peers[ci]].ky = mc_ptr->rot_axis_y;  // These are currently key locations rather than rotation axis locations
                 mc[mc[mi].peers[ci]].kz = mc_ptr->rot_axis_z;  // These are currently key locations rather than rotation axis locations
                 mc[mc[mi].peers[ci]].has_coords = true;
-                fprintf ( stdout, "    Component %s is at (%g,%g,%g)\n", mc[mc[mi].peers[ci]].name, mc[mc[mi].peers[ci]].x, mc[mc[mi].peers[ci]].y, mc[mc[mi].peers[ci]].z );
-                fprintf ( stdout, "       Ref key for %s is at (%g,%g,%g)\n", mc[mc[mi].peers[ci]].name, mc[mc[mi].peers[ci]].kx, mc[mc[mi].peers[ci]].ky, mc[mc[mi].peers[ci]].kz );
+                if (world->dump_level >= 20) {
+                  fprintf ( stdout, "    Component %s is at (%g,%g,%g)\n", mc[mc[mi].peers[ci]].name, mc[mc[mi].peers[ci]].x, mc[mc[mi].peers[ci]].y, mc[mc[mi].peers[ci]].z );
+                  fprintf ( stdout, "       Ref key for %s is at (%g,%g,%g)\n", mc[mc[mi].peers[ci]].name, mc[mc[mi].peers[ci]].kx, mc[mc[mi].peers[ci]].ky, mc[mc[mi].peers[ci]].kz );
+                }
                 break;
               }
             }
@@ -867,10 +872,12 @@ static void bind_molecules_at_components ( struct volume *world, external_molcom
     vvk[1] = mc[var_comp_index].ky - mc[var_mol_index].y;
     vvk[2] = mc[var_comp_index].kz - mc[var_mol_index].z;
 
-    fprintf ( stdout, "  Fixed vcomp = [ %g %g %g ]\n", fvc[0], fvc[1], fvc[2] );
-    fprintf ( stdout, "  Var   vcomp = [ %g %g %g ]\n", vvc[0], vvc[1], vvc[2] );
-    fprintf ( stdout, "  Fixed vkey  = [ %g %g %g ]\n", fvk[0], fvk[1], fvk[2] );
-    fprintf ( stdout, "  Var vkey    = [ %g %g %g ]\n", vvk[0], vvk[1], vvk[2] );
+    if (world->dump_level >= 20) {
+      fprintf ( stdout, "  Fixed vcomp = [ %g %g %g ]\n", fvc[0], fvc[1], fvc[2] );
+      fprintf ( stdout, "  Var   vcomp = [ %g %g %g ]\n", vvc[0], vvc[1], vvc[2] );
+      fprintf ( stdout, "  Fixed vkey  = [ %g %g %g ]\n", fvk[0], fvk[1], fvk[2] );
+      fprintf ( stdout, "  Var vkey    = [ %g %g %g ]\n", vvk[0], vvk[1], vvk[2] );
+    }
 
     // Use the cross product to get the normal to the fixed molecule-component-key plane
     double fixed_normal[3];
@@ -898,8 +905,10 @@ static void bind_molecules_at_components ( struct volume *world, external_molcom
     var_unit[1] = var_normal[1] / var_norm_mag;
     var_unit[2] = var_normal[2] / var_norm_mag;
 
-    fprintf ( stdout, "  Fixed unit = [ %g %g %g ]\n", fixed_unit[0], fixed_unit[1], fixed_unit[2] );
-    fprintf ( stdout, "  Var unit = [ %g %g %g ]\n", var_unit[0], var_unit[1], var_unit[2] );
+    if (world->dump_level >= 20) {
+      fprintf ( stdout, "  Fixed unit = [ %g %g %g ]\n", fixed_unit[0], fixed_unit[1], fixed_unit[2] );
+      fprintf ( stdout, "  Var unit = [ %g %g %g ]\n", var_unit[0], var_unit[1], var_unit[2] );
+    }
 
     double norm_dot_prod;
     norm_dot_prod = (fixed_unit[0] * var_unit[0]) + (fixed_unit[1] * var_unit[1]) + (fixed_unit[2] * var_unit[2]);
@@ -913,12 +922,16 @@ static void bind_molecules_at_components ( struct volume *world, external_molcom
       fprintf ( stdout, "Numerical Warning: normalized dot product %g was less than -1\n", norm_dot_prod );
       norm_dot_prod = -1;
     }
-    fprintf ( stdout, "  Normalized Dot Product between fixed and var is %g\n", norm_dot_prod );
+    if (world->dump_level >= 20) {
+      fprintf ( stdout, "  Normalized Dot Product between fixed and var is %g\n", norm_dot_prod );
+    }
 
     // Compute the amount of rotation to bring the planes into alignment offset by the requested bond angles
     double cur_key_plane_angle = acos ( norm_dot_prod );
 
-    fprintf ( stdout, "Current key plane angle = %g\n", (180*cur_key_plane_angle/MY_PI) );
+    if (world->dump_level >= 20) {
+      fprintf ( stdout, "Current key plane angle = %g\n", (180*cur_key_plane_angle/MY_PI) );
+    }
 
     double cross_prod[3];
 
@@ -931,14 +944,18 @@ static void bind_molecules_at_components ( struct volume *world, external_molcom
       cur_key_plane_angle = (2*MY_PI) - cur_key_plane_angle;
     }
 
-    fprintf ( stdout, "Current key plane angle = %g,  dot_cross_rot = %g\n", (180*cur_key_plane_angle/MY_PI), dot_cross_rot );
+    if (world->dump_level >= 20) {
+      fprintf ( stdout, "Current key plane angle = %g,  dot_cross_rot = %g\n", (180*cur_key_plane_angle/MY_PI), dot_cross_rot );
+    }
 
     double composite_rot_angle = MY_PI + (var_req_bond_angle+fixed_req_bond_angle) + cur_key_plane_angle;  // The "MY_PI" adds 180 degrees to make the components "line up"
 
-    fprintf ( stdout, "  Fixed angle                is = %g degrees\n", 180 * fixed_req_bond_angle / MY_PI );
-    fprintf ( stdout, "  Var angle                  is = %g degrees\n", 180 * var_req_bond_angle / MY_PI );
-    fprintf ( stdout, "  Current angle between keys is = %g degrees\n", 180 * cur_key_plane_angle / MY_PI );
-    fprintf ( stdout, "  Composite rotation angle   is = %g degrees\n", 180 * composite_rot_angle / MY_PI );
+    if (world->dump_level >= 20) {
+      fprintf ( stdout, "  Fixed angle                is = %g degrees\n", 180 * fixed_req_bond_angle / MY_PI );
+      fprintf ( stdout, "  Var angle                  is = %g degrees\n", 180 * var_req_bond_angle / MY_PI );
+      fprintf ( stdout, "  Current angle between keys is = %g degrees\n", 180 * cur_key_plane_angle / MY_PI );
+      fprintf ( stdout, "  Composite rotation angle   is = %g degrees\n", 180 * composite_rot_angle / MY_PI );
+    }
 
     // Build a 3D rotation matrix along the axis of the molecule to the component
     double var_vcomp_mag = sqrt ( (vvc[0]*vvc[0]) + (vvc[1]*vvc[1]) + (vvc[2]*vvc[2]) );
@@ -1336,13 +1353,13 @@ static external_molcomp_loc *build_molcomp_array ( struct volume *world, char **
 }
 
 
-static char **get_graph_strings ( char *nauty_string ) {
+static char **get_graph_strings ( char const *nauty_string ) {
   // Parse the graph pattern
   // This code assumes that the graph pattern ends with a comma!!
   int num_parts;
   int part_num;
   char **graph_parts;
-  char *first, *last;
+  char const *first, *last;
 
   // Start by just counting the parts
   part_num = 0;
@@ -1364,11 +1381,11 @@ static char **get_graph_strings ( char *nauty_string ) {
   first = nauty_string;
   last = strchr ( first, ',' );
   while (last != NULL) {
-    *last = '\0';
-    char *s = (char *) malloc ( strlen(first) + 1 );
-    strcpy ( s, first );
+    // Copy without touching the pattern, which other threads may be reading
+    char *s = (char *) malloc ( (last - first) + 1 );
+    memcpy ( s, first, last - first );
+    s[last - first] = '\0';
     graph_parts[part_num] = s;
-    *last = ',';
     first = last+1;
     last = strchr ( first, ',' );
     part_num++;
@@ -1392,6 +1409,283 @@ static void free_graph_parts ( char **graph_parts ) {
   }
 }
 
+static void free_molcomp_list ( molcomp_list *mcl ) {
+  for (int i = 0; i < mcl->num_molcomp_items; i++) {
+    free ( mcl->molcomp_array[i].name );
+    free ( mcl->molcomp_array[i].graph_string );
+    free ( mcl->molcomp_array[i].peers );
+  }
+  free ( mcl->molcomp_array );
+  free ( mcl );
+}
+
+/* Layouts of NFsim complexes, keyed by graph pattern.  Lookups may come from
+ * several threads at once.  Between frames the cache holds at most
+ * COMPLEX_LAYOUT_CACHE_MAX layouts (see viz_output.h); the least recently
+ * used ones are dropped once a frame is written, never while a frame may
+ * still refer to them. */
+#define COMPLEX_LAYOUT_BUCKETS 8192 /* a power of two */
+
+struct complex_layout {
+  struct complex_layout *next; /* in the same bucket */
+  char *graph_pattern;
+  unsigned long hash;
+  molcomp_list *mcl;
+  _Atomic long long last_used; /* frame in which the layout was last used */
+};
+
+struct complex_layout_cache {
+  pthread_rwlock_t lock; /* protects the buckets and n_layouts */
+  struct complex_layout *buckets[COMPLEX_LAYOUT_BUCKETS];
+  int n_layouts;
+  long long frame; /* number of frames written so far */
+};
+
+static struct complex_layout_cache *complex_layouts = NULL;
+
+static struct complex_layout_cache *create_layout_cache(void) {
+  struct complex_layout_cache *cache = CHECKED_MALLOC_STRUCT(
+      struct complex_layout_cache, "complex layout cache");
+  memset(cache, 0, sizeof(struct complex_layout_cache));
+  pthread_rwlock_init(&cache->lock, NULL);
+  return cache;
+}
+
+static void destroy_layout_cache(struct complex_layout_cache *cache) {
+  for (int b = 0; b < COMPLEX_LAYOUT_BUCKETS; b++) {
+    struct complex_layout *cl = cache->buckets[b];
+    while (cl != NULL) {
+      struct complex_layout *next = cl->next;
+      free_molcomp_list(cl->mcl);
+      free(cl->graph_pattern);
+      free(cl);
+      cl = next;
+    }
+  }
+  pthread_rwlock_destroy(&cache->lock);
+  free(cache);
+}
+
+/* Looks up a layout; the caller holds the lock */
+static struct complex_layout *find_layout(struct complex_layout_cache *cache,
+                                          char const *graph_pattern,
+                                          unsigned long h) {
+  struct complex_layout *cl = cache->buckets[h & (COMPLEX_LAYOUT_BUCKETS - 1)];
+  for (; cl != NULL; cl = cl->next) {
+    if (cl->hash == h && strcmp(cl->graph_pattern, graph_pattern) == 0)
+      return cl;
+  }
+  return NULL;
+}
+
+/*************************************************************************
+get_complex_layout:
+  In: world: simulation state
+      cache: layout cache
+      graph_pattern: graph pattern of an NFsim complex
+  Out: The relative positions of the molecules and components of the
+       complex, computed on the first request and cached.  Safe to call from
+       several threads at once.  Returns NULL if out of memory.
+*************************************************************************/
+static molcomp_list *get_complex_layout(struct volume *world,
+                                        struct complex_layout_cache *cache,
+                                        char const *graph_pattern) {
+  unsigned long h = hash(graph_pattern);
+
+  pthread_rwlock_rdlock(&cache->lock);
+  struct complex_layout *cl = find_layout(cache, graph_pattern, h);
+  if (cl != NULL)
+    atomic_store_explicit(&cl->last_used, cache->frame, memory_order_relaxed);
+  pthread_rwlock_unlock(&cache->lock);
+  if (cl != NULL)
+    return cl->mcl;
+
+  // This pattern has not been laid out yet, so do it outside of the lock
+  char **graph_parts = get_graph_strings ( graph_pattern );
+
+  // Print for use with external tools like the SpatialMols2D.java
+  if (world->dump_level >= 10) {
+    fprintf ( stdout, "=#= New Graph Pattern: %s\n", graph_pattern );
+  }
+
+  int num_parts = 0;
+  while (graph_parts[num_parts] != NULL)
+    num_parts++;
+
+  external_molcomp_loc *molcomp_array = build_molcomp_array ( world, graph_parts );
+  free_graph_parts ( graph_parts );
+
+  if (world->dump_level >= 20) {
+    fprintf ( stdout, "=============== molcomp_array ===============\n" );
+    dump_molcomp_array ( molcomp_array, num_parts );
+    fprintf ( stdout, "=============================================\n" );
+  }
+
+  molcomp_list *mcl = (molcomp_list *) malloc ( sizeof(molcomp_list) );
+  struct complex_layout *new_cl =
+      (struct complex_layout *)malloc(sizeof(struct complex_layout));
+  char *key = strdup(graph_pattern);
+  if (mcl == NULL || new_cl == NULL || key == NULL) {
+    free(mcl);
+    free(new_cl);
+    free(key);
+    return NULL;
+  }
+  mcl->molcomp_array = molcomp_array;
+  mcl->num_molcomp_items = num_parts;
+  new_cl->graph_pattern = key;
+  new_cl->hash = h;
+  new_cl->mcl = mcl;
+
+  // Another thread may have laid out the same pattern meanwhile
+  pthread_rwlock_wrlock(&cache->lock);
+  cl = find_layout(cache, graph_pattern, h);
+  if (cl == NULL) {
+    atomic_init(&new_cl->last_used, cache->frame);
+    struct complex_layout **bucket =
+        &cache->buckets[h & (COMPLEX_LAYOUT_BUCKETS - 1)];
+    new_cl->next = *bucket;
+    *bucket = new_cl;
+    cache->n_layouts++;
+    cl = new_cl;
+    new_cl = NULL;
+  } else {
+    atomic_store_explicit(&cl->last_used, cache->frame, memory_order_relaxed);
+  }
+  pthread_rwlock_unlock(&cache->lock);
+
+  if (new_cl != NULL) {
+    free_molcomp_list(new_cl->mcl);
+    free(new_cl->graph_pattern);
+    free(new_cl);
+  }
+  return cl->mcl;
+}
+
+static int compare_layout_age(void const *a, void const *b) {
+  long long ta = atomic_load_explicit(
+      &(*(struct complex_layout *const *)a)->last_used, memory_order_relaxed);
+  long long tb = atomic_load_explicit(
+      &(*(struct complex_layout *const *)b)->last_used, memory_order_relaxed);
+  return (ta > tb) - (ta < tb);
+}
+
+/*************************************************************************
+end_layout_frame:
+  In: cache: layout cache
+  Out: The frame is over.  If the cache holds more than
+       COMPLEX_LAYOUT_CACHE_MAX layouts, the least recently used ones are
+       freed.  No other thread may use the cache during the call.
+*************************************************************************/
+static void end_layout_frame(struct complex_layout_cache *cache) {
+  cache->frame++;
+  if (cache->n_layouts <= COMPLEX_LAYOUT_CACHE_MAX)
+    return;
+
+  struct complex_layout **all = CHECKED_MALLOC_ARRAY(
+      struct complex_layout *, cache->n_layouts, "complex layouts");
+  int n = 0;
+  for (int b = 0; b < COMPLEX_LAYOUT_BUCKETS; b++) {
+    for (struct complex_layout *cl = cache->buckets[b]; cl != NULL;
+         cl = cl->next)
+      all[n++] = cl;
+  }
+  qsort(all, n, sizeof(struct complex_layout *), compare_layout_age);
+
+  /* Mark the oldest ones by clearing their layout, then unlink them */
+  for (int i = 0; i < n - COMPLEX_LAYOUT_CACHE_MAX; i++) {
+    free_molcomp_list(all[i]->mcl);
+    all[i]->mcl = NULL;
+  }
+  free(all);
+  for (int b = 0; b < COMPLEX_LAYOUT_BUCKETS; b++) {
+    struct complex_layout **prev = &cache->buckets[b];
+    while (*prev != NULL) {
+      struct complex_layout *cl = *prev;
+      if (cl->mcl == NULL) {
+        *prev = cl->next;
+        free(cl->graph_pattern);
+        free(cl);
+        cache->n_layouts--;
+      } else {
+        prev = &cl->next;
+      }
+    }
+  }
+}
+
+/*************************************************************************
+complex_layout_cache_size:
+  In: none
+  Out: The number of layouts of NFsim complexes currently cached, 0 if no
+       frame with complexes has been written yet.
+*************************************************************************/
+int complex_layout_cache_size(void) {
+  return (complex_layouts != NULL) ? complex_layouts->n_layouts : 0;
+}
+
+/* Position of a molecule in a frame, with the layout of its complex */
+struct complex_placement {
+  float pos_x, pos_y, pos_z; /* in microns */
+  float norm_x, norm_y, norm_z;
+  char mol_type;
+  bool is_complex;
+  molcomp_list *mcl; /* NULL if the layout could not be computed */
+};
+
+/*************************************************************************
+place_complex:
+  In: world: simulation state
+      amp: molecule
+      placed: where to store its position and layout
+  Out: none.  Safe to call from several threads at once.
+*************************************************************************/
+static void place_complex(struct volume *world, struct abstract_molecule *amp,
+                          struct complex_placement *placed) {
+  float pos_x = 0.0;
+  float pos_y = 0.0;
+  float pos_z = 0.0;
+  float norm_x = 0.0;
+  float norm_y = 0.0;
+  float norm_z = 0.0;
+  if ((amp->properties->flags & NOT_FREE) == 0) {
+    struct volume_molecule *mp = (struct volume_molecule *)amp;
+    pos_x = mp->pos.x;
+    pos_y = mp->pos.y;
+    pos_z = mp->pos.z;
+  } else if ((amp->properties->flags & ON_GRID) != 0) {
+    struct surface_molecule *gmp = (struct surface_molecule *)amp;
+    struct vector3 where;
+    uv2xyz(&(gmp->s_pos), gmp->grid->surface, &where);
+    pos_x = where.x;
+    pos_y = where.y;
+    pos_z = where.z;
+  }
+
+  placed->pos_x = pos_x * world->length_unit;
+  placed->pos_y = pos_y * world->length_unit;
+  placed->pos_z = pos_z * world->length_unit;
+
+  placed->mol_type = 'v';
+  if ((amp->properties->flags & ON_GRID) != 0) {
+    placed->mol_type = 's';
+    struct surface_molecule *gmp = (struct surface_molecule *)amp;
+    short orient = gmp->orient;
+    norm_x = orient * gmp->grid->surface->normal.x;
+    norm_y = orient * gmp->grid->surface->normal.y;
+    norm_z = orient * gmp->grid->surface->normal.z;
+  }
+  placed->norm_x = norm_x;
+  placed->norm_y = norm_y;
+  placed->norm_z = norm_z;
+
+  placed->is_complex = (amp->properties->flags & EXTERNAL_SPECIES) != 0;
+  placed->mcl = NULL;
+  if (placed->is_complex)
+    placed->mcl = get_complex_layout(world, complex_layouts,
+                                     amp->graph_data->graph_pattern);
+}
+
 /************************************************************************
 output_cellblender_molecules:
 In: vizblk: VIZ_OUTPUT block for this frame list
@@ -1646,47 +1940,33 @@ static int output_cellblender_molecules(struct volume *world,
       /*  species_type = 1;*/
       /*}*/
 
+      /* Get the positions of the molecules and the layouts of their
+       * complexes in parallel; laying out a new complex is expensive */
+      struct complex_placement *placements = CHECKED_MALLOC_ARRAY(
+          struct complex_placement, this_mol_count, "complex placements");
+      if (complex_layouts == NULL)
+        complex_layouts = create_layout_cache();
+      int n_placed;
+#pragma omp parallel for schedule(dynamic, 64)
+      for (n_placed = 0; n_placed < (int)this_mol_count; n_placed++)
+        place_complex(world, mols[n_placed], &placements[n_placed]);
+
       /* Get and save positions of EXTERNAL_SPECIES volume and surface molecules: */
       for (unsigned int n_mol = 0; n_mol < this_mol_count; ++n_mol) {
         amp = mols[n_mol];
 
-        float pos_x = 0.0;
-        float pos_y = 0.0;
-        float pos_z = 0.0;
-        float norm_x = 0.0;
-        float norm_y = 0.0;
-        float norm_z = 0.0;
-        if ((amp->properties->flags & NOT_FREE) == 0) {
-          struct volume_molecule *mp = (struct volume_molecule *)amp;
-          pos_x = mp->pos.x;
-          pos_y = mp->pos.y;
-          pos_z = mp->pos.z;
-        } else if ((amp->properties->flags & ON_GRID) != 0) {
-          struct surface_molecule *gmp = (struct surface_molecule *)amp;
-          struct vector3 where;
-          uv2xyz(&(gmp->s_pos), gmp->grid->surface, &where);
-          pos_x = where.x;
-          pos_y = where.y;
-          pos_z = where.z;
-        }
-
-        pos_x *= world->length_unit;
-        pos_y *= world->length_unit;
-        pos_z *= world->length_unit;
-
-        char mol_type = 'v';
-        if ((amp->properties->flags & ON_GRID) != 0) {
-          mol_type = 's';
-          struct surface_molecule *gmp = (struct surface_molecule *)mols[n_mol];
-          short orient = gmp->orient;
-          norm_x = orient * gmp->grid->surface->normal.x;
-          norm_y = orient * gmp->grid->surface->normal.y;
-          norm_z = orient * gmp->grid->surface->normal.z;
-        }
+        struct complex_placement *placed = &placements[n_mol];
+        float pos_x = placed->pos_x;
+        float pos_y = placed->pos_y;
+        float pos_z = placed->pos_z;
+        float norm_x = placed->norm_x;
+        float norm_y = placed->norm_y;
+        float norm_z = placed->norm_z;
+        char mol_type = placed->mol_type;
 
         float x_offset = 0.0;
 
-        if ((amp->properties->flags & EXTERNAL_SPECIES) != 0) {
+        if (placed->is_complex) {
           /* This is complex molecule, so add a new viz molecule for each molecule in the complex */
           /* The graph pattern will be something like: */
           /*    c:SH2~NO_STATE!5,c:U~NO_STATE!5!3,c:a~NO_STATE!6,c:b~Y!6!1,c:g~Y!6,m:Lyn@PM!0!1,m:Rec@PM!2!3!4, */
@@ -1694,61 +1974,7 @@ static int output_cellblender_molecules(struct volume *world,
 
 /* BEGIN NEW PROCESSING */
 
-          if (graph_pattern_table == NULL) {
-            graph_pattern_table = init_symtab ( 10 );
-          }
-
-          struct sym_entry *sp;
-          sp = retrieve_sym(next_mol, graph_pattern_table);
-
-          if (sp == NULL) {
-
-            // This pattern has not been saved yet, so parse it, save it, and possibly print it.
-
-            char **graph_parts = get_graph_strings ( next_mol );
-
-            // Print for use with external tools like the SpatialMols2D.java
-            if (world->dump_level >= 10) {
-              fprintf ( stdout, "=#= New Graph Pattern: %s\n", next_mol );
-            }
-
-            // Count the number of parts in graph_parts linked list
-            int num_parts = 0;
-            char *next_part = graph_parts[num_parts];
-            while (next_part != NULL) {
-              //#### fprintf ( stdout, "  Graph Part %d: %s\n", num_parts, next_part );
-              num_parts++;
-              next_part = graph_parts[num_parts];
-            }
-
-            external_molcomp_loc *molcomp_array = build_molcomp_array ( world, graph_parts );
-
-            fprintf ( stdout, "=============== molcomp_array ===============\n" );
-            dump_molcomp_array ( molcomp_array, num_parts );
-            fprintf ( stdout, "=============================================\n" );
-
-            molcomp_list *mcl = (molcomp_list *) malloc ( sizeof(molcomp_list) );
-            mcl->molcomp_array = molcomp_array;
-            mcl->num_molcomp_items = num_parts;
-
-            //#### fprintf ( stdout, "=============== molcomp_list ===============\n" );
-            //#### dump_molcomp_list ( mcl );
-            //#### fprintf ( stdout, "=============================================\n" );
-
-            sp = store_sym ( next_mol, VOID_PTR, graph_pattern_table, mcl );
-
-            //#### fprintf ( stdout, "=============== graph_pattern_table ===============\n" );
-            //#### dump_symtab ( graph_pattern_table );
-            //#### fprintf ( stdout, "===================================================\n" );
-
-            free_graph_parts ( graph_parts );
-          }
-
-          molcomp_list *mcl = NULL;
-          if (sp != NULL) {
-            mcl = (molcomp_list *) sp->value;
-            // fprintf ( stdout, "     sp: %s\n", mcl->name );
-          }
+          molcomp_list *mcl = placed->mcl;
 
           if (mcl != NULL) {
 
@@ -1892,8 +2118,13 @@ static int output_cellblender_molecules(struct volume *world,
 
         }
       }
+      free(placements);
     }
 
+    /* The lists hold copies of the positions, so old layouts can go */
+    if (complex_layouts != NULL)
+      end_layout_frame(complex_layouts);
+
     /* Write out the molecules with their proper names */
     external_mol_viz_by_name *nl = mol_name_list;
     external_mol_viz *mv;
@@ -2141,6 +2372,11 @@ finalize_viz_output:
              into visualization output files.
 **************************************************************************/
 int finalize_viz_output(struct volume *world, struct viz_output_block *vizblk) {
+  if (complex_layouts != NULL) {
+    destroy_layout_cache(complex_layouts);
+    complex_layouts = NULL;
+  }
+
   if (vizblk == NULL)
     return 0;
 
@@ -27,9 +27,14 @@
 
 /* Header file for visualization output routines */
 
+/* Most layouts of NFsim complexes kept between viz output frames */
+#define COMPLEX_LAYOUT_CACHE_MAX 4096
+
 int update_frame_data_list(struct volume *world,
                            struct viz_output_block *vizblk);
 
 int init_frame_data_list(struct volume *world, struct viz_output_block *vizblk);
 
 int finalize_viz_output(struct volume *world, struct viz_output_block *vizblk);
+
+int complex_layout_cache_size(void);
@@ -385,29 +385,28 @@ int is_defunct_molecule(struct abstract_element *e) {
   return ((struct abstract_molecule *)e)->properties == NULL;
 }
 
-/*struct surface_molecule **/
-/*place_surface_molecule(struct volume *state, struct species *s,*/
-/*                       struct vector3 *loc, short orient, double search_diam,*/
-/*                       double t, struct subvolume **psv, char *mesh_name,*/
-/*                       struct string_buffer *reg_names,*/
-/*                       struct string_buffer *regions_to_ignore) {*/
-struct wall* find_closest_wall(
-    struct volume *state, struct vector3 *loc, double search_diam,
-    struct vector2 *best_uv, int *grid_index, struct species *s, char *mesh_name,
-    struct string_buffer *reg_names, struct string_buffer *regions_to_ignore) {
+/*************************************************************************
+closest_wall_in_reach:
+  In: state: simulation state
+      loc: 3D location
+      search_d2: squared search radius
+      best_uv: set to the closest point on the wall found
+      best_d2_out: set to the squared distance of that point
+      psv: set to the subvolume of that point
+      s, mesh_name, reg_names, regions_to_ignore: as for find_closest_wall
+  Out: The closest wall within the search radius, or NULL.  Only reads the
+       geometry, so it may be called from several threads at once.
+*************************************************************************/
+static struct wall *closest_wall_in_reach(
+    struct volume *state, struct vector3 *loc, double search_d2,
+    struct vector2 *best_uv, double *best_d2_out, struct subvolume **psv,
+    struct species *s, char *mesh_name, struct string_buffer *reg_names,
+    struct string_buffer *regions_to_ignore) {
 
   double d2;
   struct vector2 s_loc;
-
-  /*struct vector2 best_uv;*/
   struct vector3 best_xyz;
 
-  double search_d2;
-  if (search_diam <= EPS_C)
-    search_d2 = EPS_C * EPS_C;
-  else
-    search_d2 = search_diam * search_diam;
-
   struct subvolume *sv = find_subvolume(state, loc, NULL);
 
   char *species_name = s->sym->name;
@@ -541,12 +540,28 @@ struct wall* find_closest_wall(
     }
   }
 
-  if (best_w == NULL) {
-    return NULL;
-  }
+  *best_d2_out = best_d2;
+  *psv = sv;
+  return best_w;
+}
 
-  /* We can look this far around the surface we hit for an empty spot */
-  d2 = search_d2 - best_d2; 
+/*************************************************************************
+claim_wall_tile:
+  In: state: simulation state
+      best_w: wall found by closest_wall_in_reach
+      best_uv: point on it, moved to the free tile found
+      d2: squared distance we can look around that point for a free tile
+      sv: subvolume of the point
+      grid_index: set to the free tile
+      mesh_name, reg_names: as for find_closest_wall
+  Out: The wall with the free tile, or NULL if there is none.  The grid of
+       the wall is created if it has none yet.
+*************************************************************************/
+static struct wall *claim_wall_tile(struct volume *state, struct wall *best_w,
+                                    struct vector2 *best_uv, double d2,
+                                    struct subvolume *sv, int *grid_index,
+                                    char *mesh_name,
+                                    struct string_buffer *reg_names) {
 
   if (best_w->grid == NULL) {
     if (create_grid(state, best_w, sv))
@@ -582,40 +597,59 @@ struct wall* find_closest_wall(
   return best_w;
 }
 
-/*************************************************************************
-place_surface_molecule
-  In: species for the new molecule
-      3D location of the new molecule
-      orientation of the new molecule
-      diameter to search for a free surface spot
-      schedule time for the new molecule
-  Out: pointer to the new molecule, or NULL if no free spot was found.
-  Note: This function halts the program if it runs out of memory.
-        This function is similar to insert_surface_molecule, but it does
-        not schedule the molecule or add it to the count.  This is done
-        to simplify the logic when placing a surface macromolecule.
-        (i.e. place all molecules, and once we're sure we've succeeded,
-        schedule them all and count them all.)
- *************************************************************************/
-struct surface_molecule *
-place_surface_molecule(struct volume *state, struct species *s,
-                       struct vector3 *loc, short orient, double search_diam,
-                       double t, struct subvolume **psv, char *mesh_name,
-                       struct string_buffer *reg_names,
-                       struct string_buffer *regions_to_ignore,
-                       struct periodic_image *periodic_box) {
+/*struct surface_molecule **/
+/*place_surface_molecule(struct volume *state, struct species *s,*/
+/*                       struct vector3 *loc, short orient, double search_diam,*/
+/*                       double t, struct subvolume **psv, char *mesh_name,*/
+/*                       struct string_buffer *reg_names,*/
+/*                       struct string_buffer *regions_to_ignore) {*/
+struct wall* find_closest_wall(
+    struct volume *state, struct vector3 *loc, double search_diam,
+    struct vector2 *best_uv, int *grid_index, struct species *s, char *mesh_name,
+    struct string_buffer *reg_names, struct string_buffer *regions_to_ignore) {
 
-  struct vector2 best_uv;
-  struct vector3 best_xyz;
-  int grid_index = 0;
-  int *grid_index_p = &grid_index;
-  struct wall *best_w = find_closest_wall(
-    state, loc, search_diam, &best_uv, grid_index_p, s, mesh_name, reg_names,
-    regions_to_ignore);
+  double search_d2;
+  if (search_diam <= EPS_C)
+    search_d2 = EPS_C * EPS_C;
+  else
+    search_d2 = search_diam * search_diam;
 
+  double best_d2;
+  struct subvolume *sv;
+  struct wall *best_w =
+      closest_wall_in_reach(state, loc, search_d2, best_uv, &best_d2, &sv, s,
+                            mesh_name, reg_names, regions_to_ignore);
   if (best_w == NULL) {
-    return NULL; 
+    return NULL;
   }
+
+  /* We can look this far around the surface we hit for an empty spot */
+  return claim_wall_tile(state, best_w, best_uv, search_d2 - best_d2, sv,
+                         grid_index, mesh_name, reg_names);
+}
+
+/*************************************************************************
+place_surface_molecule_on_wall:
+  In: state: simulation state
+      s: species for the new molecule
+      best_w: wall with a free tile, from find_closest_wall
+      uv: position on the wall
+      grid_index: the free tile
+      orient: orientation of the new molecule
+      t: schedule time for the new molecule
+      psv: set to the subvolume of the new molecule
+      periodic_box: periodic image of the new molecule
+  Out: pointer to the new molecule, or NULL if the spot is outside of the
+       periodic box or taken by the same periodic image.  Like
+       place_surface_molecule, it does not schedule or count the molecule.
+*************************************************************************/
+static struct surface_molecule *place_surface_molecule_on_wall(
+    struct volume *state, struct species *s, struct wall *best_w,
+    struct vector2 *uv, int grid_index, short orient, double t,
+    struct subvolume **psv, struct periodic_image *periodic_box) {
+
+  struct vector2 best_uv = *uv;
+  struct vector3 best_xyz;
   if (state->periodic_box_obj) {
     struct polygon_object *p = (struct polygon_object*)(state->periodic_box_obj->contents);
     struct subdivided_box *sb = p->sb;
@@ -688,6 +722,44 @@ place_surface_molecule(struct volume *state, struct species *s,
   return sm;
 }
 
+/*************************************************************************
+place_surface_molecule
+  In: species for the new molecule
+      3D location of the new molecule
+      orientation of the new molecule
+      diameter to search for a free surface spot
+      schedule time for the new molecule
+  Out: pointer to the new molecule, or NULL if no free spot was found.
+  Note: This function halts the program if it runs out of memory.
+        This function is similar to insert_surface_molecule, but it does
+        not schedule the molecule or add it to the count.  This is done
+        to simplify the logic when placing a surface macromolecule.
+        (i.e. place all molecules, and once we're sure we've succeeded,
+        schedule them all and count them all.)
+ *************************************************************************/
+struct surface_molecule *
+place_surface_molecule(struct volume *state, struct species *s,
+                       struct vector3 *loc, short orient, double search_diam,
+                       double t, struct subvolume **psv, char *mesh_name,
+                       struct string_buffer *reg_names,
+                       struct string_buffer *regions_to_ignore,
+                       struct periodic_image *periodic_box) {
+
+  struct vector2 best_uv;
+  int grid_index = 0;
+  int *grid_index_p = &grid_index;
+  struct wall *best_w = find_closest_wall(
+    state, loc, search_diam, &best_uv, grid_index_p, s, mesh_name, reg_names,
+    regions_to_ignore);
+
+  if (best_w == NULL) {
+    return NULL; 
+  }
+  return place_surface_molecule_on_wall(state, s, best_w, &best_uv,
+                                        grid_index, orient, t, psv,
+                                        periodic_box);
+}
+
 /*************************************************************************
 insert_surface_molecule
   In: species for the new molecule
@@ -731,26 +803,16 @@ insert_surface_molecule(struct volume *state, struct species *s,
 }
 
 /*************************************************************************
-insert_volume_molecule
-  In: pointer to a volume_molecule that we're going to place in local storage
-      pointer to a volume_molecule that may be nearby
-  Out: pointer to the new volume_molecule (copies data from volume molecule
-       passed in), or NULL if out of memory.  Molecule is placed in scheduler
-       also.
+place_volume_molecule
+  In: state: simulation state
+      vm: volume molecule to copy into local storage
+      sv: subvolume of its position
+  Out: pointer to the new volume_molecule, or NULL if it is outside of the
+       periodic box.  Like insert_volume_molecule, but the molecule is not
+       scheduled.
 *************************************************************************/
-struct volume_molecule *insert_volume_molecule(
-    struct volume *state, struct volume_molecule *vm,
-    struct volume_molecule *vm_guess) {
-
-  struct subvolume *sv;
-
-  if (vm_guess == NULL)
-    sv = find_subvolume(state, &(vm->pos), NULL);
-  else if (inside_subvolume(&(vm->pos), vm_guess->subvol, state->x_fineparts,
-                            state->y_fineparts, state->z_fineparts))
-    sv = vm_guess->subvol;
-  else
-    sv = find_subvolume(state, &(vm->pos), vm_guess->subvol);
+static struct volume_molecule *place_volume_molecule(
+    struct volume *state, struct volume_molecule *vm, struct subvolume *sv) {
 
   // Make sure this molecule isn't outside of the periodic boundaries
   struct vector3 llf, urb;
@@ -796,11 +858,382 @@ struct volume_molecule *insert_volume_molecule(
                               new_vm->periodic_box);
   }
 
-  if (schedule_add(sv->local_storage->timer, new_vm))
+  return new_vm;
+}
+
+/*************************************************************************
+place_volume_molecule_near
+  In: pointer to a volume_molecule that we're going to place in local storage
+      pointer to a volume_molecule that may be nearby
+  Out: pointer to the new volume_molecule (copies data from volume molecule
+       passed in), or NULL if it is outside of the periodic box.  Like
+       insert_volume_molecule, but the molecule is not scheduled; the caller
+       schedules it in the timer of new_vm->subvol->local_storage.
+*************************************************************************/
+struct volume_molecule *place_volume_molecule_near(
+    struct volume *state, struct volume_molecule *vm,
+    struct volume_molecule *vm_guess) {
+
+  struct subvolume *sv;
+
+  if (vm_guess == NULL)
+    sv = find_subvolume(state, &(vm->pos), NULL);
+  else if (inside_subvolume(&(vm->pos), vm_guess->subvol, state->x_fineparts,
+                            state->y_fineparts, state->z_fineparts))
+    sv = vm_guess->subvol;
+  else
+    sv = find_subvolume(state, &(vm->pos), vm_guess->subvol);
+
+  return place_volume_molecule(state, vm, sv);
+}
+
+/*************************************************************************
+insert_volume_molecule
+  In: pointer to a volume_molecule that we're going to place in local storage
+      pointer to a volume_molecule that may be nearby
+  Out: pointer to the new volume_molecule (copies data from volume molecule
+       passed in), or NULL if out of memory.  Molecule is placed in scheduler
+       also.
+*************************************************************************/
+struct volume_molecule *insert_volume_molecule(
+    struct volume *state, struct volume_molecule *vm,
+    struct volume_molecule *vm_guess) {
+
+  struct volume_molecule *new_vm =
+      place_volume_molecule_near(state, vm, vm_guess);
+  if (new_vm == NULL)
+    return NULL;
+
+  if (schedule_add(new_vm->subvol->local_storage->timer, new_vm))
     mcell_allocfailed("Failed to add volume molecule to scheduler.");
   return new_vm;
 }
 
+/* Neighbor tables aim at this many molecules per cell, with at most
+ * NBR_MAX_CELLS_PER_AXIS cells along each axis of the subvolume. */
+#define NBR_MOLS_PER_CELL 4
+#define NBR_MAX_CELLS_PER_AXIS 16
+
+/* Species whose molecules are kept in neighbor tables */
+static int is_nbr_species(struct species *spec) {
+  return spec != NULL &&
+         (spec->flags & (CAN_VOLVOL | CAN_VOLVOLVOL | CAN_VOLVOLSURF)) != 0;
+}
+
+/***************************************************************************
+ nbr_cell_axis:
+    Find the cell of a neighbor table along one axis, clamping positions
+    outside of the subvolume to the outermost cells.
+
+ In: pos: coordinate along the axis
+     llf: lower bound of the table along the axis
+     r_edge: reciprocal of the cell edge length along the axis
+     n: number of cells along the axis
+ Out: The index of the cell.
+***************************************************************************/
+int nbr_cell_axis(double pos, double llf, double r_edge, int n) {
+  int i = (int)((pos - llf) * r_edge);
+  if (i < 0)
+    return 0;
+  if (i >= n)
+    return n - 1;
+  return i;
+}
+
+static int nbr_cell_index(struct nbr_table *t, struct vector3 *pos) {
+  int i = nbr_cell_axis(pos->x, t->llf.x, t->r_edge.x, t->nx);
+  int j = nbr_cell_axis(pos->y, t->llf.y, t->r_edge.y, t->ny);
+  int k = nbr_cell_axis(pos->z, t->llf.z, t->r_edge.z, t->nz);
+  return (i * t->ny + j) * t->nz + k;
+}
+
+static void nbr_cell_add(struct nbr_table *t, int cell,
+                         struct volume_molecule *vm) {
+  struct nbr_cell *c = &t->cells[cell];
+  if (c->n_mols == c->max_mols) {
+    int new_max = (c->max_mols > 0) ? 2 * c->max_mols : 2 * NBR_MOLS_PER_CELL;
+    struct volume_molecule **mols =
+        realloc(c->mols, new_max * sizeof(struct volume_molecule *));
+    if (mols == NULL)
+      mcell_allocfailed("Failed to grow neighbor table cell.");
+    c->mols = mols;
+    c->max_mols = new_max;
+  }
+  vm->nbr_cell = cell;
+  vm->nbr_slot = c->n_mols;
+  c->mols[c->n_mols++] = vm;
+  t->n_mols++;
+}
+
+/***************************************************************************
+ nbr_table_remove:
+    Remove a molecule from the neighbor table of its subvolume.  The last
+    molecule of the cell is moved into the vacated slot.
+
+ In: vm: the molecule
+ Out: Nothing.
+***************************************************************************/
+static void nbr_table_remove(struct volume_molecule *vm) {
+  struct nbr_table *t = vm->subvol->nbr_table;
+  struct nbr_cell *c = &t->cells[vm->nbr_cell];
+  int last = --c->n_mols;
+  if (vm->nbr_slot != last) {
+    struct volume_molecule *moved = c->mols[last];
+    c->mols[vm->nbr_slot] = moved;
+    moved->nbr_slot = vm->nbr_slot;
+  }
+  t->n_mols--;
+  vm->nbr_cell = -1;
+  vm->nbr_slot = -1;
+}
+
+/***************************************************************************
+ nbr_table_add:
+    Add a molecule which was just linked into its subvolume to the neighbor
+    table of the subvolume, if there is one and the molecule belongs in it.
+
+ In: vm: the molecule
+ Out: Nothing.
+***************************************************************************/
+static void nbr_table_add(struct volume_molecule *vm) {
+  struct nbr_table *t = vm->subvol->nbr_table;
+  if (t == NULL || !is_nbr_species(vm->properties)) {
+    vm->nbr_cell = -1;
+    vm->nbr_slot = -1;
+    return;
+  }
+  nbr_cell_add(t, nbr_cell_index(t, &vm->pos), vm);
+}
+
+/***************************************************************************
+ layout_nbr_table:
+    Size the cells of a neighbor table for the molecules now in the
+    subvolume and fill them.
+
+ In: world: simulation state
+     sv: the subvolume
+     t: its table, with no cells
+ Out: Nothing.
+***************************************************************************/
+static void layout_nbr_table(struct volume *world, struct subvolume *sv,
+                             struct nbr_table *t) {
+  int n_mols = 0;
+  for (struct per_species_list *psl = sv->species_head; psl != NULL;
+       psl = psl->next) {
+    if (!is_nbr_species(psl->properties))
+      continue;
+    for (struct volume_molecule *vm = psl->head; vm != NULL; vm = vm->next_v)
+      n_mols++;
+  }
+
+  t->llf.x = world->x_fineparts[sv->llf.x];
+  t->llf.y = world->y_fineparts[sv->llf.y];
+  t->llf.z = world->z_fineparts[sv->llf.z];
+  struct vector3 edge = { world->x_fineparts[sv->urb.x] - t->llf.x,
+                          world->y_fineparts[sv->urb.y] - t->llf.y,
+                          world->z_fineparts[sv->urb.z] - t->llf.z };
+
+  /* Cubic cells holding NBR_MOLS_PER_CELL molecules on average, but no
+   * smaller than the interaction diameter */
+  double n_cells = (double)n_mols / NBR_MOLS_PER_CELL;
+  double cell = cbrt(edge.x * edge.y * edge.z / (n_cells > 1.0 ? n_cells : 1.0));
+  if (cell < 2.0 * world->rx_radius_3d)
+    cell = 2.0 * world->rx_radius_3d;
+  int n[3];
+  double e[3] = { edge.x, edge.y, edge.z };
+  for (int a = 0; a < 3; a++) {
+    n[a] = (cell > 0.0) ? (int)ceil(e[a] / cell) : 1;
+    if (n[a] < 1)
+      n[a] = 1;
+    if (n[a] > NBR_MAX_CELLS_PER_AXIS)
+      n[a] = NBR_MAX_CELLS_PER_AXIS;
+  }
+  t->nx = n[0];
+  t->ny = n[1];
+  t->nz = n[2];
+  t->r_edge.x = t->nx / edge.x;
+  t->r_edge.y = t->ny / edge.y;
+  t->r_edge.z = t->nz / edge.z;
+
+  t->cells = CHECKED_MALLOC_ARRAY(struct nbr_cell, t->nx * t->ny * t->nz,
+                                  "neighbor table cells");
+  memset(t->cells, 0, t->nx * t->ny * t->nz * sizeof(struct nbr_cell));
+  t->n_mols = 0;
+  for (struct per_species_list *psl = sv->species_head; psl != NULL;
+       psl = psl->next) {
+    if (!is_nbr_species(psl->properties))
+      continue;
+    for (struct volume_molecule *vm = psl->head; vm != NULL; vm = vm->next_v)
+      nbr_cell_add(t, nbr_cell_index(t, &vm->pos), vm);
+  }
+  t->built_n_mols = t->n_mols;
+}
+
+static void free_nbr_cells(struct nbr_table *t) {
+  for (int c = 0; c < t->nx * t->ny * t->nz; c++)
+    free(t->cells[c].mols);
+  free(t->cells);
+  t->cells = NULL;
+}
+
+/***************************************************************************
+ get_nbr_table:
+    Get the neighbor table of a subvolume, creating it on first use.  Once
+    per iteration the cells are laid out again if the number of molecules
+    has changed a lot since they were sized.
+
+ In: world: simulation state
+     sv: the subvolume
+ Out: The neighbor table, holding all molecules of the subvolume which can
+      take part in mol-mol[-*] reactions.
+***************************************************************************/
+struct nbr_table *get_nbr_table(struct volume *world, struct subvolume *sv) {
+  struct nbr_table *t = sv->nbr_table;
+  if (t == NULL) {
+    t = CHECKED_MALLOC_STRUCT(struct nbr_table, "neighbor table");
+    memset(t, 0, sizeof(struct nbr_table));
+    layout_nbr_table(world, sv, t);
+    t->iteration = world->current_iterations;
+    sv->nbr_table = t;
+    return t;
+  }
+
+  if (t->iteration != world->current_iterations) {
+    t->iteration = world->current_iterations;
+    int lo = t->built_n_mols / 2, hi = 2 * t->built_n_mols;
+    if (t->n_mols > hi + NBR_MOLS_PER_CELL || t->n_mols < lo) {
+      free_nbr_cells(t);
+      layout_nbr_table(world, sv, t);
+    }
+  }
+  return t;
+}
+
+/***************************************************************************
+ destroy_nbr_table:
+    Free the neighbor table of a subvolume.  The molecules in it are left
+    with stale cells, so this is only for when they are going away too.
+
+ In: sv: the subvolume
+ Out: Nothing.
+***************************************************************************/
+void destroy_nbr_table(struct subvolume *sv) {
+  if (sv->nbr_table == NULL)
+    return;
+  free_nbr_cells(sv->nbr_table);
+  free(sv->nbr_table);
+  sv->nbr_table = NULL;
+}
+
+/***************************************************************************
+ species_array_add:
+    Append a molecule and its current position to the contiguous arrays of a
+    per-species list, growing the arrays if necessary.
+
+ In: psl: the per-species list
+     vm: the molecule
+ Out: Nothing.  The molecule remembers its slot so it can be removed in O(1).
+***************************************************************************/
+static void species_array_add(struct per_species_list *psl,
+                              struct volume_molecule *vm) {
+  if (psl->n_mols == psl->max_mols) {
+    int new_max = (psl->max_mols > 0) ? 2 * psl->max_mols : 16;
+    struct volume_molecule **mols =
+        realloc(psl->mols, new_max * sizeof(struct volume_molecule *));
+    double *pos_x = realloc(psl->pos_x, new_max * sizeof(double));
+    double *pos_y = realloc(psl->pos_y, new_max * sizeof(double));
+    double *pos_z = realloc(psl->pos_z, new_max * sizeof(double));
+    if (mols == NULL || pos_x == NULL || pos_y == NULL || pos_z == NULL)
+      mcell_allocfailed("Failed to grow per-species molecule array.");
+    psl->mols = mols;
+    psl->pos_x = pos_x;
+    psl->pos_y = pos_y;
+    psl->pos_z = pos_z;
+    psl->max_mols = new_max;
+  }
+
+  int idx = psl->n_mols++;
+  psl->mols[idx] = vm;
+  psl->pos_x[idx] = vm->pos.x;
+  psl->pos_y[idx] = vm->pos.y;
+  psl->pos_z[idx] = vm->pos.z;
+  vm->psl = psl;
+  vm->psl_index = idx;
+}
+
+/***************************************************************************
+ species_array_remove:
+    Remove a molecule from the contiguous arrays of its per-species list.  The
+    last entry is moved into the vacated slot.
+
+ In: vm: the molecule
+ Out: Nothing.
+***************************************************************************/
+static void species_array_remove(struct volume_molecule *vm) {
+  struct per_species_list *psl = vm->psl;
+  if (psl == NULL)
+    return;
+
+  int idx = vm->psl_index;
+  int last = --psl->n_mols;
+  if (idx != last) {
+    struct volume_molecule *moved = psl->mols[last];
+    psl->mols[idx] = moved;
+    psl->pos_x[idx] = psl->pos_x[last];
+    psl->pos_y[idx] = psl->pos_y[last];
+    psl->pos_z[idx] = psl->pos_z[last];
+    moved->psl_index = idx;
+  }
+  vm->psl = NULL;
+  vm->psl_index = -1;
+}
+
+/***************************************************************************
+ update_species_array_pos:
+    Copy the current position of a molecule into its species array slot, and
+    move it to its new cell in the neighbor table.  Must be called whenever a
+    molecule which stays in its subvolume moves.
+
+ In: vm: the molecule
+ Out: Nothing.
+***************************************************************************/
+void update_species_array_pos(struct volume_molecule *vm) {
+  if (vm->nbr_cell >= 0) {
+    struct nbr_table *t = vm->subvol->nbr_table;
+    int cell = nbr_cell_index(t, &vm->pos);
+    if (cell != vm->nbr_cell) {
+      nbr_table_remove(vm);
+      nbr_cell_add(t, cell, vm);
+    }
+  }
+
+  struct per_species_list *psl = vm->psl;
+  if (psl == NULL)
+    return;
+
+  psl->pos_x[vm->psl_index] = vm->pos.x;
+  psl->pos_y[vm->psl_index] = vm->pos.y;
+  psl->pos_z[vm->psl_index] = vm->pos.z;
+}
+
+/***************************************************************************
+ free_species_arrays:
+    Release the contiguous arrays of a per-species list before the list itself
+    is returned to its memory pool.
+
+ In: psl: the per-species list
+ Out: Nothing.
+***************************************************************************/
+void free_species_arrays(struct per_species_list *psl) {
+  free(psl->mols);
+  free(psl->pos_x);
+  free(psl->pos_y);
+  free(psl->pos_z);
+  psl->mols = NULL;
+  psl->pos_x = psl->pos_y = psl->pos_z = NULL;
+  psl->n_mols = psl->max_mols = 0;
+}
+
 static int remove_from_list(struct volume_molecule *it) {
   if (it->prev_v) {
 #ifdef DEBUG_LIST_CHECKS
@@ -824,6 +1257,9 @@ static int remove_from_list(struct volume_molecule *it) {
   }
   it->prev_v = NULL;
   it->next_v = NULL;
+  species_array_remove(it);
+  if (it->nbr_cell >= 0)
+    nbr_table_remove(it);
   return 1;
 }
 
@@ -1095,12 +1531,12 @@ static int vacuum_inside_regions(struct volume *state,
 /*************************************************************************
  is_point_inside_release_region:
     Check if a given point is inside the specified region.
-
+    Returns 1 if it is, 0 if it is not, and -1 if the point is too close to
+    a wall (or the ray from the waypoint grazes one) to tell.
 *************************************************************************/
-static int is_point_inside_region(struct volume *state,
-                                  struct vector3 const *pos,
-                                  struct release_evaluator *expression,
-                                  struct subvolume *sv) {
+int is_point_inside_region(struct volume *state, struct vector3 const *pos,
+                           struct release_evaluator *expression,
+                           struct subvolume *sv) {
   struct region_list *extra_in = NULL, *extra_out = NULL, *cur_region;
   struct waypoint *wp;
   struct vector3 delta;
@@ -1166,7 +1602,7 @@ static int is_point_inside_region(struct volume *state,
       mem_put_list(sv->local_storage->regl, extra_in);
     if (extra_out != NULL)
       mem_put_list(sv->local_storage->regl, extra_out);
-    return 0;
+    return -1;
   }
 
   for (cur_region = extra_in; cur_region != NULL;
@@ -1195,6 +1631,199 @@ static int is_point_inside_region(struct volume *state,
   return result;
 }
 
+/* index of the cell along one axis containing v, clamped to the grid */
+static int voxel_index(double lo, double size, int n, double v) {
+  int i = (int)floor((v - lo) / size);
+  return (i < 0) ? 0 : (i >= n) ? n - 1 : i;
+}
+
+/*************************************************************************
+mark_boundary_voxels:
+  In: state: simulation state
+      cache: voxel cache, with the grid set up
+  Out: Every cell touched by a wall with counting regions is marked as a
+       boundary cell.  The test is conservative: a cell which the plane of a
+       wall passes through within the bounding box of the wall is marked
+       although the wall itself may miss it.
+*************************************************************************/
+static void mark_boundary_voxels(struct volume *state,
+                                 struct release_voxel_cache *cache) {
+  /* Keep walls which lie on a cell face from being missed by rounding */
+  double eps_x = 1e-6 * cache->cell_size.x;
+  double eps_y = 1e-6 * cache->cell_size.y;
+  double eps_z = 1e-6 * cache->cell_size.z;
+
+  for (int i = 0; i < state->n_subvols; i++) {
+    struct subvolume *sv = &state->subvol[i];
+    if (state->x_fineparts[sv->llf.x] > cache->urb.x ||
+        state->x_fineparts[sv->urb.x] < cache->llf.x ||
+        state->y_fineparts[sv->llf.y] > cache->urb.y ||
+        state->y_fineparts[sv->urb.y] < cache->llf.y ||
+        state->z_fineparts[sv->llf.z] > cache->urb.z ||
+        state->z_fineparts[sv->urb.z] < cache->llf.z)
+      continue;
+
+    for (int j = 0; j < sv->n_walls; j++) {
+      struct wall *w = sv->walls[j];
+      if (w->counting_regions == NULL)
+        continue;
+
+      struct vector3 lo = *w->vert[0], hi = *w->vert[0];
+      for (int k = 1; k < 3; k++) {
+        lo.x = min2d(lo.x, w->vert[k]->x);
+        lo.y = min2d(lo.y, w->vert[k]->y);
+        lo.z = min2d(lo.z, w->vert[k]->z);
+        hi.x = max2d(hi.x, w->vert[k]->x);
+        hi.y = max2d(hi.y, w->vert[k]->y);
+        hi.z = max2d(hi.z, w->vert[k]->z);
+      }
+      if (lo.x > cache->urb.x || hi.x < cache->llf.x ||
+          lo.y > cache->urb.y || hi.y < cache->llf.y ||
+          lo.z > cache->urb.z || hi.z < cache->llf.z)
+        continue;
+
+      int x0 = voxel_index(cache->llf.x, cache->cell_size.x,
+                             cache->n[0], lo.x - eps_x);
+      int x1 = voxel_index(cache->llf.x, cache->cell_size.x,
+                             cache->n[0], hi.x + eps_x);
+      int y0 = voxel_index(cache->llf.y, cache->cell_size.y,
+                             cache->n[1], lo.y - eps_y);
+      int y1 = voxel_index(cache->llf.y, cache->cell_size.y,
+                             cache->n[1], hi.y + eps_y);
+      int z0 = voxel_index(cache->llf.z, cache->cell_size.z,
+                             cache->n[2], lo.z - eps_z);
+      int z1 = voxel_index(cache->llf.z, cache->cell_size.z,
+                             cache->n[2], hi.z + eps_z);
+      /* Only cells which the plane of the wall passes through are marked,
+       * the bounding box of a slanted wall covers many more */
+      double reach = fabs(w->normal.x) * (0.5 * cache->cell_size.x + eps_x) +
+                     fabs(w->normal.y) * (0.5 * cache->cell_size.y + eps_y) +
+                     fabs(w->normal.z) * (0.5 * cache->cell_size.z + eps_z);
+      for (int x = x0; x <= x1; x++) {
+        for (int y = y0; y <= y1; y++) {
+          for (int z = z0; z <= z1; z++) {
+            struct vector3 centre;
+            centre.x = cache->llf.x + (x + 0.5) * cache->cell_size.x;
+            centre.y = cache->llf.y + (y + 0.5) * cache->cell_size.y;
+            centre.z = cache->llf.z + (z + 0.5) * cache->cell_size.z;
+            if (fabs(dot_prod(&w->normal, &centre) - w->d) > reach)
+              continue;
+            cache->cells[(x * cache->n[1] + y) * cache->n[2] + z] =
+                RELEASE_VOXEL_BOUNDARY;
+          }
+        }
+      }
+    }
+  }
+}
+
+/*************************************************************************
+build_release_voxel_cache:
+  In: state: simulation state
+      rrd: release region data, with its bounding box set up
+  Out: A new voxel cache of the region.  The cells away from the walls are
+       classified by a single ray cast from their centre; a cell whose centre
+       cannot be classified is treated as a boundary cell.
+*************************************************************************/
+static struct release_voxel_cache *
+build_release_voxel_cache(struct volume *state,
+                          struct release_region_data *rrd) {
+  struct release_voxel_cache *cache = CHECKED_MALLOC_STRUCT(
+      struct release_voxel_cache, "release region voxel cache");
+  cache->geometry_generation = state->geometry_generation;
+  cache->llf = rrd->llf;
+  cache->urb = rrd->urb;
+
+  /* Cubic cells, as many as fit into RELEASE_VOXELS_MAX */
+  double extent[3] = { rrd->urb.x - rrd->llf.x, rrd->urb.y - rrd->llf.y,
+                       rrd->urb.z - rrd->llf.z };
+  double edge = cbrt(extent[0] * extent[1] * extent[2] / RELEASE_VOXELS_MAX);
+  long n_cells = 1;
+  for (int i = 0; i < 3; i++) {
+    cache->n[i] = (edge > 0) ? (int)floor(extent[i] / edge) : 1;
+    if (cache->n[i] < 1)
+      cache->n[i] = 1;
+    n_cells *= cache->n[i];
+  }
+  cache->cell_size.x = extent[0] / cache->n[0];
+  cache->cell_size.y = extent[1] / cache->n[1];
+  cache->cell_size.z = extent[2] / cache->n[2];
+
+  cache->cells =
+      CHECKED_MALLOC_ARRAY(byte, n_cells, "release region voxel cache");
+  cache->candidates =
+      CHECKED_MALLOC_ARRAY(int, n_cells, "release region voxel cache");
+  memset(cache->cells, RELEASE_VOXEL_OUTSIDE, n_cells * sizeof(byte));
+  mark_boundary_voxels(state, cache);
+
+  cache->n_candidates = 0;
+  struct subvolume *sv = NULL;
+  for (int x = 0; x < cache->n[0]; x++) {
+    for (int y = 0; y < cache->n[1]; y++) {
+      for (int z = 0; z < cache->n[2]; z++) {
+        int c = (x * cache->n[1] + y) * cache->n[2] + z;
+        if (cache->cells[c] != RELEASE_VOXEL_BOUNDARY) {
+          struct vector3 centre;
+          centre.x = cache->llf.x + (x + 0.5) * cache->cell_size.x;
+          centre.y = cache->llf.y + (y + 0.5) * cache->cell_size.y;
+          centre.z = cache->llf.z + (z + 0.5) * cache->cell_size.z;
+          sv = find_subvolume(state, &centre, sv);
+          switch (is_point_inside_region(state, &centre, rrd->expression,
+                                         sv)) {
+          case 1:
+            cache->cells[c] = RELEASE_VOXEL_INSIDE;
+            break;
+          case 0:
+            break;
+          default:
+            cache->cells[c] = RELEASE_VOXEL_BOUNDARY;
+            break;
+          }
+        }
+        if (cache->cells[c] != RELEASE_VOXEL_OUTSIDE)
+          cache->candidates[cache->n_candidates++] = c;
+      }
+    }
+  }
+  return cache;
+}
+
+/*************************************************************************
+destroy_release_voxel_cache:
+  In: cache: voxel cache of a release region, may be NULL
+  Out: The cache is freed.
+*************************************************************************/
+void destroy_release_voxel_cache(struct release_voxel_cache *cache) {
+  if (cache == NULL)
+    return;
+  free(cache->cells);
+  free(cache->candidates);
+  free(cache);
+}
+
+/*************************************************************************
+get_release_voxel_cache:
+  In: state: simulation state
+      rrd: release region data
+  Out: The voxel cache of the region, (re)built if there is none yet or the
+       walls or bounding box changed since it was built.
+*************************************************************************/
+struct release_voxel_cache *
+get_release_voxel_cache(struct volume *state,
+                        struct release_region_data *rrd) {
+  struct release_voxel_cache *cache = rrd->voxels;
+  if (cache != NULL &&
+      (cache->geometry_generation != state->geometry_generation ||
+       distinguishable_vec3(&cache->llf, &rrd->llf, EPS_C) ||
+       distinguishable_vec3(&cache->urb, &rrd->urb, EPS_C))) {
+    destroy_release_voxel_cache(cache);
+    cache = NULL;
+  }
+  if (cache == NULL)
+    rrd->voxels = cache = build_release_voxel_cache(state, rrd);
+  return cache;
+}
+
 /*************************************************************************
 release_inside_regions:
   In: pointer to a release site object
@@ -1223,15 +1852,45 @@ static int release_inside_regions(struct volume *state,
   if (n < 0)
     return vacuum_inside_regions(state, rso, vm, n);
 
+  /* With a concentration the molecules of a CSG region are placed by trials
+   * over the whole bounding box, each of which succeeds if it lands inside */
+  bool trials = (rso->release_number_method == CCNNUM && !exactNumber);
+
+  struct release_voxel_cache *cache = get_release_voxel_cache(state, rrd);
+  int n_cells = cache->n[0] * cache->n[1] * cache->n[2];
+  if (cache->n_candidates == 0) {
+    if (trials)
+      return 0;
+    mcell_error("Release site '%s' has no volume inside its region.",
+                rso->name);
+  }
+
   struct volume_molecule *new_vm = NULL;
   struct subvolume *sv = NULL;
   while (n > 0) {
-    vm->pos.x = rrd->llf.x + (rrd->urb.x - rrd->llf.x) * rng_dbl(state->rng);
-    vm->pos.y = rrd->llf.y + (rrd->urb.y - rrd->llf.y) * rng_dbl(state->rng);
-    vm->pos.z = rrd->llf.z + (rrd->urb.z - rrd->llf.z) * rng_dbl(state->rng);
-
-    if (!is_point_inside_region(state, &vm->pos, rrd->expression, NULL)) {
-      if (rso->release_number_method == CCNNUM && !exactNumber)
+    double u[4];
+    rng_fill_dbl(state->rng, u, 4);
+
+    /* Pick a cell which is not outside.  A trial picks any cell, so that it
+     * fails as often as it would over the whole bounding box. */
+    int k = (int)(u[3] * (trials ? n_cells : cache->n_candidates));
+    if (trials && k >= cache->n_candidates) {
+      n--;
+      continue;
+    }
+    if (k >= cache->n_candidates)
+      k = cache->n_candidates - 1;
+    int c = cache->candidates[k];
+    int z = c % cache->n[2];
+    int y = (c / cache->n[2]) % cache->n[1];
+    int x = c / (cache->n[2] * cache->n[1]);
+    vm->pos.x = cache->llf.x + (x + u[0]) * cache->cell_size.x;
+    vm->pos.y = cache->llf.y + (y + u[1]) * cache->cell_size.y;
+    vm->pos.z = cache->llf.z + (z + u[2]) * cache->cell_size.z;
+
+    if (cache->cells[c] == RELEASE_VOXEL_BOUNDARY &&
+        is_point_inside_region(state, &vm->pos, rrd->expression, NULL) != 1) {
+      if (trials)
         n--;
       continue;
     }
@@ -1475,9 +2134,11 @@ int release_ellipsoid_or_rectcuboid(struct volume *state,
   for (int i = 0; i < number; i++) {
     do /* Pick values in unit square, toss if not in unit circle */
     {
-      pos.x = (rng_dbl(state->rng) - 0.5);
-      pos.y = (rng_dbl(state->rng) - 0.5);
-      pos.z = (rng_dbl(state->rng) - 0.5);
+      double u[3];
+      rng_fill_dbl(state->rng, u, 3);
+      pos.x = (u[0] - 0.5);
+      pos.y = (u[1] - 0.5);
+      pos.z = (u[2] - 0.5);
     } while (is_spheroidal &&
              pos.x * pos.x + pos.y * pos.y + pos.z * pos.z >= 0.25);
 
@@ -1521,6 +2182,251 @@ int release_ellipsoid_or_rectcuboid(struct volume *state,
   return 0;
 }
 
+/* LIST releases of at least this many molecules go through
+ * release_by_list_bulk */
+#define LIST_RELEASE_BULK_MIN 1024
+/* ... which are placed this many at a time */
+#define LIST_RELEASE_CHUNK 4096
+
+/* One molecule of a bulk LIST release */
+struct list_release_item {
+  struct release_single_molecule *rsm;
+  struct vector3 pos;   /* transformed position */
+  struct subvolume *sv; /* subvolume of pos, or of the closest wall point */
+  struct wall *w;       /* surface molecules: closest wall, or NULL */
+  struct vector2 uv;    /* closest point on w */
+  double d2;            /* squared distance to that point */
+};
+
+/* Molecules placed by a bulk LIST release into one storage, waiting to be
+ * scheduled */
+struct list_release_chain {
+  struct storage *store;
+  struct abstract_element *head;
+  struct abstract_element *tail;
+};
+
+/*************************************************************************
+list_release_append:
+  In: chains: hash table of chains, one per storage
+      mask: size of the table minus one
+      store: storage of the molecule
+      ae: the molecule
+  Out: The molecule is appended to the chain of its storage.
+*************************************************************************/
+static void list_release_append(struct list_release_chain *chains,
+                                unsigned int mask, struct storage *store,
+                                struct abstract_element *ae) {
+  unsigned int i =
+      (unsigned int)(((uintptr_t)store >> 4) * 2654435761u) & mask;
+  while (chains[i].store != NULL && chains[i].store != store)
+    i = (i + 1) & mask;
+
+  ae->next = NULL;
+  if (chains[i].store == NULL) {
+    chains[i].store = store;
+    chains[i].head = ae;
+  } else
+    chains[i].tail->next = ae;
+  chains[i].tail = ae;
+}
+
+/*************************************************************************
+schedule_list_release:
+  In: chains: hash table of chains, one per storage
+      n_chains: size of the table
+  Out: The molecules are scheduled, with one scheduler call per storage.
+       Within a storage they keep the order in which they were placed, so
+       the schedulers end up as if each molecule had been added by itself.
+*************************************************************************/
+static void schedule_list_release(struct list_release_chain *chains,
+                                  unsigned int n_chains) {
+  for (unsigned int i = 0; i < n_chains; i++) {
+    if (chains[i].store == NULL)
+      continue;
+    if (schedule_insert_list(chains[i].store->timer, chains[i].head, 1))
+      mcell_allocfailed("Failed to add molecules to scheduler.");
+  }
+}
+
+/*************************************************************************
+locate_list_release_items:
+  In: state: MCell simulation state
+      req: release event
+      items: molecules of the list, with only rsm set
+      n_items: how many
+      search_d2: squared search radius for surface molecules
+  Out: The positions of the molecules are transformed, and their subvolumes,
+       or for surface molecules their closest walls, found.  This only reads
+       the world, so the items are done in parallel.
+*************************************************************************/
+static void locate_list_release_items(struct volume *state,
+                                      struct release_event_queue *req,
+                                      struct list_release_item *items,
+                                      int n_items, double search_d2) {
+  struct release_site_obj *rso = req->release_site;
+
+#pragma omp parallel for schedule(static)
+  for (int k = 0; k < n_items; k++) {
+    struct list_release_item *it = &items[k];
+    double location[1][4];
+    location[0][0] = it->rsm->loc.x + rso->location->x;
+    location[0][1] = it->rsm->loc.y + rso->location->y;
+    location[0][2] = it->rsm->loc.z + rso->location->z;
+    location[0][3] = 1;
+
+    mult_matrix(location, req->t_matrix, location, 1, 4, 4);
+
+    it->pos.x = location[0][0];
+    it->pos.y = location[0][1];
+    it->pos.z = location[0][2];
+
+    if ((it->rsm->mol_type->flags & NOT_FREE) == 0) {
+      it->sv = find_subvolume(state, &it->pos, NULL);
+      it->w = NULL;
+    } else {
+      it->w = closest_wall_in_reach(state, &it->pos, search_d2, &it->uv,
+                                    &it->d2, &it->sv, it->rsm->mol_type, NULL,
+                                    NULL, NULL);
+    }
+  }
+}
+
+/*************************************************************************
+release_by_list_bulk:
+    Does the same as release_by_list, for long lists.  The list is taken in
+    chunks of LIST_RELEASE_CHUNK molecules.  For each chunk the positions
+    are transformed, and their subvolumes and closest walls found, in
+    parallel.  The molecules are then placed one by one in list order, so
+    that they get the same ids and random numbers as with release_by_list.
+    They are scheduled at the end, in one go per storage.
+
+  In: state: MCell simulation state
+      req: release event
+      vm: volume molecule being released
+      n_released: set to the number of molecules released
+      n_failed: set to the number of surface molecules without a free spot
+  Out: 0 on success, 1 on failure
+*************************************************************************/
+static int release_by_list_bulk(struct volume *state,
+                                struct release_event_queue *req,
+                                struct volume_molecule *vm, int *n_released,
+                                int *n_failed) {
+  struct release_site_obj *rso = req->release_site;
+
+  double diam = (rso->diameter == NULL) ? 0.0 : rso->diameter->x;
+  double search_d2 = (diam <= EPS_C) ? EPS_C * EPS_C : diam * diam;
+
+  struct list_release_item *items = CHECKED_MALLOC_ARRAY(
+      struct list_release_item, LIST_RELEASE_CHUNK, "LIST release positions");
+
+  /* At most half full, so that the probes stay short */
+  unsigned int n_stores = 0;
+  for (struct storage_list *sl = state->storage_head; sl != NULL; sl = sl->next)
+    n_stores++;
+  unsigned int n_chains = 4;
+  while (n_chains < 2 * n_stores)
+    n_chains *= 2;
+  struct list_release_chain *chains = CHECKED_MALLOC_ARRAY(
+      struct list_release_chain, n_chains, "LIST release storages");
+  memset(chains, 0, n_chains * sizeof(struct list_release_chain));
+
+  int status = 0;
+  struct species *last_spec = NULL;
+  int spec_flags = 0;
+  struct release_single_molecule *next_rsm = rso->mol_list;
+  while (next_rsm != NULL && status == 0) {
+    int n_items = 0;
+    for (; next_rsm != NULL && n_items < LIST_RELEASE_CHUNK;
+         next_rsm = next_rsm->next)
+      items[n_items++].rsm = next_rsm;
+    locate_list_release_items(state, req, items, n_items, search_d2);
+
+    for (int k = 0; k < n_items; k++) {
+      struct list_release_item *it = &items[k];
+      struct release_single_molecule *rsm = it->rsm;
+      vm->pos = it->pos;
+
+      if ((rsm->mol_type->flags & NOT_FREE) == 0) {
+        struct abstract_molecule *ap = (struct abstract_molecule *)(vm);
+        vm->properties = rsm->mol_type;
+        // Same flags as release_by_list, worked out once per run of a species
+        if (rsm->mol_type != last_spec) {
+          last_spec = rsm->mol_type;
+          initialize_diffusion_function(ap);
+          spec_flags = 0;
+          if (trigger_unimolecular(state->reaction_hash, state->rx_hashsize,
+                                   ap->properties->hashval, ap) != NULL ||
+              (ap->properties->flags & CAN_SURFWALL) != 0)
+            spec_flags |= ACT_REACT;
+          if (vm->get_space_step(vm) > 0.0)
+            spec_flags |= ACT_DIFFUSE;
+        }
+        ap->flags |= spec_flags;
+
+        struct volume_molecule *new_vm =
+            place_volume_molecule(state, vm, it->sv);
+        if (new_vm == NULL) {
+          status = 1;
+          break;
+        }
+        new_vm->periodic_box->x = rso->periodic_box->x;
+        new_vm->periodic_box->y = rso->periodic_box->y;
+        new_vm->periodic_box->z = rso->periodic_box->z;
+
+        list_release_append(chains, n_chains - 1, it->sv->local_storage,
+                            (struct abstract_element *)new_vm);
+        (*n_released)++;
+      } else {
+        short orient;
+        if (rsm->orient > 0)
+          orient = 1;
+        else if (rsm->orient < 0)
+          orient = -1;
+        else {
+          orient = (rng_uint(state->rng) & 1) ? 1 : -1;
+        }
+
+        struct surface_molecule *sm = NULL;
+        struct subvolume *sv = NULL;
+        int grid_index = 0;
+        struct wall *w = NULL;
+        if (it->w != NULL)
+          w = claim_wall_tile(state, it->w, &it->uv, search_d2 - it->d2,
+                              it->sv, &grid_index, NULL, NULL);
+        if (w != NULL)
+          sm = place_surface_molecule_on_wall(state, rsm->mol_type, w,
+                                              &it->uv, grid_index, orient,
+                                              req->event_time, &sv,
+                                              rso->periodic_box);
+        if (sm == NULL) {
+          mcell_warn("Molecule release is unable to find surface upon which "
+                     "to place molecule %s.\n"
+                     "  This could be caused by too small of a SITE_DIAMETER "
+                     "on the release site '%s'.",
+                     rsm->mol_type->sym->name, rso->name);
+          (*n_failed)++;
+          continue;
+        }
+
+        if (sm->properties->flags & (COUNT_CONTENTS | COUNT_ENCLOSED))
+          count_region_from_scratch(state, (struct abstract_molecule *)sm,
+                                    NULL, 1, NULL, sm->grid->surface, sm->t,
+                                    NULL);
+
+        list_release_append(chains, n_chains - 1, sv->local_storage,
+                            (struct abstract_element *)sm);
+        (*n_released)++;
+      }
+    }
+  }
+
+  schedule_list_release(chains, n_chains);
+  free(chains);
+  free(items);
+  return status;
+}
+
 /*************************************************************************
 release_by_list:
     This function is used for LIST based release sites.
@@ -1539,6 +2445,16 @@ int release_by_list(struct volume *state, struct release_event_queue *req,
   struct release_site_obj *rso = req->release_site;
   struct release_single_molecule *rsm = rso->mol_list;
 
+  int n = 0;
+  for (struct release_single_molecule *r = rsm;
+       r != NULL && n < LIST_RELEASE_BULK_MIN; r = r->next)
+    n++;
+  if (n == LIST_RELEASE_BULK_MIN) {
+    if (release_by_list_bulk(state, req, vm, &i, &i_failed))
+      return 1;
+    rsm = NULL; /* all released */
+  }
+
   for (; rsm != NULL; rsm = rsm->next) {
     double location[1][4];
     location[0][0] = rsm->loc.x + rso->location->x;
@@ -2124,6 +3040,14 @@ void path_bounding_box(struct vector3 *loc, struct vector3 *displacement,
       possibly returned to its birthplace.
 ***************************************************************************/
 void collect_molecule(struct volume_molecule *vm) {
+  /* Leave the species array and the neighbor table (only molecules in a
+     list have valid slots) */
+  if (vm->prev_v != NULL) {
+    species_array_remove(vm);
+    if (vm->nbr_cell >= 0)
+      nbr_table_remove(vm);
+  }
+
   /* Unlink from the previous item */
   if (vm->prev_v != NULL) {
 #ifdef DEBUG_LIST_CHECKS
@@ -2193,6 +3117,9 @@ void ht_add_molecule_to_list(struct pointer_hash *h,
       //list->graph_data->graph_pattern = strdup(vm->graph_data->graph_pattern);
       //list->graph_pattern_hash = vm->graph_pattern_hash;
       list->head = NULL;
+      list->mols = NULL;
+      list->pos_x = list->pos_y = list->pos_z = NULL;
+      list->n_mols = list->max_mols = 0;
       if(vm->graph_data){
         if (pointer_hash_add(h, vm->graph_data->graph_pattern, vm->graph_data->graph_pattern_hash, list))
           mcell_allocfailed("Failed to add species to subvolume species table.");
@@ -2217,6 +3144,9 @@ void ht_add_molecule_to_list(struct pointer_hash *h,
           vm->subvol->local_storage->pslv, "per-species molecule list");
       list->properties = vm->properties;
       list->head = NULL;
+      list->mols = NULL;
+      list->pos_x = list->pos_y = list->pos_z = NULL;
+      list->n_mols = list->max_mols = 0;
       if (pointer_hash_add(h, vm->properties, vm->properties->hashval, list))
         mcell_allocfailed("Failed to add species to subvolume species table.");
 
@@ -2231,6 +3161,14 @@ void ht_add_molecule_to_list(struct pointer_hash *h,
     list->head->prev_v = &vm->next_v;
   vm->prev_v = &list->head;
   list->head = vm;
+
+  if (vm->subvol->use_species_arrays)
+    species_array_add(list, vm);
+  else {
+    vm->psl = NULL;
+    vm->psl_index = -1;
+  }
+  nbr_table_add(vm);
 }
 
 /***************************************************************************
@@ -69,6 +69,10 @@ insert_surface_molecule(struct volume *state, struct species *s,
                         struct string_buffer *regions_to_ignore,
                         struct periodic_image *periodic_box);
 
+struct volume_molecule *place_volume_molecule_near(struct volume *world,
+                                                   struct volume_molecule *vm,
+                                                   struct volume_molecule *guess);
+
 struct volume_molecule *insert_volume_molecule(struct volume *world,
                                                struct volume_molecule *vm,
                                                struct volume_molecule *guess);
@@ -80,6 +84,38 @@ int eval_rel_region_3d(struct release_evaluator *expr, struct waypoint *wp,
                        struct region_list *in_regions,
                        struct region_list *out_regions);
 
+/* Cache of the inside/outside state of a release region, kept on a grid
+ * over its bounding box.  Cells which no counting wall comes near are
+ * entirely inside or entirely outside, so one ray cast from the centre
+ * classifies the whole cell; only points in the boundary cells need their
+ * own ray cast. */
+#define RELEASE_VOXELS_MAX 32768 /* cells in the grid, at most */
+
+enum release_voxel_t {
+  RELEASE_VOXEL_OUTSIDE,
+  RELEASE_VOXEL_INSIDE,
+  RELEASE_VOXEL_BOUNDARY
+};
+
+struct release_voxel_cache {
+  unsigned int geometry_generation; /* of the walls it was built from */
+  struct vector3 llf, urb;          /* bounding box it was built for */
+  int n[3];                         /* cells along each axis */
+  struct vector3 cell_size;
+  byte *cells;                      /* enum release_voxel_t of each cell */
+  int n_candidates;                 /* cells which are not outside */
+  int *candidates;
+};
+
+int is_point_inside_region(struct volume *state, struct vector3 const *pos,
+                           struct release_evaluator *expression,
+                           struct subvolume *sv);
+
+struct release_voxel_cache *
+get_release_voxel_cache(struct volume *state, struct release_region_data *rrd);
+
+void destroy_release_voxel_cache(struct release_voxel_cache *cache);
+
 int release_molecules(struct volume *world, struct release_event_queue *req);
 
 int release_by_list(struct volume *state, struct release_event_queue *req,
@@ -122,6 +158,13 @@ void ht_remove(struct pointer_hash *h, struct per_species_list *psl);
 
 void collect_molecule(struct volume_molecule *vm);
 
+void update_species_array_pos(struct volume_molecule *vm);
+void free_species_arrays(struct per_species_list *psl);
+
+struct nbr_table *get_nbr_table(struct volume *world, struct subvolume *sv);
+void destroy_nbr_table(struct subvolume *sv);
+int nbr_cell_axis(double pos, double llf, double r_edge, int n);
+
 bool periodic_boxes_are_identical(const struct periodic_image *b1,
   const struct periodic_image *b2);
 
@@ -33,15 +33,57 @@
 
 #include <errno.h>
 #include <math.h>
+#include <pthread.h>
 #include <string.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Largest total size (in bytes) of the per-thread voxel histograms; above
+ * this, threads count into the shared histogram with atomic increments. */
+#define VOXEL_HISTOGRAM_BUDGET (256 * 1024 * 1024)
+
+/* How many finished volume outputs may wait for the writer thread */
+#define VOLUME_OUTPUT_MAX_PENDING 4
+
+/* Volume output waiting to be written by the background writer */
+struct volume_output_job {
+  struct volume_output_job *next;
+  char *filename;
+  struct volume_output_header header;
+  int *counts; /* nvoxels_z * nvoxels_y * nvoxels_x counts, x fastest */
+};
+
+/* Background writer for binary volume output */
+struct volume_output_writer {
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond; /* Signalled when a job is queued or finished */
+  struct volume_output_job *head;
+  struct volume_output_job *tail;
+  int n_pending; /* Jobs queued or being written */
+  int shutdown;  /* Set when the writer should exit once the queue is empty */
+  int n_errors;  /* Number of jobs which failed to write */
+};
 
 static int produce_item_header(FILE *out_file, struct volume_output_item *vo);
 
-static int produce_mol_counts(struct volume *wrld, FILE *out_file,
-                              struct volume_output_item *vo);
+static int *produce_mol_counts(struct volume *wrld,
+                               struct volume_output_item *vo);
+
+static int write_text_counts(FILE *out_file, struct volume_output_item *vo,
+                             int const *counts);
+
+static int write_binary_counts(char const *filename,
+                               struct volume_output_header const *hdr,
+                               int const *counts);
+
+static int queue_volume_output_job(struct volume *wrld,
+                                   struct volume_output_job *job);
 
 static int find_species_in_array(struct species **mols, int num_mols,
                                  struct species *ptr);
@@ -72,7 +114,10 @@ int update_volume_output(struct volume *wrld, struct volume_output_item *vo) {
   }
 
   /* build the filename */
-  filename = CHECKED_SPRINTF("%s.%lld.dat", vo->filename_prefix, wrld->current_iterations);
+  if (wrld->volume_output_format == VOLUME_OUTPUT_TEXT)
+    filename = CHECKED_SPRINTF("%s.%lld.dat", vo->filename_prefix, wrld->current_iterations);
+  else
+    filename = CHECKED_SPRINTF("%s.%lld.bin", vo->filename_prefix, wrld->current_iterations);
 
   /* Try to make the directory if it doesn't exist */
   if (make_parent_dir(filename)) {
@@ -95,186 +140,229 @@ int update_volume_output(struct volume *wrld, struct volume_output_item *vo) {
 }
 
 /*
- * Produce the output for a volume item.
+ * Produce the output for a volume item.  Text output is written right away;
+ * binary output is handed to the background writer.
  */
 int output_volume_output_item(struct volume *wrld, char const *filename,
                               struct volume_output_item *vo) {
+  int *counts = produce_mol_counts(wrld, vo);
+
+  if (wrld->volume_output_format != VOLUME_OUTPUT_TEXT) {
+    struct volume_output_job *job =
+        CHECKED_MALLOC_STRUCT(struct volume_output_job, "volume output job");
+    memset(job, 0, sizeof(struct volume_output_job));
+    memcpy(job->header.magic, VOLUME_OUTPUT_MAGIC, sizeof(job->header.magic));
+    job->header.version = VOLUME_OUTPUT_VERSION;
+    job->header.sparse = (wrld->volume_output_format == VOLUME_OUTPUT_SPARSE);
+    job->header.nvoxels_x = vo->nvoxels_x;
+    job->header.nvoxels_y = vo->nvoxels_y;
+    job->header.nvoxels_z = vo->nvoxels_z;
+    job->header.time = vo->t;
+    job->header.location = vo->location;
+    job->header.voxel_size = vo->voxel_size;
+    job->filename = CHECKED_STRDUP(filename, "volume output file name");
+    job->counts = counts;
+    return queue_volume_output_job(wrld, job);
+  }
+
   FILE *f = fopen(filename, "w");
   if (f == NULL) {
     mcell_perror_nodie(errno, "Couldn't open volume output file '%s'.",
                        filename);
+    free(counts);
     return 1;
   }
 
   if (produce_item_header(f, vo))
     goto failure;
 
-  if (produce_mol_counts(wrld, f, vo))
+  if (write_text_counts(f, vo, counts))
     goto failure;
 
+  free(counts);
   fclose(f);
   return 0;
 
 failure:
+  free(counts);
   fclose(f);
   return 1;
 }
 
 /*
- * Write the molecule counts to the file.
- *
- * XXX: Update this code to be smarter about the tradeoff between large slab
- * size (= large mem usage) and small slab size (= worse cache usage).
+ * Check whether a species is one of those counted by a volume item.
  */
-static int produce_mol_counts(struct volume *wrld, FILE *out_file,
-                              struct volume_output_item *vo) {
-  struct volume_molecule *curmol;
-  int *counters, *countersptr;
-  int k, u, v;
-  double z = vo->location.z, y = vo->location.y, x = vo->location.x;
-  double x_lim = x + vo->voxel_size.x * (double)vo->nvoxels_x;
-  double y_lim = y + vo->voxel_size.y * (double)vo->nvoxels_y;
-  struct subvolume *cur_partition_z;
-  double z_lim_part;
-
-  /* Allocate memory for counters. */
-  counters =
-      CHECKED_MALLOC_ARRAY(int, vo->nvoxels_x * vo->nvoxels_y, "voxel slab");
-
-  cur_partition_z = find_subvolume(wrld, &vo->location, NULL);
-  if (cur_partition_z == NULL) {
-    free(counters);
-    mcell_internal_error(
-        "While counting at [%g, %g, %g]: point isn't within a partition.", x, y,
-        z);
-    /*return 1;*/
+static int is_counted_species(struct volume_output_item *vo,
+                              struct species *spec) {
+  if (vo->num_molecules == 1)
+    return *vo->molecules == spec;
+  return find_species_in_array(vo->molecules, vo->num_molecules, spec) != -1;
+}
+
+/*
+ * Add one to the voxel of a molecule, if it lies inside the output domain.
+ */
+static inline void count_in_voxel(struct volume_output_item *vo,
+                                  struct vector3 const *pos,
+                                  struct vector3 const *lim,
+                                  struct vector3 const *r_voxsz, int *counts,
+                                  int atomic) {
+  /* Skip molecules outside our domain */
+  if (pos->x < vo->location.x || pos->x >= lim->x ||
+      pos->y < vo->location.y || pos->y >= lim->y ||
+      pos->z < vo->location.z || pos->z >= lim->z)
+    return;
+
+  int u = (int)floor((pos->x - vo->location.x) * r_voxsz->x);
+  int v = (int)floor((pos->y - vo->location.y) * r_voxsz->y);
+  int k = (int)floor((pos->z - vo->location.z) * r_voxsz->z);
+  if (u >= vo->nvoxels_x)
+    u = vo->nvoxels_x - 1;
+  if (v >= vo->nvoxels_y)
+    v = vo->nvoxels_y - 1;
+  if (k >= vo->nvoxels_z)
+    k = vo->nvoxels_z - 1;
+
+  /* We've got a winner!  Add one to the appropriate voxel. */
+  long idx = ((long)k * vo->nvoxels_y + v) * vo->nvoxels_x + u;
+  if (atomic) {
+#pragma omp atomic
+    ++counts[idx];
+  } else {
+    ++counts[idx];
   }
+}
 
-  z_lim_part = wrld->z_fineparts[cur_partition_z->urb.z];
-
-  /* For each slab: */
-  double r_voxsz_x = 1.0 / vo->voxel_size.x;
-  double r_voxsz_y = 1.0 / vo->voxel_size.y;
-  for (k = 0; k < vo->nvoxels_z; ++k) {
-    double z_lim_slab = z + vo->voxel_size.z;
-    struct subvolume *cur_partition_y;
-
-    /* reset counters for this slab */
-    memset(counters, 0, sizeof(int) * vo->nvoxels_x * vo->nvoxels_y);
-
-  /* Loop over relevant partitions */
-  keep_counting:
-    cur_partition_y = cur_partition_z;
-    while (cur_partition_y != NULL &&
-           wrld->y_fineparts[cur_partition_y->llf.y] < y_lim) {
-      struct subvolume *cur_partition = cur_partition_y;
-      while (cur_partition != NULL &&
-             wrld->x_fineparts[cur_partition->llf.x] < x_lim) {
-        /* Count molecules */
-        struct per_species_list *psl;
-        int check_nonreacting = 0;
-        int i = 0;
-        for (i = 0; i < vo->num_molecules; ++i) {
-          if (!(vo->molecules[i]->flags & CAN_VOLVOL)) {
-            check_nonreacting = 1;
-            break;
-          }
-        }
-        for (psl = cur_partition->species_head; psl != NULL; psl = psl->next) {
-          if (psl->properties == NULL) {
-            if (!check_nonreacting)
-              continue;
-            else {
-              for (curmol = psl->head; curmol != NULL;
-                   curmol = curmol->next_v) {
-                /* See if we're interested in this molecule */
-                if (vo->num_molecules == 1) {
-                  if (*vo->molecules != curmol->properties)
-                    continue;
-                } else {
-                  if ((find_species_in_array(vo->molecules, vo->num_molecules,
-                                             curmol->properties)) == -1)
-                    continue;
-                }
-
-                /* Skip molecules not in our slab */
-                if (curmol->pos.z < z || curmol->pos.z >= z_lim_slab)
-                  continue;
-
-                /* Skip molecules outside our domain */
-                if (curmol->pos.x < x || curmol->pos.x >= x_lim ||
-                    curmol->pos.y < y || curmol->pos.y >= y_lim)
-                  continue;
-
-                /* We've got a winner!  Add one to the appropriate voxel. */
-                ++counters[((int)floor((curmol->pos.y - y) * r_voxsz_y)) *
-                               vo->nvoxels_x +
-                           (int)floor((curmol->pos.x - x) * r_voxsz_x)];
-              }
-            }
-          } else {
-            /* See if we're interested in this molecule */
-            if (vo->num_molecules == 1) {
-              if (*vo->molecules != psl->properties)
-                continue;
-            } else {
-              if ((find_species_in_array(vo->molecules, vo->num_molecules,
-                                         psl->properties)) == -1)
-                continue;
-            }
-
-            for (curmol = psl->head; curmol != NULL; curmol = curmol->next_v) {
-              /* Skip molecules not in our slab */
-              if (curmol->pos.z < z || curmol->pos.z >= z_lim_slab)
-                continue;
-
-              /* Skip molecules outside our domain */
-              if (curmol->pos.x < x || curmol->pos.x >= x_lim ||
-                  curmol->pos.y < y || curmol->pos.y >= y_lim)
-                continue;
-
-              /* We've got a winner!  Add one to the appropriate voxel. */
-              ++counters[((int)floor((curmol->pos.y - y) * r_voxsz_y)) *
-                             vo->nvoxels_x +
-                         (int)floor((curmol->pos.x - x) * r_voxsz_x)];
-            }
-          }
-        }
-
-        /* Advance to next x-partition */
-        cur_partition =
-            traverse_subvol(cur_partition, X_POS, wrld->ny_parts,
-                            wrld->nz_parts);
+/*
+ * Count the molecules of one subvolume into a voxel histogram.
+ */
+static void count_subvolume_molecules(struct subvolume *sv,
+                                      struct volume_output_item *vo,
+                                      int check_nonreacting,
+                                      struct vector3 const *lim,
+                                      struct vector3 const *r_voxsz,
+                                      int *counts, int atomic) {
+  for (struct per_species_list *psl = sv->species_head; psl != NULL;
+       psl = psl->next) {
+    if (psl->properties == NULL) {
+      if (!check_nonreacting)
+        continue;
+      for (struct volume_molecule *curmol = psl->head; curmol != NULL;
+           curmol = curmol->next_v) {
+        /* See if we're interested in this molecule */
+        if (!is_counted_species(vo, curmol->properties))
+          continue;
+        count_in_voxel(vo, &curmol->pos, lim, r_voxsz, counts, atomic);
       }
+    } else {
+      /* See if we're interested in this molecule */
+      if (!is_counted_species(vo, psl->properties))
+        continue;
+      for (struct volume_molecule *curmol = psl->head; curmol != NULL;
+           curmol = curmol->next_v)
+        count_in_voxel(vo, &curmol->pos, lim, r_voxsz, counts, atomic);
+    }
+  }
+}
 
-      /* Advance to next y-partition */
-      cur_partition_y =
-          traverse_subvol(cur_partition_y, Y_POS, wrld->ny_parts,
-                          wrld->nz_parts);
+/*
+ * Count the molecules in every voxel of a volume item.
+ *
+ * Subvolumes overlapping the output domain are binned in parallel.  Each
+ * thread counts into its own histogram, and the histograms are summed
+ * afterwards; if that would take too much memory, threads share one
+ * histogram and count with atomic increments instead.
+ *
+ * Returns the counts, nvoxels_z * nvoxels_y * nvoxels_x of them with x
+ * varying fastest; the caller frees them.
+ */
+static int *produce_mol_counts(struct volume *wrld,
+                               struct volume_output_item *vo) {
+  long n_vox = (long)vo->nvoxels_x * vo->nvoxels_y * vo->nvoxels_z;
+  struct vector3 lim = {
+    vo->location.x + vo->voxel_size.x * (double)vo->nvoxels_x,
+    vo->location.y + vo->voxel_size.y * (double)vo->nvoxels_y,
+    vo->location.z + vo->voxel_size.z * (double)vo->nvoxels_z
+  };
+  struct vector3 r_voxsz = { 1.0 / vo->voxel_size.x, 1.0 / vo->voxel_size.y,
+                             1.0 / vo->voxel_size.z };
+
+  if (find_subvolume(wrld, &vo->location, NULL) == NULL)
+    mcell_internal_error(
+        "While counting at [%g, %g, %g]: point isn't within a partition.",
+        vo->location.x, vo->location.y, vo->location.z);
+
+  int check_nonreacting = 0;
+  for (int i = 0; i < vo->num_molecules; ++i) {
+    if (!(vo->molecules[i]->flags & CAN_VOLVOL)) {
+      check_nonreacting = 1;
+      break;
     }
+  }
 
-    /* If the slab crosses a Z boundary, keep on truckin' */
-    if (z_lim_slab >= z_lim_part) {
-      /* If we can get to the next partition, don't update slab and don't
-       * spill!
-       */
-      cur_partition_z =
-          traverse_subvol(cur_partition_z, Z_POS, wrld->ny_parts,
-                          wrld->nz_parts);
-
-      if (cur_partition_z != NULL) {
-        z_lim_part = wrld->z_fineparts[cur_partition_z->urb.z];
-        goto keep_counting;
-      }
-    } else {
-      z = z_lim_slab;
-      /* z_lim_slab will be updated on the next pass through the loop. */
+  int *counts = CHECKED_MALLOC_ARRAY(int, n_vox, "voxel counts");
+  memset(counts, 0, sizeof(int) * n_vox);
+
+  /* Thread 0 counts straight into the result, others into their own copy */
+  int n_threads = 1;
+#ifdef _OPENMP
+  n_threads = omp_get_max_threads();
+#endif
+  int *local = NULL;
+  if (n_threads > 1 &&
+      (double)n_vox * (n_threads - 1) * sizeof(int) <= VOXEL_HISTOGRAM_BUDGET)
+    local = (int *)calloc((size_t)n_vox * (n_threads - 1), sizeof(int));
+  int atomic = (n_threads > 1 && local == NULL);
+
+  int i;
+#pragma omp parallel for schedule(dynamic, 16)
+  for (i = 0; i < wrld->n_subvols; i++) {
+    struct subvolume *sv = &wrld->subvol[i];
+    if (sv->species_head == NULL ||
+        wrld->x_fineparts[sv->urb.x] < vo->location.x ||
+        wrld->x_fineparts[sv->llf.x] >= lim.x ||
+        wrld->y_fineparts[sv->urb.y] < vo->location.y ||
+        wrld->y_fineparts[sv->llf.y] >= lim.y ||
+        wrld->z_fineparts[sv->urb.z] < vo->location.z ||
+        wrld->z_fineparts[sv->llf.z] >= lim.z)
+      continue;
+
+    int *hist = counts;
+#ifdef _OPENMP
+    int tid = omp_get_thread_num();
+    if (local != NULL && tid > 0)
+      hist = local + (long)(tid - 1) * n_vox;
+#endif
+    count_subvolume_molecules(sv, vo, check_nonreacting, &lim, &r_voxsz, hist,
+                              atomic);
+  }
+
+  /* Sum the per-thread histograms */
+  if (local != NULL) {
+    long idx;
+#pragma omp parallel for schedule(static)
+    for (idx = 0; idx < n_vox; idx++) {
+      int sum = counts[idx];
+      for (int t = 0; t < n_threads - 1; t++)
+        sum += local[(long)t * n_vox + idx];
+      counts[idx] = sum;
     }
+    free(local);
+  }
 
+  return counts;
+}
+
+/*
+ * Write the molecule counts to a text file, one slab at a time.
+ */
+static int write_text_counts(FILE *out_file, struct volume_output_item *vo,
+                             int const *counts) {
+  int const *countersptr = counts;
+  for (int k = 0; k < vo->nvoxels_z; ++k) {
     /* Spill our counts */
-    countersptr = counters;
-    for (u = 0; u < vo->nvoxels_y; ++u) {
-      for (v = 0; v < vo->nvoxels_x; ++v)
+    for (int u = 0; u < vo->nvoxels_y; ++u) {
+      for (int v = 0; v < vo->nvoxels_x; ++v)
         fprintf(out_file, "%d ", *countersptr++);
       fprintf(out_file, "\n");
     }
@@ -283,10 +371,179 @@ static int produce_mol_counts(struct volume *wrld, FILE *out_file,
     fprintf(out_file, "\n");
   }
 
-  free(counters);
+  if (ferror(out_file)) {
+    mcell_perror_nodie(errno, "Couldn't write volume output file.");
+    return 1;
+  }
   return 0;
 }
 
+/*
+ * Write the molecule counts to a binary file, either as the full array of
+ * counts or, for sparse output, as the indices and counts of the non-empty
+ * voxels.
+ */
+static int write_binary_counts(char const *filename,
+                               struct volume_output_header const *hdr,
+                               int const *counts) {
+  uint64_t n_vox =
+      (uint64_t)hdr->nvoxels_x * hdr->nvoxels_y * (uint64_t)hdr->nvoxels_z;
+  FILE *f = fopen(filename, "wb");
+  if (f == NULL) {
+    mcell_perror_nodie(errno, "Couldn't open volume output file '%s'.",
+                       filename);
+    return 1;
+  }
+
+  int failure = (fwrite(hdr, sizeof(struct volume_output_header), 1, f) != 1);
+  if (!failure && !hdr->sparse) {
+    failure = (fwrite(counts, sizeof(int), n_vox, f) != n_vox);
+  } else if (!failure) {
+    /* Gather the non-empty voxels so that each section is a single write */
+    uint64_t n_nonzero = 0;
+    for (uint64_t idx = 0; idx < n_vox; idx++)
+      if (counts[idx] != 0)
+        ++n_nonzero;
+    uint64_t *indices = CHECKED_MALLOC_ARRAY_NODIE(
+        uint64_t, n_nonzero + 1, "sparse volume output indices");
+    int *values = CHECKED_MALLOC_ARRAY_NODIE(int, n_nonzero + 1,
+                                             "sparse volume output counts");
+    if (indices == NULL || values == NULL) {
+      free(indices);
+      free(values);
+      fclose(f);
+      return 1;
+    }
+    uint64_t k = 0;
+    for (uint64_t idx = 0; idx < n_vox; idx++) {
+      if (counts[idx] != 0) {
+        indices[k] = idx;
+        values[k] = counts[idx];
+        ++k;
+      }
+    }
+
+    failure = (fwrite(&n_nonzero, sizeof(n_nonzero), 1, f) != 1);
+    if (!failure)
+      failure = (fwrite(indices, sizeof(uint64_t), n_nonzero, f) != n_nonzero);
+    if (!failure)
+      failure = (fwrite(values, sizeof(int), n_nonzero, f) != n_nonzero);
+    free(indices);
+    free(values);
+  }
+
+  if (fclose(f) != 0)
+    failure = 1;
+  if (failure)
+    mcell_perror_nodie(errno, "Couldn't write volume output file '%s'.",
+                       filename);
+  return failure;
+}
+
+/*
+ * Main loop of the background writer: write queued jobs in order until
+ * asked to shut down.
+ */
+static void *volume_output_writer_main(void *arg) {
+  struct volume_output_writer *writer = (struct volume_output_writer *)arg;
+
+  pthread_mutex_lock(&writer->lock);
+  while (1) {
+    while (writer->head == NULL && !writer->shutdown)
+      pthread_cond_wait(&writer->cond, &writer->lock);
+    if (writer->head == NULL)
+      break;
+
+    struct volume_output_job *job = writer->head;
+    writer->head = job->next;
+    if (writer->head == NULL)
+      writer->tail = NULL;
+    pthread_mutex_unlock(&writer->lock);
+
+    int failure = write_binary_counts(job->filename, &job->header, job->counts);
+    free(job->counts);
+    free(job->filename);
+    free(job);
+
+    pthread_mutex_lock(&writer->lock);
+    if (failure)
+      ++writer->n_errors;
+    --writer->n_pending;
+    pthread_cond_broadcast(&writer->cond);
+  }
+  pthread_mutex_unlock(&writer->lock);
+
+  return NULL;
+}
+
+/*
+ * Hand a finished volume output to the background writer, starting it if
+ * necessary.  Blocks while too many outputs are waiting to be written.
+ */
+static int queue_volume_output_job(struct volume *wrld,
+                                   struct volume_output_job *job) {
+  struct volume_output_writer *writer = wrld->volume_output_writer;
+  if (writer == NULL) {
+    writer = CHECKED_MALLOC_STRUCT(struct volume_output_writer,
+                                   "volume output writer");
+    memset(writer, 0, sizeof(struct volume_output_writer));
+    pthread_mutex_init(&writer->lock, NULL);
+    pthread_cond_init(&writer->cond, NULL);
+    if (pthread_create(&writer->thread, NULL, volume_output_writer_main,
+                       writer) != 0) {
+      /* No thread to be had; write it ourselves */
+      pthread_cond_destroy(&writer->cond);
+      pthread_mutex_destroy(&writer->lock);
+      free(writer);
+      int failure = write_binary_counts(job->filename, &job->header,
+                                        job->counts);
+      free(job->counts);
+      free(job->filename);
+      free(job);
+      return failure;
+    }
+    wrld->volume_output_writer = writer;
+  }
+
+  pthread_mutex_lock(&writer->lock);
+  while (writer->n_pending >= VOLUME_OUTPUT_MAX_PENDING)
+    pthread_cond_wait(&writer->cond, &writer->lock);
+  job->next = NULL;
+  if (writer->tail != NULL)
+    writer->tail->next = job;
+  else
+    writer->head = job;
+  writer->tail = job;
+  ++writer->n_pending;
+  pthread_cond_broadcast(&writer->cond);
+  pthread_mutex_unlock(&writer->lock);
+
+  return 0;
+}
+
+/*
+ * Wait until all queued volume output has been written and stop the
+ * background writer.  Returns the number of outputs which failed to write.
+ */
+int flush_volume_output(struct volume *wrld) {
+  struct volume_output_writer *writer = wrld->volume_output_writer;
+  if (writer == NULL)
+    return 0;
+
+  pthread_mutex_lock(&writer->lock);
+  writer->shutdown = 1;
+  pthread_cond_broadcast(&writer->cond);
+  pthread_mutex_unlock(&writer->lock);
+  pthread_join(writer->thread, NULL);
+
+  int n_errors = writer->n_errors;
+  pthread_cond_destroy(&writer->cond);
+  pthread_mutex_destroy(&writer->lock);
+  free(writer);
+  wrld->volume_output_writer = NULL;
+  return n_errors;
+}
+
 /*
  * Binary search for a pointer in an array of pointers.
  */
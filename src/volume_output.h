@@ -23,8 +23,35 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #include "mcell_structs.h"
 
+/* Binary volume output (".bin" files)
+ *
+ * Each file starts with a struct volume_output_header.  Dense files then
+ * hold nvoxels_z * nvoxels_y * nvoxels_x int counts, x varying fastest (the
+ * order of the text format).  Sparse files hold a uint64_t count n of the
+ * non-empty voxels, then n uint64_t voxel indices in increasing order, then
+ * the n int counts.  All values are in native byte order.
+ */
+#define VOLUME_OUTPUT_MAGIC "MCELLVOX"
+#define VOLUME_OUTPUT_VERSION 1
+
+struct volume_output_header {
+  char magic[8];           /* VOLUME_OUTPUT_MAGIC */
+  uint32_t version;        /* VOLUME_OUTPUT_VERSION */
+  uint32_t sparse;         /* 1 if only non-empty voxels are stored */
+  int32_t nvoxels_x;
+  int32_t nvoxels_y;
+  int32_t nvoxels_z;
+  int32_t reserved;
+  double time;             /* Scheduled time of the output, as in text files */
+  struct vector3 location; /* Lower corner of the voxel grid */
+  struct vector3 voxel_size;
+};
+
 int update_volume_output(struct volume *wrld, struct volume_output_item *vo);
 int output_volume_output_item(struct volume *wrld, char const *filename,
                               struct volume_output_item *vo);
+int flush_volume_output(struct volume *wrld);
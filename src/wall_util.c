@@ -64,10 +64,6 @@ static inline double abs_max_2vec(struct vector3 *v1, struct vector3 *v2) {
                max3d(fabs(v2->x), fabs(v2->y), fabs(v2->z)));
 }
 
-// create_new_poly_edge creates a new poly_edge and attaches it to the
-// past pointer to linked list of poly_edges
-static struct poly_edge* create_new_poly_edge(struct poly_edge* list);
-
 // have_common_region checks if wall1 and wall2 located on the (same) object
 // are part of a common region or not
 static bool have_common_region(struct object *obj, int wall1, int wall2);
@@ -77,195 +73,190 @@ static bool have_common_region(struct object *obj, int wall1, int wall2);
  ** Edge hash table section--finds common edges in polygons              **
 \**************************************************************************/
 
-/***************************************************************************
-edge_equals:
-  In: pointers to two poly_edge structs
-  Out: Returns 1 if the edges are the same, 0 otherwise.
-  Note: Orientation invariant, so an edge between vertex 1 and 2
-        is the same as an edge between vertex 2 and 1.
-***************************************************************************/
+/* Marks an unused slot in the vertex and edge tables */
+#define EDGE_SLOT_EMPTY UINT64_MAX
 
-int edge_equals(struct poly_edge *e1, struct poly_edge *e2) {
-  if ((!distinguishable(e1->v1x, e2->v1x, EPS_C)) &&
-      (!distinguishable(e1->v1y, e2->v1y, EPS_C)) &&
-      (!distinguishable(e1->v1z, e2->v1z, EPS_C)) &&
-      (!distinguishable(e1->v2x, e2->v2x, EPS_C)) &&
-      (!distinguishable(e1->v2y, e2->v2y, EPS_C)) &&
-      (!distinguishable(e1->v2z, e2->v2z, EPS_C))) {
-    return 1;
-  }
-  if ((!distinguishable(e1->v1x, e2->v2x, EPS_C)) &&
-      (!distinguishable(e1->v1y, e2->v2y, EPS_C)) &&
-      (!distinguishable(e1->v1z, e2->v2z, EPS_C)) &&
-      (!distinguishable(e1->v2x, e2->v1x, EPS_C)) &&
-      (!distinguishable(e1->v2y, e2->v1y, EPS_C)) &&
-      (!distinguishable(e1->v2z, e2->v1z, EPS_C))) {
-    return 1;
-  }
-  return 0;
-}
+/* Objects with at least this many faces have their edges matched by sorting
+   instead of through the edge table. */
+#define EDGE_SORT_MIN_FACES (1 << 20)
 
-/***************************************************************************
-edge_hash:
-  In: pe: pointer to a poly_edge struct
-      nkeys: number of keys in the hash table
-  Out: Returns a hash value between 0 and nkeys-1.
-  Note: Orientation invariant, so a hash with the two endpoints swapped
-        will be the same.
-***************************************************************************/
+/* Face count from which surface_net matches edges by sorting.  Lowered by
+   the startup benchmark to time both paths on the same object. */
+int edge_sort_min_faces = EDGE_SORT_MIN_FACES;
 
-int edge_hash(struct poly_edge *pe, int nkeys) {
-  /* Get hash of X,Y,Z set of doubles for 1st and 2nd points */
-  /* (Assume they're laid out consecutively in memory) */
-  /* FIXME: This seems like a hack. Since poly_edge is a struct there's no
-   * guarantee what the memory layout will be and the compiler may pad */
-  unsigned int hashL = jenkins_hash((ub1 *)&(pe->v1x), 3 * sizeof(double));
-  unsigned int hashR = jenkins_hash((ub1 *)&(pe->v2x), 3 * sizeof(double));
+/* Slot of the open-addressed table of distinct vertices */
+struct vertex_slot {
+  struct vector3 *v; /* First vertex seen with these coordinates */
+  int id;            /* Canonical id of the vertex, -1 if the slot is free */
+};
 
-  return (hashL + hashR) %
-         nkeys; /* ^ is symmetric so doesn't matter which is L and which is R */
-}
+/* Slot of the open-addressed table of distinct edges */
+struct edge_slot {
+  uint64_t key; /* Pair of canonical vertex ids, EDGE_SLOT_EMPTY if free */
+  int first;    /* First incidence (3 * face + edge) of this edge */
+  int last;     /* Last incidence of this edge */
+  int count;    /* Number of incidences */
+};
+
+/* Incidence of an edge, used for matching edges by sorting */
+struct edge_record {
+  uint64_t key; /* Pair of canonical vertex ids */
+  int inc;      /* Incidence (3 * face + edge) */
+};
 
 /***************************************************************************
-ehtable_init:
-  In: eht: pointer to an edge_hashtable struct
-      nkeys: number of keys that the hash table uses
-  Out: Returns 0 on success, 1 on failure.
-       Hash table is initialized.
+table_size_for:
+  In: n: number of items to be stored
+  Out: A power of two at least twice as large as n.
 ***************************************************************************/
-
-int ehtable_init(struct edge_hashtable *eht, int nkeys) {
-  eht->nkeys = nkeys;
-  eht->stored = 0;
-  eht->distinct = 0;
-  eht->data =
-      CHECKED_MALLOC_ARRAY_NODIE(struct poly_edge, nkeys, "edge hash table");
-  if (eht->data == NULL)
-    return 1;
-
-  for (int i = 0; i < nkeys; i++) {
-    eht->data[i].next = NULL;
-    eht->data[i].n = 0;
-    eht->data[i].face[0] = eht->data[i].face[1] = -1;
-  }
-
-  return 0;
+static unsigned long table_size_for(unsigned long n) {
+  unsigned long size = 16;
+  while (size < 2 * n)
+    size <<= 1;
+  return size;
 }
 
-
 /***************************************************************************
- *
- * create_new_poly_edge creates a new poly_edge and attaches it to the
- * past pointer to linked list of poly_edges
- *
- ***************************************************************************/
-struct poly_edge* create_new_poly_edge(struct poly_edge* list) {
-
-  struct poly_edge *pei = CHECKED_MALLOC_STRUCT_NODIE(struct poly_edge, "polygon edge");
-  if (pei == NULL) {
-    return NULL;
-  }
-
-  pei->next = list->next;
-  list->next = pei;
-  pei->n = 0;
-  pei->face[0] = -1;
-  pei->face[1] = -1;
-  pei->edge[0] = -1;
-  pei->edge[1] = -1;
-  return pei;
+mix_hash64:
+  In: k: 64-bit value
+  Out: Well-mixed 64-bit hash of k (finalizer of MurmurHash3).
+***************************************************************************/
+static inline uint64_t mix_hash64(uint64_t k) {
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdULL;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ULL;
+  k ^= k >> 33;
+  return k;
 }
 
 /***************************************************************************
-ehtable_add:
-  In: pointer to an edge_hashtable struct
-      pointer to the poly_edge to add
-  Out: Returns 0 on success, 1 on failure.
-       Edge is added to the hash table.
+vertex_hash:
+  In: v: pointer to a vertex
+  Out: Hash of the coordinates of the vertex.  Vertices that compare equal
+       coordinate by coordinate get the same hash (0.0 and -0.0 included).
 ***************************************************************************/
-int ehtable_add(struct edge_hashtable *eht, struct poly_edge *pe) {
-
-  int i = edge_hash(pe, eht->nkeys);
-  struct poly_edge *pep = &(eht->data[i]);
-
-  while (pep != NULL) {
-    if (pep->n == 0) /* New entry */
-    {
-      pep->n = 1;
-      pep->face[0] = pe->face[0];
-      pep->edge[0] = pe->edge[0];
-      pep->v1x = pe->v1x;
-      pep->v1y = pe->v1y;
-      pep->v1z = pe->v1z;
-      pep->v2x = pe->v2x;
-      pep->v2y = pe->v2y;
-      pep->v2z = pe->v2z;
-      eht->stored++;
-      eht->distinct++;
-      return 0;
-    }
+static uint64_t vertex_hash(struct vector3 *v) {
+  double c[3] = { v->x + 0.0, v->y + 0.0, v->z + 0.0 };
+  uint64_t bits[3];
+  memcpy(bits, c, sizeof(bits));
+  return mix_hash64(bits[0] ^ mix_hash64(bits[1] ^ mix_hash64(bits[2])));
+}
 
-    if (edge_equals(pep, pe)) /* This edge exists already ... */
-    {
-      if (pep->face[1] == -1) /* ...and we're the 2nd one */
-      {
-        pep->face[1] = pe->face[0];
-        pep->edge[1] = pe->edge[0];
-        pep->n++;
-        eht->stored++;
-        return 0;
-      } else /* ...or we're 3rd and need more space */
-      {
-        if (pep->next != NULL) {
-          if (edge_equals(pep->next, pe)) /* Space already there */
-          {
-            pep->n++;
-            pep = pep->next;
-            continue; /* Use space on next loop */
-          }
-        }
+/***************************************************************************
+assign_vertex_ids:
+  In: facelist: array of pointers to walls
+      nfaces: length of array
+      vert_id: array of 3 * nfaces ints to fill in
+  Out: Returns 0 on success, 1 on malloc failure.  Every vertex of every
+       wall gets an id; vertices with identical coordinates share the id.
+***************************************************************************/
+static int assign_vertex_ids(struct wall **facelist, int nfaces, int *vert_id) {
+  unsigned long size = table_size_for(3 * (unsigned long)nfaces);
+  unsigned long mask = size - 1;
+  struct vertex_slot *table = CHECKED_MALLOC_ARRAY_NODIE(
+      struct vertex_slot, size, "vertex table");
+  if (table == NULL)
+    return 1;
+  for (unsigned long s = 0; s < size; s++) {
+    table[s].v = NULL;
+    table[s].id = -1;
+  }
 
-        struct poly_edge *pei = create_new_poly_edge(pep);
-        if (pei == NULL) {
-          return 1;
-        }
-        pep->n++;
-        pep = pei;
-        eht->distinct--; /* Not really distinct, just need more space */
+  int n_ids = 0;
+  for (int i = 0; i < nfaces; i++) {
+    if (facelist[i] == NULL)
+      continue;
+    for (int j = 0; j < 3; j++) {
+      struct vector3 *v = facelist[i]->vert[j];
+      unsigned long s = vertex_hash(v) & mask;
+      while (table[s].id != -1) {
+        struct vector3 *u = table[s].v;
+        if (u == v || (u->x == v->x && u->y == v->y && u->z == v->z))
+          break;
+        s = (s + 1) & mask;
       }
-    } else if (pep->next != NULL) {
-      pep = pep->next;
-    } else { /* Hit end of list, so make space for use next loop. */
-      struct poly_edge *pei = create_new_poly_edge(pep);
-      if (pei == NULL) {
-        return 1;
+      if (table[s].id == -1) {
+        table[s].v = v;
+        table[s].id = n_ids++;
       }
-      pep = pei;
+      vert_id[3 * i + j] = table[s].id;
     }
   }
 
+  free(table);
   return 0;
 }
 
 /***************************************************************************
-ehtable_kill:
-  In: eht: pointer to an edge_hashtable struct
-  Out: No return value.  Hashtable data is deallocated.
-  Note: eht itself is not freed, since it isn't created with ehtable_init.
+edge_key:
+  In: vert_id: canonical vertex ids of all walls
+      inc: incidence (3 * face + edge)
+  Out: Orientation invariant key of the edge, so an edge between vertex 1
+       and 2 is the same as an edge between vertex 2 and 1.
 ***************************************************************************/
-void ehtable_kill(struct edge_hashtable *eht) {
-  struct poly_edge *pe;
+static inline uint64_t edge_key(int *vert_id, int inc) {
+  int face = inc / 3;
+  int j = inc % 3;
+  uint64_t a = (uint64_t)vert_id[3 * face + j];
+  uint64_t b = (uint64_t)vert_id[3 * face + (j + 1) % 3];
+  return (a < b) ? ((a << 32) | b) : ((b << 32) | a);
+}
 
-  for (int i = 0; i < eht->nkeys; i++) {
-    while (eht->data[i].next != NULL) {
-      pe = eht->data[i].next;
-      eht->data[i].next = pe->next;
-      free(pe);
+/***************************************************************************
+compare_edge_records:
+  In: two edge_records
+  Out: Orders records by edge key, then by incidence.
+***************************************************************************/
+static int compare_edge_records(const void *a, const void *b) {
+  const struct edge_record *ra = (const struct edge_record *)a;
+  const struct edge_record *rb = (const struct edge_record *)b;
+  if (ra->key != rb->key)
+    return (ra->key < rb->key) ? -1 : 1;
+  return (ra->inc > rb->inc) - (ra->inc < rb->inc);
+}
+
+/***************************************************************************
+sort_edge_records:
+  In: rec: array of edge records
+      tmp: scratch array of the same length
+      n: number of records
+  Out: No return value.  Records are sorted by compare_edge_records.  Runs
+       are sorted in parallel and then merged pairwise in parallel.
+***************************************************************************/
+static void sort_edge_records(struct edge_record *rec, struct edge_record *tmp,
+                              long n) {
+  long run = 1L << 14;
+  long start;
+
+#pragma omp parallel for schedule(dynamic, 1)
+  for (start = 0; start < n; start += run) {
+    long len = (n - start < run) ? n - start : run;
+    qsort(rec + start, len, sizeof(struct edge_record), compare_edge_records);
+  }
+
+  struct edge_record *src = rec, *dst = tmp;
+  for (; run < n; run *= 2) {
+#pragma omp parallel for schedule(dynamic, 1)
+    for (start = 0; start < n; start += 2 * run) {
+      long mid = (start + run < n) ? start + run : n;
+      long end = (start + 2 * run < n) ? start + 2 * run : n;
+      long a = start, b = mid, k = start;
+      while (a < mid && b < end)
+        dst[k++] = (compare_edge_records(&src[b], &src[a]) < 0) ? src[b++]
+                                                                  : src[a++];
+      while (a < mid)
+        dst[k++] = src[a++];
+      while (b < end)
+        dst[k++] = src[b++];
     }
+    struct edge_record *t = src;
+    src = dst;
+    dst = t;
   }
-  free(eht->data);
-  eht->data = NULL;
-  eht->nkeys = 0;
+
+  if (src != rec)
+    memcpy(rec, src, n * sizeof(struct edge_record));
 }
 
 /**************************************************************************\
@@ -453,6 +444,242 @@ static void refine_edge_pairs(struct poly_edge *p, struct wall **faces) {
 #undef TSWAP
 }
 
+/***************************************************************************
+connect_shared_edge:
+  In: the head of a linked list holding all incidences of one edge
+      array of pointers to walls
+      flag to clear if the edge is not shared by two walls
+  Out: 0 on success, 1 on malloc failure.  The walls are connected along
+       the best-matching pairs of incidences.
+***************************************************************************/
+static int connect_shared_edge(struct poly_edge *pep, struct wall **facelist,
+                               int *is_closed) {
+  struct edge *e;
+
+  while (pep != NULL) {
+    if (pep->n > 2) {
+      refine_edge_pairs(pep, facelist);
+    }
+    if (pep->n >= 2) {
+      if (pep->face[0] != -1 && pep->face[1] != -1) {
+        if (compatible_edges(facelist, pep->face[0], pep->edge[0], pep->face[1],
+                             pep->edge[1])) {
+          facelist[pep->face[0]]->nb_walls[pep->edge[0]] = facelist[pep->face[1]];
+          facelist[pep->face[1]]->nb_walls[pep->edge[1]] = facelist[pep->face[0]];
+          e = (struct edge *)CHECKED_MEM_GET_NODIE(
+              facelist[pep->face[0]]->birthplace->join, "edge");
+          if (e == NULL)
+            return 1;
+
+          e->forward = facelist[pep->face[0]];
+          e->backward = facelist[pep->face[1]];
+          init_edge_transform(e, pep->edge[0]);
+          facelist[pep->face[0]]->edges[pep->edge[0]] = e;
+          facelist[pep->face[1]]->edges[pep->edge[1]] = e;
+        }
+
+      } else {
+        *is_closed = 0;
+      }
+    } else if (pep->n == 1) {
+      *is_closed = 0;
+      e = (struct edge *)CHECKED_MEM_GET_NODIE(
+          facelist[pep->face[0]]->birthplace->join, "edge");
+      if (e == NULL)
+        return 1;
+
+      e->forward = facelist[pep->face[0]];
+      e->backward = NULL;
+      /* Don't call init_edge_transform unless both edges are set */
+      facelist[pep->face[0]]->edges[pep->edge[0]] = e;
+    }
+    pep = pep->next;
+  }
+
+  return 0;
+}
+
+/***************************************************************************
+build_edge_chain:
+  In: incidences of one edge, in the order the walls list them
+      number of incidences
+      array of at least (count + 1) / 2 poly_edges to use
+  Out: Head of the list of poly_edges.  Incidences are paired up in order,
+       and each node counts the incidences from itself to the end of the
+       list, as refine_edge_pairs expects.
+***************************************************************************/
+static struct poly_edge *build_edge_chain(int *inc, int count,
+                                          struct poly_edge *nodes) {
+  int n_nodes = (count + 1) / 2;
+  for (int k = 0; k < n_nodes; k++) {
+    struct poly_edge *pe = &nodes[k];
+    pe->next = (k + 1 < n_nodes) ? &nodes[k + 1] : NULL;
+    pe->n = count - 2 * k;
+    pe->face[0] = inc[2 * k] / 3;
+    pe->edge[0] = inc[2 * k] % 3;
+    if (2 * k + 1 < count) {
+      pe->face[1] = inc[2 * k + 1] / 3;
+      pe->edge[1] = inc[2 * k + 1] % 3;
+    } else {
+      pe->face[1] = -1;
+      pe->edge[1] = -1;
+    }
+  }
+  return nodes;
+}
+
+/***************************************************************************
+connect_edge_group:
+  In: incidences of one edge
+      number of incidences
+      array of pointers to walls
+      scratch space for the poly_edges (grown as needed)
+      flag to clear if the edge is not shared by two walls
+  Out: 0 on success, 1 on malloc failure.
+***************************************************************************/
+static int connect_edge_group(int *inc, int count, struct wall **facelist,
+                              struct poly_edge **nodes, int *max_nodes,
+                              int *is_closed) {
+  int n_nodes = (count + 1) / 2;
+  if (n_nodes > *max_nodes) {
+    struct poly_edge *grown = CHECKED_MALLOC_ARRAY_NODIE(
+        struct poly_edge, n_nodes, "polygon edges");
+    if (grown == NULL)
+      return 1;
+    free(*nodes);
+    *nodes = grown;
+    *max_nodes = n_nodes;
+  }
+
+  struct poly_edge *head = build_edge_chain(inc, count, *nodes);
+  return connect_shared_edge(head, facelist, is_closed);
+}
+
+/***************************************************************************
+match_edges_by_table:
+  In: array of pointers to walls
+      integer length of array
+      canonical vertex ids of the walls
+      flag to clear if the surface is not closed
+  Out: 0 on success, 1 on malloc failure.  Edges are collected in an
+       open-addressed table keyed by vertex id pairs and sized from the
+       number of faces, then connected.
+***************************************************************************/
+static int match_edges_by_table(struct wall **facelist, int nfaces,
+                                int *vert_id, int *is_closed) {
+  unsigned long size = table_size_for(3 * (unsigned long)nfaces / 2 + 1);
+  unsigned long mask = size - 1;
+  struct edge_slot *table =
+      CHECKED_MALLOC_ARRAY_NODIE(struct edge_slot, size, "edge table");
+  int *inc_next = CHECKED_MALLOC_ARRAY_NODIE(int, 3 * nfaces, "edge links");
+  int *group = CHECKED_MALLOC_ARRAY_NODIE(int, 3 * nfaces, "edge group");
+  if (table == NULL || inc_next == NULL || group == NULL) {
+    free(table);
+    free(inc_next);
+    free(group);
+    return 1;
+  }
+  for (unsigned long s = 0; s < size; s++)
+    table[s].key = EDGE_SLOT_EMPTY;
+
+  for (int inc = 0; inc < 3 * nfaces; inc++) {
+    if (facelist[inc / 3] == NULL)
+      continue;
+
+    uint64_t key = edge_key(vert_id, inc);
+    unsigned long s = mix_hash64(key) & mask;
+    while (table[s].key != EDGE_SLOT_EMPTY && table[s].key != key)
+      s = (s + 1) & mask;
+
+    inc_next[inc] = -1;
+    if (table[s].key == EDGE_SLOT_EMPTY) {
+      table[s].key = key;
+      table[s].first = inc;
+      table[s].count = 0;
+    } else {
+      inc_next[table[s].last] = inc;
+    }
+    table[s].last = inc;
+    table[s].count++;
+  }
+
+  int status = 0;
+  struct poly_edge *nodes = NULL;
+  int max_nodes = 0;
+  for (unsigned long s = 0; s < size && status == 0; s++) {
+    if (table[s].key == EDGE_SLOT_EMPTY)
+      continue;
+
+    int count = 0;
+    for (int inc = table[s].first; inc != -1; inc = inc_next[inc])
+      group[count++] = inc;
+    status = connect_edge_group(group, count, facelist, &nodes, &max_nodes,
+                                is_closed);
+  }
+
+  free(nodes);
+  free(group);
+  free(inc_next);
+  free(table);
+  return status;
+}
+
+/***************************************************************************
+match_edges_by_sorting:
+  In: array of pointers to walls
+      integer length of array
+      canonical vertex ids of the walls
+      flag to clear if the surface is not closed
+  Out: 0 on success, 1 on malloc failure.  All edge incidences are sorted
+       by vertex id pair (in parallel), so each edge becomes a run of
+       incidences in wall order, then connected.
+***************************************************************************/
+static int match_edges_by_sorting(struct wall **facelist, int nfaces,
+                                  int *vert_id, int *is_closed) {
+  long n_inc = 3 * (long)nfaces;
+  struct edge_record *rec =
+      CHECKED_MALLOC_ARRAY_NODIE(struct edge_record, n_inc + 1, "edge records");
+  struct edge_record *tmp =
+      CHECKED_MALLOC_ARRAY_NODIE(struct edge_record, n_inc + 1, "edge records");
+  int *group = CHECKED_MALLOC_ARRAY_NODIE(int, n_inc + 1, "edge group");
+  if (rec == NULL || tmp == NULL || group == NULL) {
+    free(rec);
+    free(tmp);
+    free(group);
+    return 1;
+  }
+
+  long inc;
+#pragma omp parallel for schedule(static)
+  for (inc = 0; inc < n_inc; inc++) {
+    rec[inc].inc = (int)inc;
+    rec[inc].key = (facelist[inc / 3] == NULL) ? EDGE_SLOT_EMPTY
+                                               : edge_key(vert_id, (int)inc);
+  }
+
+  sort_edge_records(rec, tmp, n_inc);
+
+  int status = 0;
+  struct poly_edge *nodes = NULL;
+  int max_nodes = 0;
+  long start = 0;
+  while (start < n_inc && rec[start].key != EDGE_SLOT_EMPTY && status == 0) {
+    long end = start;
+    int count = 0;
+    while (end < n_inc && rec[end].key == rec[start].key)
+      group[count++] = rec[end++].inc;
+    status = connect_edge_group(group, count, facelist, &nodes, &max_nodes,
+                                is_closed);
+    start = end;
+  }
+
+  free(nodes);
+  free(group);
+  free(tmp);
+  free(rec);
+  return status;
+}
+
 /***************************************************************************
 surface_net:
   In: array of pointers to walls
@@ -468,88 +695,44 @@ surface_net:
         be any free edges anywhere.)  It is possible to build weird, twisty
         self-intersecting things.  The behavior of these things during a
         simulation is not guaranteed to be well-defined.
+        Edges are identified by the pair of (coordinate-wise) distinct
+        vertices they join.  Large objects, or objects whose edge table
+        cannot be allocated, are matched by sorting instead.
 ***************************************************************************/
 int surface_net(struct wall **facelist, int nfaces) {
-  struct edge *e;
+  return surface_net_sort_above(facelist, nfaces, edge_sort_min_faces);
+}
+
+/***************************************************************************
+surface_net_sort_above:
+  In: array of pointers to walls
+      integer length of array
+      objects with at least this many faces have their edges matched by
+      sorting instead of through the edge table
+  Out: As surface_net.  A limit of 0 always takes the sorting path, so both
+       paths can be checked against each other on small objects.
+***************************************************************************/
+int surface_net_sort_above(struct wall **facelist, int nfaces,
+                           int sort_min_faces) {
   int is_closed = 1;
 
-  struct edge_hashtable eht;
-  int nkeys = (3 * nfaces) / 2;
-  if (ehtable_init(&eht, nkeys))
+  int *vert_id = CHECKED_MALLOC_ARRAY_NODIE(int, 3 * nfaces + 1, "vertex ids");
+  if (vert_id == NULL)
+    return 1;
+  if (assign_vertex_ids(facelist, nfaces, vert_id)) {
+    free(vert_id);
     return 1;
-
-  for (int i = 0; i < nfaces; i++) {
-    if (facelist[i] == NULL)
-      continue;
-
-    int k;
-    int nedge = 3;
-    for (int j = 0; j < nedge; j++) {
-
-      if (j + 1 < nedge)
-        k = j + 1;
-      else
-        k = 0;
-
-      struct poly_edge pe;
-      pe.v1x = facelist[i]->vert[j]->x;
-      pe.v1y = facelist[i]->vert[j]->y;
-      pe.v1z = facelist[i]->vert[j]->z;
-      pe.v2x = facelist[i]->vert[k]->x;
-      pe.v2y = facelist[i]->vert[k]->y;
-      pe.v2z = facelist[i]->vert[k]->z;
-      pe.face[0] = i;
-      pe.edge[0] = j;
-
-      if (ehtable_add(&eht, &pe))
-        return 1;
-    }
   }
 
-  for (int i = 0; i < nkeys; i++) {
-    struct poly_edge *pep = (eht.data + i);
-    while (pep != NULL) {
-      if (pep->n > 2) {
-        refine_edge_pairs(pep, facelist);
-      }
-      if (pep->n >= 2) {
-        if (pep->face[0] != -1 && pep->face[1] != -1) {
-          if (compatible_edges(facelist, pep->face[0], pep->edge[0], pep->face[1],
-                               pep->edge[1])) {
-            facelist[pep->face[0]]->nb_walls[pep->edge[0]] = facelist[pep->face[1]];
-            facelist[pep->face[1]]->nb_walls[pep->edge[1]] = facelist[pep->face[0]];
-            e = (struct edge *)CHECKED_MEM_GET_NODIE(
-                facelist[pep->face[0]]->birthplace->join, "edge");
-            if (e == NULL)
-              return 1;
-
-            e->forward = facelist[pep->face[0]];
-            e->backward = facelist[pep->face[1]];
-            init_edge_transform(e, pep->edge[0]);
-            facelist[pep->face[0]]->edges[pep->edge[0]] = e;
-            facelist[pep->face[1]]->edges[pep->edge[1]] = e;
-          }
+  int status = 1;
+  if (nfaces < sort_min_faces)
+    status = match_edges_by_table(facelist, nfaces, vert_id, &is_closed);
+  if (status != 0)
+    status = match_edges_by_sorting(facelist, nfaces, vert_id, &is_closed);
 
-        } else {
-          is_closed = 0;
-        }
-      } else if (pep->n == 1) {
-        is_closed = 0;
-        e = (struct edge *)CHECKED_MEM_GET_NODIE(
-            facelist[pep->face[0]]->birthplace->join, "edge");
-        if (e == NULL)
-          return 1;
-
-        e->forward = facelist[pep->face[0]];
-        e->backward = NULL;
-        /* Don't call init_edge_transform unless both edges are set */
-        facelist[pep->face[0]]->edges[pep->edge[0]] = e;
-      }
-      pep = pep->next;
-    }
-  }
-
-  ehtable_kill(&eht);
+  free(vert_id);
+  if (status != 0)
+    return 1;
   return -is_closed; /* We use 1 to indicate malloc failure so return 0/-1 */
 }
 
@@ -659,6 +842,11 @@ int sharpen_object(struct object *parent) {
     else {
       parent->is_closed = -i; 
     }
+
+    for (int n_wall = 0; n_wall < parent->n_walls; n_wall++) {
+      if (parent->wall_p[n_wall] != NULL)
+        init_wall_xform(parent->wall_p[n_wall]);
+    }
   } else if (parent->object_type == META_OBJ) {
     for (struct object *o = parent->first_child; o != NULL; o = o->next) {
       if (sharpen_object(o))
@@ -870,6 +1058,43 @@ struct wall *traverse_surface(struct wall *here, struct vector2 *loc, int which,
   }
 }
 
+/***************************************************************************
+init_wall_xform:
+  In: w: a wall whose edges have been added
+  Out: No return value.  The edge crossing record of the wall is filled in
+       from its edges, so that 2D diffusion can cross or reflect off them
+       without looking at the edges.  The values are computed exactly as
+       traverse_surface and ray_trace_2D compute them.
+***************************************************************************/
+void init_wall_xform(struct wall *w) {
+  for (int i = 0; i < 3; i++) {
+    struct wall_edge_xform *x = &w->xform.edge[i];
+    struct edge *e = w->edges[i];
+    if (e == NULL || e->backward == NULL) {
+      memset(x, 0, sizeof(struct wall_edge_xform));
+      continue;
+    }
+    x->inverse = (e->forward != w);
+    x->nb_wall = x->inverse ? e->forward : e->backward;
+    x->cos_theta = e->cos_theta;
+    x->sin_theta = e->sin_theta;
+    x->translate = e->translate;
+  }
+
+  struct vector2 *r = w->xform.reflector;
+  r[0].u = 0.0;
+  r[0].v = 1.0;
+  r[1].u = -w->uv_vert2.v;
+  r[1].v = w->uv_vert2.u - w->uv_vert1_u;
+  r[2].u = w->uv_vert2.v;
+  r[2].v = -w->uv_vert2.u;
+  for (int i = 1; i < 3; i++) {
+    double f = 1.0 / sqrt(r[i].u * r[i].u + r[i].v * r[i].v);
+    r[i].u *= f;
+    r[i].v *= f;
+  }
+}
+
 /***************************************************************************
 is_manifold:
   In: r: A region. This region must already be painted on walls. The edges must
@@ -1573,21 +1798,28 @@ struct wall *localize_wall(struct wall *w, struct storage *stor) {
   return ww;
 }
 
+/* Range of subvolumes touched by the (enlarged) bounding box of a wall */
+struct wall_subvol_range {
+  int x_min, x_max;
+  int y_min, y_max;
+  int z_min, z_max;
+  double leeway; /* Margin by which subvolume boxes are enlarged */
+  int home;      /* Subvolume whose storage will hold the wall */
+};
+
 /***************************************************************************
-distribute_wall:
+wall_subvol_range:
   In: a wall belonging to an object
-  Out: A pointer to the wall as copied into appropriate local memory, or
-       NULL on memory allocation error.  Also, the wall is added to the
-       appropriate wall lists for all subvolumes it intersects; if this
-       fails due to memory allocation errors, NULL is also returned.
+      range to fill in
+  Out: No return value.  The range of candidate subvolumes for the wall and
+       the subvolume in whose storage the wall will live are computed.
+  Note: does not modify any shared state, so it may be called concurrently.
 ***************************************************************************/
-static struct wall *distribute_wall(struct volume *world, struct wall *w) {
-  struct wall *where_am_i;       /* Version of the wall in local memory */
+static void wall_subvol_range(struct volume *world, struct wall *w,
+                              struct wall_subvol_range *r) {
   struct vector3 llf, urb, cent; /* Bounding box for wall */
-  int x_max, x_min, y_max, y_min, z_max,
-      z_min;           /* Enlarged box to avoid rounding */
-  int h, i, j, k;      /* Iteration variables for subvolumes */
-  double leeway = 1.0; /* Margin of error */
+  int i, j, k;                   /* Iteration variables for subvolumes */
+  double leeway = 1.0;           /* Margin of error */
 
   wall_bounding_box(w, &llf, &urb);
 
@@ -1607,6 +1839,7 @@ static struct wall *distribute_wall(struct volume *world, struct wall *w) {
   if (world->use_expanded_list) {
     leeway += world->rx_radius_3d;
   }
+  r->leeway = leeway;
 
   llf.x -= leeway;
   llf.y -= leeway;
@@ -1619,129 +1852,156 @@ static struct wall *distribute_wall(struct volume *world, struct wall *w) {
   cent.y = 0.33333333333 * (w->vert[0]->y + w->vert[1]->y + w->vert[2]->y);
   cent.z = 0.33333333333 * (w->vert[0]->z + w->vert[1]->z + w->vert[2]->z);
 
-  x_min = bisect(world->x_partitions, world->nx_parts, llf.x);
-  if (urb.x < world->x_partitions[x_min + 1])
-    x_max = x_min + 1;
+  r->x_min = bisect(world->x_partitions, world->nx_parts, llf.x);
+  if (urb.x < world->x_partitions[r->x_min + 1])
+    r->x_max = r->x_min + 1;
   else
-    x_max = bisect(world->x_partitions, world->nx_parts, urb.x) + 1;
+    r->x_max = bisect(world->x_partitions, world->nx_parts, urb.x) + 1;
 
-  y_min = bisect(world->y_partitions, world->ny_parts, llf.y);
-  if (urb.y < world->y_partitions[y_min + 1])
-    y_max = y_min + 1;
+  r->y_min = bisect(world->y_partitions, world->ny_parts, llf.y);
+  if (urb.y < world->y_partitions[r->y_min + 1])
+    r->y_max = r->y_min + 1;
   else
-    y_max = bisect(world->y_partitions, world->ny_parts, urb.y) + 1;
+    r->y_max = bisect(world->y_partitions, world->ny_parts, urb.y) + 1;
 
-  z_min = bisect(world->z_partitions, world->nz_parts, llf.z);
-  if (urb.z < world->z_partitions[z_min + 1])
-    z_max = z_min + 1;
+  r->z_min = bisect(world->z_partitions, world->nz_parts, llf.z);
+  if (urb.z < world->z_partitions[r->z_min + 1])
+    r->z_max = r->z_min + 1;
   else
-    z_max = bisect(world->z_partitions, world->nz_parts, urb.z) + 1;
+    r->z_max = bisect(world->z_partitions, world->nz_parts, urb.z) + 1;
 
-  if ((z_max - z_min) * (y_max - y_min) * (x_max - x_min) == 1) {
-    h = z_min + (world->nz_parts - 1) * (y_min + (world->ny_parts - 1) * x_min);
-    where_am_i = localize_wall(w, world->subvol[h].local_storage);
-    if (where_am_i == NULL)
-      return NULL;
-
-    if (wall_to_vol(where_am_i, &(world->subvol[h])) == NULL)
-      return NULL;
-
-    return where_am_i;
+  if ((r->z_max - r->z_min) * (r->y_max - r->y_min) * (r->x_max - r->x_min) ==
+      1) {
+    r->home = r->z_min +
+              (world->nz_parts - 1) *
+                  (r->y_min + (world->ny_parts - 1) * r->x_min);
+    return;
   }
 
-  for (i = x_min; i < x_max; i++) {
+  for (i = r->x_min; i < r->x_max; i++) {
     if (cent.x < world->x_partitions[i])
       break;
   }
-  for (j = y_min; j < y_max; j++) {
+  for (j = r->y_min; j < r->y_max; j++) {
     if (cent.y < world->y_partitions[j])
       break;
   }
-  for (k = z_min; k < z_max; k++) {
+  for (k = r->z_min; k < r->z_max; k++) {
     if (cent.z < world->z_partitions[k])
       break;
   }
 
-  h = (k - 1) +
-      (world->nz_parts - 1) * ((j - 1) + (world->ny_parts - 1) * (i - 1));
-  where_am_i = localize_wall(w, world->subvol[h].local_storage);
-  if (where_am_i == NULL)
-    return NULL;
+  r->home = (k - 1) + (world->nz_parts - 1) *
+                          ((j - 1) + (world->ny_parts - 1) * (i - 1));
+}
+
+/***************************************************************************
+wall_subvol_hits:
+  In: a wall belonging to an object
+      its range of candidate subvolumes
+      array to store the indices of the intersected subvolumes, or NULL
+  Out: The number of subvolumes the wall intersects.  If hits is not NULL,
+       their indices are stored in the order in which the wall lists have
+       always been built.
+  Note: does not modify any shared state, so it may be called concurrently.
+***************************************************************************/
+static int wall_subvol_hits(struct volume *world, struct wall *w,
+                            struct wall_subvol_range *r, int *hits) {
+  struct vector3 llf, urb;
+  int h, i, j, k;
+  int n_hits = 0;
 
-  for (k = z_min; k < z_max; k++) {
-    for (j = y_min; j < y_max; j++) {
-      for (i = x_min; i < x_max; i++) {
+  if ((r->z_max - r->z_min) * (r->y_max - r->y_min) * (r->x_max - r->x_min) ==
+      1) {
+    if (hits != NULL)
+      hits[0] = r->home;
+    return 1;
+  }
+
+  for (k = r->z_min; k < r->z_max; k++) {
+    for (j = r->y_min; j < r->y_max; j++) {
+      for (i = r->x_min; i < r->x_max; i++) {
         h = k + (world->nz_parts - 1) * (j + (world->ny_parts - 1) * i);
-        llf.x = world->x_fineparts[world->subvol[h].llf.x] - leeway;
-        llf.y = world->y_fineparts[world->subvol[h].llf.y] - leeway;
-        llf.z = world->z_fineparts[world->subvol[h].llf.z] - leeway;
-        urb.x = world->x_fineparts[world->subvol[h].urb.x] + leeway;
-        urb.y = world->y_fineparts[world->subvol[h].urb.y] + leeway;
-        urb.z = world->z_fineparts[world->subvol[h].urb.z] + leeway;
+        llf.x = world->x_fineparts[world->subvol[h].llf.x] - r->leeway;
+        llf.y = world->y_fineparts[world->subvol[h].llf.y] - r->leeway;
+        llf.z = world->z_fineparts[world->subvol[h].llf.z] - r->leeway;
+        urb.x = world->x_fineparts[world->subvol[h].urb.x] + r->leeway;
+        urb.y = world->y_fineparts[world->subvol[h].urb.y] + r->leeway;
+        urb.z = world->z_fineparts[world->subvol[h].urb.z] + r->leeway;
 
         if (wall_in_box(w->vert, &(w->normal), w->d, &llf, &urb)) {
-          if (wall_to_vol(where_am_i, &(world->subvol[h])) == NULL)
-            return NULL;
+          if (hits != NULL)
+            hits[n_hits] = h;
+          n_hits++;
         }
       }
     }
   }
 
-  return where_am_i;
+  return n_hits;
 }
 
 /***************************************************************************
-distribute_object:
+count_object_walls:
   In: an object
-  Out: 0 on success, 1 on memory allocation failure.  The object's walls
-       are copied to local memory and the wall lists in the appropriate
-       subvolumes are set to refer to that wall.  The object's own copy
-       of the wall is deallocated and it is set to point to the new version.
-  Note: this function is recursive and is called on any children of the
-        object passed to it.
+  Out: The number of (not removed) walls of this object and its children.
 ***************************************************************************/
-int distribute_object(struct volume *world, struct object *parent) {
-  struct object *o; /* Iterator for child objects */
-  int i;
-  long long vert_index; /* index of the vertex in the global array
-                     "world->all_vertices" */
+static long count_object_walls(struct object *parent) {
+  long n = 0;
+  if (parent->object_type == BOX_OBJ || parent->object_type == POLY_OBJ) {
+    for (int i = 0; i < parent->n_walls; i++) {
+      if (parent->wall_p[i] != NULL)
+        n++;
+    }
+  } else if (parent->object_type == META_OBJ) {
+    for (struct object *o = parent->first_child; o != NULL; o = o->next)
+      n += count_object_walls(o);
+  }
+  return n;
+}
 
+/***************************************************************************
+gather_object_walls:
+  In: an object
+      array to be filled with the addresses of the object's wall pointers
+      array to be filled with the object owning each wall
+      index of the next free slot
+  Out: The index of the next free slot.  Walls are gathered in the same order
+       in which the object tree has always been traversed.
+***************************************************************************/
+static long gather_object_walls(struct object *parent, struct wall ***slots,
+                                struct object **owners, long n) {
   if (parent->object_type == BOX_OBJ || parent->object_type == POLY_OBJ) {
-    for (i = 0; i < parent->n_walls; i++) {
+    for (int i = 0; i < parent->n_walls; i++) {
       if (parent->wall_p[i] == NULL)
         continue; /* Wall removed. */
-
-      parent->wall_p[i] = distribute_wall(world, parent->wall_p[i]);
-
-      if (parent->wall_p[i] == NULL)
-        mcell_allocfailed("Failed to distribute wall %d on object %s.", i,
-                          parent->sym->name);
-
-      /* create information about shared vertices */
-      if (world->create_shared_walls_info_flag) {
-        vert_index = (long long)(parent->wall_p[i]->vert[0] - world->all_vertices);
-        push_wall_to_list(&(world->walls_using_vertex[vert_index]),
-                          parent->wall_p[i]);
-        vert_index = (long long)(parent->wall_p[i]->vert[1] - world->all_vertices);
-        push_wall_to_list(&(world->walls_using_vertex[vert_index]),
-                          parent->wall_p[i]);
-        vert_index = (long long)(parent->wall_p[i]->vert[2] - world->all_vertices);
-        push_wall_to_list(&(world->walls_using_vertex[vert_index]),
-                          parent->wall_p[i]);
-      }
+      slots[n] = &parent->wall_p[i];
+      owners[n] = parent;
+      n++;
     }
+  } else if (parent->object_type == META_OBJ) {
+    for (struct object *o = parent->first_child; o != NULL; o = o->next)
+      n = gather_object_walls(o, slots, owners, n);
+  }
+  return n;
+}
+
+/***************************************************************************
+release_object_walls:
+  In: an object
+  Out: No return value.  The object's own copies of its walls (and those of
+       its children) are deallocated; wall_p is used from now on.
+***************************************************************************/
+static void release_object_walls(struct object *parent) {
+  if (parent->object_type == BOX_OBJ || parent->object_type == POLY_OBJ) {
     if (parent->walls != NULL) {
       free(parent->walls);
       parent->walls = NULL; /* Use wall_p from now on! */
     }
   } else if (parent->object_type == META_OBJ) {
-    for (o = parent->first_child; o != NULL; o = o->next) {
-      if (distribute_object(world, o) != 0)
-        return 1;
-    }
+    for (struct object *o = parent->first_child; o != NULL; o = o->next)
+      release_object_walls(o);
   }
-
-  return 0;
 }
 
 /***************************************************************************
@@ -1749,16 +2009,148 @@ distribute_world:
   In: No arguments.
   Out: 0 on success, 1 on memory allocation failure.  Every geometric object
        is distributed to local memory and into appropriate subvolumes.
+  Note: this is done in passes so that the expensive wall/subvolume
+        intersection tests can run in parallel:
+          1. find the candidate subvolumes of each wall and count hits,
+          2. prefix-sum the counts and store the hits of each wall,
+          3. copy the walls into local memory (in the original order),
+          4. bucket the hits by subvolume into one contiguous array per
+             subvolume, and build the wall lists as views of these arrays.
+        The resulting wall lists are identical to those built one wall at a
+        time.
 ***************************************************************************/
 int distribute_world(struct volume *world) {
   struct object *o; /* Iterator for objects in the world */
 
-  for (o = world->root_instance; o != NULL; o = o->next) {
-    if (distribute_object(world, o) != 0)
-      return 1;
+  long n_walls = 0;
+  for (o = world->root_instance; o != NULL; o = o->next)
+    n_walls += count_object_walls(o);
+
+  struct wall ***slots =
+      CHECKED_MALLOC_ARRAY_NODIE(struct wall **, n_walls + 1, "wall slots");
+  struct object **owners =
+      CHECKED_MALLOC_ARRAY_NODIE(struct object *, n_walls + 1, "wall owners");
+  struct wall_subvol_range *ranges = CHECKED_MALLOC_ARRAY_NODIE(
+      struct wall_subvol_range, n_walls + 1, "wall subvolume ranges");
+  long *hit_offset =
+      CHECKED_MALLOC_ARRAY_NODIE(long, n_walls + 1, "wall hit offsets");
+  long *sv_offset = CHECKED_MALLOC_ARRAY_NODIE(long, world->n_subvols + 1,
+                                               "subvolume wall offsets");
+  if (slots == NULL || owners == NULL || ranges == NULL ||
+      hit_offset == NULL || sv_offset == NULL) {
+    free(slots);
+    free(owners);
+    free(ranges);
+    free(hit_offset);
+    free(sv_offset);
+    return 1;
   }
 
-  return 0;
+  long n = 0;
+  for (o = world->root_instance; o != NULL; o = o->next)
+    n = gather_object_walls(o, slots, owners, n);
+
+  /* Pass 1: candidate subvolumes and number of hits of each wall */
+  long w_idx;
+#pragma omp parallel for schedule(dynamic, 256)
+  for (w_idx = 0; w_idx < n_walls; w_idx++) {
+    struct wall *w = *slots[w_idx];
+    wall_subvol_range(world, w, &ranges[w_idx]);
+    hit_offset[w_idx] = wall_subvol_hits(world, w, &ranges[w_idx], NULL);
+  }
+
+  /* Exclusive prefix sum over the hit counts */
+  long n_hits = 0;
+  for (w_idx = 0; w_idx < n_walls; w_idx++) {
+    long c = hit_offset[w_idx];
+    hit_offset[w_idx] = n_hits;
+    n_hits += c;
+  }
+  hit_offset[n_walls] = n_hits;
+
+  int *hits = CHECKED_MALLOC_ARRAY_NODIE(int, n_hits + 1, "wall hits");
+  struct wall **sv_walls = CHECKED_MALLOC_ARRAY_NODIE(
+      struct wall *, n_hits + 1, "subvolume wall arrays");
+  if (hits == NULL || sv_walls == NULL) {
+    free(hits);
+    free(sv_walls);
+    free(slots);
+    free(owners);
+    free(ranges);
+    free(hit_offset);
+    free(sv_offset);
+    return 1;
+  }
+
+  /* Pass 2: store the hits of each wall */
+#pragma omp parallel for schedule(dynamic, 256)
+  for (w_idx = 0; w_idx < n_walls; w_idx++) {
+    wall_subvol_hits(world, *slots[w_idx], &ranges[w_idx],
+                     hits + hit_offset[w_idx]);
+  }
+
+  /* Copy walls into the local memory of their home subvolume */
+  for (w_idx = 0; w_idx < n_walls; w_idx++) {
+    struct wall *w = localize_wall(
+        *slots[w_idx], world->subvol[ranges[w_idx].home].local_storage);
+    if (w == NULL)
+      mcell_allocfailed("Failed to distribute wall %d on object %s.",
+                        (int)(slots[w_idx] - owners[w_idx]->wall_p),
+                        owners[w_idx]->sym->name);
+    *slots[w_idx] = w;
+
+    /* create information about shared vertices */
+    if (world->create_shared_walls_info_flag) {
+      for (int v = 0; v < 3; v++) {
+        long long vert_index = (long long)(w->vert[v] - world->all_vertices);
+        push_wall_to_list(&(world->walls_using_vertex[vert_index]), w);
+      }
+    }
+  }
+
+  /* Bucket the hits by subvolume, keeping the wall order in each bucket */
+  for (int h = 0; h <= world->n_subvols; h++)
+    sv_offset[h] = 0;
+  for (long hit = 0; hit < n_hits; hit++)
+    sv_offset[hits[hit] + 1]++;
+  for (int h = 0; h < world->n_subvols; h++)
+    sv_offset[h + 1] += sv_offset[h];
+  for (int h = 0; h < world->n_subvols; h++) {
+    world->subvol[h].walls = sv_walls + sv_offset[h];
+    world->subvol[h].n_walls = 0;
+  }
+  for (w_idx = 0; w_idx < n_walls; w_idx++) {
+    for (long hit = hit_offset[w_idx]; hit < hit_offset[w_idx + 1]; hit++) {
+      struct subvolume *sv = &world->subvol[hits[hit]];
+      sv->walls[sv->n_walls++] = *slots[w_idx];
+    }
+  }
+  free(world->subvol_walls);
+  world->subvol_walls = sv_walls;
+
+  /* The wall lists are views of the arrays; walls are prepended in array
+     order, as wall_to_vol has always done */
+  int status = 0;
+  for (int h = 0; h < world->n_subvols && status == 0; h++) {
+    struct subvolume *sv = &world->subvol[h];
+    for (int i = 0; i < sv->n_walls; i++) {
+      if (wall_to_vol(sv->walls[i], sv) == NULL) {
+        status = 1;
+        break;
+      }
+    }
+  }
+
+  for (o = world->root_instance; o != NULL; o = o->next)
+    release_object_walls(o);
+
+  free(hits);
+  free(slots);
+  free(owners);
+  free(ranges);
+  free(hit_offset);
+  free(sv_offset);
+  return status;
 }
 
 /***************************************************************************
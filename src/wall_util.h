@@ -27,27 +27,11 @@
 
 /* Temporary data stored about an edge of a polygon */
 struct poly_edge {
-  struct poly_edge *next; /* Next edge in a hash table. */
-
-  double v1x; /* X coord of starting point */
-  double v1y; /* Y coord of starting point */
-  double v1z; /* Z coord of starting point */
-  double v2x; /* X coord of ending point */
-  double v2y; /* Y coord of ending point */
-  double v2z; /* Z coord of ending point */
+  struct poly_edge *next; /* Next pair of walls sharing this edge */
 
   int face[2]; /* wall indices on side of edge */
   int edge[2]; /* which edge of wall1/2 are we? */
-  int n;     /* How many walls share this edge? */
-};
-
-/* Hash table for rapid order-invariant lookup of edges. */
-struct edge_hashtable {
-  struct poly_edge *data; /* Array of polygon edges */
-
-  int nkeys;    /* Length of array */
-  int stored;   /* How many things do we have in the table? */
-  int distinct; /* How many of those are distinct? */
+  int n;     /* How many walls share this edge (from this node on)? */
 };
 
 /* This linked list node is used in walls overlap test */
@@ -64,14 +48,11 @@ struct plane {
                the plane */
 };
 
-int edge_equals(struct poly_edge *e1, struct poly_edge *e2);
-int edge_hash(struct poly_edge *pe, int nkeys);
-
-int ehtable_init(struct edge_hashtable *eht, int nkeys);
-int ehtable_add(struct edge_hashtable *eht, struct poly_edge *pe);
-void ehtable_kill(struct edge_hashtable *eht);
+extern int edge_sort_min_faces;
 
 int surface_net(struct wall **facelist, int nfaces);
+int surface_net_sort_above(struct wall **facelist, int nfaces,
+                           int sort_min_faces);
 void init_edge_transform(struct edge *e, int edgenum);
 int sharpen_object(struct object *parent);
 
@@ -84,6 +65,38 @@ int find_edge_point(struct wall *here, struct vector2 *loc,
                     struct vector2 *disp, struct vector2 *edgept);
 struct wall *traverse_surface(struct wall *here, struct vector2 *loc, int which,
                               struct vector2 *newloc);
+void init_wall_xform(struct wall *w);
+
+/* Map loc on a wall to newloc on the wall behind the edge x */
+static inline void map_across_edge(struct wall_edge_xform const *x,
+                                   struct vector2 const *loc,
+                                   struct vector2 *newloc) {
+  double u, v;
+
+  if (!x->inverse) {
+    u = x->cos_theta * loc->u + x->sin_theta * loc->v;
+    v = -x->sin_theta * loc->u + x->cos_theta * loc->v;
+    newloc->u = u + x->translate.u;
+    newloc->v = v + x->translate.v;
+  } else {
+    u = loc->u - x->translate.u;
+    v = loc->v - x->translate.v;
+    newloc->u = x->cos_theta * u - x->sin_theta * v;
+    newloc->v = x->sin_theta * u + x->cos_theta * v;
+  }
+}
+
+/* Same as traverse_surface, but from the precomputed record of the wall */
+static inline struct wall *cross_edge(struct wall *here, struct vector2 *loc,
+                                      int which, struct vector2 *newloc) {
+  struct wall_edge_xform const *x = &here->xform.edge[which];
+
+  if (x->nb_wall == NULL)
+    return NULL;
+
+  map_across_edge(x, loc, newloc);
+  return x->nb_wall;
+}
 int is_manifold(struct region *r, int count_regions_flag);
 
 void jump_away_line(struct vector3 *p, struct vector3 *v, double k,
@@ -108,8 +121,6 @@ struct wall_list *wall_to_vol(struct wall *w, struct subvolume *sv);
 
 struct wall *localize_wall(struct wall *w, struct storage *stor);
 
-int distribute_object(struct volume *world, struct object *parent);
-
 int distribute_world(struct volume *world);
 
 void closest_pt_point_triangle(struct vector3 *p, struct vector3 *a,
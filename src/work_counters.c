@@ -0,0 +1,289 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2006-2017 by
+ * The Salk Institute for Biological Studies and
+ * Pittsburgh Supercomputing Center, Carnegie Mellon University
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+ * USA.
+ *
+******************************************************************************/
+
+#include "config.h"
+
+#include "work_counters.h"
+
+#ifdef MCELL_WORK_COUNTERS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "logging.h"
+#include "mem_util.h"
+#include "strfunc.h"
+#include "util.h"
+
+static char const *const work_counter_names[WORK_N_COUNTERS] = {
+  "ray_voxel_steps", "wall_tests", "mol_pair_tests", "rxn_attempted",
+  "rxn_fired",
+};
+
+struct work_counters *work_counters_create(void) {
+  struct work_counters *wc =
+      CHECKED_MALLOC_STRUCT(struct work_counters, "work counters");
+  memset(wc, 0, sizeof(struct work_counters));
+  return wc;
+}
+
+/*************************************************************************
+grow_counter_array:
+  In: counters: array of n_old rows of WORK_N_COUNTERS counters
+      n_old: current number of rows
+      n_new: wanted number of rows, at least n_old
+  Out: The array with n_new rows, the new ones zeroed.
+*************************************************************************/
+static long long *grow_counter_array(long long *counters, int n_old,
+                                     int n_new) {
+  counters = (long long *)realloc(counters, (size_t)n_new * WORK_N_COUNTERS *
+                                                sizeof(long long));
+  if (counters == NULL)
+    mcell_allocfailed("Failed to grow work counters.");
+  memset(counters + (size_t)n_old * WORK_N_COUNTERS, 0,
+         (size_t)(n_new - n_old) * WORK_N_COUNTERS * sizeof(long long));
+  return counters;
+}
+
+/*************************************************************************
+reserve_counters:
+  In: wc: work counters
+      n_species: number of species which must fit
+      n_subvols: number of subvolumes which must fit
+  Out: The arrays of wc hold at least the given numbers of rows.  Species
+       may be added during the run (e.g. by NFsim), so this may grow them
+       more than once.
+*************************************************************************/
+static void reserve_counters(struct work_counters *wc, int n_species,
+                             int n_subvols) {
+  if (n_species > wc->n_species) {
+    wc->by_species = grow_counter_array(wc->by_species, wc->n_species,
+                                        n_species);
+    wc->n_species = n_species;
+  }
+  if (n_subvols > wc->n_subvols) {
+    wc->by_subvol = grow_counter_array(wc->by_subvol, wc->n_subvols,
+                                       n_subvols);
+    wc->n_subvols = n_subvols;
+  }
+}
+
+/*************************************************************************
+work_count:
+  In: world: simulation state
+      sv: subvolume in which the work was done
+      spec: species of the molecule doing the work
+      what: which counter
+      n: amount of work
+  Out: The counter is increased in the storage of sv.
+*************************************************************************/
+void work_count(struct volume *world, struct subvolume *sv,
+                struct species *spec, enum work_counter_t what, long long n) {
+  if (sv == NULL || spec == NULL)
+    return;
+
+  struct work_counters *wc = sv->local_storage->work;
+  int sv_index = (int)(sv - world->subvol);
+  if ((int)spec->species_id >= wc->n_species || sv_index >= wc->n_subvols) {
+    int n_species = world->n_species;
+    if ((int)spec->species_id >= n_species)
+      n_species = spec->species_id + 1;
+    reserve_counters(wc, n_species, world->n_subvols);
+  }
+
+  wc->by_species[spec->species_id * WORK_N_COUNTERS + what] += n;
+  wc->by_subvol[sv_index * WORK_N_COUNTERS + what] += n;
+}
+
+/*************************************************************************
+work_commit:
+  In: world: simulation state
+      sv: subvolume the ray tracer just worked in
+      spec: species of the molecule which was traced
+  Out: The pending work of the storage of sv is counted for spec and sv.
+*************************************************************************/
+void work_commit(struct volume *world, struct subvolume *sv,
+                 struct species *spec) {
+  long long *pending = sv->local_storage->work->pending;
+  for (int i = 0; i < WORK_N_COUNTERS; i++) {
+    if (pending[i] != 0) {
+      work_count(world, sv, spec, (enum work_counter_t)i, pending[i]);
+      pending[i] = 0;
+    }
+  }
+}
+
+/*************************************************************************
+fold_counters:
+  In: dst: counters to add to
+      src: counters to add and clear
+  Out: none
+*************************************************************************/
+static void fold_counters(struct work_counters *dst,
+                          struct work_counters *src) {
+  reserve_counters(dst, src->n_species, src->n_subvols);
+  for (int i = 0; i < src->n_species * WORK_N_COUNTERS; i++)
+    dst->by_species[i] += src->by_species[i];
+  for (int i = 0; i < src->n_subvols * WORK_N_COUNTERS; i++)
+    dst->by_subvol[i] += src->by_subvol[i];
+  memset(src->by_species, 0,
+         (size_t)src->n_species * WORK_N_COUNTERS * sizeof(long long));
+  memset(src->by_subvol, 0,
+         (size_t)src->n_subvols * WORK_N_COUNTERS * sizeof(long long));
+}
+
+/*************************************************************************
+work_counters_destroy:
+  In: world: simulation state
+      store: storage which is about to be freed
+  Out: The counters of the storage are kept in the world totals, until the
+       next reaction output, and freed.
+*************************************************************************/
+void work_counters_destroy(struct volume *world, struct storage *store) {
+  struct work_counters *wc = store->work;
+  if (wc == NULL)
+    return;
+
+  if (world->work_totals == NULL)
+    world->work_totals = work_counters_create();
+  fold_counters(world->work_totals, wc);
+  free(wc->by_species);
+  free(wc->by_subvol);
+  free(wc);
+  store->work = NULL;
+}
+
+/*************************************************************************
+open_work_file:
+  In: world: simulation state
+      name: base name of the file
+      first: nonzero if this is the first report of the run
+  Out: The file, opened next to the first reaction data file, or NULL.
+*************************************************************************/
+static FILE *open_work_file(struct volume *world, char const *name,
+                            int first) {
+  char *path;
+  struct output_block *obp = world->output_block_head;
+  char const *ref = (obp != NULL && obp->data_set_head != NULL)
+                        ? obp->data_set_head->outfile_name
+                        : NULL;
+  char const *slash = (ref != NULL) ? strrchr(ref, '/') : NULL;
+  if (slash != NULL)
+    path = alloc_sprintf("%.*s/%s", (int)(slash - ref), ref, name);
+  else
+    path = alloc_sprintf("%s", name);
+  if (path == NULL)
+    mcell_allocfailed("Failed to allocate work counter file name.");
+
+  FILE *f = NULL;
+  if (make_parent_dir(path) == 0)
+    f = open_file(path, first ? "w" : "a");
+  free(path);
+  return f;
+}
+
+static void write_work_header(FILE *f, char const *key) {
+  fprintf(f, "# iteration %s", key);
+  for (int i = 0; i < WORK_N_COUNTERS; i++)
+    fprintf(f, " %s", work_counter_names[i]);
+  fprintf(f, "\n");
+}
+
+static int has_work(long long const *row) {
+  for (int i = 0; i < WORK_N_COUNTERS; i++)
+    if (row[i] != 0)
+      return 1;
+  return 0;
+}
+
+static void write_work_row(FILE *f, long long const *row) {
+  for (int i = 0; i < WORK_N_COUNTERS; i++)
+    fprintf(f, " %lld", row[i]);
+  fprintf(f, "\n");
+}
+
+/*************************************************************************
+work_counters_output:
+  In: world: simulation state
+  Out: Returns 0 on success, 1 on failure.  The counters of all storages are
+       summed, the species and subvolumes which did any work since the last
+       call are appended to work_counters_species.dat and
+       work_counters_subvolumes.dat in the reaction data directory, and the
+       counters are cleared.  Subvolumes are listed by index and by the
+       indices of their lower left front corner.
+*************************************************************************/
+int work_counters_output(struct volume *world) {
+  if (world->work_totals == NULL)
+    world->work_totals = work_counters_create();
+  struct work_counters *totals = world->work_totals;
+  for (struct storage_list *stg = world->storage_head; stg != NULL;
+       stg = stg->next) {
+    if (stg->store->work != NULL)
+      fold_counters(totals, stg->store->work);
+  }
+
+  int first = !totals->files_started;
+  totals->files_started = 1;
+
+  FILE *f = open_work_file(world, "work_counters_species.dat", first);
+  if (f == NULL)
+    return 1;
+  if (first)
+    write_work_header(f, "species");
+  for (int i = 0; i < totals->n_species && i < world->n_species; i++) {
+    long long *row = totals->by_species + i * WORK_N_COUNTERS;
+    if (!has_work(row))
+      continue;
+    fprintf(f, "%lld %s", world->current_iterations,
+            world->species_list[i]->sym->name);
+    write_work_row(f, row);
+  }
+  if (fclose(f) != 0)
+    return 1;
+
+  f = open_work_file(world, "work_counters_subvolumes.dat", first);
+  if (f == NULL)
+    return 1;
+  if (first)
+    write_work_header(f, "subvolume i j k");
+  for (int i = 0; i < totals->n_subvols && i < world->n_subvols; i++) {
+    long long *row = totals->by_subvol + i * WORK_N_COUNTERS;
+    if (!has_work(row))
+      continue;
+    struct subvolume *sv = &world->subvol[i];
+    fprintf(f, "%lld %d %d %d %d", world->current_iterations, i, sv->llf.x,
+            sv->llf.y, sv->llf.z);
+    write_work_row(f, row);
+  }
+  if (fclose(f) != 0)
+    return 1;
+
+  memset(totals->by_species, 0,
+         (size_t)totals->n_species * WORK_N_COUNTERS * sizeof(long long));
+  memset(totals->by_subvol, 0,
+         (size_t)totals->n_subvols * WORK_N_COUNTERS * sizeof(long long));
+  return 0;
+}
+
+#endif
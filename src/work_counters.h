@@ -0,0 +1,91 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2006-2017 by
+ * The Salk Institute for Biological Studies and
+ * Pittsburgh Supercomputing Center, Carnegie Mellon University
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+ * USA.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include "mcell_structs.h"
+
+/* Per-species and per-subvolume work counters (build with
+ * -DWORK_COUNTERS=ON, which defines MCELL_WORK_COUNTERS).
+ *
+ * Every storage collects its own counters, so the diffusion code never
+ * touches shared state.  The ray tracers only know the subvolume, so they
+ * count into 'pending' and the caller, which knows the moving species,
+ * attributes the pending work with WORK_COMMIT.  At reaction output time the
+ * counters of all storages are summed and written next to the reaction data
+ * (see work_counters_output).  Without MCELL_WORK_COUNTERS all the macros
+ * below expand to nothing.
+ */
+
+enum work_counter_t {
+  WORK_RAY_VOXEL,      /* ray-subvolume steps */
+  WORK_WALL_TESTS,     /* ray-wall intersection tests */
+  WORK_MOL_PAIR_TESTS, /* ray-molecule intersection tests */
+  WORK_RXN_ATTEMPTED,  /* reaction probabilities tested */
+  WORK_RXN_FIRED,      /* reactions which happened */
+  WORK_N_COUNTERS
+};
+
+struct work_counters {
+  long long pending[WORK_N_COUNTERS]; /* not yet attributed to a species */
+  int n_species;
+  int n_subvols;
+  long long *by_species; /* n_species x WORK_N_COUNTERS */
+  long long *by_subvol;  /* n_subvols x WORK_N_COUNTERS */
+  int files_started;     /* only used for the world totals */
+};
+
+#ifdef MCELL_WORK_COUNTERS
+
+struct work_counters *work_counters_create(void);
+void work_counters_destroy(struct volume *world, struct storage *store);
+void work_count(struct volume *world, struct subvolume *sv,
+                struct species *spec, enum work_counter_t what, long long n);
+void work_commit(struct volume *world, struct subvolume *sv,
+                 struct species *spec);
+int work_counters_output(struct volume *world);
+
+/* subvolume a molecule is in, for counting work done by it */
+static inline struct subvolume *work_subvol(struct abstract_molecule *am) {
+  if ((am->flags & TYPE_VOL) != 0)
+    return ((struct volume_molecule *)am)->subvol;
+  if ((am->flags & TYPE_SURF) != 0)
+    return ((struct surface_molecule *)am)->grid->subvol;
+  return NULL;
+}
+
+#define WORK_PENDING(sv, what) ((sv)->local_storage->work->pending[what]++)
+#define WORK_COMMIT(world, sv, spec) work_commit(world, sv, spec)
+#define WORK_COUNT(world, sv, spec, what)                                      \
+  work_count(world, sv, spec, what, 1)
+#define WORK_COUNT_MOL(world, am, what)                                        \
+  work_count(world, work_subvol(am), (am)->properties, what, 1)
+
+#else
+
+#define WORK_PENDING(sv, what) ((void)0)
+#define WORK_COMMIT(world, sv, spec) ((void)0)
+#define WORK_COUNT(world, sv, spec, what) ((void)0)
+#define WORK_COUNT_MOL(world, am, what) ((void)0)
+
+#endif
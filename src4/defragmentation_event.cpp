@@ -44,10 +44,19 @@ void defragmentation_event_t::step() {
     vector<volume_molecule_t>& volume_molecules = p.get_volume_molecules();
     vector<uint32_t>& volume_molecules_id_to_index_mapping = p.get_volume_molecules_id_to_index_mapping();
 
-    vector<partition_t::time_step_volume_molecules_data_t>& mols_per_time_step = p.get_volume_molecule_data_per_time_step_array();
-    assert(mols_per_time_step.size() == 1 && mols_per_time_step[0].molecule_ids.size() == volume_molecules.size()
-        && "For now, volume_molecule_indices_per_time_step[0] must be identical to volume_molecules");
-    vector<uint32_t>& volume_molecule_ids_per_time_step = mols_per_time_step[0].molecule_ids;
+    // each time step class has its own list of molecule ids, remove the defunct ones
+    // while the mapping still points to them, the order of the remaining ones is kept
+    for (partition_t::time_step_volume_molecules_data_t& time_step_data: p.get_volume_molecule_data_per_time_step_array()) {
+      vector<molecule_id_t>& molecule_ids = time_step_data.molecule_ids;
+      molecule_ids.erase(
+          remove_if(molecule_ids.begin(), molecule_ids.end(),
+              [&](const molecule_id_t id) -> bool {
+                return volume_molecules[volume_molecules_id_to_index_mapping[id]].is_defunct();
+              }
+          ),
+          molecule_ids.end()
+      );
+    }
 
 #ifdef DEBUG_DEFRAGMENTATION
     cout << "Defragmentation before sort:\n";
@@ -55,7 +64,6 @@ void defragmentation_event_t::step() {
 #endif
 
     typedef vector<volume_molecule_t>::iterator vmit_t;
-    vmit_t it_begin = volume_molecules.begin();
     vmit_t it_end = volume_molecules.end();
 
     // find first defunct molecule
@@ -63,13 +71,22 @@ void defragmentation_event_t::step() {
     vmit_t it_copy_destination = it_first_defunct;
     size_t removed = 0;
 
-    vector<uint32_t>::iterator it_indices_begin = volume_molecule_ids_per_time_step.begin();
-
     while (it_first_defunct != it_end) {
 
       // then find the next one that is not defunct
       vmit_t it_next_funct = find_if(it_first_defunct, it_end, [](const volume_molecule_t & m) -> bool { return !m.is_defunct(); });
 
+      // items between it_first_defunct and it_next_funct will be removed,
+      // their ids are marked as invalid in volume_molecules_id_to_index_mapping so that
+      // actions scheduled for them can be skipped
+      for (vmit_t it_update_mapping = it_first_defunct; it_update_mapping != it_next_funct; it_update_mapping++) {
+        const volume_molecule_t& vm = *it_update_mapping;
+        assert(vm.is_defunct());
+        volume_molecules_id_to_index_mapping[vm.id] = MOLECULE_INDEX_INVALID;
+      }
+
+      removed += it_next_funct - it_first_defunct;
+
       if (it_next_funct == it_end) {
         // are we finished?
         break;
@@ -78,37 +95,18 @@ void defragmentation_event_t::step() {
       // then again, find following defunct molecule
       vmit_t it_second_defunct = find_if(it_next_funct, it_end, [](const volume_molecule_t & m) -> bool { return m.is_defunct(); });
 
-      // items between it_first_defunct and it_next_funct will be removed
-      // for debug mode, we will set their ids in volume_molecules_id_to_index_mapping as invalid
-#ifndef NDEBUG
-      for (vmit_t it_update_mapping = it_first_defunct; it_update_mapping != it_next_funct; it_update_mapping++) {
-        const volume_molecule_t& vm = *it_update_mapping;
-        assert(vm.is_defunct());
-        volume_molecules_id_to_index_mapping[vm.id] = MOLECULE_INDEX_INVALID;
-      }
-#endif
-
       // move data: from, to, into position
       std::copy(it_next_funct, it_second_defunct, it_copy_destination);
 
-      // do the same thing to the volume_molecules_per_time_step
-      size_t next_funct_index = it_next_funct - it_begin;
-      size_t second_defunct_index = it_second_defunct - it_begin;
-      size_t copy_destination_index = it_copy_destination - it_begin;
-      std::copy(it_indices_begin + next_funct_index, it_indices_begin + second_defunct_index, it_indices_begin + copy_destination_index);
-
-      removed += it_next_funct - it_first_defunct;
-
       // and also move destination pointer
       it_copy_destination += it_second_defunct - it_next_funct;
 
-       it_first_defunct = it_second_defunct;
+      it_first_defunct = it_second_defunct;
     }
 
     // remove everything after it_copy_destination
     if (removed != 0) {
       volume_molecules.resize(volume_molecules.size() - removed);
-      volume_molecule_ids_per_time_step.resize(volume_molecule_ids_per_time_step.size() - removed);
     }
 
 #ifdef DEBUG_DEFRAGMENTATION
@@ -120,9 +118,7 @@ void defragmentation_event_t::step() {
     size_t new_count = volume_molecules.size();
     for (size_t i = 0; i < new_count; i++) {
       const volume_molecule_t& vm = volume_molecules[i];
-      if (vm.is_defunct()) {
-        break;
-      }
+      assert(!vm.is_defunct());
       // correct index because the molecule could have been moved
       volume_molecules_id_to_index_mapping[vm.id] = i;
     }
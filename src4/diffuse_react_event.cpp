@@ -38,6 +38,7 @@ extern "C" {
 #include "partition.h"
 #include "geometry.h"
 #include "debug_config.h"
+#include "event_trace.h"
 
 // include implementations of utility functions
 #include "reaction_utils.inc"
@@ -56,22 +57,28 @@ void diffuse_react_event_t::step() {
     // diffuse molecules from volume_molecule_indices_per_time_step that have the current diffusion_time_step
     uint32_t time_step_index = p.get_molecule_list_index_for_time_step(diffusion_time_step);
     if (time_step_index != TIME_STEP_INDEX_INVALID) {
-      diffuse_molecules(p, p.get_volume_molecule_ids_for_time_step_index(time_step_index));
+      diffuse_molecules(p, time_step_index);
     }
   }
 }
 
 
-void diffuse_react_event_t::diffuse_molecules(partition_t& p, const std::vector<molecule_id_t>& molecule_ids) {
+void diffuse_react_event_t::diffuse_molecules(partition_t& p, const uint32_t time_step_index) {
   float_t event_time_end = event_time + diffusion_time_step;
 
+  // molecules of other time steps created from now on can only join this time step class
+  // in its next event
+  p.get_volume_molecule_data_per_time_step_array()[time_step_index].diffused_until = event_time_end;
+
   // we need to stricly follow the ordering in mcell3, therefore steps 2) and 3) do not use the time
   // for which they were scheduled but rather simply the order in which these "microevents" were created
 
-  // 1) first diffuse already existing molecules
-  uint32_t existing_mols_count = molecule_ids.size();
+  // 1) first diffuse already existing molecules,
+  // the list is not kept as a reference because reactions may add new time step classes
+  // and thus move the per time step data
+  uint32_t existing_mols_count = p.get_volume_molecule_ids_for_time_step_index(time_step_index).size();
   for (uint32_t i = 0; i < existing_mols_count; i++) {
-    molecule_id_t id = molecule_ids[i];
+    molecule_id_t id = p.get_volume_molecule_ids_for_time_step_index(time_step_index)[i];
     // existing molecules - simulate whole time step
     diffuse_single_molecule(p, id, diffusion_time_step, event_time_end);
   }
@@ -79,24 +86,43 @@ void diffuse_react_event_t::diffuse_molecules(partition_t& p, const std::vector<
   // 2) we need to take care of unimolecular reactions that were scheduled for this time step
   // in the previous time steps; these unimolecular reaction microevents are handled like they are in a queue
 
-  // first get the calndar owned by partition that contains actions that are scheduled
-  uint32_t time_step_index = p.get_or_add_molecule_list_index_for_time_step(diffusion_time_step);
-  partition_t::calendar_for_unimol_rxs_t& calendar_for_unimol_rxs =
-      p.get_unimolecular_actions_calendar_for_time_step_index(time_step_index);
-
-  // then get bucket for this this->time corresponding to our event time
-  uint64_t bucket_index = calendar_for_unimol_rxs.get_bucket_index_for_time(event_time);
+  // first get the bucket for this->time corresponding to our event time from the calendar
+  // owned by partition that contains actions that are scheduled
+  uint64_t bucket_index =
+      p.get_unimolecular_actions_calendar_for_time_step_index(time_step_index).get_bucket_index_for_time(event_time);
   if (bucket_index != BUCKET_INDEX_INVALID) {
 
-    // FIXME: somehow simplify this
-    fifo_bucket_t<diffuse_or_unimol_react_action_t>& bucket = calendar_for_unimol_rxs.get_bucket_with_index(bucket_index);
-    std::vector<diffuse_or_unimol_react_action_t>& actions = bucket.events;
-    for (const diffuse_or_unimol_react_action_t& unimol_action: actions) {
-      react_unimol_single_molecule(p, unimol_action.id, unimol_action.scheduled_time, unimol_action.unimol_rx);
+    // neither the calendar nor the bucket are kept as a reference, a new time step class
+    // moves the calendar and a reaction may append actions to this bucket,
+    // the actions are copied for the same reason
+    for (size_t i = 0;
+        i < p.get_unimolecular_actions_calendar_for_time_step_index(time_step_index)
+            .get_bucket_with_index(bucket_index).events.size();
+        i++) {
+      const diffuse_or_unimol_react_action_t action =
+          p.get_unimolecular_actions_calendar_for_time_step_index(time_step_index)
+          .get_bucket_with_index(bucket_index).events[i];
+
+      if (!p.is_molecule_present(action.id)) {
+        // was removed by defragmentation
+        continue;
+      }
+
+      if (action.type == diffuse_or_unimol_react_action_t::DIFFUSE) {
+        // molecule created by a reaction in an event of a different time step,
+        // it diffuses from its creation time and from now on together with this time step class
+        p.add_molecule_to_time_step_list(action.id, time_step_index);
+        diffuse_single_molecule(p, action.id, event_time_end - action.scheduled_time, event_time_end);
+      }
+      else {
+        react_unimol_single_molecule(p, action.id, action.scheduled_time, action.unimol_rx);
+      }
     }
 
     // remove bucket and also all the older ones from out internal scheduler because we processed it
     // FIXME: we can remove multiple items at once
+    partition_t::calendar_for_unimol_rxs_t& calendar_for_unimol_rxs =
+        p.get_unimolecular_actions_calendar_for_time_step_index(time_step_index);
     uint64_t i = 0;
     while (i <= bucket_index) {
       calendar_for_unimol_rxs.pop_bucket();
@@ -106,9 +132,10 @@ void diffuse_react_event_t::diffuse_molecules(partition_t& p, const std::vector<
 
   // 3) simulate remaining time of molecules created with reactions
   // need to call .size() each iteration because the size can increase,
-  // again, we are using it as a queue and we do not follow the time when they were created
+  // again, we are using it as a queue and we do not follow the time when they were created,
+  // the action is copied because the vector may be reallocated while the molecule is simulated
   for (uint32_t i = 0; i < new_diffuse_or_unimol_react_actions.size(); i++) {
-    const diffuse_or_unimol_react_action_t& action = new_diffuse_or_unimol_react_actions[i];
+    const diffuse_or_unimol_react_action_t action = new_diffuse_or_unimol_react_actions[i];
 
     if (action.type == diffuse_or_unimol_react_action_t::DIFFUSE) {
       diffuse_single_molecule(p, action.id, diffusion_time_step - action.scheduled_time, event_time_end);
@@ -170,6 +197,7 @@ void diffuse_react_event_t::diffuse_single_molecule(
     vm.dump(world, "", "Diffusing vm:", world->current_iteration, event_time_end - time_up_to_event_end - diffusion_time_step);
   );
 #endif
+  TRACE(vm.trace(world, TRACE_DIFFUSE, 0, event_time_end - time_up_to_event_end - diffusion_time_step));
 
   // we might need to adjust remaining time step if this molecule has a unimolecular reaction
   // within this event's time step range
@@ -194,13 +222,21 @@ void diffuse_react_event_t::diffuse_single_molecule(
   // TBD: reflections
   vec3_t displacement;
   float_t r_rate_factor;
-  compute_displacement(species, world->rng, remaining_time_step, displacement, r_rate_factor);
+  compute_displacement(species, p.rng, remaining_time_step, displacement, r_rate_factor);
 
 #ifdef DEBUG_DIFFUSION
   DUMP_CONDITION4(
     displacement.dump("  displacement:", "");
   );
 #endif
+  TRACE(
+    trace_event(
+        TRACE_DISPLACEMENT, 0, world->current_iteration, vm.id, 0,
+        world->species[vm.species_id].mcell3_species_id,
+        event_time_end - time_up_to_event_end - diffusion_time_step,
+        displacement.x, displacement.y, displacement.z
+    )
+  );
   // note: we are ignoring use_expanded_list setting compared to mcell3
 
   // detect collisions with other molecules
@@ -248,6 +284,7 @@ void diffuse_react_event_t::diffuse_single_molecule(
       collision_t::dump_array(p, molecule_collisions);
     );
   #endif
+    TRACE(collision_t::trace_array(world, p, molecule_collisions));
 
     // evaluate and possible execute collisions and reactions
     for (size_t collision_index = 0; collision_index < molecule_collisions.size(); collision_index++) {
@@ -354,7 +391,7 @@ ray_trace_state_t diffuse_react_event_t::ray_trace(
           vm,
           subpart_index,
           previous_reflected_wall,
-          world->rng,
+          p.rng,
           displacement_up_to_wall_collision,
           collisions
       );
@@ -438,7 +475,7 @@ bool diffuse_react_event_t::collide_and_react_with_vol_mol(
   // returns which reaction pathway to take
   float_t scaling = factor * r_rate_factor;
   int i = rx_util::test_bimolecular(
-    rx, world->rng, colliding_molecule, diffused_molecule, scaling);
+    rx, p.rng, colliding_molecule, diffused_molecule, scaling);
 
   if (i < RX_LEAST_VALID_PATHWAY) {
     return false;
@@ -465,7 +502,7 @@ void diffuse_react_event_t::create_unimol_rx_action(
     return;
   }
 
-  float_t time_from_now = rx_util::compute_unimol_lifetime(world, vm, rx);
+  float_t time_from_now = rx_util::compute_unimol_lifetime(p, world, vm, rx);
 
   float_t scheduled_time = curr_time + time_from_now;
 
@@ -542,6 +579,10 @@ int diffuse_react_event_t::outcome_bimolecular(
       reacA.dump(world, "", "  defunct vm:", world->current_iteration);
     );
 #endif
+    TRACE(
+      reacB.trace(world, TRACE_RXN_REACTANT, 0);
+      reacA.trace(world, TRACE_RXN_REACTANT, 0);
+    );
 
     // always for now
     // we used the reactants - remove them
@@ -574,15 +615,6 @@ int diffuse_react_event_t::outcome_products_random(
   for (const species_with_orientation_t& product: rx->products) {
     volume_molecule_t vm(MOLECULE_ID_INVALID, product.species_id, pos);
 
-    volume_molecule_t& new_vm = p.add_volume_molecule(vm, world->species[vm.species_id].time_step);
-    new_vm.flags =  ACT_NEWBIE | TYPE_VOL | IN_VOLUME | ACT_DIFFUSE;
-
-  #ifdef DEBUG_REACTIONS
-    DUMP_CONDITION4(
-      new_vm.dump(world, "", "  created vm:", world->current_iteration);
-    );
-  #endif
-
     float_t scheduled_time;
     if (rx->reactants.size() == 2) {
       // bimolecular reaction
@@ -597,11 +629,38 @@ int diffuse_react_event_t::outcome_products_random(
       scheduled_time = reaction_time;
     }
 
-    // NOTE: in this time step, we will simply simulate all results of reactions regardless on the diffusion time step of the
-    // particular product
-    // we alway create diffuse events, unimol react events are created elsewhere
-    new_diffuse_or_unimol_react_actions.push_back(
-        diffuse_or_unimol_react_action_t(new_vm.id, scheduled_time, diffuse_or_unimol_react_action_t::DIFFUSE));
+    float_t product_time_step = world->species[vm.species_id].time_step;
+    uint32_t time_step_index = p.get_or_add_molecule_list_index_for_time_step(product_time_step);
+
+    // a product with a different time step is handed over to the event of its own time step,
+    // if that event did not get past the product's creation yet, the product starts to diffuse
+    // there from its creation time, otherwise it waits for the next event of its time step
+    bool own_time_step = (product_time_step == diffusion_time_step);
+    float_t creation_time = event_time + scheduled_time;
+    bool hand_over =
+        !own_time_step &&
+        creation_time >= p.get_volume_molecule_data_per_time_step_array()[time_step_index].diffused_until;
+
+    volume_molecule_t& new_vm = p.add_volume_molecule_with_time_step_index(vm, time_step_index, !hand_over);
+    new_vm.flags =  ACT_NEWBIE | TYPE_VOL | IN_VOLUME | ACT_DIFFUSE;
+
+  #ifdef DEBUG_REACTIONS
+    DUMP_CONDITION4(
+      new_vm.dump(world, "", "  created vm:", world->current_iteration);
+    );
+  #endif
+    TRACE(new_vm.trace(world, TRACE_RXN_PRODUCT, 0));
+
+    if (own_time_step) {
+      // we alway create diffuse events, unimol react events are created elsewhere
+      new_diffuse_or_unimol_react_actions.push_back(
+          diffuse_or_unimol_react_action_t(new_vm.id, scheduled_time, diffuse_or_unimol_react_action_t::DIFFUSE));
+    }
+    else if (hand_over) {
+      p.add_unimolecular_action(
+          product_time_step,
+          diffuse_or_unimol_react_action_t(new_vm.id, creation_time, diffuse_or_unimol_react_action_t::DIFFUSE));
+    }
   }
   return RX_A_OK;
 }
@@ -629,6 +688,7 @@ int diffuse_react_event_t::outcome_unimolecular(
     vm_new_ref.dump(world, "", "Unimolecular vm defunct:", world->current_iteration, time_from_event_start);
   );
 #endif
+  TRACE(vm_new_ref.trace(world, TRACE_RXN_REACTANT, TRACE_RXN_UNIMOL, time_from_event_start));
   p.set_molecule_as_defunct(vm_new_ref);
   return RX_DESTROY;
 }
@@ -685,4 +745,19 @@ void collision_t::dump_array(partition_t& p, const collision_vector_t& vec) {
   }
 }
 
+
+void collision_t::trace_array(const world_t* world, partition_t& p, const collision_vector_t& vec) {
+  for (const collision_t& c: vec) {
+    bool mol = (c.type == COLLISION_VOLMOL_VOLMOL);
+    const volume_molecule_t& vm = p.get_vm(c.diffused_molecule_id);
+    trace_event(
+        TRACE_COLLISION, mol ? TRACE_COLL_MOL : TRACE_COLL_WALL,
+        world->current_iteration, c.diffused_molecule_id,
+        mol ? c.colliding_molecule_id : 0,
+        world->species[vm.species_id].mcell3_species_id,
+        c.time, c.pos.x, c.pos.y, c.pos.z
+    );
+  }
+}
+
 } /* namespace mcell */
@@ -131,6 +131,8 @@ public:
   void dump(partition_t& p, const std::string ind) const;
   std::string to_string() const;
   static void dump_array(partition_t& p, const collision_vector_t& vec);
+  // adds the collisions to the event trace, see event_trace.h
+  static void trace_array(const world_t* world, partition_t& p, const collision_vector_t& vec);
 };
 
 
@@ -163,7 +165,7 @@ private:
   // molecules newly created in reactions
   std::vector<diffuse_or_unimol_react_action_t> new_diffuse_or_unimol_react_actions;
 
-  void diffuse_molecules(partition_t& p, const std::vector< molecule_id_t >& indices);
+  void diffuse_molecules(partition_t& p, const uint32_t time_step_index);
 
   void diffuse_single_molecule(
       partition_t& p,
@@ -27,6 +27,7 @@
 
 #include "molecule.h"
 #include "world.h"
+#include "event_trace.h"
 
 using namespace std;
 
@@ -83,6 +84,20 @@ void volume_molecule_t::dump(
 }
 
 
+void volume_molecule_t::trace(
+    const world_t* world,
+    const uint8_t type,
+    const uint8_t trace_flags,
+    const float_t time
+) const {
+  // species are recorded with their mcell3 ids so that traces can be compared
+  trace_event(
+      type, trace_flags, world->current_iteration, id, 0,
+      world->species[species_id].mcell3_species_id, time, pos.x, pos.y, pos.z
+  );
+}
+
+
 string volume_molecule_t::to_string() const {
   stringstream ss;
   ss <<
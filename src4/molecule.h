@@ -118,6 +118,13 @@ public:
       const uint64_t iteration,
       const float_t time = 0
   ) const;
+  // adds a record to the event trace, the counterpart of dump
+  void trace(
+      const world_t* world,
+      const uint8_t type,
+      const uint8_t trace_flags,
+      const float_t time = 0
+  ) const;
   std::string to_string() const;
   static void dump_array(const std::vector<volume_molecule_t>& vec);
 };
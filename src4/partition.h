@@ -97,6 +97,13 @@ public:
   }
 
 
+  // false if the molecule was defunct and then removed by defragmentation
+  bool is_molecule_present(const molecule_id_t id) const {
+    assert(id < volume_molecules_id_to_index_mapping.size());
+    return volume_molecules_id_to_index_mapping[id] != MOLECULE_INDEX_INVALID;
+  }
+
+
   molecule_id_t get_molecule_index(const volume_molecule_t& m) {
     // simply use pointer arithmetic to compute the molecule's index
     molecule_id_t res = m.id;
@@ -225,14 +232,19 @@ public:
   }
 
 
-  // any molecule flags are set by caller after the molecule is created by this method
-  volume_molecule_t& add_volume_molecule_with_time_step_index(volume_molecule_t vm_copy, const uint32_t time_step_index) {
+  // any molecule flags are set by caller after the molecule is created by this method,
+  // a molecule created with add_to_time_step_list == false is not diffused until
+  // it is added with add_to_time_step_list
+  volume_molecule_t& add_volume_molecule_with_time_step_index(
+      volume_molecule_t vm_copy, const uint32_t time_step_index, const bool add_to_time_step_list = true) {
     molecule_id_t molecule_id = next_molecule_id;
     next_molecule_id++;
     // and its index to the list sorted by time step
     // this is an array that changes only when molecule leaves this partition
     assert(time_step_index <= volume_molecules_data_per_time_step_array.size());
-    volume_molecules_data_per_time_step_array[time_step_index].molecule_ids.push_back(molecule_id);
+    if (add_to_time_step_list) {
+      volume_molecules_data_per_time_step_array[time_step_index].molecule_ids.push_back(molecule_id);
+    }
 
     // We always have to increase the size of the mappping array - its size is
     // large enough to hold indices for all molecules that were ever created,
@@ -257,6 +269,12 @@ public:
   }
 
 
+  void add_molecule_to_time_step_list(const molecule_id_t id, const uint32_t time_step_index) {
+    assert(time_step_index < volume_molecules_data_per_time_step_array.size());
+    volume_molecules_data_per_time_step_array[time_step_index].molecule_ids.push_back(id);
+  }
+
+
   void set_molecule_as_defunct(volume_molecule_t& vm) {
     // set that this molecule does not exist anymore
     vm.set_is_defunct();
@@ -265,6 +283,8 @@ public:
   }
 
 
+  // also used for DIFFUSE actions of molecules that join a time step class later,
+  // scheduled_time is absolute in both cases
   void add_unimolecular_action(float_t diffusion_time_step, const diffuse_or_unimol_react_action_t& unimol_react_action) {
     uint32_t time_step_index = get_or_add_molecule_list_index_for_time_step(diffusion_time_step);
     volume_molecules_data_per_time_step_array[time_step_index].calendar_for_unimol_rxs.insert(unimol_react_action, unimol_react_action.scheduled_time);
@@ -280,11 +300,15 @@ public:
   struct time_step_volume_molecules_data_t {
     // usually initialized with empty molecule_ids_ array
     time_step_volume_molecules_data_t(float_t time_step_, const std::vector< molecule_id_t > molecule_ids_)
-      : time_step(time_step_), molecule_ids(molecule_ids_), calendar_for_unimol_rxs(time_step_) {
+      : time_step(time_step_), diffused_until(TIME_SIMULATION_START),
+        molecule_ids(molecule_ids_), calendar_for_unimol_rxs(time_step_) {
     }
 
 		// diffusion time step value 
     float_t time_step;
+    // end of the last diffusion event of this time step, molecules created before this time
+    // have missed their chance to be diffused in it
+    float_t diffused_until;
     // molecule ids with this diffusion time step 
     std::vector<molecule_id_t> molecule_ids;
     // and unimolecular reactions scheduled while diffusing  molecules with this diffusion time step;
@@ -416,6 +440,11 @@ public:
 
   void dump();
 
+  // random numbers for everything that happens in this partition, each
+  // partition has its own stream so that the draws of one partition do not
+  // depend on the others
+  rng_state rng;
+
 private:
   // left, bottom, closest (lowest z) point of the partition
   vec3_t origin_corner;
@@ -63,9 +63,9 @@ void release_event_t::step() {
     vec3_t pos;
     do /* Pick values in unit square, toss if not in unit circle */
     {
-      pos.x = (rng_dbl(&world->rng) - 0.5);
-      pos.y = (rng_dbl(&world->rng) - 0.5);
-      pos.z = (rng_dbl(&world->rng) - 0.5);
+      pos.x = (rng_dbl(&p.rng) - 0.5);
+      pos.y = (rng_dbl(&p.rng) - 0.5);
+      pos.z = (rng_dbl(&p.rng) - 0.5);
     } while (is_spheroidal &&
              pos.x * pos.x + pos.y * pos.y + pos.z * pos.z >= 0.25);
 
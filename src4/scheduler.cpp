@@ -43,6 +43,9 @@ float_t scheduler_t::handle_next_event(bool &end_simulation) {
 #endif
   event->step();
 
+  // the event may be deleted right away
+  end_simulation = event->type_index == EVENT_TYPE_INDEX_END_SIMULATION;
+
   // schedule itself for the next period or just delete
   if (event->periodicity_interval != 0) {
     event->event_time += event->periodicity_interval;
@@ -52,7 +55,6 @@ float_t scheduler_t::handle_next_event(bool &end_simulation) {
     delete event;
   }
 
-  end_simulation = event->type_index == EVENT_TYPE_INDEX_END_SIMULATION;
   return event_time;
 }
 
@@ -180,8 +180,9 @@ bool world_t::run_simulation() {
     // this is where events get executed
     time = scheduler.handle_next_event(end_simulation);
 
-    // report progress
-    if (time > previous_time) {
+    // report progress, with time steps shorter than one iteration
+    // several events start within the same iteration
+    if (floor_to_multiple(time, 1) > floor_to_multiple(previous_time, 1)) {
       current_iteration++;
       if (current_iteration % output_frequency == 0) {
 
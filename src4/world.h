@@ -80,7 +80,17 @@ public:
         floor_to_multiple(pos, world_constants.partition_edge_length)
         - vec3_t(world_constants.partition_edge_length/2);
     partitions.push_back(partition_t(origin, world_constants, simulation_stats));
-    return partitions.size() - 1;
+
+    // the initial partition continues the global stream of MCell 3 so that
+    // both versions draw the same numbers
+    uint32_t index = partitions.size() - 1;
+    if (index == PARTITION_INDEX_INITIAL) {
+      partitions.back().rng = rng;
+    }
+    else {
+      rng_init_stream(&partitions.back().rng, seed_seq, RNG_STREAM_PARTITION, index);
+    }
+    return index;
   }
 
   // -------------- reaction utility methods --------------
@@ -168,7 +178,8 @@ public:
   world_constants_t world_constants;
   simulation_stats_t simulation_stats;
 
-  // single state for the random number generator
+  // state of the global random number stream, taken over by the initial
+  // partition, see add_partition
   rng_state rng;
 
   // in case when there would be many copies of a string, this constant pool can be used
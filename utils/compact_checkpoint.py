@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+
+###############################################################################
+#                                                                             #
+# Copyright (C) 2006-2017 by                                                  #
+# The Salk Institute for Biological Studies and                               #
+# Pittsburgh Supercomputing Center, Carnegie Mellon University                #
+#                                                                             #
+# This program is free software; you can redistribute it and/or               #
+# modify it under the terms of the GNU General Public License                 #
+# as published by the Free Software Foundation; either version 2              #
+# of the License, or (at your option) any later version.                      #
+#                                                                             #
+# This program is distributed in the hope that it will be useful,             #
+# but WITHOUT ANY WARRANTY; without even the implied warranty of              #
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               #
+# GNU General Public License for more details.                                #
+#                                                                             #
+# You should have received a copy of the GNU General Public License           #
+# along with this program; if not, write to the Free Software                 #
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,  #
+# USA.                                                                        #
+#                                                                             #
+###############################################################################
+
+"""
+Merges an incremental checkpoint base (written with -checkpoint_deltas) and
+the deltas next to it (<base>.d1, <base>.d2, ...) into a new base.
+
+By default the base is replaced and the merged deltas are removed.  Deltas
+written later by a simulation which is still running stay valid, because the
+new base records how many deltas it holds.
+"""
+
+import os
+import sys
+import struct
+import zlib
+import argparse
+
+import mcell_checkpoint as mc
+
+CHUNK_RECORDS = 65536
+
+# sections taken over from the last file, in the order MCell writes them
+PREAMBLE = [mc.CMD_BYTE_ORDER, mc.CMD_CHECKPOINT_API, mc.CMD_MCELL_VERSION]
+HEADER = [mc.CMD_CURRENT_TIME, mc.CMD_CURRENT_ITERATION, mc.CMD_CHKPT_SEQ_NUM,
+          mc.CMD_RNG_STATE, mc.CMD_SPECIES_TABLE]
+
+
+def read_chkpt(fname):
+    raw = {}
+    parsed = {}
+    for cmd, data, d in mc.read_sections(open(fname, 'rb').read()):
+        raw[cmd] = data
+        parsed.update(d)
+    if mc.CMD_SCHEDULER_STATE in raw:
+        raise Exception('%s is not an incremental checkpoint.' % fname)
+    return raw, parsed
+
+
+def merge(base):
+    raw, data = read_chkpt(base)
+    if 'chain_id' not in data or data['chain_kind'] != mc.LINK_BASE:
+        raise Exception('%s is not the base of incremental checkpoints.'
+                        % base)
+
+    chain_id = data['chain_id']
+    index = data['chain_index']
+    compress = data['compress']
+    mols = dict((m['id'], m) for m in data['molecules'])
+    merged = []
+
+    while True:
+        delta = '%s.d%d' % (base, index + 1)
+        if not os.path.exists(delta):
+            break
+        draw, ddata = read_chkpt(delta)
+        if (ddata.get('chain_id') != chain_id or
+                ddata.get('chain_kind') != mc.LINK_DELTA or
+                ddata.get('chain_index') != index + 1):
+            print('Ignoring %s, which was not written after %s.'
+                  % (delta, base))
+            break
+        for i in ddata.get('removed', []):
+            del mols[i]
+        for m in ddata['molecules']:
+            mols[m['id']] = m
+        raw = draw
+        index += 1
+        merged.append(delta)
+
+    return raw, data['endian'], chain_id, index, compress, mols, merged
+
+
+def chunk_section(endian, species, compress, mols):
+    e = '<' if endian == 'little' else '>'
+    ids = dict((name, i) for i, name in species.items())
+    records = [struct.pack(e + mc.MOL_RECORD, m['id'], m['t'], m['t2'],
+                           m['birthday'], m['pos'][0], m['pos'][1],
+                           m['pos'][2], ids[m['species']], m['orient'],
+                           int(m['newbie']), int(m['change']))
+               for m in mols]
+
+    n_chunks = (len(records) + CHUNK_RECORDS - 1) // CHUNK_RECORDS
+    out = [bytes([mc.CMD_MOL_CHUNKS]), mc.vint_bytes(len(records)),
+           mc.vint_bytes(n_chunks), bytes([compress])]
+    for first in range(0, len(records), CHUNK_RECORDS):
+        chunk = records[first:first + CHUNK_RECORDS]
+        payload = b''.join(chunk)
+        stored = zlib.compress(payload, 1) if compress == mc.CHUNK_ZLIB \
+            else payload
+        out.append(struct.pack(e + 'III', len(chunk), len(payload),
+                               len(stored)))
+        out.append(stored)
+    return b''.join(out)
+
+
+def compact(base, out_name):
+    raw, endian, chain_id, index, compress, mols, merged = merge(base)
+
+    species = dict(mc.read_species(
+        mc.UnmarshalBuffer(raw[mc.CMD_SPECIES_TABLE][1:]))['species'])
+    link = (bytes([mc.CMD_CHKPT_LINK]) + mc.vint_bytes(chain_id) +
+            mc.vint_bytes(index) + bytes([mc.LINK_BASE]))
+    ordered = [mols[i] for i in sorted(mols)]
+
+    tmp_name = out_name + '.tmp'
+    with open(tmp_name, 'wb') as f:
+        for cmd in PREAMBLE:
+            if cmd in raw:
+                f.write(raw[cmd])
+        f.write(link)
+        for cmd in HEADER:
+            f.write(raw[cmd])
+        f.write(chunk_section(endian, species, compress, ordered))
+    os.rename(tmp_name, out_name)
+
+    if out_name == base:
+        for delta in merged:
+            os.remove(delta)
+    print('Merged %d deltas into %s (%d molecules).'
+          % (len(merged), out_name, len(ordered)))
+
+
+def setup_argparser():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "-o", "--output",
+        help="write the new base here and leave the input files alone")
+    parser.add_argument("chkpt_file", help="name of the base checkpoint file")
+    return parser.parse_args()
+
+if __name__ == '__main__':
+
+    args = setup_argparser()
+    compact(args.chkpt_file, args.output or args.chkpt_file)
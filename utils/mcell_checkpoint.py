@@ -25,6 +25,7 @@
 
 import sys
 import struct
+import zlib
 import argparse
 
 
@@ -38,6 +39,10 @@ class UnmarshalBuffer(object):
         return self.__offset
     offset = property(get_offset)
 
+    def get_endian(self):
+        return self.__endian
+    endian = property(get_endian)
+
     def at_end(self):
         return self.__offset >= len(self.__data)
 
@@ -84,6 +89,22 @@ class UnmarshalBuffer(object):
         self.__offset += struct.calcsize(tmpl)
         return vals
 
+    def next_bytes(self, l):
+        b = self.__data[self.__offset:self.__offset + l]
+        if len(b) != l:
+            raise Exception('Sorry -- this file seems to be truncated.')
+        self.__offset += l
+        return b
+
+
+def vint_bytes(val):
+    out = [val & 0x7f]
+    val >>= 7
+    while val != 0:
+        out.append((val & 0x7f) | 0x80)
+        val >>= 7
+    return bytes(reversed(out))
+
 CMD_CURRENT_TIME      = 1
 CMD_CURRENT_ITERATION = 2
 CMD_CHKPT_SEQ_NUM     = 3
@@ -92,8 +113,19 @@ CMD_MCELL_VERSION     = 5
 CMD_SPECIES_TABLE     = 6
 CMD_SCHEDULER_STATE   = 7
 CMD_BYTE_ORDER        = 8
-CMD_NUM_CHKPT_CMD     = 9
+CMD_MOL_CHUNKS        = 9
 CMD_CHECKPOINT_API    = 10
+CMD_CHKPT_LINK        = 11
+CMD_MOL_REMOVED       = 12
+
+CHUNK_RAW  = 0
+CHUNK_ZLIB = 1
+
+LINK_BASE  = 0
+LINK_DELTA = 1
+
+# id, t, t2, birthday, x, y, z, species id, orient, newbie, change
+MOL_RECORD = 'QddddddIhBB'
 
 
 def read_api(ub):
@@ -131,6 +163,18 @@ def read_rng_state(ub):
                 'rng_cc':   cc,
                 'rng_rsl':  randrsl,
                 'rng_mm':   mm}
+    elif rngtype == b'P':
+        randcnt = ub.next_vint()
+        key = ub.next_struct('2I')
+        stream, counter = ub.next_struct('QQ')
+        randrsl = ub.next_struct('64I')
+        return {'rng_seed':    seed,
+                'rng_type':    'Philox4x32',
+                'rng_cnt':     randcnt,
+                'rng_key':     key,
+                'rng_stream':  stream,
+                'rng_counter': counter,
+                'rng_rsl':     randrsl}
     elif rngtype == b'M':
         a, b, c, d = ub.next_struct('IIII')
         return {'rng_seed': seed,
@@ -198,10 +242,57 @@ def read_scheduler(ub, spec):
     return {'molecules': molecules}
 
 
-def read_file(fname):
-    ub = UnmarshalBuffer(open(fname, 'rb').read())
-    data = {}
+def read_link(ub):
+    chain_id = ub.next_vint()
+    index = ub.next_vint()
+    kind = ub.next_byte()
+    return {'chain_id': chain_id, 'chain_index': index, 'chain_kind': kind}
+
+
+def read_removed(ub):
+    n = ub.next_vint()
+    ids = []
+    prev = 0
+    for i in range(n):
+        prev += ub.next_vint()
+        ids.append(prev)
+    return {'removed': ids}
+
+
+def read_chunks(ub, spec):
+    total = ub.next_vint()
+    n_chunks = ub.next_vint()
+    compress = ub.next_byte()
+    rec_size = struct.calcsize('<' + MOL_RECORD)
+    molecules = []
+    for c in range(n_chunks):
+        n, raw_size, stored_size = ub.next_struct('III')
+        payload = ub.next_bytes(stored_size)
+        if compress == CHUNK_ZLIB:
+            payload = zlib.decompress(payload)
+        if len(payload) != raw_size or raw_size != n * rec_size:
+            raise Exception('Sorry -- this file seems to be malformed.')
+        for vals in struct.iter_unpack(ub.endian + MOL_RECORD, payload):
+            molecules.append({'id':       vals[0],
+                              'species':  spec[vals[7]],
+                              'newbie':   vals[9] != 0,
+                              'change':   vals[10] != 0,
+                              't':        vals[1],
+                              't2':       vals[2],
+                              'birthday': vals[3],
+                              'pos':      (vals[4], vals[5], vals[6]),
+                              'orient':   vals[8]})
+    if len(molecules) != total:
+        raise Exception('Sorry -- this file seems to be malformed.')
+    return {'molecules': molecules, 'compress': compress}
+
+
+def read_sections(data):
+    """Yields (command, raw bytes, parsed contents) for each section."""
+    ub = UnmarshalBuffer(data)
+    species = {}
     while not ub.at_end():
+        start = ub.offset
         cmd = ub.next_byte()
         if cmd == CMD_CURRENT_TIME:
             d = read_current_time(ub)
@@ -215,18 +306,29 @@ def read_file(fname):
             d = read_mcell_version(ub)
         elif cmd == CMD_SPECIES_TABLE:
             d = read_species(ub)
+            species = d['species']
         elif cmd == CMD_SCHEDULER_STATE:
-            d = read_scheduler(ub, data['species'])
+            d = read_scheduler(ub, species)
         elif cmd == CMD_BYTE_ORDER:
             d = read_byte_order(ub)
-        elif cmd == CMD_NUM_CHKPT_CMD:
-            print("CMD_NUM_CHKPT_CMD")
+        elif cmd == CMD_MOL_CHUNKS:
+            d = read_chunks(ub, species)
         elif cmd == CMD_CHECKPOINT_API:
             d = read_api(ub)
+        elif cmd == CMD_CHKPT_LINK:
+            d = read_link(ub)
+        elif cmd == CMD_MOL_REMOVED:
+            d = read_removed(ub)
         else:
             raise Exception(
                 'Unknown command %02x in file. Perhaps the file is malformed.'
                 % cmd)
+        yield cmd, data[start:ub.offset], d
+
+
+def read_file(fname):
+    data = {}
+    for cmd, raw, d in read_sections(open(fname, 'rb').read()):
         data.update(d)
     return data
 
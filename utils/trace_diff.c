@@ -0,0 +1,229 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2019 by
+ * The Salk Institute for Biological Studies and
+ * Pittsburgh Supercomputing Center, Carnegie Mellon University
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+ * USA.
+ *
+******************************************************************************/
+
+/* trace_diff: compares two event traces written with -event_trace, e.g. one
+ * from MCell3 and one from MCell4, and reports the first event where they
+ * diverge.
+ *
+ *   trace_diff [-e tolerance] [-c context] [-t thread] trace_a trace_b
+ *
+ * Only the records of one thread are compared (default 0, the main thread),
+ * because the records of different threads are interleaved arbitrarily.
+ * Times and positions are compared with a relative tolerance, everything
+ * else exactly.  Exit status is 0 if the traces match, 1 if they differ and
+ * 2 on errors.
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "event_trace.h"
+
+#define MAX_CONTEXT 64
+
+static char const *const event_names[TRACE_N_EVENTS] = {
+  "?", "diffuse", "displacement", "collision", "rxn_time", "rxn_product",
+  "rxn_reactant", "rng",
+};
+
+struct trace_reader {
+  char const *filename;
+  FILE *f;
+  unsigned long long index; /* records of the thread read so far */
+};
+
+static int open_trace(struct trace_reader *r, char const *filename) {
+  r->filename = filename;
+  r->index = 0;
+  r->f = fopen(filename, "rb");
+  if (r->f == NULL) {
+    fprintf(stderr, "trace_diff: cannot open '%s': %s\n", filename,
+            strerror(errno));
+    return 1;
+  }
+
+  struct trace_file_header header;
+  if (fread(&header, sizeof(header), 1, r->f) != 1 ||
+      memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) != 0) {
+    fprintf(stderr, "trace_diff: '%s' is not an event trace\n", filename);
+    return 1;
+  }
+  if (header.version != TRACE_VERSION ||
+      header.record_size != sizeof(struct trace_record)) {
+    fprintf(stderr, "trace_diff: '%s' has version %u and record size %u, "
+                    "expected %u and %u\n",
+            filename, header.version, header.record_size, TRACE_VERSION,
+            (unsigned)sizeof(struct trace_record));
+    return 1;
+  }
+  return 0;
+}
+
+/* Reads the next record of the given thread.  Returns 1 if there was one,
+ * 0 at the end of the trace. */
+static int next_record(struct trace_reader *r, unsigned thread,
+                       struct trace_record *rec) {
+  while (fread(rec, sizeof(struct trace_record), 1, r->f) == 1) {
+    if (rec->thread == thread) {
+      r->index++;
+      return 1;
+    }
+  }
+  if (ferror(r->f)) {
+    fprintf(stderr, "trace_diff: error reading '%s': %s\n", r->filename,
+            strerror(errno));
+    exit(2);
+  }
+  return 0;
+}
+
+static int same_double(double a, double b, double tolerance) {
+  if (a == b)
+    return 1;
+  double scale = fmax(fabs(a), fabs(b));
+  return fabs(a - b) <= tolerance * (scale > 1.0 ? scale : 1.0);
+}
+
+static int same_record(struct trace_record const *a,
+                       struct trace_record const *b, double tolerance) {
+  if (a->type != b->type || a->flags != b->flags ||
+      a->species != b->species || a->iteration != b->iteration ||
+      a->id != b->id || a->id2 != b->id2)
+    return 0;
+  /* RNG records hold the generator state, which must match exactly */
+  if (a->type == TRACE_RNG)
+    return 1;
+  if (!same_double(a->time, b->time, tolerance))
+    return 0;
+  for (int i = 0; i < 3; i++)
+    if (!same_double(a->pos[i], b->pos[i], tolerance))
+      return 0;
+  return 1;
+}
+
+static void print_record(char const *prefix, unsigned long long index,
+                         struct trace_record const *rec) {
+  char const *name =
+      (rec->type < TRACE_N_EVENTS) ? event_names[rec->type] : "?";
+  if (rec->type == TRACE_RNG) {
+    printf("%s%llu: %s%s randcnt: %llu, aa: %llu, bb: %u, cc: %llu\n", prefix,
+           index, name, (rec->flags & TRACE_RNG_GAUSS) ? " (gauss)" : "",
+           (unsigned long long)rec->id, (unsigned long long)rec->id2,
+           rec->species, (unsigned long long)rec->iteration);
+    return;
+  }
+  printf("%s%llu: it: %llu, %s, flags: %u, id: %llu, id2: %llu, species: %u, "
+         "time: %.17g, pos: (%.17g, %.17g, %.17g)\n",
+         prefix, index, (unsigned long long)rec->iteration, name,
+         (unsigned)rec->flags, (unsigned long long)rec->id,
+         (unsigned long long)rec->id2, rec->species, rec->time, rec->pos[0],
+         rec->pos[1], rec->pos[2]);
+}
+
+static void usage(char const *argv0) {
+  fprintf(stderr,
+          "Usage: %s [-e tolerance] [-c context] [-t thread] trace_a trace_b\n"
+          "  -e tolerance  relative tolerance for times and positions "
+          "(default 1e-9)\n"
+          "  -c context    number of matching records to show before the "
+          "difference\n"
+          "                (default 5, at most %d)\n"
+          "  -t thread     index of the thread to compare (default 0)\n",
+          argv0, MAX_CONTEXT);
+}
+
+int main(int argc, char **argv) {
+  double tolerance = 1e-9;
+  int context = 5;
+  unsigned thread = 0;
+
+  int c;
+  while ((c = getopt(argc, argv, "e:c:t:h")) != -1) {
+    switch (c) {
+    case 'e':
+      tolerance = atof(optarg);
+      break;
+    case 'c':
+      context = atoi(optarg);
+      if (context < 0)
+        context = 0;
+      if (context > MAX_CONTEXT)
+        context = MAX_CONTEXT;
+      break;
+    case 't':
+      thread = (unsigned)atoi(optarg);
+      break;
+    default:
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (argc - optind != 2) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  struct trace_reader a, b;
+  if (open_trace(&a, argv[optind]) || open_trace(&b, argv[optind + 1]))
+    return 2;
+
+  /* the last 'context' matching records, in a ring */
+  struct trace_record history[MAX_CONTEXT];
+  unsigned long long n_history = 0; /* = records matched so far */
+
+  while (1) {
+    struct trace_record ra, rb;
+    int has_a = next_record(&a, thread, &ra);
+    int has_b = next_record(&b, thread, &rb);
+    if (!has_a && !has_b) {
+      printf("Traces match (%llu records of thread %u).\n", a.index, thread);
+      return 0;
+    }
+
+    if (has_a && has_b && same_record(&ra, &rb, tolerance)) {
+      if (context > 0)
+        history[n_history % context] = ra;
+      n_history++;
+      continue;
+    }
+
+    printf("Traces differ at record %llu of thread %u.\n", n_history, thread);
+    unsigned long long first =
+        (n_history > (unsigned)context) ? n_history - context : 0;
+    for (unsigned long long i = first; i < n_history; i++)
+      print_record("   ", i, &history[i % context]);
+    if (has_a)
+      print_record(" a ", n_history, &ra);
+    else
+      printf(" a %s ends here\n", a.filename);
+    if (has_b)
+      print_record(" b ", n_history, &rb);
+    else
+      printf(" b %s ends here\n", b.filename);
+    return 1;
+  }
+}